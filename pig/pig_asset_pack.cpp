@@ -0,0 +1,1033 @@
+/*
+File:   pig_asset_pack.cpp
+Date:   10\19\2026
+Description:
+	** Holds the functions that open, read and build asset packs (see pig_asset_pack.h), the small LZ4 block
+	** codec the packed entries are compressed with, and the platform api hooks that make the pack transparent
+*/
+
+#if PIG_ASSET_PACK
+
+// +--------------------------------------------------------------+
+// |                         Path Helpers                         |
+// +--------------------------------------------------------------+
+//Pack paths are compared case insensitively with either kind of slash, so "Resources\Textures\Test.png" finds "resources/textures/test.png"
+char NormalizeAssetPackPathChar(char c)
+{
+	if (c == '\\') { return '/'; }
+	if (c >= 'A' && c <= 'Z') { return (char)(c - 'A' + 'a'); }
+	return c;
+}
+MyStr_t TrimAssetPackPath(MyStr_t path)
+{
+	while (path.length >= 2 && path.chars[0] == '.' && (path.chars[1] == '/' || path.chars[1] == '\\')) { path.chars += 2; path.length -= 2; }
+	while (path.length > 0 && (path.chars[path.length-1] == '/' || path.chars[path.length-1] == '\\')) { path.length--; }
+	return path;
+}
+
+//FNV-1a over the normalized characters, so looking up a path never has to make a normalized copy of it
+u64 HashAssetPackPath(MyStr_t path)
+{
+	path = TrimAssetPackPath(path);
+	u64 result = 14695981039346656037ULL;
+	for (u64 cIndex = 0; cIndex < path.length; cIndex++)
+	{
+		result ^= (u8)NormalizeAssetPackPathChar(path.chars[cIndex]);
+		result *= 1099511628211ULL;
+	}
+	return result;
+}
+
+//Both paths must already be trimmed
+bool AssetPackPathsMatch(MyStr_t path1, MyStr_t path2)
+{
+	if (path1.length != path2.length) { return false; }
+	for (u64 cIndex = 0; cIndex < path1.length; cIndex++)
+	{
+		if (NormalizeAssetPackPathChar(path1.chars[cIndex]) != NormalizeAssetPackPathChar(path2.chars[cIndex])) { return false; }
+	}
+	return true;
+}
+
+MyStr_t GetAssetPackEntryPath(const AssetPack_t* pack, const AssetPackFileEntry_t* entry)
+{
+	NotNull2(pack, entry);
+	return NewStr(entry->pathLength, (char*)&pack->strings[entry->pathOffset]);
+}
+
+u64 AlignAssetPackOffset(u64 offset)
+{
+	return ((offset + (ASSET_PACK_ALIGNMENT-1)) / ASSET_PACK_ALIGNMENT) * ASSET_PACK_ALIGNMENT;
+}
+
+// +--------------------------------------------------------------+
+// |                       LZ4 Block Format                       |
+// +--------------------------------------------------------------+
+//NOTE: This is the plain LZ4 block format (no frame header or checksums, the pack entry holds the sizes). The compressor is
+//      the simple greedy single hash table version, it's nowhere near as fast as the reference lz4 but it only runs when building
+//      a pack. The decompressor is the part that matters at runtime and it checks every length against both buffers
+u64 Lz4CompressBound(u64 srcSize)
+{
+	return srcSize + (srcSize / 255) + 16;
+}
+
+u32 Lz4Read32(const u8* pntr)
+{
+	u32 result;
+	MyMemCopy(&result, pntr, sizeof(u32));
+	return result;
+}
+u32 Lz4HashSequence(u32 sequence)
+{
+	return (sequence * 2654435761U) >> (32 - ASSET_PACK_LZ4_HASH_BITS);
+}
+//Lengths of 15 or more spill into extra bytes after the token, 255 means keep going
+u8* Lz4WriteLengthBytes(u8* outPntr, u64 length)
+{
+	while (length >= 255) { *outPntr = 255; outPntr++; length -= 255; }
+	*outPntr = (u8)length;
+	outPntr++;
+	return outPntr;
+}
+
+//hashTable must hold ASSET_PACK_LZ4_HASH_SIZE u32s. Returns the compressed size, or 0 if it didn't fit in destCapacity
+u64 Lz4CompressBlock(const u8* src, u64 srcSize, u8* dest, u64 destCapacity, u32* hashTable)
+{
+	NotNull3(src, dest, hashTable);
+	Assert(srcSize <= 0x7FFFFFFF); //positions are stored as u32 in the hash table
+	MyMemSet(hashTable, 0x00, sizeof(u32) * ASSET_PACK_LZ4_HASH_SIZE);
+	u8* outPntr = dest;
+	u8* outEnd = dest + destCapacity;
+	u64 anchor = 0; //start of the literals that haven't been written yet
+	
+	if (srcSize > ASSET_PACK_LZ4_MF_LIMIT)
+	{
+		u64 matchStartLimit = srcSize - ASSET_PACK_LZ4_MF_LIMIT;
+		u64 matchEndLimit = srcSize - ASSET_PACK_LZ4_LAST_LITERALS;
+		u64 position = 0;
+		while (position < matchStartLimit)
+		{
+			u32 sequence = Lz4Read32(&src[position]);
+			u32 hash = Lz4HashSequence(sequence);
+			u64 candidate = hashTable[hash];
+			hashTable[hash] = (u32)position;
+			if (candidate >= position || position - candidate > ASSET_PACK_LZ4_MAX_OFFSET || Lz4Read32(&src[candidate]) != sequence)
+			{
+				position += 1 + ((position - anchor) >> ASSET_PACK_LZ4_SKIP_TRIGGER);
+				continue;
+			}
+			
+			u64 matchLength = ASSET_PACK_LZ4_MIN_MATCH;
+			while (position + matchLength < matchEndLimit && src[candidate + matchLength] == src[position + matchLength]) { matchLength++; }
+			
+			u64 literalLength = position - anchor;
+			u64 maxSequenceSize = 1 + (literalLength / 255) + 1 + literalLength + 2 + (matchLength / 255) + 1;
+			if ((u64)(outEnd - outPntr) < maxSequenceSize) { return 0; }
+			
+			u8* tokenPntr = outPntr;
+			outPntr++;
+			u8 token = 0;
+			if (literalLength >= 15) { token = 0xF0; outPntr = Lz4WriteLengthBytes(outPntr, literalLength - 15); }
+			else { token = (u8)(literalLength << 4); }
+			MyMemCopy(outPntr, &src[anchor], literalLength);
+			outPntr += literalLength;
+			
+			u64 offset = position - candidate;
+			outPntr[0] = (u8)(offset & 0xFF);
+			outPntr[1] = (u8)(offset >> 8);
+			outPntr += 2;
+			
+			u64 matchCode = matchLength - ASSET_PACK_LZ4_MIN_MATCH;
+			if (matchCode >= 15) { token |= 0x0F; outPntr = Lz4WriteLengthBytes(outPntr, matchCode - 15); }
+			else { token |= (u8)matchCode; }
+			*tokenPntr = token;
+			
+			position += matchLength;
+			anchor = position;
+		}
+	}
+	
+	//The last sequence is only literals
+	u64 literalLength = srcSize - anchor;
+	u64 lastSequenceSize = 1 + (literalLength / 255) + 1 + literalLength;
+	if ((u64)(outEnd - outPntr) < lastSequenceSize) { return 0; }
+	if (literalLength >= 15) { *outPntr = 0xF0; outPntr++; outPntr = Lz4WriteLengthBytes(outPntr, literalLength - 15); }
+	else { *outPntr = (u8)(literalLength << 4); outPntr++; }
+	MyMemCopy(outPntr, &src[anchor], literalLength);
+	outPntr += literalLength;
+	
+	return (u64)(outPntr - dest);
+}
+
+//Returns false if src isn't a valid block or doesn't decompress to exactly destSize bytes
+bool Lz4DecompressBlock(const u8* src, u64 srcSize, u8* dest, u64 destSize)
+{
+	NotNull(src);
+	Assert(dest != nullptr || destSize == 0);
+	const u8* inPntr = src;
+	const u8* inEnd = src + srcSize;
+	u64 outIndex = 0;
+	while (inPntr < inEnd)
+	{
+		u8 token = *inPntr;
+		inPntr++;
+		
+		u64 literalLength = (token >> 4);
+		if (literalLength == 15)
+		{
+			u8 lengthByte = 255;
+			while (lengthByte == 255)
+			{
+				if (inPntr >= inEnd) { return false; }
+				lengthByte = *inPntr;
+				inPntr++;
+				literalLength += lengthByte;
+			}
+		}
+		if (literalLength > (u64)(inEnd - inPntr) || literalLength > destSize - outIndex) { return false; }
+		MyMemCopy(&dest[outIndex], inPntr, literalLength);
+		inPntr += literalLength;
+		outIndex += literalLength;
+		if (inPntr >= inEnd) { break; } //the last sequence has no match
+		
+		if (inEnd - inPntr < 2) { return false; }
+		u64 offset = (u64)inPntr[0] | ((u64)inPntr[1] << 8);
+		inPntr += 2;
+		if (offset == 0 || offset > outIndex) { return false; }
+		
+		u64 matchLength = (token & 0x0F);
+		if (matchLength == 15)
+		{
+			u8 lengthByte = 255;
+			while (lengthByte == 255)
+			{
+				if (inPntr >= inEnd) { return false; }
+				lengthByte = *inPntr;
+				inPntr++;
+				matchLength += lengthByte;
+			}
+		}
+		matchLength += ASSET_PACK_LZ4_MIN_MATCH;
+		if (matchLength > destSize - outIndex) { return false; }
+		
+		//Matches are allowed to overlap the bytes they are producing (that's how runs get encoded) so those have to go a byte at a time
+		const u8* matchPntr = &dest[outIndex - offset];
+		if (offset >= matchLength) { MyMemCopy(&dest[outIndex], matchPntr, matchLength); }
+		else { for (u64 bIndex = 0; bIndex < matchLength; bIndex++) { dest[outIndex + bIndex] = matchPntr[bIndex]; } }
+		outIndex += matchLength;
+	}
+	return (outIndex == destSize);
+}
+
+// +--------------------------------------------------------------+
+// |                        Reading Entries                       |
+// +--------------------------------------------------------------+
+const AssetPackFileEntry_t* FindAssetPackEntry(const AssetPack_t* pack, MyStr_t path, u64* entryIndexOut = nullptr)
+{
+	NotNull(pack);
+	if (!pack->isOpen || path.length == 0) { return nullptr; }
+	path = TrimAssetPackPath(path);
+	u64 hash = HashAssetPackPath(path);
+	u64 slotMask = pack->header->numSlots - 1;
+	for (u64 probe = 0; probe < pack->header->numSlots; probe++)
+	{
+		u32 slotValue = pack->slots[(hash + probe) & slotMask];
+		if (slotValue == ASSET_PACK_EMPTY_SLOT) { return nullptr; }
+		const AssetPackFileEntry_t* entry = &pack->entries[slotValue-1];
+		if (entry->pathHash == hash && AssetPackPathsMatch(path, GetAssetPackEntryPath(pack, entry)))
+		{
+			if (entryIndexOut != nullptr) { *entryIndexOut = slotValue-1; }
+			return entry;
+		}
+	}
+	return nullptr;
+}
+
+//There are no folder entries in a pack, a folder "exists" if some entry's path starts with it. This is a linear search so it's only meant for the occasional DoesFileExist
+bool IsAssetPackFolder(const AssetPack_t* pack, MyStr_t folderPath)
+{
+	NotNull(pack);
+	if (!pack->isOpen) { return false; }
+	folderPath = TrimAssetPackPath(folderPath);
+	if (folderPath.length == 0) { return false; }
+	for (u64 eIndex = 0; eIndex < pack->header->numEntries; eIndex++)
+	{
+		const AssetPackFileEntry_t* entry = &pack->entries[eIndex];
+		MyStr_t entryPath = GetAssetPackEntryPath(pack, entry);
+		if (entryPath.length <= folderPath.length || NormalizeAssetPackPathChar(entryPath.chars[folderPath.length]) != '/') { continue; }
+		if (AssetPackPathsMatch(folderPath, NewStr(folderPath.length, entryPath.chars))) { return true; }
+	}
+	return false;
+}
+
+//Doesn't look at the cache. Safe to call from any thread
+bool DecompressAssetPackEntry(const AssetPack_t* pack, u64 entryIndex, u8* dest)
+{
+	NotNull(pack);
+	Assert(pack->isOpen && entryIndex < pack->header->numEntries);
+	const AssetPackFileEntry_t* entry = &pack->entries[entryIndex];
+	const u8* storedData = pack->mappedFile.data + entry->dataOffset;
+	switch (entry->compression)
+	{
+		case AssetPackCompression_None: MyMemCopy(dest, storedData, entry->size); return true;
+		case AssetPackCompression_Lz4:  return Lz4DecompressBlock(storedData, entry->storedSize, dest, entry->size);
+		default: return false;
+	}
+}
+
+//Every hooked file call lands here, usually from several threads at once, so this must not take pack->mutex
+void CountAssetPackCall(volatile u64* counter)
+{
+	NotNull(counter);
+	PigAtomicFetchAdd(counter, 1);
+}
+
+//Writes the whole entry into dest, which must have room for entry->size bytes. Safe to call from any thread
+bool ReadAssetPackEntry(AssetPack_t* pack, u64 entryIndex, u8* dest)
+{
+	NotNull(pack);
+	Assert(pack->isOpen && entryIndex < pack->header->numEntries);
+	const AssetPackFileEntry_t* entry = &pack->entries[entryIndex];
+	if (entry->compression == AssetPackCompression_None) { return DecompressAssetPackEntry(pack, entryIndex, dest); }
+	
+	bool copiedFromCache = false;
+	plat->LockMutex(&pack->mutex, MUTEX_LOCK_INFINITE);
+	if (pack->cacheOffsets[entryIndex] != ASSET_PACK_NOT_CACHED)
+	{
+		MyMemCopy(dest, pack->cache + pack->cacheOffsets[entryIndex], entry->size);
+		copiedFromCache = true;
+	}
+	plat->UnlockMutex(&pack->mutex);
+	
+	if (copiedFromCache) { return true; }
+	CountAssetPackCall(&pack->stats.numDecompressed);
+	return DecompressAssetPackEntry(pack, entryIndex, dest);
+}
+
+//Returns a pointer to the whole entry that stays valid until it's passed to ReleaseAssetPackEntryView. Uncompressed entries point straight
+//into the mapping, compressed ones point into the cache or into a copy we decompress right now. Safe to call from any thread
+const u8* AcquireAssetPackEntryView(AssetPack_t* pack, u64 entryIndex)
+{
+	NotNull(pack);
+	Assert(pack->isOpen && entryIndex < pack->header->numEntries);
+	const AssetPackFileEntry_t* entry = &pack->entries[entryIndex];
+	const u8* result = nullptr;
+	plat->LockMutex(&pack->mutex, MUTEX_LOCK_INFINITE);
+	if (entry->compression == AssetPackCompression_None)
+	{
+		result = pack->mappedFile.data + entry->dataOffset;
+		pack->numOpenViews++;
+	}
+	else if (pack->cacheOffsets[entryIndex] != ASSET_PACK_NOT_CACHED)
+	{
+		result = pack->cache + pack->cacheOffsets[entryIndex];
+		pack->numCacheViews++;
+	}
+	plat->UnlockMutex(&pack->mutex);
+	if (result != nullptr) { return result; }
+	
+	Assert(entry->size > 0); //only entries of at least ASSET_PACK_MIN_COMPRESS_SIZE get compressed
+	u8* ownedData = AllocArray(&pig->threadSafeHeap, u8, entry->size);
+	if (ownedData == nullptr) { return nullptr; }
+	if (!DecompressAssetPackEntry(pack, entryIndex, ownedData))
+	{
+		FreeMem(&pig->threadSafeHeap, ownedData, entry->size);
+		return nullptr;
+	}
+	
+	plat->LockMutex(&pack->mutex, MUTEX_LOCK_INFINITE);
+	AssetPackOwnedView_t* newView = VarArrayAdd(&pack->ownedViews, AssetPackOwnedView_t);
+	NotNull(newView);
+	newView->data = ownedData;
+	newView->size = entry->size;
+	plat->UnlockMutex(&pack->mutex);
+	CountAssetPackCall(&pack->stats.numDecompressed);
+	return ownedData;
+}
+
+//Returns false if data didn't come from AcquireAssetPackEntryView on this pack
+bool ReleaseAssetPackEntryView(AssetPack_t* pack, const u8* data)
+{
+	NotNull(pack);
+	if (!pack->isOpen || data == nullptr) { return false; }
+	bool result = false;
+	plat->LockMutex(&pack->mutex, MUTEX_LOCK_INFINITE);
+	//Owned views are checked first, a heap allocation could sit right after the end of the mapping (and empty entries at the end point there)
+	VarArrayLoop(&pack->ownedViews, vIndex)
+	{
+		VarArrayLoopGet(AssetPackOwnedView_t, view, &pack->ownedViews, vIndex);
+		if (view->data == data)
+		{
+			FreeMem(&pig->threadSafeHeap, (u8*)view->data, view->size);
+			VarArrayRemove(&pack->ownedViews, vIndex, AssetPackOwnedView_t);
+			result = true;
+			break;
+		}
+	}
+	if (!result && data >= pack->mappedFile.data && data <= pack->mappedFile.data + pack->mappedFile.size)
+	{
+		Assert(pack->numOpenViews > 0);
+		pack->numOpenViews--;
+		result = true;
+	}
+	else if (!result && pack->cache != nullptr && data >= pack->cache && data < pack->cache + pack->cacheSize)
+	{
+		Assert(pack->numCacheViews > 0);
+		pack->numCacheViews--;
+		result = true;
+	}
+	plat->UnlockMutex(&pack->mutex);
+	return result;
+}
+
+// +--------------------------------------------------------------+
+// |                           Prefetch                           |
+// +--------------------------------------------------------------+
+//NOTE: This runs on thread pool threads (see PigTask_DecompressAssets) so it must not allocate or touch anything but the prefetch items and the cache
+void DecompressAssetPackRange(AssetPack_t* pack, u64 firstItem, u64 numItems)
+{
+	NotNull(pack);
+	Assert(firstItem + numItems <= pack->numPrefetchItems);
+	for (u64 iIndex = firstItem; iIndex < firstItem + numItems; iIndex++)
+	{
+		AssetPackPrefetchItem_t* item = &pack->prefetchItems[iIndex];
+		item->success = DecompressAssetPackEntry(pack, item->entryIndex, pack->cache + item->cacheOffset);
+	}
+}
+
+//Decompresses every compressed entry (up to ASSET_PACK_MAX_CACHE_SIZE worth) into one cache allocation. The work is split into ranges
+//of roughly equal output size, all but the first are queued on the thread pool and this thread does the first one and then waits for the rest.
+//Until ReleaseAssetPackCache, ReadFileContents and MapFile serve those entries out of the cache
+void PrefetchAssetPack(AssetPack_t* pack, bool useThreadPool = true)
+{
+	NotNull(pack);
+	Assert(pack->isOpen);
+	AssertSingleThreaded();
+	pack->numQueuedTasks = 0;
+	if (pack->cache != nullptr || pack->numCompressed == 0) { return; }
+	
+	pack->prefetchItems = AllocArray(pack->allocArena, AssetPackPrefetchItem_t, pack->numCompressed);
+	NotNull(pack->prefetchItems);
+	pack->numPrefetchItems = 0;
+	u64 cacheSize = 0;
+	for (u64 eIndex = 0; eIndex < pack->header->numEntries; eIndex++)
+	{
+		const AssetPackFileEntry_t* entry = &pack->entries[eIndex];
+		if (entry->compression == AssetPackCompression_None) { continue; }
+		if (cacheSize + entry->size > ASSET_PACK_MAX_CACHE_SIZE) { continue; }
+		Assert(pack->numPrefetchItems < pack->numCompressed);
+		AssetPackPrefetchItem_t* item = &pack->prefetchItems[pack->numPrefetchItems];
+		item->entryIndex = (u32)eIndex;
+		item->success = false;
+		item->cacheOffset = cacheSize;
+		pack->numPrefetchItems++;
+		cacheSize = AlignAssetPackOffset(cacheSize + entry->size);
+	}
+	
+	u8* cache = (pack->numPrefetchItems > 0) ? AllocArray(&pig->largeAllocHeap, u8, cacheSize) : nullptr;
+	if (cache == nullptr)
+	{
+		if (pack->numPrefetchItems > 0) { PrintLine_W("Failed to allocate %s for the asset pack cache", FormatBytesNt(cacheSize, GetTempArena())); }
+		FreeMem(pack->allocArena, pack->prefetchItems, sizeof(AssetPackPrefetchItem_t) * pack->numCompressed);
+		pack->prefetchItems = nullptr;
+		pack->numPrefetchItems = 0;
+		return;
+	}
+	plat->LockMutex(&pack->mutex, MUTEX_LOCK_INFINITE);
+	pack->cache = cache;
+	pack->cacheSize = cacheSize;
+	plat->UnlockMutex(&pack->mutex);
+	
+	u64 numRanges = 1;
+	if (useThreadPool && pack->semaphoreCreated)
+	{
+		numRanges = platInfo->numThreadPoolThreads + 1;
+		if (numRanges > ASSET_PACK_MAX_TASKS) { numRanges = ASSET_PACK_MAX_TASKS; }
+		u64 maxRanges = MaxU64(cacheSize / ASSET_PACK_MIN_BYTES_PER_TASK, 1);
+		if (numRanges > maxRanges) { numRanges = maxRanges; }
+		if (numRanges > pack->numPrefetchItems) { numRanges = pack->numPrefetchItems; }
+	}
+	
+	if (numRanges <= 1) { DecompressAssetPackRange(pack, 0, pack->numPrefetchItems); }
+	else
+	{
+		u64 bytesPerRange = cacheSize / numRanges;
+		u64 rangeIndex = 0;
+		u64 rangeBytes = 0;
+		pack->ranges[0].pack = pack;
+		pack->ranges[0].firstItem = 0;
+		pack->ranges[0].numItems = 0;
+		for (u64 iIndex = 0; iIndex < pack->numPrefetchItems; iIndex++)
+		{
+			if (rangeBytes >= bytesPerRange && rangeIndex+1 < numRanges)
+			{
+				rangeIndex++;
+				pack->ranges[rangeIndex].pack = pack;
+				pack->ranges[rangeIndex].firstItem = iIndex;
+				pack->ranges[rangeIndex].numItems = 0;
+				rangeBytes = 0;
+			}
+			pack->ranges[rangeIndex].numItems++;
+			rangeBytes += pack->entries[pack->prefetchItems[iIndex].entryIndex].size;
+		}
+		numRanges = rangeIndex+1;
+		
+		for (u64 rIndex = 1; rIndex < numRanges; rIndex++)
+		{
+			AssetPackTaskRange_t* range = &pack->ranges[rIndex];
+			PlatTaskInput_t taskInput = {};
+			taskInput.type = PigTask_DecompressAssets;
+			taskInput.inputSize1 = sizeof(AssetPackTaskRange_t);
+			taskInput.inputPntr1 = range;
+			taskInput.inputArena1 = nullptr; //the pack owns the ranges
+			if (plat->QueueTask(&taskInput) != nullptr) { pack->numQueuedTasks++; }
+			else { DecompressAssetPackRange(pack, range->firstItem, range->numItems); }
+		}
+		
+		DecompressAssetPackRange(pack, pack->ranges[0].firstItem, pack->ranges[0].numItems);
+		for (u64 tIndex = 0; tIndex < pack->numQueuedTasks; tIndex++)
+		{
+			plat->WaitOnSemaphore(&pack->doneSemaphore, SEMAPHORE_WAIT_INFINITE);
+		}
+	}
+	
+	//The offsets only become visible once everything is decompressed, so the thread pool can't read a half written entry out of the cache
+	u64 numFailed = 0;
+	plat->LockMutex(&pack->mutex, MUTEX_LOCK_INFINITE);
+	for (u64 iIndex = 0; iIndex < pack->numPrefetchItems; iIndex++)
+	{
+		const AssetPackPrefetchItem_t* item = &pack->prefetchItems[iIndex];
+		if (item->success) { pack->cacheOffsets[item->entryIndex] = item->cacheOffset; }
+		else { numFailed++; }
+	}
+	plat->UnlockMutex(&pack->mutex);
+	if (numFailed > 0) { PrintLine_W("%llu asset pack entr%s failed to decompress", numFailed, (numFailed == 1) ? "y" : "ies"); }
+	
+	FreeMem(pack->allocArena, pack->prefetchItems, sizeof(AssetPackPrefetchItem_t) * pack->numCompressed);
+	pack->prefetchItems = nullptr;
+	pack->numPrefetchItems = 0;
+}
+
+//Compressed entries go back to being decompressed on demand. Returns false (and keeps the cache) while files mapped out of it are still open
+bool ReleaseAssetPackCache(AssetPack_t* pack)
+{
+	NotNull(pack);
+	AssertSingleThreaded();
+	if (pack->cache == nullptr) { return true; }
+	plat->LockMutex(&pack->mutex, MUTEX_LOCK_INFINITE);
+	if (pack->numCacheViews > 0)
+	{
+		plat->UnlockMutex(&pack->mutex);
+		return false;
+	}
+	u8* cache = pack->cache;
+	u64 cacheSize = pack->cacheSize;
+	for (u64 eIndex = 0; eIndex < pack->header->numEntries; eIndex++) { pack->cacheOffsets[eIndex] = ASSET_PACK_NOT_CACHED; }
+	pack->cache = nullptr;
+	pack->cacheSize = 0;
+	plat->UnlockMutex(&pack->mutex);
+	FreeMem(&pig->largeAllocHeap, cache, cacheSize);
+	return true;
+}
+
+// +--------------------------------------------------------------+
+// |                        Open and Close                        |
+// +--------------------------------------------------------------+
+bool IsAssetPackFileValid(const u8* fileData, u64 fileSize, const char** reasonOut)
+{
+	NotNull2(fileData, reasonOut);
+	if (fileSize < sizeof(AssetPackFileHeader_t)) { *reasonOut = "File is too small"; return false; }
+	const AssetPackFileHeader_t* header = (const AssetPackFileHeader_t*)fileData;
+	if (MyMemCompare(&header->magic[0], ASSET_PACK_MAGIC, sizeof(header->magic)) != 0) { *reasonOut = "Wrong magic"; return false; }
+	if (header->version != ASSET_PACK_VERSION) { *reasonOut = "Unsupported version"; return false; }
+	if (header->fileSize != fileSize) { *reasonOut = "File is truncated"; return false; }
+	if (header->numEntries == 0) { *reasonOut = "Pack has no entries"; return false; }
+	if (header->numSlots <= header->numEntries || (header->numSlots & (header->numSlots-1)) != 0) { *reasonOut = "Invalid slot count"; return false; }
+	if (header->slotsOffset > fileSize || (u64)header->numSlots * sizeof(u32) > fileSize - header->slotsOffset) { *reasonOut = "Slot table is out of bounds"; return false; }
+	if (header->entriesOffset > fileSize || (u64)header->numEntries * sizeof(AssetPackFileEntry_t) > fileSize - header->entriesOffset) { *reasonOut = "Entry table is out of bounds"; return false; }
+	if (header->stringsOffset > fileSize || header->stringsSize > fileSize - header->stringsOffset) { *reasonOut = "String table is out of bounds"; return false; }
+	if (header->dataOffset > fileSize) { *reasonOut = "Data is out of bounds"; return false; }
+	
+	const u32* slots = (const u32*)(fileData + header->slotsOffset);
+	for (u64 sIndex = 0; sIndex < header->numSlots; sIndex++)
+	{
+		if (slots[sIndex] > header->numEntries) { *reasonOut = "Invalid slot"; return false; }
+	}
+	const AssetPackFileEntry_t* entries = (const AssetPackFileEntry_t*)(fileData + header->entriesOffset);
+	for (u64 eIndex = 0; eIndex < header->numEntries; eIndex++)
+	{
+		const AssetPackFileEntry_t* entry = &entries[eIndex];
+		if (entry->compression >= AssetPackCompression_NumTypes) { *reasonOut = "Unknown compression"; return false; }
+		if ((u64)entry->pathOffset + entry->pathLength >= header->stringsSize) { *reasonOut = "Entry path is out of bounds"; return false; }
+		if (entry->dataOffset < header->dataOffset || (entry->dataOffset % ASSET_PACK_ALIGNMENT) != 0) { *reasonOut = "Entry data is misplaced"; return false; }
+		if (entry->dataOffset > fileSize || entry->storedSize > fileSize - entry->dataOffset) { *reasonOut = "Entry data is out of bounds"; return false; }
+		if (entry->compression == AssetPackCompression_None && entry->storedSize != entry->size) { *reasonOut = "Uncompressed entry has the wrong size"; return false; }
+		if (entry->compression != AssetPackCompression_None && entry->size == 0) { *reasonOut = "Compressed entry is empty"; return false; }
+	}
+	return true;
+}
+
+void CloseAssetPack(AssetPack_t* pack)
+{
+	NotNull(pack);
+	if (pack->isOpen)
+	{
+		AssertMsg(pack->numOpenViews == 0 && pack->numCacheViews == 0 && pack->ownedViews.length == 0, "An asset pack was closed while files mapped out of it were still open");
+		if (pack->isHooked)
+		{
+			if (plat == &pack->hookedApi) { plat = pack->realApi; }
+			pack->isHooked = false;
+		}
+		bool cacheReleased = ReleaseAssetPackCache(pack);
+		Assert(cacheReleased);
+		UNUSED(cacheReleased);
+		FreeMem(pack->allocArena, pack->cacheOffsets, sizeof(u64) * pack->header->numEntries);
+		FreeVarArray(&pack->ownedViews);
+		if (pack->semaphoreCreated) { pack->realApi->DestroySemaphore(&pack->doneSemaphore); }
+		pack->realApi->DestroyMutex(&pack->mutex);
+		pack->realApi->UnmapFile(&pack->mappedFile);
+		FreeString(pack->allocArena, &pack->filePath);
+	}
+	ClearPointer(pack);
+}
+
+//Maps the pack with the real platform api and checks the tables. Doesn't hook anything, see HookAssetPack
+bool OpenAssetPack(AssetPack_t* pack, MemArena_t* memArena, MyStr_t filePath, const PlatformApi_t* realApi)
+{
+	NotNull3(pack, memArena, realApi);
+	NotNullStr(&filePath);
+	ClearPointer(pack);
+	if (!realApi->MapFile(filePath, &pack->mappedFile))
+	{
+		PrintLine_E("Failed to map asset pack at \"%.*s\"", StrPrint(filePath));
+		ClearPointer(pack);
+		return false;
+	}
+	const char* invalidReason = nullptr;
+	if (!IsAssetPackFileValid(pack->mappedFile.data, pack->mappedFile.size, &invalidReason))
+	{
+		PrintLine_E("Invalid asset pack at \"%.*s\": %s", StrPrint(filePath), invalidReason);
+		realApi->UnmapFile(&pack->mappedFile);
+		ClearPointer(pack);
+		return false;
+	}
+	
+	pack->allocArena = memArena;
+	pack->realApi = realApi;
+	pack->filePath = AllocString(memArena, &filePath);
+	NotNullStr(&pack->filePath);
+	pack->header = (const AssetPackFileHeader_t*)pack->mappedFile.data;
+	pack->slots = (const u32*)(pack->mappedFile.data + pack->header->slotsOffset);
+	pack->entries = (const AssetPackFileEntry_t*)(pack->mappedFile.data + pack->header->entriesOffset);
+	pack->strings = (const char*)(pack->mappedFile.data + pack->header->stringsOffset);
+	for (u64 eIndex = 0; eIndex < pack->header->numEntries; eIndex++)
+	{
+		if (pack->entries[eIndex].compression != AssetPackCompression_None) { pack->numCompressed++; }
+		pack->totalSize += pack->entries[eIndex].size;
+	}
+	
+	pack->cacheOffsets = AllocArray(memArena, u64, pack->header->numEntries);
+	NotNull(pack->cacheOffsets);
+	for (u64 eIndex = 0; eIndex < pack->header->numEntries; eIndex++) { pack->cacheOffsets[eIndex] = ASSET_PACK_NOT_CACHED; }
+	CreateVarArray(&pack->ownedViews, &pig->threadSafeHeap, sizeof(AssetPackOwnedView_t));
+	realApi->CreateMutex(&pack->mutex);
+	if (platInfo->numThreadPoolThreads > 0)
+	{
+		realApi->CreateSemaphore(&pack->doneSemaphore, 0, ASSET_PACK_MAX_TASKS);
+		pack->semaphoreCreated = true;
+	}
+	
+	pack->isOpen = true;
+	return true;
+}
+
+// +--------------------------------------------------------------+
+// |                      Platform Api Hooks                      |
+// +--------------------------------------------------------------+
+//NOTE: While pig->assetPack is hooked (see HookAssetPack) these are called instead of the platform layer's functions, possibly from thread pool threads.
+//      Anything that isn't in the pack falls through to the real function so loose files next to the pack keep working
+
+// +==============================+
+// |   AssetPack_DoesFileExist    |
+// +==============================+
+// bool DoesFileExist(MyStr_t filePath, bool* isFolderOut)
+PLAT_API_DOES_FILE_EXIST_DEF(AssetPack_DoesFileExist)
+{
+	AssetPack_t* pack = &pig->assetPack;
+	if (FindAssetPackEntry(pack, filePath) != nullptr)
+	{
+		if (isFolderOut != nullptr) { *isFolderOut = false; }
+		return true;
+	}
+	if (pack->realApi->DoesFileExist(filePath, isFolderOut)) { return true; }
+	if (IsAssetPackFolder(pack, filePath))
+	{
+		if (isFolderOut != nullptr) { *isFolderOut = true; }
+		return true;
+	}
+	return false;
+}
+
+// +==============================+
+// |  AssetPack_ReadFileContents  |
+// +==============================+
+// bool ReadFileContents(MyStr_t filePath, MemArena_t* memArena, bool convertNewLines, PlatFileContents_t* contentsOut)
+PLAT_API_READ_FILE_CONTENTS_DEF(AssetPack_ReadFileContents)
+{
+	AssetPack_t* pack = &pig->assetPack;
+	NotNull(contentsOut);
+	u64 entryIndex = 0;
+	const AssetPackFileEntry_t* entry = FindAssetPackEntry(pack, filePath, &entryIndex);
+	if (entry == nullptr)
+	{
+		CountAssetPackCall(&pack->stats.numFallbacks);
+		return pack->realApi->ReadFileContents(filePath, memArena, convertNewLines, contentsOut);
+	}
+	CountAssetPackCall(&pack->stats.numReads);
+	
+	//This has to look exactly like the platform layer's result so plat->FreeFileContents can free it
+	ClearPointer(contentsOut);
+	if (memArena == nullptr) { memArena = platInfo->stdHeap; }
+	u8* resultData = AllocArray(memArena, u8, entry->size+1); //+1 for null-term
+	NotNullMsg(resultData, "Failed to allocate space to hold file contents. The application probably tried to open a massive file");
+	if (!ReadAssetPackEntry(pack, entryIndex, resultData))
+	{
+		PrintLine_E("Failed to decompress \"%.*s\" from the asset pack", StrPrint(filePath));
+		FreeMem(memArena, resultData, entry->size+1);
+		contentsOut->readSuccess = false;
+		return false;
+	}
+	contentsOut->size = entry->size;
+	if (convertNewLines && contentsOut->size > 0)
+	{
+		u64 numNewLinesReplaced = StrReplaceInPlace(NewStr(contentsOut->size, (char*)resultData), "\r\n", "\n", false, true);
+		if (numNewLinesReplaced > 0)
+		{
+			Assert(contentsOut->size > numNewLinesReplaced);
+			ShrinkMem(memArena, resultData, contentsOut->size+1, contentsOut->size+1 - numNewLinesReplaced);
+			contentsOut->size -= numNewLinesReplaced;
+		}
+	}
+	
+	contentsOut->allocArena = memArena;
+	contentsOut->data = resultData;
+	contentsOut->data[contentsOut->size] = '\0';
+	contentsOut->path = AllocString(memArena, &filePath);
+	NotNullStr(&contentsOut->path);
+	contentsOut->readSuccess = true;
+	return true;
+}
+
+// +==============================+
+// |      AssetPack_MapFile       |
+// +==============================+
+// bool MapFile(MyStr_t filePath, PlatMappedFile_t* mappedFileOut)
+PLAT_API_MAP_FILE_DEF(AssetPack_MapFile)
+{
+	AssetPack_t* pack = &pig->assetPack;
+	NotNull(mappedFileOut);
+	u64 entryIndex = 0;
+	const AssetPackFileEntry_t* entry = FindAssetPackEntry(pack, filePath, &entryIndex);
+	if (entry == nullptr)
+	{
+		CountAssetPackCall(&pack->stats.numFallbacks);
+		return pack->realApi->MapFile(filePath, mappedFileOut);
+	}
+	CountAssetPackCall(&pack->stats.numMaps);
+	
+	ClearPointer(mappedFileOut);
+	const u8* viewData = AcquireAssetPackEntryView(pack, entryIndex);
+	if (viewData == nullptr)
+	{
+		PrintLine_E("Failed to decompress \"%.*s\" from the asset pack", StrPrint(filePath));
+		return false;
+	}
+	mappedFileOut->isOpen = true;
+	mappedFileOut->size = entry->size;
+	mappedFileOut->data = viewData;
+	return true;
+}
+
+// +==============================+
+// |     AssetPack_UnmapFile      |
+// +==============================+
+// void UnmapFile(PlatMappedFile_t* mappedFile)
+PLAT_API_UNMAP_FILE_DEF(AssetPack_UnmapFile)
+{
+	NotNull(mappedFile);
+	AssetPack_t* pack = &pig->assetPack;
+	if (ReleaseAssetPackEntryView(pack, mappedFile->data)) { ClearPointer(mappedFile); }
+	else { pack->realApi->UnmapFile(mappedFile); }
+}
+
+//Points plat at a copy of the real api with the file functions above swapped in. The hooks only know about pig->assetPack
+void HookAssetPack(AssetPack_t* pack)
+{
+	NotNull(pack);
+	Assert(pack == &pig->assetPack);
+	Assert(pack->isOpen);
+	MyMemCopy(&pack->hookedApi, pack->realApi, sizeof(PlatformApi_t));
+	pack->hookedApi.DoesFileExist    = AssetPack_DoesFileExist;
+	pack->hookedApi.ReadFileContents = AssetPack_ReadFileContents;
+	pack->hookedApi.MapFile          = AssetPack_MapFile;
+	pack->hookedApi.UnmapFile        = AssetPack_UnmapFile;
+	pack->isHooked = true;
+	plat = &pack->hookedApi;
+}
+
+//Called from PigEntryPoint. PigEntryPoint leaves plat alone while it's hooked, unless the platform handed us a different api or the dll
+//was reloaded (which moves the hook functions), in which case we make a fresh copy
+void UpdateAssetPackHook(AssetPack_t* pack, const PlatformApi_t* api, bool dllReloaded)
+{
+	NotNull(pack);
+	if (!pack->isHooked || api == nullptr) { return; }
+	if (dllReloaded || pack->realApi != api || plat != &pack->hookedApi)
+	{
+		pack->realApi = api;
+		HookAssetPack(pack);
+	}
+}
+
+bool IsPlatHookedByAssetPack(const PlatformApi_t* api)
+{
+	return (pig != nullptr && pig->assetPack.isHooked && plat == &pig->assetPack.hookedApi && pig->assetPack.realApi == api);
+}
+
+//Opens ASSET_PACK_FILE_PATH if it exists and routes the engine's file functions through it
+bool Pig_OpenAssetPack()
+{
+	NotNull(pig);
+	if (pig->assetPack.isOpen) { return true; }
+	MyStr_t packPath = NewStr(ASSET_PACK_FILE_PATH);
+	if (!plat->DoesFileExist(packPath, nullptr)) { return false; }
+	if (!OpenAssetPack(&pig->assetPack, mainHeap, packPath, plat)) { return false; }
+	HookAssetPack(&pig->assetPack);
+	PrintLine_I("Reading resources from %s (%u entr%s, %llu compressed)", ASSET_PACK_FILE_PATH, pig->assetPack.header->numEntries, (pig->assetPack.header->numEntries == 1) ? "y" : "ies", pig->assetPack.numCompressed);
+	return true;
+}
+
+// +--------------------------------------------------------------+
+// |                         Pack Builder                         |
+// +--------------------------------------------------------------+
+void FreeAssetPackBuildFiles(const PlatformApi_t* realApi, VarArray_t* files)
+{
+	NotNull2(realApi, files);
+	VarArrayLoop(files, fIndex)
+	{
+		VarArrayLoopGet(AssetPackBuildFile_t, file, files, fIndex);
+		if (file->path.chars != nullptr) { FreeString(mainHeap, &file->path); }
+		if (file->contents.data != nullptr) { realApi->FreeFileContents(&file->contents); }
+		if (file->compressedData != nullptr) { FreeMem(&pig->largeAllocHeap, file->compressedData, file->compressedAllocSize); }
+	}
+	FreeVarArray(files);
+}
+
+//Reads every file under folderPath (recursively) with the real platform api, LZ4 compresses the ones that are worth it and writes the
+//pack to outputPath. The stored paths start with folderPath, so a pack built from "Resources" answers "Resources/Textures/test.png".
+//The whole pack is put together in memory first so this needs about twice the size of the folder in memory
+bool BuildAssetPack(MyStr_t folderPath, MyStr_t outputPath, bool compress, AssetPackBuildStats_t* statsOut = nullptr)
+{
+	NotNullStr(&folderPath);
+	NotNullStr(&outputPath);
+	AssertSingleThreaded();
+	const PlatformApi_t* realApi = pig->assetPack.isHooked ? pig->assetPack.realApi : plat;
+	if (pig->assetPack.isOpen && HashAssetPackPath(outputPath) == HashAssetPackPath(pig->assetPack.filePath))
+	{
+		PrintLine_E("Can't overwrite the asset pack that is open at \"%.*s\", close it first", StrPrint(pig->assetPack.filePath));
+		return false;
+	}
+	folderPath = TrimAssetPackPath(folderPath);
+	if (folderPath.length == 0) { WriteLine_E("The folder path can't be empty"); return false; }
+	
+	VarArray_t files;
+	CreateVarArray(&files, mainHeap, sizeof(AssetPackBuildFile_t));
+	VarArray_t folders;
+	CreateVarArray(&folders, mainHeap, sizeof(MyStr_t));
+	MyStr_t* rootFolder = VarArrayAdd(&folders, MyStr_t);
+	NotNull(rootFolder);
+	*rootFolder = AllocString(mainHeap, &folderPath);
+	
+	while (folders.length > 0)
+	{
+		MyStr_t folder = *VarArrayGetHard(&folders, folders.length-1, MyStr_t);
+		VarArrayRemove(&folders, folders.length-1, MyStr_t);
+		TempPushMark(); //for the enumerated names
+		for (u8 pass = 0; pass < 2; pass++)
+		{
+			PlatFileEnumerator_t enumerator = realApi->StartEnumeratingFiles(folder, (pass == 0), (pass == 1));
+			MyStr_t name = MyStr_Empty;
+			while (realApi->EnumerateFiles(&enumerator, &name, GetTempArena(), false))
+			{
+				MyStr_t path = PrintInArenaStr(mainHeap, "%.*s/%.*s", StrPrint(folder), StrPrint(name));
+				NotNullStr(&path);
+				if (pass == 0)
+				{
+					AssetPackBuildFile_t* newFile = VarArrayAdd(&files, AssetPackBuildFile_t);
+					NotNull(newFile);
+					ClearPointer(newFile);
+					newFile->path = path;
+				}
+				else
+				{
+					MyStr_t* newFolder = VarArrayAdd(&folders, MyStr_t);
+					NotNull(newFolder);
+					*newFolder = path;
+				}
+			}
+		}
+		TempPopMark();
+		FreeString(mainHeap, &folder);
+	}
+	FreeVarArray(&folders);
+	if (files.length == 0)
+	{
+		PrintLine_E("There are no files in \"%.*s\"", StrPrint(folderPath));
+		FreeVarArray(&files);
+		return false;
+	}
+	
+	//Read (and maybe compress) everything. Compressed entries are checked by decompressing them again, a bad entry gets stored as-is instead
+	u32* hashTable = compress ? AllocArray(mainHeap, u32, ASSET_PACK_LZ4_HASH_SIZE) : nullptr;
+	Assert(!compress || hashTable != nullptr);
+	AssetPackBuildStats_t stats = {};
+	u64 stringsSize = 0;
+	bool success = true;
+	VarArrayLoop(&files, fIndex)
+	{
+		VarArrayLoopGet(AssetPackBuildFile_t, file, &files, fIndex);
+		if (!realApi->ReadFileContents(file->path, &pig->largeAllocHeap, false, &file->contents))
+		{
+			PrintLine_E("Failed to read \"%.*s\"", StrPrint(file->path));
+			success = false;
+			break;
+		}
+		file->pathHash = HashAssetPackPath(file->path);
+		file->compression = AssetPackCompression_None;
+		file->storedSize = file->contents.size;
+		stringsSize += file->path.length + 1;
+		
+		u64 fileSize = file->contents.size;
+		if (compress && fileSize >= ASSET_PACK_MIN_COMPRESS_SIZE)
+		{
+			file->compressedAllocSize = Lz4CompressBound(fileSize);
+			file->compressedData = AllocArray(&pig->largeAllocHeap, u8, file->compressedAllocSize);
+			NotNull(file->compressedData);
+			u64 compressedSize = Lz4CompressBlock(file->contents.data, fileSize, file->compressedData, file->compressedAllocSize, hashTable);
+			bool keepCompressed = (compressedSize > 0 && compressedSize <= fileSize - (fileSize / ASSET_PACK_MIN_COMPRESS_SAVINGS));
+			if (keepCompressed)
+			{
+				u8* checkData = AllocArray(&pig->largeAllocHeap, u8, fileSize);
+				NotNull(checkData);
+				if (!Lz4DecompressBlock(file->compressedData, compressedSize, checkData, fileSize) || MyMemCompare(checkData, file->contents.data, fileSize) != 0)
+				{
+					PrintLine_W("\"%.*s\" didn't survive a compression round trip, storing it uncompressed", StrPrint(file->path));
+					keepCompressed = false;
+				}
+				FreeMem(&pig->largeAllocHeap, checkData, fileSize);
+			}
+			if (keepCompressed)
+			{
+				file->compression = AssetPackCompression_Lz4;
+				file->storedSize = compressedSize;
+				stats.numCompressed++;
+			}
+			else
+			{
+				FreeMem(&pig->largeAllocHeap, file->compressedData, file->compressedAllocSize);
+				file->compressedData = nullptr;
+				file->compressedAllocSize = 0;
+			}
+		}
+		stats.sourceSize += fileSize;
+	}
+	if (hashTable != nullptr) { FreeMem(mainHeap, hashTable, sizeof(u32) * ASSET_PACK_LZ4_HASH_SIZE); }
+	if (!success) { FreeAssetPackBuildFiles(realApi, &files); return false; }
+	Assert(files.length < 0x7FFFFFFF && stringsSize <= 0xFFFFFFFF);
+	
+	u32 numSlots = 16;
+	while (numSlots < files.length * 2) { numSlots *= 2; }
+	u64 slotsOffset = AlignAssetPackOffset(sizeof(AssetPackFileHeader_t));
+	u64 entriesOffset = AlignAssetPackOffset(slotsOffset + (numSlots * sizeof(u32)));
+	u64 stringsOffset = AlignAssetPackOffset(entriesOffset + (files.length * sizeof(AssetPackFileEntry_t)));
+	u64 dataOffset = AlignAssetPackOffset(stringsOffset + stringsSize);
+	u64 packSize = dataOffset;
+	VarArrayLoop(&files, fIndex)
+	{
+		VarArrayLoopGet(AssetPackBuildFile_t, file, &files, fIndex);
+		file->dataOffset = packSize;
+		packSize = AlignAssetPackOffset(packSize + file->storedSize);
+	}
+	
+	u8* packData = AllocArray(&pig->largeAllocHeap, u8, packSize);
+	if (packData == nullptr)
+	{
+		PrintLine_E("Failed to allocate %s for the asset pack", FormatBytesNt(packSize, GetTempArena()));
+		FreeAssetPackBuildFiles(realApi, &files);
+		return false;
+	}
+	MyMemSet(packData, 0x00, packSize);
+	
+	AssetPackFileHeader_t* header = (AssetPackFileHeader_t*)packData;
+	MyMemCopy(&header->magic[0], ASSET_PACK_MAGIC, sizeof(header->magic));
+	header->version = ASSET_PACK_VERSION;
+	header->numEntries = (u32)files.length;
+	header->numSlots = numSlots;
+	header->slotsOffset = slotsOffset;
+	header->entriesOffset = entriesOffset;
+	header->stringsOffset = stringsOffset;
+	header->stringsSize = stringsSize;
+	header->dataOffset = dataOffset;
+	header->fileSize = packSize;
+	
+	u32* slots = (u32*)(packData + slotsOffset);
+	AssetPackFileEntry_t* entries = (AssetPackFileEntry_t*)(packData + entriesOffset);
+	char* strings = (char*)(packData + stringsOffset);
+	u64 stringsUsed = 0;
+	VarArrayLoop(&files, fIndex)
+	{
+		VarArrayLoopGet(AssetPackBuildFile_t, file, &files, fIndex);
+		
+		//Two files can only land on the same path if they differ by case, which works on some file systems but can't work in a pack
+		u64 slotIndex = file->pathHash & (numSlots-1);
+		while (slots[slotIndex] != ASSET_PACK_EMPTY_SLOT)
+		{
+			const AssetPackBuildFile_t* otherFile = VarArrayGetHard(&files, slots[slotIndex]-1, AssetPackBuildFile_t);
+			if (otherFile->pathHash == file->pathHash && AssetPackPathsMatch(otherFile->path, file->path))
+			{
+				PrintLine_E("\"%.*s\" and \"%.*s\" only differ by case", StrPrint(otherFile->path), StrPrint(file->path));
+				success = false;
+			}
+			slotIndex = (slotIndex + 1) & (numSlots-1);
+		}
+		slots[slotIndex] = (u32)fIndex + 1;
+		
+		AssetPackFileEntry_t* entry = &entries[fIndex];
+		entry->pathHash = file->pathHash;
+		entry->pathOffset = (u32)stringsUsed;
+		entry->pathLength = (u32)file->path.length;
+		entry->compression = (u8)file->compression;
+		entry->dataOffset = file->dataOffset;
+		entry->storedSize = file->storedSize;
+		entry->size = file->contents.size;
+		MyMemCopy(&strings[stringsUsed], file->path.chars, file->path.length);
+		stringsUsed += file->path.length + 1; //null-term is already there from the MyMemSet
+		
+		const u8* storedData = (file->compression == AssetPackCompression_None) ? file->contents.data : file->compressedData;
+		MyMemCopy(packData + file->dataOffset, storedData, file->storedSize);
+	}
+	Assert(stringsUsed == stringsSize);
+	
+	if (success)
+	{
+		success = realApi->WriteEntireFile(outputPath, packData, packSize);
+		if (!success) { PrintLine_E("Failed to write asset pack to \"%.*s\"", StrPrint(outputPath)); }
+	}
+	stats.numFiles = files.length;
+	stats.packSize = packSize;
+	FreeMem(&pig->largeAllocHeap, packData, packSize);
+	FreeAssetPackBuildFiles(realApi, &files);
+	if (success && statsOut != nullptr) { *statsOut = stats; }
+	return success;
+}
+
+#endif //PIG_ASSET_PACK
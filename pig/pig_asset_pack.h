@@ -0,0 +1,170 @@
+/*
+File:   pig_asset_pack.h
+Date:   10\19\2026
+Description:
+	** An asset pack (.pak) is every file in a folder (usually Resources) stored back to back in one file with a
+	** hashed table of contents at the front. The whole pack is mapped once and each entry starts on an
+	** ASSET_PACK_ALIGNMENT boundary so uncompressed entries can be handed out as pointers straight into the mapping.
+	** Entries that shrink enough are stored LZ4 compressed (block format, see Lz4CompressBlock) and are decompressed
+	** on demand, or ahead of time on the thread pool by PrefetchAssetPack (see PigTask_DecompressAssets).
+	** While a pack is open the engine's file functions (ReadFileContents, MapFile, etc.) are routed through it so
+	** none of the code that loads resources needs to know whether the file came from the pack or from the disk
+*/
+
+#ifndef _PIG_ASSET_PACK_H
+#define _PIG_ASSET_PACK_H
+
+#define ASSET_PACK_MAGIC                "PPAK"
+#define ASSET_PACK_VERSION              1
+#define ASSET_PACK_FILE_PATH            "Resources.pak" //next to the executable, opened in Pig_Initialize if it exists
+#define ASSET_PACK_ALIGNMENT            64 //every table and entry starts on a cache line (which also keeps u64 reads aligned)
+#define ASSET_PACK_EMPTY_SLOT           0 //slots hold entryIndex+1
+#define ASSET_PACK_NOT_CACHED           UINT64_MAX
+
+#define ASSET_PACK_MIN_COMPRESS_SIZE    Kilobytes(1) //smaller files aren't worth the decompression call
+#define ASSET_PACK_MIN_COMPRESS_SAVINGS 8 //compressed entries must be at least 1/8th smaller, otherwise they are stored as-is and can be mapped directly
+#define ASSET_PACK_MAX_CACHE_SIZE       Megabytes(256) //PrefetchAssetPack leaves anything past this to be decompressed on demand
+#define ASSET_PACK_MAX_TASKS            32 //the main thread takes one range, the rest are queued on the thread pool
+#define ASSET_PACK_MIN_BYTES_PER_TASK   Kilobytes(256) //less decompressed output than this isn't worth waking up the thread pool
+
+#define ASSET_PACK_LZ4_MIN_MATCH        4
+#define ASSET_PACK_LZ4_MAX_OFFSET       65535
+#define ASSET_PACK_LZ4_LAST_LITERALS    5 //the format requires the last 5 bytes of a block to be literals
+#define ASSET_PACK_LZ4_MF_LIMIT         12 //and the last match to start at least 12 bytes before the end
+#define ASSET_PACK_LZ4_HASH_BITS        16
+#define ASSET_PACK_LZ4_HASH_SIZE        (1 << ASSET_PACK_LZ4_HASH_BITS)
+#define ASSET_PACK_LZ4_SKIP_TRIGGER     6 //the longer we go without a match the bigger steps we take, so incompressible data goes by quickly
+
+enum AssetPackCompression_t
+{
+	AssetPackCompression_None = 0,
+	AssetPackCompression_Lz4,
+	AssetPackCompression_NumTypes,
+};
+const char* GetAssetPackCompressionStr(AssetPackCompression_t compression)
+{
+	switch (compression)
+	{
+		case AssetPackCompression_None: return "None";
+		case AssetPackCompression_Lz4:  return "Lz4";
+		default: return "Unknown";
+	}
+}
+
+//NOTE: A .pak file is this header, then numSlots u32 hash slots, then numEntries AssetPackFileEntry_t, then the
+//      string table (null-terminated paths, compared case insensitively) and finally the entry data. Every section is aligned to ASSET_PACK_ALIGNMENT
+START_PACK()
+struct ATTR_PACKED AssetPackFileHeader_t
+{
+	char magic[4]; //ASSET_PACK_MAGIC
+	u32 version; //ASSET_PACK_VERSION
+	u32 numEntries;
+	u32 numSlots; //power of 2, at least twice numEntries. Linear probing from pathHash & (numSlots-1)
+	u64 slotsOffset;
+	u64 entriesOffset;
+	u64 stringsOffset;
+	u64 stringsSize;
+	u64 dataOffset;
+	u64 fileSize; //catches truncated packs
+};
+struct ATTR_PACKED AssetPackFileEntry_t
+{
+	u64 pathHash; //HashAssetPackPath
+	u32 pathOffset; //into the string table
+	u32 pathLength;
+	u8 compression; //AssetPackCompression_t
+	u8 reserved[7];
+	u64 dataOffset; //from the start of the file, a multiple of ASSET_PACK_ALIGNMENT
+	u64 storedSize; //size in the pack
+	u64 size; //size once decompressed
+};
+END_PACK()
+
+struct AssetPack_t;
+
+struct AssetPackPrefetchItem_t
+{
+	u32 entryIndex;
+	bool success;
+	u64 cacheOffset;
+};
+
+struct AssetPackTaskRange_t
+{
+	AssetPack_t* pack;
+	u64 firstItem;
+	u64 numItems;
+};
+
+//MapFile results for compressed entries that weren't in the cache, these are freed by UnmapFile
+struct AssetPackOwnedView_t
+{
+	const u8* data;
+	u64 size;
+};
+
+//NOTE: These are bumped with PigAtomicFetchAdd from whatever thread made the call, they aren't protected by AssetPack_t::mutex
+struct AssetPackStats_t
+{
+	volatile u64 numReads;
+	volatile u64 numMaps;
+	volatile u64 numDecompressed; //on demand, doesn't count PrefetchAssetPack
+	volatile u64 numFallbacks; //calls that weren't for a file in the pack and went to the real platform api
+};
+
+struct AssetPack_t
+{
+	bool isOpen;
+	MemArena_t* allocArena;
+	MyStr_t filePath;
+	const PlatformApi_t* realApi;
+	PlatMappedFile_t mappedFile;
+	const AssetPackFileHeader_t* header; //header, slots, entries and strings all point into mappedFile
+	const u32* slots;
+	const AssetPackFileEntry_t* entries;
+	const char* strings;
+	u64 numCompressed;
+	u64 totalSize; //of all entries once decompressed
+	
+	bool isHooked;
+	PlatformApi_t hookedApi; //copy of realApi with the file functions replaced, plat points at this while isHooked
+	
+	AssetPackStats_t stats;
+	
+	PlatMutex_t mutex; //protects everything below, the hooked functions get called from the thread pool too
+	u64 numOpenViews; //MapFile results that point into mappedFile
+	u64 numCacheViews; //MapFile results that point into cache, ReleaseAssetPackCache won't free the cache while these are open
+	VarArray_t ownedViews; //AssetPackOwnedView_t, allocated from threadSafeHeap
+	u64 cacheSize;
+	u8* cache; //allocated from largeAllocHeap by PrefetchAssetPack
+	u64* cacheOffsets; //one per entry, ASSET_PACK_NOT_CACHED for entries that have to be decompressed on demand
+	
+	bool semaphoreCreated;
+	PlatSemaphore_t doneSemaphore; //triggered once by each queued task
+	u64 numPrefetchItems;
+	AssetPackPrefetchItem_t* prefetchItems; //only alive during PrefetchAssetPack
+	AssetPackTaskRange_t ranges[ASSET_PACK_MAX_TASKS];
+	u64 numQueuedTasks; //from the last PrefetchAssetPack call
+};
+
+struct AssetPackBuildFile_t
+{
+	MyStr_t path; //allocated from mainHeap
+	u64 pathHash;
+	PlatFileContents_t contents; //read from largeAllocHeap
+	AssetPackCompression_t compression;
+	u64 storedSize;
+	u8* compressedData; //allocated from largeAllocHeap, nullptr for entries that are stored as-is
+	u64 compressedAllocSize;
+	u64 dataOffset;
+};
+
+struct AssetPackBuildStats_t
+{
+	u64 numFiles;
+	u64 numCompressed;
+	u64 sourceSize;
+	u64 packSize;
+};
+
+#endif //  _PIG_ASSET_PACK_H
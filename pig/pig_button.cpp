@@ -104,7 +104,7 @@ r32 ButtonGetAutoHeight(Button_t* btn)
 {
 	NotNull(btn);
 	const FontFace_t* fontFace = GetFontFace(GetPointer(&btn->font), btn->fontFaceSelector);
-	r32 fontLineHeight = (fontFace != nullptr) ? (fontFace->lineHeight * btn->fontScale) : 0;
+	r32 fontLineHeight = (fontFace != nullptr) ? (fontFace->lineHeight * GetFontFaceScale(fontFace, btn->fontFaceSelector) * btn->fontScale) : 0;
 	return (fontLineHeight + btn->innerMargin.y*2);
 }
 
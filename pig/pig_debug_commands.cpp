@@ -1340,6 +1340,2054 @@ void Debug_TestScratch(MyStr_t numBytesStr)
 }
 EXPRESSION_FUNC_DEFINITION(Debug_TestScratch_Glue) { EXP_GET_ARG_STR(0, numBytesStr); Debug_TestScratch(numBytesStr); return NewExpValueVoid(); }
 
+// +--------------------------------------------------------------+
+// |                          text_cache                          |
+// +--------------------------------------------------------------+
+#define Debug_TextCache_Def "void text_cache(bool clear)"
+#define Debug_TextCache_Desc "Prints statistics about the text layout cache that RcDrawText and RcMeasureText use. Pass true to also free all cached layouts and reset the counters"
+void Debug_TextCache(bool clear)
+{
+	TextLayoutCache_t* cache = &rc->textLayoutCache;
+	u64 numGlyphs = 0;
+	u64 numBytes = 0;
+	for (const TextLayout_t* layout = cache->lruHead; layout != nullptr; layout = layout->lruNext)
+	{
+		numGlyphs += layout->glyphs.length;
+		numBytes += layout->text.length + (layout->glyphs.length * sizeof(TextLayoutGlyph_t));
+	}
+	u64 numLookups = cache->numHits + cache->numMisses;
+	PrintLine_N("Text layout cache is %s: %llu/%llu layouts, %llu glyphs, %s", (cache->enabled ? "enabled" : "disabled"), cache->numLayouts, (u64)TEXT_LAYOUT_CACHE_SIZE, numGlyphs, FormatBytesNt(numBytes, TempArena));
+	PrintLine_I("  %llu hits, %llu misses (%.1f%% hit rate), %llu evictions", cache->numHits, cache->numMisses, (numLookups > 0) ? (r32)(cache->numHits * 100) / (r32)numLookups : 0.0f, cache->numEvictions);
+	PrintLine_I("  %llu misses weren't cached because the text wasn't seen on an earlier frame", cache->numSkipped);
+	if (clear)
+	{
+		ClearTextLayoutCache(cache);
+		cache->numHits = 0;
+		cache->numMisses = 0;
+		cache->numEvictions = 0;
+		cache->numSkipped = 0;
+		WriteLine_I("Cleared the text layout cache");
+	}
+}
+EXPRESSION_FUNC_DEFINITION(Debug_TextCache_Glue) { EXP_GET_ARG_BOOL(0, clear); Debug_TextCache(clear); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                        map_file_bench                        |
+// +--------------------------------------------------------------+
+#define Debug_MapFileBench_Def "void map_file_bench(string file_path)"
+#define Debug_MapFileBench_Desc "Loads a file with ReadFileContents and then with MapFile, touching every byte (and decoding it if it's an image) and prints the time taken and how much of our heap memory each approach needed (this is not the process' RSS)"
+void Debug_MapFileBench(MyStr_t filePath)
+{
+	bool isImage = (StrEndsWith(filePath, ".png", true) || StrEndsWith(filePath, ".jpg", true) || StrEndsWith(filePath, ".bmp", true));
+	
+	// +==============================+
+	// |       ReadFileContents       |
+	// +==============================+
+	u64 readHeapBefore = platInfo->stdHeap->used;
+	PerfTime_t readStartTime = GetPerfTime();
+	PlatFileContents_t fileContents = {};
+	if (!plat->ReadFileContents(filePath, nullptr, false, &fileContents)) { PrintLine_E("Failed to read \"%.*s\"", StrPrint(filePath)); return; }
+	u64 readHeapPeak = platInfo->stdHeap->used - readHeapBefore;
+	u64 readHash = FnvHashU64(fileContents.data, fileContents.size);
+	PlatImageData_t readImageData = {};
+	if (isImage && plat->TryParseImageFile(fileContents.size, fileContents.data, sizeof(u32), &readImageData))
+	{
+		readHeapPeak = platInfo->stdHeap->used - readHeapBefore;
+		plat->FreeImageData(&readImageData);
+	}
+	plat->FreeFileContents(&fileContents);
+	PerfTime_t readEndTime = GetPerfTime();
+	
+	// +==============================+
+	// |           MapFile            |
+	// +==============================+
+	u64 mapHeapBefore = platInfo->stdHeap->used;
+	PerfTime_t mapStartTime = GetPerfTime();
+	PlatMappedFile_t mappedFile = {};
+	if (!plat->MapFile(filePath, &mappedFile)) { PrintLine_E("Failed to map \"%.*s\"", StrPrint(filePath)); return; }
+	u64 mapHeapPeak = platInfo->stdHeap->used - mapHeapBefore;
+	u64 mapHash = FnvHashU64(mappedFile.data, mappedFile.size);
+	PlatImageData_t mapImageData = {};
+	if (isImage && plat->TryParseImageFile(mappedFile.size, mappedFile.data, sizeof(u32), &mapImageData))
+	{
+		mapHeapPeak = platInfo->stdHeap->used - mapHeapBefore;
+		plat->FreeImageData(&mapImageData);
+	}
+	u64 fileSize = mappedFile.size;
+	plat->UnmapFile(&mappedFile);
+	PerfTime_t mapEndTime = GetPerfTime();
+	
+	if (readHash != mapHash) { WriteLine_E("File contents did not match between ReadFileContents and MapFile!"); }
+	MemArena_t* scratch = GetScratchArena();
+	PrintLine_N("\"%.*s\" is %s%s", StrPrint(filePath), FormatBytesNt(fileSize, scratch), (isImage ? " (decoded as image)" : ""));
+	PrintLine_I("  ReadFileContents: %.2lfms, %s of heap", GetPerfTimeDiff(&readStartTime, &readEndTime), FormatBytesNt(readHeapPeak, scratch));
+	PrintLine_I("  MapFile:          %.2lfms, %s of heap", GetPerfTimeDiff(&mapStartTime, &mapEndTime), FormatBytesNt(mapHeapPeak, scratch));
+	WriteLine_D("  (the second load benefits from the OS file cache, run it twice to compare warm numbers)");
+	WriteLine_D("  (heap only counts our own allocations, the mapped pages still count towards the process' RSS once they are touched)");
+	FreeScratchArena(scratch);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_MapFileBench_Glue) { EXP_GET_ARG_STR(0, filePath); Debug_MapFileBench(filePath); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                         render_stats                         |
+// +--------------------------------------------------------------+
+#define Debug_RenderStats_Def "void render_stats()"
+#define Debug_RenderStats_Desc "Prints the render command statistics from the last frame (draw calls, state changes, redundant uniform sets, etc.)"
+void Debug_RenderStats()
+{
+	const RenderCmdStats_t* stats = &rc->lastFrameStats;
+	MemArena_t* scratch = GetScratchArena();
+	PrintLine_N("Last frame: %llu command%s (%s) on %s backend in %.2lfms", stats->numCommands, Plural(stats->numCommands, "s"), FormatBytesNt(stats->numBytes, scratch), GetRenderApiStr(rc->cmdBackend), stats->frameTime);
+	PrintLine_I("  Draw Calls:     %llu", stats->numDrawCalls);
+	PrintLine_I("  State Changes:  %llu (%llu redundant)", stats->numStateChanges, stats->numRedundantStateChanges);
+	PrintLine_I("  Uniform Sets:   %llu (%llu redundant, %s)", stats->numUniformSets, stats->numRedundantUniformSets, FormatBytesNt(stats->uniformBytes, scratch));
+	PrintLine_I("  Filtered Sets:  %llu (%s)%s", stats->numFilteredUniformSets, FormatBytesNt(stats->filteredUniformBytes, scratch), rc->filterUniforms ? "" : " [filtering disabled]");
+	PrintLine_I("  Clears:         %llu", stats->numClears);
+	for (u64 tIndex = 1; tIndex < RenderCmdType_NumTypes; tIndex++)
+	{
+		if (stats->commandCounts[tIndex] > 0)
+		{
+			PrintLine_D("    %s: %llu", GetRenderCmdTypeStr((RenderCmdType_t)tIndex), stats->commandCounts[tIndex]);
+		}
+	}
+	PrintLine_I("  Shader Cache:   %llu loaded from cache, %llu compiled%s", pig->numShaderBinaryHits, pig->numShaderBinaryMisses, pig->shaderBinaryCacheEnabled ? "" : " [cache unavailable]");
+	const RcModelStats_t* modelStats = &rc->lastModelStats;
+	PrintLine_I("  Models:         %llu queued, %llu culled, %llu/%llu parts drawn in %.3lfms%s", modelStats->numQueued, modelStats->numModelsCulled, modelStats->numPartsDrawn, modelStats->numPartsDrawn + modelStats->numPartsCulled, modelStats->cullTime, rc->modelCulling ? "" : " [culling disabled]");
+	PrintLine_I("  Model Batches:  %llu (one material and buffer bind each)", modelStats->numBatches);
+	FreeScratchArena(scratch);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_RenderStats_Glue) { Debug_RenderStats(); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                         render_dump                          |
+// +--------------------------------------------------------------+
+#define Debug_RenderDump_Def "void render_dump(string file_path)"
+#define Debug_RenderDump_Desc "Writes the render commands recorded during the last frame to a file"
+void Debug_RenderDump(MyStr_t filePath)
+{
+	if (!rc->cmdBuffer.recording) { WriteLine_E("The render command buffer is not recording"); return; }
+	if (DumpRenderCmdBuffer(&rc->cmdBuffer, filePath))
+	{
+		MemArena_t* scratch = GetScratchArena();
+		PrintLine_I("Wrote %llu render command%s (%s) to \"%.*s\"", rc->cmdBuffer.stats.numCommands, Plural(rc->cmdBuffer.stats.numCommands, "s"), FormatBytesNt(rc->cmdBuffer.length, scratch), StrPrint(filePath));
+		FreeScratchArena(scratch);
+	}
+	else
+	{
+		PrintLine_E("Failed to write render commands to \"%.*s\"", StrPrint(filePath));
+	}
+}
+EXPRESSION_FUNC_DEFINITION(Debug_RenderDump_Glue) { EXP_GET_ARG_STR(0, filePath); Debug_RenderDump(filePath); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                         render_bench                         |
+// +--------------------------------------------------------------+
+#define Debug_RenderBench_Def "void render_bench(u64 num_draws)"
+#define Debug_RenderBench_Desc "Issues a number of 2D rectangle draws against the null render backend, with and without command recording and uniform filtering, and prints the front-end cost per draw"
+void Debug_RenderBench(u64 numDraws)
+{
+	if (numDraws == 0) { WriteLine_E("num_draws must be greater than 0"); return; }
+	
+	RenderContextState_t oldState = rc->state;
+	const PlatWindow_t* oldWindow = rc->currentWindow;
+	RenderCmdBuffer_t oldBuffer = rc->cmdBuffer;
+	bool oldFilterUniforms = rc->filterUniforms;
+	InitRenderCmdBuffer(&rc->cmdBuffer, mainHeap);
+	rc->cmdBackend = RenderApi_None;
+	
+	//Pass 0 records with uniform filtering, pass 1 doesn't record, pass 2 records without filtering
+	r64 times[3] = {};
+	RenderCmdStats_t passStats[3] = {};
+	u64 passBytes[3] = {};
+	for (u64 pass = 0; pass < ArrayCount(times); pass++)
+	{
+		ClearRenderCmdBuffer(&rc->cmdBuffer);
+		rc->cmdBuffer.recording = (pass != 1);
+		RcSetUniformFiltering(pass != 2);
+		RcInvalidateUniformShadows();
+		PerfTime_t startTime = GetPerfTime();
+		RcBegin(platInfo->mainWindow, nullptr, &pig->resources.shaders->main2D, Black);
+		for (u64 dIndex = 0; dIndex < numDraws; dIndex++)
+		{
+			rec rectangle = NewRec((r32)(dIndex % 64) * 8, (r32)((dIndex / 64) % 64) * 8, 8, 8);
+			Color_t color = ColorLerp(MonokaiRed, MonokaiBlue, (r32)(dIndex % 16) / 16.0f);
+			if ((dIndex % 8) < 4)
+			{
+				RcBindTexture1(((dIndex % 2) == 0) ? &rc->dotTexture : &rc->invalidTexture);
+				RcDrawTexturedRectangle(rectangle, color);
+			}
+			else if ((dIndex % 8) == 7) { RcDrawRoundedRectangle(rectangle, 2, color); } //binds another shader and back, which re-sends every uniform
+			else { RcDrawRectangle(rectangle, color); }
+		}
+		PerfTime_t endTime = GetPerfTime();
+		times[pass] = GetPerfTimeDiff(&startTime, &endTime);
+		passStats[pass] = rc->cmdBuffer.stats;
+		passBytes[pass] = rc->cmdBuffer.length;
+	}
+	
+	FreeRenderCmdBuffer(&rc->cmdBuffer);
+	rc->cmdBuffer = oldBuffer;
+	rc->cmdBackend = pig->renderApi;
+	rc->state = oldState;
+	rc->currentWindow = oldWindow;
+	RcSetUniformFiltering(oldFilterUniforms);
+	RcInvalidateUniformShadows(); //the shadows now describe what the null backend was told, not the real one
+	
+	MemArena_t* scratch = GetScratchArena();
+	PrintLine_N("%llu draw%s against the null backend:", numDraws, Plural(numDraws, "s"));
+	PrintLine_I("  Recording:     %.2lfms (%.3lfus/draw, %.1lf commands/draw, %s)", times[0], (times[0] * 1000.0) / (r64)numDraws, (r64)passStats[0].numCommands / (r64)numDraws, FormatBytesNt(passBytes[0], scratch));
+	PrintLine_I("  Not Recording: %.2lfms (%.3lfus/draw)", times[1], (times[1] * 1000.0) / (r64)numDraws);
+	PrintLine_I("  Unfiltered:    %.2lfms (%.3lfus/draw, %.1lf commands/draw, %s)", times[2], (times[2] * 1000.0) / (r64)numDraws, (r64)passStats[2].numCommands / (r64)numDraws, FormatBytesNt(passBytes[2], scratch));
+	PrintLine_I("  Uniform Sets:  %llu filtered vs %llu unfiltered (%llu dropped, %s)", passStats[0].numUniformSets, passStats[2].numUniformSets, passStats[0].numFilteredUniformSets, FormatBytesNt(passStats[0].filteredUniformBytes, scratch));
+	FreeScratchArena(scratch);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_RenderBench_Glue) { EXP_GET_ARG_U64(0, numDraws); Debug_RenderBench(numDraws); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                    render_filter_uniforms                    |
+// +--------------------------------------------------------------+
+#define Debug_RenderFilter_Def "void render_filter_uniforms(bool enabled)"
+#define Debug_RenderFilter_Desc "Enables or disables dropping uniform sets that the bound shader already has the value for"
+void Debug_RenderFilter(bool enabled)
+{
+	RcSetUniformFiltering(enabled);
+	PrintLine_I("Uniform filtering %s", enabled ? "enabled" : "disabled");
+}
+EXPRESSION_FUNC_DEFINITION(Debug_RenderFilter_Glue) { EXP_GET_ARG_BOOL(0, enabled); Debug_RenderFilter(enabled); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                          anim_bench                          |
+// +--------------------------------------------------------------+
+#define DEBUG_ANIM_BENCH_NUM_BONES 48
+#define DEBUG_ANIM_BENCH_NUM_KEYS  8
+#define Debug_AnimBench_Def "void anim_bench(u64 num_instances, u64 num_frames)"
+#define Debug_AnimBench_Desc "Evaluates bone palettes for a number of instances of a synthetic rig (scalar, SSE and SSE on the thread pool) and prints poses per second"
+void Debug_AnimBench(u64 numInstances, u64 numFrames)
+{
+	if (numInstances == 0) { WriteLine_E("num_instances must be greater than 0"); return; }
+	if (numFrames == 0) { WriteLine_E("num_frames must be greater than 0"); return; }
+	
+	//A binary tree of bones, each offset 1 unit from its parent, with every bone swinging around Z at its own rate
+	Skeleton_t skeleton;
+	CreateSkeleton(&skeleton, mainHeap, DEBUG_ANIM_BENCH_NUM_BONES);
+	for (u64 bIndex = 0; bIndex < skeleton.numBones; bIndex++)
+	{
+		skeleton.parentIndices[bIndex] = (bIndex > 0) ? (u16)((bIndex-1) / 2) : ANIM_NO_BONE_INDEX;
+		skeleton.bindLocal[bIndex] = (bIndex > 0) ? Mat4Translate3(NewVec3(((bIndex % 2) == 0) ? 0.5f : -0.5f, 1.0f, 0.0f)) : Mat4_Identity;
+	}
+	SkeletonCalculateInverseBind(&skeleton);
+	
+	AnimClip_t clip;
+	CreateAnimClip(&clip, mainHeap, &skeleton, NewStr("bench"), 2.0f, true);
+	for (u64 bIndex = 0; bIndex < skeleton.numBones; bIndex++)
+	{
+		AnimBoneTrack_t* track = AnimClipAllocTrack(&clip, bIndex, DEBUG_ANIM_BENCH_NUM_KEYS);
+		for (u64 kIndex = 0; kIndex < DEBUG_ANIM_BENCH_NUM_KEYS; kIndex++)
+		{
+			r32 keyTime = clip.duration * (r32)kIndex / (r32)(DEBUG_ANIM_BENCH_NUM_KEYS-1);
+			r32 halfAngle = SinR32(keyTime * Pi32 * (r32)(1 + (bIndex % 3))) * 0.25f;
+			track->times[kIndex] = keyTime;
+			track->values[kIndex].position = (bIndex > 0) ? NewVec3(((bIndex % 2) == 0) ? 0.5f : -0.5f, 1.0f, 0.0f) : Vec3_Zero;
+			track->values[kIndex].rotation = NewQuat(0, 0, SinR32(halfAngle), CosR32(halfAngle));
+			track->values[kIndex].scale = Vec3_One;
+		}
+	}
+	
+	AnimPoseBatch_t batch;
+	CreateAnimPoseBatch(&batch, mainHeap, &skeleton, numInstances);
+	for (u64 iIndex = 0; iIndex < numInstances; iIndex++)
+	{
+		batch.instances[iIndex].clip = &clip;
+		batch.instances[iIndex].time = clip.duration * (r32)iIndex / (r32)numInstances;
+	}
+	
+	//Pass 0 is scalar, pass 1 is SSE on this thread, pass 2 is SSE on the thread pool. Palettes from the last frame of passes 0 and 1 are compared
+	const char* passNames[3] = { "Scalar:         ", "SSE:            ", "SSE Threaded:   " };
+	r64 times[3] = {};
+	u64 paletteSize = sizeof(mat4) * numInstances * skeleton.numBones;
+	mat4* scalarPalettes = AllocArray(mainHeap, mat4, numInstances * skeleton.numBones);
+	NotNull(scalarPalettes);
+	r32 maxDifference = 0.0f;
+	for (u64 pass = 0; pass < ArrayCount(times); pass++)
+	{
+		batch.useSimd = (pass != 0);
+		PerfTime_t startTime = GetPerfTime();
+		for (u64 fIndex = 0; fIndex < numFrames; fIndex++)
+		{
+			for (u64 iIndex = 0; iIndex < numInstances; iIndex++) { batch.instances[iIndex].time += 1/60.0f; }
+			EvaluateAnimPoseBatch(&batch, (pass == 2));
+		}
+		PerfTime_t endTime = GetPerfTime();
+		times[pass] = GetPerfTimeDiff(&startTime, &endTime);
+		for (u64 iIndex = 0; iIndex < numInstances; iIndex++) { batch.instances[iIndex].time -= (r32)numFrames * (1/60.0f); }
+		
+		if (pass == 0) { MyMemCopy(scalarPalettes, batch.palettes, paletteSize); }
+		else if (pass == 1)
+		{
+			const r32* scalarValues = &scalarPalettes[0].values[0][0];
+			const r32* simdValues = &batch.palettes[0].values[0][0];
+			for (u64 vIndex = 0; vIndex < paletteSize / sizeof(r32); vIndex++)
+			{
+				maxDifference = MaxR32(maxDifference, AbsR32(scalarValues[vIndex] - simdValues[vIndex]));
+			}
+		}
+	}
+	u64 numQueuedTasks = batch.numQueuedTasks;
+	
+	FreeMem(mainHeap, scalarPalettes, paletteSize);
+	FreeAnimPoseBatch(&batch);
+	FreeAnimClip(&clip);
+	FreeSkeleton(&skeleton);
+	
+	MemArena_t* scratch = GetScratchArena();
+	u64 numPoses = numInstances * numFrames;
+	PrintLine_N("%llu instance%s of a %d bone rig for %llu frame%s (%s of palettes per frame):", numInstances, Plural(numInstances, "s"), DEBUG_ANIM_BENCH_NUM_BONES, numFrames, Plural(numFrames, "s"), FormatBytesNt(paletteSize, scratch));
+	for (u64 pass = 0; pass < ArrayCount(times); pass++)
+	{
+		PrintLine_I("  %s%.2lfms (%.0lf poses/sec, %.3lfms/frame)", passNames[pass], times[pass], (times[pass] > 0) ? ((r64)numPoses * 1000.0 / times[pass]) : 0.0, times[pass] / (r64)numFrames);
+	}
+	PrintLine_I("  Threaded pass used %llu pool task%s per frame, max scalar/SSE difference %g", numQueuedTasks, Plural(numQueuedTasks, "s"), maxDifference);
+	FreeScratchArena(scratch);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_AnimBench_Glue) { EXP_GET_ARG_U64(0, numInstances); EXP_GET_ARG_U64(1, numFrames); Debug_AnimBench(numInstances, numFrames); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                      render_model_opts                       |
+// +--------------------------------------------------------------+
+#define Debug_RenderModelOpts_Def "void render_model_opts(bool culling)"
+#define Debug_RenderModelOpts_Desc "Enables or disables frustum culling of model parts for RcDrawModel* and queued models"
+void Debug_RenderModelOpts(bool culling)
+{
+	NotNull(rc);
+	rc->modelCulling = culling;
+	PrintLine_I("Model culling %s", culling ? "enabled" : "disabled");
+}
+EXPRESSION_FUNC_DEFINITION(Debug_RenderModelOpts_Glue) { EXP_GET_ARG_BOOL(0, culling); Debug_RenderModelOpts(culling); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                       model_cull_bench                       |
+// +--------------------------------------------------------------+
+#define DEBUG_MODEL_CULL_BENCH_NUM_PARTS 4
+#define Debug_ModelCullBench_Def "void model_cull_bench(u64 num_instances)"
+#define Debug_ModelCullBench_Desc "Culls and batches a grid of copies of a synthetic model around a camera (no GPU work) and checks the box test against a corner by corner test"
+void Debug_ModelCullBench(u64 numInstances)
+{
+	if (numInstances == 0) { WriteLine_E("num_instances must be greater than 0"); return; }
+	
+	//A model with a stack of 1x1x1 parts, none of the part buffers are ever drawn but BuildModelDrawBatches skips invalid buffers so we mark them valid
+	Model_t model = {};
+	model.allocArena = mainHeap;
+	model.hasBounds = true;
+	CreateVarArray(&model.parts, mainHeap, sizeof(ModelPart_t), DEBUG_MODEL_CULL_BENCH_NUM_PARTS);
+	for (u64 pIndex = 0; pIndex < DEBUG_MODEL_CULL_BENCH_NUM_PARTS; pIndex++)
+	{
+		ModelPart_t* part = VarArrayAdd(&model.parts, ModelPart_t);
+		NotNull(part);
+		ClearPointer(part);
+		part->partIndex = pIndex;
+		part->boundsMin = NewVec3(-0.5f, (r32)pIndex, -0.5f);
+		part->boundsMax = NewVec3(0.5f, (r32)pIndex + 1.0f, 0.5f);
+		part->buffer.isValid = true;
+	}
+	model.boundsMin = NewVec3(-0.5f, 0.0f, -0.5f);
+	model.boundsMax = NewVec3(0.5f, (r32)DEBUG_MODEL_CULL_BENCH_NUM_PARTS, 0.5f);
+	
+	//Camera at the origin looking down +Z with a 60 degree vertical fov, tilted down a bit so the upper parts of far away copies leave the top of the view
+	r32 aspectRatio = 16.0f / 9.0f;
+	r32 focalLength = 1.0f / (SinR32(Pi32 / 6.0f) / CosR32(Pi32 / 6.0f));
+	mat4 projection;
+	ClearStruct(projection);
+	projection.values[0][0] = focalLength / aspectRatio;
+	projection.values[1][1] = focalLength;
+	projection.values[2][2] = 1.0f;
+	projection.values[3][2] = -0.05f;
+	projection.values[2][3] = 1.0f; //clip w = view z
+	mat4 view = Mat4Translate3(NewVec3(0, -(r32)DEBUG_MODEL_CULL_BENCH_NUM_PARTS, 0));
+	Frustum_t frustum = NewFrustum(Mat4Multiply(projection, view));
+	
+	//A square grid centered on the camera so roughly half the copies are behind it and most of the rest are off to the sides
+	u64 gridSize = 1;
+	while (gridSize * gridSize < numInstances) { gridSize++; }
+	RcQueuedModel_t* queue = AllocArray(mainHeap, RcQueuedModel_t, numInstances);
+	RcModelInstance_t* instances = AllocArray(mainHeap, RcModelInstance_t, numInstances * DEBUG_MODEL_CULL_BENCH_NUM_PARTS);
+	NotNull2(queue, instances);
+	for (u64 iIndex = 0; iIndex < numInstances; iIndex++)
+	{
+		v3 position = NewVec3(((r32)(iIndex % gridSize) - (r32)gridSize/2.0f) * 3.0f, 0.0f, ((r32)(iIndex / gridSize) - (r32)gridSize/2.0f) * 3.0f);
+		r32 halfAngle = (r32)iIndex * 0.37f;
+		mat4 worldMatrix = Mat4_Identity;
+		Mat4Transform(worldMatrix, Mat4Quaternion(NewQuat(0, SinR32(halfAngle), 0, CosR32(halfAngle))));
+		Mat4Transform(worldMatrix, Mat4Translate3(position));
+		queue[iIndex].model = &model;
+		queue[iIndex].worldMatrix = worldMatrix;
+		queue[iIndex].color = White;
+	}
+	
+	// +==============================+
+	// |    Box Test vs Corner Test   |
+	// +==============================+
+	u64 numMismatches = 0;
+	u64 numVisibleFast = 0;
+	PerfTime_t fastStartTime = GetPerfTime();
+	for (u64 iIndex = 0; iIndex < numInstances; iIndex++)
+	{
+		if (IsBoxInFrustum(&frustum, queue[iIndex].worldMatrix, model.boundsMin, model.boundsMax)) { numVisibleFast++; }
+	}
+	PerfTime_t fastEndTime = GetPerfTime();
+	u64 numVisibleCorners = 0;
+	PerfTime_t cornersStartTime = GetPerfTime();
+	for (u64 iIndex = 0; iIndex < numInstances; iIndex++)
+	{
+		if (IsBoxInFrustumByCorners(&frustum, queue[iIndex].worldMatrix, model.boundsMin, model.boundsMax)) { numVisibleCorners++; }
+	}
+	PerfTime_t cornersEndTime = GetPerfTime();
+	for (u64 iIndex = 0; iIndex < numInstances; iIndex++)
+	{
+		bool fastResult = IsBoxInFrustum(&frustum, queue[iIndex].worldMatrix, model.boundsMin, model.boundsMax);
+		bool cornersResult = IsBoxInFrustumByCorners(&frustum, queue[iIndex].worldMatrix, model.boundsMin, model.boundsMax);
+		if (fastResult != cornersResult) { numMismatches++; }
+	}
+	
+	// +==============================+
+	// |        Build Batches         |
+	// +==============================+
+	//Pass 0 doesn't cull (what RcDrawModelSimple did before), pass 1 culls. Every drawn part is one draw call
+	const char* passNames[2] = { "No Culling:     ", "Culled:         " };
+	RcModelStats_t passStats[2] = {};
+	r64 passTimes[2] = {};
+	for (u64 pass = 0; pass < ArrayCount(passStats); pass++)
+	{
+		VarArray_t batches;
+		CreateVarArray(&batches, mainHeap, sizeof(RcModelDrawBatch_t));
+		PerfTime_t startTime = GetPerfTime();
+		BuildModelDrawBatches(queue, numInstances, &frustum, (pass >= 1), instances, &batches, &passStats[pass]);
+		PerfTime_t endTime = GetPerfTime();
+		passTimes[pass] = GetPerfTimeDiff(&startTime, &endTime);
+		FreeVarArray(&batches);
+	}
+	
+	FreeMem(mainHeap, instances, sizeof(RcModelInstance_t) * numInstances * DEBUG_MODEL_CULL_BENCH_NUM_PARTS);
+	FreeMem(mainHeap, queue, sizeof(RcQueuedModel_t) * numInstances);
+	FreeVarArray(&model.parts);
+	
+	PrintLine_N("%llu cop%s of a %d part model on a %llux%llu grid:", numInstances, (numInstances == 1) ? "y" : "ies", DEBUG_MODEL_CULL_BENCH_NUM_PARTS, gridSize, gridSize);
+	PrintLine_I("  Box Test:       %.3lfms, %llu visible", GetPerfTimeDiff(&fastStartTime, &fastEndTime), numVisibleFast);
+	PrintLine_I("  Corner Test:    %.3lfms, %llu visible", GetPerfTimeDiff(&cornersStartTime, &cornersEndTime), numVisibleCorners);
+	if (numMismatches > 0) { PrintLine_E("  %llu cop%s disagreed between the box and corner tests!", numMismatches, (numMismatches == 1) ? "y" : "ies"); }
+	else { WriteLine_I("  Box and corner tests agree on every copy"); }
+	for (u64 pass = 0; pass < ArrayCount(passStats); pass++)
+	{
+		const RcModelStats_t* stats = &passStats[pass];
+		PrintLine_I("  %s %.3lfms, %llu model%s culled, %llu/%llu parts drawn in %llu batch%s",
+			passNames[pass], passTimes[pass],
+			stats->numModelsCulled, Plural(stats->numModelsCulled, "s"),
+			stats->numPartsDrawn, numInstances * DEBUG_MODEL_CULL_BENCH_NUM_PARTS,
+			stats->numBatches, Plural(stats->numBatches, "es")
+		);
+	}
+}
+EXPRESSION_FUNC_DEFINITION(Debug_ModelCullBench_Glue) { EXP_GET_ARG_U64(0, numInstances); Debug_ModelCullBench(numInstances); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                       slug_text_bench                        |
+// +--------------------------------------------------------------+
+#if SLUG_SUPPORTED
+#define Debug_SlugTextBench_Def "void slug_text_bench(string font_path, u64 num_labels, u64 num_frames)"
+#define Debug_SlugTextBench_Desc "Draws a number of static Slug text labels against the null render backend, one at a time and as a single SlugTextBatch_t, and prints the CPU time per frame"
+void Debug_SlugTextBench(MyStr_t fontPath, u64 numLabels, u64 numFrames)
+{
+	if (numLabels == 0) { WriteLine_E("num_labels must be greater than 0"); return; }
+	if (numFrames == 0) { WriteLine_E("num_frames must be greater than 0"); return; }
+	if (!plat->DoesFileExist(fontPath, nullptr)) { PrintLine_E("There is no font file at \"%.*s\"", StrPrint(fontPath)); return; }
+	
+	SlugFont_t font;
+	if (!LoadSlugFont(mainHeap, fontPath, &font)) { PrintLine_E("Failed to load slug font from \"%.*s\"", StrPrint(fontPath)); return; }
+	
+	//Building every label's geometry is what drawing would cost per frame if the geometry was rebuilt on every draw
+	SlugText_t* labels = AllocArray(mainHeap, SlugText_t, numLabels);
+	NotNull(labels);
+	PerfTime_t buildStartTime = GetPerfTime();
+	for (u64 lIndex = 0; lIndex < numLabels; lIndex++)
+	{
+		MemArena_t* scratch = GetScratchArena();
+		labels[lIndex] = CreateSlugText(mainHeap, PrintInArenaStr(scratch, "Label %llu", lIndex), &font);
+		FreeScratchArena(scratch);
+	}
+	PerfTime_t buildEndTime = GetPerfTime();
+	r64 buildTime = GetPerfTimeDiff(&buildStartTime, &buildEndTime);
+	
+	SlugTextBatch_t batch;
+	CreateSlugTextBatch(mainHeap, &batch, &font, numLabels);
+	for (u64 lIndex = 0; lIndex < numLabels; lIndex++)
+	{
+		SlugTextBatchAdd(&batch, &labels[lIndex], NewVec2((r32)(lIndex % 100) * 64, (r32)(lIndex / 100) * 16));
+	}
+	PerfTime_t packStartTime = GetPerfTime();
+	UpdateSlugTextBatch(&batch);
+	PerfTime_t packEndTime = GetPerfTime();
+	r64 packTime = GetPerfTimeDiff(&packStartTime, &packEndTime);
+	u64 numBatchVertices = batch.vertBuffer.numVertices;
+	
+	RenderContextState_t oldState = rc->state;
+	const PlatWindow_t* oldWindow = rc->currentWindow;
+	RenderCmdBuffer_t oldBuffer = rc->cmdBuffer;
+	InitRenderCmdBuffer(&rc->cmdBuffer, mainHeap);
+	rc->cmdBackend = RenderApi_None;
+	
+	//Pass 0 draws each label with RenderSlugText, pass 1 draws them all with RenderSlugTextBatch
+	const char* passNames[2] = { "One at a Time:  ", "Batched:        " };
+	r64 times[2] = {};
+	u64 passDrawCalls[2] = {};
+	for (u64 pass = 0; pass < ArrayCount(times); pass++)
+	{
+		PerfTime_t startTime = GetPerfTime();
+		for (u64 fIndex = 0; fIndex < numFrames; fIndex++)
+		{
+			ClearRenderCmdBuffer(&rc->cmdBuffer);
+			RcInvalidateUniformShadows();
+			RcBegin(platInfo->mainWindow, nullptr, &pig->resources.shaders->main2D, Black);
+			if (pass == 0)
+			{
+				for (u64 lIndex = 0; lIndex < numLabels; lIndex++)
+				{
+					RenderSlugText(&labels[lIndex], NewVec2((r32)(lIndex % 100) * 64, (r32)(lIndex / 100) * 16));
+				}
+			}
+			else { RenderSlugTextBatch(&batch); }
+		}
+		PerfTime_t endTime = GetPerfTime();
+		times[pass] = GetPerfTimeDiff(&startTime, &endTime);
+		passDrawCalls[pass] = rc->cmdBuffer.stats.numDrawCalls;
+	}
+	u64 numRebuilds = batch.numRebuilds;
+	
+	FreeRenderCmdBuffer(&rc->cmdBuffer);
+	rc->cmdBuffer = oldBuffer;
+	rc->cmdBackend = pig->renderApi;
+	rc->state = oldState;
+	rc->currentWindow = oldWindow;
+	RcInvalidateUniformShadows(); //the shadows now describe what the null backend was told, not the real one
+	
+	FreeSlugTextBatch(&batch);
+	for (u64 lIndex = 0; lIndex < numLabels; lIndex++) { FreeSlugText(&labels[lIndex]); }
+	FreeMem(mainHeap, labels, sizeof(SlugText_t) * numLabels);
+	FreeSlugFont(&font);
+	
+	PrintLine_N("%llu static label%s for %llu frame%s against the null backend:", numLabels, Plural(numLabels, "s"), numFrames, Plural(numFrames, "s"));
+	PrintLine_I("  Geometry Build:   %.2lfms for every label (the per-frame cost if text was rebuilt on every draw)", buildTime);
+	PrintLine_I("  Batch Pack:       %.2lfms (%llu vertices, rebuilt %llu time%s)", packTime, numBatchVertices, numRebuilds, Plural(numRebuilds, "s"));
+	for (u64 pass = 0; pass < ArrayCount(times); pass++)
+	{
+		PrintLine_I("  %s  %.3lfms/frame, %llu draw call%s/frame", passNames[pass], times[pass] / (r64)numFrames, passDrawCalls[pass], Plural(passDrawCalls[pass], "s"));
+	}
+}
+EXPRESSION_FUNC_DEFINITION(Debug_SlugTextBench_Glue) { EXP_GET_ARG_STR(0, fontPath); EXP_GET_ARG_U64(1, numLabels); EXP_GET_ARG_U64(2, numFrames); Debug_SlugTextBench(fontPath, numLabels, numFrames); return NewExpValueVoid(); }
+#endif //SLUG_SUPPORTED
+
+// +--------------------------------------------------------------+
+// |                       asset_pack_info                        |
+// +--------------------------------------------------------------+
+#if PIG_ASSET_PACK
+#define Debug_AssetPackInfo_Def "void asset_pack_info()"
+#define Debug_AssetPackInfo_Desc "Prints information about the open asset pack and how many file reads it has served"
+void Debug_AssetPackInfo()
+{
+	AssetPack_t* pack = &pig->assetPack;
+	if (!pack->isOpen) { PrintLine_I("No asset pack is open (looked for \"%s\" at startup)", ASSET_PACK_FILE_PATH); return; }
+	
+	u64 numReads = PigAtomicLoadAcquire(&pack->stats.numReads);
+	u64 numMaps = PigAtomicLoadAcquire(&pack->stats.numMaps);
+	u64 numDecompressed = PigAtomicLoadAcquire(&pack->stats.numDecompressed);
+	u64 numFallbacks = PigAtomicLoadAcquire(&pack->stats.numFallbacks);
+	plat->LockMutex(&pack->mutex, MUTEX_LOCK_INFINITE);
+	u64 cacheSize = pack->cacheSize;
+	u64 numMappedViews = pack->numOpenViews + pack->numCacheViews;
+	u64 numOwnedViews = pack->ownedViews.length;
+	plat->UnlockMutex(&pack->mutex);
+	
+	MemArena_t* scratch = GetScratchArena();
+	u32 numEntries = pack->header->numEntries;
+	PrintLine_N("Asset pack \"%.*s\"%s:", StrPrint(pack->filePath), pack->isHooked ? "" : " (not hooked)");
+	PrintLine_I("  %u entr%s (%llu compressed), %s in the pack, %s decompressed", numEntries, (numEntries == 1) ? "y" : "ies", pack->numCompressed, FormatBytesNt(pack->mappedFile.size, scratch), FormatBytesNt(pack->totalSize, scratch));
+	PrintLine_I("  Cache: %s, %llu view%s into the pack or cache, %llu decompressed view%s", FormatBytesNt(cacheSize, scratch), numMappedViews, Plural(numMappedViews, "s"), numOwnedViews, Plural(numOwnedViews, "s"));
+	PrintLine_I("  Served %llu read%s and %llu map%s (%llu decompressed on demand), %llu call%s went to loose files", numReads, Plural(numReads, "s"), numMaps, Plural(numMaps, "s"), numDecompressed, numFallbacks, Plural(numFallbacks, "s"));
+	FreeScratchArena(scratch);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_AssetPackInfo_Glue) { Debug_AssetPackInfo(); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                      asset_pack_enable                       |
+// +--------------------------------------------------------------+
+#define Debug_AssetPackEnable_Def "void asset_pack_enable(bool enabled)"
+#define Debug_AssetPackEnable_Desc "Opens or closes the asset pack next to the executable. Resources that are already loaded stay as they are until they get reloaded"
+void Debug_AssetPackEnable(bool enabled)
+{
+	AssetPack_t* pack = &pig->assetPack;
+	if (enabled)
+	{
+		if (pack->isOpen) { WriteLine_I("The asset pack is already open"); return; }
+		if (Pig_OpenAssetPack()) { WriteLine_I("Files will be read out of the asset pack from now on"); }
+		else { PrintLine_E("Couldn't open an asset pack at \"%s\"", ASSET_PACK_FILE_PATH); }
+	}
+	else
+	{
+		if (!pack->isOpen) { WriteLine_I("No asset pack is open"); return; }
+		plat->LockMutex(&pack->mutex, MUTEX_LOCK_INFINITE);
+		u64 numViews = pack->numOpenViews + pack->numCacheViews + pack->ownedViews.length;
+		plat->UnlockMutex(&pack->mutex);
+		if (numViews > 0) { PrintLine_E("Can't close the asset pack, %llu file%s mapped out of it %s still open", numViews, Plural(numViews, "s"), (numViews == 1) ? "is" : "are"); return; }
+		CloseAssetPack(pack);
+		WriteLine_I("Closed the asset pack, files will be read from the disk from now on");
+	}
+}
+EXPRESSION_FUNC_DEFINITION(Debug_AssetPackEnable_Glue) { EXP_GET_ARG_BOOL(0, enabled); Debug_AssetPackEnable(enabled); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                       asset_pack_build                       |
+// +--------------------------------------------------------------+
+#define Debug_AssetPackBuild_Def "void asset_pack_build(string folder_path, string output_path, bool compress)"
+#define Debug_AssetPackBuild_Desc "Packs every file in a folder (recursively) into an asset pack, LZ4 compressing the files that shrink enough when compress is true. Use \"Resources\" and \"Resources.pak\" to build the pack the engine opens at startup"
+void Debug_AssetPackBuild(MyStr_t folderPath, MyStr_t outputPath, bool compress)
+{
+	AssetPackBuildStats_t stats = {};
+	PerfTime_t startTime = GetPerfTime();
+	bool success = BuildAssetPack(folderPath, outputPath, compress, &stats);
+	PerfTime_t endTime = GetPerfTime();
+	if (!success) { PrintLine_E("Failed to build an asset pack from \"%.*s\"", StrPrint(folderPath)); return; }
+	
+	MemArena_t* scratch = GetScratchArena();
+	PrintLine_I("Packed %llu file%s (%llu compressed) from \"%.*s\" into \"%.*s\" in %.1lfms", stats.numFiles, Plural(stats.numFiles, "s"), stats.numCompressed, StrPrint(folderPath), StrPrint(outputPath), GetPerfTimeDiff(&startTime, &endTime));
+	PrintLine_I("  %s of files, %s pack", FormatBytesNt(stats.sourceSize, scratch), FormatBytesNt(stats.packSize, scratch));
+	FreeScratchArena(scratch);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_AssetPackBuild_Glue) { EXP_GET_ARG_STR(0, folderPath); EXP_GET_ARG_STR(1, outputPath); EXP_GET_ARG_BOOL(2, compress); Debug_AssetPackBuild(folderPath, outputPath, compress); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                       asset_pack_bench                       |
+// +--------------------------------------------------------------+
+#define Debug_AssetPackBench_Def "void asset_pack_bench(string pack_path)"
+#define Debug_AssetPackBench_Desc "Reads every file in an asset pack from the loose files it was built from and then out of the pack, twice each, and times serial vs threaded decompression of the whole pack. The OS file cache isn't flushed so every pass is a warm read"
+void Debug_AssetPackBench(MyStr_t packPath)
+{
+	const PlatformApi_t* realApi = pig->assetPack.isHooked ? pig->assetPack.realApi : plat;
+	
+	PerfTime_t openStartTime = GetPerfTime();
+	AssetPack_t pack;
+	if (!OpenAssetPack(&pack, mainHeap, packPath, realApi)) { return; }
+	PerfTime_t openEndTime = GetPerfTime();
+	r64 openTime = GetPerfTimeDiff(&openStartTime, &openEndTime);
+	u64 numEntries = pack.header->numEntries;
+	
+	//The loose files have to be there (run this from the folder the pack was built in), otherwise the platform layer logs an error for every file
+	u64 numMissing = 0;
+	for (u64 eIndex = 0; eIndex < numEntries; eIndex++)
+	{
+		if (!realApi->DoesFileExist(GetAssetPackEntryPath(&pack, &pack.entries[eIndex]), nullptr)) { numMissing++; }
+	}
+	if (numMissing > 0)
+	{
+		PrintLine_E("%llu of the %llu file%s in the pack aren't next to it as loose files", numMissing, numEntries, Plural(numEntries, "s"));
+		CloseAssetPack(&pack);
+		return;
+	}
+	
+	//Even passes read the loose files, odd passes read the pack. Both allocate and copy each file like ReadFileContents does.
+	//NOTE: We don't flush the OS file cache (and checking that the loose files exist above already touches them) so none of
+	//      these are cold reads, the first round only differs from the second in what this process has touched so far
+	const char* passNames[4] = { "Loose (warm 1): ", "Pack (warm 1):  ", "Loose (warm 2): ", "Pack (warm 2):  " };
+	r64 times[4] = {};
+	u64 passBytes[4] = {};
+	u64 numFailed = 0;
+	for (u64 pass = 0; pass < ArrayCount(times); pass++)
+	{
+		bool fromPack = ((pass % 2) == 1);
+		PerfTime_t startTime = GetPerfTime();
+		for (u64 eIndex = 0; eIndex < numEntries; eIndex++)
+		{
+			const AssetPackFileEntry_t* entry = &pack.entries[eIndex];
+			if (fromPack)
+			{
+				u8* entryData = AllocArray(&pig->largeAllocHeap, u8, entry->size+1);
+				NotNull(entryData);
+				if (ReadAssetPackEntry(&pack, eIndex, entryData)) { passBytes[pass] += entry->size; }
+				else { numFailed++; }
+				FreeMem(&pig->largeAllocHeap, entryData, entry->size+1);
+			}
+			else
+			{
+				PlatFileContents_t fileContents = {};
+				if (realApi->ReadFileContents(GetAssetPackEntryPath(&pack, entry), &pig->largeAllocHeap, false, &fileContents))
+				{
+					passBytes[pass] += fileContents.size;
+					realApi->FreeFileContents(&fileContents);
+				}
+				else { numFailed++; }
+			}
+		}
+		PerfTime_t endTime = GetPerfTime();
+		times[pass] = GetPerfTimeDiff(&startTime, &endTime);
+	}
+	
+	//This is what PrefetchAssetPack does at startup when everything is going to be loaded
+	r64 decompressTimes[2] = {};
+	u64 numQueuedTasks = 0;
+	u64 cacheSize = 0;
+	for (u64 pass = 0; pass < ArrayCount(decompressTimes); pass++)
+	{
+		PerfTime_t startTime = GetPerfTime();
+		PrefetchAssetPack(&pack, (pass == 1));
+		PerfTime_t endTime = GetPerfTime();
+		decompressTimes[pass] = GetPerfTimeDiff(&startTime, &endTime);
+		if (pass == 1) { numQueuedTasks = pack.numQueuedTasks; }
+		cacheSize = pack.cacheSize;
+		ReleaseAssetPackCache(&pack);
+	}
+	u64 packSize = pack.mappedFile.size;
+	u64 numCompressed = pack.numCompressed;
+	CloseAssetPack(&pack);
+	
+	MemArena_t* scratch = GetScratchArena();
+	PrintLine_N("%llu file%s in \"%.*s\" (%s, %llu compressed):", numEntries, Plural(numEntries, "s"), StrPrint(packPath), FormatBytesNt(packSize, scratch), numCompressed);
+	PrintLine_I("  Pack Open:      %.2lfms", openTime);
+	for (u64 pass = 0; pass < ArrayCount(times); pass++)
+	{
+		r64 megabytesPerSec = (times[pass] > 0) ? (((r64)passBytes[pass] / (r64)Megabytes(1)) / (times[pass] / 1000.0)) : 0.0;
+		PrintLine_I("  %s%.2lfms (%.0lf MB/s)", passNames[pass], times[pass], megabytesPerSec);
+	}
+	PrintLine_I("  Decompress:     %.2lfms serial, %.2lfms with %llu pool task%s (%s)", decompressTimes[0], decompressTimes[1], numQueuedTasks, Plural(numQueuedTasks, "s"), FormatBytesNt(cacheSize, scratch));
+	if (numFailed > 0) { PrintLine_E("  %llu read%s failed", numFailed, Plural(numFailed, "s")); }
+	FreeScratchArena(scratch);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_AssetPackBench_Glue) { EXP_GET_ARG_STR(0, packPath); Debug_AssetPackBench(packPath); return NewExpValueVoid(); }
+#endif //PIG_ASSET_PACK
+
+// +--------------------------------------------------------------+
+// |                          font_atlas                          |
+// +--------------------------------------------------------------+
+#define Debug_FontAtlas_Def "void font_atlas()"
+#define Debug_FontAtlas_Desc "Prints information about the dynamic glyph atlas of every loaded font face"
+void Debug_FontAtlas()
+{
+	MemArena_t* scratch = GetScratchArena();
+	u64 numAtlases = 0;
+	for (u64 fontIndex = 0; fontIndex < RESOURCES_NUM_FONTS; fontIndex++)
+	{
+		Font_t* font = &pig->resources.fonts->items[fontIndex];
+		if (!font->isValid) { continue; }
+		VarArrayLoop(&font->faces, fIndex)
+		{
+			VarArrayLoopGet(FontFace_t, face, &font->faces, fIndex);
+			if (face->atlas == nullptr) { continue; }
+			FontGlyphAtlas_t* atlas = face->atlas;
+			PrintLine_N("Font[%llu] face[%llu] (size %d): %llu glyph%s on %llu/%u page%s (%dx%d)", fontIndex, fIndex, face->fontSize, atlas->numGlyphs, Plural(atlas->numGlyphs, "s"), atlas->numPages, FONT_ATLAS_MAX_PAGES, Plural(FONT_ATLAS_MAX_PAGES, "s"), atlas->pageSize.width, atlas->pageSize.height);
+			PrintLine_I("  Rasterized %llu glyph%s in %llu bake%s (%.2lfms), %llu missing, %llu pending, %llu eviction%s", atlas->numRasterized, Plural(atlas->numRasterized, "s"), atlas->numBakes, Plural(atlas->numBakes, "s"), atlas->rasterizeTime, atlas->missingCodepoints.length, atlas->pendingCodepoints.length, atlas->numEvictions, Plural(atlas->numEvictions, "s"));
+			PrintLine_I("  Uploaded %s in %llu upload%s", FormatBytesNt(atlas->numUploadedBytes, scratch), atlas->numUploads, Plural(atlas->numUploads, "s"));
+			numAtlases++;
+		}
+	}
+	if (numAtlases == 0) { WriteLine_W("No font faces have a dynamic glyph atlas"); }
+	FreeScratchArena(scratch);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_FontAtlas_Glue) { Debug_FontAtlas(); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                       font_atlas_bench                       |
+// +--------------------------------------------------------------+
+#define Debug_FontAtlasBench_Def "void font_atlas_bench(string font_name, i32 size)"
+#define Debug_FontAtlasBench_Desc "Loads a platform font with the full Latin/Cyrillic/Kana bakes and then with an ASCII bake and a dynamic glyph atlas, and compares load time and memory"
+u64 Debug_GetFontTextureBytes(const Font_t* font)
+{
+	u64 result = 0;
+	VarArrayLoop(&font->faces, fIndex)
+	{
+		VarArrayLoopGet(FontFace_t, face, &font->faces, fIndex);
+		VarArrayLoop(&face->bakes, bIndex)
+		{
+			VarArrayLoopGet(FontBake_t, bake, &face->bakes, bIndex);
+			result += (u64)(bake->bitmap.widthi * bake->bitmap.heighti);
+		}
+		if (face->atlas != nullptr) { result += face->atlas->numPages * (u64)(face->atlas->pageSize.width * face->atlas->pageSize.height); }
+	}
+	return result;
+}
+void Debug_FontAtlasBench(MyStr_t fontName, i32 fontSize)
+{
+	if (fontSize <= 0) { WriteLine_E("size must be greater than 0"); return; }
+	v2i bakeSize = ((fontSize <= 24) ? NewVec2i(512, 512) : NewVec2i(1024, 1024));
+	PlatFontRange_t ranges[2] = {};
+	ranges[0].fontSize = (float)fontSize;
+	ranges[1].fontSize = (float)fontSize;
+	
+	// +==============================+
+	// |       Full Range Bakes       |
+	// +==============================+
+	u64 fullHeapBefore = mainHeap->used;
+	PerfTime_t fullStartTime = GetPerfTime();
+	Font_t fullFont = {};
+	StartFont(&fullFont, mainHeap, 1);
+	FontFace_t* fullFace = FontStartFace(&fullFont, fontName, true, fontSize, false, false, 3);
+	if (fullFace == nullptr) { PrintLine_E("Failed to load font \"%.*s\"", StrPrint(fontName)); DestroyFont(&fullFont); return; }
+	ranges[0].firstCodepoint = 0x20;
+	ranges[0].numChars = 0x7E - ranges[0].firstCodepoint;
+	ranges[1].firstCodepoint = UNICODE_LATIN_EXT_START;
+	ranges[1].numChars = UNICODE_LATIN_EXT_COUNT;
+	FontAddBakeToActiveFace(&fullFont, fullFace, bakeSize, 2, &ranges[0]);
+	ranges[0].firstCodepoint = UNICODE_CYRILLIC_START;
+	ranges[0].numChars = UNICODE_CYRILLIC_COUNT;
+	FontAddBakeToActiveFace(&fullFont, fullFace, bakeSize, 1, &ranges[0]);
+	ranges[0].firstCodepoint = UNICODE_HIRAGANA_START;
+	ranges[0].numChars = UNICODE_KATAKANA_END - ranges[0].firstCodepoint;
+	FontAddBakeToActiveFace(&fullFont, fullFace, bakeSize, 1, &ranges[0]);
+	FontFinishFace(&fullFont, fullFace);
+	EndFont(&fullFont);
+	PerfTime_t fullEndTime = GetPerfTime();
+	u64 fullHeapUsed = mainHeap->used - fullHeapBefore;
+	u64 fullTextureBytes = Debug_GetFontTextureBytes(&fullFont);
+	DestroyFont(&fullFont);
+	
+	// +==============================+
+	// |    ASCII + Dynamic Atlas     |
+	// +==============================+
+	u64 dynamicHeapBefore = mainHeap->used;
+	PerfTime_t dynamicStartTime = GetPerfTime();
+	Font_t dynamicFont = {};
+	StartFont(&dynamicFont, mainHeap, 1);
+	FontFace_t* dynamicFace = FontStartFace(&dynamicFont, fontName, true, fontSize, false, false, 1);
+	if (dynamicFace == nullptr) { PrintLine_E("Failed to load font \"%.*s\"", StrPrint(fontName)); DestroyFont(&dynamicFont); return; }
+	ranges[0].firstCodepoint = 0x20;
+	ranges[0].numChars = 0x7E - ranges[0].firstCodepoint;
+	FontAddBakeToActiveFace(&dynamicFont, dynamicFace, bakeSize, 1, &ranges[0]);
+	FontEnableDynamicAtlas(&dynamicFont, dynamicFace, bakeSize);
+	u64 fontFileSize = (dynamicFace->atlas != nullptr) ? dynamicFace->atlas->fontFile.size : 0;
+	FontFinishFace(&dynamicFont, dynamicFace);
+	EndFont(&dynamicFont);
+	PerfTime_t dynamicEndTime = GetPerfTime();
+	u64 dynamicHeapUsed = mainHeap->used - dynamicHeapBefore;
+	u64 dynamicTextureBytes = Debug_GetFontTextureBytes(&dynamicFont);
+	
+	//Touch every Latin Extended and Cyrillic character to see what on-demand rasterization costs
+	u64 numTouched = 0;
+	PerfTime_t touchStartTime = GetPerfTime();
+	for (u32 codepoint = UNICODE_LATIN_EXT_START; codepoint < UNICODE_LATIN_EXT_START + UNICODE_LATIN_EXT_COUNT; codepoint++) { GetFontBakeForChar(&dynamicFont, dynamicFace, codepoint); numTouched++; }
+	for (u32 codepoint = UNICODE_CYRILLIC_START; codepoint < UNICODE_CYRILLIC_START + UNICODE_CYRILLIC_COUNT; codepoint++) { GetFontBakeForChar(&dynamicFont, dynamicFace, codepoint); numTouched++; }
+	FontFlushGlyphAtlases(&dynamicFont); //rasterizes everything we just touched in batches of FONT_ATLAS_MAX_BATCH_GLYPHS
+	PerfTime_t touchEndTime = GetPerfTime();
+	u64 touchedHeapUsed = mainHeap->used - dynamicHeapBefore;
+	u64 touchedTextureBytes = Debug_GetFontTextureBytes(&dynamicFont);
+	DestroyFont(&dynamicFont);
+	
+	MemArena_t* scratch = GetScratchArena();
+	PrintLine_N("\"%.*s\" at size %d with %dx%d bakes:", StrPrint(fontName), fontSize, bakeSize.width, bakeSize.height);
+	PrintLine_I("  Full ranges:     %.2lfms, %s of heap, %s of textures", GetPerfTimeDiff(&fullStartTime, &fullEndTime), FormatBytesNt(fullHeapUsed, scratch), FormatBytesNt(fullTextureBytes, scratch));
+	PrintLine_I("  ASCII + atlas:   %.2lfms, %s of heap (+%s font file kept), %s of textures", GetPerfTimeDiff(&dynamicStartTime, &dynamicEndTime), FormatBytesNt(dynamicHeapUsed, scratch), FormatBytesNt(fontFileSize, scratch), FormatBytesNt(dynamicTextureBytes, scratch));
+	PrintLine_I("  After %llu glyphs: %.2lfms (%.3lfms/glyph), %s of heap, %s of textures", numTouched, GetPerfTimeDiff(&touchStartTime, &touchEndTime), GetPerfTimeDiff(&touchStartTime, &touchEndTime) / (r64)numTouched, FormatBytesNt(touchedHeapUsed, scratch), FormatBytesNt(touchedTextureBytes, scratch));
+	FreeScratchArena(scratch);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_FontAtlasBench_Glue) { EXP_GET_ARG_STR(0, fontName); EXP_GET_ARG_I32(1, fontSize); Debug_FontAtlasBench(fontName, fontSize); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                        font_sdf_bench                        |
+// +--------------------------------------------------------------+
+#define Debug_FontSdfBench_Def "void font_sdf_bench(string font_name, i32 raster_size)"
+#define Debug_FontSdfBench_Desc "Loads a platform font the way debugFont used to (12/18/24 in 4 styles) and then as 4 distance field faces, and compares load time and memory"
+bool Debug_FontSdfBenchAddFace(Font_t* font, MyStr_t fontName, i32 fontSize, bool bold, bool italic, bool cyrillic, bool isSdf, i32 rasterSize, v2i bakeSize)
+{
+	PlatFontRange_t ranges[2] = {};
+	ranges[0].fontSize = (float)fontSize;
+	ranges[1].fontSize = (float)fontSize;
+	FontFace_t* face = FontStartFace(font, fontName, true, fontSize, bold, italic, 2);
+	if (face == nullptr) { return false; }
+	ranges[0].firstCodepoint = 0x20;
+	ranges[0].numChars = 0x7E - ranges[0].firstCodepoint;
+	ranges[1].firstCodepoint = UNICODE_LATIN_EXT_START;
+	ranges[1].numChars = UNICODE_LATIN_EXT_COUNT;
+	if (isSdf) { FontAddSdfBakeToActiveFace(font, face, rasterSize, FONT_SDF_DEFAULT_SPREAD, bakeSize, 2, &ranges[0]); }
+	else { FontAddBakeToActiveFace(font, face, bakeSize, 2, &ranges[0]); }
+	if (cyrillic)
+	{
+		ranges[0].firstCodepoint = UNICODE_CYRILLIC_START;
+		ranges[0].numChars = UNICODE_CYRILLIC_COUNT;
+		if (isSdf) { FontAddSdfBakeToActiveFace(font, face, rasterSize, FONT_SDF_DEFAULT_SPREAD, bakeSize, 1, &ranges[0]); }
+		else { FontAddBakeToActiveFace(font, face, bakeSize, 1, &ranges[0]); }
+	}
+	FontFinishFace(font, face);
+	return true;
+}
+void Debug_FontSdfBench(MyStr_t fontName, i32 rasterSize)
+{
+	if (rasterSize <= 0) { rasterSize = FONT_SDF_DEFAULT_RASTER_SIZE; }
+	const i32 sizes[] = { 12, 18, 24 };
+	const v2i sizeBakeSizes[] = { NewVec2i(256, 256), NewVec2i(256, 256), NewVec2i(512, 512) };
+	
+	// +==============================+
+	// |       Multi-Size Faces       |
+	// +==============================+
+	u64 multiHeapBefore = mainHeap->used;
+	PerfTime_t multiStartTime = GetPerfTime();
+	Font_t multiFont = {};
+	StartFont(&multiFont, mainHeap, ArrayCount(sizes) * 4);
+	for (u64 sIndex = 0; sIndex < ArrayCount(sizes); sIndex++)
+	{
+		for (u8 style = 0; style < 4; style++)
+		{
+			bool bold = IsFlagSet(style, 0x01);
+			bool italic = IsFlagSet(style, 0x02);
+			if (!Debug_FontSdfBenchAddFace(&multiFont, fontName, sizes[sIndex], bold, italic, (style == 0), false, 0, sizeBakeSizes[sIndex]))
+			{
+				PrintLine_E("Failed to load font \"%.*s\"", StrPrint(fontName));
+				DestroyFont(&multiFont);
+				return;
+			}
+		}
+	}
+	EndFont(&multiFont);
+	PerfTime_t multiEndTime = GetPerfTime();
+	u64 multiHeapUsed = mainHeap->used - multiHeapBefore;
+	u64 multiTextureBytes = Debug_GetFontTextureBytes(&multiFont);
+	u64 multiNumFaces = multiFont.faces.length;
+	DestroyFont(&multiFont);
+	
+	// +==============================+
+	// |          SDF Faces           |
+	// +==============================+
+	u64 sdfHeapBefore = mainHeap->used;
+	PerfTime_t sdfStartTime = GetPerfTime();
+	Font_t sdfFont = {};
+	StartFont(&sdfFont, mainHeap, 4);
+	for (u8 style = 0; style < 4; style++)
+	{
+		bool bold = IsFlagSet(style, 0x01);
+		bool italic = IsFlagSet(style, 0x02);
+		if (!Debug_FontSdfBenchAddFace(&sdfFont, fontName, 18, bold, italic, (style == 0), true, rasterSize, NewVec2i(1024, 1024)))
+		{
+			PrintLine_E("Failed to load font \"%.*s\"", StrPrint(fontName));
+			DestroyFont(&sdfFont);
+			return;
+		}
+	}
+	EndFont(&sdfFont);
+	PerfTime_t sdfEndTime = GetPerfTime();
+	u64 sdfHeapUsed = mainHeap->used - sdfHeapBefore;
+	u64 sdfTextureBytes = Debug_GetFontTextureBytes(&sdfFont);
+	u64 sdfNumFaces = sdfFont.faces.length;
+	bool sdfHadFailures = sdfFont.hasFailures;
+	DestroyFont(&sdfFont);
+	
+	MemArena_t* scratch = GetScratchArena();
+	PrintLine_N("\"%.*s\" ASCII + Latin Ext (+ Cyrillic on regular faces):", StrPrint(fontName));
+	PrintLine_I("  Sizes 12/18/24: %llu face%s, %.2lfms, %s of heap, %s of textures", multiNumFaces, Plural(multiNumFaces, "s"), GetPerfTimeDiff(&multiStartTime, &multiEndTime), FormatBytesNt(multiHeapUsed, scratch), FormatBytesNt(multiTextureBytes, scratch));
+	PrintLine_I("  SDF at %d:      %llu face%s, %.2lfms, %s of heap, %s of textures", rasterSize, sdfNumFaces, Plural(sdfNumFaces, "s"), GetPerfTimeDiff(&sdfStartTime, &sdfEndTime), FormatBytesNt(sdfHeapUsed, scratch), FormatBytesNt(sdfTextureBytes, scratch));
+	if (sdfHadFailures) { WriteLine_W("  Some SDF bakes failed, try a smaller raster_size"); }
+	FreeScratchArena(scratch);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_FontSdfBench_Glue) { EXP_GET_ARG_STR(0, fontName); EXP_GET_ARG_I32(1, rasterSize); Debug_FontSdfBench(fontName, rasterSize); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                      texture_cook_bench                      |
+// +--------------------------------------------------------------+
+#define Debug_TextureCookBench_Def "void texture_cook_bench(string file_path)"
+#define Debug_TextureCookBench_Desc "Loads an image (or every single layer texture resource if file_path is empty) through the PNG path and through a cooked block compressed mip chain, and compares load time, VRAM and quality"
+struct Debug_TextureCookBenchStats_t
+{
+	u64 numTextures;
+	r64 pngLoadTime;
+	u64 pngVram;
+	r64 cookTime;
+	r64 cookedLoadTime;
+	u64 cookedVram;
+	u64 cookedFileSize;
+	u64 sourceFileSize;
+};
+void Debug_TextureCookBenchFile(MyStr_t filePath, bool pixelated, bool highQuality, Debug_TextureCookBenchStats_t* stats)
+{
+	PlatMappedFile_t sourceFile = {};
+	if (!plat->MapFile(filePath, &sourceFile)) { PrintLine_E("Couldn't open \"%.*s\"", StrPrint(filePath)); return; }
+	MemArena_t* scratch = GetScratchArena();
+	
+	//PNG path: decode, upload, then let the GPU build the mips (same as LoadTexture)
+	PerfTime_t pngStartTime = GetPerfTime();
+	PlatImageData_t imageData;
+	if (!plat->TryParseImageFile(sourceFile.size, sourceFile.data, sizeof(u32), &imageData))
+	{
+		PrintLine_E("Couldn't parse \"%.*s\"", StrPrint(filePath));
+		plat->UnmapFile(&sourceFile);
+		FreeScratchArena(scratch);
+		return;
+	}
+	Texture_t pngTexture = {};
+	CreateTexture(scratch, &pngTexture, &imageData, pixelated, false);
+	PerfTime_t pngEndTime = GetPerfTime();
+	u64 pngVram = ((u64)imageData.width * (u64)imageData.height * sizeof(u32) * 4) / 3; //full mip chain is about 4/3 of the base level
+	DestroyTexture(&pngTexture);
+	
+	//Cook (this is the one time cost paid on first load in developer builds)
+	PerfTime_t cookStartTime = GetPerfTime();
+	TextureCompression_t format = ChooseTextureCompression(&imageData, pixelated, highQuality);
+	CookedTexture_t cooked = {};
+	bool cookedSuccessfully = CookTexture(scratch, &imageData, format, true, &cooked);
+	PerfTime_t cookEndTime = GetPerfTime();
+	if (!cookedSuccessfully)
+	{
+		PrintLine_E("Failed to cook \"%.*s\"", StrPrint(filePath));
+		plat->FreeImageData(&imageData);
+		plat->UnmapFile(&sourceFile);
+		FreeScratchArena(scratch);
+		return;
+	}
+	u64 cookedFileSize = 0;
+	u8* cookedFileData = SerializeCookedTexture(&cooked, scratch, &cookedFileSize);
+	NotNull(cookedFileData);
+	
+	//Cooked path: parse the container and upload the blocks directly
+	PerfTime_t cookedStartTime = GetPerfTime();
+	CookedTexture_t loadedCooked = {};
+	bool parsedCooked = DeserializeCookedTexture(cookedFileData, cookedFileSize, &loadedCooked);
+	Texture_t cookedTexture = {};
+	bool uploadedCooked = (parsedCooked && CreateTextureFromCooked(scratch, &cookedTexture, &loadedCooked, pixelated, false));
+	PerfTime_t cookedEndTime = GetPerfTime();
+	DestroyTexture(&cookedTexture);
+	
+	PlatImageData_t decodedImage = {};
+	r64 psnr = 0.0;
+	if (DecodeCookedTextureMip(&cooked, 0, scratch, &decodedImage)) { psnr = CalcImagePsnr(&imageData, &decodedImage); }
+	
+	PrintLine_I("  %.*s %dx%d %s%s: PNG %.2lfms/%s, cook %.2lfms, cooked %.2lfms/%s, %.1lfdB",
+		StrPrint(GetFileNamePart(filePath)), imageData.width, imageData.height,
+		GetTextureCompressionStr(format), (uploadedCooked ? "" : " (upload failed)"),
+		GetPerfTimeDiff(&pngStartTime, &pngEndTime), FormatBytesNt(pngVram, scratch),
+		GetPerfTimeDiff(&cookStartTime, &cookEndTime),
+		GetPerfTimeDiff(&cookedStartTime, &cookedEndTime), FormatBytesNt(cooked.dataSize, scratch),
+		psnr
+	);
+	
+	stats->numTextures++;
+	stats->pngLoadTime += GetPerfTimeDiff(&pngStartTime, &pngEndTime);
+	stats->pngVram += pngVram;
+	stats->cookTime += GetPerfTimeDiff(&cookStartTime, &cookEndTime);
+	stats->cookedLoadTime += GetPerfTimeDiff(&cookedStartTime, &cookedEndTime);
+	stats->cookedVram += cooked.dataSize;
+	stats->cookedFileSize += cookedFileSize;
+	stats->sourceFileSize += sourceFile.size;
+	
+	plat->FreeImageData(&imageData);
+	plat->UnmapFile(&sourceFile);
+	FreeScratchArena(scratch);
+}
+void Debug_TextureCookBench(MyStr_t filePath)
+{
+	Debug_TextureCookBenchStats_t stats = {};
+	if (!IsEmptyStr(filePath))
+	{
+		Debug_TextureCookBenchFile(filePath, false, false, &stats);
+	}
+	else
+	{
+		for (u64 textureIndex = 0; textureIndex < RESOURCES_NUM_TEXTURES; textureIndex++)
+		{
+			ResourceTextureMetaInfo_t metaInfo = {};
+			const char* texturePath = Resources_GetPathForTexture(textureIndex, &metaInfo);
+			if (texturePath == nullptr || metaInfo.numLayers != 0) { continue; }
+			Debug_TextureCookBenchFile(NewStr(texturePath), metaInfo.pixelated, metaInfo.highQuality, &stats);
+		}
+	}
+	if (stats.numTextures == 0) { return; }
+	
+	MemArena_t* scratch = GetScratchArena();
+	PrintLine_N("%llu texture%s:", stats.numTextures, Plural(stats.numTextures, "s"));
+	PrintLine_I("  PNG:    %.2lfms to load, %s of VRAM, %s on disk", stats.pngLoadTime, FormatBytesNt(stats.pngVram, scratch), FormatBytesNt(stats.sourceFileSize, scratch));
+	PrintLine_I("  Cooked: %.2lfms to load, %s of VRAM, %s on disk (%.2lfms to cook)", stats.cookedLoadTime, FormatBytesNt(stats.cookedVram, scratch), FormatBytesNt(stats.cookedFileSize, scratch), stats.cookTime);
+	WriteLine_I("  (Upload times don't include the GPU finishing the work, glGenerateMipmap in the PNG path is mostly asynchronous)");
+	FreeScratchArena(scratch);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_TextureCookBench_Glue) { EXP_GET_ARG_STR(0, filePath); Debug_TextureCookBench(filePath); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                      texture_cook_test                       |
+// +--------------------------------------------------------------+
+#define Debug_TextureCookTest_Def "void texture_cook_test()"
+#define Debug_TextureCookTest_Desc "Cooks a generated test image in every format, decodes it back and checks the result (deterministic, needs no files or GPU)"
+void Debug_TextureCookTest()
+{
+	u64 numFailed = 0;
+	for (u64 formatIndex = 0; formatIndex < TextureCompression_NumFormats; formatIndex++)
+	{
+		TextureCompression_t format = (TextureCompression_t)formatIndex;
+		r64 psnr = 0.0;
+		const char* failure = nullptr;
+		if (TestTextureCompressionRoundTrip(format, &psnr, &failure))
+		{
+			PrintLine_I("  %s: passed, %.1lfdB (minimum %.1lfdB)", GetTextureCompressionStr(format), psnr, GetTextureCompressionTestMinPsnr(format));
+		}
+		else
+		{
+			PrintLine_E("  %s: FAILED, %s (%.1lfdB)", GetTextureCompressionStr(format), failure, psnr);
+			numFailed++;
+		}
+	}
+	if (numFailed == 0) { WriteLine_I("All texture compression round trips passed"); }
+	else { PrintLine_E("%llu texture compression format%s failed", numFailed, Plural(numFailed, "s")); }
+}
+EXPRESSION_FUNC_DEFINITION(Debug_TextureCookTest_Glue) { Debug_TextureCookTest(); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                        texture_atlas                         |
+// +--------------------------------------------------------------+
+#define Debug_TextureAtlas_Def "void texture_atlas()"
+#define Debug_TextureAtlas_Desc "Prints which texture resources are packed into the texture atlas, how full each page is, and how many texture binds the last frame took"
+void Debug_TextureAtlas()
+{
+	TextureAtlas_t* atlas = &pig->resources.textureAtlas;
+	MemArena_t* scratch = GetScratchArena();
+	PrintLine_N("Texture atlas: %llu/%u page%s (%dx%d)", atlas->numPages, TEXTURE_ATLAS_MAX_PAGES, Plural(TEXTURE_ATLAS_MAX_PAGES, "s"), atlas->pageSize.width, atlas->pageSize.height);
+	for (u64 pIndex = 0; pIndex < atlas->numPages; pIndex++)
+	{
+		TextureAtlasPage_t* page = &atlas->pages[pIndex];
+		u64 usedArea = 0;
+		for (u64 textureIndex = 0; textureIndex < RESOURCES_NUM_TEXTURES; textureIndex++)
+		{
+			Texture_t* texture = &pig->resources.textures->items[textureIndex];
+			if (!texture->isValid || texture->atlasPage != &page->texture) { continue; }
+			usedArea += (u64)(texture->atlasRec.width * texture->atlasRec.height);
+			PrintLine_D("    texture[%llu] %dx%d at (%d, %d)", textureIndex, texture->atlasRec.width, texture->atlasRec.height, texture->atlasRec.x, texture->atlasRec.y);
+		}
+		u64 pageArea = (u64)(atlas->pageSize.width * atlas->pageSize.height);
+		PrintLine_I("  Page[%llu] (%s): %llu item%s, %llu shel%s, %llu free region%s, %.1lf%% used",
+			pIndex, page->pixelated ? "pixelated" : "smooth",
+			page->numItems, Plural(page->numItems, "s"),
+			page->numShelves, (page->numShelves == 1) ? "f" : "ves",
+			page->freeRecs.length, Plural(page->freeRecs.length, "s"),
+			(r64)usedArea * 100.0 / (r64)pageArea
+		);
+	}
+	PrintLine_I("  %llu add%s, %llu in place update%s, %llu remove%s", atlas->numAdds, Plural(atlas->numAdds, "s"), atlas->numInPlaceUpdates, Plural(atlas->numInPlaceUpdates, "s"), atlas->numRemoves, Plural(atlas->numRemoves, "s"));
+	PrintLine_I("  Uploaded %s in %llu upload%s", FormatBytesNt(atlas->numUploadedBytes, scratch), atlas->numUploads, Plural(atlas->numUploads, "s"));
+	const RenderCmdStats_t* stats = &rc->lastFrameStats;
+	PrintLine_I("  Last frame: %llu texture bind%s for %llu draw call%s", stats->commandCounts[RenderCmdType_BindTexture1], Plural(stats->commandCounts[RenderCmdType_BindTexture1], "s"), stats->numDrawCalls, Plural(stats->numDrawCalls, "s"));
+	FreeScratchArena(scratch);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_TextureAtlas_Glue) { Debug_TextureAtlas(); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                      image_kernel_bench                      |
+// +--------------------------------------------------------------+
+#define Debug_ImageKernelBench_Def "void image_kernel_bench(i32 size)"
+#define Debug_ImageKernelBench_Desc "Runs the image kernels (sheet slicing, alpha check, premultiply, swizzle, mip chain) over a size x size RGBA image (4096 if 0) on every kernel path this CPU supports and checks they all match the scalar output"
+void Debug_ImageKernelBench(i32 size)
+{
+	if (size <= 0) { size = 4096; }
+	const i32 frameSize = 32;
+	u64 numPixels = (u64)size * (u64)size;
+	u64 imageBytes = numPixels * sizeof(u32);
+	u32* sourcePixels = AllocArray(mainHeap, u32, numPixels);
+	u32* workPixels = AllocArray(mainHeap, u32, numPixels);
+	u32* scalarPixels = AllocArray(mainHeap, u32, numPixels);
+	if (sourcePixels == nullptr || workPixels == nullptr || scalarPixels == nullptr)
+	{
+		PrintLine_E("Failed to allocate 3x %dx%d images", size, size);
+		if (sourcePixels != nullptr) { FreeMem(mainHeap, sourcePixels, imageBytes); }
+		if (workPixels != nullptr) { FreeMem(mainHeap, workPixels, imageBytes); }
+		if (scalarPixels != nullptr) { FreeMem(mainHeap, scalarPixels, imageBytes); }
+		return;
+	}
+	
+	//Sprite sheet-ish contents: every other 32x32 frame is fully transparent, the rest are noise
+	u32 randState = 0x12345678;
+	for (i32 yPos = 0; yPos < size; yPos++)
+	{
+		for (i32 xPos = 0; xPos < size; xPos++)
+		{
+			randState = (randState * 1664525) + 1013904223;
+			bool emptyFrame = ((((xPos / frameSize) + (yPos / frameSize)) % 2) == 1);
+			sourcePixels[((u64)yPos * (u64)size) + (u64)xPos] = (emptyFrame ? (randState & 0x00FFFFFF) : randState);
+		}
+	}
+	
+	PrintLine_N("Image kernels on a %dx%d image (%s):", size, size, FormatBytesNt(imageBytes, TempArena));
+	for (u64 pIndex = ImageKernelPath_Scalar; pIndex < ImageKernelPath_NumPaths; pIndex++)
+	{
+		ImageKernelPath_t path = (ImageKernelPath_t)pIndex;
+		if (!IsImageKernelPathSupported(path)) { PrintLine_W("  %s: not supported on this CPU", GetImageKernelPathStr(path)); continue; }
+		bool matchesScalar = true;
+		
+		//Slice into frames the same way CreateSpriteSheet does for texture arrays
+		PerfTime_t sliceStart = GetPerfTime();
+		u64 numFilledFrames = 0;
+		u64 frameIndex = 0;
+		for (i32 frameY = 0; frameY < size / frameSize; frameY++)
+		{
+			for (i32 frameX = 0; frameX < size / frameSize; frameX++)
+			{
+				bool filled = false;
+				u32* frameDest = &workPixels[frameIndex * (u64)(frameSize * frameSize)];
+				for (i32 yPos = 0; yPos < frameSize; yPos++)
+				{
+					const u32* sourceRow = &sourcePixels[((u64)(frameY*frameSize + yPos) * (u64)size) + (u64)(frameX*frameSize)];
+					if (ImageCopyRow(&frameDest[yPos * frameSize], sourceRow, (u64)frameSize, path)) { filled = true; }
+				}
+				if (filled) { numFilledFrames++; }
+				frameIndex++;
+			}
+		}
+		PerfTime_t sliceEnd = GetPerfTime();
+		r64 sliceTime = GetPerfTimeDiff(&sliceStart, &sliceEnd);
+		
+		PerfTime_t alphaStart = GetPerfTime();
+		u64 numRowsWithAlpha = 0;
+		for (i32 yPos = 0; yPos < size; yPos++)
+		{
+			if (ImageRowHasAlpha(&sourcePixels[(u64)yPos * (u64)size], (u64)size, path)) { numRowsWithAlpha++; }
+		}
+		PerfTime_t alphaEnd = GetPerfTime();
+		r64 alphaTime = GetPerfTimeDiff(&alphaStart, &alphaEnd);
+		
+		MyMemCopy(workPixels, sourcePixels, imageBytes);
+		PerfTime_t premultiplyStart = GetPerfTime();
+		ImagePremultiplyAlpha(workPixels, numPixels, path);
+		PerfTime_t premultiplyEnd = GetPerfTime();
+		r64 premultiplyTime = GetPerfTimeDiff(&premultiplyStart, &premultiplyEnd);
+		if (path == ImageKernelPath_Scalar) { MyMemCopy(scalarPixels, workPixels, imageBytes); }
+		else if (MyMemCompare(scalarPixels, workPixels, imageBytes) != 0) { matchesScalar = false; }
+		
+		PerfTime_t swizzleStart = GetPerfTime();
+		ImageSwizzleRedBlue(workPixels, sourcePixels, numPixels, path);
+		PerfTime_t swizzleEnd = GetPerfTime();
+		r64 swizzleTime = GetPerfTimeDiff(&swizzleStart, &swizzleEnd);
+		
+		//Full mip chain, each level written after the previous one in workPixels
+		PerfTime_t mipStart = GetPerfTime();
+		const u8* levelPixels = (const u8*)sourcePixels;
+		v2i levelSize = NewVec2i(size, size);
+		u8* nextPixels = (u8*)workPixels;
+		u64 numLevels = 0;
+		while (levelSize.width > 1 || levelSize.height > 1)
+		{
+			v2i nextSize = NewVec2i(MaxI32(levelSize.width/2, 1), MaxI32(levelSize.height/2, 1));
+			ImageDownsampleBox(levelPixels, levelSize, (u64)levelSize.width * sizeof(u32), nextPixels, nextSize, path);
+			levelPixels = nextPixels;
+			nextPixels += (u64)nextSize.width * (u64)nextSize.height * sizeof(u32);
+			levelSize = nextSize;
+			numLevels++;
+		}
+		PerfTime_t mipEnd = GetPerfTime();
+		r64 mipTime = GetPerfTimeDiff(&mipStart, &mipEnd);
+		u64 mipBytes = (u64)(nextPixels - (u8*)workPixels);
+		if (path == ImageKernelPath_Scalar) { MyMemCopy(scalarPixels, workPixels, mipBytes); }
+		else if (MyMemCompare(scalarPixels, workPixels, mipBytes) != 0) { matchesScalar = false; }
+		
+		PrintLine_I("  %-6s slice %.2lfms (%llu/%llu filled), alpha %.2lfms, premultiply %.2lfms, swizzle %.2lfms, %llu mips %.2lfms%s",
+			GetImageKernelPathStr(path),
+			sliceTime, numFilledFrames, frameIndex,
+			alphaTime, premultiplyTime, swizzleTime,
+			numLevels, mipTime,
+			matchesScalar ? "" : " MISMATCH"
+		);
+		UNUSED(numRowsWithAlpha);
+	}
+	
+	FreeMem(mainHeap, sourcePixels, imageBytes);
+	FreeMem(mainHeap, workPixels, imageBytes);
+	FreeMem(mainHeap, scalarPixels, imageBytes);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_ImageKernelBench_Glue) { EXP_GET_ARG_I32(0, size); Debug_ImageKernelBench(size); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                       sheet_trim_stats                       |
+// +--------------------------------------------------------------+
+#define Debug_SheetTrimStats_Def "void sheet_trim_stats()"
+#define Debug_SheetTrimStats_Desc "Lists the loaded sprite sheets that trim their frames with how much VRAM the packed texture saves over the full grid and how much of each frame's area still gets drawn"
+void Debug_SheetTrimStats()
+{
+	MemArena_t* scratch = GetScratchArena();
+	u64 numTrimmedSheets = 0;
+	u64 totalUntrimmedVram = 0;
+	u64 totalTrimmedVram = 0;
+	for (u64 sIndex = 0; sIndex < RESOURCES_NUM_SHEETS; sIndex++)
+	{
+		const SpriteSheet_t* sheet = &pig->resources.sheets->items[sIndex];
+		if (!sheet->isValid || !sheet->isTrimmed) { continue; }
+		u64 untrimmedVram = (u64)sheet->untrimmedTextureSize.width * (u64)sheet->untrimmedTextureSize.height * sizeof(u32);
+		u64 trimmedVram = (u64)sheet->texture.width * (u64)sheet->texture.height * sizeof(u32);
+		u64 frameArea = (u64)sheet->frameSize.width * (u64)sheet->frameSize.height;
+		u64 drawnArea = 0;
+		VarArrayLoop(&sheet->frames, fIndex)
+		{
+			VarArrayLoopGet(SpriteSheetFrame_t, frame, &sheet->frames, fIndex);
+			if (frame->filled) { drawnArea += (u64)frame->trimRec.width * (u64)frame->trimRec.height; }
+		}
+		PrintLine_I("  %s: %dx%d -> %dx%d (%s -> %s), %llu/%llu frame%s filled, drawing %.1lf%% of each frame's pixels",
+			GetResourceSheetName(sIndex),
+			sheet->untrimmedTextureSize.width, sheet->untrimmedTextureSize.height,
+			sheet->texture.width, sheet->texture.height,
+			FormatBytesNt(untrimmedVram, scratch), FormatBytesNt(trimmedVram, scratch),
+			sheet->numFilledFrames, sheet->frames.length, Plural(sheet->frames.length, "s"),
+			(sheet->numFilledFrames > 0) ? ((r64)drawnArea * 100.0 / (r64)(frameArea * sheet->numFilledFrames)) : 0.0
+		);
+		numTrimmedSheets++;
+		totalUntrimmedVram += untrimmedVram;
+		totalTrimmedVram += trimmedVram;
+	}
+	if (numTrimmedSheets == 0) { PrintLine_W("No trimmed sprite sheets are loaded"); FreeScratchArena(scratch); return; }
+	PrintLine_I("%llu trimmed sheet%s using %s instead of %s", numTrimmedSheets, Plural(numTrimmedSheets, "s"), FormatBytesNt(totalTrimmedVram, scratch), FormatBytesNt(totalUntrimmedVram, scratch));
+	FreeScratchArena(scratch);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_SheetTrimStats_Glue) { Debug_SheetTrimStats(); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                        settings_bench                        |
+// +--------------------------------------------------------------+
+#define SETTINGS_BENCH_NUM_KEYS 64
+#define Debug_SettingsBench_Def "void settings_bench(i32 num_reads)"
+#define Debug_SettingsBench_Desc "Fills a PigSettings_t with 64 mixed type settings and does num_reads (1M if 0) random PigGetSetting reads through a linear search + parse every time (the old path) and through the hashed index and parse cache"
+//This is how PigGetSetting* worked before the key index and the parse cache
+r64 Debug_SettingsBenchLinearRead(const PigSettings_t* settings, MyStr_t key, u64 typeIndex)
+{
+	VarArrayLoop(&settings->entries, sIndex)
+	{
+		VarArrayLoopGet(PigSettingsEntry_t, setting, &settings->entries, sIndex);
+		if (!StrEqualsIgnoreCase(setting->key, key)) { continue; }
+		switch (typeIndex)
+		{
+			case 0: { bool value = false; TryParseBool(setting->value, &value); return (value ? 1.0 : 0.0); }
+			case 1: { r32 value = 0.0f; TryParseR32(setting->value, &value); return (r64)value; }
+			case 2: { u64 value = 0; TryParseU64(setting->value, &value); return (r64)value; }
+			case 3: { v2 value = Vec2_Zero; TryParseV2(setting->value, &value); return (r64)(value.x + value.y); }
+			case 4: { v3 value = Vec3_Zero; TryParseV3(setting->value, &value); return (r64)(value.x + value.y + value.z); }
+			default: { v2i value = Vec2i_Zero; TryParseV2i(setting->value, &value); return (r64)(value.x + value.y); }
+		}
+	}
+	return 0.0;
+}
+r64 Debug_SettingsBenchIndexedRead(const PigSettings_t* settings, MyStr_t key, u64 typeIndex)
+{
+	switch (typeIndex)
+	{
+		case 0: { return (PigGetSettingBool(settings, key, false) ? 1.0 : 0.0); }
+		case 1: { return (r64)PigGetSettingR32(settings, key, 0.0f); }
+		case 2: { return (r64)PigGetSettingU64(settings, key, 0); }
+		case 3: { v2 value = PigGetSettingV2(settings, key, Vec2_Zero); return (r64)(value.x + value.y); }
+		case 4: { v3 value = PigGetSettingV3(settings, key, Vec3_Zero); return (r64)(value.x + value.y + value.z); }
+		default: { v2i value = PigGetSettingV2i(settings, key, Vec2i_Zero); return (r64)(value.x + value.y); }
+	}
+}
+void Debug_SettingsBench(i32 numReads)
+{
+	u64 numReadsU64 = (numReads > 0) ? (u64)numReads : 1000000;
+	MemArena_t* scratch = GetScratchArena();
+	PigSettings_t settings;
+	PigInitSettings(&settings, mainHeap, SETTINGS_BENCH_NUM_KEYS);
+	MyStr_t keys[SETTINGS_BENCH_NUM_KEYS];
+	MyStr_t lookupKeys[SETTINGS_BENCH_NUM_KEYS]; //every other key is looked up in uppercase to exercise ignoreCase
+	for (u64 kIndex = 0; kIndex < SETTINGS_BENCH_NUM_KEYS; kIndex++)
+	{
+		keys[kIndex] = PrintInArenaStr(scratch, "BenchSetting%02llu", kIndex);
+		lookupKeys[kIndex] = AllocString(scratch, &keys[kIndex]);
+		if ((kIndex % 2) != 0)
+		{
+			for (u64 cIndex = 0; cIndex < lookupKeys[kIndex].length; cIndex++)
+			{
+				char c = lookupKeys[kIndex].pntr[cIndex];
+				if (c >= 'a' && c <= 'z') { lookupKeys[kIndex].pntr[cIndex] = (char)(c - 'a' + 'A'); }
+			}
+		}
+		switch (kIndex % 6)
+		{
+			case 0: PigSetSettingBool(&settings, keys[kIndex], ((kIndex % 4) == 0), true, scratch); break;
+			case 1: PigSetSettingR32(&settings, keys[kIndex], (r32)kIndex * 0.25f, true, scratch); break;
+			case 2: PigSetSettingU64(&settings, keys[kIndex], kIndex * 1000, true, scratch); break;
+			case 3: PigSetSettingV2(&settings, keys[kIndex], NewVec2((r32)kIndex, 2.5f), true, scratch); break;
+			case 4: PigSetSettingV3(&settings, keys[kIndex], NewVec3((r32)kIndex, 1.5f, -3.0f), true, scratch); break;
+			default: PigSetSettingV2i(&settings, keys[kIndex], NewVec2i((i32)kIndex, -7), true, scratch); break;
+		}
+	}
+	
+	//Same pseudo-random sequence of keys for both runs
+	u32 linearSeed = 0x12345678;
+	r64 linearChecksum = 0.0;
+	PerfTime_t linearStartTime = GetPerfTime();
+	for (u64 rIndex = 0; rIndex < numReadsU64; rIndex++)
+	{
+		linearSeed = (linearSeed * 1664525) + 1013904223;
+		u64 kIndex = (u64)(linearSeed >> 8) % SETTINGS_BENCH_NUM_KEYS;
+		linearChecksum += Debug_SettingsBenchLinearRead(&settings, lookupKeys[kIndex], kIndex % 6);
+	}
+	PerfTime_t linearEndTime = GetPerfTime();
+	
+	u32 indexedSeed = 0x12345678;
+	r64 indexedChecksum = 0.0;
+	PerfTime_t indexedStartTime = GetPerfTime();
+	for (u64 rIndex = 0; rIndex < numReadsU64; rIndex++)
+	{
+		indexedSeed = (indexedSeed * 1664525) + 1013904223;
+		u64 kIndex = (u64)(indexedSeed >> 8) % SETTINGS_BENCH_NUM_KEYS;
+		indexedChecksum += Debug_SettingsBenchIndexedRead(&settings, lookupKeys[kIndex], kIndex % 6);
+	}
+	PerfTime_t indexedEndTime = GetPerfTime();
+	
+	r64 linearTime = GetPerfTimeDiff(&linearStartTime, &linearEndTime);
+	r64 indexedTime = GetPerfTimeDiff(&indexedStartTime, &indexedEndTime);
+	PrintLine_N("%llu mixed reads over %d settings:", numReadsU64, SETTINGS_BENCH_NUM_KEYS);
+	PrintLine_I("  Linear search + parse: %.2lfms (%.1lfns/read)", linearTime, linearTime * 1000000.0 / (r64)numReadsU64);
+	PrintLine_I("  Index + parse cache:   %.2lfms (%.1lfns/read) %.1lfx faster", indexedTime, indexedTime * 1000000.0 / (r64)numReadsU64, (indexedTime > 0) ? (linearTime / indexedTime) : 0.0);
+	if (linearChecksum != indexedChecksum) { PrintLine_E("  Results did not match! %lf vs %lf", linearChecksum, indexedChecksum); }
+	
+	PigFreeSettings(&settings);
+	FreeScratchArena(scratch);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_SettingsBench_Glue) { EXP_GET_ARG_I32(0, numReads); Debug_SettingsBench(numReads); return NewExpValueVoid(); }
+
+#define Debug_PartsBench_Def "void parts_bench(string path, i32 num_lookups)"
+#define Debug_PartsBench_Desc "Loads the .parts file at path from text and from its cooked form and times both, then does num_lookups (1M if 0) random prefab lookups by name (linear search), by name (hashed index) and by PartsPrefabId_t"
+void Debug_PartsBench(MyStr_t path, i32 numLookups)
+{
+	u64 numLookupsU64 = (numLookups > 0) ? (u64)numLookups : 1000000;
+	MemArena_t* scratch = GetScratchArena();
+	PlatMappedFile_t sourceFile = {};
+	if (!plat->MapFile(path, &sourceFile))
+	{
+		PrintLine_E("Couldn't open \"%.*s\"", StrPrint(path));
+		FreeScratchArena(scratch);
+		return;
+	}
+	
+	ProcessLog_t parseLog = {};
+	CreateProcessLog(&parseLog, Kilobytes(8), mainHeap, mainHeap);
+	PartsPrefabCollection_t textCollection = {};
+	PerfTime_t textStartTime = GetPerfTime();
+	bool parsedText = TryDeserPartsPrefabCollection(NewStr(sourceFile.size, (char*)sourceFile.data), mainHeap, &parseLog, &textCollection);
+	PerfTime_t textEndTime = GetPerfTime();
+	if (parseLog.hadWarnings || parseLog.hadErrors) { DumpProcessLog(&parseLog, "Parts Parse Log"); }
+	FreeProcessLog(&parseLog);
+	if (!parsedText || textCollection.prefabs.length == 0)
+	{
+		PrintLine_E("Failed to parse any prefabs from \"%.*s\"", StrPrint(path));
+		if (parsedText) { FreePartsPrefabCollection(&textCollection); }
+		plat->UnmapFile(&sourceFile);
+		FreeScratchArena(scratch);
+		return;
+	}
+	
+	u64 cookedSize = 0;
+	u8* cookedData = SerializeCookedPartsPrefabCollection(&textCollection, sourceFile.size, 0, scratch, &cookedSize);
+	PartsPrefabCollection_t cookedCollection = {};
+	PerfTime_t cookedStartTime = GetPerfTime();
+	bool loadedCooked = (cookedData != nullptr && DeserializeCookedPartsPrefabCollection(cookedData, cookedSize, mainHeap, &cookedCollection));
+	PerfTime_t cookedEndTime = GetPerfTime();
+	
+	r64 textTime = GetPerfTimeDiff(&textStartTime, &textEndTime);
+	r64 cookedTime = GetPerfTimeDiff(&cookedStartTime, &cookedEndTime);
+	PrintLine_N("%llu prefab%s from %s text file:", textCollection.prefabs.length, Plural(textCollection.prefabs.length, "s"), FormatBytesNt(sourceFile.size, scratch));
+	PrintLine_I("  Parse text:   %.3lfms", textTime);
+	if (loadedCooked) { PrintLine_I("  Load cooked:  %.3lfms (%s) %.1lfx faster", cookedTime, FormatBytesNt(cookedSize, scratch), (cookedTime > 0) ? (textTime / cookedTime) : 0.0); }
+	else { PrintLine_E("  Failed to load the cooked collection back!"); }
+	
+	u64 numPrefabs = textCollection.prefabs.length;
+	PartsPrefabId_t* prefabIds = AllocArray(scratch, PartsPrefabId_t, numPrefabs);
+	NotNull(prefabIds);
+	VarArrayLoop(&textCollection.prefabs, pIndex)
+	{
+		VarArrayLoopGet(PartsPrefab_t, prefab, &textCollection.prefabs, pIndex);
+		prefabIds[pIndex] = GetPartsPrefabId(&textCollection, prefab->name);
+	}
+	
+	//Same pseudo-random sequence of prefabs for all three runs
+	u32 linearSeed = 0x12345678;
+	u64 linearChecksum = 0;
+	PerfTime_t linearStartTime = GetPerfTime();
+	for (u64 lIndex = 0; lIndex < numLookupsU64; lIndex++)
+	{
+		linearSeed = (linearSeed * 1664525) + 1013904223;
+		const PartsPrefab_t* wantedPrefab = VarArrayGet(&textCollection.prefabs, (u64)(linearSeed >> 8) % numPrefabs, PartsPrefab_t);
+		VarArrayLoop(&textCollection.prefabs, pIndex)
+		{
+			VarArrayLoopGet(PartsPrefab_t, prefab, &textCollection.prefabs, pIndex);
+			if (StrEqualsIgnoreCase(prefab->name, wantedPrefab->name)) { linearChecksum += prefab->id; break; }
+		}
+	}
+	PerfTime_t linearEndTime = GetPerfTime();
+	
+	u32 namedSeed = 0x12345678;
+	u64 namedChecksum = 0;
+	PerfTime_t namedStartTime = GetPerfTime();
+	for (u64 lIndex = 0; lIndex < numLookupsU64; lIndex++)
+	{
+		namedSeed = (namedSeed * 1664525) + 1013904223;
+		const PartsPrefab_t* wantedPrefab = VarArrayGet(&textCollection.prefabs, (u64)(namedSeed >> 8) % numPrefabs, PartsPrefab_t);
+		const PartsPrefab_t* prefab = FindPartsPrefab(&textCollection, wantedPrefab->name);
+		if (prefab != nullptr) { namedChecksum += prefab->id; }
+	}
+	PerfTime_t namedEndTime = GetPerfTime();
+	
+	u32 idSeed = 0x12345678;
+	u64 idChecksum = 0;
+	PerfTime_t idStartTime = GetPerfTime();
+	for (u64 lIndex = 0; lIndex < numLookupsU64; lIndex++)
+	{
+		idSeed = (idSeed * 1664525) + 1013904223;
+		const PartsPrefab_t* prefab = GetPartsPrefabById(&textCollection, prefabIds[(u64)(idSeed >> 8) % numPrefabs]);
+		if (prefab != nullptr) { idChecksum += prefab->id; }
+	}
+	PerfTime_t idEndTime = GetPerfTime();
+	
+	r64 linearTime = GetPerfTimeDiff(&linearStartTime, &linearEndTime);
+	r64 namedTime = GetPerfTimeDiff(&namedStartTime, &namedEndTime);
+	r64 idTime = GetPerfTimeDiff(&idStartTime, &idEndTime);
+	PrintLine_N("%llu random lookups:", numLookupsU64);
+	PrintLine_I("  Linear name search: %.2lfms (%.1lfns/lookup)", linearTime, linearTime * 1000000.0 / (r64)numLookupsU64);
+	PrintLine_I("  Hashed name lookup: %.2lfms (%.1lfns/lookup)", namedTime, namedTime * 1000000.0 / (r64)numLookupsU64);
+	PrintLine_I("  PartsPrefabId_t:    %.2lfms (%.1lfns/lookup)", idTime, idTime * 1000000.0 / (r64)numLookupsU64);
+	if (linearChecksum != namedChecksum || linearChecksum != idChecksum) { PrintLine_E("  Results did not match! %llu vs %llu vs %llu", linearChecksum, namedChecksum, idChecksum); }
+	
+	if (loadedCooked) { FreePartsPrefabCollection(&cookedCollection); }
+	FreePartsPrefabCollection(&textCollection);
+	plat->UnmapFile(&sourceFile);
+	FreeScratchArena(scratch);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_PartsBench_Glue) { EXP_GET_ARG_STR(0, path); EXP_GET_ARG_I32(1, numLookups); Debug_PartsBench(path, numLookups); return NewExpValueVoid(); }
+
+#define Debug_TempArenaBench_Def "void temp_arena_bench(i32 num_calls)"
+#define Debug_TempArenaBench_Desc "Times num_calls (10M if 0) temp arena lookups through the old thread id compare/thread pool search, through the thread local binding, and a TempPushMark + alloc + TempPopMark round trip"
+void Debug_TempArenaBench(i32 numCalls)
+{
+	u64 numCallsU64 = (numCalls > 0) ? (u64)numCalls : 10000000;
+	u64 mainChecksum = 0;
+	u64 workerChecksum = 0;
+	u64 boundChecksum = 0;
+	u64 allocChecksum = 0;
+	
+	//What every call on the main thread used to do
+	PerfTime_t mainStartTime = GetPerfTime();
+	for (u64 cIndex = 0; cIndex < numCallsU64; cIndex++)
+	{
+		bool isDefinitive = false;
+		mainChecksum += (u64)Pig_LookupTempArena(&isDefinitive);
+	}
+	PerfTime_t mainEndTime = GetPerfTime();
+	
+	//What every call on a worker thread used to do. The main thread isn't in the pool so this walks all of it (a worker stopped at its own slot)
+	PerfTime_t workerStartTime = GetPerfTime();
+	for (u64 cIndex = 0; cIndex < numCallsU64; cIndex++)
+	{
+		workerChecksum += (u64)plat->GetThreadContext(plat->GetThisThreadId());
+	}
+	PerfTime_t workerEndTime = GetPerfTime();
+	
+	PerfTime_t boundStartTime = GetPerfTime();
+	for (u64 cIndex = 0; cIndex < numCallsU64; cIndex++)
+	{
+		boundChecksum += (u64)GetTempArena();
+	}
+	PerfTime_t boundEndTime = GetPerfTime();
+	
+	PerfTime_t allocStartTime = GetPerfTime();
+	for (u64 cIndex = 0; cIndex < numCallsU64; cIndex++)
+	{
+		TempPushMark();
+		u8* bytes = AllocArray(TempArena, u8, 16);
+		allocChecksum += (bytes != nullptr) ? 1 : 0;
+		TempPopMark();
+	}
+	PerfTime_t allocEndTime = GetPerfTime();
+	
+	r64 mainTime = GetPerfTimeDiff(&mainStartTime, &mainEndTime);
+	r64 workerTime = GetPerfTimeDiff(&workerStartTime, &workerEndTime);
+	r64 boundTime = GetPerfTimeDiff(&boundStartTime, &boundEndTime);
+	r64 allocTime = GetPerfTimeDiff(&allocStartTime, &allocEndTime);
+	PrintLine_N("%llu calls:", numCallsU64);
+	PrintLine_I("  Old main thread lookup:   %.2lfms (%.2lfns/call)", mainTime, mainTime * 1000000.0 / (r64)numCallsU64);
+	PrintLine_I("  Old worker thread lookup: %.2lfms (%.2lfns/call)", workerTime, workerTime * 1000000.0 / (r64)numCallsU64);
+	PrintLine_I("  Thread local binding:     %.2lfms (%.2lfns/call)", boundTime, boundTime * 1000000.0 / (r64)numCallsU64);
+	PrintLine_I("  Push + alloc + pop:       %.2lfms (%.2lfns/call)", allocTime, allocTime * 1000000.0 / (r64)numCallsU64);
+	if (mainChecksum != boundChecksum || allocChecksum != numCallsU64) { PrintLine_E("  Results did not match! 0x%016llX vs 0x%016llX (%llu)", mainChecksum, boundChecksum, workerChecksum); }
+}
+EXPRESSION_FUNC_DEFINITION(Debug_TempArenaBench_Glue) { EXP_GET_ARG_I32(0, numCalls); Debug_TempArenaBench(numCalls); return NewExpValueVoid(); }
+
+#define Debug_DebugExpBench_Def "void debug_exp_bench(i32 num_exprs, i32 num_frames)"
+#define Debug_DebugExpBench_Desc "Evaluates num_exprs (1000 if 0) distinct variable/arithmetic expressions every frame for num_frames (10 if 0) frames through a freshly built context (the old path, on a subset), through the cached context, and through compiled programs"
+void Debug_DebugExpBench(i32 numExprs, i32 numFrames)
+{
+	u64 numExprsU64 = (numExprs > 0) ? (u64)numExprs : 1000;
+	u64 numFramesU64 = (numFrames > 0) ? (u64)numFrames : 10;
+	u64 numOldPathExprs = (numExprsU64 < 50) ? numExprsU64 : 50;
+	PigDebugExpCache_t* cache = &pig->debugExp;
+	MemArena_t* scratch = GetScratchArena();
+	ExpContext_t* context = GetDebugExpContext(cache, scratch);
+	
+	MyStr_t* sources = AllocArray(scratch, MyStr_t, numExprsU64);
+	NotNull(sources);
+	for (u64 eIndex = 0; eIndex < numExprsU64; eIndex++)
+	{
+		switch (eIndex % 4)
+		{
+			case 0: sources[eIndex] = PrintInArenaStr(scratch, "mouse_x * 2 + %llu", eIndex); break;
+			case 1: sources[eIndex] = PrintInArenaStr(scratch, "(elapsed_ms > %llu.5) && !show_monitors", eIndex % 100); break;
+			case 2: sources[eIndex] = PrintInArenaStr(scratch, "program_time %% %llu", eIndex + 1); break;
+			default: sources[eIndex] = PrintInArenaStr(scratch, "screen_width / (screen_height + %llu) - time_scale", eIndex); break;
+		}
+	}
+	
+	//Compiled into our own programs rather than the cache so we don't evict whatever the console has cached
+	PerfTime_t compileStartTime = GetPerfTime();
+	DebugExpProgram_t* programs = AllocArray(scratch, DebugExpProgram_t, numExprsU64);
+	NotNull(programs);
+	u64 numFallbackPrograms = 0;
+	for (u64 eIndex = 0; eIndex < numExprsU64; eIndex++)
+	{
+		CompileDebugExp(cache, sources[eIndex], scratch, &programs[eIndex]);
+		if (programs[eIndex].isFallback) { numFallbackPrograms++; }
+	}
+	PerfTime_t compileEndTime = GetPerfTime();
+	
+	u64 numOldErrors = 0;
+	PerfTime_t oldStartTime = GetPerfTime();
+	for (u64 eIndex = 0; eIndex < numOldPathExprs; eIndex++)
+	{
+		PushMemMark(scratch);
+		ExpContext_t freshContext = {};
+		InitDebugConsoleExpContext(scratch, false, &freshContext);
+		ExpValue_t result = {};
+		if (!IsEmptyStr(TryRunExpressionErrorStr(sources[eIndex], scratch, &result, &freshContext))) { numOldErrors++; }
+		PopMemMark(scratch);
+	}
+	PerfTime_t oldEndTime = GetPerfTime();
+	
+	u64 numCachedErrors = 0;
+	PerfTime_t cachedStartTime = GetPerfTime();
+	for (u64 fIndex = 0; fIndex < numFramesU64; fIndex++)
+	{
+		for (u64 eIndex = 0; eIndex < numExprsU64; eIndex++)
+		{
+			PushMemMark(scratch);
+			ExpValue_t result = {};
+			if (!IsEmptyStr(TryRunExpressionErrorStr(sources[eIndex], scratch, &result, context))) { numCachedErrors++; }
+			PopMemMark(scratch);
+		}
+	}
+	PerfTime_t cachedEndTime = GetPerfTime();
+	
+	u64 numVmErrors = 0;
+	u64 numTrueResults = 0;
+	PerfTime_t vmStartTime = GetPerfTime();
+	for (u64 fIndex = 0; fIndex < numFramesU64; fIndex++)
+	{
+		for (u64 eIndex = 0; eIndex < numExprsU64; eIndex++)
+		{
+			if (programs[eIndex].isFallback) { continue; }
+			DebugExpValue_t result = {};
+			if (!RunDebugExpProgram(cache, &programs[eIndex], &result)) { numVmErrors++; }
+			else if (DebugExpValueIsTruthy(result)) { numTrueResults++; }
+		}
+	}
+	PerfTime_t vmEndTime = GetPerfTime();
+	
+	//RunDebugExp pays for this once per call on top of the compiled program
+	u64 numVerifyCalls = (numOldPathExprs > 0) ? numOldPathExprs : 1;
+	PerfTime_t verifyStartTime = GetPerfTime();
+	for (u64 vIndex = 0; vIndex < numVerifyCalls; vIndex++) { VerifyDebugExpVarSlots(cache, scratch); }
+	PerfTime_t verifyEndTime = GetPerfTime();
+	
+	r64 compileTime = GetPerfTimeDiff(&compileStartTime, &compileEndTime);
+	r64 oldTime = GetPerfTimeDiff(&oldStartTime, &oldEndTime);
+	r64 cachedTime = GetPerfTimeDiff(&cachedStartTime, &cachedEndTime);
+	r64 vmTime = GetPerfTimeDiff(&vmStartTime, &vmEndTime);
+	r64 verifyTime = GetPerfTimeDiff(&verifyStartTime, &verifyEndTime);
+	u64 numEvals = numExprsU64 * numFramesU64;
+	PrintLine_N("%llu expression%s x %llu frame%s (%llu variable slot%s):", numExprsU64, Plural(numExprsU64, "s"), numFramesU64, Plural(numFramesU64, "s"), cache->varSlots.length, Plural(cache->varSlots.length, "s"));
+	PrintLine_I("  Compile:                 %.2lfms (%.2lfus/expression, %llu fell back)", compileTime, compileTime * 1000.0 / (r64)numExprsU64, numFallbackPrograms);
+	PrintLine_I("  Fresh context per eval:  %.2lfus/eval (%llu sampled, ~%.2lfms/frame projected)", oldTime * 1000.0 / (r64)numOldPathExprs, numOldPathExprs, oldTime / (r64)numOldPathExprs * (r64)numExprsU64);
+	PrintLine_I("  Cached context:          %.2lfus/eval (%.2lfms/frame)", cachedTime * 1000.0 / (r64)numEvals, cachedTime / (r64)numFramesU64);
+	PrintLine_I("  Compiled:                %.2lfns/eval (%.3lfms/frame)", vmTime * 1000000.0 / (r64)numEvals, vmTime / (r64)numFramesU64);
+	PrintLine_I("  Var slot check:          %.2lfus/call (once per RunDebugExp, %llu stale invalidation%s so far)", verifyTime * 1000.0 / (r64)numVerifyCalls, cache->numStaleSlotInvalidations, Plural(cache->numStaleSlotInvalidations, "s"));
+	if (numOldErrors > 0 || numCachedErrors > 0 || numVmErrors > 0) { PrintLine_E("  %llu/%llu/%llu evaluations failed!", numOldErrors, numCachedErrors, numVmErrors); }
+	PrintLine_D("  (%llu compiled evaluation%s were true)", numTrueResults, Plural(numTrueResults, "s"));
+	
+	FreeScratchArena(scratch);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_DebugExpBench_Glue) { EXP_GET_ARG_I32(0, numExprs); EXP_GET_ARG_I32(1, numFrames); Debug_DebugExpBench(numExprs, numFrames); return NewExpValueVoid(); }
+
+#if JSON_SUPPORTED
+#define Debug_JsonBench_Def "void json_bench(string ldtk_path, i32 num_levels)"
+#define Debug_JsonBench_Desc "Reads the levels and layers out of an LDtk project (or a generated one with num_levels levels, 200 if 0, when ldtk_path is empty) with yajl + path strings, yajl + compiled JsonPath_t, and the single pass JsonReader_t, and prints the time taken by each"
+struct JsonBenchResults_t
+{
+	u64 numLevels;
+	u64 numLayers;
+	u64 numTiles;
+	i64 levelValueSum;
+	u64 identifierLengthSum;
+};
+bool JsonBenchResultsMatch(const JsonBenchResults_t* left, const JsonBenchResults_t* right)
+{
+	return (left->numLevels == right->numLevels && left->numLayers == right->numLayers && left->numTiles == right->numTiles &&
+		left->levelValueSum == right->levelValueSum && left->identifierLengthSum == right->identifierLengthSum);
+}
+MyStr_t GenerateBenchLdtkJson(MemArena_t* memArena, u64 numLevels)
+{
+	const u64 levelGridWidth = 40;
+	const u64 levelGridHeight = 24;
+	StringBuilder_t builder;
+	NewStringBuilder(&builder, memArena, numLevels * levelGridWidth * levelGridHeight * 60);
+	StringBuilderAppend(&builder, "{\"__header__\":{\"fileType\":\"LDtk Project JSON\",\"app\":\"LDtk\"},\"jsonVersion\":\"1.5.3\",\"defaultGridSize\":16,\"worldLayout\":\"Free\",\"levels\":[");
+	for (u64 lIndex = 0; lIndex < numLevels; lIndex++)
+	{
+		if (lIndex > 0) { StringBuilderAppendChar(&builder, ','); }
+		StringBuilderAppendPrint(&builder, "{\"identifier\":\"Level_%llu\",\"iid\":\"a1b2c3d4-%08llx\",\"uid\":%llu,\"worldX\":%llu,\"worldY\":%llu,\"worldDepth\":0,\"pxWid\":%llu,\"pxHei\":%llu,\"__bgColor\":\"#40465B\",\"fieldInstances\":[],\"layerInstances\":[",
+			lIndex, lIndex, lIndex, (lIndex % 10) * levelGridWidth * 16, (lIndex / 10) * levelGridHeight * 16, levelGridWidth * 16, levelGridHeight * 16);
+		StringBuilderAppendPrint(&builder, "{\"__identifier\":\"Entities\",\"__type\":\"Entities\",\"__cWid\":%llu,\"__cHei\":%llu,\"__gridSize\":16,\"gridTiles\":[],\"entityInstances\":[{\"__identifier\":\"Player\",\"px\":[32,48],\"fieldInstances\":[{\"__identifier\":\"name\",\"__value\":\"Hero \\\"\\u00e9\\\"\"}]}]},", levelGridWidth, levelGridHeight);
+		StringBuilderAppendPrint(&builder, "{\"__identifier\":\"Tiles\",\"__type\":\"Tiles\",\"__cWid\":%llu,\"__cHei\":%llu,\"__gridSize\":16,\"entityInstances\":[],\"gridTiles\":[", levelGridWidth, levelGridHeight);
+		for (u64 tIndex = 0; tIndex < levelGridWidth * levelGridHeight; tIndex++)
+		{
+			u64 tileX = (tIndex % levelGridWidth) * 16;
+			u64 tileY = (tIndex / levelGridWidth) * 16;
+			if (tIndex > 0) { StringBuilderAppendChar(&builder, ','); }
+			StringBuilderAppendPrint(&builder, "{\"px\":[%llu,%llu],\"src\":[%llu,0],\"f\":0,\"t\":%llu,\"d\":[%llu],\"a\":1}", tileX, tileY, (tIndex % 8) * 16, tIndex % 8, tIndex);
+		}
+		StringBuilderAppend(&builder, "]}]}");
+	}
+	StringBuilderAppend(&builder, "]}");
+	return ToMyStr(&builder);
+}
+void Debug_JsonBench(MyStr_t ldtkPath, i32 numLevels)
+{
+	MemArena_t benchArena;
+	InitMemArena_PagedHeapFuncs(&benchArena, Megabytes(4), PlatAllocFunc, PlatFreeFunc);
+	PlatFileContents_t fileContents = {};
+	MyStr_t jsonStr = MyStr_Empty;
+	if (!IsEmptyStr(ldtkPath))
+	{
+		if (!plat->ReadFileContents(ldtkPath, nullptr, false, &fileContents)) { PrintLine_E("Failed to read \"%.*s\"", StrPrint(ldtkPath)); FreeMemArena(&benchArena); return; }
+		jsonStr = NewStr(fileContents.size, (char*)fileContents.data);
+	}
+	else
+	{
+		jsonStr = GenerateBenchLdtkJson(&benchArena, (numLevels > 0) ? (u64)numLevels : 200);
+	}
+	PrintLine_N("Reading %s of json:", FormatBytesNt(jsonStr.length, TempArena));
+	
+	// +==============================+
+	// |    yajl + Path Strings       |
+	// +==============================+
+	JsonBenchResults_t stringResults = {};
+	PerfTime_t stringParseStartTime = GetPerfTime();
+	ParsedJson_t parsedJson = {};
+	bool parsedSuccessfully = TryParseJson(&benchArena, jsonStr, 256, &parsedJson);
+	PerfTime_t stringParseEndTime = GetPerfTime();
+	if (!parsedSuccessfully)
+	{
+		PrintLine_E("yajl failed to parse: %s", parsedJson.errorBuffer);
+		FreeParsedJson(&parsedJson);
+		if (fileContents.data != nullptr) { plat->FreeFileContents(&fileContents); }
+		FreeMemArena(&benchArena);
+		return;
+	}
+	PerfTime_t stringWalkStartTime = GetPerfTime();
+	{
+		yajl_val levelsNode = nullptr;
+		if (TryFindJsonNodeByPathStr(&parsedJson, "levels", &levelsNode) && YAJL_IS_ARRAY(levelsNode))
+		{
+			stringResults.numLevels = GetJsonArrayLength(levelsNode);
+			for (u64 lIndex = 0; lIndex < stringResults.numLevels; lIndex++)
+			{
+				TempPushMark();
+				yajl_val levelNode = GetJsonArrayElement(levelsNode, lIndex);
+				stringResults.identifierLengthSum += TryGetJsonValueStr(levelNode, "identifier", MyStr_Empty).length;
+				stringResults.levelValueSum += TryGetJsonValueI64(levelNode, "worldX", 0) + TryGetJsonValueI64(levelNode, "worldY", 0);
+				stringResults.levelValueSum += TryGetJsonValueI64(levelNode, "pxWid", 0) + TryGetJsonValueI64(levelNode, "pxHei", 0);
+				yajl_val layersNode = nullptr;
+				if (TryFindJsonNodeByPathStr(levelNode, "layerInstances", &layersNode) && YAJL_IS_ARRAY(layersNode))
+				{
+					for (u64 layerIndex = 0; layerIndex < GetJsonArrayLength(layersNode); layerIndex++)
+					{
+						yajl_val layerNode = GetJsonArrayElement(layersNode, layerIndex);
+						stringResults.numLayers++;
+						stringResults.identifierLengthSum += TryGetJsonValueStr(layerNode, "__identifier", MyStr_Empty).length;
+						yajl_val tilesNode = nullptr;
+						if (TryFindJsonNodeByPathStr(layerNode, "gridTiles", &tilesNode) && YAJL_IS_ARRAY(tilesNode)) { stringResults.numTiles += GetJsonArrayLength(tilesNode); }
+					}
+				}
+				TempPopMark();
+			}
+		}
+	}
+	PerfTime_t stringWalkEndTime = GetPerfTime();
+	
+	// +==============================+
+	// |   yajl + Compiled Paths      |
+	// +==============================+
+	JsonBenchResults_t compiledResults = {};
+	PerfTime_t compiledWalkStartTime = GetPerfTime();
+	{
+		JsonPath_t levelsPath, identifierPath, worldXPath, worldYPath, pxWidPath, pxHeiPath, layersPath, layerIdentifierPath, gridTilesPath;
+		CompileJsonPath(&benchArena, "levels",         &levelsPath);
+		CompileJsonPath(&benchArena, "identifier",     &identifierPath);
+		CompileJsonPath(&benchArena, "worldX",         &worldXPath);
+		CompileJsonPath(&benchArena, "worldY",         &worldYPath);
+		CompileJsonPath(&benchArena, "pxWid",          &pxWidPath);
+		CompileJsonPath(&benchArena, "pxHei",          &pxHeiPath);
+		CompileJsonPath(&benchArena, "layerInstances", &layersPath);
+		CompileJsonPath(&benchArena, "__identifier",   &layerIdentifierPath);
+		CompileJsonPath(&benchArena, "gridTiles",      &gridTilesPath);
+		yajl_val levelsNode = nullptr;
+		if (TryFindJsonNode(&parsedJson, &levelsPath, &levelsNode) && YAJL_IS_ARRAY(levelsNode))
+		{
+			compiledResults.numLevels = GetJsonArrayLength(levelsNode);
+			for (u64 lIndex = 0; lIndex < compiledResults.numLevels; lIndex++)
+			{
+				yajl_val levelNode = GetJsonArrayElement(levelsNode, lIndex);
+				compiledResults.identifierLengthSum += TryGetJsonValueStr(levelNode, &identifierPath, MyStr_Empty).length;
+				compiledResults.levelValueSum += TryGetJsonValueI64(levelNode, &worldXPath, 0) + TryGetJsonValueI64(levelNode, &worldYPath, 0);
+				compiledResults.levelValueSum += TryGetJsonValueI64(levelNode, &pxWidPath, 0) + TryGetJsonValueI64(levelNode, &pxHeiPath, 0);
+				yajl_val layersNode = nullptr;
+				if (TryFindJsonNode(levelNode, &layersPath, &layersNode) && YAJL_IS_ARRAY(layersNode))
+				{
+					for (u64 layerIndex = 0; layerIndex < GetJsonArrayLength(layersNode); layerIndex++)
+					{
+						yajl_val layerNode = GetJsonArrayElement(layersNode, layerIndex);
+						compiledResults.numLayers++;
+						compiledResults.identifierLengthSum += TryGetJsonValueStr(layerNode, &layerIdentifierPath, MyStr_Empty).length;
+						yajl_val tilesNode = nullptr;
+						if (TryFindJsonNode(layerNode, &gridTilesPath, &tilesNode) && YAJL_IS_ARRAY(tilesNode)) { compiledResults.numTiles += GetJsonArrayLength(tilesNode); }
+					}
+				}
+			}
+		}
+	}
+	PerfTime_t compiledWalkEndTime = GetPerfTime();
+	FreeParsedJson(&parsedJson);
+	
+	// +==============================+
+	// |         JsonReader_t         |
+	// +==============================+
+	JsonBenchResults_t readerResults = {};
+	u64 readerHeapBefore = benchArena.used;
+	PerfTime_t readerStartTime = GetPerfTime();
+	bool readSuccessfully = false;
+	{
+		VarArray_t levelIdentifiers, worldXs, worldYs, pxWids, pxHeis, layerIdentifiers, tileCounts;
+		CreateVarArray(&levelIdentifiers, &benchArena, sizeof(MyStr_t));
+		CreateVarArray(&worldXs,          &benchArena, sizeof(i64));
+		CreateVarArray(&worldYs,          &benchArena, sizeof(i64));
+		CreateVarArray(&pxWids,           &benchArena, sizeof(i64));
+		CreateVarArray(&pxHeis,           &benchArena, sizeof(i64));
+		CreateVarArray(&layerIdentifiers, &benchArena, sizeof(MyStr_t));
+		CreateVarArray(&tileCounts,       &benchArena, sizeof(u64));
+		u64 numLevelsFound = 0;
+		JsonReader_t reader;
+		InitJsonReader(&reader, &benchArena);
+		JsonReaderBindCount(&reader,     "levels",                                  &numLevelsFound);
+		JsonReaderBindStrList(&reader,   "levels/*/identifier",                     &levelIdentifiers);
+		JsonReaderBindI64List(&reader,   "levels/*/worldX",                         &worldXs);
+		JsonReaderBindI64List(&reader,   "levels/*/worldY",                         &worldYs);
+		JsonReaderBindI64List(&reader,   "levels/*/pxWid",                          &pxWids);
+		JsonReaderBindI64List(&reader,   "levels/*/pxHei",                          &pxHeis);
+		JsonReaderBindStrList(&reader,   "levels/*/layerInstances/*/__identifier",  &layerIdentifiers);
+		JsonReaderBindCountList(&reader, "levels/*/layerInstances/*/gridTiles",     &tileCounts);
+		readSuccessfully = JsonReaderRun(&reader, jsonStr);
+		
+		readerResults.numLevels = numLevelsFound;
+		readerResults.numLayers = layerIdentifiers.length;
+		VarArrayLoop(&levelIdentifiers, iIndex) { VarArrayLoopGet(MyStr_t, identifier, &levelIdentifiers, iIndex); readerResults.identifierLengthSum += identifier->length; }
+		VarArrayLoop(&layerIdentifiers, iIndex) { VarArrayLoopGet(MyStr_t, identifier, &layerIdentifiers, iIndex); readerResults.identifierLengthSum += identifier->length; }
+		VarArrayLoop(&worldXs, vIndex) { readerResults.levelValueSum += *VarArrayGet(&worldXs, vIndex, i64); }
+		VarArrayLoop(&worldYs, vIndex) { readerResults.levelValueSum += *VarArrayGet(&worldYs, vIndex, i64); }
+		VarArrayLoop(&pxWids, vIndex) { readerResults.levelValueSum += *VarArrayGet(&pxWids, vIndex, i64); }
+		VarArrayLoop(&pxHeis, vIndex) { readerResults.levelValueSum += *VarArrayGet(&pxHeis, vIndex, i64); }
+		VarArrayLoop(&tileCounts, cIndex) { readerResults.numTiles += *VarArrayGet(&tileCounts, cIndex, u64); }
+		PrintLine_D("JsonReader_t read %llu values and skipped %llu", reader.numValuesRead, reader.numValuesSkipped);
+		FreeJsonReader(&reader);
+	}
+	PerfTime_t readerEndTime = GetPerfTime();
+	u64 readerHeapUsed = benchArena.used - readerHeapBefore;
+	
+	r64 stringParseTime = GetPerfTimeDiff(&stringParseStartTime, &stringParseEndTime);
+	r64 stringWalkTime = GetPerfTimeDiff(&stringWalkStartTime, &stringWalkEndTime);
+	r64 compiledWalkTime = GetPerfTimeDiff(&compiledWalkStartTime, &compiledWalkEndTime);
+	r64 readerTime = GetPerfTimeDiff(&readerStartTime, &readerEndTime);
+	PrintLine_N("  %llu level%s, %llu layer%s, %llu tile%s", stringResults.numLevels, Plural(stringResults.numLevels, "s"), stringResults.numLayers, Plural(stringResults.numLayers, "s"), stringResults.numTiles, Plural(stringResults.numTiles, "s"));
+	PrintLine_I("  yajl tree parse:             %.2lfms", stringParseTime);
+	PrintLine_I("  Walk with path strings:      %.2lfms (%.2lfms total)", stringWalkTime, stringParseTime + stringWalkTime);
+	PrintLine_I("  Walk with JsonPath_t:        %.2lfms (%.2lfms total)", compiledWalkTime, stringParseTime + compiledWalkTime);
+	PrintLine_I("  JsonReader_t single pass:    %.2lfms (%s allocated, including result lists)", readerTime, FormatBytesNt(readerHeapUsed, TempArena));
+	if (!readSuccessfully) { PrintLine_E("  JsonReader_t failed to read the json!"); }
+	if (!JsonBenchResultsMatch(&stringResults, &compiledResults) || !JsonBenchResultsMatch(&stringResults, &readerResults)) { PrintLine_E("  Results did not match!"); }
+	
+	if (fileContents.data != nullptr) { plat->FreeFileContents(&fileContents); }
+	FreeMemArena(&benchArena);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_JsonBench_Glue) { EXP_GET_ARG_STR(0, ldtkPath); EXP_GET_ARG_I32(1, numLevels); Debug_JsonBench(ldtkPath, numLevels); return NewExpValueVoid(); }
+#endif //JSON_SUPPORTED
+
+#if PIG_PROFILER
+// +--------------------------------------------------------------+
+// |                       profiler_capture                       |
+// +--------------------------------------------------------------+
+#define Debug_ProfilerCapture_Def "void profiler_capture(string file_path, i32 num_frames)"
+#define Debug_ProfilerCapture_Desc "Records every profiler zone from every thread for the next num_frames (60 if 0) frames and writes them to file_path (profile.json if empty) in the Chrome trace format (open in chrome://tracing or ui.perfetto.dev)"
+void Debug_ProfilerCapture(MyStr_t filePath, i32 numFrames)
+{
+	if (IsEmptyStr(filePath)) { filePath = NewStr("profile.json"); }
+	u64 numFramesU64 = (numFrames > 0) ? (u64)numFrames : 60;
+	if (pig->profiler.capturing) { PrintLine_E("A profiler capture to \"%.*s\" is already running (%llu frame%s left)", StrPrint(pig->profiler.captureFilePath), pig->profiler.captureFramesLeft, Plural(pig->profiler.captureFramesLeft, "s")); return; }
+	if (StartPigProfilerCapture(&pig->profiler, filePath, numFramesU64))
+	{
+		PrintLine_I("Capturing %llu frame%s to \"%.*s\"...", numFramesU64, Plural(numFramesU64, "s"), StrPrint(filePath));
+	}
+	else
+	{
+		WriteLine_E("Failed to start the profiler capture");
+	}
+}
+EXPRESSION_FUNC_DEFINITION(Debug_ProfilerCapture_Glue) { EXP_GET_ARG_STR(0, filePath); EXP_GET_ARG_I32(1, numFrames); Debug_ProfilerCapture(filePath, numFrames); return NewExpValueVoid(); }
+
+#define Debug_ProfilerBench_Def "void profiler_bench(i32 num_zones)"
+#define Debug_ProfilerBench_Desc "Records num_zones (1000000 if 0) empty profiler zones on the calling thread and prints the cost of recording them and of gathering them into the frame tree, compared to the same loop without zones (which is what builds with PIG_PROFILER 0 compile to)"
+void Debug_ProfilerBench(i32 numZones)
+{
+	u64 numZonesU64 = (numZones > 0) ? (u64)numZones : 1000000;
+	PigProfiler_t* profiler = &pig->profiler;
+	PigProfilerThread_t* thread = PigProfilerGetThisThread();
+	if (thread == nullptr) { WriteLine_E("This thread could not be registered with the profiler"); return; }
+	u64 threadIndex = (u64)(thread - &profiler->threads[0]);
+	//The ring buffer is drained between batches (like the frame boundary does) so nothing gets dropped
+	const u64 batchSize = PIG_PROFILER_RING_SIZE/4;
+	u64 numDroppedBefore = thread->numDropped;
+	
+	volatile u64 counter = 0;
+	PerfTime_t baselineStartTime = GetPerfTime();
+	for (u64 zIndex = 0; zIndex < numZonesU64; zIndex++)
+	{
+		counter = counter + 1;
+	}
+	PerfTime_t baselineEndTime = GetPerfTime();
+	
+	r64 recordTime = 0;
+	r64 drainTime = 0;
+	PigProfilerDrainThread(profiler, thread, threadIndex);
+	for (u64 batchStart = 0; batchStart < numZonesU64; batchStart += batchSize)
+	{
+		u64 batchEnd = (batchStart + batchSize < numZonesU64) ? (batchStart + batchSize) : numZonesU64;
+		PerfTime_t recordStartTime = GetPerfTime();
+		for (u64 zIndex = batchStart; zIndex < batchEnd; zIndex++)
+		{
+			PigProfileBegin("ProfilerBench");
+			counter = counter + 1;
+			PigProfileEnd();
+		}
+		PerfTime_t recordEndTime = GetPerfTime();
+		PigProfilerDrainThread(profiler, thread, threadIndex);
+		PerfTime_t drainEndTime = GetPerfTime();
+		recordTime += GetPerfTimeDiff(&recordStartTime, &recordEndTime);
+		drainTime += GetPerfTimeDiff(&recordEndTime, &drainEndTime);
+	}
+	
+	u64 numRecorded = 0;
+	VarArrayLoop(&profiler->buildingFrame.nodes, nIndex)
+	{
+		VarArrayLoopGet(PigProfilerNode_t, node, &profiler->buildingFrame.nodes, nIndex);
+		if (node->threadIndex == threadIndex && node->name != nullptr && StrEquals(NewStr(node->name), NewStr("ProfilerBench"))) { numRecorded += node->callCount; }
+	}
+	
+	r64 baselineTime = GetPerfTimeDiff(&baselineStartTime, &baselineEndTime);
+	PrintLine_N("%llu zone%s on %s:", numZonesU64, Plural(numZonesU64, "s"), &thread->name[0]);
+	PrintLine_I("  Without zones:       %.2lfms (%.2lfns/iteration)", baselineTime, baselineTime * 1000000.0 / (r64)numZonesU64);
+	PrintLine_I("  Recording:           %.2lfms (%.2lfns/zone over baseline)", recordTime, (recordTime - baselineTime) * 1000000.0 / (r64)numZonesU64);
+	PrintLine_I("  Gathering into tree: %.2lfms (%.2lfns/zone)", drainTime, drainTime * 1000000.0 / (r64)numZonesU64);
+	if (numRecorded != numZonesU64) { PrintLine_E("  Only %llu/%llu zones made it into the frame tree (%llu dropped)", numRecorded, numZonesU64, thread->numDropped - numDroppedBefore); }
+}
+EXPRESSION_FUNC_DEFINITION(Debug_ProfilerBench_Glue) { EXP_GET_ARG_I32(0, numZones); Debug_ProfilerBench(numZones); return NewExpValueVoid(); }
+#endif //PIG_PROFILER
+
+#if PIG_MEM_TRACKING
+// +--------------------------------------------------------------+
+// |                        mem_track_dump                        |
+// +--------------------------------------------------------------+
+#define Debug_MemTrackDump_Def "void mem_track_dump(string file_path)"
+#define Debug_MemTrackDump_Desc "Writes the allocation sites and the recent per-frame allocation history of every tracked arena to file_path (mem_track.txt if empty) as plain text that can be diffed against another dump"
+void Debug_MemTrackDump(MyStr_t filePath)
+{
+	if (IsEmptyStr(filePath)) { filePath = NewStr("mem_track.txt"); }
+	PigMemTrackerDump(&pig->memTracker, filePath);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_MemTrackDump_Glue) { EXP_GET_ARG_STR(0, filePath); Debug_MemTrackDump(filePath); return NewExpValueVoid(); }
+
+// +--------------------------------------------------------------+
+// |                      mem_expect_steady                       |
+// +--------------------------------------------------------------+
+#define Debug_MemExpectSteady_Def "void mem_expect_steady(i32 num_frames)"
+#define Debug_MemExpectSteady_Desc "Reports every allocation made in mainHeap during the next num_frames (60 if 0) frames as an error, then prints whether those frames were allocation free"
+void Debug_MemExpectSteady(i32 numFrames)
+{
+	u64 numFramesU64 = (numFrames > 0) ? (u64)numFrames : 60;
+	PigMemTrackerExpectNoAllocs(&pig->memTracker, &pig->mainHeap, numFramesU64);
+	PrintLine_I("Expecting no allocations in mainHeap for the next %llu frame%s", numFramesU64, Plural(numFramesU64, "s"));
+}
+EXPRESSION_FUNC_DEFINITION(Debug_MemExpectSteady_Glue) { EXP_GET_ARG_I32(0, numFrames); Debug_MemExpectSteady(numFrames); return NewExpValueVoid(); }
+
+#if !defined(GYLIB_MEM_ARENA_DEBUG_ENABLED)
+// +--------------------------------------------------------------+
+// |                       mem_track_bench                        |
+// +--------------------------------------------------------------+
+#define Debug_MemTrackBench_Def "void mem_track_bench(i32 num_allocs)"
+#define Debug_MemTrackBench_Desc "Makes and frees num_allocs (100000 if 0) small allocations in a scratch paged heap calling gylib directly (which is what builds with PIG_MEM_TRACKING 0 compile to), through the tracking wrappers while the arena isn't tracked, and while it is, and prints the cost of each"
+void Debug_MemTrackBench(i32 numAllocs)
+{
+	u64 numAllocsU64 = (numAllocs > 0) ? (u64)numAllocs : 100000;
+	const u64 allocSize = 48;
+	void** allocPntrs = (void**)PlatAllocFunc(sizeof(void*) * numAllocsU64);
+	NotNull(allocPntrs);
+	MemArena_t benchArena;
+	InitMemArena_PagedHeapFuncs(&benchArena, Megabytes(4), PlatAllocFunc, PlatFreeFunc);
+	r64 passTimes[3] = {};
+	
+	for (u64 pass = 0; pass < ArrayCount(passTimes); pass++)
+	{
+		if (pass == 2 && !PigMemTrackArena(&pig->memTracker, &benchArena, "benchArena")) { break; }
+		PerfTime_t startTime = GetPerfTime();
+		if (pass == 0)
+		{
+			for (u64 aIndex = 0; aIndex < numAllocsU64; aIndex++) { allocPntrs[aIndex] = (AllocMem)(&benchArena, allocSize); }
+			for (u64 aIndex = numAllocsU64; aIndex > 0; aIndex--) { (FreeMem)(&benchArena, allocPntrs[aIndex-1], allocSize); }
+		}
+		else
+		{
+			for (u64 aIndex = 0; aIndex < numAllocsU64; aIndex++) { allocPntrs[aIndex] = AllocMem(&benchArena, allocSize); }
+			for (u64 aIndex = numAllocsU64; aIndex > 0; aIndex--) { FreeMem(&benchArena, allocPntrs[aIndex-1], allocSize); }
+		}
+		PerfTime_t endTime = GetPerfTime();
+		passTimes[pass] = GetPerfTimeDiff(&startTime, &endTime);
+		if (pass == 2)
+		{
+			PigMemTrackedArena_t* tracked = PigMemTrackerFindArena(&pig->memTracker, &benchArena);
+			if (tracked->liveCount != 0 || tracked->numUntrackedFrees != 0) { PrintLine_E("  Tracking didn't balance: %llu live, %llu untracked frees", tracked->liveCount, tracked->numUntrackedFrees); }
+			PigMemUntrackArena(&pig->memTracker, &benchArena);
+		}
+	}
+	
+	PrintLine_N("%llu alloc/free pair%s of %llu bytes:", numAllocsU64, Plural(numAllocsU64, "s"), allocSize);
+	PrintLine_I("  gylib directly:      %.2lfms (%.2lfns/pair)", passTimes[0], passTimes[0] * 1000000.0 / (r64)numAllocsU64);
+	PrintLine_I("  Wrapper, untracked:  %.2lfms (%.2lfns/pair over direct)", passTimes[1], (passTimes[1] - passTimes[0]) * 1000000.0 / (r64)numAllocsU64);
+	PrintLine_I("  Wrapper, tracked:    %.2lfms (%.2lfns/pair over direct)", passTimes[2], (passTimes[2] - passTimes[0]) * 1000000.0 / (r64)numAllocsU64);
+	
+	FreeMemArena(&benchArena);
+	PlatFreeFunc(allocPntrs);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_MemTrackBench_Glue) { EXP_GET_ARG_I32(0, numAllocs); Debug_MemTrackBench(numAllocs); return NewExpValueVoid(); }
+#endif //!defined(GYLIB_MEM_ARENA_DEBUG_ENABLED)
+#endif //PIG_MEM_TRACKING
+
+#if DEVELOPER_BUILD
+// +--------------------------------------------------------------+
+// |                       file_watch_test                        |
+// +--------------------------------------------------------------+
+#define Debug_FileWatchTest_Def "void file_watch_test(u64 num_files)"
+#define Debug_FileWatchTest_Desc "Writes num_files files into a test folder, watches them, measures the file watching thread while idle, then touches every file and reports how long it took for each change to be delivered"
+void Debug_FileWatchTest(u64 numFiles)
+{
+	if (numFiles == 0) { WriteLine_E("num_files must be at least 1"); return; }
+	StartFileWatchTest(&pig->resources.fileWatchTest, numFiles);
+}
+EXPRESSION_FUNC_DEFINITION(Debug_FileWatchTest_Glue) { EXP_GET_ARG_U64(0, numFiles); Debug_FileWatchTest(numFiles); return NewExpValueVoid(); }
+#endif //DEVELOPER_BUILD
+
 // +--------------------------------------------------------------+
 // |                         open_window                          |
 // +--------------------------------------------------------------+
@@ -1563,7 +3611,7 @@ EXPRESSION_FUNC_DEFINITION(Debug_RunMemTestSet_Glue) { Debug_RunMemTestSet(); re
 // +--------------------------------------------------------------+
 EXPRESSION_VAR_GETTER(MyStr_t, CurrentAppState_Getter) { return NewStr(GetAppStateStr(GetCurrentAppState())); }
 
-void PigAddDebugVarsToExpContext(ExpContext_t* context)
+void PigAddDebugVarsToExpContext(ExpContext_t* context) //pre-declared in pig_func_defs.h
 {
 	const bool read = false;
 	const bool write = true;
@@ -1574,24 +3622,28 @@ void PigAddDebugVarsToExpContext(ExpContext_t* context)
 	AddExpConstantDef(context, "pig_version_build", NewExpValueU16(ENGINE_VERSION_BUILD));
 	
 	// Read-only variables
-	AddExpVariableDefU64(context,  read,  "program_time",        &ProgramTime,                          "Number of milliseconds since the start of the program");
-	AddExpVariableDefR64(context,  read,  "time_scale",          &TimeScale,                            "A floating pointer number that changes per frame to indicate the ratio between elapsed_ms and the target framerate elapsed ms");
-	AddExpVariableDefR64(context,  read,  "elapsed_ms",          &ElapsedMs,                            "The number of milliseconds elapsed since last frame (this can be manipulated using debug commands, and is capped to a max value so we don't time travel forward)");
-	AddExpVariableDefR64(context,  read,  "uncapped_elapsed_ms", &UncappedElapsedMs,                    "The number of milliseconds elapsed since last frame (not capped to a max value, still can be manipulated by debug commands)");
-	AddExpVariableDefU64(context,  read,  "local_timestamp",     &LocalTimestamp,                       "Number of seconds from Jan 1st 1980 as a U64 (offset by some number of hours to account for computer's timezone)");
-	AddExpVariableDefU64(context,  read,  "unix_timestamp",      &UnixTimestamp,                        "Number of seconds from Jan 1st 1980 as a U64");
-	AddExpVariableDefR32(context,  read,  "mouse_x",             &MousePos.x,                           "The x coordinate of the mouse (relative to the game window, 1px unit)");
-	AddExpVariableDefR32(context,  read,  "mouse_y",             &MousePos.y,                           "The y coordinate of the mouse (relative to the game window, 1px unit)");
-	AddExpVariableDefR32(context,  read,  "screen_width",        &ScreenSize.width,                     "The width in pixels of the window (the renderable portion of it at least)");
-	AddExpVariableDefR32(context,  read,  "screen_height",       &ScreenSize.height,                    "The height in pixels of the window (the renderable portion of it at least)");
-	AddExpVariableDefBool(context, read,  "fullscreen_enabled",  &pig->currentWindow->input.fullscreen, "Whether the game is currently in fullscreen mode or not"); //TODO: This is reporting the opposite value than I expect!
-	AddExpVariableDefStr(context,         "current_app_state",   CurrentAppState_Getter,                "Enables a debug render of a sphere of a particular radius around the player's position");
-	
-	AddExpVariableDefR64(context,  write, "fixed_time_scale",         &pigOut->fixedTimeScale,        "The current time scale multiplier (only applies if fixed_time_scale_enabled)");
-	AddExpVariableDefBool(context, write, "fixed_time_scale_enabled", &pigOut->fixedTimeScaleEnabled, "Whether the time scale value for the game is currently fixed by fixed_time_scale multiplier");
-	AddExpVariableDefBool(context, write, "dont_exit_on_assert",      &pig->dontExitOnAssert,         "Toggles whether assertions should force close the application when hit");
-	AddExpVariableDefBool(context, write, "show_monitors",            &pig->monitorsDebug,            "Toggles debug overlay for monitor info, resolutions, video modes, window position, etc.");
-	AddExpVariableDefBool(context, write, "show_cyclic_funcs",        &pig->cyclicFuncsDebug,         "Toggles rendering of the cyclic function debug overlay");
+	PigAddDebugVarU64(context,  read,  "program_time",        &ProgramTime,                          "Number of milliseconds since the start of the program");
+	PigAddDebugVarR64(context,  read,  "time_scale",          &TimeScale,                            "A floating pointer number that changes per frame to indicate the ratio between elapsed_ms and the target framerate elapsed ms");
+	PigAddDebugVarR64(context,  read,  "elapsed_ms",          &ElapsedMs,                            "The number of milliseconds elapsed since last frame (this can be manipulated using debug commands, and is capped to a max value so we don't time travel forward)");
+	PigAddDebugVarR64(context,  read,  "uncapped_elapsed_ms", &UncappedElapsedMs,                    "The number of milliseconds elapsed since last frame (not capped to a max value, still can be manipulated by debug commands)");
+	PigAddDebugVarU64(context,  read,  "local_timestamp",     &LocalTimestamp,                       "Number of seconds from Jan 1st 1980 as a U64 (offset by some number of hours to account for computer's timezone)");
+	PigAddDebugVarU64(context,  read,  "unix_timestamp",      &UnixTimestamp,                        "Number of seconds from Jan 1st 1980 as a U64");
+	PigAddDebugVarR32(context,  read,  "mouse_x",             &MousePos.x,                           "The x coordinate of the mouse (relative to the game window, 1px unit)");
+	PigAddDebugVarR32(context,  read,  "mouse_y",             &MousePos.y,                           "The y coordinate of the mouse (relative to the game window, 1px unit)");
+	PigAddDebugVarR32(context,  read,  "screen_width",        &ScreenSize.width,                     "The width in pixels of the window (the renderable portion of it at least)");
+	PigAddDebugVarR32(context,  read,  "screen_height",       &ScreenSize.height,                    "The height in pixels of the window (the renderable portion of it at least)");
+	PigAddDebugVarBool(context, read,  "fullscreen_enabled",  &pig->currentWindow->input.fullscreen, "Whether the game is currently in fullscreen mode or not"); //TODO: This is reporting the opposite value than I expect!
+	AddExpVariableDefStr(context,      "current_app_state",   CurrentAppState_Getter,                "Enables a debug render of a sphere of a particular radius around the player's position");
+	
+	PigAddDebugVarR64(context,  write, "fixed_time_scale",         &pigOut->fixedTimeScale,        "The current time scale multiplier (only applies if fixed_time_scale_enabled)");
+	PigAddDebugVarBool(context, write, "fixed_time_scale_enabled", &pigOut->fixedTimeScaleEnabled, "Whether the time scale value for the game is currently fixed by fixed_time_scale multiplier");
+	PigAddDebugVarBool(context, write, "dont_exit_on_assert",      &pig->dontExitOnAssert,         "Toggles whether assertions should force close the application when hit");
+	PigAddDebugVarBool(context, write, "show_monitors",            &pig->monitorsDebug,            "Toggles debug overlay for monitor info, resolutions, video modes, window position, etc.");
+	PigAddDebugVarBool(context, write, "show_cyclic_funcs",        &pig->cyclicFuncsDebug,         "Toggles rendering of the cyclic function debug overlay");
+	PigAddDebugVarBool(context, write, "text_layout_cache_enabled", &rc->textLayoutCache.enabled,  "Toggles whether RcDrawText and RcMeasureText use cached layouts instead of flowing the text every call");
+	#if PIG_PROFILER
+	PigAddDebugVarBool(context, write, "show_profiler",            &pig->profiler.showOverlay,     "Toggles the profiler overlay (the zone tree recorded during the last frame on every thread)");
+	#endif
 }
 
 void PigAddDebugCommandsToExpContext(ExpContext_t* context)
@@ -1633,6 +3685,53 @@ void PigAddDebugCommandsToExpContext(ExpContext_t* context)
 	#endif //STEAM_BUILD
 	AddDebugCommandDef(context, Debug_ListResourcePool_Def,    Debug_ListResourcePool_Glue,    Debug_ListResourcePool_Desc);
 	AddDebugCommandDef(context, Debug_TestScratch_Def,         Debug_TestScratch_Glue,         Debug_TestScratch_Desc);
+	AddDebugCommandDef(context, Debug_TextCache_Def,           Debug_TextCache_Glue,           Debug_TextCache_Desc);
+	AddDebugCommandDef(context, Debug_MapFileBench_Def,        Debug_MapFileBench_Glue,        Debug_MapFileBench_Desc);
+	AddDebugCommandDef(context, Debug_RenderStats_Def,         Debug_RenderStats_Glue,         Debug_RenderStats_Desc);
+	AddDebugCommandDef(context, Debug_RenderDump_Def,          Debug_RenderDump_Glue,          Debug_RenderDump_Desc);
+	AddDebugCommandDef(context, Debug_RenderBench_Def,         Debug_RenderBench_Glue,         Debug_RenderBench_Desc);
+	AddDebugCommandDef(context, Debug_RenderFilter_Def,        Debug_RenderFilter_Glue,        Debug_RenderFilter_Desc);
+	AddDebugCommandDef(context, Debug_AnimBench_Def,           Debug_AnimBench_Glue,           Debug_AnimBench_Desc);
+	AddDebugCommandDef(context, Debug_RenderModelOpts_Def,     Debug_RenderModelOpts_Glue,     Debug_RenderModelOpts_Desc);
+	AddDebugCommandDef(context, Debug_ModelCullBench_Def,      Debug_ModelCullBench_Glue,      Debug_ModelCullBench_Desc);
+	#if SLUG_SUPPORTED
+	AddDebugCommandDef(context, Debug_SlugTextBench_Def,       Debug_SlugTextBench_Glue,       Debug_SlugTextBench_Desc);
+	#endif //SLUG_SUPPORTED
+	#if PIG_ASSET_PACK
+	AddDebugCommandDef(context, Debug_AssetPackInfo_Def,       Debug_AssetPackInfo_Glue,       Debug_AssetPackInfo_Desc);
+	AddDebugCommandDef(context, Debug_AssetPackEnable_Def,     Debug_AssetPackEnable_Glue,     Debug_AssetPackEnable_Desc);
+	AddDebugCommandDef(context, Debug_AssetPackBuild_Def,      Debug_AssetPackBuild_Glue,      Debug_AssetPackBuild_Desc);
+	AddDebugCommandDef(context, Debug_AssetPackBench_Def,      Debug_AssetPackBench_Glue,      Debug_AssetPackBench_Desc);
+	#endif //PIG_ASSET_PACK
+	AddDebugCommandDef(context, Debug_FontAtlas_Def,           Debug_FontAtlas_Glue,           Debug_FontAtlas_Desc);
+	AddDebugCommandDef(context, Debug_FontAtlasBench_Def,      Debug_FontAtlasBench_Glue,      Debug_FontAtlasBench_Desc);
+	AddDebugCommandDef(context, Debug_FontSdfBench_Def,        Debug_FontSdfBench_Glue,        Debug_FontSdfBench_Desc);
+	AddDebugCommandDef(context, Debug_TextureCookBench_Def,    Debug_TextureCookBench_Glue,    Debug_TextureCookBench_Desc);
+	AddDebugCommandDef(context, Debug_TextureCookTest_Def,     Debug_TextureCookTest_Glue,     Debug_TextureCookTest_Desc);
+	AddDebugCommandDef(context, Debug_TextureAtlas_Def,        Debug_TextureAtlas_Glue,        Debug_TextureAtlas_Desc);
+	AddDebugCommandDef(context, Debug_ImageKernelBench_Def,    Debug_ImageKernelBench_Glue,    Debug_ImageKernelBench_Desc);
+	AddDebugCommandDef(context, Debug_SheetTrimStats_Def,      Debug_SheetTrimStats_Glue,      Debug_SheetTrimStats_Desc);
+	AddDebugCommandDef(context, Debug_SettingsBench_Def,       Debug_SettingsBench_Glue,       Debug_SettingsBench_Desc);
+	AddDebugCommandDef(context, Debug_PartsBench_Def,          Debug_PartsBench_Glue,          Debug_PartsBench_Desc);
+	AddDebugCommandDef(context, Debug_TempArenaBench_Def,      Debug_TempArenaBench_Glue,      Debug_TempArenaBench_Desc);
+	AddDebugCommandDef(context, Debug_DebugExpBench_Def,       Debug_DebugExpBench_Glue,       Debug_DebugExpBench_Desc);
+	#if JSON_SUPPORTED
+	AddDebugCommandDef(context, Debug_JsonBench_Def,           Debug_JsonBench_Glue,           Debug_JsonBench_Desc);
+	#endif //JSON_SUPPORTED
+	#if PIG_PROFILER
+	AddDebugCommandDef(context, Debug_ProfilerCapture_Def,     Debug_ProfilerCapture_Glue,     Debug_ProfilerCapture_Desc);
+	AddDebugCommandDef(context, Debug_ProfilerBench_Def,       Debug_ProfilerBench_Glue,       Debug_ProfilerBench_Desc);
+	#endif //PIG_PROFILER
+	#if PIG_MEM_TRACKING
+	AddDebugCommandDef(context, Debug_MemTrackDump_Def,        Debug_MemTrackDump_Glue,        Debug_MemTrackDump_Desc);
+	AddDebugCommandDef(context, Debug_MemExpectSteady_Def,     Debug_MemExpectSteady_Glue,     Debug_MemExpectSteady_Desc);
+	#if !defined(GYLIB_MEM_ARENA_DEBUG_ENABLED)
+	AddDebugCommandDef(context, Debug_MemTrackBench_Def,       Debug_MemTrackBench_Glue,       Debug_MemTrackBench_Desc);
+	#endif
+	#endif //PIG_MEM_TRACKING
+	#if DEVELOPER_BUILD
+	AddDebugCommandDef(context, Debug_FileWatchTest_Def,       Debug_FileWatchTest_Glue,       Debug_FileWatchTest_Desc);
+	#endif //DEVELOPER_BUILD
 	AddDebugCommandDef(context, Debug_OpenWindow_Def,          Debug_OpenWindow_Glue,          Debug_OpenWindow_Desc);
 	#if LUA_SUPPORTED
 	AddDebugCommandDef(context, Debug_Lua_Def,                 Debug_Lua_Glue,                 Debug_Lua_Desc);
@@ -1666,15 +3765,12 @@ bool PigParseDebugCommand(MyStr_t commandStr) //pre-declared in pig_func_defs.h
 	if (commandStr.length == 0) { return false; }
 	
 	MemArena_t* scratch = GetScratchArena();
-	ExpContext_t context = {};
-	InitDebugConsoleExpContext(scratch, false, &context);
-	
-	ExpValue_t result = {};
-	MyStr_t errorStr = TryRunExpressionErrorStr(commandStr, scratch, &result, &context);
-	bool isValidCommand = IsEmptyStr(errorStr);
+	MyStr_t resultStr = MyStr_Empty;
+	MyStr_t errorStr = MyStr_Empty;
+	bool isValidCommand = RunDebugExp(&pig->debugExp, commandStr, scratch, &resultStr, &errorStr);
 	if (isValidCommand)
 	{
-		if (result.type != ExpValueType_Void) { PrintLine_I("=> %s", ExpValueToStr(result, scratch).chars); }
+		if (!IsEmptyStr(resultStr)) { PrintLine_I("=> %.*s", StrPrint(resultStr)); }
 		// if (foo != 14.123f) { PrintLine_D("foo is now %g", foo); }
 	}
 	else
@@ -97,7 +97,7 @@ void InitializeDebugConsole(DebugConsole_t* console, u64 fifoSize, u8* fifoSpace
 	{
 		console->hasFifo = false;
 	}
-	
+
 }
 
 // +--------------------------------------------------------------+
@@ -1198,16 +1198,15 @@ void UpdateDebugConsole(DebugConsole_t* console)
 		console->inputTextbox.selectionChanged = false;
 		
 		MemArena_t* scratch = GetScratchArena();
-		ExpContext_t context = {};
-		InitDebugConsoleExpContext(scratch, false, &context);
+		ExpContext_t* context = GetDebugExpContext(&pig->debugExp, scratch);
 		
 		console->isInputValid = true;
 		if (!IsEmptyStr(console->inputTextbox.text))
 		{
-			console->isInputValid = (ValidateExpression(console->inputTextbox.text, scratch, &context) == Result_Success);
+			console->isInputValid = (ValidateExpression(console->inputTextbox.text, scratch, context) == Result_Success);
 		}
 		
-		DebugConsoleUpdateAutocompleteItems(console, &context, scratch);
+		DebugConsoleUpdateAutocompleteItems(console, context, scratch);
 		
 		FreeScratchArena(scratch);
 	}
@@ -1229,9 +1228,8 @@ void UpdateDebugConsole(DebugConsole_t* console)
 		if (!console->autocompleteActive && console->inputTextbox.text.length == 0)
 		{
 			MemArena_t* scratch = GetScratchArena();
-			ExpContext_t context = {};
-			InitDebugConsoleExpContext(scratch, false, &context);
-			DebugConsoleUpdateAutocompleteItems(console, &context, scratch, true);
+			ExpContext_t* context = GetDebugExpContext(&pig->debugExp, scratch);
+			DebugConsoleUpdateAutocompleteItems(console, context, scratch, true);
 			FreeScratchArena(scratch);
 		}
 		if (console->autocompleteActive && console->autocompleteItems.length > 0)
@@ -1266,10 +1264,9 @@ void UpdateDebugConsole(DebugConsole_t* console)
 			DebugConsoleAutocompleteItem_t* selectedItem = VarArrayGet(&console->autocompleteItems, console->autocompleteSelectionIndex, DebugConsoleAutocompleteItem_t);
 			
 			MemArena_t* scratch = GetScratchArena();
-			ExpContext_t context = {};
-			InitDebugConsoleExpContext(scratch, false, &context);
+			ExpContext_t* context = GetDebugExpContext(&pig->debugExp, scratch);
 			ExpAutocompleteInfo_t info = {};
-			GetExpAutocompleteInfo(console->inputTextbox.text, console->inputTextbox.selectionEndIndex, scratch, &info, &context);
+			GetExpAutocompleteInfo(console->inputTextbox.text, console->inputTextbox.selectionEndIndex, scratch, &info, context);
 			
 			u64 replaceSectionStart = console->inputTextbox.selectionEndIndex;
 			u64 replaceSectionEnd = console->inputTextbox.selectionEndIndex;
@@ -0,0 +1,782 @@
+/*
+File:   pig_debug_exp.cpp
+Date:   10\19\2026
+Description:
+	** Holds the compiler, VM and cache that let us evaluate debug expressions (console input,
+	** key bindings, etc.) without re-tokenizing, re-parsing and re-resolving names every time
+*/
+
+// +--------------------------------------------------------------+
+// |                        Init and Free                         |
+// +--------------------------------------------------------------+
+void FreeDebugExpProgram(MemArena_t* allocArena, DebugExpProgram_t* program)
+{
+	NotNull2(allocArena, program);
+	if (!IsEmptyStr(program->source)) { FreeString(allocArena, &program->source); }
+	if (program->code != nullptr) { FreeMem(allocArena, program->code, program->codeSize); }
+	if (program->constants != nullptr) { FreeMem(allocArena, program->constants, sizeof(DebugExpValue_t) * program->numConstants); }
+	ClearPointer(program);
+}
+
+//NOTE: Called after every dll reload since the cached context and var slots are full of pointers into the old dll,
+//      and by VerifyDebugExpVarSlots when a variable has moved
+void InvalidateDebugExpCache(PigDebugExpCache_t* cache)
+{
+	NotNull(cache);
+	VarArrayLoop(&cache->programs, pIndex)
+	{
+		VarArrayLoopGet(DebugExpProgram_t, program, &cache->programs, pIndex);
+		FreeDebugExpProgram(cache->allocArena, program);
+	}
+	VarArrayClear(&cache->programs);
+	VarArrayClear(&cache->varSlots);
+	if (cache->contextBuilt)
+	{
+		FreeMemArena(&cache->contextHeap);
+		ClearStruct(cache->context);
+		cache->contextBuilt = false;
+	}
+}
+
+void FreeDebugExpCache(PigDebugExpCache_t* cache)
+{
+	NotNull(cache);
+	InvalidateDebugExpCache(cache);
+	FreeVarArray(&cache->programs);
+	FreeVarArray(&cache->varSlots);
+	ClearPointer(cache);
+}
+
+void InitDebugExpCache(PigDebugExpCache_t* cache, MemArena_t* memArena)
+{
+	NotNull2(cache, memArena);
+	ClearPointer(cache);
+	cache->allocArena = memArena;
+	cache->nextUseIndex = 1;
+	CreateVarArray(&cache->varSlots, memArena, sizeof(DebugExpVarSlot_t));
+	CreateVarArray(&cache->programs, memArena, sizeof(DebugExpProgram_t));
+}
+
+// +--------------------------------------------------------------+
+// |                        Var Registration                      |
+// +--------------------------------------------------------------+
+//NOTE: Only variables added through these (instead of AddExpVariableDefXXX directly) can be compiled into a program,
+//      anything else still works but the expression will be run through the gylib evaluator
+void DebugExpAddVarSlot(ExpContext_t* context, const char* name, DebugExpVarType_t type, bool writeable, void* pntr)
+{
+	PigDebugExpCache_t* cache = &pig->debugExp;
+	if (cache->verifyingContext != nullptr && cache->verifyingContext == context)
+	{
+		const DebugExpVarSlot_t* slot = (cache->verifySlotIndex < cache->varSlots.length) ? VarArrayGet(&cache->varSlots, cache->verifySlotIndex, DebugExpVarSlot_t) : nullptr;
+		if (slot == nullptr || slot->pntr != pntr || slot->type != type || slot->writeable != writeable || !StrEquals(slot->name, NewStr(name))) { cache->verifyFailed = true; }
+		cache->verifySlotIndex++;
+		return;
+	}
+	if (cache->buildingContext != context) { return; }
+	DebugExpVarSlot_t* newSlot = VarArrayAdd(&cache->varSlots, DebugExpVarSlot_t);
+	NotNull(newSlot);
+	ClearPointer(newSlot);
+	newSlot->name = NewStr(name);
+	newSlot->nameHash = FnvHashU64(newSlot->name.chars, newSlot->name.length);
+	newSlot->type = type;
+	newSlot->writeable = writeable;
+	newSlot->pntr = pntr;
+}
+void PigAddDebugVarU64(ExpContext_t* context, bool writeable, const char* name, u64* pntr, const char* documentation)
+{
+	AddExpVariableDefU64(context, writeable, name, pntr, documentation);
+	DebugExpAddVarSlot(context, name, DebugExpVarType_U64, writeable, pntr);
+}
+void PigAddDebugVarR32(ExpContext_t* context, bool writeable, const char* name, r32* pntr, const char* documentation)
+{
+	AddExpVariableDefR32(context, writeable, name, pntr, documentation);
+	DebugExpAddVarSlot(context, name, DebugExpVarType_R32, writeable, pntr);
+}
+void PigAddDebugVarR64(ExpContext_t* context, bool writeable, const char* name, r64* pntr, const char* documentation)
+{
+	AddExpVariableDefR64(context, writeable, name, pntr, documentation);
+	DebugExpAddVarSlot(context, name, DebugExpVarType_R64, writeable, pntr);
+}
+void PigAddDebugVarBool(ExpContext_t* context, bool writeable, const char* name, bool* pntr, const char* documentation)
+{
+	AddExpVariableDefBool(context, writeable, name, pntr, documentation);
+	DebugExpAddVarSlot(context, name, DebugExpVarType_Bool, writeable, pntr);
+}
+
+i64 FindDebugExpVarSlot(PigDebugExpCache_t* cache, MyStr_t name)
+{
+	u64 nameHash = FnvHashU64(name.chars, name.length);
+	VarArrayLoop(&cache->varSlots, sIndex)
+	{
+		VarArrayLoopGet(DebugExpVarSlot_t, slot, &cache->varSlots, sIndex);
+		if (slot->nameHash == nameHash && StrEquals(slot->name, name)) { return (i64)sIndex; }
+	}
+	return -1;
+}
+
+// +--------------------------------------------------------------+
+// |                        Cached Context                        |
+// +--------------------------------------------------------------+
+//NOTE: context->scratch is pointed at the caller's scratch arena every time since the one used while building is long gone
+ExpContext_t* GetDebugExpContext(PigDebugExpCache_t* cache, MemArena_t* scratch)
+{
+	NotNull2(cache, scratch);
+	if (cache->contextBuilt && cache->contextWindow != pig->currentWindow) { InvalidateDebugExpCache(cache); }
+	if (!cache->contextBuilt)
+	{
+		InitMemArena_PagedHeapFuncs(&cache->contextHeap, DEBUG_EXP_CONTEXT_PAGE_SIZE, PlatAllocFunc, PlatFreeFunc);
+		VarArrayClear(&cache->varSlots);
+		cache->buildingContext = &cache->context;
+		InitDebugConsoleExpContext(&cache->contextHeap, false, &cache->context);
+		cache->buildingContext = nullptr;
+		cache->contextBuilt = true;
+		cache->contextWindow = pig->currentWindow;
+	}
+	cache->context.scratch = scratch;
+	return &cache->context;
+}
+
+//Registers the pig and game variables again into a throwaway context (much cheaper than the whole console context,
+//no functions or commands) and drops the cache if any of them point somewhere else now (app state changes, reallocations, etc.)
+//Returns false if the cache was dropped
+bool VerifyDebugExpVarSlots(PigDebugExpCache_t* cache, MemArena_t* scratch)
+{
+	NotNull2(cache, scratch);
+	if (!cache->contextBuilt) { return true; }
+	PushMemMark(scratch);
+	ExpContext_t verifyContext = {};
+	InitExpContext(scratch, &verifyContext, false);
+	verifyContext.scratch = scratch;
+	cache->verifyingContext = &verifyContext;
+	cache->verifySlotIndex = 0;
+	cache->verifyFailed = false;
+	PigAddDebugVarsToExpContext(&verifyContext);
+	GameAddDebugVarsToExpContext(&verifyContext);
+	cache->verifyingContext = nullptr;
+	PopMemMark(scratch);
+	if (cache->verifyFailed || cache->verifySlotIndex != cache->varSlots.length)
+	{
+		InvalidateDebugExpCache(cache);
+		cache->numStaleSlotInvalidations++;
+		return false;
+	}
+	return true;
+}
+
+// +--------------------------------------------------------------+
+// |                          Tokenizer                           |
+// +--------------------------------------------------------------+
+enum DebugExpTokenType_t
+{
+	DebugExpTokenType_None = 0,
+	DebugExpTokenType_End,
+	DebugExpTokenType_Number,
+	DebugExpTokenType_Identifier,
+	DebugExpTokenType_Operator,
+	DebugExpTokenType_OpenParens,
+	DebugExpTokenType_CloseParens,
+	DebugExpTokenType_Unsupported, //strings, commas, anything else the compiler leaves to the gylib evaluator
+};
+
+struct DebugExpToken_t
+{
+	DebugExpTokenType_t type;
+	MyStr_t str;
+	DebugExpValue_t number;
+};
+
+struct DebugExpCompiler_t
+{
+	MyStr_t source;
+	u64 readIndex;
+	DebugExpToken_t token;
+	bool isFallback;
+	MyStr_t errorStr;
+	
+	PigDebugExpCache_t* cache;
+	VarArray_t code; //u8
+	VarArray_t constants; //DebugExpValue_t
+	u64 stackDepth;
+	u64 maxStackDepth;
+};
+
+bool IsDebugExpIdentifierChar(char c, bool isFirstChar)
+{
+	if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_') { return true; }
+	return (!isFirstChar && c >= '0' && c <= '9');
+}
+
+void DebugExpNextToken(DebugExpCompiler_t* compiler)
+{
+	MyStr_t source = compiler->source;
+	while (compiler->readIndex < source.length && (source.chars[compiler->readIndex] == ' ' || source.chars[compiler->readIndex] == '\t')) { compiler->readIndex++; }
+	
+	DebugExpToken_t* token = &compiler->token;
+	ClearPointer(token);
+	if (compiler->readIndex >= source.length) { token->type = DebugExpTokenType_End; return; }
+	
+	u64 startIndex = compiler->readIndex;
+	char c = source.chars[startIndex];
+	char nextChar = (startIndex+1 < source.length) ? source.chars[startIndex+1] : '\0';
+	if (c >= '0' && c <= '9')
+	{
+		token->type = DebugExpTokenType_Number;
+		if (c == '0' && (nextChar == 'x' || nextChar == 'X'))
+		{
+			compiler->readIndex += 2;
+			u64 value = 0;
+			while (compiler->readIndex < source.length)
+			{
+				char hexChar = source.chars[compiler->readIndex];
+				if (hexChar >= '0' && hexChar <= '9') { value = (value << 4) | (u64)(hexChar - '0'); }
+				else if (hexChar >= 'a' && hexChar <= 'f') { value = (value << 4) | (u64)(hexChar - 'a' + 10); }
+				else if (hexChar >= 'A' && hexChar <= 'F') { value = (value << 4) | (u64)(hexChar - 'A' + 10); }
+				else { break; }
+				compiler->readIndex++;
+			}
+			token->number.type = DebugExpType_Int;
+			token->number.valueInt = (i64)value;
+		}
+		else
+		{
+			u64 wholePart = 0;
+			while (compiler->readIndex < source.length && source.chars[compiler->readIndex] >= '0' && source.chars[compiler->readIndex] <= '9')
+			{
+				wholePart = (wholePart * 10) + (u64)(source.chars[compiler->readIndex] - '0');
+				compiler->readIndex++;
+			}
+			token->number.type = DebugExpType_Int;
+			token->number.valueInt = (i64)wholePart;
+			if (compiler->readIndex < source.length && source.chars[compiler->readIndex] == '.')
+			{
+				compiler->readIndex++;
+				r64 value = (r64)wholePart;
+				r64 placeValue = 0.1;
+				while (compiler->readIndex < source.length && source.chars[compiler->readIndex] >= '0' && source.chars[compiler->readIndex] <= '9')
+				{
+					value += placeValue * (r64)(source.chars[compiler->readIndex] - '0');
+					placeValue *= 0.1;
+					compiler->readIndex++;
+				}
+				if (compiler->readIndex < source.length && (source.chars[compiler->readIndex] == 'f' || source.chars[compiler->readIndex] == 'F')) { compiler->readIndex++; }
+				token->number.type = DebugExpType_Float;
+				token->number.valueFloat = value;
+			}
+		}
+		//things like "1e5" or "12abc" are left to the gylib evaluator to accept or complain about
+		if (compiler->readIndex < source.length && IsDebugExpIdentifierChar(source.chars[compiler->readIndex], false)) { token->type = DebugExpTokenType_Unsupported; }
+	}
+	else if (IsDebugExpIdentifierChar(c, true))
+	{
+		token->type = DebugExpTokenType_Identifier;
+		while (compiler->readIndex < source.length && IsDebugExpIdentifierChar(source.chars[compiler->readIndex], false)) { compiler->readIndex++; }
+	}
+	else if (c == '(') { token->type = DebugExpTokenType_OpenParens; compiler->readIndex++; }
+	else if (c == ')') { token->type = DebugExpTokenType_CloseParens; compiler->readIndex++; }
+	else if ((c == '&' && nextChar == '&') || (c == '|' && nextChar == '|') || (c == '=' && nextChar == '=') ||
+		(c == '!' && nextChar == '=') || (c == '<' && nextChar == '=') || (c == '>' && nextChar == '='))
+	{
+		token->type = DebugExpTokenType_Operator;
+		compiler->readIndex += 2;
+	}
+	else if (c == '+' || c == '-' || c == '*' || c == '/' || c == '%' || c == '<' || c == '>' || c == '!' || c == '=')
+	{
+		token->type = DebugExpTokenType_Operator;
+		compiler->readIndex++;
+	}
+	else
+	{
+		token->type = DebugExpTokenType_Unsupported;
+		compiler->readIndex++;
+	}
+	token->str = StrSubstring(&source, startIndex, compiler->readIndex);
+}
+
+// +--------------------------------------------------------------+
+// |                           Compiler                           |
+// +--------------------------------------------------------------+
+void DebugExpEmitOp(DebugExpCompiler_t* compiler, DebugExpOp_t op, i64 stackChange)
+{
+	u8* newByte = VarArrayAdd(&compiler->code, u8);
+	NotNull(newByte);
+	*newByte = (u8)op;
+	Assert(stackChange >= 0 || compiler->stackDepth >= (u64)(-stackChange));
+	compiler->stackDepth = (u64)((i64)compiler->stackDepth + stackChange);
+	if (compiler->stackDepth > compiler->maxStackDepth) { compiler->maxStackDepth = compiler->stackDepth; }
+}
+//Returns the index of the operand so jumps can be patched once we know where they land
+u64 DebugExpEmitOpU16(DebugExpCompiler_t* compiler, DebugExpOp_t op, i64 stackChange, u16 operand)
+{
+	DebugExpEmitOp(compiler, op, stackChange);
+	u64 operandIndex = compiler->code.length;
+	u8* lowByte = VarArrayAdd(&compiler->code, u8);
+	NotNull(lowByte);
+	*lowByte = (u8)(operand & 0xFF);
+	u8* highByte = VarArrayAdd(&compiler->code, u8);
+	NotNull(highByte);
+	*highByte = (u8)(operand >> 8);
+	return operandIndex;
+}
+void DebugExpPatchJump(DebugExpCompiler_t* compiler, u64 operandIndex)
+{
+	u64 offset = compiler->code.length - (operandIndex + 2);
+	if (offset > UINT16_MAX) { compiler->isFallback = true; return; }
+	u8* operandBytes = VarArrayGet(&compiler->code, operandIndex, u8);
+	operandBytes[0] = (u8)(offset & 0xFF);
+	operandBytes[1] = (u8)(offset >> 8);
+}
+void DebugExpEmitConst(DebugExpCompiler_t* compiler, DebugExpValue_t value)
+{
+	if (compiler->constants.length >= DEBUG_EXP_MAX_CONSTANTS) { compiler->isFallback = true; return; }
+	DebugExpValue_t* newConstant = VarArrayAdd(&compiler->constants, DebugExpValue_t);
+	NotNull(newConstant);
+	*newConstant = value;
+	DebugExpEmitOpU16(compiler, DebugExpOp_PushConst, 1, (u16)(compiler->constants.length-1));
+}
+
+// Precedence (low to high): =  ||  &&  == !=  < <= > >=  + -  * / %  unary - !
+i32 GetDebugExpBinaryPrecedence(MyStr_t opStr, DebugExpOp_t* opOut)
+{
+	if (StrEquals(opStr, "||")) { *opOut = DebugExpOp_JumpIfTrueOrPop;  return 1; }
+	if (StrEquals(opStr, "&&")) { *opOut = DebugExpOp_JumpIfFalseOrPop; return 2; }
+	if (StrEquals(opStr, "==")) { *opOut = DebugExpOp_Equal;            return 3; }
+	if (StrEquals(opStr, "!=")) { *opOut = DebugExpOp_NotEqual;         return 3; }
+	if (StrEquals(opStr, "<"))  { *opOut = DebugExpOp_Less;             return 4; }
+	if (StrEquals(opStr, "<=")) { *opOut = DebugExpOp_LessEqual;        return 4; }
+	if (StrEquals(opStr, ">"))  { *opOut = DebugExpOp_Greater;          return 4; }
+	if (StrEquals(opStr, ">=")) { *opOut = DebugExpOp_GreaterEqual;     return 4; }
+	if (StrEquals(opStr, "+"))  { *opOut = DebugExpOp_Add;              return 5; }
+	if (StrEquals(opStr, "-"))  { *opOut = DebugExpOp_Subtract;         return 5; }
+	if (StrEquals(opStr, "*"))  { *opOut = DebugExpOp_Multiply;         return 6; }
+	if (StrEquals(opStr, "/"))  { *opOut = DebugExpOp_Divide;           return 6; }
+	if (StrEquals(opStr, "%"))  { *opOut = DebugExpOp_Modulo;           return 6; }
+	return 0;
+}
+
+void DebugExpCompileBinary(DebugExpCompiler_t* compiler, i32 minPrecedence);
+
+void DebugExpCompileUnary(DebugExpCompiler_t* compiler)
+{
+	if (compiler->isFallback) { return; }
+	DebugExpToken_t token = compiler->token;
+	if (token.type == DebugExpTokenType_Operator && (StrEquals(token.str, "-") || StrEquals(token.str, "!")))
+	{
+		DebugExpNextToken(compiler);
+		DebugExpCompileUnary(compiler);
+		DebugExpEmitOp(compiler, StrEquals(token.str, "-") ? DebugExpOp_Negate : DebugExpOp_Not, 0);
+	}
+	else if (token.type == DebugExpTokenType_Number)
+	{
+		DebugExpEmitConst(compiler, token.number);
+		DebugExpNextToken(compiler);
+	}
+	else if (token.type == DebugExpTokenType_OpenParens)
+	{
+		DebugExpNextToken(compiler);
+		DebugExpCompileBinary(compiler, 1);
+		if (compiler->isFallback) { return; }
+		if (compiler->token.type != DebugExpTokenType_CloseParens) { compiler->isFallback = true; return; }
+		DebugExpNextToken(compiler);
+	}
+	else if (token.type == DebugExpTokenType_Identifier)
+	{
+		if (StrEquals(token.str, "true") || StrEquals(token.str, "false"))
+		{
+			DebugExpValue_t value = {};
+			value.type = DebugExpType_Bool;
+			value.valueBool = StrEquals(token.str, "true");
+			DebugExpEmitConst(compiler, value);
+			DebugExpNextToken(compiler);
+			return;
+		}
+		
+		//Anything that isn't one of our var slots (function calls, constants, string getters, game variables) goes to gylib
+		i64 slotIndex = FindDebugExpVarSlot(compiler->cache, token.str);
+		if (slotIndex < 0 || slotIndex > UINT16_MAX) { compiler->isFallback = true; return; }
+		DebugExpNextToken(compiler);
+		if (compiler->token.type == DebugExpTokenType_OpenParens) { compiler->isFallback = true; return; }
+		if (compiler->token.type == DebugExpTokenType_Operator && StrEquals(compiler->token.str, "="))
+		{
+			const DebugExpVarSlot_t* slot = VarArrayGet(&compiler->cache->varSlots, (u64)slotIndex, DebugExpVarSlot_t);
+			bool isFirstToken = (token.str.chars == compiler->source.chars);
+			if (!slot->writeable || !isFirstToken) { compiler->isFallback = true; return; } //let gylib produce the error message
+			DebugExpNextToken(compiler);
+			DebugExpCompileBinary(compiler, 1);
+			DebugExpEmitOpU16(compiler, DebugExpOp_StoreVar, 0, (u16)slotIndex);
+		}
+		else
+		{
+			DebugExpEmitOpU16(compiler, DebugExpOp_LoadVar, 1, (u16)slotIndex);
+		}
+	}
+	else { compiler->isFallback = true; }
+}
+
+void DebugExpCompileBinary(DebugExpCompiler_t* compiler, i32 minPrecedence)
+{
+	DebugExpCompileUnary(compiler);
+	while (!compiler->isFallback && compiler->token.type == DebugExpTokenType_Operator)
+	{
+		DebugExpOp_t op = DebugExpOp_Return;
+		i32 precedence = GetDebugExpBinaryPrecedence(compiler->token.str, &op);
+		if (precedence == 0) { compiler->isFallback = true; return; } //assignment to something that isn't a var, etc.
+		if (precedence < minPrecedence) { break; }
+		DebugExpNextToken(compiler);
+		
+		if (op == DebugExpOp_JumpIfFalseOrPop || op == DebugExpOp_JumpIfTrueOrPop)
+		{
+			DebugExpEmitOp(compiler, DebugExpOp_ToBool, 0);
+			u64 jumpOperandIndex = DebugExpEmitOpU16(compiler, op, -1, 0); //pops when it doesn't jump
+			DebugExpCompileBinary(compiler, precedence+1);
+			DebugExpEmitOp(compiler, DebugExpOp_ToBool, 0);
+			DebugExpPatchJump(compiler, jumpOperandIndex);
+		}
+		else
+		{
+			DebugExpCompileBinary(compiler, precedence+1);
+			DebugExpEmitOp(compiler, op, -1);
+		}
+	}
+}
+
+//NOTE: Always succeeds, programs the compiler can't handle come back with isFallback set and no code
+void CompileDebugExp(PigDebugExpCache_t* cache, MyStr_t source, MemArena_t* memArena, DebugExpProgram_t* programOut)
+{
+	NotNull3(cache, memArena, programOut);
+	ClearPointer(programOut);
+	programOut->source = AllocString(memArena, &source);
+	programOut->sourceHash = FnvHashU64(source.chars, source.length);
+	
+	MemArena_t* scratch = GetScratchArena(memArena);
+	DebugExpCompiler_t compiler = {};
+	compiler.source = source;
+	compiler.cache = cache;
+	CreateVarArray(&compiler.code, scratch, sizeof(u8), 64);
+	CreateVarArray(&compiler.constants, scratch, sizeof(DebugExpValue_t), 8);
+	
+	DebugExpNextToken(&compiler);
+	if (compiler.token.type == DebugExpTokenType_End) { compiler.isFallback = true; }
+	DebugExpCompileBinary(&compiler, 1);
+	if (!compiler.isFallback && compiler.token.type != DebugExpTokenType_End) { compiler.isFallback = true; }
+	if (!compiler.isFallback && compiler.maxStackDepth > DEBUG_EXP_MAX_STACK_DEPTH) { compiler.isFallback = true; }
+	if (!compiler.isFallback) { DebugExpEmitOp(&compiler, DebugExpOp_Return, -1); }
+	
+	programOut->isFallback = compiler.isFallback;
+	if (!compiler.isFallback)
+	{
+		programOut->codeSize = compiler.code.length;
+		programOut->code = AllocArray(memArena, u8, compiler.code.length);
+		NotNull(programOut->code);
+		MyMemCopy(programOut->code, compiler.code.items, compiler.code.length);
+		programOut->numConstants = compiler.constants.length;
+		if (compiler.constants.length > 0)
+		{
+			programOut->constants = AllocArray(memArena, DebugExpValue_t, compiler.constants.length);
+			NotNull(programOut->constants);
+			MyMemCopy(programOut->constants, compiler.constants.items, sizeof(DebugExpValue_t) * compiler.constants.length);
+		}
+		programOut->maxStackDepth = compiler.maxStackDepth;
+	}
+	
+	FreeVarArray(&compiler.code);
+	FreeVarArray(&compiler.constants);
+	FreeScratchArena(scratch);
+}
+
+// +--------------------------------------------------------------+
+// |                              VM                              |
+// +--------------------------------------------------------------+
+DebugExpValue_t NewDebugExpValueBool(bool value)  { DebugExpValue_t result = {}; result.type = DebugExpType_Bool;  result.valueBool = value;  return result; }
+DebugExpValue_t NewDebugExpValueInt(i64 value)    { DebugExpValue_t result = {}; result.type = DebugExpType_Int;   result.valueInt = value;   return result; }
+DebugExpValue_t NewDebugExpValueFloat(r64 value)  { DebugExpValue_t result = {}; result.type = DebugExpType_Float; result.valueFloat = value; return result; }
+
+r64 DebugExpValueAsFloat(DebugExpValue_t value)
+{
+	switch (value.type)
+	{
+		case DebugExpType_Bool:  return (value.valueBool ? 1.0 : 0.0);
+		case DebugExpType_Int:   return (r64)value.valueInt;
+		case DebugExpType_Float: return value.valueFloat;
+		default: return 0.0;
+	}
+}
+bool DebugExpValueIsTruthy(DebugExpValue_t value)
+{
+	switch (value.type)
+	{
+		case DebugExpType_Bool:  return value.valueBool;
+		case DebugExpType_Int:   return (value.valueInt != 0);
+		case DebugExpType_Float: return (value.valueFloat != 0.0);
+		default: return false;
+	}
+}
+
+DebugExpValue_t DebugExpLoadVar(const DebugExpVarSlot_t* slot)
+{
+	switch (slot->type)
+	{
+		case DebugExpVarType_U64:  return NewDebugExpValueInt((i64)(*(u64*)slot->pntr));
+		case DebugExpVarType_R32:  return NewDebugExpValueFloat((r64)(*(r32*)slot->pntr));
+		case DebugExpVarType_R64:  return NewDebugExpValueFloat(*(r64*)slot->pntr);
+		case DebugExpVarType_Bool: return NewDebugExpValueBool(*(bool*)slot->pntr);
+		default: DebugAssert(false); return NewDebugExpValueInt(0);
+	}
+}
+//Returns the value as it was actually stored (e.g. truncated to an integer)
+DebugExpValue_t DebugExpStoreVar(const DebugExpVarSlot_t* slot, DebugExpValue_t value)
+{
+	switch (slot->type)
+	{
+		case DebugExpVarType_U64:
+		{
+			u64 storeValue = (value.type == DebugExpType_Int) ? (u64)value.valueInt : (u64)DebugExpValueAsFloat(value);
+			*(u64*)slot->pntr = storeValue;
+		} break;
+		case DebugExpVarType_R32:  *(r32*)slot->pntr = (r32)DebugExpValueAsFloat(value); break;
+		case DebugExpVarType_R64:  *(r64*)slot->pntr = DebugExpValueAsFloat(value); break;
+		case DebugExpVarType_Bool: *(bool*)slot->pntr = DebugExpValueIsTruthy(value); break;
+		default: DebugAssert(false); break;
+	}
+	return DebugExpLoadVar(slot);
+}
+
+bool DebugExpCompareValues(DebugExpOp_t op, DebugExpValue_t left, DebugExpValue_t right)
+{
+	if (left.type == DebugExpType_Bool && right.type == DebugExpType_Bool)
+	{
+		if (op == DebugExpOp_Equal) { return (left.valueBool == right.valueBool); }
+		if (op == DebugExpOp_NotEqual) { return (left.valueBool != right.valueBool); }
+	}
+	if (left.type == DebugExpType_Int && right.type == DebugExpType_Int)
+	{
+		switch (op)
+		{
+			case DebugExpOp_Equal:        return (left.valueInt == right.valueInt);
+			case DebugExpOp_NotEqual:     return (left.valueInt != right.valueInt);
+			case DebugExpOp_Less:         return (left.valueInt <  right.valueInt);
+			case DebugExpOp_LessEqual:    return (left.valueInt <= right.valueInt);
+			case DebugExpOp_Greater:      return (left.valueInt >  right.valueInt);
+			case DebugExpOp_GreaterEqual: return (left.valueInt >= right.valueInt);
+			default: return false;
+		}
+	}
+	r64 leftFloat = DebugExpValueAsFloat(left);
+	r64 rightFloat = DebugExpValueAsFloat(right);
+	switch (op)
+	{
+		case DebugExpOp_Equal:        return (leftFloat == rightFloat);
+		case DebugExpOp_NotEqual:     return (leftFloat != rightFloat);
+		case DebugExpOp_Less:         return (leftFloat <  rightFloat);
+		case DebugExpOp_LessEqual:    return (leftFloat <= rightFloat);
+		case DebugExpOp_Greater:      return (leftFloat >  rightFloat);
+		case DebugExpOp_GreaterEqual: return (leftFloat >= rightFloat);
+		default: return false;
+	}
+}
+
+//NOTE: errorStrOut (if given) only ever points at string literals so nothing needs to be allocated
+bool RunDebugExpProgram(const PigDebugExpCache_t* cache, const DebugExpProgram_t* program, DebugExpValue_t* resultOut, const char** errorStrOut = nullptr)
+{
+	NotNull3(cache, program, resultOut);
+	Assert(!program->isFallback);
+	Assert(program->maxStackDepth <= DEBUG_EXP_MAX_STACK_DEPTH);
+	
+	DebugExpValue_t stack[DEBUG_EXP_MAX_STACK_DEPTH];
+	u64 stackSize = 0;
+	const DebugExpVarSlot_t* slots = (const DebugExpVarSlot_t*)cache->varSlots.items;
+	const u8* code = program->code;
+	u64 codeIndex = 0;
+	while (codeIndex < program->codeSize)
+	{
+		DebugExpOp_t op = (DebugExpOp_t)code[codeIndex];
+		codeIndex++;
+		u16 operand = 0;
+		if (op == DebugExpOp_PushConst || op == DebugExpOp_LoadVar || op == DebugExpOp_StoreVar ||
+			op == DebugExpOp_JumpIfFalseOrPop || op == DebugExpOp_JumpIfTrueOrPop)
+		{
+			operand = (u16)(code[codeIndex] | ((u16)code[codeIndex+1] << 8));
+			codeIndex += 2;
+		}
+		
+		switch (op)
+		{
+			case DebugExpOp_Return:
+			{
+				*resultOut = (stackSize > 0) ? stack[stackSize-1] : DebugExpValue_t{};
+				return true;
+			} break;
+			case DebugExpOp_PushConst: stack[stackSize++] = program->constants[operand]; break;
+			case DebugExpOp_LoadVar:   stack[stackSize++] = DebugExpLoadVar(&slots[operand]); break;
+			case DebugExpOp_StoreVar:  stack[stackSize-1] = DebugExpStoreVar(&slots[operand], stack[stackSize-1]); break;
+			case DebugExpOp_Pop:       stackSize--; break;
+			case DebugExpOp_ToBool:    stack[stackSize-1] = NewDebugExpValueBool(DebugExpValueIsTruthy(stack[stackSize-1])); break;
+			case DebugExpOp_Not:       stack[stackSize-1] = NewDebugExpValueBool(!DebugExpValueIsTruthy(stack[stackSize-1])); break;
+			case DebugExpOp_Negate:
+			{
+				DebugExpValue_t* value = &stack[stackSize-1];
+				if (value->type == DebugExpType_Int) { value->valueInt = -value->valueInt; }
+				else { *value = NewDebugExpValueFloat(-DebugExpValueAsFloat(*value)); }
+			} break;
+			case DebugExpOp_JumpIfFalseOrPop:
+			{
+				if (!stack[stackSize-1].valueBool) { codeIndex += operand; }
+				else { stackSize--; }
+			} break;
+			case DebugExpOp_JumpIfTrueOrPop:
+			{
+				if (stack[stackSize-1].valueBool) { codeIndex += operand; }
+				else { stackSize--; }
+			} break;
+			case DebugExpOp_Add:
+			case DebugExpOp_Subtract:
+			case DebugExpOp_Multiply:
+			case DebugExpOp_Divide:
+			case DebugExpOp_Modulo:
+			{
+				DebugExpValue_t right = stack[--stackSize];
+				DebugExpValue_t* left = &stack[stackSize-1];
+				if (left->type == DebugExpType_Int && right.type == DebugExpType_Int)
+				{
+					if ((op == DebugExpOp_Divide || op == DebugExpOp_Modulo) && right.valueInt == 0)
+					{
+						if (errorStrOut != nullptr) { *errorStrOut = "Integer divide by zero"; }
+						return false;
+					}
+					switch (op)
+					{
+						case DebugExpOp_Add:      left->valueInt += right.valueInt; break;
+						case DebugExpOp_Subtract: left->valueInt -= right.valueInt; break;
+						case DebugExpOp_Multiply: left->valueInt *= right.valueInt; break;
+						case DebugExpOp_Divide:   left->valueInt /= right.valueInt; break;
+						default:                  left->valueInt %= right.valueInt; break;
+					}
+				}
+				else
+				{
+					r64 leftFloat = DebugExpValueAsFloat(*left);
+					r64 rightFloat = DebugExpValueAsFloat(right);
+					switch (op)
+					{
+						case DebugExpOp_Add:      *left = NewDebugExpValueFloat(leftFloat + rightFloat); break;
+						case DebugExpOp_Subtract: *left = NewDebugExpValueFloat(leftFloat - rightFloat); break;
+						case DebugExpOp_Multiply: *left = NewDebugExpValueFloat(leftFloat * rightFloat); break;
+						case DebugExpOp_Divide:   *left = NewDebugExpValueFloat(leftFloat / rightFloat); break;
+						default:                  *left = NewDebugExpValueFloat(ModR64(leftFloat, rightFloat)); break;
+					}
+				}
+			} break;
+			case DebugExpOp_Equal:
+			case DebugExpOp_NotEqual:
+			case DebugExpOp_Less:
+			case DebugExpOp_LessEqual:
+			case DebugExpOp_Greater:
+			case DebugExpOp_GreaterEqual:
+			{
+				DebugExpValue_t right = stack[--stackSize];
+				stack[stackSize-1] = NewDebugExpValueBool(DebugExpCompareValues(op, stack[stackSize-1], right));
+			} break;
+			default:
+			{
+				if (errorStrOut != nullptr) { *errorStrOut = "Invalid op in compiled expression"; }
+				DebugAssert(false);
+				return false;
+			} break;
+		}
+	}
+	
+	if (errorStrOut != nullptr) { *errorStrOut = "Compiled expression is missing its return"; }
+	return false;
+}
+
+MyStr_t DebugExpValueToStr(DebugExpValue_t value, MemArena_t* memArena)
+{
+	switch (value.type)
+	{
+		case DebugExpType_Bool:  return NewStr(value.valueBool ? "true" : "false");
+		case DebugExpType_Int:   return PrintInArenaStr(memArena, "%lld", value.valueInt);
+		case DebugExpType_Float: return PrintInArenaStr(memArena, "%g", value.valueFloat);
+		default: return MyStr_Empty;
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                            Cache                             |
+// +--------------------------------------------------------------+
+DebugExpProgram_t* GetDebugExpProgram(PigDebugExpCache_t* cache, MyStr_t source, MemArena_t* scratch)
+{
+	NotNull2(cache, scratch);
+	GetDebugExpContext(cache, scratch); //makes sure the var slots are filled before we compile anything
+	
+	u64 sourceHash = FnvHashU64(source.chars, source.length);
+	VarArrayLoop(&cache->programs, pIndex)
+	{
+		VarArrayLoopGet(DebugExpProgram_t, program, &cache->programs, pIndex);
+		if (program->sourceHash == sourceHash && StrEquals(program->source, source))
+		{
+			program->lastUseIndex = cache->nextUseIndex++;
+			return program;
+		}
+	}
+	
+	DebugExpProgram_t* result = nullptr;
+	if (cache->programs.length >= DEBUG_EXP_MAX_CACHED_PROGRAMS)
+	{
+		VarArrayLoop(&cache->programs, pIndex)
+		{
+			VarArrayLoopGet(DebugExpProgram_t, program, &cache->programs, pIndex);
+			if (result == nullptr || program->lastUseIndex < result->lastUseIndex) { result = program; }
+		}
+		NotNull(result);
+		FreeDebugExpProgram(cache->allocArena, result);
+		cache->numEvictions++;
+	}
+	else
+	{
+		result = VarArrayAdd(&cache->programs, DebugExpProgram_t);
+		NotNull(result);
+	}
+	
+	CompileDebugExp(cache, source, cache->allocArena, result);
+	result->lastUseIndex = cache->nextUseIndex++;
+	cache->numCompiles++;
+	if (result->isFallback) { cache->numFallbackCompiles++; }
+	return result;
+}
+
+//NOTE: resultStrOut is left empty for expressions that don't produce a value (like most debug commands).
+//      Returns false and fills errorStrOut if the expression is invalid or failed to run
+bool RunDebugExp(PigDebugExpCache_t* cache, MyStr_t source, MemArena_t* scratch, MyStr_t* resultStrOut, MyStr_t* errorStrOut)
+{
+	NotNull4(cache, scratch, resultStrOut, errorStrOut);
+	*resultStrOut = MyStr_Empty;
+	*errorStrOut = MyStr_Empty;
+	
+	VerifyDebugExpVarSlots(cache, scratch);
+	DebugExpProgram_t* program = GetDebugExpProgram(cache, source, scratch);
+	program->numRuns++;
+	if (!program->isFallback)
+	{
+		cache->numVmRuns++;
+		DebugExpValue_t result = {};
+		const char* vmErrorStr = nullptr;
+		if (!RunDebugExpProgram(cache, program, &result, &vmErrorStr))
+		{
+			*errorStrOut = NewStr(vmErrorStr);
+			return false;
+		}
+		*resultStrOut = DebugExpValueToStr(result, scratch);
+		return true;
+	}
+	else
+	{
+		cache->numFallbackRuns++;
+		//The command we run might end up compiling (and evicting) programs of its own so we don't hold onto program past this point
+		MyStr_t sourceCopy = AllocString(scratch, &source);
+		ExpContext_t* context = GetDebugExpContext(cache, scratch);
+		ExpValue_t result = {};
+		*errorStrOut = TryRunExpressionErrorStr(sourceCopy, scratch, &result, context);
+		if (!IsEmptyStr(*errorStrOut)) { return false; }
+		if (result.type != ExpValueType_Void) { *resultStrOut = ExpValueToStr(result, scratch); }
+		return true;
+	}
+}
@@ -0,0 +1,143 @@
+/*
+File:   pig_debug_exp.h
+Date:   10\19\2026
+Description:
+	** Debug console input, key bindings and anything else that evaluates the same expression string over and over
+	** goes through a PigDebugExpCache_t. The first time a string is seen it gets compiled into a DebugExpProgram_t:
+	** a small bytecode with variables already resolved to pointer slots, run by a stack VM. Anything the compiler
+	** doesn't understand (function calls, constants, strings, etc.) is marked as a fallback program and is
+	** handed to the gylib expression evaluator, but against one cached ExpContext_t rather than one built on every call
+*/
+
+#ifndef _PIG_DEBUG_EXP_H
+#define _PIG_DEBUG_EXP_H
+
+#define DEBUG_EXP_MAX_CACHED_PROGRAMS 256
+#define DEBUG_EXP_MAX_STACK_DEPTH     32
+#define DEBUG_EXP_MAX_CONSTANTS       UINT16_MAX
+#define DEBUG_EXP_CONTEXT_PAGE_SIZE   Kilobytes(64)
+
+enum DebugExpType_t
+{
+	DebugExpType_None = 0, //void
+	DebugExpType_Bool,
+	DebugExpType_Int, //i64
+	DebugExpType_Float, //r64
+	DebugExpType_NumTypes,
+};
+const char* GetDebugExpTypeStr(DebugExpType_t type)
+{
+	switch (type)
+	{
+		case DebugExpType_None:  return "None";
+		case DebugExpType_Bool:  return "Bool";
+		case DebugExpType_Int:   return "Int";
+		case DebugExpType_Float: return "Float";
+		default: return "Unknown";
+	}
+}
+
+struct DebugExpValue_t
+{
+	DebugExpType_t type;
+	union
+	{
+		bool valueBool;
+		i64 valueInt;
+		r64 valueFloat;
+	};
+};
+
+//How the variable is actually stored in memory, values are converted to/from DebugExpValue_t on load/store
+enum DebugExpVarType_t
+{
+	DebugExpVarType_U64 = 0,
+	DebugExpVarType_R32,
+	DebugExpVarType_R64,
+	DebugExpVarType_Bool,
+	DebugExpVarType_NumTypes,
+};
+
+struct DebugExpVarSlot_t
+{
+	MyStr_t name; //points at the string literal given at registration, only valid until the dll is reloaded
+	u64 nameHash;
+	DebugExpVarType_t type;
+	bool writeable;
+	void* pntr;
+};
+
+enum DebugExpOp_t
+{
+	DebugExpOp_Return = 0,
+	DebugExpOp_PushConst, //u16 constant index
+	DebugExpOp_LoadVar, //u16 var slot
+	DebugExpOp_StoreVar, //u16 var slot, leaves the stored value on the stack
+	DebugExpOp_Pop,
+	DebugExpOp_Negate,
+	DebugExpOp_Not,
+	DebugExpOp_Add,
+	DebugExpOp_Subtract,
+	DebugExpOp_Multiply,
+	DebugExpOp_Divide,
+	DebugExpOp_Modulo,
+	DebugExpOp_Equal,
+	DebugExpOp_NotEqual,
+	DebugExpOp_Less,
+	DebugExpOp_LessEqual,
+	DebugExpOp_Greater,
+	DebugExpOp_GreaterEqual,
+	DebugExpOp_ToBool,
+	DebugExpOp_JumpIfFalseOrPop, //u16 forward offset, used for &&
+	DebugExpOp_JumpIfTrueOrPop, //u16 forward offset, used for ||
+	DebugExpOp_NumOps,
+};
+
+struct DebugExpProgram_t
+{
+	MyStr_t source;
+	u64 sourceHash;
+	u64 lastUseIndex;
+	u64 numRuns;
+	
+	bool isFallback; //run by the gylib evaluator instead of the VM
+	u64 codeSize;
+	u8* code;
+	u64 numConstants;
+	DebugExpValue_t* constants;
+	u64 maxStackDepth;
+};
+
+struct PigDebugExpCache_t
+{
+	MemArena_t* allocArena;
+	
+	//Rebuilt lazily after every dll load since it's full of pointers into the dll (names, docs, function and variable pointers)
+	//Also rebuilt when pig->currentWindow changes since some variables point into the window's input state.
+	//Variables can also point into app state or other memory that gets freed or moved, so before every RunDebugExp
+	//the variables are registered again into a throwaway context and if any slot's pointer changed the cache is dropped.
+	//That check only sees variables added through PigAddDebugVarXXX, anything added with AddExpVariableDefXXX directly
+	//that points at memory that moves needs an InvalidateDebugExpCache call when it does
+	bool contextBuilt;
+	const PlatWindow_t* contextWindow;
+	MemArena_t contextHeap;
+	ExpContext_t context;
+	ExpContext_t* buildingContext;
+	VarArray_t varSlots; //DebugExpVarSlot_t
+	
+	ExpContext_t* verifyingContext;
+	u64 verifySlotIndex;
+	bool verifyFailed;
+	
+	u64 nextUseIndex;
+	VarArray_t programs; //DebugExpProgram_t
+	
+	u64 numCompiles;
+	u64 numFallbackCompiles;
+	u64 numEvictions;
+	u64 numStaleSlotInvalidations;
+	u64 numVmRuns;
+	u64 numFallbackRuns;
+};
+
+#endif //  _PIG_DEBUG_EXP_H
@@ -147,6 +147,9 @@ void UpdatePigDebugOverlay(PigDebugOverlay_t* overlay)
 		if (KeyPressed(Key_7)) { HandleKey(Key_7); overlay->easingFuncsEnabled     = !overlay->easingFuncsEnabled;     overlay->hotkeyPlusNumberPressed = true; overlay->lastMouseCloseTime = ProgramTime; }
 		if (KeyPressed(Key_8)) { HandleKey(Key_8); overlay->controllerDebugEnabled = !overlay->controllerDebugEnabled; overlay->hotkeyPlusNumberPressed = true; overlay->lastMouseCloseTime = ProgramTime; }
 		if (KeyPressed(Key_9)) { HandleKey(Key_9); pig->imgui.launcherIsOpen       = !pig->imgui.launcherIsOpen;       overlay->hotkeyPlusNumberPressed = true; overlay->lastMouseCloseTime = ProgramTime; }
+		#if PIG_PROFILER
+		if (KeyPressed(Key_0)) { HandleKey(Key_0); pig->profiler.showOverlay       = !pig->profiler.showOverlay;       overlay->hotkeyPlusNumberPressed = true; overlay->lastMouseCloseTime = ProgramTime; }
+		#endif
 		
 		if (KeyPressed(Key_Num1)) { HandleKey(Key_Num1); overlay->debugReadoutsEnabled   = !overlay->debugReadoutsEnabled;   overlay->hotkeyPlusNumberPressed = true; overlay->lastMouseCloseTime = ProgramTime; }
 		if (KeyPressed(Key_Num2)) { HandleKey(Key_Num2); pig->perfGraph.enabled          = !pig->perfGraph.enabled;          overlay->hotkeyPlusNumberPressed = true; overlay->lastMouseCloseTime = ProgramTime; }
@@ -157,6 +160,9 @@ void UpdatePigDebugOverlay(PigDebugOverlay_t* overlay)
 		if (KeyPressed(Key_Num7)) { HandleKey(Key_Num7); overlay->easingFuncsEnabled     = !overlay->easingFuncsEnabled;     overlay->hotkeyPlusNumberPressed = true; overlay->lastMouseCloseTime = ProgramTime; }
 		if (KeyPressed(Key_Num8)) { HandleKey(Key_Num8); overlay->controllerDebugEnabled = !overlay->controllerDebugEnabled; overlay->hotkeyPlusNumberPressed = true; overlay->lastMouseCloseTime = ProgramTime; }
 		if (KeyPressed(Key_Num9)) { HandleKey(Key_Num9); pig->imgui.launcherIsOpen       = !pig->imgui.launcherIsOpen;       overlay->hotkeyPlusNumberPressed = true; overlay->lastMouseCloseTime = ProgramTime; }
+		#if PIG_PROFILER
+		if (KeyPressed(Key_Num0)) { HandleKey(Key_Num0); pig->profiler.showOverlay       = !pig->profiler.showOverlay;       overlay->hotkeyPlusNumberPressed = true; overlay->lastMouseCloseTime = ProgramTime; }
+		#endif
 	}
 	
 	// +==============================+
@@ -628,7 +634,7 @@ void RenderPigDebugOverlay(PigDebugOverlay_t* overlay)
 			
 			if (pig->mouseHit.priority > 0)
 			{
-				RcDrawTextPrintWithBackground(textPos, MonokaiWhite, backgroundColor, backgroundPadding, "Mouse Hit: \"\b%.*s\b\" (priority %llu, %p)", StrPrint(pig->mouseHit.name), pig->mouseHit.priority, pig->mouseHit.pntr);
+				RcDrawTextPrintWithBackground(textPos, MonokaiWhite, backgroundColor, backgroundPadding, "Mouse Hit: \"\b%.*s\b\" (priority %llu, %p, id %016llX)", StrPrint(GetMouseHitName(&pig->mouseHit)), pig->mouseHit.priority, pig->mouseHit.pntr, pig->mouseHit.id);
 				textPos.y += stepY;
 			}
 			else
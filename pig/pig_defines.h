@@ -56,8 +56,19 @@ Description:
 #define PIG_DOUBLE_CLICK_TIME         400 //ms TODO: Does this need any tuning? Is there a common accepted value?
 #define PIG_DOUBLE_CLICK_MAX_DIST     5 //px TODO: Does this need any tuning? Is there a common accepted value?
 
-#define GIF_FRAMERATE  50   //fps
-#define MAX_GIF_SIZE   Gigabytes(1) //frames (1920x1080@50fps that's about 2.5 seconds, but can be like 40 seconds for small-ish sub-rects)
+#define GIF_FRAMERATE                 50   //fps
+#define MAX_GIF_SIZE                  Gigabytes(1) //encoded bytes written to the output file
+#define GIF_MAX_FRAMES_IN_FLIGHT      8 //frames (captured but not yet written, further frames are dropped until the encoder catches up)
+
+#define PIG_FONT_DYNAMIC_ATLAS        1 //when 0 every face bakes its full Latin/Cyrillic/Kana ranges at load time
+#define PIG_COOKED_TEXTURES           1 //when 1 single layer texture resources load from .ptex files (cooked on first load in developer builds)
+#define PIG_TEXTURE_ATLAS             1 //when 1 small texture resources marked atlasable are packed into shared pages (see pig_texture_atlas.h)
+#define PIG_MOUSE_HIT_GRID            0 //when 1 MouseHitRec rectangles are recorded in a per-frame grid so a lower priority item can't win just because it was updated before a higher priority one (see MouseHitGrid_t)
+#define PIG_RENDER_CMD_RECORDING      DEVELOPER_BUILD //when 0 render commands are still counted in RenderCmdStats_t but aren't kept in the buffer, so render_dump has nothing to write
+#define PIG_PROFILER                  (DEVELOPER_BUILD && !WASM_COMPILATION) //when 0 PigProfileBegin/PigProfileEnd compile to nothing (see pig_profiler.h)
+#define PIG_MEM_TRACKING              (DEVELOPER_BUILD && !WASM_COMPILATION) //when 1 AllocMem/FreeMem/ReallocMem are routed through the allocation tracker (see pig_mem_tracker.h), when 0 they call gylib directly
+#define PIG_SHADER_BINARY_CACHE       (!WASM_COMPILATION) //when 1 linked OpenGL programs are saved to the SavesAndSettings folder and loaded back with glProgramBinary if the source and driver haven't changed
+#define PIG_ASSET_PACK                (WINDOWS_COMPILATION || LINUX_COMPILATION) //when 1 a Resources.pak next to the executable is opened at startup and file reads are served from it (see pig_asset_pack.h)
 
 #define PIG_WINDOW_MIN_SIZE   NewVec2i(400, 100)
 
@@ -28,20 +28,24 @@ void PigInitGlad()
 }
 
 // +==============================+
-// |       Pig_GetTempArena       |
+// |     Pig_LookupTempArena      |
 // +==============================+
-GYLIB_GET_TEMP_ARENA_DEF(Pig_GetTempArena)
+//NOTE: This is the slow path, it compares thread ids and (for anything other than the main thread) has the platform search its thread pool
+MemArena_t* Pig_LookupTempArena(bool* isDefinitiveOut)
 {
+	*isDefinitiveOut = false;
 	if (plat == nullptr) { return nullptr; }
 	if (pig == nullptr) { return nullptr; }
 	ThreadId_t thisThreadId = plat->GetThisThreadId();
 	if (thisThreadId == pig->mainThreadId)
 	{
+		*isDefinitiveOut = (pig->tempArena.size > 0);
 		return &pig->tempArena;
 	}
 	#if PROCMON_SUPPORTED
 	else if (thisThreadId == pig->procmonThreadId)
 	{
+		//procmonTempArena gets swapped out as events come in so we don't hold onto it
 		return pig->procmonTempArena;
 	}
 	#endif
@@ -50,12 +54,40 @@ GYLIB_GET_TEMP_ARENA_DEF(Pig_GetTempArena)
 		PlatThreadPoolThread_t* threadContext = plat->GetThreadContext(thisThreadId);
 		if (threadContext != nullptr && threadContext->tempArena.size > 0)
 		{
+			*isDefinitiveOut = true;
 			return &threadContext->tempArena;
 		}
-		else { return nullptr; }
+		else
+		{
+			//Audio, file watching, etc. threads never get a temp arena. We can only be sure of that once the main thread id is known
+			*isDefinitiveOut = (pig->initialized);
+			return nullptr;
+		}
 	}
 }
 
+// +==============================+
+// |       Pig_GetTempArena       |
+// +==============================+
+//NOTE: These live in the engine dll so a reload gives us a fresh (unbound) copy on every thread. Each thread binds itself
+//      the first time it asks for its temp arena and after that TempPushMark, TempPrint, etc. are just a thread local read.
+//      pig is part of the binding so a re-initialize (new PigState_t) also forces threads to look themselves up again
+thread_local PigState_t* Pig_ThisThreadBoundPig = nullptr;
+thread_local MemArena_t* Pig_ThisThreadTempArena = nullptr;
+
+GYLIB_GET_TEMP_ARENA_DEF(Pig_GetTempArena)
+{
+	if (Pig_ThisThreadBoundPig != nullptr && Pig_ThisThreadBoundPig == pig) { return Pig_ThisThreadTempArena; }
+	bool isDefinitive = false;
+	MemArena_t* result = Pig_LookupTempArena(&isDefinitive);
+	if (isDefinitive)
+	{
+		Pig_ThisThreadBoundPig = pig;
+		Pig_ThisThreadTempArena = result;
+	}
+	return result;
+}
+
 // gy_threading implementations (required when defining GYLIB_THREADING_ENABLED)
 void InitGyMutex(GyMutex_t* mutex)
 {
@@ -133,7 +165,12 @@ void PigEntryPoint(PigEntryPoint_t entryPoint, const StartupInfo_t* startupInfo,
 	startup = startupInfo;
 	pigEntryPoint = entryPoint;
 	platInfo = info;
+	#if PIG_ASSET_PACK
+	//Thread pool threads can be reading plat at any time, so once the asset pack has hooked it we don't flip it back to the real api (see UpdateAssetPackHook)
+	if (!IsPlatHookedByAssetPack(api)) { plat = api; }
+	#else
 	plat = api;
+	#endif
 	pigIn = input;
 	pigOut = output;
 	#if GAME_USES_FUNC_TABLE
@@ -157,6 +194,9 @@ void PigEntryPoint(PigEntryPoint_t entryPoint, const StartupInfo_t* startupInfo,
 		logGlobals = &pig->logGlobals;
 		pig->logGlobals.getPreciseProgramTime = LogGlobals_GetPreciseProgramTime;
 		pig->logGlobals.getThreadNumber = LogGlobals_GetThreadNumber;
+		#if PIG_ASSET_PACK
+		UpdateAssetPackHook(&pig->assetPack, api, (entryPoint == PigEntryPoint_PostReload));
+		#endif
 	}
 	else
 	{
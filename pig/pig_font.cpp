@@ -10,12 +10,15 @@ Description:
 #define DEFAULT_UNDERLINE_OFFSET     2 //px
 #define DEFAULT_UNDERLINE_THICKNESS  1 //px
 
+#include "pig_font_shaders.cpp"
+
 // +--------------------------------------------------------------+
 // |                Creation/Destruction Functions                |
 // +--------------------------------------------------------------+
 void DestroyFont(Font_t* font)
 {
 	NotNull(font);
+	TextLayoutCacheEvictFont(font);
 	if (font->faces.length > 0)
 	{
 		NotNull(font->allocArena);
@@ -34,6 +37,11 @@ void DestroyFont(Font_t* font)
 				FreeVarArray(&bake->ranges);
 			}
 			FreeVarArray(&face->bakes);
+			if (face->atlas != nullptr)
+			{
+				FreeFontGlyphAtlas(face->atlas);
+				FreeMem(font->allocArena, face->atlas, sizeof(FontGlyphAtlas_t));
+			}
 		}
 	}
 	FreeVarArray(&font->faces);
@@ -367,6 +375,837 @@ void MakeFontFaceDefault(Font_t* font, FontFace_t* face)
 
 //TODO: Add some functions that help us create font faces from custom bitmap font files or from local .ttf files rather than platform provided file lookups
 
+// +--------------------------------------------------------------+
+// |                  Signed Distance Field Bakes                 |
+// +--------------------------------------------------------------+
+#define FONT_SDF_INFINITY 1e20
+
+//One dimensional squared distance transform (Felzenszwalb & Huttenlocher) over length values in grid, starting at offset and stepping by stride.
+//f, v and z are scratch space for at least length, length and length+1 values
+void FontSdfTransform1D(r64* grid, u64 offset, u64 stride, i32 length, r64* f, i32* v, r64* z)
+{
+	for (i32 q = 0; q < length; q++) { f[q] = grid[offset + ((u64)q * stride)]; }
+	v[0] = 0;
+	z[0] = -FONT_SDF_INFINITY;
+	z[1] = FONT_SDF_INFINITY;
+	i32 k = 0;
+	for (i32 q = 1; q < length; q++)
+	{
+		r64 s = 0;
+		do
+		{
+			i32 r = v[k];
+			s = ((f[q] + (r64)(q*q)) - (f[r] + (r64)(r*r))) / (r64)(2 * (q - r));
+		} while (s <= z[k] && --k > -1);
+		k++;
+		v[k] = q;
+		z[k] = s;
+		z[k+1] = FONT_SDF_INFINITY;
+	}
+	k = 0;
+	for (i32 q = 0; q < length; q++)
+	{
+		while (z[k+1] < (r64)q) { k++; }
+		i32 r = v[k];
+		grid[offset + ((u64)q * stride)] = f[r] + (r64)((q - r) * (q - r));
+	}
+}
+void FontSdfTransform2D(r64* grid, v2i size, r64* f, i32* v, r64* z)
+{
+	for (i32 x = 0; x < size.width; x++) { FontSdfTransform1D(grid, (u64)x, (u64)size.width, size.height, f, v, z); }
+	for (i32 y = 0; y < size.height; y++) { FontSdfTransform1D(grid, (u64)(y * size.width), 1, size.width, f, v, z); }
+}
+
+//Turns the coverage of a single glyph into a distance field in a cell that has spread pixels of padding on every side.
+//Partially covered pixels seed the transform with how far the 50% coverage edge is from their center, so the rasterizer's
+//anti-aliasing gives us sub-pixel edge positions. The edge lands on 128, spread pixels outside is 0 and spread pixels inside is 255
+void FontSdfGenerateGlyph(const u8* coverage, u64 coverageRowSize, v2i glyphSize, i32 spread, u8* cellPixels, u64 cellRowSize, r64* gridOuter, r64* gridInner, r64* f, i32* v, r64* z)
+{
+	v2i cellSize = glyphSize + NewVec2i(spread*2, spread*2);
+	for (i32 pIndex = 0; pIndex < cellSize.width * cellSize.height; pIndex++)
+	{
+		gridOuter[pIndex] = FONT_SDF_INFINITY;
+		gridInner[pIndex] = 0;
+	}
+	for (i32 yPos = 0; yPos < glyphSize.height; yPos++)
+	{
+		for (i32 xPos = 0; xPos < glyphSize.width; xPos++)
+		{
+			r64 alpha = (r64)coverage[((u64)yPos * coverageRowSize) + (u64)xPos] / 255.0;
+			if (alpha <= 0.0) { continue; }
+			i32 cellIndex = ((yPos + spread) * cellSize.width) + (xPos + spread);
+			if (alpha >= 1.0)
+			{
+				gridOuter[cellIndex] = 0;
+				gridInner[cellIndex] = FONT_SDF_INFINITY;
+			}
+			else
+			{
+				r64 edgeDistance = 0.5 - alpha;
+				gridOuter[cellIndex] = (edgeDistance > 0) ? (edgeDistance * edgeDistance) : 0;
+				gridInner[cellIndex] = (edgeDistance < 0) ? (edgeDistance * edgeDistance) : 0;
+			}
+		}
+	}
+	
+	FontSdfTransform2D(gridOuter, cellSize, f, v, z);
+	FontSdfTransform2D(gridInner, cellSize, f, v, z);
+	
+	for (i32 yPos = 0; yPos < cellSize.height; yPos++)
+	{
+		u8* cellRow = &cellPixels[(u64)yPos * cellRowSize];
+		for (i32 xPos = 0; xPos < cellSize.width; xPos++)
+		{
+			i32 cellIndex = (yPos * cellSize.width) + xPos;
+			r64 distance = SqrtR64(gridOuter[cellIndex]) - SqrtR64(gridInner[cellIndex]); //positive outside the glyph
+			r64 value = ClampR64(0.5 - (distance / (r64)(spread * 2)), 0.0, 1.0);
+			cellRow[xPos] = (u8)RoundR64i(value * 255.0);
+		}
+	}
+}
+
+//Simple row packing, the glyphs come in codepoint order so neighbors tend to have similar heights anyway
+bool FontSdfPackCells(const PlatFontData_t* fontData, i32 spread, v2i bakeSize, reci* cellRecsOut, v2i* maxCellSizeOut)
+{
+	NotNull2(fontData, cellRecsOut);
+	i32 cursorX = 0;
+	i32 cursorY = 0;
+	i32 rowHeight = 0;
+	v2i maxCellSize = Vec2i_Zero;
+	for (u64 cIndex = 0; cIndex < fontData->numChars; cIndex++)
+	{
+		v2i glyphSize = fontData->charData[cIndex].sourceRec.size;
+		if (glyphSize.width <= 0 || glyphSize.height <= 0) { cellRecsOut[cIndex] = Reci_Zero; continue; }
+		v2i cellSize = glyphSize + NewVec2i(spread*2, spread*2);
+		if (cellSize.width > bakeSize.width) { return false; }
+		if (cursorX + cellSize.width > bakeSize.width)
+		{
+			cursorX = 0;
+			cursorY += rowHeight;
+			rowHeight = 0;
+		}
+		if (cursorY + cellSize.height > bakeSize.height) { return false; }
+		cellRecsOut[cIndex] = NewReci(cursorX, cursorY, cellSize.width, cellSize.height);
+		cursorX += cellSize.width;
+		rowHeight = MaxI32(rowHeight, cellSize.height);
+		maxCellSize.width = MaxI32(maxCellSize.width, cellSize.width);
+		maxCellSize.height = MaxI32(maxCellSize.height, cellSize.height);
+	}
+	if (maxCellSizeOut != nullptr) { *maxCellSizeOut = maxCellSize; }
+	return true;
+}
+
+//NOTE: Works like FontAddBakeToActiveFace but the ranges are rasterized at rasterSize and each glyph's coverage is turned into a
+//      distance field (see FontSdfGenerateGlyph). One of these bakes can be drawn at any size with rc->fontSdfShader so a single
+//      face can replace a set of faces that only differ in fontSize. The bitmap starts at FONT_SDF_MIN_BAKE_SIZE and doubles until
+//      every glyph fits, up to maxBakeSize. Char metrics stay in raster pixels, multiply them by bake->rasterScale to get face units
+FontBake_t* FontAddSdfBakeToActiveFace(Font_t* font, FontFace_t* face, i32 rasterSize, i32 spread, v2i maxBakeSize, u64 numRanges, const PlatFontRange_t* ranges)
+{
+	NotNull(font);
+	NotNull(font->allocArena);
+	NotNull(face);
+	DebugAssert(VarArrayContains(&font->faces, face));
+	Assert(IsFlagSet(face->flags, FontFaceFlag_IsActive));
+	Assert(rasterSize > 0 && spread > 0);
+	Assert(maxBakeSize.width > 0 && maxBakeSize.height > 0);
+	Assert(numRanges > 0);
+	NotNull(ranges);
+	
+	FontBake_t* result = VarArrayAdd(&face->bakes, FontBake_t);
+	NotNull(result);
+	ClearPointer(result);
+	result->bakeIndex = (face->bakes.length - 1);
+	CreateVarArray(&result->ranges, font->allocArena, sizeof(FontRange_t), numRanges);
+	result->flags = FontBakeFlag_IsSdf;
+	result->rasterScale = (r32)face->fontSize / (r32)rasterSize;
+	
+	MemArena_t* scratch = GetScratchArena();
+	PlatFontRange_t* rasterRanges = AllocArray(scratch, PlatFontRange_t, numRanges);
+	NotNull(rasterRanges);
+	u32 newFaceMinCodepoint = face->minCodepoint;
+	u32 newFaceMaxCodepoint = face->maxCodepoint;
+	for (u64 rIndex = 0; rIndex < numRanges; rIndex++)
+	{
+		const PlatFontRange_t* inRange = &ranges[rIndex];
+		MyMemCopy(&rasterRanges[rIndex], inRange, sizeof(PlatFontRange_t));
+		rasterRanges[rIndex].fontSize = (float)rasterSize;
+		
+		FontRange_t* range = VarArrayAdd(&result->ranges, FontRange_t);
+		NotNull(range);
+		range->rangeIndex = (result->ranges.length - 1);
+		range->contiguous = (inRange->codePointList == nullptr);
+		if (range->contiguous)
+		{
+			range->minCodepoint = inRange->firstCodepoint;
+			range->maxCodepoint = inRange->firstCodepoint + inRange->numChars;
+		}
+		else
+		{
+			range->minCodepoint = UINT32_MAX;
+			range->maxCodepoint = UINT32_MAX;
+			for (u64 cIndex = 0; cIndex < inRange->numChars; cIndex++)
+			{
+				u32 codepoint = inRange->codePointList[cIndex];
+				Assert(codepoint < UINT32_MAX);
+				if (codepoint < range->minCodepoint || range->minCodepoint == UINT32_MAX) { range->minCodepoint = codepoint; }
+				if (codepoint >= range->maxCodepoint || range->maxCodepoint == UINT32_MAX) { range->maxCodepoint = codepoint+1; }
+			}
+		}
+		if (range->minCodepoint < newFaceMinCodepoint || newFaceMinCodepoint == UINT32_MAX) { newFaceMinCodepoint = range->minCodepoint; }
+		if (range->maxCodepoint > newFaceMaxCodepoint || newFaceMaxCodepoint == UINT32_MAX) { newFaceMaxCodepoint = range->maxCodepoint; }
+		CreateVarArray(&range->charInfos, font->allocArena, sizeof(FontCharInfo_t), inRange->numChars);
+	}
+	
+	// +==============================+
+	// |      Rasterize Coverage      |
+	// +==============================+
+	PlatFontData_t fontData = {};
+	if (!plat->BakeFont(&face->fontFile, maxBakeSize, false, numRanges, rasterRanges, &fontData, nullptr))
+	{
+		FreeScratchArena(scratch);
+		MyDebugBreak();
+		font->hasFailures = true;
+		FlagUnset(face->flags, FontFaceFlag_IsValid);
+		return result;
+	}
+	
+	// +==============================+
+	// |      Pack Padded Glyphs      |
+	// +==============================+
+	reci* cellRecs = AllocArray(scratch, reci, MaxU64(fontData.numChars, 1));
+	NotNull(cellRecs);
+	v2i bakeSize = NewVec2i(MinI32(FONT_SDF_MIN_BAKE_SIZE, maxBakeSize.width), MinI32(FONT_SDF_MIN_BAKE_SIZE, maxBakeSize.height));
+	v2i maxCellSize = Vec2i_Zero;
+	while (!FontSdfPackCells(&fontData, spread, bakeSize, cellRecs, &maxCellSize))
+	{
+		if (bakeSize.width >= maxBakeSize.width && bakeSize.height >= maxBakeSize.height)
+		{
+			PrintLine_E("Failed to fit %llu SDF glyph%s at %d into a %dx%d bake", fontData.numChars, Plural(fontData.numChars, "s"), rasterSize, maxBakeSize.width, maxBakeSize.height);
+			plat->FreeFontData(&fontData);
+			FreeScratchArena(scratch);
+			MyDebugBreak();
+			font->hasFailures = true;
+			FlagUnset(face->flags, FontFaceFlag_IsValid);
+			return result;
+		}
+		if (bakeSize.width <= bakeSize.height && bakeSize.width < maxBakeSize.width) { bakeSize.width = MinI32(bakeSize.width * 2, maxBakeSize.width); }
+		else if (bakeSize.height < maxBakeSize.height) { bakeSize.height = MinI32(bakeSize.height * 2, maxBakeSize.height); }
+		else { bakeSize.width = MinI32(bakeSize.width * 2, maxBakeSize.width); }
+	}
+	
+	// +==============================+
+	// |    Generate Distance Field   |
+	// +==============================+
+	PlatImageData_t imageData = {};
+	imageData.size = bakeSize;
+	imageData.pixelSize = sizeof(u8);
+	imageData.rowSize = (u64)bakeSize.width;
+	imageData.dataSize = (u64)(bakeSize.width * bakeSize.height);
+	imageData.data8 = AllocArray(scratch, u8, imageData.dataSize);
+	NotNull(imageData.data8);
+	MyMemSet(imageData.data8, 0x00, imageData.dataSize);
+	
+	u64 maxCellArea = MaxU64((u64)(maxCellSize.width * maxCellSize.height), 1);
+	i32 maxCellLength = MaxI32(MaxI32(maxCellSize.width, maxCellSize.height), 1);
+	r64* gridOuter = AllocArray(scratch, r64, maxCellArea);
+	r64* gridInner = AllocArray(scratch, r64, maxCellArea);
+	r64* transformF = AllocArray(scratch, r64, (u64)maxCellLength);
+	i32* transformV = AllocArray(scratch, i32, (u64)maxCellLength);
+	r64* transformZ = AllocArray(scratch, r64, (u64)maxCellLength + 1);
+	NotNull3(gridOuter, gridInner, transformF);
+	NotNull2(transformV, transformZ);
+	for (u64 cIndex = 0; cIndex < fontData.numChars; cIndex++)
+	{
+		reci cellRec = cellRecs[cIndex];
+		if (cellRec.width <= 0 || cellRec.height <= 0) { continue; }
+		reci sourceRec = fontData.charData[cIndex].sourceRec;
+		FontSdfGenerateGlyph(
+			&fontData.imageData.data8[((u64)sourceRec.y * fontData.imageData.rowSize) + (u64)sourceRec.x], fontData.imageData.rowSize,
+			sourceRec.size, spread,
+			&imageData.data8[((u64)cellRec.y * imageData.rowSize) + (u64)cellRec.x], imageData.rowSize,
+			gridOuter, gridInner, transformF, transformV, transformZ
+		);
+	}
+	
+	if (!CreateTexture(font->allocArena, &result->bitmap, &imageData, false, false))
+	{
+		plat->FreeFontData(&fontData);
+		FreeScratchArena(scratch);
+		MyDebugBreak();
+		font->hasFailures = true;
+		FlagUnset(face->flags, FontFaceFlag_IsValid);
+		return result;
+	}
+	
+	// +==============================+
+	// |       Fill Char Infos        |
+	// +==============================+
+	u64 charInfoIndex = 0;
+	for (u64 rIndex = 0; rIndex < numRanges; rIndex++)
+	{
+		const PlatFontRange_t* inRange = &ranges[rIndex];
+		FontRange_t* range = VarArrayGet(&result->ranges, rIndex, FontRange_t);
+		for (u32 cIndex = 0; cIndex < inRange->numChars; cIndex++)
+		{
+			u32 codepoint = (inRange->codePointList != nullptr) ? (inRange->codePointList[cIndex]) : (inRange->firstCodepoint + cIndex);
+			Assert(charInfoIndex < fontData.numChars);
+			PlatFontCharData_t* platCharInfo = &fontData.charData[charInfoIndex];
+			Assert(platCharInfo->codepoint == codepoint);
+			
+			FontCharInfo_t* charInfo = VarArrayAdd(&range->charInfos, FontCharInfo_t);
+			NotNull(charInfo);
+			ClearPointer(charInfo);
+			charInfo->charIndex = (range->charInfos.length - 1);
+			charInfo->codepoint = codepoint;
+			
+			//The source rec covers the padding so the outside of the distance field gets drawn too
+			charInfo->sourceRec = cellRecs[charInfoIndex];
+			charInfo->logicalOffset = platCharInfo->offset;
+			charInfo->logicalSize = ToVec2(platCharInfo->sourceRec.size);
+			charInfo->renderOffset = platCharInfo->offset - NewVec2((r32)spread, (r32)spread);
+			charInfo->advanceX = platCharInfo->advanceX;
+			
+			//Face metrics are in face units and don't include the padding
+			if (charInfo->logicalSize.width > 0 && charInfo->logicalSize.height > 0)
+			{
+				r32 maxAscend = MaxR32(0, -charInfo->logicalOffset.y) * result->rasterScale;
+				r32 maxDescend = MaxR32(0, charInfo->logicalOffset.y + charInfo->logicalSize.height) * result->rasterScale;
+				r32 lineHeight = maxAscend + maxDescend;
+				if (maxAscend  > face->maxAscend)  { face->maxAscend  = maxAscend;  }
+				if (maxDescend > face->maxDescend) { face->maxDescend = maxDescend; }
+				if (lineHeight > face->lineHeight) { face->lineHeight = lineHeight; }
+				if (maxAscend  > face->renderMaxAscend)  { face->renderMaxAscend  = maxAscend;  }
+				if (maxDescend > face->renderMaxDescend) { face->renderMaxDescend = maxDescend; }
+				if (lineHeight > face->renderLineHeight) { face->renderLineHeight = lineHeight; }
+			}
+			
+			charInfoIndex++;
+		}
+	}
+	
+	plat->FreeFontData(&fontData);
+	FreeScratchArena(scratch);
+	
+	face->minCodepoint = newFaceMinCodepoint;
+	face->maxCodepoint = newFaceMaxCodepoint;
+	
+	FlagSet(face->flags, FontFaceFlag_IsSdf);
+	FlagSet(result->flags, FontBakeFlag_IsValid);
+	return result;
+}
+
+// +--------------------------------------------------------------+
+// |                     Dynamic Glyph Atlas                      |
+// +--------------------------------------------------------------+
+void FreeFontGlyphAtlas(FontGlyphAtlas_t* atlas)
+{
+	NotNull(atlas);
+	NotNull(atlas->allocArena);
+	for (u64 pIndex = 0; pIndex < atlas->numPages; pIndex++)
+	{
+		FontAtlasPage_t* page = &atlas->pages[pIndex];
+		DestroyTexture(&page->bake.bitmap);
+		VarArrayLoop(&page->bake.ranges, rIndex)
+		{
+			VarArrayLoopGet(FontRange_t, range, &page->bake.ranges, rIndex);
+			FreeVarArray(&range->charInfos);
+		}
+		FreeVarArray(&page->bake.ranges);
+		if (page->pixels != nullptr) { FreeMem(atlas->allocArena, page->pixels, (u64)(page->size.width * page->size.height)); }
+	}
+	if (atlas->hashSlots != nullptr) { FreeMem(atlas->allocArena, atlas->hashSlots, sizeof(FontAtlasGlyphSlot_t) * atlas->hashCapacity); }
+	FreeVarArray(&atlas->missingCodepoints);
+	FreeVarArray(&atlas->pendingCodepoints);
+	plat->FreeFileContents(&atlas->fontFile);
+	plat->FreeFileContents(&atlas->fallbackFontFile);
+	ClearPointer(atlas);
+}
+
+//NOTE: Takes ownership of the face's font file so glyphs can keep being rasterized after FontFinishFace.
+//      Any bakes added to the face before or after this are still checked first, so the usual pattern is to bake ASCII up front.
+//      Codepoints the font doesn't have draw as the invalid-char box unless drawNotdef is true, in which case they draw as the font's .notdef glyph
+bool FontEnableDynamicAtlas(Font_t* font, FontFace_t* face, v2i pageSize, bool drawNotdef = false)
+{
+	NotNull(font);
+	NotNull(font->allocArena);
+	NotNull(face);
+	DebugAssert(VarArrayContains(&font->faces, face));
+	Assert(IsFlagSet(face->flags, FontFaceFlag_IsActive));
+	Assert(face->atlas == nullptr);
+	Assert(pageSize.width > 0 && pageSize.height > 0);
+	if (face->fontFile.data == nullptr) { return false; }
+	
+	FontGlyphAtlas_t* atlas = AllocStruct(font->allocArena, FontGlyphAtlas_t);
+	NotNull(atlas);
+	ClearPointer(atlas);
+	atlas->allocArena = font->allocArena;
+	atlas->fontFile = face->fontFile;
+	ClearStruct(face->fontFile);
+	atlas->fallbackMinCodepoint = UINT32_MAX;
+	atlas->pageSize = pageSize;
+	atlas->drawNotdef = drawNotdef;
+	atlas->rasterSize = NewVec2i(face->fontSize*2 + 4, face->fontSize*2 + 4);
+	atlas->hashCapacity = FONT_ATLAS_MIN_HASH_CAPACITY;
+	atlas->hashSlots = AllocArray(font->allocArena, FontAtlasGlyphSlot_t, atlas->hashCapacity);
+	NotNull(atlas->hashSlots);
+	MyMemSet(atlas->hashSlots, 0x00, sizeof(FontAtlasGlyphSlot_t) * atlas->hashCapacity);
+	CreateVarArray(&atlas->missingCodepoints, font->allocArena, sizeof(u32));
+	CreateVarArray(&atlas->pendingCodepoints, font->allocArena, sizeof(u32));
+	face->atlas = atlas;
+	return true;
+}
+
+//Codepoints at or above minCodepoint get rasterized from this font instead (useful for CJK characters that the main font doesn't have)
+bool FontSetAtlasFallbackFont(FontFace_t* face, MyStr_t fontName, u32 minCodepoint)
+{
+	NotNull(face);
+	NotNull(face->atlas);
+	NotNullStr(&fontName);
+	PlatFileContents_t newFontFile = {};
+	if (!plat->ReadPlatformFont(fontName, face->fontSize, IsFlagSet(face->flags, FontFaceFlag_IsBold), IsFlagSet(face->flags, FontFaceFlag_IsItalic), nullptr, &newFontFile))
+	{
+		PrintLine_E("Failed to open platform font file by name \"%.*s\" for glyph atlas fallback", StrPrint(fontName));
+		return false;
+	}
+	plat->FreeFileContents(&face->atlas->fallbackFontFile);
+	face->atlas->fallbackFontFile = newFontFile;
+	face->atlas->fallbackMinCodepoint = minCodepoint;
+	return true;
+}
+
+u64 FontAtlasHashCodepoint(u32 codepoint, u64 hashCapacity)
+{
+	return (((u64)codepoint * 2654435761ULL) & (hashCapacity - 1));
+}
+FontAtlasGlyphSlot_t* FontAtlasFindSlot(FontGlyphAtlas_t* atlas, u32 codepoint)
+{
+	NotNull(atlas);
+	Assert(codepoint != 0);
+	u64 slotIndex = FontAtlasHashCodepoint(codepoint, atlas->hashCapacity);
+	for (u64 probe = 0; probe < atlas->hashCapacity; probe++)
+	{
+		FontAtlasGlyphSlot_t* slot = &atlas->hashSlots[slotIndex];
+		if (slot->codepoint == codepoint) { return slot; }
+		if (slot->codepoint == 0) { return nullptr; }
+		slotIndex = ((slotIndex + 1) & (atlas->hashCapacity - 1));
+	}
+	return nullptr;
+}
+void FontAtlasInsertSlot(FontGlyphAtlas_t* atlas, u32 codepoint, u32 pageIndex, u64 charIndex)
+{
+	NotNull(atlas);
+	Assert(codepoint != 0);
+	Assert(atlas->numUsedSlots < atlas->hashCapacity/2);
+	u64 slotIndex = FontAtlasHashCodepoint(codepoint, atlas->hashCapacity);
+	while (atlas->hashSlots[slotIndex].codepoint != 0)
+	{
+		DebugAssert(atlas->hashSlots[slotIndex].codepoint != codepoint);
+		slotIndex = ((slotIndex + 1) & (atlas->hashCapacity - 1));
+	}
+	atlas->hashSlots[slotIndex].codepoint = codepoint;
+	atlas->hashSlots[slotIndex].pageIndex = pageIndex;
+	atlas->hashSlots[slotIndex].charIndex = charIndex;
+	atlas->numUsedSlots++;
+	if (pageIndex < FONT_ATLAS_PENDING_PAGE) { atlas->numGlyphs++; }
+}
+//Called after a page is evicted, when the table needs to grow, or when pending codepoints need to be dropped
+void FontAtlasRebuildHash(FontGlyphAtlas_t* atlas, u64 minNumSlots)
+{
+	NotNull(atlas);
+	u64 newCapacity = FONT_ATLAS_MIN_HASH_CAPACITY;
+	while (newCapacity < minNumSlots*2 + 1) { newCapacity *= 2; }
+	if (newCapacity != atlas->hashCapacity)
+	{
+		FreeMem(atlas->allocArena, atlas->hashSlots, sizeof(FontAtlasGlyphSlot_t) * atlas->hashCapacity);
+		atlas->hashCapacity = newCapacity;
+		atlas->hashSlots = AllocArray(atlas->allocArena, FontAtlasGlyphSlot_t, atlas->hashCapacity);
+		NotNull(atlas->hashSlots);
+	}
+	MyMemSet(atlas->hashSlots, 0x00, sizeof(FontAtlasGlyphSlot_t) * atlas->hashCapacity);
+	atlas->numUsedSlots = 0;
+	atlas->numGlyphs = 0;
+	for (u64 pIndex = 0; pIndex < atlas->numPages; pIndex++)
+	{
+		FontRange_t* range = VarArrayGet(&atlas->pages[pIndex].bake.ranges, 0, FontRange_t);
+		VarArrayLoop(&range->charInfos, cIndex)
+		{
+			VarArrayLoopGet(FontCharInfo_t, charInfo, &range->charInfos, cIndex);
+			FontAtlasInsertSlot(atlas, charInfo->codepoint, (u32)pIndex, cIndex);
+		}
+	}
+	//Pending codepoints may have already been rasterized (or found missing) partway through FontAtlasRasterizePending
+	VarArrayLoop(&atlas->missingCodepoints, mIndex)
+	{
+		VarArrayLoopGet(u32, missingCodepoint, &atlas->missingCodepoints, mIndex);
+		if (FontAtlasFindSlot(atlas, *missingCodepoint) == nullptr) { FontAtlasInsertSlot(atlas, *missingCodepoint, FONT_ATLAS_MISSING_PAGE, 0); }
+	}
+	VarArrayLoop(&atlas->pendingCodepoints, pIndex)
+	{
+		VarArrayLoopGet(u32, pendingCodepoint, &atlas->pendingCodepoints, pIndex);
+		if (FontAtlasFindSlot(atlas, *pendingCodepoint) == nullptr) { FontAtlasInsertSlot(atlas, *pendingCodepoint, FONT_ATLAS_PENDING_PAGE, 0); }
+	}
+}
+//Fills in the codepoint's existing slot (a pending codepoint being rasterized or found missing) or inserts a new one, growing the table if needed
+void FontAtlasSetSlot(FontGlyphAtlas_t* atlas, u32 codepoint, u32 pageIndex, u64 charIndex)
+{
+	NotNull(atlas);
+	FontAtlasGlyphSlot_t* slot = FontAtlasFindSlot(atlas, codepoint);
+	if (slot != nullptr)
+	{
+		if (slot->pageIndex < FONT_ATLAS_PENDING_PAGE) { atlas->numGlyphs--; }
+		if (pageIndex < FONT_ATLAS_PENDING_PAGE) { atlas->numGlyphs++; }
+		slot->pageIndex = pageIndex;
+		slot->charIndex = charIndex;
+		return;
+	}
+	if ((atlas->numUsedSlots + 1) * 2 > atlas->hashCapacity) { FontAtlasRebuildHash(atlas, atlas->numUsedSlots + 1); }
+	FontAtlasInsertSlot(atlas, codepoint, pageIndex, charIndex);
+}
+
+void FontAtlasMarkDirty(FontAtlasPage_t* page, reci dirtyRec)
+{
+	NotNull(page);
+	if (page->isDirty)
+	{
+		i32 minX = MinI32(page->dirtyRec.x, dirtyRec.x);
+		i32 minY = MinI32(page->dirtyRec.y, dirtyRec.y);
+		i32 maxX = MaxI32(page->dirtyRec.x + page->dirtyRec.width, dirtyRec.x + dirtyRec.width);
+		i32 maxY = MaxI32(page->dirtyRec.y + page->dirtyRec.height, dirtyRec.y + dirtyRec.height);
+		page->dirtyRec = NewReci(minX, minY, maxX - minX, maxY - minY);
+	}
+	else
+	{
+		page->dirtyRec = dirtyRec;
+		page->isDirty = true;
+	}
+}
+
+//Uploads everything rasterized into the page since the last flush with a single sub-image upload
+void FontAtlasFlushBake(const FontBake_t* bake)
+{
+	NotNull(bake);
+	Assert(IsFlagSet(bake->flags, FontBakeFlag_IsDynamic));
+	NotNull(bake->atlas);
+	FontGlyphAtlas_t* atlas = bake->atlas;
+	Assert(bake->bakeIndex < atlas->numPages);
+	FontAtlasPage_t* page = &atlas->pages[bake->bakeIndex];
+	if (!page->isDirty) { return; }
+	
+	const u8* firstPixel = &page->pixels[(page->dirtyRec.y * page->size.width) + page->dirtyRec.x];
+	UpdateTextureSubPart(&page->bake.bitmap, page->dirtyRec, firstPixel, 1, (u64)page->size.width);
+	atlas->numUploads++;
+	atlas->numUploadedBytes += (u64)(page->dirtyRec.width * page->dirtyRec.height);
+	page->isDirty = false;
+}
+void FontAtlasFlush(FontGlyphAtlas_t* atlas)
+{
+	NotNull(atlas);
+	for (u64 pIndex = 0; pIndex < atlas->numPages; pIndex++)
+	{
+		FontAtlasFlushBake(&atlas->pages[pIndex].bake);
+	}
+}
+
+FontAtlasPage_t* FontAtlasAddPage(FontGlyphAtlas_t* atlas, i32 fontSize)
+{
+	NotNull(atlas);
+	if (atlas->numPages >= FONT_ATLAS_MAX_PAGES) { return nullptr; }
+	
+	FontAtlasPage_t* page = &atlas->pages[atlas->numPages];
+	ClearPointer(page);
+	page->pageIndex = atlas->numPages;
+	page->size = atlas->pageSize;
+	page->pixels = AllocArray(atlas->allocArena, u8, (u64)(page->size.width * page->size.height));
+	if (page->pixels == nullptr) { return nullptr; }
+	MyMemSet(page->pixels, 0x00, (u64)(page->size.width * page->size.height));
+	
+	PlatImageData_t imageData = {};
+	imageData.size = page->size;
+	imageData.pixelSize = sizeof(u8);
+	imageData.rowSize = (u64)page->size.width;
+	imageData.dataSize = (u64)(page->size.width * page->size.height);
+	imageData.data8 = page->pixels;
+	if (!CreateTexture(atlas->allocArena, &page->bake.bitmap, &imageData, false, false, false, false))
+	{
+		FreeMem(atlas->allocArena, page->pixels, imageData.dataSize);
+		ClearPointer(page);
+		return nullptr;
+	}
+	
+	page->bake.bakeIndex = page->pageIndex;
+	page->bake.flags = FontBakeFlag_IsValid | FontBakeFlag_IsDynamic;
+	page->bake.atlas = atlas;
+	CreateVarArray(&page->bake.ranges, atlas->allocArena, sizeof(FontRange_t), 1);
+	FontRange_t* range = VarArrayAdd(&page->bake.ranges, FontRange_t);
+	NotNull(range);
+	ClearPointer(range);
+	range->contiguous = false;
+	range->minCodepoint = UINT32_MAX;
+	range->maxCodepoint = UINT32_MAX;
+	//NOTE: We never let charInfos grow past this capacity (the page counts as full instead) so that
+	//      FontCharInfo_t pointers handed out for a page stay valid until that page is evicted
+	u64 maxGlyphsX = (u64)(page->size.width / (MaxI32(fontSize/2, 1) + FONT_ATLAS_GLYPH_PADDING));
+	u64 maxGlyphsY = (u64)(page->size.height / (fontSize + FONT_ATLAS_GLYPH_PADDING));
+	page->maxGlyphs = MaxU64(maxGlyphsX * maxGlyphsY, 16);
+	CreateVarArray(&range->charInfos, atlas->allocArena, sizeof(FontCharInfo_t), page->maxGlyphs);
+	
+	atlas->numPages++;
+	return page;
+}
+
+//Shelf packing: use the shortest existing shelf the glyph fits in (without wasting too much height), otherwise open a new shelf below the others
+bool FontAtlasPackGlyph(FontAtlasPage_t* page, v2i glyphSize, reci* recOut)
+{
+	NotNull(page);
+	NotNull(recOut);
+	FontRange_t* range = VarArrayGet(&page->bake.ranges, 0, FontRange_t);
+	if (range->charInfos.length >= page->maxGlyphs) { return false; }
+	
+	v2i paddedSize = glyphSize + NewVec2i(FONT_ATLAS_GLYPH_PADDING, FONT_ATLAS_GLYPH_PADDING);
+	FontAtlasShelf_t* bestShelf = nullptr;
+	for (u64 sIndex = 0; sIndex < page->numShelves; sIndex++)
+	{
+		FontAtlasShelf_t* shelf = &page->shelves[sIndex];
+		if (shelf->height >= paddedSize.height && shelf->height <= paddedSize.height + paddedSize.height/4 + 2 &&
+			shelf->usedWidth + paddedSize.width <= page->size.width &&
+			(bestShelf == nullptr || shelf->height < bestShelf->height))
+		{
+			bestShelf = shelf;
+		}
+	}
+	if (bestShelf == nullptr)
+	{
+		i32 nextShelfY = 0;
+		if (page->numShelves > 0) { nextShelfY = page->shelves[page->numShelves-1].y + page->shelves[page->numShelves-1].height; }
+		if (page->numShelves >= FONT_ATLAS_MAX_SHELVES || nextShelfY + paddedSize.height > page->size.height || paddedSize.width > page->size.width) { return false; }
+		bestShelf = &page->shelves[page->numShelves];
+		page->numShelves++;
+		bestShelf->y = nextShelfY;
+		bestShelf->height = paddedSize.height;
+		bestShelf->usedWidth = 0;
+	}
+	
+	*recOut = NewReci(bestShelf->usedWidth, bestShelf->y, paddedSize.width, paddedSize.height);
+	bestShelf->usedWidth += paddedSize.width;
+	return true;
+}
+
+void FontAtlasEvictPage(Font_t* font, FontGlyphAtlas_t* atlas, FontAtlasPage_t* page)
+{
+	NotNull3(font, atlas, page);
+	FontRange_t* range = VarArrayGet(&page->bake.ranges, 0, FontRange_t);
+	VarArrayClear(&range->charInfos);
+	range->minCodepoint = UINT32_MAX;
+	range->maxCodepoint = UINT32_MAX;
+	page->numShelves = 0;
+	MyMemSet(page->pixels, 0x00, (u64)(page->size.width * page->size.height));
+	page->isDirty = false;
+	FontAtlasMarkDirty(page, NewReci(0, 0, page->size));
+	atlas->numEvictions++;
+	FontAtlasRebuildHash(atlas, atlas->numUsedSlots);
+	//Any cached layouts could be pointing at glyphs on this page
+	TextLayoutCacheEvictFont(font);
+}
+
+//Finds room for a glyph, adding pages until we hit FONT_ATLAS_MAX_PAGES and then evicting the least recently used page.
+//Pages used during this frame are never evicted since their glyphs may still be referenced by the caller
+FontAtlasPage_t* FontAtlasFindRoom(Font_t* font, FontFace_t* face, v2i glyphSize, reci* recOut)
+{
+	FontGlyphAtlas_t* atlas = face->atlas;
+	for (u64 pIndex = 0; pIndex < atlas->numPages; pIndex++)
+	{
+		if (FontAtlasPackGlyph(&atlas->pages[pIndex], glyphSize, recOut)) { return &atlas->pages[pIndex]; }
+	}
+	FontAtlasPage_t* newPage = FontAtlasAddPage(atlas, face->fontSize);
+	if (newPage != nullptr)
+	{
+		if (FontAtlasPackGlyph(newPage, glyphSize, recOut)) { return newPage; }
+		return nullptr;
+	}
+	
+	FontAtlasPage_t* oldestPage = nullptr;
+	for (u64 pIndex = 0; pIndex < atlas->numPages; pIndex++)
+	{
+		FontAtlasPage_t* page = &atlas->pages[pIndex];
+		if (page->lastUseTime != ProgramTime && (oldestPage == nullptr || page->lastUseTime < oldestPage->lastUseTime)) { oldestPage = page; }
+	}
+	if (oldestPage == nullptr) { return nullptr; }
+	FontAtlasEvictPage(font, atlas, oldestPage);
+	if (FontAtlasPackGlyph(oldestPage, glyphSize, recOut)) { return oldestPage; }
+	return nullptr;
+}
+
+void FontAtlasAddMissing(FontGlyphAtlas_t* atlas, u32 codepoint)
+{
+	NotNull(atlas);
+	u32* missingCodepoint = VarArrayAdd(&atlas->missingCodepoints, u32);
+	NotNull(missingCodepoint);
+	*missingCodepoint = codepoint;
+	FontAtlasSetSlot(atlas, codepoint, FONT_ATLAS_MISSING_PAGE, 0);
+}
+
+//Copies one glyph out of a platform bake into the atlas. Returns false if every page is full of glyphs used this frame
+bool FontAtlasAddBakedGlyph(Font_t* font, FontFace_t* face, const PlatFontData_t* fontData, const PlatFontCharData_t* platCharInfo)
+{
+	NotNull3(font, face, face->atlas);
+	NotNull2(fontData, platCharInfo);
+	FontGlyphAtlas_t* atlas = face->atlas;
+	
+	reci atlasRec = Reci_Zero;
+	FontAtlasPage_t* page = FontAtlasFindRoom(font, face, platCharInfo->sourceRec.size, &atlasRec);
+	if (page == nullptr) { return false; }
+	
+	reci glyphRec = NewReci(atlasRec.topLeft, platCharInfo->sourceRec.size);
+	for (i32 row = 0; row < glyphRec.height; row++)
+	{
+		u8* destRow = &page->pixels[((glyphRec.y + row) * page->size.width) + glyphRec.x];
+		const u8* sourceRow = &fontData->imageData.data8[((platCharInfo->sourceRec.y + row) * fontData->imageData.rowSize) + platCharInfo->sourceRec.x];
+		MyMemCopy(destRow, sourceRow, (u64)glyphRec.width);
+	}
+	if (glyphRec.width > 0 && glyphRec.height > 0) { FontAtlasMarkDirty(page, atlasRec); }
+	
+	FontRange_t* range = VarArrayGet(&page->bake.ranges, 0, FontRange_t);
+	FontCharInfo_t* charInfo = VarArrayAdd(&range->charInfos, FontCharInfo_t);
+	NotNull(charInfo);
+	ClearPointer(charInfo);
+	u32 codepoint = platCharInfo->codepoint;
+	charInfo->charIndex = (range->charInfos.length - 1);
+	charInfo->codepoint = codepoint;
+	charInfo->sourceRec = glyphRec;
+	charInfo->logicalOffset = platCharInfo->offset;
+	charInfo->logicalSize = ToVec2(platCharInfo->sourceRec.size);
+	charInfo->renderOffset = platCharInfo->offset;
+	charInfo->advanceX = platCharInfo->advanceX;
+	if (codepoint < range->minCodepoint || range->minCodepoint == UINT32_MAX) { range->minCodepoint = codepoint; }
+	if (codepoint >= range->maxCodepoint || range->maxCodepoint == UINT32_MAX) { range->maxCodepoint = codepoint+1; }
+	
+	FontAtlasSetSlot(atlas, codepoint, (u32)page->pageIndex, charInfo->charIndex);
+	page->lastUseTime = ProgramTime;
+	atlas->numRasterized++;
+	return true;
+}
+
+//Rasterizes all the codepoints with a single plat->BakeFont call. If the bake fails we retry the glyphs
+//one at a time so a single bad glyph doesn't keep the rest of the batch from ever showing up
+void FontAtlasBakeGlyphs(Font_t* font, FontFace_t* face, PlatFileContents_t* fontFile, u64 numCodepoints, u32* codepoints)
+{
+	NotNull3(font, face, face->atlas);
+	NotNull2(fontFile, codepoints);
+	Assert(numCodepoints > 0 && numCodepoints <= FONT_ATLAS_MAX_BATCH_GLYPHS);
+	FontGlyphAtlas_t* atlas = face->atlas;
+	
+	i32 gridSize = 1;
+	while ((u64)(gridSize * gridSize) < numCodepoints) { gridSize++; }
+	PlatFontRange_t platRange = {};
+	platRange.fontSize = (float)face->fontSize;
+	platRange.codePointList = codepoints;
+	platRange.numChars = (u32)numCodepoints;
+	PlatFontData_t fontData = {};
+	atlas->numBakes++;
+	if (!plat->BakeFont(fontFile, NewVec2i(atlas->rasterSize.width * gridSize, atlas->rasterSize.height * gridSize), false, 1, &platRange, &fontData, nullptr))
+	{
+		if (numCodepoints == 1) { FontAtlasAddMissing(atlas, codepoints[0]); return; }
+		for (u64 cIndex = 0; cIndex < numCodepoints; cIndex++) { FontAtlasBakeGlyphs(font, face, fontFile, 1, &codepoints[cIndex]); }
+		return;
+	}
+	Assert(fontData.numChars == numCodepoints);
+	
+	for (u64 cIndex = 0; cIndex < fontData.numChars; cIndex++)
+	{
+		const PlatFontCharData_t* platCharInfo = &fontData.charData[cIndex];
+		if (platCharInfo->isNotdef && !atlas->drawNotdef) { FontAtlasAddMissing(atlas, platCharInfo->codepoint); continue; }
+		//If all pages are full of glyphs used this frame the codepoint will miss again next frame and get queued again
+		FontAtlasAddBakedGlyph(font, face, &fontData, platCharInfo);
+	}
+	plat->FreeFontData(&fontData);
+}
+
+//Rasterizes everything GetFontAtlasGlyph missed since the last call, in as few bakes as possible (one per font file per FONT_ATLAS_MAX_BATCH_GLYPHS)
+void FontAtlasRasterizePending(Font_t* font, FontFace_t* face)
+{
+	NotNull3(font, face, face->atlas);
+	FontGlyphAtlas_t* atlas = face->atlas;
+	if (atlas->pendingCodepoints.length == 0) { return; }
+	
+	PerfTime_t rasterStartTime = GetPerfTime();
+	u64 numRasterizedBefore = atlas->numRasterized;
+	u32 batch[FONT_ATLAS_MAX_BATCH_GLYPHS];
+	for (u64 fontFileIndex = 0; fontFileIndex < 2; fontFileIndex++)
+	{
+		bool useFallback = (fontFileIndex == 1);
+		PlatFileContents_t* fontFile = (useFallback ? &atlas->fallbackFontFile : &atlas->fontFile);
+		if (fontFile->data == nullptr) { continue; }
+		u64 numInBatch = 0;
+		VarArrayLoop(&atlas->pendingCodepoints, pIndex)
+		{
+			VarArrayLoopGet(u32, codepoint, &atlas->pendingCodepoints, pIndex);
+			bool isFallbackCodepoint = (atlas->fallbackFontFile.data != nullptr && *codepoint >= atlas->fallbackMinCodepoint);
+			if (isFallbackCodepoint != useFallback) { continue; }
+			batch[numInBatch] = *codepoint;
+			numInBatch++;
+			if (numInBatch == FONT_ATLAS_MAX_BATCH_GLYPHS) { FontAtlasBakeGlyphs(font, face, fontFile, numInBatch, &batch[0]); numInBatch = 0; }
+		}
+		if (numInBatch > 0) { FontAtlasBakeGlyphs(font, face, fontFile, numInBatch, &batch[0]); }
+	}
+	//Anything still pending didn't fit because every page is full of glyphs used this frame. Drop those slots so they get queued again the next time they are asked for
+	bool anyStillPending = false;
+	VarArrayLoop(&atlas->pendingCodepoints, pIndex)
+	{
+		VarArrayLoopGet(u32, codepoint, &atlas->pendingCodepoints, pIndex);
+		FontAtlasGlyphSlot_t* slot = FontAtlasFindSlot(atlas, *codepoint);
+		if (slot != nullptr && slot->pageIndex == FONT_ATLAS_PENDING_PAGE) { anyStillPending = true; break; }
+	}
+	VarArrayClear(&atlas->pendingCodepoints);
+	if (anyStillPending) { FontAtlasRebuildHash(atlas, atlas->numUsedSlots); }
+	
+	//Layouts made before now have invalid-char boxes where these glyphs go
+	if (atlas->numRasterized != numRasterizedBefore) { TextLayoutCacheEvictFont(font); }
+	PerfTime_t rasterEndTime = GetPerfTime();
+	atlas->rasterizeTime += GetPerfTimeDiff(&rasterStartTime, &rasterEndTime);
+}
+
+//Called once per frame before rendering so the glyphs missed during the update are rasterized in one batch and uploaded in one batch per page
+void FontFlushGlyphAtlases(Font_t* font)
+{
+	NotNull(font);
+	VarArrayLoop(&font->faces, fIndex)
+	{
+		VarArrayLoopGet(FontFace_t, face, &font->faces, fIndex);
+		if (face->atlas != nullptr)
+		{
+			FontAtlasRasterizePending(font, face);
+			FontAtlasFlush(face->atlas);
+		}
+	}
+}
+
+//Looks up a glyph in the atlas. The first time a glyph is asked for it gets queued to be rasterized by the next FontFlushGlyphAtlases and nullptr is returned
+FontBake_t* GetFontAtlasGlyph(Font_t* font, FontFace_t* face, u32 codepoint, FontCharInfo_t** infoOut = nullptr, FontRange_t** rangeOut = nullptr)
+{
+	NotNull3(font, face, face->atlas);
+	FontGlyphAtlas_t* atlas = face->atlas;
+	if (codepoint == 0) { return nullptr; }
+	
+	FontAtlasGlyphSlot_t* slot = FontAtlasFindSlot(atlas, codepoint);
+	if (slot != nullptr)
+	{
+		if (slot->pageIndex == FONT_ATLAS_PENDING_PAGE || slot->pageIndex == FONT_ATLAS_MISSING_PAGE) { return nullptr; }
+		Assert(slot->pageIndex < atlas->numPages);
+		FontAtlasPage_t* page = &atlas->pages[slot->pageIndex];
+		FontRange_t* range = VarArrayGet(&page->bake.ranges, 0, FontRange_t);
+		page->lastUseTime = ProgramTime;
+		if (infoOut != nullptr) { *infoOut = VarArrayGet(&range->charInfos, slot->charIndex, FontCharInfo_t); }
+		if (rangeOut != nullptr) { *rangeOut = range; }
+		return &page->bake;
+	}
+	
+	u32* newPendingCodepoint = VarArrayAdd(&atlas->pendingCodepoints, u32);
+	NotNull(newPendingCodepoint);
+	*newPendingCodepoint = codepoint;
+	FontAtlasSetSlot(atlas, codepoint, FONT_ATLAS_PENDING_PAGE, 0);
+	return nullptr;
+}
+
 // +--------------------------------------------------------------+
 // |                    Usage/Access Functions                    |
 // +--------------------------------------------------------------+
@@ -385,7 +1224,9 @@ FontFace_t* GetFontFace(Font_t* font, FontFaceSelector_t selector)
 		u64 mismatch = 0;
 		if (selector.fontSize != 0)
 		{
-			mismatch += (u64)AbsI32(face->fontSize - selector.fontSize);
+			//SDF faces can be drawn at any size so they are only barely worse than a face that matches exactly
+			if (IsFlagSet(face->flags, FontFaceFlag_IsSdf)) { mismatch += ((face->fontSize != selector.fontSize) ? 1 : 0); }
+			else { mismatch += (u64)AbsI32(face->fontSize - selector.fontSize); }
 		}
 		mismatch <<= 2; //shift up by two to give 2-bit space for bold and italic mismatch
 		if (selector.bold != IsFlagSet(face->flags, FontFaceFlag_IsBold)) { mismatch++; }
@@ -406,6 +1247,22 @@ const FontFace_t* GetFontFace(const Font_t* font, FontFaceSelector_t selector) /
 	return (const FontFace_t*)GetFontFace((Font_t*)font, selector);
 }
 
+//SDF faces get scaled up or down to the fontSize the selector asked for. Multiply face metrics (lineHeight, maxAscend, etc.) by this
+r32 GetFontFaceScale(const FontFace_t* face, FontFaceSelector_t selector)
+{
+	NotNull(face);
+	if (!IsFlagSet(face->flags, FontFaceFlag_IsSdf) || selector.selectDefault || selector.fontSize == 0) { return 1.0f; }
+	return (r32)selector.fontSize / (r32)face->fontSize;
+}
+//Converts a character's metrics from bake pixels to face units
+r32 GetFontCharScale(const FontFace_t* face, const FontBake_t* bake, const FontCharInfo_t* charInfo)
+{
+	NotNull3(face, bake, charInfo);
+	if (IsFlagSet(bake->flags, FontBakeFlag_IsScalable)) { return face->renderLineHeight / charInfo->renderSize.height; }
+	if (IsFlagSet(bake->flags, FontBakeFlag_IsSdf)) { return bake->rasterScale; }
+	return 1.0f;
+}
+
 FontBake_t* GetFontBakeForChar(Font_t* font, FontFace_t* face, u32 codepoint, FontCharInfo_t** infoOut = nullptr, FontRange_t** rangeOut = nullptr)
 {
 	NotNull(font);
@@ -442,6 +1299,10 @@ FontBake_t* GetFontBakeForChar(Font_t* font, FontFace_t* face, u32 codepoint, Fo
 			}
 		}
 	}
+	if (face->atlas != nullptr)
+	{
+		return GetFontAtlasGlyph(font, face, codepoint, infoOut, rangeOut);
+	}
 	return nullptr;
 }
 const FontBake_t* GetFontBakeForChar(const Font_t* font, const FontFace_t* face, u32 codepoint, const FontCharInfo_t** infoOut = nullptr, const FontRange_t** rangeOut = nullptr) //const-variant
@@ -455,6 +1316,17 @@ FontCharInfo_t* GetFontCharInfoInBake(Font_t* font, FontFace_t* face, FontBake_t
 	NotNull(face);
 	NotNull(bake);
 	DebugAssert(VarArrayContains(&font->faces, face));
+	if (IsFlagSet(bake->flags, FontBakeFlag_IsDynamic))
+	{
+		//Only look for glyphs that are already on this page, GetFontBakeForChar will rasterize new ones
+		Assert(bake->atlas == face->atlas);
+		FontAtlasGlyphSlot_t* slot = ((codepoint != 0) ? FontAtlasFindSlot(face->atlas, codepoint) : nullptr);
+		if (slot == nullptr || slot->pageIndex != bake->bakeIndex) { return nullptr; }
+		FontRange_t* range = VarArrayGet(&bake->ranges, 0, FontRange_t);
+		face->atlas->pages[slot->pageIndex].lastUseTime = ProgramTime;
+		if (rangeOut != nullptr) { *rangeOut = range; }
+		return VarArrayGet(&range->charInfos, slot->charIndex, FontCharInfo_t);
+	}
 	DebugAssert(VarArrayContains(&face->bakes, bake));
 	VarArrayLoop(&bake->ranges, rIndex)
 	{
@@ -41,19 +41,106 @@ enum FontBakeFlag_t
 	FontBakeFlag_IsSpriteFont = 0x02,
 	FontBakeFlag_IsScalable   = 0x04,
 	FontBakeFlag_IsColored    = 0x08,
+	FontBakeFlag_IsDynamic    = 0x10, //the bake is a page in a FontGlyphAtlas_t and its glyphs can change at runtime
+	FontBakeFlag_IsSdf        = 0x20, //the bitmap holds signed distance values rather than coverage and must be drawn with rc->fontSdfShader
 	
 	FontBakeFlag_None = 0x00,
-	FontBakeFlag_All  = 0x0F,
-	FontBakeFlag_NumFlags = 4,
+	FontBakeFlag_All  = 0x3F,
+	FontBakeFlag_NumFlags = 6,
 };
 
+struct FontGlyphAtlas_t;
+
 struct FontBake_t
 {
-	u64 bakeIndex;
+	u64 bakeIndex; //the page index for FontBakeFlag_IsDynamic bakes
 	u8 flags;
 	Texture_t bitmap;
 	VarArray_t ranges;
 	PlatRectPackContext_t rectPackContext;
+	FontGlyphAtlas_t* atlas; //only filled for FontBakeFlag_IsDynamic bakes
+	r32 rasterScale; //only filled for FontBakeFlag_IsSdf bakes, char metrics are in raster pixels and get multiplied by this to be in face units
+};
+
+// +--------------------------------------------------------------+
+// |                  Signed Distance Field Bakes                 |
+// +--------------------------------------------------------------+
+#define FONT_SDF_DEFAULT_RASTER_SIZE  32 //px, the size glyphs are rasterized at before being turned into distance fields
+#define FONT_SDF_DEFAULT_SPREAD       4 //px, how far outside/inside the glyph edge the distance field reaches (in raster pixels)
+#define FONT_SDF_MIN_BAKE_SIZE        64 //px, SDF bakes start at this size and double until all the glyphs fit
+
+// +--------------------------------------------------------------+
+// |                      Dynamic Glyph Atlas                     |
+// +--------------------------------------------------------------+
+#define FONT_ATLAS_MAX_PAGES          4 //pages per face
+#define FONT_ATLAS_MAX_SHELVES        64 //shelves per page
+#define FONT_ATLAS_GLYPH_PADDING      1 //px
+#define FONT_ATLAS_MIN_HASH_CAPACITY  256 //slots
+#define FONT_ATLAS_MAX_BATCH_GLYPHS   64 //glyphs per plat->BakeFont call when rasterizing a frame's worth of misses
+#define FONT_ATLAS_PENDING_PAGE       0xFFFFFFFE //FontAtlasGlyphSlot_t::pageIndex for a codepoint waiting on the next FontFlushGlyphAtlases
+#define FONT_ATLAS_MISSING_PAGE       0xFFFFFFFF //FontAtlasGlyphSlot_t::pageIndex for a codepoint the platform failed to rasterize
+
+struct FontAtlasShelf_t
+{
+	i32 y;
+	i32 height;
+	i32 usedWidth;
+};
+
+struct FontAtlasPage_t
+{
+	u64 pageIndex;
+	FontBake_t bake; //has FontBakeFlag_IsDynamic and a single non-contiguous range holding the glyphs on this page
+	v2i size;
+	u8* pixels; //single channel, CPU side copy of the texture so glyphs can be uploaded in batches
+	u64 lastUseTime;
+	u64 maxGlyphs; //charInfos is allocated with this capacity up front and never grows
+	
+	u64 numShelves;
+	FontAtlasShelf_t shelves[FONT_ATLAS_MAX_SHELVES];
+	
+	bool isDirty;
+	reci dirtyRec;
+};
+
+struct FontAtlasGlyphSlot_t
+{
+	u32 codepoint; //0 means empty
+	u32 pageIndex; //or FONT_ATLAS_PENDING_PAGE/FONT_ATLAS_MISSING_PAGE
+	u64 charIndex;
+};
+
+//NOTE: A FontGlyphAtlas_t lets a face rasterize glyphs the first time they are asked for instead of
+//      needing every range baked up front. Misses are queued and rasterized together once per frame
+//      (see FontAtlasRasterizePending), glyphs are shelf-packed into pages, pages are uploaded to the
+//      GPU in batches (see FontAtlasFlushBake) and when every page is full the least recently used
+//      page is cleared and reused
+struct FontGlyphAtlas_t
+{
+	MemArena_t* allocArena;
+	PlatFileContents_t fontFile;
+	PlatFileContents_t fallbackFontFile; //optional, used for codepoints at or above fallbackMinCodepoint
+	u32 fallbackMinCodepoint;
+	v2i pageSize;
+	v2i rasterSize; //room we give a single glyph in the bitmap we ask the platform to bake into
+	bool drawNotdef; //when false codepoints the font doesn't have draw as the invalid-char box, like they would with a static bake
+	
+	u64 numPages;
+	FontAtlasPage_t pages[FONT_ATLAS_MAX_PAGES];
+	
+	u64 hashCapacity; //always a power of 2
+	u64 numUsedSlots; //glyphs + missing + pending
+	u64 numGlyphs;
+	FontAtlasGlyphSlot_t* hashSlots;
+	VarArray_t missingCodepoints; //u32, codepoints the platform failed to rasterize (or the font doesn't have), so we don't keep retrying them. Only read when rebuilding the hash, lookups go through hashSlots
+	VarArray_t pendingCodepoints; //u32, misses since the last FontFlushGlyphAtlases, these draw as the invalid-char box until then. Also have a FONT_ATLAS_PENDING_PAGE slot so we only queue them once
+	
+	u64 numRasterized;
+	u64 numBakes; //plat->BakeFont calls
+	u64 numEvictions;
+	u64 numUploads;
+	u64 numUploadedBytes;
+	r64 rasterizeTime; //ms
 };
 
 enum FontFaceFlag_t
@@ -63,12 +150,13 @@ enum FontFaceFlag_t
 	FontFaceFlag_IsItalic   = 0x0004,
 	FontFaceFlag_IsDefault  = 0x0008, //should only be set on a single face in the font and correspond to defaultFaceIndex
 	FontFaceFlag_IsActive   = 0x0010, //whether the face holds an active handle to a font file for generating new bakes
+	FontFaceFlag_IsSdf      = 0x0020, //the face has signed distance field bakes and can be drawn at any fontSize, see GetFontFaceScale
 	
 	FontFaceFlag_BoldItalic = (FontFaceFlag_IsBold|FontFaceFlag_IsItalic),
 	
 	FontFaceFlag_None = 0x0000,
-	FontFaceFlag_All  = 0x000F,
-	FontFaceFlag_NumFlags = 5,
+	FontFaceFlag_All  = 0x003F,
+	FontFaceFlag_NumFlags = 6,
 };
 
 struct FontFace_t
@@ -85,6 +173,7 @@ struct FontFace_t
 	VarArray_t bakes;
 	
 	PlatFileContents_t fontFile;
+	FontGlyphAtlas_t* atlas; //nullptr unless FontEnableDynamicAtlas was called
 	
 	r32 lineHeight;
 	r32 maxAscend;
@@ -154,6 +243,8 @@ const char* GetTextAlignmentStr(TextAlignment_t alignment)
 	}
 }
 
+struct TextLayout_t;
+
 struct FontFlowState_t
 {
 	MyStr_t text;
@@ -184,6 +275,8 @@ struct FontFlowState_t
 	r32 thisLineHeight;
 	const FontFace_t* selectedFaceCache;
 	const FontBake_t* selectedBakeCache;
+	Shader_t* textShader; //the shader that was bound before we switched to rc->fontSdfShader for an SDF bake, nullptr if we never switched
+	TextLayout_t* recordLayout; //if not nullptr, all draws are recorded into this layout rather than being sent to the RenderContext_t
 };
 void ClearFlowStateCache(FontFlowState_t* flowState)
 {
@@ -231,4 +324,78 @@ struct FontFlowInfo_t
 	v2 endPos;
 };
 
+// +--------------------------------------------------------------+
+// |                      Text Layout Types                       |
+// +--------------------------------------------------------------+
+#define TEXT_LAYOUT_CACHE_SIZE        256 //layouts
+#define TEXT_LAYOUT_CACHE_NUM_BUCKETS 512 //power of 2
+#define TEXT_LAYOUT_CACHE_NUM_SEEN    1024 //power of 2, see TextLayoutCache_t::seen
+#define TEXT_LAYOUT_CACHE_MAX_LENGTH  2048 //bytes (longer strings always get flowed directly)
+
+enum TextLayoutGlyphType_t
+{
+	TextLayoutGlyphType_Char = 0,
+	TextLayoutGlyphType_InvalidChar,
+	TextLayoutGlyphType_Underline,
+	TextLayoutGlyphType_NumTypes,
+};
+
+struct TextLayoutGlyph_t
+{
+	TextLayoutGlyphType_t type;
+	const FontBake_t* bake; //only filled for TextLayoutGlyphType_Char
+	bool isColored;
+	rec renderRec; //relative to the position the layout is drawn at
+	rec sourceRec;
+};
+
+//NOTE: A TextLayout_t is the result of running FontFlow_Main once, with all the glyph
+//      placements stored so we can replay them without doing any of the flow logic again.
+//      The layout holds pointers into the font's bakes, so it must be thrown away if the font is destroyed
+struct TextLayout_t
+{
+	MemArena_t* allocArena;
+	u64 hash;
+	TextLayout_t* lruPrev; //towards the most recently used layout
+	TextLayout_t* lruNext; //towards the least recently used layout (or the next free slot while unused)
+	TextLayout_t* bucketNext;
+	
+	MyStr_t text;
+	const Font_t* font;
+	FontFaceSelector_t faceSelector;
+	r32 scale;
+	r32 maxWidth;
+	TextAlignment_t alignment;
+	
+	FontFlowInfo_t flowInfo; //relative to Vec2_Zero
+	VarArray_t glyphs; //TextLayoutGlyph_t
+};
+
+struct TextLayoutCacheSeen_t
+{
+	u64 hash;
+	u64 time; //ProgramTime of the frame it was last asked for
+};
+
+//NOTE: Text only gets a layout once it has been asked for on two different frames. Strings that change
+//      every frame (timers, counters, etc.) never make it past the seen table so they don't push out the stable ones
+struct TextLayoutCache_t
+{
+	bool enabled;
+	MemArena_t* allocArena;
+	
+	u64 numHits;
+	u64 numMisses;
+	u64 numEvictions;
+	u64 numSkipped; //misses that weren't cached because the text hadn't been seen on an earlier frame
+	
+	u64 numLayouts;
+	TextLayout_t* lruHead; //most recently used
+	TextLayout_t* lruTail; //least recently used, this is the one we evict
+	TextLayout_t* freeHead; //linked through lruNext
+	TextLayout_t* buckets[TEXT_LAYOUT_CACHE_NUM_BUCKETS];
+	TextLayoutCacheSeen_t seen[TEXT_LAYOUT_CACHE_NUM_SEEN]; //indexed by hash, colliding strings just overwrite each other
+	TextLayout_t layouts[TEXT_LAYOUT_CACHE_SIZE];
+};
+
 #endif //  _PIG_FONT_H
@@ -14,6 +14,40 @@ Description:
 // +--------------------------------------------------------------+
 // |                      FontFlow Functions                      |
 // +--------------------------------------------------------------+
+void FontFlow_RecordGlyph(FontFlowState_t* flowState, TextLayoutGlyphType_t type, rec renderRec, const FontBake_t* bake = nullptr, rec sourceRec = Rec_Zero)
+{
+	NotNull(flowState);
+	NotNull(flowState->recordLayout);
+	TextLayoutGlyph_t* newGlyph = VarArrayAdd(&flowState->recordLayout->glyphs, TextLayoutGlyph_t);
+	NotNull(newGlyph);
+	ClearPointer(newGlyph);
+	newGlyph->type = type;
+	newGlyph->bake = bake;
+	newGlyph->isColored = (bake != nullptr && IsFlagSet(bake->flags, FontBakeFlag_IsColored));
+	newGlyph->renderRec = renderRec;
+	newGlyph->sourceRec = sourceRec;
+}
+
+//NOTE: SDF bakes are drawn with rc->fontSdfShader. The shader that was bound before we switched to it gets stored in textShaderPntr
+//      so it can be rebound for any other bakes and once the caller is done drawing
+void FontFlow_BindBake(const FontBake_t* bake, Shader_t** textShaderPntr)
+{
+	NotNull2(bake, textShaderPntr);
+	if (IsFlagSet(bake->flags, FontBakeFlag_IsDynamic)) { FontAtlasFlushBake(bake); }
+	if (IsFlagSet(bake->flags, FontBakeFlag_IsSdf) && rc->fontSdfShader.isValid)
+	{
+		if (*textShaderPntr == nullptr) { *textShaderPntr = rc->state.boundShader; }
+		RcBindShader(&rc->fontSdfShader);
+	}
+	else if (*textShaderPntr != nullptr)
+	{
+		RcBindShader(*textShaderPntr);
+	}
+	//TODO: The cast to Texture_t* here is dumb mismatch between me wanting to do const pointers here and
+	//      not doing them over in RenderContext stuff. Which one should change?
+	RcBindTexture1((Texture_t*)&bake->bitmap);
+}
+
 const FontCharInfo_t* FontFlow_FindCharInfo(FontFlowState_t* flowState, u32 codepoint)
 {
 	const FontCharInfo_t* result = nullptr;
@@ -131,8 +165,9 @@ u64 FontFlow_FindNextLineBreak(const FontFlowState_t* flowState, r32* widthOut =
 			const FontCharInfo_t* charInfo = FontFlow_FindCharInfo(&lookFlowState, codepoint);
 			if (charInfo != nullptr)
 			{
-				thisCharAdvance = charInfo->advanceX * charColumnWidth * lookFlowState.scale;
-				thisCharLogicalRec = NewRec(lookFlowState.position + charInfo->logicalOffset * lookFlowState.scale, charInfo->logicalSize * lookFlowState.scale);
+				r32 charScale = GetFontCharScale(lookFlowState.selectedFaceCache, lookFlowState.selectedBakeCache, charInfo);
+				thisCharAdvance = charInfo->advanceX * charColumnWidth * lookFlowState.scale * charScale;
+				thisCharLogicalRec = NewRec(lookFlowState.position + charInfo->logicalOffset * lookFlowState.scale * charScale, charInfo->logicalSize * lookFlowState.scale * charScale);
 			}
 			else
 			{
@@ -232,7 +267,8 @@ void FontFlow_DoLineBreak(FontFlowState_t* flowState, FontFlowCallbacks_t* callb
 		{
 			rec underlineRec = NewRecBetween(flowState->underlineStartPos, underlinePos);
 			if (underlineRec.height < underlineThickness * flowState->scale) { underlineRec.height = underlineThickness * flowState->scale; }
-			RcDrawRectangle(underlineRec, flowState->color);
+			if (flowState->recordLayout != nullptr) { FontFlow_RecordGlyph(flowState, TextLayoutGlyphType_Underline, underlineRec); }
+			else { RcDrawRectangle(underlineRec, flowState->color); }
 		}
 	}
 	
@@ -362,7 +398,8 @@ void FontFlow_Main(FontFlowState_t* flowState, FontFlowCallbacks_t* callbacks =
 				{
 					rec underlineRec = NewRecBetween(flowState->underlineStartPos, underlinePos);
 					if (underlineRec.height < underlineThickness * flowState->scale) { underlineRec.height = underlineThickness * flowState->scale; }
-					RcDrawRectangle(underlineRec, flowState->color);
+					if (flowState->recordLayout != nullptr) { FontFlow_RecordGlyph(flowState, TextLayoutGlyphType_Underline, underlineRec); }
+					else { RcDrawRectangle(underlineRec, flowState->color); }
 				}
 			}
 		}
@@ -380,11 +417,7 @@ void FontFlow_Main(FontFlowState_t* flowState, FontFlowCallbacks_t* callbacks =
 					flowState->thisLineHeight = flowState->selectedFaceCache->lineHeight;
 				}
 				
-				r32 scalableEffect = 1.0f;
-				if (IsFlagSet(flowState->selectedBakeCache->flags, FontBakeFlag_IsScalable))
-				{
-					scalableEffect = flowState->selectedFaceCache->renderLineHeight / charInfo->renderSize.height;
-				}
+				r32 scalableEffect = GetFontCharScale(flowState->selectedFaceCache, flowState->selectedBakeCache, charInfo);
 				rec renderRec = NewRec(flowState->position + charInfo->renderOffset * flowState->scale * scalableEffect, ToVec2(charInfo->renderSize) * flowState->scale * scalableEffect);
 				rec logicalRec = NewRec(flowState->position + charInfo->logicalOffset * flowState->scale * scalableEffect, charInfo->logicalSize * flowState->scale * scalableEffect);
 				
@@ -399,13 +432,15 @@ void FontFlow_Main(FontFlowState_t* flowState, FontFlowCallbacks_t* callbacks =
 					}
 					if (renderChar)
 					{
-						if (!flowState->justMeasuring)
+						if (flowState->recordLayout != nullptr)
+						{
+							FontFlow_RecordGlyph(flowState, TextLayoutGlyphType_Char, renderRec, flowState->selectedBakeCache, ToRec(charInfo->sourceRec));
+						}
+						else if (!flowState->justMeasuring)
 						{
 							Color_t drawColor = (IsFlagSet(flowState->selectedBakeCache->flags, FontBakeFlag_IsColored) ? White : flowState->color);
 							// RecAlign(&renderRec);//TODO: Implement this properly
-							//TODO: The cast to Texture_t* here is dumb mismatch between me wanting to do const pointers here and
-							//      not doing them over in RenderContext stuff. Which one should change?
-							RcBindTexture1((Texture_t*)&flowState->selectedBakeCache->bitmap);
+							FontFlow_BindBake(flowState->selectedBakeCache, &flowState->textShader);
 							RcDrawTexturedPartRectangle(renderRec, drawColor, ToRec(charInfo->sourceRec));
 						}
 						
@@ -454,7 +489,11 @@ void FontFlow_Main(FontFlowState_t* flowState, FontFlowCallbacks_t* callbacks =
 				rec renderRec = NewRec(flowState->position + NewVec2(0, -invalidCharRecSize.height * 0.9f * flowState->scale), invalidCharRecSize * flowState->scale);
 				rec logicalRec = renderRec;
 				
-				if (!flowState->justMeasuring)
+				if (flowState->recordLayout != nullptr)
+				{
+					FontFlow_RecordGlyph(flowState, TextLayoutGlyphType_InvalidChar, renderRec);
+				}
+				else if (!flowState->justMeasuring)
 				{
 					RcDrawRectangle(renderRec, PalVioletDarker);
 				}
@@ -566,6 +605,11 @@ void FontFlow_Main(FontFlowState_t* flowState, FontFlowCallbacks_t* callbacks =
 		callbacks->afterLine(false, flowState->lineIndex, flowState->byteIndex, flowState, callbacks->context);
 		flowState->calledAfterLineOnThisLine = true;
 	}
+	if (flowState->textShader != nullptr)
+	{
+		RcBindShader(flowState->textShader);
+		flowState->textShader = nullptr;
+	}
 }
 
 void FontFlow_Initialize(FontFlowState_t* flowStateOut, MyStr_t text, const Font_t* font, FontFaceSelector_t selector, Color_t color, v2 position,
@@ -600,6 +644,9 @@ void FontFlow_Initialize(FontFlowState_t* flowStateOut, MyStr_t text, const Font
 	flowStateOut->thisLineHeight = 0;
 	flowStateOut->selectedFaceCache = GetFontFace(font, selector);
 	flowStateOut->selectedBakeCache = nullptr;
+	flowStateOut->textShader = nullptr;
+	flowStateOut->recordLayout = nullptr;
+	if (flowStateOut->selectedFaceCache != nullptr) { flowStateOut->scale *= GetFontFaceScale(flowStateOut->selectedFaceCache, selector); }
 }
 
 void FontFlow_RenderText(MyStr_t text, const Font_t* font, FontFaceSelector_t selector, Color_t color, v2 position,
@@ -611,11 +658,102 @@ void FontFlow_RenderText(MyStr_t text, const Font_t* font, FontFaceSelector_t se
 	FontFlow_Main(&flowState, callbacks, infoOut);
 }
 
+// +--------------------------------------------------------------+
+// |                         Text Layouts                         |
+// +--------------------------------------------------------------+
+u64 GetTextLayoutHash(MyStr_t text, const Font_t* font, FontFaceSelector_t selector, TextAlignment_t alignment, r32 scale, r32 maxWidth)
+{
+	u64 result = FnvHashU64(text.pntr, text.length);
+	result = FnvHashU64(&font, sizeof(font), result);
+	result = FnvHashU64(&selector.selectDefault, sizeof(selector.selectDefault), result);
+	result = FnvHashU64(&selector.fontSize, sizeof(selector.fontSize), result);
+	result = FnvHashU64(&selector.bold, sizeof(selector.bold), result);
+	result = FnvHashU64(&selector.italic, sizeof(selector.italic), result);
+	result = FnvHashU64(&alignment, sizeof(alignment), result);
+	result = FnvHashU64(&scale, sizeof(scale), result);
+	result = FnvHashU64(&maxWidth, sizeof(maxWidth), result);
+	return result;
+}
+
+bool DoesTextLayoutMatch(const TextLayout_t* layout, u64 hash, MyStr_t text, const Font_t* font, FontFaceSelector_t selector, TextAlignment_t alignment, r32 scale, r32 maxWidth)
+{
+	NotNull(layout);
+	if (layout->hash != hash) { return false; }
+	if (layout->font != font) { return false; }
+	if (layout->alignment != alignment) { return false; }
+	if (layout->scale != scale || layout->maxWidth != maxWidth) { return false; }
+	if (layout->faceSelector.selectDefault != selector.selectDefault) { return false; }
+	if (!selector.selectDefault)
+	{
+		if (layout->faceSelector.fontSize != selector.fontSize) { return false; }
+		if (layout->faceSelector.bold != selector.bold) { return false; }
+		if (layout->faceSelector.italic != selector.italic) { return false; }
+	}
+	return StrEquals(layout->text, text);
+}
+
+void FreeTextLayout(TextLayout_t* layout)
+{
+	NotNull(layout);
+	if (layout->allocArena != nullptr)
+	{
+		if (layout->text.length > 0) { FreeString(layout->allocArena, &layout->text); }
+		FreeVarArray(&layout->glyphs);
+	}
+	ClearPointer(layout);
+}
+
+//Runs FontFlow_Main once (positioned at Vec2_Zero) and records every glyph placement so RcDrawTextLayout can replay it later
+void CreateTextLayout(MemArena_t* memArena, TextLayout_t* layoutOut, MyStr_t text, const Font_t* font, FontFaceSelector_t selector,
+	TextAlignment_t alignment = TextAlignment_Left, r32 scale = 1.0f, r32 maxWidth = 0.0f)
+{
+	NotNull2(memArena, layoutOut);
+	NotNullStr(&text);
+	NotNull(font);
+	
+	ClearPointer(layoutOut);
+	layoutOut->allocArena = memArena;
+	layoutOut->hash = GetTextLayoutHash(text, font, selector, alignment, scale, maxWidth);
+	layoutOut->text = (text.length > 0) ? AllocString(memArena, &text) : MyStr_Empty;
+	layoutOut->font = font;
+	layoutOut->faceSelector = selector;
+	layoutOut->scale = scale;
+	layoutOut->maxWidth = maxWidth;
+	layoutOut->alignment = alignment;
+	CreateVarArray(&layoutOut->glyphs, memArena, sizeof(TextLayoutGlyph_t), text.length);
+	
+	FontFlowState_t flowState;
+	FontFlow_Initialize(&flowState, layoutOut->text, font, selector, White, Vec2_Zero, alignment, scale, maxWidth);
+	flowState.recordLayout = layoutOut;
+	FontFlow_Main(&flowState, nullptr, &layoutOut->flowInfo);
+}
+
+//Fills infoOut as if the layout had been flowed at position
+void GetTextLayoutFlowInfo(const TextLayout_t* layout, v2 position, FontFlowInfo_t* infoOut)
+{
+	NotNull2(layout, infoOut);
+	MyMemCopy(infoOut, &layout->flowInfo, sizeof(FontFlowInfo_t));
+	if (infoOut->logicalRec.width != 0) { infoOut->logicalRec.topLeft += position; }
+	if (infoOut->renderRec.width != 0) { infoOut->renderRec.topLeft += position; }
+	infoOut->startPos += position;
+	infoOut->endPos += position;
+}
+
 // +--------------------------------------------------------------+
 // |                      Measure Functions                       |
 // +--------------------------------------------------------------+
 TextMeasure_t MeasureTextInFont(MyStr_t text, const Font_t* font, FontFaceSelector_t faceSelector, r32 scale = 1.0f, r32 maxWidth = 0.0f, FontFlowInfo_t* flowInfoOut = nullptr, FontFlowCallbacks_t* callbacks = nullptr)
 {
+	TextLayout_t* cachedLayout = GetCachedTextLayout(text, font, faceSelector, TextAlignment_Left, scale, maxWidth, callbacks);
+	if (cachedLayout != nullptr)
+	{
+		if (flowInfoOut != nullptr) { GetTextLayoutFlowInfo(cachedLayout, Vec2_Zero, flowInfoOut); }
+		TextMeasure_t result;
+		result.size = cachedLayout->flowInfo.logicalRec.size;
+		result.offset = -cachedLayout->flowInfo.logicalRec.topLeft;
+		return result;
+	}
+	
 	FontFlowInfo_t flowInfo = {};
 	
 	FontFlowState_t flowState;
@@ -0,0 +1,42 @@
+/*
+File:   pig_font_shaders.cpp
+Date:   10\19\2026
+Description:
+	** Holds the source for the shader that draws FontBakeFlag_IsSdf font bakes. It's compiled into
+	** rc->fontSdfShader by RcLoadBasicResources so it doesn't depend on any files in the game's Resources folder
+*/
+
+//NOTE: The vertex half matches pig_main_2d.glsl so the shader can be swapped in without touching any RenderContext state
+const char* FontSdfShaderCode_Vert_GLSL_130 =
+	"uniform mat4 WorldMatrix;\n"
+	"uniform mat4 ViewMatrix;\n"
+	"uniform mat4 ProjectionMatrix;\n"
+	"uniform vec2 Texture1Size;\n"
+	"uniform vec4 SourceRec1;\n"
+	"in vec3 inPosition;\n"
+	"in vec4 inColor1;\n"
+	"in vec2 inTexCoord1;\n"
+	"out vec4 fColor;\n"
+	"out vec2 fSampleCoord;\n"
+	"void main()\n"
+	"{\n"
+	"    fColor = inColor1;\n"
+	"    fSampleCoord = (SourceRec1.xy + (inTexCoord1 * SourceRec1.zw)) / Texture1Size;\n"
+	"    gl_Position = ProjectionMatrix * (ViewMatrix * (WorldMatrix * vec4(inPosition, 1.0)));\n"
+	"}\n";
+
+//NOTE: The glyph edge sits at 0.5 in the distance field. fwidth gives us how much the distance changes
+//      across one screen pixel so the edge stays roughly one pixel wide no matter how much the bake is scaled
+const char* FontSdfShaderCode_Frag_GLSL_130 =
+	"uniform sampler2D Texture1;\n"
+	"uniform vec4 Color1;\n"
+	"in vec4 fColor;\n"
+	"in vec2 fSampleCoord;\n"
+	"out vec4 frag_color;\n"
+	"void main()\n"
+	"{\n"
+	"    float distance = texture(Texture1, fSampleCoord).a;\n"
+	"    float smoothing = max(fwidth(distance) * 0.7071, 0.0001);\n"
+	"    float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);\n"
+	"    frag_color = fColor * Color1 * vec4(1.0, 1.0, 1.0, alpha);\n"
+	"}\n";
@@ -0,0 +1,96 @@
+/*
+File:   pig_frustum.cpp
+Date:   10\19\2026
+Description:
+	** Holds the functions that build a Frustum_t from a view-projection matrix and test boxes against it
+*/
+
+//Gribb/Hartmann plane extraction. mat4 is column-major (values[column][row]) so row r of the matrix is values[0..3][r]
+Frustum_t NewFrustum(mat4 viewProjection)
+{
+	v4 rows[4];
+	for (u8 row = 0; row < 4; row++)
+	{
+		rows[row] = NewVec4(viewProjection.values[0][row], viewProjection.values[1][row], viewProjection.values[2][row], viewProjection.values[3][row]);
+	}
+	
+	Frustum_t result;
+	result.planes[FrustumPlane_Left]   = NewVec4(rows[3].x + rows[0].x, rows[3].y + rows[0].y, rows[3].z + rows[0].z, rows[3].w + rows[0].w);
+	result.planes[FrustumPlane_Right]  = NewVec4(rows[3].x - rows[0].x, rows[3].y - rows[0].y, rows[3].z - rows[0].z, rows[3].w - rows[0].w);
+	result.planes[FrustumPlane_Bottom] = NewVec4(rows[3].x + rows[1].x, rows[3].y + rows[1].y, rows[3].z + rows[1].z, rows[3].w + rows[1].w);
+	result.planes[FrustumPlane_Top]    = NewVec4(rows[3].x - rows[1].x, rows[3].y - rows[1].y, rows[3].z - rows[1].z, rows[3].w - rows[1].w);
+	result.planes[FrustumPlane_Camera] = rows[3];
+	for (u8 pIndex = 0; pIndex < FrustumPlane_NumPlanes; pIndex++)
+	{
+		v4* plane = &result.planes[pIndex];
+		r32 normalLength = SqrtR32(plane->x*plane->x + plane->y*plane->y + plane->z*plane->z);
+		//An orthographic camera plane is (0, 0, 0, 1) which passes everything, so it's fine to leave it as-is
+		if (normalLength > 0) { *plane = NewVec4(plane->x / normalLength, plane->y / normalLength, plane->z / normalLength, plane->w / normalLength); }
+	}
+	return result;
+}
+
+bool IsPointInFrustum(const Frustum_t* frustum, v3 point)
+{
+	NotNull(frustum);
+	for (u8 pIndex = 0; pIndex < FrustumPlane_NumPlanes; pIndex++)
+	{
+		const v4* plane = &frustum->planes[pIndex];
+		if (plane->x*point.x + plane->y*point.y + plane->z*point.z + plane->w < 0) { return false; }
+	}
+	return true;
+}
+
+//Tests the box (in the space transform maps from) as an oriented box, which is exact against each plane and a lot tighter
+//than transforming it into a world aligned box first. Like every plane-by-plane test it can keep boxes that sit just outside a corner
+bool IsBoxInFrustum(const Frustum_t* frustum, const mat4& transform, v3 boxMin, v3 boxMax)
+{
+	NotNull(frustum);
+	v3 center = NewVec3((boxMin.x + boxMax.x) / 2.0f, (boxMin.y + boxMax.y) / 2.0f, (boxMin.z + boxMax.z) / 2.0f);
+	r32 extents[3] = { (boxMax.x - boxMin.x) / 2.0f, (boxMax.y - boxMin.y) / 2.0f, (boxMax.z - boxMin.z) / 2.0f };
+	v3 worldCenter = NewVec3(
+		transform.values[0][0]*center.x + transform.values[1][0]*center.y + transform.values[2][0]*center.z + transform.values[3][0],
+		transform.values[0][1]*center.x + transform.values[1][1]*center.y + transform.values[2][1]*center.z + transform.values[3][1],
+		transform.values[0][2]*center.x + transform.values[1][2]*center.y + transform.values[2][2]*center.z + transform.values[3][2]
+	);
+	for (u8 pIndex = 0; pIndex < FrustumPlane_NumPlanes; pIndex++)
+	{
+		const v4* plane = &frustum->planes[pIndex];
+		r32 distance = plane->x*worldCenter.x + plane->y*worldCenter.y + plane->z*worldCenter.z + plane->w;
+		r32 radius = 0;
+		for (u8 axis = 0; axis < 3; axis++)
+		{
+			const r32* column = &transform.values[axis][0];
+			radius += AbsR32(plane->x*column[0] + plane->y*column[1] + plane->z*column[2]) * extents[axis];
+		}
+		if (distance + radius < 0) { return false; }
+	}
+	return true;
+}
+
+//The obvious version of IsBoxInFrustum, transforms all 8 corners and looks for a plane they are all behind. Only used to check the fast version
+bool IsBoxInFrustumByCorners(const Frustum_t* frustum, const mat4& transform, v3 boxMin, v3 boxMax)
+{
+	NotNull(frustum);
+	v3 corners[8];
+	for (u8 cIndex = 0; cIndex < 8; cIndex++)
+	{
+		v3 localCorner = NewVec3(
+			IsFlagSet(cIndex, 0x01) ? boxMax.x : boxMin.x,
+			IsFlagSet(cIndex, 0x02) ? boxMax.y : boxMin.y,
+			IsFlagSet(cIndex, 0x04) ? boxMax.z : boxMin.z
+		);
+		corners[cIndex] = Mat4MultiplyVec3(transform, localCorner, true);
+	}
+	for (u8 pIndex = 0; pIndex < FrustumPlane_NumPlanes; pIndex++)
+	{
+		const v4* plane = &frustum->planes[pIndex];
+		bool allBehind = true;
+		for (u8 cIndex = 0; cIndex < 8; cIndex++)
+		{
+			if (plane->x*corners[cIndex].x + plane->y*corners[cIndex].y + plane->z*corners[cIndex].z + plane->w >= 0) { allBehind = false; break; }
+		}
+		if (allBehind) { return false; }
+	}
+	return true;
+}
@@ -0,0 +1,42 @@
+/*
+File:   pig_frustum.h
+Date:   10\19\2026
+Description:
+	** A Frustum_t holds the planes of a view-projection matrix so model parts can be culled on the CPU before
+	** we spend a draw call on them. Projections don't all agree on which clip space depth range is near and
+	** which is far (and we use a left-handed GL_GEQUAL depth test) so we only keep the four side planes plus the
+	** plane the camera sits on, which is enough to throw out everything off screen or behind the camera
+*/
+
+#ifndef _PIG_FRUSTUM_H
+#define _PIG_FRUSTUM_H
+
+enum FrustumPlane_t
+{
+	FrustumPlane_Left = 0,
+	FrustumPlane_Right,
+	FrustumPlane_Bottom,
+	FrustumPlane_Top,
+	FrustumPlane_Camera, //clip w = 0, anything behind this is behind the camera
+	FrustumPlane_NumPlanes,
+};
+const char* GetFrustumPlaneStr(FrustumPlane_t plane)
+{
+	switch (plane)
+	{
+		case FrustumPlane_Left:   return "Left";
+		case FrustumPlane_Right:  return "Right";
+		case FrustumPlane_Bottom: return "Bottom";
+		case FrustumPlane_Top:    return "Top";
+		case FrustumPlane_Camera: return "Camera";
+		default: return "Unknown";
+	}
+}
+
+//Each plane is (normal.x, normal.y, normal.z, distance) with the normal pointing inside, so a point is inside when dot(normal, point) + distance >= 0
+struct Frustum_t
+{
+	v4 planes[FrustumPlane_NumPlanes];
+};
+
+#endif //  _PIG_FRUSTUM_H
@@ -45,6 +45,40 @@ void DebugConsoleLineAdded(DebugConsole_t* console, StringFifoLine_t* newLine);
 void PigPerfGraphMark_(PigPerfGraph_t* graph);
 #define PigPerfGraphMark() PigPerfGraphMark_(&pig->perfGraph)
 
+//pig_profiler.cpp
+#if PIG_PROFILER
+void PigProfilerBegin_(const char* name);
+void PigProfilerEnd_();
+void PigProfilerNameThread_(const char* name);
+#define PigProfileBegin(name)  PigProfilerBegin_(name)
+#define PigProfileEnd()        PigProfilerEnd_()
+#define PigProfileThread(name) PigProfilerNameThread_(name)
+#else
+#define PigProfileBegin(name)  //nothing
+#define PigProfileEnd()        //nothing
+#define PigProfileThread(name) //nothing
+#endif
+
+//pig_mem_tracker.cpp
+//NOTE: GYLIB_MEM_ARENA_DEBUG_ENABLED already wraps these functions to record the call site, so we leave them alone in that case
+#if PIG_MEM_TRACKING && !defined(GYLIB_MEM_ARENA_DEBUG_ENABLED)
+void* PigTrackedAllocMem(const char* filePath, u32 lineNumber, MemArena_t* arena, u64 numBytes, AllocAlignment_t alignOverride = AllocAlignment_None);
+bool PigTrackedFreeMem(MemArena_t* arena, void* allocPntr, u64 allocSize = 0, bool ignoreNullptr = false, u64* oldSizeOut = nullptr);
+void* PigTrackedReallocMem(const char* filePath, u32 lineNumber, MemArena_t* arena, void* allocPntr, u64 newSize, u64 oldSize = 0, AllocAlignment_t alignOverride = AllocAlignment_None, bool ignoreNullptr = false, u64* oldSizeOut = nullptr);
+#define AllocMem(arena, ...)   PigTrackedAllocMem(__FILE__, __LINE__, (arena), __VA_ARGS__)
+#define FreeMem(...)           PigTrackedFreeMem(__VA_ARGS__)
+#define ReallocMem(arena, ...) PigTrackedReallocMem(__FILE__, __LINE__, (arena), __VA_ARGS__)
+#endif
+#if PIG_MEM_TRACKING
+void PigMemTagPush_(const char* tag);
+void PigMemTagPop_();
+#define PigMemTagPush(tag) PigMemTagPush_(tag)
+#define PigMemTagPop()     PigMemTagPop_()
+#else
+#define PigMemTagPush(tag) //nothing
+#define PigMemTagPop()     //nothing
+#endif
+
 //pig_app_states.cpp
 bool IsAppStateInitialized(AppState_t appState);
 bool IsAppStateActive(AppState_t appState);
@@ -56,6 +90,12 @@ void PopAppState();
 //pig_debug_commands.cpp
 bool PigParseDebugCommand(MyStr_t commandStr);
 void InitDebugConsoleExpContext(MemArena_t* contextArena, bool allocateStrings, ExpContext_t* contextOut);
+void PigAddDebugVarsToExpContext(ExpContext_t* context);
+
+//pig_render_funcs_font.cpp
+void TextLayoutCacheEvictFont(const Font_t* font);
+TextLayout_t* GetCachedTextLayout(MyStr_t text, const Font_t* font, FontFaceSelector_t selector, TextAlignment_t alignment, r32 scale, r32 maxWidth, const FontFlowCallbacks_t* callbacks);
+void InitTextLayoutCache(TextLayoutCache_t* cache, MemArena_t* memArena);
 
 //pig_render_funcs_imgui.cpp
 void RcRenderImDrawData(ImDrawData* imDrawData);
@@ -171,3 +171,40 @@ bool* GetBoolArrayPntr(bool* boolArray, v2i index, v2i size)
 	Assert(index.y < size.height);
 	return &boolArray[(u64)(index.y * size.width) + (u64)index.x];
 }
+
+// +--------------------------------------------------------------+
+// |                           Atomics                            |
+// +--------------------------------------------------------------+
+//NOTE: plat->InterlockedExchange is a function pointer call on a u32, too slow (and too small) for counters and ring buffer indices
+//      that get hit from every thread so we use the compiler intrinsics directly. Aligned 64-bit loads and stores are atomic on every platform we run on
+#if defined(_MSC_VER)
+#include <intrin.h> //_InterlockedExchangeAdd64, _ReadWriteBarrier
+#endif
+u64 PigAtomicLoadAcquire(const volatile u64* pntr)
+{
+	#if defined(_MSC_VER)
+	u64 result = *pntr;
+	_ReadWriteBarrier();
+	return result;
+	#else
+	return __atomic_load_n(pntr, __ATOMIC_ACQUIRE);
+	#endif
+}
+void PigAtomicStoreRelease(volatile u64* pntr, u64 value)
+{
+	#if defined(_MSC_VER)
+	_ReadWriteBarrier();
+	*pntr = value;
+	#else
+	__atomic_store_n(pntr, value, __ATOMIC_RELEASE);
+	#endif
+}
+//Returns the value before the add
+u64 PigAtomicFetchAdd(volatile u64* pntr, u64 value)
+{
+	#if defined(_MSC_VER)
+	return (u64)_InterlockedExchangeAdd64((volatile long long*)pntr, (long long)value);
+	#else
+	return __atomic_fetch_add(pntr, value, __ATOMIC_ACQ_REL);
+	#endif
+}
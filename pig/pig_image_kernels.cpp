@@ -0,0 +1,403 @@
+/*
+File:   pig_image_kernels.cpp
+Date:   10\19\2026
+Description:
+	** Holds the scalar, SSE2, and AVX2 versions of the pixel kernels declared in pig_image_kernels.h.
+	** All of them work on tightly packed little endian RGBA8 pixels (alpha in the top byte of a u32)
+	** and every path produces exactly the same output so callers never need to care which one ran
+*/
+
+// +--------------------------------------------------------------+
+// |                        CPU Detection                         |
+// +--------------------------------------------------------------+
+bool ImageKernelsSupportAvx2()
+{
+	#if IMAGE_KERNELS_AVX2
+	static i32 cachedResult = -1;
+	if (cachedResult < 0)
+	{
+		#if defined(_MSC_VER)
+		bool result = false;
+		int cpuInfo[4];
+		__cpuid(cpuInfo, 0);
+		if (cpuInfo[0] >= 7)
+		{
+			__cpuid(cpuInfo, 1);
+			bool osUsesXsave = ((cpuInfo[2] & (1 << 27)) != 0);
+			bool hasAvx = ((cpuInfo[2] & (1 << 28)) != 0);
+			if (osUsesXsave && hasAvx && (_xgetbv(0) & 0x06) == 0x06) //the OS has to be saving the ymm registers on context switch
+			{
+				__cpuidex(cpuInfo, 7, 0);
+				result = ((cpuInfo[1] & (1 << 5)) != 0);
+			}
+		}
+		cachedResult = (result ? 1 : 0);
+		#else
+		__builtin_cpu_init();
+		cachedResult = (__builtin_cpu_supports("avx2") ? 1 : 0);
+		#endif
+	}
+	return (cachedResult != 0);
+	#else
+	return false;
+	#endif
+}
+
+bool IsImageKernelPathSupported(ImageKernelPath_t path)
+{
+	switch (path)
+	{
+		case ImageKernelPath_Auto:   return true;
+		case ImageKernelPath_Scalar: return true;
+		case ImageKernelPath_Sse2:   return (IMAGE_KERNELS_SSE2 != 0);
+		case ImageKernelPath_Avx2:   return ImageKernelsSupportAvx2();
+		default: return false;
+	}
+}
+
+//Turns Auto into the fastest supported path and steps down from paths the CPU can't run
+ImageKernelPath_t ResolveImageKernelPath(ImageKernelPath_t path)
+{
+	if (path == ImageKernelPath_Auto) { path = ImageKernelPath_Avx2; }
+	if (path == ImageKernelPath_Avx2 && !ImageKernelsSupportAvx2()) { path = ImageKernelPath_Sse2; }
+	if (path == ImageKernelPath_Sse2 && !IMAGE_KERNELS_SSE2) { path = ImageKernelPath_Scalar; }
+	return path;
+}
+
+// +--------------------------------------------------------------+
+// |                       Scalar Kernels                         |
+// +--------------------------------------------------------------+
+bool ImageCopyRow_Scalar(u32* dest, const u32* source, u64 numPixels)
+{
+	u32 alphaAccum = 0;
+	for (u64 pIndex = 0; pIndex < numPixels; pIndex++)
+	{
+		dest[pIndex] = source[pIndex];
+		alphaAccum |= source[pIndex];
+	}
+	return ((alphaAccum & 0xFF000000) != 0);
+}
+bool ImageRowHasAlpha_Scalar(const u32* pixels, u64 numPixels)
+{
+	for (u64 pIndex = 0; pIndex < numPixels; pIndex++)
+	{
+		if ((pixels[pIndex] & 0xFF000000) != 0) { return true; }
+	}
+	return false;
+}
+inline u32 ImagePremultiplyChannel(u32 value, u32 alpha)
+{
+	//Exact round(value*alpha/255) without a divide
+	u32 temp = (value * alpha) + 128;
+	return ((temp + (temp >> 8)) >> 8);
+}
+void ImagePremultiplyAlpha_Scalar(u32* pixels, u64 numPixels)
+{
+	for (u64 pIndex = 0; pIndex < numPixels; pIndex++)
+	{
+		u32 pixel = pixels[pIndex];
+		u32 alpha = (pixel >> 24);
+		u32 red   = ImagePremultiplyChannel((pixel >>  0) & 0xFF, alpha);
+		u32 green = ImagePremultiplyChannel((pixel >>  8) & 0xFF, alpha);
+		u32 blue  = ImagePremultiplyChannel((pixel >> 16) & 0xFF, alpha);
+		pixels[pIndex] = (red << 0) | (green << 8) | (blue << 16) | (alpha << 24);
+	}
+}
+void ImageSwizzleRedBlue_Scalar(u32* dest, const u32* source, u64 numPixels)
+{
+	for (u64 pIndex = 0; pIndex < numPixels; pIndex++)
+	{
+		u32 pixel = source[pIndex];
+		dest[pIndex] = (pixel & 0xFF00FF00) | ((pixel >> 16) & 0x000000FF) | ((pixel & 0x000000FF) << 16);
+	}
+}
+//Fills dstPixels[dstStartX, dstSize.width) of one destination row. Odd sizes reuse the last source row/column rather than reading past the edge
+void ImageDownsampleBoxRow_Scalar(const u8* srcRow0, const u8* srcRow1, i32 srcWidth, u8* dstRow, i32 dstStartX, i32 dstWidth)
+{
+	for (i32 xPos = dstStartX; xPos < dstWidth; xPos++)
+	{
+		i32 srcX0 = MinI32(xPos*2, srcWidth-1);
+		i32 srcX1 = MinI32(xPos*2 + 1, srcWidth-1);
+		const u8* pixel00 = &srcRow0[(u64)srcX0 * sizeof(u32)];
+		const u8* pixel10 = &srcRow0[(u64)srcX1 * sizeof(u32)];
+		const u8* pixel01 = &srcRow1[(u64)srcX0 * sizeof(u32)];
+		const u8* pixel11 = &srcRow1[(u64)srcX1 * sizeof(u32)];
+		u8* dstPixel = &dstRow[(u64)xPos * sizeof(u32)];
+		for (u64 cIndex = 0; cIndex < 4; cIndex++)
+		{
+			dstPixel[cIndex] = (u8)(((u32)pixel00[cIndex] + (u32)pixel10[cIndex] + (u32)pixel01[cIndex] + (u32)pixel11[cIndex] + 2) / 4);
+		}
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                         SSE2 Kernels                         |
+// +--------------------------------------------------------------+
+#if IMAGE_KERNELS_SSE2
+bool ImageCopyRow_Sse2(u32* dest, const u32* source, u64 numPixels)
+{
+	__m128i alphaAccum = _mm_setzero_si128();
+	u64 pIndex = 0;
+	for (; pIndex + 4 <= numPixels; pIndex += 4)
+	{
+		__m128i pixels = _mm_loadu_si128((const __m128i*)&source[pIndex]);
+		_mm_storeu_si128((__m128i*)&dest[pIndex], pixels);
+		alphaAccum = _mm_or_si128(alphaAccum, pixels);
+	}
+	alphaAccum = _mm_and_si128(alphaAccum, _mm_set1_epi32((int)0xFF000000));
+	bool result = (_mm_movemask_epi8(_mm_cmpeq_epi32(alphaAccum, _mm_setzero_si128())) != 0xFFFF);
+	if (ImageCopyRow_Scalar(&dest[pIndex], &source[pIndex], numPixels - pIndex)) { result = true; }
+	return result;
+}
+bool ImageRowHasAlpha_Sse2(const u32* pixels, u64 numPixels)
+{
+	const __m128i alphaMask = _mm_set1_epi32((int)0xFF000000);
+	u64 pIndex = 0;
+	//Check 16 pixels at a time so the early out branch doesn't dominate the loop
+	for (; pIndex + 16 <= numPixels; pIndex += 16)
+	{
+		__m128i accum = _mm_or_si128(
+			_mm_or_si128(_mm_loadu_si128((const __m128i*)&pixels[pIndex + 0]), _mm_loadu_si128((const __m128i*)&pixels[pIndex + 4])),
+			_mm_or_si128(_mm_loadu_si128((const __m128i*)&pixels[pIndex + 8]), _mm_loadu_si128((const __m128i*)&pixels[pIndex + 12]))
+		);
+		accum = _mm_and_si128(accum, alphaMask);
+		if (_mm_movemask_epi8(_mm_cmpeq_epi32(accum, _mm_setzero_si128())) != 0xFFFF) { return true; }
+	}
+	return ImageRowHasAlpha_Scalar(&pixels[pIndex], numPixels - pIndex);
+}
+void ImagePremultiplyAlpha_Sse2(u32* pixels, u64 numPixels)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i alphaMask = _mm_set1_epi32((int)0xFF000000);
+	const __m128i rounding = _mm_set1_epi16(128);
+	u64 pIndex = 0;
+	for (; pIndex + 4 <= numPixels; pIndex += 4)
+	{
+		__m128i source = _mm_loadu_si128((const __m128i*)&pixels[pIndex]);
+		__m128i low = _mm_unpacklo_epi8(source, zero); //2 pixels as 8 u16 channels
+		__m128i high = _mm_unpackhi_epi8(source, zero);
+		__m128i lowAlpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(low, 0xFF), 0xFF); //broadcast each pixel's alpha to its 4 channels
+		__m128i highAlpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(high, 0xFF), 0xFF);
+		low = _mm_add_epi16(_mm_mullo_epi16(low, lowAlpha), rounding);
+		high = _mm_add_epi16(_mm_mullo_epi16(high, highAlpha), rounding);
+		low = _mm_srli_epi16(_mm_add_epi16(low, _mm_srli_epi16(low, 8)), 8);
+		high = _mm_srli_epi16(_mm_add_epi16(high, _mm_srli_epi16(high, 8)), 8);
+		__m128i result = _mm_packus_epi16(low, high);
+		result = _mm_or_si128(_mm_andnot_si128(alphaMask, result), _mm_and_si128(alphaMask, source));
+		_mm_storeu_si128((__m128i*)&pixels[pIndex], result);
+	}
+	ImagePremultiplyAlpha_Scalar(&pixels[pIndex], numPixels - pIndex);
+}
+void ImageSwizzleRedBlue_Sse2(u32* dest, const u32* source, u64 numPixels)
+{
+	const __m128i keepMask = _mm_set1_epi32((int)0xFF00FF00);
+	const __m128i lowMask = _mm_set1_epi32(0x000000FF);
+	u64 pIndex = 0;
+	for (; pIndex + 4 <= numPixels; pIndex += 4)
+	{
+		__m128i pixels = _mm_loadu_si128((const __m128i*)&source[pIndex]);
+		__m128i result = _mm_and_si128(pixels, keepMask);
+		result = _mm_or_si128(result, _mm_and_si128(_mm_srli_epi32(pixels, 16), lowMask));
+		result = _mm_or_si128(result, _mm_slli_epi32(_mm_and_si128(pixels, lowMask), 16));
+		_mm_storeu_si128((__m128i*)&dest[pIndex], result);
+	}
+	ImageSwizzleRedBlue_Scalar(&dest[pIndex], &source[pIndex], numPixels - pIndex);
+}
+//Produces 4 destination pixels per iteration from 8x2 source pixels, the odd column at the end (if any) is left to the scalar loop
+void ImageDownsampleBoxRow_Sse2(const u8* srcRow0, const u8* srcRow1, i32 srcWidth, u8* dstRow, i32 dstWidth)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i rounding = _mm_set1_epi16(2);
+	i32 numFullPairs = MinI32(srcWidth / 2, dstWidth);
+	i32 xPos = 0;
+	for (; xPos + 4 <= numFullPairs; xPos += 4)
+	{
+		const u8* source0 = &srcRow0[(u64)(xPos*2) * sizeof(u32)];
+		const u8* source1 = &srcRow1[(u64)(xPos*2) * sizeof(u32)];
+		__m128i row0a = _mm_loadu_si128((const __m128i*)&source0[0]);
+		__m128i row0b = _mm_loadu_si128((const __m128i*)&source0[16]);
+		__m128i row1a = _mm_loadu_si128((const __m128i*)&source1[0]);
+		__m128i row1b = _mm_loadu_si128((const __m128i*)&source1[16]);
+		//Vertical sums, 2 source pixels per register as u16 channels
+		__m128i sum0 = _mm_add_epi16(_mm_unpacklo_epi8(row0a, zero), _mm_unpacklo_epi8(row1a, zero));
+		__m128i sum1 = _mm_add_epi16(_mm_unpackhi_epi8(row0a, zero), _mm_unpackhi_epi8(row1a, zero));
+		__m128i sum2 = _mm_add_epi16(_mm_unpacklo_epi8(row0b, zero), _mm_unpacklo_epi8(row1b, zero));
+		__m128i sum3 = _mm_add_epi16(_mm_unpackhi_epi8(row0b, zero), _mm_unpackhi_epi8(row1b, zero));
+		//Horizontal sums, the neighboring pixel is in the upper 64 bits of each register
+		sum0 = _mm_add_epi16(sum0, _mm_srli_si128(sum0, 8));
+		sum1 = _mm_add_epi16(sum1, _mm_srli_si128(sum1, 8));
+		sum2 = _mm_add_epi16(sum2, _mm_srli_si128(sum2, 8));
+		sum3 = _mm_add_epi16(sum3, _mm_srli_si128(sum3, 8));
+		__m128i result01 = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(sum0, sum1), rounding), 2);
+		__m128i result23 = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(sum2, sum3), rounding), 2);
+		_mm_storeu_si128((__m128i*)&dstRow[(u64)xPos * sizeof(u32)], _mm_packus_epi16(result01, result23));
+	}
+	ImageDownsampleBoxRow_Scalar(srcRow0, srcRow1, srcWidth, dstRow, xPos, dstWidth);
+}
+#endif //IMAGE_KERNELS_SSE2
+
+// +--------------------------------------------------------------+
+// |                         AVX2 Kernels                         |
+// +--------------------------------------------------------------+
+#if IMAGE_KERNELS_AVX2
+IMAGE_KERNELS_AVX2_FUNC bool ImageCopyRow_Avx2(u32* dest, const u32* source, u64 numPixels)
+{
+	__m256i alphaAccum = _mm256_setzero_si256();
+	u64 pIndex = 0;
+	for (; pIndex + 8 <= numPixels; pIndex += 8)
+	{
+		__m256i pixels = _mm256_loadu_si256((const __m256i*)&source[pIndex]);
+		_mm256_storeu_si256((__m256i*)&dest[pIndex], pixels);
+		alphaAccum = _mm256_or_si256(alphaAccum, pixels);
+	}
+	alphaAccum = _mm256_and_si256(alphaAccum, _mm256_set1_epi32((int)0xFF000000));
+	bool result = !_mm256_testz_si256(alphaAccum, alphaAccum);
+	if (ImageCopyRow_Scalar(&dest[pIndex], &source[pIndex], numPixels - pIndex)) { result = true; }
+	return result;
+}
+IMAGE_KERNELS_AVX2_FUNC bool ImageRowHasAlpha_Avx2(const u32* pixels, u64 numPixels)
+{
+	const __m256i alphaMask = _mm256_set1_epi32((int)0xFF000000);
+	u64 pIndex = 0;
+	for (; pIndex + 32 <= numPixels; pIndex += 32)
+	{
+		__m256i accum = _mm256_or_si256(
+			_mm256_or_si256(_mm256_loadu_si256((const __m256i*)&pixels[pIndex + 0]), _mm256_loadu_si256((const __m256i*)&pixels[pIndex + 8])),
+			_mm256_or_si256(_mm256_loadu_si256((const __m256i*)&pixels[pIndex + 16]), _mm256_loadu_si256((const __m256i*)&pixels[pIndex + 24]))
+		);
+		if (!_mm256_testz_si256(accum, alphaMask)) { return true; }
+	}
+	return ImageRowHasAlpha_Scalar(&pixels[pIndex], numPixels - pIndex);
+}
+IMAGE_KERNELS_AVX2_FUNC void ImagePremultiplyAlpha_Avx2(u32* pixels, u64 numPixels)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i alphaMask = _mm256_set1_epi32((int)0xFF000000);
+	const __m256i rounding = _mm256_set1_epi16(128);
+	u64 pIndex = 0;
+	for (; pIndex + 8 <= numPixels; pIndex += 8)
+	{
+		//NOTE: unpack and pack both work within 128-bit lanes so the pixel order comes back out the same
+		__m256i source = _mm256_loadu_si256((const __m256i*)&pixels[pIndex]);
+		__m256i low = _mm256_unpacklo_epi8(source, zero);
+		__m256i high = _mm256_unpackhi_epi8(source, zero);
+		__m256i lowAlpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(low, 0xFF), 0xFF);
+		__m256i highAlpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(high, 0xFF), 0xFF);
+		low = _mm256_add_epi16(_mm256_mullo_epi16(low, lowAlpha), rounding);
+		high = _mm256_add_epi16(_mm256_mullo_epi16(high, highAlpha), rounding);
+		low = _mm256_srli_epi16(_mm256_add_epi16(low, _mm256_srli_epi16(low, 8)), 8);
+		high = _mm256_srli_epi16(_mm256_add_epi16(high, _mm256_srli_epi16(high, 8)), 8);
+		__m256i result = _mm256_packus_epi16(low, high);
+		result = _mm256_or_si256(_mm256_andnot_si256(alphaMask, result), _mm256_and_si256(alphaMask, source));
+		_mm256_storeu_si256((__m256i*)&pixels[pIndex], result);
+	}
+	ImagePremultiplyAlpha_Scalar(&pixels[pIndex], numPixels - pIndex);
+}
+IMAGE_KERNELS_AVX2_FUNC void ImageSwizzleRedBlue_Avx2(u32* dest, const u32* source, u64 numPixels)
+{
+	const __m256i shuffle = _mm256_setr_epi8(
+		2, 1, 0, 3,  6, 5, 4, 7,  10, 9, 8, 11,  14, 13, 12, 15,
+		2, 1, 0, 3,  6, 5, 4, 7,  10, 9, 8, 11,  14, 13, 12, 15
+	);
+	u64 pIndex = 0;
+	for (; pIndex + 8 <= numPixels; pIndex += 8)
+	{
+		__m256i pixels = _mm256_loadu_si256((const __m256i*)&source[pIndex]);
+		_mm256_storeu_si256((__m256i*)&dest[pIndex], _mm256_shuffle_epi8(pixels, shuffle));
+	}
+	ImageSwizzleRedBlue_Scalar(&dest[pIndex], &source[pIndex], numPixels - pIndex);
+}
+#endif //IMAGE_KERNELS_AVX2
+
+// +--------------------------------------------------------------+
+// |                          Dispatch                            |
+// +--------------------------------------------------------------+
+//Copies numPixels and returns true if any of them had a non-zero alpha (this is how sprite sheets decide if a frame is filled)
+bool ImageCopyRow(u32* dest, const u32* source, u64 numPixels, ImageKernelPath_t path = ImageKernelPath_Auto)
+{
+	switch (ResolveImageKernelPath(path))
+	{
+		#if IMAGE_KERNELS_AVX2
+		case ImageKernelPath_Avx2: return ImageCopyRow_Avx2(dest, source, numPixels);
+		#endif
+		#if IMAGE_KERNELS_SSE2
+		case ImageKernelPath_Sse2: return ImageCopyRow_Sse2(dest, source, numPixels);
+		#endif
+		default: return ImageCopyRow_Scalar(dest, source, numPixels);
+	}
+}
+bool ImageRowHasAlpha(const u32* pixels, u64 numPixels, ImageKernelPath_t path = ImageKernelPath_Auto)
+{
+	switch (ResolveImageKernelPath(path))
+	{
+		#if IMAGE_KERNELS_AVX2
+		case ImageKernelPath_Avx2: return ImageRowHasAlpha_Avx2(pixels, numPixels);
+		#endif
+		#if IMAGE_KERNELS_SSE2
+		case ImageKernelPath_Sse2: return ImageRowHasAlpha_Sse2(pixels, numPixels);
+		#endif
+		default: return ImageRowHasAlpha_Scalar(pixels, numPixels);
+	}
+}
+void ImagePremultiplyAlpha(u32* pixels, u64 numPixels, ImageKernelPath_t path = ImageKernelPath_Auto)
+{
+	switch (ResolveImageKernelPath(path))
+	{
+		#if IMAGE_KERNELS_AVX2
+		case ImageKernelPath_Avx2: ImagePremultiplyAlpha_Avx2(pixels, numPixels); break;
+		#endif
+		#if IMAGE_KERNELS_SSE2
+		case ImageKernelPath_Sse2: ImagePremultiplyAlpha_Sse2(pixels, numPixels); break;
+		#endif
+		default: ImagePremultiplyAlpha_Scalar(pixels, numPixels); break;
+	}
+}
+//RGBA <-> BGRA, dest and source are allowed to be the same buffer
+void ImageSwizzleRedBlue(u32* dest, const u32* source, u64 numPixels, ImageKernelPath_t path = ImageKernelPath_Auto)
+{
+	switch (ResolveImageKernelPath(path))
+	{
+		#if IMAGE_KERNELS_AVX2
+		case ImageKernelPath_Avx2: ImageSwizzleRedBlue_Avx2(dest, source, numPixels); break;
+		#endif
+		#if IMAGE_KERNELS_SSE2
+		case ImageKernelPath_Sse2: ImageSwizzleRedBlue_Sse2(dest, source, numPixels); break;
+		#endif
+		default: ImageSwizzleRedBlue_Scalar(dest, source, numPixels); break;
+	}
+}
+
+//Copies numRows rows of rowBytes each between two images with different strides
+void ImageCopyBlock(u8* dest, u64 destRowSize, const u8* source, u64 sourceRowSize, u64 rowBytes, u64 numRows)
+{
+	NotNull2(dest, source);
+	Assert(rowBytes <= destRowSize && rowBytes <= sourceRowSize);
+	if (destRowSize == rowBytes && sourceRowSize == rowBytes)
+	{
+		MyMemCopy(dest, source, rowBytes * numRows);
+		return;
+	}
+	for (u64 rIndex = 0; rIndex < numRows; rIndex++)
+	{
+		MyMemCopy(&dest[rIndex * destRowSize], &source[rIndex * sourceRowSize], rowBytes);
+	}
+}
+
+//2x2 box filter for one mip level. dstPixels is tightly packed (dstSize.width*4 bytes per row)
+void ImageDownsampleBox(const u8* srcPixels, v2i srcSize, u64 srcRowSize, u8* dstPixels, v2i dstSize, ImageKernelPath_t path = ImageKernelPath_Auto)
+{
+	NotNull2(srcPixels, dstPixels);
+	bool useSse2 = (ResolveImageKernelPath(path) != ImageKernelPath_Scalar); //there's no AVX2 version, the SSE2 one is already memory bound
+	for (i32 yPos = 0; yPos < dstSize.height; yPos++)
+	{
+		const u8* srcRow0 = &srcPixels[(u64)MinI32(yPos*2, srcSize.height-1) * srcRowSize];
+		const u8* srcRow1 = &srcPixels[(u64)MinI32(yPos*2 + 1, srcSize.height-1) * srcRowSize];
+		u8* dstRow = &dstPixels[(u64)yPos * (u64)dstSize.width * sizeof(u32)];
+		#if IMAGE_KERNELS_SSE2
+		if (useSse2) { ImageDownsampleBoxRow_Sse2(srcRow0, srcRow1, srcSize.width, dstRow, dstSize.width); continue; }
+		#else
+		UNUSED(useSse2);
+		#endif
+		ImageDownsampleBoxRow_Scalar(srcRow0, srcRow1, srcSize.width, dstRow, 0, dstSize.width);
+	}
+}
@@ -0,0 +1,61 @@
+/*
+File:   pig_image_kernels.h
+Date:   10\19\2026
+Description:
+	** Small set of RGBA8 pixel kernels (row copies, alpha checks, premultiply, swizzle, box filter downsample)
+	** that the texture, sprite sheet, and texture cooking code run their inner loops through.
+	** Each kernel has a scalar version that every platform can use, an SSE2 version that any x86-64
+	** build can use, and (for the simple ones) an AVX2 version that's picked at runtime if the CPU supports it
+*/
+
+#ifndef _PIG_IMAGE_KERNELS_H
+#define _PIG_IMAGE_KERNELS_H
+
+#if !WASM_COMPILATION && (defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__))
+#define IMAGE_KERNELS_SSE2 1
+#else
+#define IMAGE_KERNELS_SSE2 0
+#endif
+
+#if IMAGE_KERNELS_SSE2 && (defined(_MSC_VER) || defined(__GNUC__) || defined(__clang__))
+#define IMAGE_KERNELS_AVX2 1
+#else
+#define IMAGE_KERNELS_AVX2 0
+#endif
+
+#if IMAGE_KERNELS_SSE2
+#include <emmintrin.h>
+#endif
+#if IMAGE_KERNELS_AVX2
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+//MSVC lets us use AVX2 intrinsics in any function, the caller is responsible for checking the CPU first
+#define IMAGE_KERNELS_AVX2_FUNC
+#else
+//GCC and Clang need to be told per-function that they can emit AVX2 instructions without enabling them for the whole build
+#define IMAGE_KERNELS_AVX2_FUNC __attribute__((target("avx2")))
+#endif
+#endif
+
+enum ImageKernelPath_t
+{
+	ImageKernelPath_Auto = 0, //the fastest path the current CPU supports
+	ImageKernelPath_Scalar,
+	ImageKernelPath_Sse2,
+	ImageKernelPath_Avx2,
+	ImageKernelPath_NumPaths,
+};
+const char* GetImageKernelPathStr(ImageKernelPath_t path)
+{
+	switch (path)
+	{
+		case ImageKernelPath_Auto:   return "Auto";
+		case ImageKernelPath_Scalar: return "Scalar";
+		case ImageKernelPath_Sse2:   return "SSE2";
+		case ImageKernelPath_Avx2:   return "AVX2";
+		default: return "Unknown";
+	}
+}
+
+#endif //  _PIG_IMAGE_KERNELS_H
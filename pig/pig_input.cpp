@@ -10,21 +10,183 @@ Description:
 // +--------------------------------------------------------------+
 // |                         Constructors                         |
 // +--------------------------------------------------------------+
-void FreeMouseHitInfo(MouseHitInfo_t* info)
+//Names longer than the mouseHitNames buffers are cut off before they are hashed, stored or compared
+MyStr_t TruncateMouseHitName(MyStr_t name)
 {
-	NotNull(info);
-	FreeString(fixedHeap, &info->name);
-	ClearPointer(info);
+	if (name.length > MOUSE_HIT_NAME_BUFFER_SIZE-1) { name.length = MOUSE_HIT_NAME_BUFFER_SIZE-1; }
+	return name;
+}
+u64 HashMouseHitName(MyStr_t name)
+{
+	name = TruncateMouseHitName(name);
+	if (name.length == 0) { return 0; }
+	NotNull(name.pntr);
+	u64 result = FnvHashU64(name.pntr, name.length);
+	return (result != 0) ? result : 1;
+}
+u64 GetMouseHitId(u64 nameHash, const void* pntr, u64 index)
+{
+	u64 result = (nameHash != 0) ? FnvHashU64(&pntr, sizeof(pntr), nameHash) : FnvHashU64(&pntr, sizeof(pntr));
+	result = FnvHashU64(&index, sizeof(index), result);
+	return (result != 0) ? result : 1;
+}
+u64 GetMouseHitId(const char* hitItemName, u64 index = 0)
+{
+	NotNull(hitItemName);
+	return GetMouseHitId(HashMouseHitName(NewStr(hitItemName)), nullptr, index);
+}
+u64 GetMouseHitId(const void* hitItemPntr, u64 index = 0)
+{
+	return GetMouseHitId(0, hitItemPntr, index);
+}
+
+//Formats into a caller provided buffer of MOUSE_HIT_NAME_BUFFER_SIZE chars so printed names never touch an arena
+MyStr_t PrintMouseHitNameVa(char* bufferPntr, const char* formatString, va_list args)
+{
+	NotNull2(bufferPntr, formatString);
+	int printResult = MyVaListPrintf(bufferPntr, MOUSE_HIT_NAME_BUFFER_SIZE, formatString, args);
+	DebugAssert(printResult >= 0);
+	if (printResult < 0) { return NewStr(formatString); }
+	u64 nameLength = ((u64)printResult < MOUSE_HIT_NAME_BUFFER_SIZE) ? (u64)printResult : (MOUSE_HIT_NAME_BUFFER_SIZE-1);
+	bufferPntr[nameLength] = '\0';
+	return NewStr(nameLength, bufferPntr);
+}
+#define PrintMouseHitName(bufferName, nameVarName, formatString) \
+	char bufferName[MOUSE_HIT_NAME_BUFFER_SIZE];                    \
+	MyStr_t nameVarName;                                            \
+	do                                                              \
+	{                                                               \
+		va_list args;                                               \
+		va_start(args, formatString);                               \
+		nameVarName = PrintMouseHitNameVa(bufferName, (formatString), args); \
+		va_end(args);                                               \
+	} while(0)
+
+//nameBuffer must hold MOUSE_HIT_NAME_BUFFER_SIZE chars and stay alive as long as the info does (see pig->mouseHitNames)
+void ClearMouseHitInfo(MouseHitInfo_t* info, char* nameBuffer)
+{
+	NotNull2(info, nameBuffer);
+	info->priority = 0;
+	info->window = nullptr;
+	info->id = 0;
+	info->nameHash = 0;
+	info->nameLength = 0;
+	info->name = nameBuffer;
+	info->name[0] = '\0';
+	info->pntr = nullptr;
+	info->index = 0;
 }
 void CreateMouseHitInfo(const PlatWindow_t* window, u64 priority, MyStr_t name, const void* pntr, u64 index, MouseHitInfo_t* infoOut)
 {
-	NotNull(infoOut);
-	ClearPointer(infoOut);
+	NotNull2(infoOut, infoOut->name);
+	name = TruncateMouseHitName(name);
 	infoOut->window = window;
 	infoOut->priority = priority;
-	infoOut->name = (name.pntr != nullptr) ? AllocString(fixedHeap, &name) : MyStr_Empty;
+	infoOut->nameHash = HashMouseHitName(name);
+	infoOut->nameLength = name.length;
+	if (name.length > 0 && name.pntr != infoOut->name) { MyMemCopy(infoOut->name, name.pntr, name.length); }
+	infoOut->name[name.length] = '\0';
 	infoOut->pntr = pntr;
 	infoOut->index = index;
+	infoOut->id = GetMouseHitId(infoOut->nameHash, pntr, index);
+}
+
+MyStr_t GetMouseHitName(const MouseHitInfo_t* info)
+{
+	NotNull(info);
+	if (info->name == nullptr) { return MyStr_Empty; }
+	return NewStr(info->nameLength, info->name);
+}
+
+// +--------------------------------------------------------------+
+// |                        Mouse Hit Grid                        |
+// +--------------------------------------------------------------+
+void MouseHitGridStartFrame(MouseHitGrid_t* grid)
+{
+	NotNull(grid);
+	grid->resolvedThisFrame = false;
+	grid->blockingPriority = 0;
+	if (!grid->enabled) { return; }
+	grid->currentFrameIndex = (grid->currentFrameIndex + 1) % ArrayCount(grid->frames);
+	MouseHitGridFrame_t* frame = &grid->frames[grid->currentFrameIndex];
+	frame->window = nullptr;
+	VarArrayClear(&frame->entries);
+	VarArrayClear(&frame->nodes);
+	MyMemSet(&frame->cellHeads[0][0], 0x00, sizeof(frame->cellHeads));
+}
+
+v2i GetMouseHitGridCell(v2 position)
+{
+	return NewVec2i(
+		ClampI32(FloorR32i(position.x / MOUSE_HIT_GRID_CELL_SIZE), 0, MOUSE_HIT_GRID_MAX_CELLS_X-1),
+		ClampI32(FloorR32i(position.y / MOUSE_HIT_GRID_CELL_SIZE), 0, MOUSE_HIT_GRID_MAX_CELLS_Y-1)
+	);
+}
+
+void MouseHitGridRegister(MouseHitGrid_t* grid, const PlatWindow_t* window, rec rectangle, u64 priority)
+{
+	NotNull(grid);
+	if (!grid->enabled) { return; }
+	MouseHitGridFrame_t* frame = &grid->frames[grid->currentFrameIndex];
+	if (frame->window == nullptr) { frame->window = window; }
+	if (frame->window != window) { return; } //only the first window to register each frame is tracked
+	if (rectangle.width <= 0 || rectangle.height <= 0) { return; }
+	
+	u32 entryIndex = (u32)frame->entries.length;
+	MouseHitGridEntry_t* entry = VarArrayAdd(&frame->entries, MouseHitGridEntry_t);
+	NotNull(entry);
+	entry->priority = priority;
+	entry->rectangle = rectangle;
+	
+	v2i minCell = GetMouseHitGridCell(rectangle.topLeft);
+	v2i maxCell = GetMouseHitGridCell(rectangle.topLeft + rectangle.size);
+	for (i32 cellY = minCell.y; cellY <= maxCell.y; cellY++)
+	{
+		for (i32 cellX = minCell.x; cellX <= maxCell.x; cellX++)
+		{
+			MouseHitGridNode_t* node = VarArrayAdd(&frame->nodes, MouseHitGridNode_t);
+			NotNull(node);
+			node->entryIndex = entryIndex;
+			node->nextNodeIndex = frame->cellHeads[cellY][cellX];
+			frame->cellHeads[cellY][cellX] = (u32)frame->nodes.length;
+		}
+	}
+}
+
+//Returns the highest priority of the rectangles under position in the given frame, or 0 if there aren't any
+u64 MouseHitGridQuery(const MouseHitGridFrame_t* frame, v2 position)
+{
+	NotNull(frame);
+	u64 result = 0;
+	v2i cell = GetMouseHitGridCell(position);
+	u32 nodeIndexPlusOne = frame->cellHeads[cell.y][cell.x];
+	while (nodeIndexPlusOne != 0)
+	{
+		const MouseHitGridNode_t* node = VarArrayGet(&frame->nodes, nodeIndexPlusOne-1, MouseHitGridNode_t);
+		const MouseHitGridEntry_t* entry = VarArrayGet(&frame->entries, node->entryIndex, MouseHitGridEntry_t);
+		if (entry->priority > result && IsInsideRec(entry->rectangle, position)) { result = entry->priority; }
+		nodeIndexPlusOne = node->nextNodeIndex;
+	}
+	return result;
+}
+
+//Returns false if a rectangle with a higher priority was under the mouse last frame
+bool MouseHitGridAllows(MouseHitGrid_t* grid, u64 priority)
+{
+	NotNull(grid);
+	if (!grid->enabled) { return true; }
+	const MouseHitGridFrame_t* prevFrame = &grid->frames[(grid->currentFrameIndex + 1) % ArrayCount(grid->frames)];
+	if (prevFrame->window == nullptr || prevFrame->window != pig->currentWindow) { return true; }
+	if (!grid->resolvedThisFrame)
+	{
+		//MousePos is only correct once the window we're asking about is current, so this happens lazily
+		grid->resolvedThisFrame = true;
+		if (pig->currentWindow->input.mouseInsideWindow)
+		{
+			grid->blockingPriority = MouseHitGridQuery(prevFrame, MousePos);
+		}
+	}
+	return (priority >= grid->blockingPriority);
 }
 
 // +--------------------------------------------------------------+
@@ -33,8 +195,16 @@ void CreateMouseHitInfo(const PlatWindow_t* window, u64 priority, MyStr_t name,
 void Pig_InitializeInput()
 {
 	NotNull(pig);
-	CreateMouseHitInfo(nullptr, 0, MyStr_Empty, nullptr, 0, &pig->mouseHit);
-	CreateMouseHitInfo(nullptr, 0, MyStr_Empty, nullptr, 0, &pig->prevMouseHit);
+	ClearMouseHitInfo(&pig->mouseHit, &pig->mouseHitNames[0][0]);
+	ClearMouseHitInfo(&pig->prevMouseHit, &pig->mouseHitNames[1][0]);
+	
+	ClearStruct(pig->mouseHitGrid);
+	pig->mouseHitGrid.enabled = PIG_MOUSE_HIT_GRID;
+	for (u64 fIndex = 0; fIndex < ArrayCount(pig->mouseHitGrid.frames); fIndex++)
+	{
+		CreateVarArray(&pig->mouseHitGrid.frames[fIndex].entries, mainHeap, sizeof(MouseHitGridEntry_t));
+		CreateVarArray(&pig->mouseHitGrid.frames[fIndex].nodes, mainHeap, sizeof(MouseHitGridNode_t));
+	}
 	
 	pig->focusedItemPntr = nullptr;
 	pig->focusedItemName = MyStr_Empty;
@@ -93,9 +263,9 @@ void Pig_UpdateInputBefore()
 	// +==============================+
 	// |       Update MouseHit        |
 	// +==============================+
-	FreeMouseHitInfo(&pig->prevMouseHit);
 	MyMemCopy(&pig->prevMouseHit, &pig->mouseHit, sizeof(MouseHitInfo_t));
-	CreateMouseHitInfo(nullptr, 0, MyStr_Empty, nullptr, 0, &pig->mouseHit);
+	ClearMouseHitInfo(&pig->mouseHit, (pig->prevMouseHit.name == &pig->mouseHitNames[0][0]) ? &pig->mouseHitNames[1][0] : &pig->mouseHitNames[0][0]);
+	MouseHitGridStartFrame(&pig->mouseHitGrid);
 	
 	// +==============================+
 	// |     Clear Handled Arrays     |
@@ -140,15 +310,16 @@ void Pig_InputRenderDebugInfo()
 	#if 0
 	if (pig->mouseHit.priority > 0)
 	{
-		if (!IsEmptyStr(pig->mouseHit.name))
+		MyStr_t mouseHitName = GetMouseHitName(&pig->mouseHit);
+		if (!IsEmptyStr(mouseHitName))
 		{
 			if (pig->mouseHit.index != 0)
 			{
-				plat->DebugReadout(TempPrintStr("MouseHover: %s[%llu]", pig->mouseHit.name.pntr, pig->mouseHit.index), White, 1.0f);
+				plat->DebugReadout(TempPrintStr("MouseHover: %.*s[%llu]", StrPrint(mouseHitName), pig->mouseHit.index), White, 1.0f);
 			}
 			else
 			{
-				plat->DebugReadout(TempPrintStr("MouseHover: %s", pig->mouseHit.name.pntr), White, 1.0f);
+				plat->DebugReadout(TempPrintStr("MouseHover: %.*s", StrPrint(mouseHitName)), White, 1.0f);
 			}
 		}
 		else if (pig->mouseHit.pntr != nullptr)
@@ -310,11 +481,18 @@ bool DidMouseMove()
 // +==============================+
 // |    Mouse Capture Helpers     |
 // +==============================+
+//Every MouseHit variant checks this before it takes pig->mouseHit. Equal priority goes to whoever asked first
+bool CanWinMouseHit(u64 priority)
+{
+	NotNull(pig);
+	if (pig->mouseHit.priority >= priority) { return false; }
+	return MouseHitGridAllows(&pig->mouseHitGrid, priority);
+}
 bool MouseHitNamedIndex(const char* hitItemName, u64 index, u64 priority = 1)
 {
 	NotNull(pig);
 	NotNull(hitItemName);
-	if (pig->mouseHit.priority < priority)
+	if (CanWinMouseHit(priority))
 	{
 		CreateMouseHitInfo(pig->currentWindow, priority, NewStr(hitItemName), nullptr, index, &pig->mouseHit);
 		return true;
@@ -329,17 +507,12 @@ bool MouseHitPrintIndexPriority(u64 index, u64 priority, const char* formatStrin
 {
 	NotNull(pig);
 	NotNull(formatString);
-	TempPushMark();
-	if (pig->mouseHit.priority < priority)
-	{
-		TempPrintVa(printResult, printLength, formatString);
-		DebugAssert(printResult != nullptr);
-		if (printResult == nullptr) { printResult = (char*)formatString; printLength = (i32)MyStrLength32(formatString); }
-		CreateMouseHitInfo(pig->currentWindow, priority, NewStr(printLength, printResult), nullptr, index, &pig->mouseHit);
-		TempPopMark();
+	if (CanWinMouseHit(priority))
+	{
+		PrintMouseHitName(nameBuffer, hitItemName, formatString);
+		CreateMouseHitInfo(pig->currentWindow, priority, hitItemName, nullptr, index, &pig->mouseHit);
 		return true;
 	}
-	TempPopMark();
 	return false;
 }
 #define MouseHitPrintIndex(index, formatString, ...) MouseHitPrintIndexPriority((index), 1, formatString, ##__VA_ARGS__)
@@ -348,7 +521,7 @@ bool MouseHitPntrIndex(const void* hitItemPntr, u64 index, u64 priority = 1)
 {
 	NotNull(pig);
 	NotNull(hitItemPntr);
-	if (pig->mouseHit.priority < priority)
+	if (CanWinMouseHit(priority))
 	{
 		CreateMouseHitInfo(pig->currentWindow, priority, MyStr_Empty, hitItemPntr, index, &pig->mouseHit);
 		return true;
@@ -360,45 +533,42 @@ bool MouseHitPntr(const void* hitItemPntr, u64 priority = 1)
 	return MouseHitPntrIndex(hitItemPntr, 0, priority);
 }
 
+//The rectangle variants also record the rectangle in the mouse hit grid (if enabled), whether the mouse is inside it or not
 bool MouseHitRecNamedIndex(rec rectangle, const char* hitItemName, u64 index, u64 priority = 1)
 {
+	MouseHitGridRegister(&pig->mouseHitGrid, pig->currentWindow, rectangle, priority);
 	if (!IsMouseInsideRec(rectangle)) { return false; }
 	return MouseHitNamedIndex(hitItemName, index, priority);
 }
 bool MouseHitRecNamed(rec rectangle, const char* hitItemName, u64 priority = 1)
 {
-	if (!IsMouseInsideRec(rectangle)) { return false; }
-	return MouseHitNamed(hitItemName, priority);
+	return MouseHitRecNamedIndex(rectangle, hitItemName, 0, priority);
 }
 bool MouseHitRecPrintIndexPriority(rec rectangle, u64 index, u64 priority, const char* formatString, ...)
 {
 	NotNull(pig);
 	NotNull(formatString);
+	MouseHitGridRegister(&pig->mouseHitGrid, pig->currentWindow, rectangle, priority);
 	if (!IsMouseInsideRec(rectangle)) { return false; }
-	TempPushMark();
-	if (pig->mouseHit.priority < priority)
-	{
-		TempPrintVa(printResult, printLength, formatString);
-		DebugAssert(printResult != nullptr);
-		if (printResult == nullptr) { printResult = (char*)formatString; printLength = (i32)MyStrLength32(formatString); }
-		CreateMouseHitInfo(pig->currentWindow, priority, NewStr(printLength, printResult), nullptr, index, &pig->mouseHit);
-		TempPopMark();
+	if (CanWinMouseHit(priority))
+	{
+		PrintMouseHitName(nameBuffer, hitItemName, formatString);
+		CreateMouseHitInfo(pig->currentWindow, priority, hitItemName, nullptr, index, &pig->mouseHit);
 		return true;
 	}
-	TempPopMark();
 	return false;
 }
 #define MouseHitRecPrintIndex(rectangle, index, formatString, ...) MouseHitRecPrintIndexPriority((rectangle), (index), 1, formatString, ##__VA_ARGS__)
 #define MouseHitRecPrint(rectangle, formatString, ...) MouseHitRecPrintIndexPriority((rectangle), 0, 1, formatString, ##__VA_ARGS__)
 bool MouseHitRecPntrIndex(rec rectangle, const void* hitItemPntr, u64 index, u64 priority = 1)
 {
+	MouseHitGridRegister(&pig->mouseHitGrid, pig->currentWindow, rectangle, priority);
 	if (!IsMouseInsideRec(rectangle)) { return false; }
 	return MouseHitPntrIndex(hitItemPntr, index, priority);
 }
 bool MouseHitRecPntr(rec rectangle, const void* hitItemPntr, u64 priority = 1)
 {
-	if (!IsMouseInsideRec(rectangle)) { return false; }
-	return MouseHitPntr(hitItemPntr, priority);
+	return MouseHitRecPntrIndex(rectangle, hitItemPntr, 0, priority);
 }
 
 // +==============================+
@@ -409,26 +579,33 @@ bool IsMouseOverAnything()
 	NotNull(pig);
 	return (pig->mouseHit.priority > 0);
 }
-bool IsMouseOverNamed(const char* expectedName, bool mustBeIndex0 = false)
+//id should come from GetMouseHitId, callers that check the same item every frame can calculate it once and hold on to it
+bool IsMouseOverId(u64 id)
+{
+	NotNull(pig);
+	if (pig->mouseHit.priority == 0) { return false; }
+	return (pig->mouseHit.id == id);
+}
+bool IsMouseOverNamed(MyStr_t expectedName, bool mustBeIndex0 = false)
 {
-	NotNull(expectedName);
 	if (pig->mouseHit.priority == 0) { return false; }
 	if (mustBeIndex0 && pig->mouseHit.index != 0) { return false; }
-	if (IsEmptyStr(pig->mouseHit.name)) { return false; }
-	u64 expectedNameLength = MyStrLength64(expectedName);
-	if (pig->mouseHit.name.length != expectedNameLength) { return false; }
-	if (MyStrCompare(pig->mouseHit.name.pntr, expectedName, expectedNameLength) != 0) { return false; }
-	return true;
+	if (pig->mouseHit.nameLength == 0) { return false; }
+	expectedName = TruncateMouseHitName(expectedName);
+	if (pig->mouseHit.nameLength != expectedName.length) { return false; }
+	return (MyStrCompare(pig->mouseHit.name, expectedName.pntr, expectedName.length) == 0);
+}
+bool IsMouseOverNamed(const char* expectedName, bool mustBeIndex0 = false)
+{
+	NotNull(expectedName);
+	return IsMouseOverNamed(NewStr(expectedName), mustBeIndex0);
 }
 bool IsMouseOverPrint(const char* formatString, ...)
 {
-	TempPushMark();
-	TempPrintVa(nameStr, nameLength, formatString);
-	DebugAssert(nameStr != nullptr);
-	if (nameStr == nullptr) { TempPopMark(); return false; }
-	bool result = IsMouseOverNamed(nameStr);
-	TempPopMark();
-	return result;
+	NotNull(formatString);
+	if (pig->mouseHit.priority == 0) { return false; }
+	PrintMouseHitName(nameBuffer, expectedName, formatString);
+	return IsMouseOverNamed(expectedName);
 }
 bool IsMouseOverNamedIndex(const char* expectedName, u64 index)
 {
@@ -436,26 +613,27 @@ bool IsMouseOverNamedIndex(const char* expectedName, u64 index)
 	if (pig->mouseHit.index != index) { return false; }
 	return true;
 }
-bool IsMouseOverNamedPartial(const char* expectedName, bool mustBeIndex0 = false)
+bool IsMouseOverNamedPartial(MyStr_t expectedName, bool mustBeIndex0 = false)
 {
-	NotNull(expectedName);
 	if (pig->mouseHit.priority == 0) { return false; }
 	if (mustBeIndex0 && pig->mouseHit.index != 0) { return false; }
-	if (IsEmptyStr(pig->mouseHit.name)) { return false; }
-	u64 expectedNameLength = MyStrLength64(expectedName);
-	if (pig->mouseHit.name.length < expectedNameLength) { return false; }
-	if (MyStrCompare(pig->mouseHit.name.pntr, expectedName, expectedNameLength) != 0) { return false; }
-	return true;
+	if (pig->mouseHit.nameLength == 0) { return false; }
+	expectedName = TruncateMouseHitName(expectedName);
+	if (pig->mouseHit.nameLength < expectedName.length) { return false; }
+	if (expectedName.length == 0) { return true; }
+	return (MyStrCompare(pig->mouseHit.name, expectedName.pntr, expectedName.length) == 0);
+}
+bool IsMouseOverNamedPartial(const char* expectedName, bool mustBeIndex0 = false)
+{
+	NotNull(expectedName);
+	return IsMouseOverNamedPartial(NewStr(expectedName), mustBeIndex0);
 }
 bool IsMouseOverPrintPartial(const char* formatString, ...)
 {
-	TempPushMark();
-	TempPrintVa(nameStr, nameLength, formatString);
-	DebugAssert(nameStr != nullptr);
-	if (nameStr == nullptr) { TempPopMark(); return false; }
-	bool result = IsMouseOverNamedPartial(nameStr);
-	TempPopMark();
-	return result;
+	NotNull(formatString);
+	if (pig->mouseHit.priority == 0) { return false; }
+	PrintMouseHitName(nameBuffer, expectedName, formatString);
+	return IsMouseOverNamedPartial(expectedName);
 }
 
 // +--------------------------------------------------------------+
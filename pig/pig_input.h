@@ -7,15 +7,58 @@ Date:   10\30\2021
 #ifndef _PIG_INPUT_H
 #define _PIG_INPUT_H
 
+#define MOUSE_HIT_NAME_BUFFER_SIZE    128 //chars, longer names get truncated before they are hashed or compared
+#define MOUSE_HIT_GRID_CELL_SIZE      64 //px
+#define MOUSE_HIT_GRID_MAX_CELLS_X    64 //cells, rectangles past the edge of the grid are clamped into the last cell
+#define MOUSE_HIT_GRID_MAX_CELLS_Y    64 //cells
+
+//NOTE: Winning a MouseHit call doesn't allocate. The name is copied into one of the two pig->mouseHitNames buffers
+//      (one for mouseHit and one for prevMouseHit) so this struct stays small enough to copy every frame.
+//      nameHash is the hash of the name alone, id mixes in the pntr and index (see GetMouseHitId)
 struct MouseHitInfo_t
 {
 	u64 priority; //0 means nothing is hovered, greater numbers are higher priority
 	const PlatWindow_t* window;
-	MyStr_t name;
+	u64 id;
+	u64 nameHash; //0 if the item has no name
+	u64 nameLength;
+	char* name; //null-terminated, points into pig->mouseHitNames
 	const void* pntr;
 	u64 index;
 };
 
+struct MouseHitGridEntry_t
+{
+	u64 priority;
+	rec rectangle;
+};
+struct MouseHitGridNode_t
+{
+	u32 entryIndex;
+	u32 nextNodeIndex; //0 is the end of the list, otherwise index+1
+};
+struct MouseHitGridFrame_t
+{
+	const PlatWindow_t* window; //only rectangles registered for this window are recorded
+	VarArray_t entries; //MouseHitGridEntry_t
+	VarArray_t nodes; //MouseHitGridNode_t
+	u32 cellHeads[MOUSE_HIT_GRID_MAX_CELLS_Y][MOUSE_HIT_GRID_MAX_CELLS_X]; //0 is an empty cell, otherwise node index+1
+};
+//NOTE: The grid records every MouseHitRec call for a frame. On the next frame the first MouseHit call looks up the
+//      highest priority of last frame's rectangles under the mouse, and any MouseHit call with a lower priority loses,
+//      even if the higher priority item hasn't been updated yet this frame. Between equal priorities the first caller
+//      still wins, same as without the grid. Because it goes off last frame's rectangles a lower priority item can be
+//      blocked (or let through) for one frame after the higher priority rectangle moves
+struct MouseHitGrid_t
+{
+	bool enabled;
+	u64 currentFrameIndex; //index into frames[] that's being filled this frame
+	MouseHitGridFrame_t frames[2];
+	
+	bool resolvedThisFrame;
+	u64 blockingPriority; //0 if nothing from last frame is under the mouse
+};
+
 struct BtnHandlingInfo_t
 {
 	bool pressHandled;
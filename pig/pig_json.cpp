@@ -127,15 +127,167 @@ char** ParseJsonPath(MemArena_t* memArena, MyStr_t pathStr, u64* numPiecesOut =
 	return result;
 }
 
+// +--------------------------------------------------------------+
+// |                        Compiled Paths                        |
+// +--------------------------------------------------------------+
+//NOTE: A JsonPath_t is split, hashed and parsed once so code that does the same lookup on many nodes
+//      (like every level in an LDtk project) doesn't pay for ParseJsonPath on each one.
+//      Pieces are split the same way ParseJsonPath splits them. A piece that is all digits can also index into an array
+//      and a piece that is just "*" is a wildcard (only JsonReader_t binds make use of it, TryFindJsonNode never matches it)
+struct JsonPathPiece_t
+{
+	MyStr_t key; //points into JsonPath_t::pathStr, not null-terminated
+	u64 keyHash;
+	bool isIndex;
+	u64 index;
+	bool isWildcard;
+};
+
+struct JsonPath_t
+{
+	MemArena_t* allocArena;
+	MyStr_t pathStr;
+	u64 numPieces;
+	JsonPathPiece_t* pieces;
+	u64 allocSize;
+};
+
+u64 HashJsonKey(const char* keyChars, u64 keyLength)
+{
+	return FnvHashU64(keyChars, keyLength);
+}
+
+void FreeJsonPath(JsonPath_t* path)
+{
+	NotNull(path);
+	if (path->pieces != nullptr && path->allocArena != nullptr && DoesMemArenaSupportFreeing(path->allocArena))
+	{
+		FreeMem(path->allocArena, path->pieces, path->allocSize);
+	}
+	ClearPointer(path);
+}
+
+bool CompileJsonPath(MemArena_t* memArena, MyStr_t pathStr, JsonPath_t* pathOut)
+{
+	NotNull2(memArena, pathOut);
+	NotNullStr(&pathStr);
+	ClearPointer(pathOut);
+	
+	u64 numPieces = 0;
+	u64 partStartIndex = 0;
+	for (u64 cIndex = 0; cIndex <= pathStr.length; cIndex++)
+	{
+		char nextChar = (cIndex < pathStr.length) ? pathStr.chars[cIndex] : '\0';
+		if (nextChar == '/' || nextChar == '\\' || (nextChar == '\0' && cIndex > partStartIndex))
+		{
+			numPieces++;
+			partStartIndex = cIndex+1;
+		}
+	}
+	
+	//pieces and a null-terminated copy of the path live in one allocation
+	pathOut->allocSize = (sizeof(JsonPathPiece_t) * numPieces) + pathStr.length + 1;
+	u8* allocation = (u8*)AllocMem(memArena, pathOut->allocSize);
+	if (allocation == nullptr) { return false; }
+	pathOut->allocArena = memArena;
+	pathOut->numPieces = numPieces;
+	pathOut->pieces = (JsonPathPiece_t*)allocation;
+	pathOut->pathStr = NewStr(pathStr.length, (char*)(allocation + (sizeof(JsonPathPiece_t) * numPieces)));
+	if (pathStr.length > 0) { MyMemCopy(pathOut->pathStr.chars, pathStr.chars, pathStr.length); }
+	pathOut->pathStr.chars[pathStr.length] = '\0';
+	
+	u64 pieceIndex = 0;
+	partStartIndex = 0;
+	for (u64 cIndex = 0; cIndex <= pathStr.length; cIndex++)
+	{
+		char nextChar = (cIndex < pathStr.length) ? pathStr.chars[cIndex] : '\0';
+		if (nextChar == '/' || nextChar == '\\' || (nextChar == '\0' && cIndex > partStartIndex))
+		{
+			Assert(pieceIndex < numPieces);
+			JsonPathPiece_t* piece = &pathOut->pieces[pieceIndex];
+			ClearPointer(piece);
+			piece->key = StrSubstring(&pathOut->pathStr, partStartIndex, cIndex);
+			piece->keyHash = HashJsonKey(piece->key.chars, piece->key.length);
+			piece->isWildcard = StrEquals(piece->key, "*");
+			piece->isIndex = (piece->key.length > 0);
+			for (u64 kIndex = 0; kIndex < piece->key.length; kIndex++)
+			{
+				char keyChar = piece->key.chars[kIndex];
+				if (keyChar < '0' || keyChar > '9') { piece->isIndex = false; piece->index = 0; break; }
+				piece->index = (piece->index * 10) + (u64)(keyChar - '0');
+			}
+			pieceIndex++;
+			partStartIndex = cIndex+1;
+		}
+	}
+	Assert(pieceIndex == numPieces);
+	
+	return true;
+}
+bool CompileJsonPath(MemArena_t* memArena, const char* nullTermPathStr, JsonPath_t* pathOut)
+{
+	return CompileJsonPath(memArena, NewStr(nullTermPathStr), pathOut);
+}
+
+//yajl object keys are null-terminated, we compare char by char so we never read past the end of a shorter key
+bool DoesJsonKeyMatchPiece(const char* nullTermKey, const JsonPathPiece_t* piece)
+{
+	for (u64 cIndex = 0; cIndex < piece->key.length; cIndex++)
+	{
+		if (nullTermKey[cIndex] != piece->key.chars[cIndex]) { return false; }
+	}
+	return (nullTermKey[piece->key.length] == '\0');
+}
+
+bool TryFindJsonNode(yajl_val rootNode, const JsonPath_t* path, yajl_val* nodeOut)
+{
+	NotNull2(rootNode, path);
+	yajl_val node = rootNode;
+	for (u64 pIndex = 0; pIndex < path->numPieces; pIndex++)
+	{
+		const JsonPathPiece_t* piece = &path->pieces[pIndex];
+		if (YAJL_IS_OBJECT(node))
+		{
+			yajl_val childNode = nullptr;
+			for (size_t kIndex = 0; kIndex < node->u.object.len; kIndex++)
+			{
+				if (DoesJsonKeyMatchPiece(node->u.object.keys[kIndex], piece)) { childNode = node->u.object.values[kIndex]; break; }
+			}
+			if (childNode == nullptr) { return false; }
+			node = childNode;
+		}
+		else if (YAJL_IS_ARRAY(node) && piece->isIndex)
+		{
+			if (piece->index >= (u64)node->u.array.len) { return false; }
+			node = node->u.array.values[piece->index];
+		}
+		else { return false; }
+	}
+	if (nodeOut != nullptr) { *nodeOut = node; }
+	return true;
+}
+bool TryFindJsonNode(ParsedJson_t* parsedJson, const JsonPath_t* path, yajl_val* nodeOut)
+{
+	NotNull(parsedJson);
+	return TryFindJsonNode(parsedJson->rootNode, path, nodeOut);
+}
+
+//NOTE: The string versions compile a throwaway path in TempArena on every call. Anything that's called in a loop should compile once and use the JsonPath_t versions
+JsonPath_t CompileTempJsonPath(MyStr_t pathStr)
+{
+	JsonPath_t result;
+	bool compiled = CompileJsonPath(TempArena, pathStr, &result);
+	AssertMsg(compiled, "Failed to compile json path in TempArena");
+	UNUSED(compiled);
+	return result;
+}
+
 bool TryFindJsonNodeByPathStr(yajl_val rootNode, MyStr_t pathStr, yajl_val* nodeOut)
 {
 	NotNull(rootNode);
-	char** pathPieces = ParseJsonPath(TempArena, pathStr);
-	if (pathPieces == nullptr) { return false; }
-	yajl_val foundNode = yajl_tree_get(rootNode, (const char **)pathPieces, yajl_t_any);
-	if (foundNode == nullptr) { return false; }
-	if (nodeOut != nullptr) { *nodeOut = foundNode; }
-	return true;
+	JsonPath_t path;
+	if (!CompileJsonPath(TempArena, pathStr, &path)) { return false; }
+	return TryFindJsonNode(rootNode, &path, nodeOut);
 }
 bool TryFindJsonNodeByPathStr(yajl_val rootNode, const char* nullTermPathStr, yajl_val* nodeOut)
 {
@@ -169,15 +321,20 @@ yajl_val GetJsonArrayElement(yajl_val arrayNode, u64 index)
 // +==============================+
 // |            Object            |
 // +==============================+
-yajl_val TryGetJsonObject(yajl_val rootNode, MyStr_t pathStr, yajl_val defaultValue = nullptr, bool allowNull = true)
+yajl_val TryGetJsonObject(yajl_val rootNode, const JsonPath_t* path, yajl_val defaultValue = nullptr, bool allowNull = true)
 {
 	yajl_val resultNode;
-	bool found = TryFindJsonNodeByPathStr(rootNode, pathStr, &resultNode);
+	bool found = TryFindJsonNode(rootNode, path, &resultNode);
 	if (!found) { return defaultValue; }
 	if (YAJL_IS_NULL(resultNode) && allowNull) { return nullptr; }
 	if (!YAJL_IS_OBJECT(resultNode)) { return defaultValue; }
 	return resultNode;
 }
+yajl_val TryGetJsonObject(yajl_val rootNode, MyStr_t pathStr, yajl_val defaultValue = nullptr, bool allowNull = true)
+{
+	JsonPath_t path = CompileTempJsonPath(pathStr);
+	return TryGetJsonObject(rootNode, &path, defaultValue, allowNull);
+}
 yajl_val TryGetJsonObject(yajl_val rootNode, const char* nullTermPathStr, yajl_val defaultValue = nullptr, bool allowNull = true)
 {
 	return TryGetJsonObject(rootNode, NewStr(nullTermPathStr), defaultValue, allowNull);
@@ -196,15 +353,20 @@ yajl_val TryGetJsonObject(ParsedJson_t* parsedJson, const char* nullTermPathStr,
 // +==============================+
 // |           MyStr_t            |
 // +==============================+
-MyStr_t TryGetJsonValueStr(yajl_val rootNode, MyStr_t pathStr, MyStr_t defaultValue)
+MyStr_t TryGetJsonValueStr(yajl_val rootNode, const JsonPath_t* path, MyStr_t defaultValue)
 {
 	yajl_val resultNode;
-	bool found = TryFindJsonNodeByPathStr(rootNode, pathStr, &resultNode);
+	bool found = TryFindJsonNode(rootNode, path, &resultNode);
 	if (!found) { return defaultValue; }
 	if (YAJL_IS_NULL(resultNode)) { return MyStr_Empty; }
 	if (!YAJL_IS_STRING(resultNode)) { return defaultValue; }
 	return NewStr(YAJL_GET_STRING(resultNode));
 }
+MyStr_t TryGetJsonValueStr(yajl_val rootNode, MyStr_t pathStr, MyStr_t defaultValue)
+{
+	JsonPath_t path = CompileTempJsonPath(pathStr);
+	return TryGetJsonValueStr(rootNode, &path, defaultValue);
+}
 MyStr_t TryGetJsonValueStr(yajl_val rootNode, const char* nullTermPathStr, MyStr_t defaultValue)
 {
 	return TryGetJsonValueStr(rootNode, NewStr(nullTermPathStr), defaultValue);
@@ -220,16 +382,21 @@ MyStr_t TryGetJsonValueStr(ParsedJson_t* parsedJson, const char* nullTermPathStr
 	return TryGetJsonValueStr(parsedJson->rootNode, NewStr(nullTermPathStr), defaultValue);
 }
 
-MyStr_t GetJsonValueStr(yajl_val rootNode, MyStr_t pathStr)
+MyStr_t GetJsonValueStr(yajl_val rootNode, const JsonPath_t* path)
 {
 	yajl_val resultNode;
-	bool found = TryFindJsonNodeByPathStr(rootNode, pathStr, &resultNode);
+	bool found = TryFindJsonNode(rootNode, path, &resultNode);
 	AssertMsg(found, "Failed to find Json node by path");
 	//TODO: Should we turn a number or other type into a string?
 	if (YAJL_IS_NULL(resultNode)) { return MyStr_Empty; }
 	AssertMsg(YAJL_IS_STRING(resultNode), "Expected a string json node!");
 	return NewStr(YAJL_GET_STRING(resultNode));
 }
+MyStr_t GetJsonValueStr(yajl_val rootNode, MyStr_t pathStr)
+{
+	JsonPath_t path = CompileTempJsonPath(pathStr);
+	return GetJsonValueStr(rootNode, &path);
+}
 MyStr_t GetJsonValueStr(yajl_val rootNode, const char* nullTermPathStr)
 {
 	return GetJsonValueStr(rootNode, NewStr(nullTermPathStr));
@@ -248,15 +415,20 @@ MyStr_t GetJsonValueStr(ParsedJson_t* parsedJson, const char* nullTermPathStr)
 // +==============================+
 // |             I64              |
 // +==============================+
-i64 TryGetJsonValueI64(yajl_val rootNode, MyStr_t pathStr, i64 defaultValue)
+i64 TryGetJsonValueI64(yajl_val rootNode, const JsonPath_t* path, i64 defaultValue)
 {
 	yajl_val resultNode;
-	bool found = TryFindJsonNodeByPathStr(rootNode, pathStr, &resultNode);
+	bool found = TryFindJsonNode(rootNode, path, &resultNode);
 	if (!found) { return defaultValue; }
 	if (YAJL_IS_NULL(resultNode)) { return 0; }
 	if (!YAJL_IS_INTEGER(resultNode)) { return defaultValue; }
 	return YAJL_GET_INTEGER(resultNode);
 }
+i64 TryGetJsonValueI64(yajl_val rootNode, MyStr_t pathStr, i64 defaultValue)
+{
+	JsonPath_t path = CompileTempJsonPath(pathStr);
+	return TryGetJsonValueI64(rootNode, &path, defaultValue);
+}
 i64 TryGetJsonValueI64(yajl_val rootNode, const char* nullTermPathStr, i64 defaultValue)
 {
 	return TryGetJsonValueI64(rootNode, NewStr(nullTermPathStr), defaultValue);
@@ -272,15 +444,20 @@ i64 TryGetJsonValueI64(ParsedJson_t* parsedJson, const char* nullTermPathStr, i6
 	return TryGetJsonValueI64(parsedJson->rootNode, NewStr(nullTermPathStr), defaultValue);
 }
 
-i64 GetJsonValueI64(yajl_val rootNode, MyStr_t pathStr)
+i64 GetJsonValueI64(yajl_val rootNode, const JsonPath_t* path)
 {
 	yajl_val resultNode;
-	bool found = TryFindJsonNodeByPathStr(rootNode, pathStr, &resultNode);
+	bool found = TryFindJsonNode(rootNode, path, &resultNode);
 	AssertMsg(found, "Failed to find Json node by path");
 	if (YAJL_IS_NULL(resultNode)) { return 0; }
 	AssertMsg(YAJL_IS_INTEGER(resultNode), "Expected an integer json node!");
 	return YAJL_GET_INTEGER(resultNode);
 }
+i64 GetJsonValueI64(yajl_val rootNode, MyStr_t pathStr)
+{
+	JsonPath_t path = CompileTempJsonPath(pathStr);
+	return GetJsonValueI64(rootNode, &path);
+}
 i64 GetJsonValueI64(yajl_val rootNode, const char* nullTermPathStr)
 {
 	return GetJsonValueI64(rootNode, NewStr(nullTermPathStr));
@@ -299,15 +476,20 @@ i64 GetJsonValueI64(ParsedJson_t* parsedJson, const char* nullTermPathStr)
 // +==============================+
 // |             R64              |
 // +==============================+
-r64 TryGetJsonValueR64(yajl_val rootNode, MyStr_t pathStr, r64 defaultValue)
+r64 TryGetJsonValueR64(yajl_val rootNode, const JsonPath_t* path, r64 defaultValue)
 {
 	yajl_val resultNode;
-	bool found = TryFindJsonNodeByPathStr(rootNode, pathStr, &resultNode);
+	bool found = TryFindJsonNode(rootNode, path, &resultNode);
 	if (!found) { return defaultValue; }
 	if (YAJL_IS_NULL(resultNode)) { return 0; }
 	if (!YAJL_IS_DOUBLE(resultNode)) { return defaultValue; }
 	return YAJL_GET_DOUBLE(resultNode);
 }
+r64 TryGetJsonValueR64(yajl_val rootNode, MyStr_t pathStr, r64 defaultValue)
+{
+	JsonPath_t path = CompileTempJsonPath(pathStr);
+	return TryGetJsonValueR64(rootNode, &path, defaultValue);
+}
 r64 TryGetJsonValueR64(yajl_val rootNode, const char* nullTermPathStr, r64 defaultValue)
 {
 	return TryGetJsonValueR64(rootNode, NewStr(nullTermPathStr), defaultValue);
@@ -323,15 +505,20 @@ r64 TryGetJsonValueR64(ParsedJson_t* parsedJson, const char* nullTermPathStr, r6
 	return TryGetJsonValueR64(parsedJson->rootNode, NewStr(nullTermPathStr), defaultValue);
 }
 
-r64 GetJsonValueR64(yajl_val rootNode, MyStr_t pathStr)
+r64 GetJsonValueR64(yajl_val rootNode, const JsonPath_t* path)
 {
 	yajl_val resultNode;
-	bool found = TryFindJsonNodeByPathStr(rootNode, pathStr, &resultNode);
+	bool found = TryFindJsonNode(rootNode, path, &resultNode);
 	AssertMsg(found, "Failed to find Json node by path");
 	if (YAJL_IS_NULL(resultNode)) { return 0; }
 	AssertMsg(YAJL_IS_DOUBLE(resultNode), "Expected a r64 json node!");
 	return YAJL_GET_DOUBLE(resultNode);
 }
+r64 GetJsonValueR64(yajl_val rootNode, MyStr_t pathStr)
+{
+	JsonPath_t path = CompileTempJsonPath(pathStr);
+	return GetJsonValueR64(rootNode, &path);
+}
 r64 GetJsonValueR64(yajl_val rootNode, const char* nullTermPathStr)
 {
 	return GetJsonValueR64(rootNode, NewStr(nullTermPathStr));
@@ -350,18 +537,18 @@ r64 GetJsonValueR64(ParsedJson_t* parsedJson, const char* nullTermPathStr)
 // +--------------------------------------------------------------+
 // |                     ProcessLog Versions                      |
 // +--------------------------------------------------------------+
-yajl_val LogJsonArray(ProcessLog_t* log, yajl_val rootNode, MyStr_t pathStr, yajl_val defaultValue = nullptr, bool allowMissing = false, bool allowInvalidType = false, bool isError = true)
+yajl_val LogJsonArray(ProcessLog_t* log, yajl_val rootNode, const JsonPath_t* path, yajl_val defaultValue = nullptr, bool allowMissing = false, bool allowInvalidType = false, bool isError = true)
 {
 	if (rootNode == nullptr) { return defaultValue; }
 	yajl_val resultNode;
-	bool found = TryFindJsonNodeByPathStr(rootNode, pathStr, &resultNode);
+	bool found = TryFindJsonNode(rootNode, path, &resultNode);
 	if (!found)
 	{
 		if (!allowMissing)
 		{
 			if (isError) { log->hadErrors = true; }
 			else { log->hadWarnings = true; }
-			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Failed to find Json node by path: \"%.*s\"", StrPrint(pathStr));
+			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Failed to find Json node by path: \"%.*s\"", StrPrint(path->pathStr));
 		}
 		return defaultValue;
 	}
@@ -371,24 +558,29 @@ yajl_val LogJsonArray(ProcessLog_t* log, yajl_val rootNode, MyStr_t pathStr, yaj
 		{
 			if (isError) { log->hadErrors = true; }
 			else { log->hadWarnings = true; }
-			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Found %s not array at \"%.*s\"", GetYajlTypeStr(resultNode->type), StrPrint(pathStr));
+			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Found %s not array at \"%.*s\"", GetYajlTypeStr(resultNode->type), StrPrint(path->pathStr));
 		}
 		return defaultValue;
 	}
 	return resultNode;
 }
-yajl_val LogJsonObject(ProcessLog_t* log, yajl_val rootNode, MyStr_t pathStr, yajl_val defaultValue = nullptr, bool allowMissing = false, bool allowNull = true, bool allowInvalidType = false, bool isError = true)
+yajl_val LogJsonArray(ProcessLog_t* log, yajl_val rootNode, MyStr_t pathStr, yajl_val defaultValue = nullptr, bool allowMissing = false, bool allowInvalidType = false, bool isError = true)
+{
+	JsonPath_t path = CompileTempJsonPath(pathStr);
+	return LogJsonArray(log, rootNode, &path, defaultValue, allowMissing, allowInvalidType, isError);
+}
+yajl_val LogJsonObject(ProcessLog_t* log, yajl_val rootNode, const JsonPath_t* path, yajl_val defaultValue = nullptr, bool allowMissing = false, bool allowNull = true, bool allowInvalidType = false, bool isError = true)
 {
 	if (rootNode == nullptr) { return defaultValue; }
 	yajl_val resultNode;
-	bool found = TryFindJsonNodeByPathStr(rootNode, pathStr, &resultNode);
+	bool found = TryFindJsonNode(rootNode, path, &resultNode);
 	if (!found)
 	{
 		if (!allowMissing)
 		{
 			if (isError) { log->hadErrors = true; }
 			else { log->hadWarnings = true; }
-			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Failed to find Json node by path: \"%.*s\"", StrPrint(pathStr));
+			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Failed to find Json node by path: \"%.*s\"", StrPrint(path->pathStr));
 		}
 		return defaultValue;
 	}
@@ -399,24 +591,29 @@ yajl_val LogJsonObject(ProcessLog_t* log, yajl_val rootNode, MyStr_t pathStr, ya
 		{
 			if (isError) { log->hadErrors = true; }
 			else { log->hadWarnings = true; }
-			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Found %s not object at \"%.*s\"", GetYajlTypeStr(resultNode->type), StrPrint(pathStr));
+			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Found %s not object at \"%.*s\"", GetYajlTypeStr(resultNode->type), StrPrint(path->pathStr));
 		}
 		return defaultValue;
 	}
 	return resultNode;
 }
-MyStr_t LogJsonValueStr(ProcessLog_t* log, yajl_val rootNode, MyStr_t pathStr, MyStr_t defaultValue, bool allowMissing = false, bool allowInvalidType = false, bool isError = true)
+yajl_val LogJsonObject(ProcessLog_t* log, yajl_val rootNode, MyStr_t pathStr, yajl_val defaultValue = nullptr, bool allowMissing = false, bool allowNull = true, bool allowInvalidType = false, bool isError = true)
+{
+	JsonPath_t path = CompileTempJsonPath(pathStr);
+	return LogJsonObject(log, rootNode, &path, defaultValue, allowMissing, allowNull, allowInvalidType, isError);
+}
+MyStr_t LogJsonValueStr(ProcessLog_t* log, yajl_val rootNode, const JsonPath_t* path, MyStr_t defaultValue, bool allowMissing = false, bool allowInvalidType = false, bool isError = true)
 {
 	if (rootNode == nullptr) { return defaultValue; }
 	yajl_val resultNode;
-	bool found = TryFindJsonNodeByPathStr(rootNode, pathStr, &resultNode);
+	bool found = TryFindJsonNode(rootNode, path, &resultNode);
 	if (!found)
 	{
 		if (!allowMissing)
 		{
 			if (isError) { log->hadErrors = true; }
 			else { log->hadWarnings = true; }
-			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Failed to find Json node by path: \"%.*s\"", StrPrint(pathStr));
+			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Failed to find Json node by path: \"%.*s\"", StrPrint(path->pathStr));
 		}
 		return defaultValue;
 	}
@@ -427,24 +624,29 @@ MyStr_t LogJsonValueStr(ProcessLog_t* log, yajl_val rootNode, MyStr_t pathStr, M
 		{
 			if (isError) { log->hadErrors = true; }
 			else { log->hadWarnings = true; }
-			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Found %s not string at \"%.*s\"", GetYajlTypeStr(resultNode->type), StrPrint(pathStr));
+			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Found %s not string at \"%.*s\"", GetYajlTypeStr(resultNode->type), StrPrint(path->pathStr));
 		}
 		return defaultValue;
 	}
 	return NewStr(YAJL_GET_STRING(resultNode));
 }
-i64 LogJsonValueI64(ProcessLog_t* log, yajl_val rootNode, MyStr_t pathStr, i64 defaultValue = 0, bool allowMissing = false, bool allowInvalidType = false, bool isError = true)
+MyStr_t LogJsonValueStr(ProcessLog_t* log, yajl_val rootNode, MyStr_t pathStr, MyStr_t defaultValue, bool allowMissing = false, bool allowInvalidType = false, bool isError = true)
+{
+	JsonPath_t path = CompileTempJsonPath(pathStr);
+	return LogJsonValueStr(log, rootNode, &path, defaultValue, allowMissing, allowInvalidType, isError);
+}
+i64 LogJsonValueI64(ProcessLog_t* log, yajl_val rootNode, const JsonPath_t* path, i64 defaultValue = 0, bool allowMissing = false, bool allowInvalidType = false, bool isError = true)
 {
 	if (rootNode == nullptr) { return defaultValue; }
 	yajl_val resultNode;
-	bool found = TryFindJsonNodeByPathStr(rootNode, pathStr, &resultNode);
+	bool found = TryFindJsonNode(rootNode, path, &resultNode);
 	if (!found)
 	{
 		if (!allowMissing)
 		{
 			if (isError) { log->hadErrors = true; }
 			else { log->hadWarnings = true; }
-			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Failed to find Json node by path: \"%.*s\"", StrPrint(pathStr));
+			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Failed to find Json node by path: \"%.*s\"", StrPrint(path->pathStr));
 		}
 		return defaultValue;
 	}
@@ -455,24 +657,29 @@ i64 LogJsonValueI64(ProcessLog_t* log, yajl_val rootNode, MyStr_t pathStr, i64 d
 		{
 			if (isError) { log->hadErrors = true; }
 			else { log->hadWarnings = true; }
-			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Found %s not i64 at \"%.*s\"", GetYajlTypeStr(resultNode->type), StrPrint(pathStr));
+			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Found %s not i64 at \"%.*s\"", GetYajlTypeStr(resultNode->type), StrPrint(path->pathStr));
 		}
 		return defaultValue;
 	}
 	return YAJL_GET_INTEGER(resultNode);
 }
-r64 LogJsonValueR64(ProcessLog_t* log, yajl_val rootNode, MyStr_t pathStr, r64 defaultValue = 0, bool allowMissing = false, bool allowInvalidType = false, bool isError = true)
+i64 LogJsonValueI64(ProcessLog_t* log, yajl_val rootNode, MyStr_t pathStr, i64 defaultValue = 0, bool allowMissing = false, bool allowInvalidType = false, bool isError = true)
+{
+	JsonPath_t path = CompileTempJsonPath(pathStr);
+	return LogJsonValueI64(log, rootNode, &path, defaultValue, allowMissing, allowInvalidType, isError);
+}
+r64 LogJsonValueR64(ProcessLog_t* log, yajl_val rootNode, const JsonPath_t* path, r64 defaultValue = 0, bool allowMissing = false, bool allowInvalidType = false, bool isError = true)
 {
 	if (rootNode == nullptr) { return defaultValue; }
 	yajl_val resultNode;
-	bool found = TryFindJsonNodeByPathStr(rootNode, pathStr, &resultNode);
+	bool found = TryFindJsonNode(rootNode, path, &resultNode);
 	if (!found)
 	{
 		if (!allowMissing)
 		{
 			if (isError) { log->hadErrors = true; }
 			else { log->hadWarnings = true; }
-			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Failed to find Json node by path: \"%.*s\"", StrPrint(pathStr));
+			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Failed to find Json node by path: \"%.*s\"", StrPrint(path->pathStr));
 		}
 		return defaultValue;
 	}
@@ -482,12 +689,17 @@ r64 LogJsonValueR64(ProcessLog_t* log, yajl_val rootNode, MyStr_t pathStr, r64 d
 		{
 			if (isError) { log->hadErrors = true; }
 			else { log->hadWarnings = true; }
-			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Found %s not r64 at \"%.*s\"", GetYajlTypeStr(resultNode->type), StrPrint(pathStr));
+			LogPrintLineAt(log, (isError ? DbgLevel_Error : DbgLevel_Warning), "Found %s not r64 at \"%.*s\"", GetYajlTypeStr(resultNode->type), StrPrint(path->pathStr));
 		}
 		return defaultValue;
 	}
 	return YAJL_GET_DOUBLE(resultNode);
 }
+r64 LogJsonValueR64(ProcessLog_t* log, yajl_val rootNode, MyStr_t pathStr, r64 defaultValue = 0, bool allowMissing = false, bool allowInvalidType = false, bool isError = true)
+{
+	JsonPath_t path = CompileTempJsonPath(pathStr);
+	return LogJsonValueR64(log, rootNode, &path, defaultValue, allowMissing, allowInvalidType, isError);
+}
 
 //yajl_val and const char* variants
 yajl_val LogJsonArray(ProcessLog_t* log, yajl_val rootNode, const char* nullTermPathStr, yajl_val defaultValue = nullptr, bool allowMissing = false, bool allowInvalidType = false, bool isError = true)
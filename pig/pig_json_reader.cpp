@@ -0,0 +1,619 @@
+/*
+File:   pig_json_reader.cpp
+Date:   10\19\2026
+Description:
+	** Holds a single pass JSON reader that fills in values bound to JsonPath_t paths as it scans the text.
+	** Unlike TryParseJson it never builds a yajl tree, the only allocations it makes are for the string values
+	** it hands back (and the list items for bindings that use a "*" wildcard). Subtrees that no binding
+	** is interested in are skipped with a quick bracket matching scan.
+*/
+
+#if JSON_SUPPORTED
+
+#define JSON_READER_MAX_DEPTH         64
+#define JSON_READER_MAX_NUMBER_LENGTH 63
+
+enum JsonFieldType_t
+{
+	JsonFieldType_None = 0,
+	JsonFieldType_Str, //MyStr_t, allocated from the reader's valueArena
+	JsonFieldType_I64,
+	JsonFieldType_R64,
+	JsonFieldType_Bool,
+	JsonFieldType_Count, //u64, number of elements in an array or members in an object
+	JsonFieldType_NumTypes,
+};
+const char* GetJsonFieldTypeStr(JsonFieldType_t type)
+{
+	switch (type)
+	{
+		case JsonFieldType_None:  return "None";
+		case JsonFieldType_Str:   return "Str";
+		case JsonFieldType_I64:   return "I64";
+		case JsonFieldType_R64:   return "R64";
+		case JsonFieldType_Bool:  return "Bool";
+		case JsonFieldType_Count: return "Count";
+		default: return "Unknown";
+	}
+}
+
+struct JsonReaderField_t
+{
+	JsonPath_t path;
+	JsonFieldType_t type;
+	void* valuePntr; //for single value bindings
+	VarArray_t* list; //for bindings with wildcards, every match is appended
+	u64 numFound;
+	u64 matchedDepth; //how many pieces of path match the value the reader is currently inside
+};
+
+struct JsonReader_t
+{
+	MemArena_t* allocArena;
+	MemArena_t* valueArena;
+	VarArray_t fields; //JsonReaderField_t
+	
+	u64 numValuesRead;
+	u64 numValuesSkipped;
+	u64 numTypeMismatches;
+};
+
+//Only lives for the duration of JsonReaderRun
+struct JsonReaderState_t
+{
+	JsonReader_t* reader;
+	ProcessLog_t* log;
+	MemArena_t* scratch;
+	MyStr_t json;
+	u64 index;
+	bool failed;
+	const char* errorMsg;
+	u64 errorIndex;
+};
+
+// +--------------------------------------------------------------+
+// |                        Init and Free                         |
+// +--------------------------------------------------------------+
+void FreeJsonReader(JsonReader_t* reader)
+{
+	NotNull(reader);
+	VarArrayLoop(&reader->fields, fIndex)
+	{
+		VarArrayLoopGet(JsonReaderField_t, field, &reader->fields, fIndex);
+		FreeJsonPath(&field->path);
+	}
+	FreeVarArray(&reader->fields);
+	ClearPointer(reader);
+}
+
+//valueArena is where string values get allocated, it can be the same as memArena
+void InitJsonReader(JsonReader_t* reader, MemArena_t* memArena, MemArena_t* valueArena = nullptr)
+{
+	NotNull2(reader, memArena);
+	ClearPointer(reader);
+	reader->allocArena = memArena;
+	reader->valueArena = (valueArena != nullptr) ? valueArena : memArena;
+	CreateVarArray(&reader->fields, memArena, sizeof(JsonReaderField_t));
+}
+
+// +--------------------------------------------------------------+
+// |                           Binding                            |
+// +--------------------------------------------------------------+
+//Returns the index of the binding so the caller can check JsonReaderGetNumFound after running
+u64 JsonReaderBind(JsonReader_t* reader, MyStr_t pathStr, JsonFieldType_t type, void* valuePntr, VarArray_t* list)
+{
+	NotNull(reader);
+	Assert(type != JsonFieldType_None && type < JsonFieldType_NumTypes);
+	Assert((valuePntr != nullptr) != (list != nullptr));
+	JsonReaderField_t* newField = VarArrayAdd(&reader->fields, JsonReaderField_t);
+	NotNull(newField);
+	ClearPointer(newField);
+	bool compiled = CompileJsonPath(reader->allocArena, pathStr, &newField->path);
+	Assert(compiled);
+	UNUSED(compiled);
+	newField->type = type;
+	newField->valuePntr = valuePntr;
+	newField->list = list;
+	return reader->fields.length-1;
+}
+
+u64 JsonReaderBindStr(JsonReader_t* reader, const char* pathStr, MyStr_t* valueOut)  { return JsonReaderBind(reader, NewStr(pathStr), JsonFieldType_Str,   valueOut, nullptr); }
+u64 JsonReaderBindI64(JsonReader_t* reader, const char* pathStr, i64* valueOut)      { return JsonReaderBind(reader, NewStr(pathStr), JsonFieldType_I64,   valueOut, nullptr); }
+u64 JsonReaderBindR64(JsonReader_t* reader, const char* pathStr, r64* valueOut)      { return JsonReaderBind(reader, NewStr(pathStr), JsonFieldType_R64,   valueOut, nullptr); }
+u64 JsonReaderBindBool(JsonReader_t* reader, const char* pathStr, bool* valueOut)    { return JsonReaderBind(reader, NewStr(pathStr), JsonFieldType_Bool,  valueOut, nullptr); }
+u64 JsonReaderBindCount(JsonReader_t* reader, const char* pathStr, u64* valueOut)    { return JsonReaderBind(reader, NewStr(pathStr), JsonFieldType_Count, valueOut, nullptr); }
+
+//The list must already be created with the matching item type (MyStr_t, i64, r64, bool or u64 respectively)
+u64 JsonReaderBindStrList(JsonReader_t* reader, const char* pathStr, VarArray_t* list)   { return JsonReaderBind(reader, NewStr(pathStr), JsonFieldType_Str,   nullptr, list); }
+u64 JsonReaderBindI64List(JsonReader_t* reader, const char* pathStr, VarArray_t* list)   { return JsonReaderBind(reader, NewStr(pathStr), JsonFieldType_I64,   nullptr, list); }
+u64 JsonReaderBindR64List(JsonReader_t* reader, const char* pathStr, VarArray_t* list)   { return JsonReaderBind(reader, NewStr(pathStr), JsonFieldType_R64,   nullptr, list); }
+u64 JsonReaderBindBoolList(JsonReader_t* reader, const char* pathStr, VarArray_t* list)  { return JsonReaderBind(reader, NewStr(pathStr), JsonFieldType_Bool,  nullptr, list); }
+u64 JsonReaderBindCountList(JsonReader_t* reader, const char* pathStr, VarArray_t* list) { return JsonReaderBind(reader, NewStr(pathStr), JsonFieldType_Count, nullptr, list); }
+
+u64 JsonReaderGetNumFound(const JsonReader_t* reader, u64 fieldIndex)
+{
+	NotNull(reader);
+	Assert(fieldIndex < reader->fields.length);
+	const JsonReaderField_t* field = VarArrayGet(&reader->fields, fieldIndex, JsonReaderField_t);
+	return field->numFound;
+}
+
+// +--------------------------------------------------------------+
+// |                           Helpers                            |
+// +--------------------------------------------------------------+
+void JsonReaderFail(JsonReaderState_t* state, const char* errorMsg)
+{
+	if (state->failed) { return; }
+	state->failed = true;
+	state->errorMsg = errorMsg;
+	state->errorIndex = state->index;
+}
+
+void JsonReaderSkipWhitespace(JsonReaderState_t* state)
+{
+	while (state->index < state->json.length)
+	{
+		char c = state->json.chars[state->index];
+		if (c != ' ' && c != '\t' && c != '\n' && c != '\r') { break; }
+		state->index++;
+	}
+}
+
+bool JsonReaderConsumeLiteral(JsonReaderState_t* state, const char* literal)
+{
+	u64 literalLength = MyStrLength64(literal);
+	if (state->index + literalLength > state->json.length || MyMemCompare(&state->json.chars[state->index], literal, literalLength) != 0)
+	{
+		JsonReaderFail(state, "Invalid literal");
+		return false;
+	}
+	state->index += literalLength;
+	return true;
+}
+
+//Leaves rawOut pointing at the characters between the quotes, escapes and all
+bool JsonReaderScanString(JsonReaderState_t* state, MyStr_t* rawOut, bool* hasEscapesOut)
+{
+	DebugAssert(state->json.chars[state->index] == '"');
+	state->index++;
+	u64 startIndex = state->index;
+	bool hasEscapes = false;
+	while (state->index < state->json.length)
+	{
+		char c = state->json.chars[state->index];
+		if (c == '"')
+		{
+			*rawOut = NewStr(state->index - startIndex, &state->json.chars[startIndex]);
+			*hasEscapesOut = hasEscapes;
+			state->index++;
+			return true;
+		}
+		if (c == '\\') { hasEscapes = true; state->index++; }
+		state->index++;
+	}
+	JsonReaderFail(state, "Unterminated string");
+	return false;
+}
+
+u32 JsonReaderParseHex4(const char* chars, bool* isValidOut)
+{
+	u32 result = 0;
+	for (u8 cIndex = 0; cIndex < 4; cIndex++)
+	{
+		char c = chars[cIndex];
+		result <<= 4;
+		if (c >= '0' && c <= '9') { result |= (u32)(c - '0'); }
+		else if (c >= 'a' && c <= 'f') { result |= (u32)(c - 'a' + 10); }
+		else if (c >= 'A' && c <= 'F') { result |= (u32)(c - 'A' + 10); }
+		else { *isValidOut = false; return 0; }
+	}
+	return result;
+}
+
+//Result is always null-terminated (and the decoded string is never longer than the raw one)
+MyStr_t JsonReaderDecodeString(JsonReaderState_t* state, MyStr_t rawStr, bool hasEscapes, MemArena_t* memArena)
+{
+	if (!hasEscapes) { return AllocString(memArena, &rawStr); }
+	
+	char* resultChars = AllocArray(memArena, char, rawStr.length+1);
+	NotNull(resultChars);
+	u64 resultLength = 0;
+	for (u64 cIndex = 0; cIndex < rawStr.length; cIndex++)
+	{
+		char c = rawStr.chars[cIndex];
+		if (c != '\\' || cIndex+1 >= rawStr.length) { resultChars[resultLength++] = c; continue; }
+		cIndex++;
+		char escapeChar = rawStr.chars[cIndex];
+		switch (escapeChar)
+		{
+			case 'n': resultChars[resultLength++] = '\n'; break;
+			case 't': resultChars[resultLength++] = '\t'; break;
+			case 'r': resultChars[resultLength++] = '\r'; break;
+			case 'b': resultChars[resultLength++] = '\b'; break;
+			case 'f': resultChars[resultLength++] = '\f'; break;
+			case 'u':
+			{
+				bool isValid = (cIndex + 4 < rawStr.length);
+				u32 codepoint = isValid ? JsonReaderParseHex4(&rawStr.chars[cIndex+1], &isValid) : 0;
+				if (!isValid) { JsonReaderFail(state, "Invalid \\u escape sequence"); break; }
+				cIndex += 4;
+				//surrogate pairs come as two \u escapes
+				if (codepoint >= 0xD800 && codepoint <= 0xDBFF && cIndex + 6 < rawStr.length && rawStr.chars[cIndex+1] == '\\' && rawStr.chars[cIndex+2] == 'u')
+				{
+					u32 lowSurrogate = JsonReaderParseHex4(&rawStr.chars[cIndex+3], &isValid);
+					if (isValid && lowSurrogate >= 0xDC00 && lowSurrogate <= 0xDFFF)
+					{
+						codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+						cIndex += 6;
+					}
+				}
+				u8 encodedBytes[UTF8_MAX_CHAR_SIZE];
+				u8 encodedSize = GetUtf8BytesForCode(codepoint, &encodedBytes[0]);
+				//a \uXXXX escape is 6 bytes (12 for a pair) and never encodes to more than 4 so we can't overrun the buffer
+				MyMemCopy(&resultChars[resultLength], &encodedBytes[0], encodedSize);
+				resultLength += encodedSize;
+			} break;
+			default: resultChars[resultLength++] = escapeChar; break; // \" \\ \/ and anything else we just pass through
+		}
+	}
+	resultChars[resultLength] = '\0';
+	return NewStr(resultLength, resultChars);
+}
+
+//Scans without interpreting, isIntegerOut is false if there's a fraction or exponent
+bool JsonReaderScanNumber(JsonReaderState_t* state, MyStr_t* numberStrOut, bool* isIntegerOut)
+{
+	u64 startIndex = state->index;
+	bool isInteger = true;
+	if (state->json.chars[state->index] == '-') { state->index++; }
+	while (state->index < state->json.length)
+	{
+		char c = state->json.chars[state->index];
+		if (c >= '0' && c <= '9') { }
+		else if (c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-') { isInteger = false; }
+		else { break; }
+		state->index++;
+	}
+	*numberStrOut = NewStr(state->index - startIndex, &state->json.chars[startIndex]);
+	*isIntegerOut = isInteger;
+	if (numberStrOut->length == 0 || (numberStrOut->length == 1 && numberStrOut->chars[0] == '-'))
+	{
+		JsonReaderFail(state, "Invalid number");
+		return false;
+	}
+	return true;
+}
+
+bool JsonReaderParseI64(MyStr_t numberStr, i64* valueOut)
+{
+	bool isNegative = (numberStr.chars[0] == '-');
+	u64 value = 0;
+	for (u64 cIndex = (isNegative ? 1 : 0); cIndex < numberStr.length; cIndex++)
+	{
+		u64 digit = (u64)(numberStr.chars[cIndex] - '0');
+		if (value > (UINT64_MAX - digit) / 10) { return false; }
+		value = (value * 10) + digit;
+	}
+	if (value > (isNegative ? ((u64)INT64_MAX + 1) : (u64)INT64_MAX)) { return false; }
+	*valueOut = isNegative ? (i64)(0 - value) : (i64)value;
+	return true;
+}
+
+bool JsonReaderParseR64(MyStr_t numberStr, r64* valueOut)
+{
+	if (numberStr.length > JSON_READER_MAX_NUMBER_LENGTH) { return false; }
+	char numberBuffer[JSON_READER_MAX_NUMBER_LENGTH+1];
+	MyMemCopy(&numberBuffer[0], numberStr.chars, numberStr.length);
+	numberBuffer[numberStr.length] = '\0';
+	char* endPntr = nullptr;
+	*valueOut = strtod(&numberBuffer[0], &endPntr);
+	return (endPntr == &numberBuffer[numberStr.length]);
+}
+
+//Skips a whole value without looking at anything inside of it (mismatched bracket types inside a skipped value are not caught)
+void JsonReaderSkipValue(JsonReaderState_t* state)
+{
+	char firstChar = state->json.chars[state->index];
+	if (firstChar == '"')
+	{
+		MyStr_t rawStr; bool hasEscapes;
+		JsonReaderScanString(state, &rawStr, &hasEscapes);
+		return;
+	}
+	if (firstChar != '{' && firstChar != '[')
+	{
+		//number or literal, runs until the next separator
+		while (state->index < state->json.length)
+		{
+			char c = state->json.chars[state->index];
+			if (c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t' || c == '\n' || c == '\r') { break; }
+			state->index++;
+		}
+		return;
+	}
+	
+	u64 depth = 0;
+	while (state->index < state->json.length && !state->failed)
+	{
+		char c = state->json.chars[state->index];
+		if (c == '"')
+		{
+			MyStr_t rawStr; bool hasEscapes;
+			JsonReaderScanString(state, &rawStr, &hasEscapes);
+			continue;
+		}
+		state->index++;
+		if (c == '{' || c == '[') { depth++; }
+		else if (c == '}' || c == ']')
+		{
+			depth--;
+			if (depth == 0) { return; }
+		}
+	}
+	JsonReaderFail(state, "Unexpected end of json");
+}
+
+// +--------------------------------------------------------------+
+// |                        Path Matching                         |
+// +--------------------------------------------------------------+
+//Called as we step into the member or element at depth+1. Returns whether any binding cares about this value (or something inside it)
+bool JsonReaderEnterChild(JsonReaderState_t* state, u64 depth, MyStr_t key, u64 keyHash, bool isIndex, u64 index)
+{
+	bool anyInterested = false;
+	VarArrayLoop(&state->reader->fields, fIndex)
+	{
+		VarArrayLoopGet(JsonReaderField_t, field, &state->reader->fields, fIndex);
+		if (field->matchedDepth != depth || depth >= field->path.numPieces) { continue; }
+		const JsonPathPiece_t* piece = &field->path.pieces[depth];
+		bool matches = false;
+		if (piece->isWildcard) { matches = true; }
+		else if (isIndex) { matches = (piece->isIndex && piece->index == index); }
+		else { matches = (piece->keyHash == keyHash && StrEquals(piece->key, key)); }
+		if (matches)
+		{
+			field->matchedDepth = depth+1;
+			anyInterested = true;
+		}
+	}
+	return anyInterested;
+}
+void JsonReaderLeaveChild(JsonReaderState_t* state, u64 depth)
+{
+	VarArrayLoop(&state->reader->fields, fIndex)
+	{
+		VarArrayLoopGet(JsonReaderField_t, field, &state->reader->fields, fIndex);
+		if (field->matchedDepth > depth) { field->matchedDepth = depth; }
+	}
+}
+
+void JsonReaderTypeMismatch(JsonReaderState_t* state, JsonReaderField_t* field, const char* foundTypeStr)
+{
+	state->reader->numTypeMismatches++;
+	if (state->log != nullptr)
+	{
+		LogPrintLine_W(state->log, "Found %s not %s at \"%.*s\" (byte %llu)", foundTypeStr, GetJsonFieldTypeStr(field->type), StrPrint(field->path.pathStr), state->index);
+		state->log->hadWarnings = true;
+	}
+}
+
+//valuePntr points at a MyStr_t, i64, r64, bool or u64 depending on the field type
+void JsonReaderStoreValue(JsonReaderField_t* field, const void* valuePntr)
+{
+	void* destPntr = field->valuePntr;
+	if (field->list != nullptr)
+	{
+		switch (field->type)
+		{
+			case JsonFieldType_Str:   destPntr = VarArrayAdd(field->list, MyStr_t); break;
+			case JsonFieldType_I64:   destPntr = VarArrayAdd(field->list, i64);     break;
+			case JsonFieldType_R64:   destPntr = VarArrayAdd(field->list, r64);     break;
+			case JsonFieldType_Bool:  destPntr = VarArrayAdd(field->list, bool);    break;
+			case JsonFieldType_Count: destPntr = VarArrayAdd(field->list, u64);     break;
+			default: DebugAssert(false); break;
+		}
+		NotNull(destPntr);
+	}
+	switch (field->type)
+	{
+		case JsonFieldType_Str:   *(MyStr_t*)destPntr = *(const MyStr_t*)valuePntr; break;
+		case JsonFieldType_I64:   *(i64*)destPntr = *(const i64*)valuePntr;         break;
+		case JsonFieldType_R64:   *(r64*)destPntr = *(const r64*)valuePntr;         break;
+		case JsonFieldType_Bool:  *(bool*)destPntr = *(const bool*)valuePntr;       break;
+		case JsonFieldType_Count: *(u64*)destPntr = *(const u64*)valuePntr;         break;
+		default: DebugAssert(false); break;
+	}
+	field->numFound++;
+}
+
+// +--------------------------------------------------------------+
+// |                            Parser                            |
+// +--------------------------------------------------------------+
+void JsonReaderParseValue(JsonReaderState_t* state, u64 depth);
+
+//Counts the members/elements of a container and hands the count to any Count binding that matched it
+void JsonReaderStoreCount(JsonReaderState_t* state, u64 depth, u64 count)
+{
+	VarArrayLoop(&state->reader->fields, fIndex)
+	{
+		VarArrayLoopGet(JsonReaderField_t, field, &state->reader->fields, fIndex);
+		if (field->matchedDepth != depth || field->path.numPieces != depth) { continue; }
+		if (field->type == JsonFieldType_Count) { JsonReaderStoreValue(field, &count); }
+		else { JsonReaderTypeMismatch(state, field, "container"); }
+	}
+}
+
+void JsonReaderParseObject(JsonReaderState_t* state, u64 depth)
+{
+	DebugAssert(state->json.chars[state->index] == '{');
+	state->index++;
+	u64 numMembers = 0;
+	JsonReaderSkipWhitespace(state);
+	if (state->index < state->json.length && state->json.chars[state->index] == '}') { state->index++; JsonReaderStoreCount(state, depth, 0); return; }
+	
+	MemArena_t* scratch = state->scratch;
+	while (!state->failed)
+	{
+		JsonReaderSkipWhitespace(state);
+		if (state->index >= state->json.length || state->json.chars[state->index] != '"') { JsonReaderFail(state, "Expected a key string"); return; }
+		MyStr_t rawKey; bool keyHasEscapes;
+		if (!JsonReaderScanString(state, &rawKey, &keyHasEscapes)) { return; }
+		JsonReaderSkipWhitespace(state);
+		if (state->index >= state->json.length || state->json.chars[state->index] != ':') { JsonReaderFail(state, "Expected : after key"); return; }
+		state->index++;
+		JsonReaderSkipWhitespace(state);
+		if (state->index >= state->json.length) { JsonReaderFail(state, "Unexpected end of json"); return; }
+		
+		PushMemMark(scratch);
+		MyStr_t key = keyHasEscapes ? JsonReaderDecodeString(state, rawKey, true, scratch) : rawKey;
+		bool isInterested = JsonReaderEnterChild(state, depth, key, HashJsonKey(key.chars, key.length), false, 0);
+		PopMemMark(scratch);
+		if (isInterested) { JsonReaderParseValue(state, depth+1); }
+		else { JsonReaderSkipValue(state); state->reader->numValuesSkipped++; }
+		JsonReaderLeaveChild(state, depth);
+		numMembers++;
+		
+		JsonReaderSkipWhitespace(state);
+		if (state->index >= state->json.length) { JsonReaderFail(state, "Unterminated object"); return; }
+		char c = state->json.chars[state->index];
+		state->index++;
+		if (c == '}') { break; }
+		if (c != ',') { state->index--; JsonReaderFail(state, "Expected , or } in object"); return; }
+	}
+	JsonReaderStoreCount(state, depth, numMembers);
+}
+
+void JsonReaderParseArray(JsonReaderState_t* state, u64 depth)
+{
+	DebugAssert(state->json.chars[state->index] == '[');
+	state->index++;
+	u64 numElements = 0;
+	JsonReaderSkipWhitespace(state);
+	if (state->index < state->json.length && state->json.chars[state->index] == ']') { state->index++; JsonReaderStoreCount(state, depth, 0); return; }
+	
+	while (!state->failed)
+	{
+		JsonReaderSkipWhitespace(state);
+		if (state->index >= state->json.length) { JsonReaderFail(state, "Unexpected end of json"); return; }
+		bool isInterested = JsonReaderEnterChild(state, depth, MyStr_Empty, 0, true, numElements);
+		if (isInterested) { JsonReaderParseValue(state, depth+1); }
+		else { JsonReaderSkipValue(state); state->reader->numValuesSkipped++; }
+		JsonReaderLeaveChild(state, depth);
+		numElements++;
+		
+		JsonReaderSkipWhitespace(state);
+		if (state->index >= state->json.length) { JsonReaderFail(state, "Unterminated array"); return; }
+		char c = state->json.chars[state->index];
+		state->index++;
+		if (c == ']') { break; }
+		if (c != ',') { state->index--; JsonReaderFail(state, "Expected , or ] in array"); return; }
+	}
+	JsonReaderStoreCount(state, depth, numElements);
+}
+
+void JsonReaderParseValue(JsonReaderState_t* state, u64 depth)
+{
+	if (depth > JSON_READER_MAX_DEPTH) { JsonReaderFail(state, "Json is nested too deeply"); return; }
+	JsonReaderSkipWhitespace(state);
+	if (state->index >= state->json.length) { JsonReaderFail(state, "Unexpected end of json"); return; }
+	state->reader->numValuesRead++;
+	
+	char c = state->json.chars[state->index];
+	if (c == '{') { JsonReaderParseObject(state, depth); return; }
+	if (c == '[') { JsonReaderParseArray(state, depth); return; }
+	
+	MyStr_t rawStr = MyStr_Empty;
+	bool hasEscapes = false;
+	bool isInteger = false;
+	bool boolValue = false;
+	const char* foundTypeStr = nullptr;
+	if (c == '"') { if (!JsonReaderScanString(state, &rawStr, &hasEscapes)) { return; } foundTypeStr = "string"; }
+	else if (c == 't') { if (!JsonReaderConsumeLiteral(state, "true")) { return; } boolValue = true; foundTypeStr = "true"; }
+	else if (c == 'f') { if (!JsonReaderConsumeLiteral(state, "false")) { return; } boolValue = false; foundTypeStr = "false"; }
+	else if (c == 'n') { if (!JsonReaderConsumeLiteral(state, "null")) { return; } foundTypeStr = "null"; }
+	else if (c == '-' || (c >= '0' && c <= '9')) { if (!JsonReaderScanNumber(state, &rawStr, &isInteger)) { return; } foundTypeStr = "number"; }
+	else { JsonReaderFail(state, "Unexpected character"); return; }
+	
+	//null fills any binding with an empty/zero value, same as the TryGetJsonValue functions do
+	bool isNull = (c == 'n');
+	VarArrayLoop(&state->reader->fields, fIndex)
+	{
+		VarArrayLoopGet(JsonReaderField_t, field, &state->reader->fields, fIndex);
+		if (field->matchedDepth != depth || field->path.numPieces != depth) { continue; }
+		switch (field->type)
+		{
+			case JsonFieldType_Str:
+			{
+				if (c != '"' && !isNull) { JsonReaderTypeMismatch(state, field, foundTypeStr); break; }
+				MyStr_t value = isNull ? MyStr_Empty : JsonReaderDecodeString(state, rawStr, hasEscapes, state->reader->valueArena);
+				JsonReaderStoreValue(field, &value);
+			} break;
+			case JsonFieldType_I64:
+			{
+				i64 value = 0;
+				if (!isNull && (c == '"' || c == 't' || c == 'f' || !isInteger || !JsonReaderParseI64(rawStr, &value))) { JsonReaderTypeMismatch(state, field, foundTypeStr); break; }
+				JsonReaderStoreValue(field, &value);
+			} break;
+			case JsonFieldType_R64:
+			{
+				r64 value = 0;
+				if (!isNull && (c == '"' || c == 't' || c == 'f' || !JsonReaderParseR64(rawStr, &value))) { JsonReaderTypeMismatch(state, field, foundTypeStr); break; }
+				JsonReaderStoreValue(field, &value);
+			} break;
+			case JsonFieldType_Bool:
+			{
+				if (c != 't' && c != 'f' && !isNull) { JsonReaderTypeMismatch(state, field, foundTypeStr); break; }
+				JsonReaderStoreValue(field, &boolValue);
+			} break;
+			case JsonFieldType_Count: JsonReaderTypeMismatch(state, field, foundTypeStr); break;
+			default: DebugAssert(false); break;
+		}
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                             Run                              |
+// +--------------------------------------------------------------+
+//NOTE: Bindings that don't show up in the json are left untouched, set defaults before calling this.
+//      jsonStr doesn't need to be null-terminated so a mapped file can be passed in directly
+bool JsonReaderRun(JsonReader_t* reader, MyStr_t jsonStr, ProcessLog_t* log = nullptr)
+{
+	NotNull(reader);
+	NotNullStr(&jsonStr);
+	reader->numValuesRead = 0;
+	reader->numValuesSkipped = 0;
+	reader->numTypeMismatches = 0;
+	VarArrayLoop(&reader->fields, fIndex)
+	{
+		VarArrayLoopGet(JsonReaderField_t, field, &reader->fields, fIndex);
+		field->numFound = 0;
+		field->matchedDepth = 0;
+	}
+	
+	JsonReaderState_t state = {};
+	state.reader = reader;
+	state.log = log;
+	state.scratch = GetScratchArena(reader->allocArena, reader->valueArena);
+	state.json = jsonStr;
+	//skip a UTF-8 byte order mark if there is one
+	if (jsonStr.length >= 3 && (u8)jsonStr.chars[0] == 0xEF && (u8)jsonStr.chars[1] == 0xBB && (u8)jsonStr.chars[2] == 0xBF) { state.index = 3; }
+	
+	JsonReaderParseValue(&state, 0);
+	JsonReaderSkipWhitespace(&state);
+	if (!state.failed && state.index < jsonStr.length) { JsonReaderFail(&state, "Unexpected characters after the end of the json"); }
+	FreeScratchArena(state.scratch);
+	
+	if (state.failed)
+	{
+		if (log != nullptr)
+		{
+			u64 lineNum = 1;
+			for (u64 cIndex = 0; cIndex < state.errorIndex && cIndex < jsonStr.length; cIndex++) { if (jsonStr.chars[cIndex] == '\n') { lineNum++; } }
+			LogPrintLine_E(log, "%s at line %llu (byte %llu)", state.errorMsg, lineNum, state.errorIndex);
+			log->hadErrors = true;
+		}
+		return false;
+	}
+	return true;
+}
+
+#endif // JSON_SUPPORTED
@@ -74,7 +74,13 @@ extern "C" {
 #include "pig/pig_serialization.h"
 #include "pig/pig_input_chars.h"
 #include "pig/pig_ui_theme.h"
+#include "pig/pig_image_kernels.h"
+#include "pig/pig_texture_compression.h"
 #include "pig/pig_render.h"
+#include "pig/pig_frustum.h"
+#include "pig/pig_skeletal_anim.h"
+#include "pig/pig_texture_atlas.h"
+#include "pig/pig_max_rects.h"
 #include "pig/pig_types.h"
 #include "pig/pig_slug_types.h"
 #include "pig/pig_svg.h"
@@ -82,6 +88,7 @@ extern "C" {
 #include "pig/pig_vox_frame_set.h"
 #include "pig/pig_font.h"
 #include "pig/pig_slug.h"
+#include "pig/pig_render_commands.h"
 #include "pig/pig_render_context.h"
 #include "pig/pig_resources.h"
 #include "pig/pig_resource_pool.h"
@@ -95,9 +102,13 @@ extern "C" {
 #include "pig/pig_lua.h"
 #include "pig/pig_python.h"
 #include "pig/pig_debug_commands.h"
+#include "pig/pig_debug_exp.h"
 #include "pig/pig_debug_console.h"
+#include "pig/pig_profiler.h"
+#include "pig/pig_mem_tracker.h"
 #include "pig/pig_confirm_dialog.h"
 #include "pig/pig_tasks.h"
+#include "pig/pig_asset_pack.h"
 
 #include "game_main.h"
 
@@ -155,15 +166,21 @@ static       rec              ScreenRec      = {};
 #include "pig/pig_notification_macros.cpp"
 #include "pig/pig_time.cpp"
 #include "pig/pig_ui_theme.cpp"
+#include "pig/pig_asset_pack.cpp"
 
 #include "pig/pig_json.cpp"
+#include "pig/pig_json_reader.cpp"
 #include "pig/pig_wav.cpp"
 #include "pig/pig_ogg.cpp"
 #include "pig/pig_vertex_buffer.cpp"
 #include "pig/pig_shader.cpp"
+#include "pig/pig_image_kernels.cpp"
+#include "pig/pig_texture_compression.cpp"
 #include "pig/pig_texture.cpp"
+#include "pig/pig_texture_atlas.cpp"
 #include "pig/pig_texture_array.cpp"
 #include "pig/pig_frame_buffer.cpp"
+#include "pig/pig_max_rects.cpp"
 #include "pig/pig_sprite_sheet.cpp"
 #include "pig/pig_sprite_sheet_meta.cpp"
 #include "pig/pig_svg.cpp"
@@ -175,7 +192,9 @@ static       rec              ScreenRec      = {};
 #include "pig/pig_model_obj_serialization.cpp"
 #include "pig/pig_model_armature.cpp"
 #include "pig/pig_model_armature_serialization.cpp"
+#include "pig/pig_frustum.cpp"
 #include "pig/pig_model.cpp"
+#include "pig/pig_skeletal_anim.cpp"
 #include "pig/pig_sounds.cpp"
 #include "pig/pig_music.cpp"
 #include "pig/pig_resources.cpp"
@@ -188,6 +207,7 @@ static       rec              ScreenRec      = {};
 #include "pig/pig_window.cpp"
 #include "pig/pig_imgui.cpp"
 
+#include "pig/pig_render_commands.cpp"
 #include "pig/pig_render.cpp"
 #include "pig/pig_slug_render.cpp"
 #include "pig/pig_render_funcs_2d.cpp"
@@ -205,6 +225,9 @@ static       rec              ScreenRec      = {};
 #include "pig/pig_render_funcs_extra.cpp"
 #include "pig/pig_lua.cpp"
 #include "pig/pig_python.cpp"
+#include "pig/pig_profiler.cpp"
+#include "pig/pig_mem_tracker.cpp"
+#include "pig/pig_debug_exp.cpp"
 #include "pig/pig_debug_commands.cpp"
 #include "pig/pig_debug_console.cpp"
 #include "pig/pig_notifications.cpp"
@@ -298,7 +321,10 @@ PIG_UPDATE_DEF(Pig_Update)
 PIG_AUDIO_SERVICE_DEF(Pig_AudioService)
 {
 	//NOTE: This function runs on the audio thread
+	PigProfileThread("Audio");
+	PigProfileBegin("AudioService");
 	PigAudioService(audioInfo);
+	PigProfileEnd();
 }
 
 // +==============================+
@@ -320,6 +346,7 @@ PIG_SHOULD_WINDOW_CLOSE_DEF(Pig_ShouldWindowClose)
 PIG_PERFORM_TASK_DEF(Pig_PerformTask)
 {
 	//NOTE: This function runs on a thread pool thread
+	PigProfileBegin("Task");
 	if (task->input.type >= GameTask_Base)
 	{
 		GameHandleTask(info, api, thread, task);
@@ -328,6 +355,7 @@ PIG_PERFORM_TASK_DEF(Pig_PerformTask)
 	{
 		PigHandleTask(info, api, thread, task);
 	}
+	PigProfileEnd();
 	AssertIf(thread->tempArena.size > 0, GetNumMarks(&thread->tempArena) == 0);
 }
 
@@ -11,7 +11,36 @@ Description:
 
 struct PigGifFrame_t
 {
-	PlatImageData_t imageData;
+	u64 windowId;
+	u64 index;
+	u16 centiseconds;
+	bool finished;
+	bool success;
+	PlatImageData_t imageData; //freed by the worker thread once encoded
+	MsfGifResult result; //a complete single frame GIF, we only copy out the frame blocks
+};
+
+//NOTE: Frames are captured on the main thread and then encoded in parallel on the thread pool.
+//      Each frame gets its own palette so they can be encoded independently, and they are
+//      written to the file in order as soon as all earlier frames have finished
+struct PigGifEncoder_t
+{
+	bool active;
+	bool finishing;
+	MyStr_t filePath; //allocated from mainHeap
+	PlatOpenFile_t file;
+	bool writeFailed;
+	v2i size;
+	PerfTime_t startTime;
+	
+	u64 numFramesCaptured; //also the index of the next frame
+	u64 nextWriteIndex;
+	u64 numFramesWritten;
+	u64 numFramesDropped;
+	u16 droppedCentiseconds; //added onto the delay of the next captured frame so playback speed stays correct
+	u64 numBytesWritten;
+	u64 rawBytesCaptured;
+	PigGifFrame_t* frames[GIF_MAX_FRAMES_IN_FLIGHT]; //indexed by (frame index % GIF_MAX_FRAMES_IN_FLIGHT)
 };
 
 struct PigWindowState_t
@@ -29,7 +58,7 @@ struct PigWindowState_t
 	bool recordingGif;
 	bool finishGif;
 	bool gifKeyWasUsedForSelection;
-	LinkedList_t gifFrames; //PigGifFrame_t
+	PigGifEncoder_t gifEncoder;
 };
 
 struct PigState_t
@@ -44,6 +73,7 @@ struct PigState_t
 	PigSettings_t settings;
 	PigDebugBindings_t debugBindings;
 	PigDebugBindings_t sessionDebugBindings;
+	PigDebugExpCache_t debugExp;
 	RandomSeries_t random;
 	
 	//Memory Arenas
@@ -77,6 +107,10 @@ struct PigState_t
 	//Rendering
 	RenderApi_t renderApi;
 	RenderContext_t renderContext;
+	bool shaderBinaryCacheEnabled;
+	u64 shaderDriverHash; //GL_VENDOR, GL_RENDERER and GL_VERSION hashed together, see InitShaderBinaryCache_OpenGL
+	u64 numShaderBinaryHits;
+	u64 numShaderBinaryMisses;
 	
 	//UI
 	GlobalTheme_t theme;
@@ -95,6 +129,9 @@ struct PigState_t
 	
 	//Resources
 	Resources_t resources;
+	#if PIG_ASSET_PACK
+	AssetPack_t assetPack;
+	#endif
 	
 	//Window Management
 	const PlatWindow_t* currentWindow;
@@ -106,6 +143,8 @@ struct PigState_t
 	bool wasMouseCapturedLastFrame;
 	MouseHitInfo_t prevMouseHit;
 	MouseHitInfo_t mouseHit;
+	char mouseHitNames[2][MOUSE_HIT_NAME_BUFFER_SIZE]; //mouseHit.name and prevMouseHit.name, they swap each frame
+	MouseHitGrid_t mouseHitGrid;
 	u64 prevProgramTime;
 	BtnHandlingInfo_t keyHandled[Key_NumKeys];
 	BtnHandlingInfo_t mouseBtnHandled[MouseBtn_NumBtns];
@@ -134,6 +173,12 @@ struct PigState_t
 	PigPerfGraph_t perfGraph;
 	PigMemGraph_t memGraph;
 	PigAudioOutGraph_t audioOutGraph;
+	#if PIG_PROFILER
+	PigProfiler_t profiler;
+	#endif
+	#if PIG_MEM_TRACKING
+	PigMemTracker_t memTracker;
+	#endif
 	r64 physicsSimTimeLastFrame;
 	bool cyclicFuncsDebug;
 	CyclicFunc_t cyclicFunc;
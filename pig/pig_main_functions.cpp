@@ -55,6 +55,10 @@ void PigInitialize(EngineMemory_t* memory)
 	#endif
 	pig->tempArena.debugName      = NewStringInArenaNt(&pig->mainHeap, "tempArena").chars;
 	#endif
+	#if PIG_MEM_TRACKING
+	InitPigMemTracker(&pig->memTracker);
+	PigMemTrackArena(&pig->memTracker, &pig->mainHeap, "mainHeap");
+	#endif
 	TempPushMark();
 	
 	PerfTime_t initStartTime = GetPerfTime();
@@ -65,6 +69,9 @@ void PigInitialize(EngineMemory_t* memory)
 	GameLoadSettings(&pig->settings, mainHeap);
 	InitializePigPerfGraph(&pig->perfGraph);
 	InitializePigMemGraph(&pig->memGraph);
+	#if PIG_PROFILER
+	InitPigProfiler(&pig->profiler, mainHeap, &pig->threadSafeHeap);
+	#endif
 	{
 		MemArena_t* scratch1 = GetScratchArena();
 		MemArena_t* scratch2 = GetScratchArena(scratch1);
@@ -101,6 +108,10 @@ void PigInitialize(EngineMemory_t* memory)
 	PrintLine_N("|    Pig engine v%u.%02u(%03u)     |", ENGINE_VERSION_MAJOR, ENGINE_VERSION_MINOR, ENGINE_VERSION_BUILD);
 	WriteLine_N("+==============================+");
 	
+	#if PIG_ASSET_PACK
+	Pig_OpenAssetPack(); //a pack has to be open before anything gets loaded, from here on plat reads files out of it if it exists
+	#endif
+	
 	#if !DEBUG_BUILD && GYLIB_ASSERTIONS_ENABLED
 	bool isFolder = false;
 	plat->DoesFileExist(NewStr("Resources"), &isFolder);
@@ -112,6 +123,7 @@ void PigInitialize(EngineMemory_t* memory)
 	const GLubyte* vendor = glGetString(GL_VENDOR); // Returns the vendor
 	const GLubyte* renderer = glGetString(GL_RENDERER); // Returns a hint to the model
 	PrintLine_D("Using %s API on %s %s", GetRenderApiStr(pig->renderApi), vendor, renderer);
+	InitShaderBinaryCache_OpenGL();
 	#endif
 	
 	SeedRand((u32)LocalTimestamp);
@@ -137,7 +149,14 @@ void PigInitialize(EngineMemory_t* memory)
 	RcLoadBasicResources();
 	Pig_InitResources();
 	GamePinResources();
+	#if PIG_ASSET_PACK
+	//Only worth decompressing everything up front when everything is about to be loaded
+	if (pig->assetPack.isOpen && LOAD_ALL_RESOURCES_ON_STARTUP) { PrefetchAssetPack(&pig->assetPack); }
+	#endif
 	Pig_LoadResourceAtStartup(!LOAD_ALL_RESOURCES_ON_STARTUP, BEFORE_RESOURCES_LOAD_PERCENT, RESOURCES_LOAD_PERCENT);
+	#if PIG_ASSET_PACK
+	if (!ReleaseAssetPackCache(&pig->assetPack)) { WriteLine_W("Keeping the asset pack cache around, files mapped out of it are still open"); }
+	#endif
 	#if STEAM_BUILD
 	Pig_InitializeSteamAvatars();
 	#endif
@@ -145,6 +164,7 @@ void PigInitialize(EngineMemory_t* memory)
 	PigInitDebugBindings(&pig->sessionDebugBindings, fixedHeap);
 	PigInitDebugBindings(&pig->debugBindings, fixedHeap);
 	GameLoadDebugBindings(&pig->debugBindings);
+	InitDebugExpCache(&pig->debugExp, mainHeap);
 	PigInitImgui();
 	#if LUA_SUPPORTED
 	PigInitLua();
@@ -184,7 +204,9 @@ void PigUpdateMainWindow()
 {
 	CheckScratchNumMarksDuringUpdate();
 	PigUpdateImguiBefore();
+	PigProfileBegin("UpdateResources");
 	Pig_UpdateResources();
+	PigProfileEnd();
 	
 	PigNotificationsCaptureMouse(&pig->notificationsQueue);
 	PigDebugOverlayCaptureMouse(&pig->debugOverlay);
@@ -209,9 +231,13 @@ void PigUpdateMainWindow()
 	#endif
 	PigImguiHandleInputEventsAndCaptureMouse();
 	
+	PigProfileBegin("GameGeneralUpdate");
 	GameGeneralUpdate();
+	PigProfileEnd();
 	Pig_HandleAppStateChanges(false);
+	PigProfileBegin("UpdateAppState");
 	UpdateAppState(pig->currentAppState);
+	PigProfileEnd();
 	
 	PigUpdateImguiAfter();
 	CheckScratchNumMarksDuringUpdate();
@@ -270,7 +296,8 @@ void PigRenderOutOfScreenshotOverlays()
 		RcDrawTexturedRectangle(gifRecordingRec, White);
 		
 		RcBindFont(&pig->resources.fonts->debug, SelectDefaultFontFace());
-		i32 gifRecordTime = RoundR32i(pig->currentWindowState->gifFrames.count * (1000.0f / GIF_FRAMERATE));
+		const PigGifEncoder_t* gifEncoder = &pig->currentWindowState->gifEncoder;
+		i32 gifRecordTime = RoundR32i((gifEncoder->numFramesCaptured + gifEncoder->numFramesDropped) * (1000.0f / GIF_FRAMERATE));
 		v2 recordingTextPos = NewVec2(gifRecordingRec.x + gifRecordingRec.width/2, gifRecordingRec.y + gifRecordingRec.height + 5 + RcGetMaxAscend());
 		Vec2Align(&recordingTextPos);
 		RcDrawTextPrintEx(recordingTextPos, White, TextAlignment_Center, 0, "F4 to stop (%s)", FormatMillisecondsNt(gifRecordTime, TempArena));
@@ -291,6 +318,9 @@ void PigRenderDebugOverlays()
 	RenderPigAudioOutGraph(&pig->audioOutGraph);
 	RenderPigPerfGraph(&pig->perfGraph);
 	RenderPigMemGraph(&pig->memGraph);
+	#if PIG_PROFILER
+	RenderPigProfiler(&pig->profiler);
+	#endif
 	Pig_InputRenderDebugInfo();
 	RenderPigDebugOverlay(&pig->debugOverlay);
 	PigRenderNotifications(&pig->notificationsQueue);
@@ -356,6 +386,13 @@ void PigUpdate()
 	#endif
 	CheckScratchNumMarksDuringUpdate();
 	
+	#if PIG_PROFILER
+	UpdatePigProfilerBefore(&pig->profiler);
+	#endif
+	#if PIG_MEM_TRACKING
+	UpdatePigMemTrackerBefore(&pig->memTracker);
+	#endif
+	PigProfileBegin("PigUpdate");
 	UpdatePigPerfGraphBefore(&pig->perfGraph);
 	PigHandlePlatformDebugLines(&pigIn->platDebugLines);
 	PigHandleTaskCompletedInputEvents();
@@ -365,10 +402,16 @@ void PigUpdate()
 	PigUpdateMusicSystem(&pig->musicSystem);
 	
 	Pig_ChangeWindow(platInfo->mainWindow);
+	PigProfileBegin("UpdateMainWindow");
 	PigUpdateMainWindow();
+	PigProfileEnd();
 	
 	if (true)
 	{
+		PigProfileBegin("Render");
+		RcStartFrame();
+		Pig_FlushFontGlyphAtlases();
+		Pig_FlushTextureAtlas();
 		const PlatWindow_t* window = LinkedListFirst(platInfo->windows, PlatWindow_t);
 		bool isMainWindow = (window == platInfo->mainWindow);
 		for (u32 wIndex = 0; wIndex < platInfo->windows->count; wIndex++)
@@ -392,11 +435,15 @@ void PigUpdate()
 						firstRenderingAppStateIndex = aIndex-1;
 						if (DoesAppStateCoverBelow(pig->appStateStack[aIndex-1])) { break; }
 					}
+					PigProfileBegin("RenderAppState");
 					for (u64 aIndex = firstRenderingAppStateIndex; aIndex < pig->appStateStackSize; aIndex++)
 					{
 						RenderAppState(pig->appStateStack[aIndex], renderBuffer, (aIndex == firstRenderingAppStateIndex));
 					}
+					PigProfileEnd();
+					PigProfileBegin("RenderDebugOverlays");
 					PigRenderDebugOverlays();
+					PigProfileEnd();
 					PigRenderForcedOverlays();
 				}
 				else
@@ -416,10 +463,15 @@ void PigUpdate()
 			}
 			window = LinkedListNext(platInfo->windows, PlatWindow_t, window);
 		}
+		RcEndFrame();
+		PigProfileBegin("SwapBuffers");
 		plat->SwapBuffers();
+		PigProfileEnd();
+		PigProfileEnd();
 	}
 	
 	Pig_UpdateInputAfter();
+	PigProfileEnd();
 	CheckScratchNumMarksDuringUpdate();
 	pig->firstUpdate = false;
 }
@@ -467,10 +519,18 @@ void PigPostReload(Version_t oldVersion)
 	UpdateMemArenaFuncPntrs(&pig->pythonHeap, PlatAllocFunc, PlatFreeFunc);
 	#endif
 	UpdateMemArenaFuncPntrs(&pig->audioHeap, PlatAllocFunc, PlatFreeFunc);
+	if (pig->debugExp.contextBuilt) { UpdateMemArenaFuncPntrs(&pig->debugExp.contextHeap, PlatAllocFunc, PlatFreeFunc); }
 	GyLibDebugOutputFunc = Pig_GyLibDebugOutputHandler;
 	GyLibDebugPrintFunc  = Pig_GyLibDebugPrintHandler;
 	
 	DebugConsoleClearRegisteredCommands(&pig->debugConsole);
+	InvalidateDebugExpCache(&pig->debugExp);
+	#if PIG_PROFILER
+	PigProfilerHandleReload(&pig->profiler);
+	#endif
+	#if PIG_MEM_TRACKING
+	PigMemTrackerHandleReload(&pig->memTracker);
+	#endif
 	
 	Pig_ChangeWindow(platInfo->mainWindow);
 	PigImguiHandleReload();
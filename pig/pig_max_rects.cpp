@@ -0,0 +1,125 @@
+/*
+File:   pig_max_rects.cpp
+Date:   10\19\2026
+Description:
+	** Holds the functions that initialize and insert into a MaxRectsPacker_t
+*/
+
+void FreeMaxRectsPacker(MaxRectsPacker_t* packer)
+{
+	NotNull(packer);
+	FreeVarArray(&packer->freeRecs);
+	ClearPointer(packer);
+}
+
+void InitMaxRectsPacker(MaxRectsPacker_t* packer, MemArena_t* memArena, v2i binSize)
+{
+	NotNull2(packer, memArena);
+	Assert(binSize.width > 0 && binSize.height > 0);
+	ClearPointer(packer);
+	packer->allocArena = memArena;
+	packer->binSize = binSize;
+	CreateVarArray(&packer->freeRecs, memArena, sizeof(reci), 16);
+	reci* fullRec = VarArrayAdd(&packer->freeRecs, reci);
+	NotNull(fullRec);
+	*fullRec = NewReci(0, 0, binSize.width, binSize.height);
+}
+
+bool MaxRectsRecContains(reci outer, reci inner)
+{
+	return (inner.x >= outer.x && inner.y >= outer.y &&
+		inner.x + inner.width <= outer.x + outer.width &&
+		inner.y + inner.height <= outer.y + outer.height);
+}
+
+//Cuts usedRec out of every free rectangle it overlaps, leaving up to 4 maximal leftovers around it
+void MaxRectsSplitFreeRecs(MaxRectsPacker_t* packer, reci usedRec)
+{
+	u64 numFreeRecs = packer->freeRecs.length;
+	for (u64 fIndex = 0; fIndex < numFreeRecs; )
+	{
+		reci freeRec = *VarArrayGet(&packer->freeRecs, fIndex, reci);
+		if (usedRec.x >= freeRec.x + freeRec.width || usedRec.x + usedRec.width <= freeRec.x ||
+			usedRec.y >= freeRec.y + freeRec.height || usedRec.y + usedRec.height <= freeRec.y)
+		{
+			fIndex++;
+			continue;
+		}
+		
+		reci leftovers[4];
+		u64 numLeftovers = 0;
+		if (usedRec.x > freeRec.x) { leftovers[numLeftovers++] = NewReci(freeRec.x, freeRec.y, usedRec.x - freeRec.x, freeRec.height); }
+		if (usedRec.x + usedRec.width < freeRec.x + freeRec.width) { leftovers[numLeftovers++] = NewReci(usedRec.x + usedRec.width, freeRec.y, (freeRec.x + freeRec.width) - (usedRec.x + usedRec.width), freeRec.height); }
+		if (usedRec.y > freeRec.y) { leftovers[numLeftovers++] = NewReci(freeRec.x, freeRec.y, freeRec.width, usedRec.y - freeRec.y); }
+		if (usedRec.y + usedRec.height < freeRec.y + freeRec.height) { leftovers[numLeftovers++] = NewReci(freeRec.x, usedRec.y + usedRec.height, freeRec.width, (freeRec.y + freeRec.height) - (usedRec.y + usedRec.height)); }
+		
+		VarArrayRemove(&packer->freeRecs, fIndex, reci);
+		numFreeRecs--;
+		for (u64 lIndex = 0; lIndex < numLeftovers; lIndex++)
+		{
+			reci* newFreeRec = VarArrayAdd(&packer->freeRecs, reci); //added past numFreeRecs so we don't split them again
+			NotNull(newFreeRec);
+			*newFreeRec = leftovers[lIndex];
+		}
+	}
+}
+
+//Removes free rectangles that are fully inside another one, they can never be a better choice
+void MaxRectsPruneFreeRecs(MaxRectsPacker_t* packer)
+{
+	for (u64 fIndex1 = 0; fIndex1 < packer->freeRecs.length; )
+	{
+		bool removedRec1 = false;
+		for (u64 fIndex2 = fIndex1+1; fIndex2 < packer->freeRecs.length; )
+		{
+			reci rec1 = *VarArrayGet(&packer->freeRecs, fIndex1, reci);
+			reci rec2 = *VarArrayGet(&packer->freeRecs, fIndex2, reci);
+			if (MaxRectsRecContains(rec2, rec1))
+			{
+				VarArrayRemove(&packer->freeRecs, fIndex1, reci);
+				removedRec1 = true;
+				break;
+			}
+			if (MaxRectsRecContains(rec1, rec2)) { VarArrayRemove(&packer->freeRecs, fIndex2, reci); }
+			else { fIndex2++; }
+		}
+		if (!removedRec1) { fIndex1++; }
+	}
+}
+
+bool MaxRectsInsert(MaxRectsPacker_t* packer, v2i size, reci* recOut)
+{
+	NotNull2(packer, recOut);
+	Assert(size.width > 0 && size.height > 0);
+	
+	//Best Short Side Fit: pick the free rectangle that leaves the smallest leftover on its shorter side
+	bool foundSpot = false;
+	reci bestRec = Reci_Zero;
+	i32 bestShortSide = 0;
+	i32 bestLongSide = 0;
+	VarArrayLoop(&packer->freeRecs, fIndex)
+	{
+		VarArrayLoopGet(reci, freeRec, &packer->freeRecs, fIndex);
+		if (freeRec->width < size.width || freeRec->height < size.height) { continue; }
+		i32 leftoverX = freeRec->width - size.width;
+		i32 leftoverY = freeRec->height - size.height;
+		i32 shortSide = MinI32(leftoverX, leftoverY);
+		i32 longSide = MaxI32(leftoverX, leftoverY);
+		if (!foundSpot || shortSide < bestShortSide || (shortSide == bestShortSide && longSide < bestLongSide))
+		{
+			foundSpot = true;
+			bestRec = NewReci(freeRec->topLeft, size);
+			bestShortSide = shortSide;
+			bestLongSide = longSide;
+		}
+	}
+	if (!foundSpot) { return false; }
+	
+	MaxRectsSplitFreeRecs(packer, bestRec);
+	MaxRectsPruneFreeRecs(packer);
+	packer->usedSize.width = MaxI32(packer->usedSize.width, bestRec.x + bestRec.width);
+	packer->usedSize.height = MaxI32(packer->usedSize.height, bestRec.y + bestRec.height);
+	packer->usedArea += (u64)(size.width * size.height);
+	*recOut = bestRec;
+	return true;
+}
@@ -0,0 +1,23 @@
+/*
+File:   pig_max_rects.h
+Date:   10\19\2026
+Description:
+	** A MaxRectsPacker_t places rectangles of arbitrary sizes into a fixed size bin using the MaxRects
+	** algorithm (Jukka Jylanki, "A Thousand Ways to Pack the Bin") with the Best Short Side Fit heuristic.
+	** It keeps a list of maximal free rectangles (which may overlap each other), so it packs irregular
+	** sizes much tighter than the shelf packers used by the font and texture atlases
+*/
+
+#ifndef _PIG_MAX_RECTS_H
+#define _PIG_MAX_RECTS_H
+
+struct MaxRectsPacker_t
+{
+	MemArena_t* allocArena;
+	v2i binSize;
+	v2i usedSize; //bottom right corner of everything placed so far
+	u64 usedArea;
+	VarArray_t freeRecs; //reci
+};
+
+#endif //  _PIG_MAX_RECTS_H
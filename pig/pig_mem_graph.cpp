@@ -583,6 +583,9 @@ void RenderPigMemGraph_Imgui(PigMemGraph_t* graph)
 			ImGui::ProgressBar(usedPercent);
 			ImGui::PopStyleColor();
 		}
+		#if PIG_MEM_TRACKING
+		RenderPigMemTracker_Imgui(&pig->memTracker, arena->pntr, graph->historyGraphsHeight);
+		#endif
 		ImGui::Unindent();
 		
 		ImGui::PopID();
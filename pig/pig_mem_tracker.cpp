@@ -0,0 +1,624 @@
+/*
+File:   pig_mem_tracker.cpp
+Date:   10\19\2026
+Description:
+	** Holds the PigTrackedAllocMem/PigTrackedFreeMem/PigTrackedReallocMem wrappers that AllocMem/FreeMem/ReallocMem
+	** are redirected to when PIG_MEM_TRACKING is enabled, along with the per-site and per-frame bookkeeping for
+	** registered arenas, the steady state checks, the text dump and the imgui timeline in the memory graph window
+*/
+
+#if PIG_MEM_TRACKING
+
+#define PIG_MEM_TRACKER_IMGUI_MAX_SITES  32
+#define PIG_MEM_TRACKER_RELOAD_SITE_TAG  "(before reload)"
+#define PIG_MEM_TRACKER_OTHER_SITE_TAG   "(other sites)"
+
+// +--------------------------------------------------------------+
+// |                        Initialization                        |
+// +--------------------------------------------------------------+
+void InitPigMemTracker(PigMemTracker_t* tracker)
+{
+	NotNull(tracker);
+	ClearPointer(tracker);
+	plat->CreateMutex(&tracker->remoteFreesMutex);
+	tracker->initialized = true;
+}
+
+PigMemTrackedArena_t* PigMemTrackerFindArena(PigMemTracker_t* tracker, const MemArena_t* arena)
+{
+	for (u64 aIndex = 0; aIndex < tracker->numArenas; aIndex++)
+	{
+		if (tracker->arenas[aIndex].arena == arena) { return &tracker->arenas[aIndex]; }
+	}
+	return nullptr;
+}
+
+//NOTE: All of the tracker's own storage comes straight from the platform layer so it never shows up in (or recurses into) a tracked arena
+bool PigMemTrackArena(PigMemTracker_t* tracker, MemArena_t* arena, const char* name)
+{
+	NotNull3(tracker, arena, name);
+	AssertSingleThreaded();
+	Assert(tracker->initialized);
+	if (PigMemTrackerFindArena(tracker, arena) != nullptr) { return true; }
+	if (tracker->numArenas >= PIG_MEM_TRACKER_MAX_ARENAS)
+	{
+		PrintLine_W("Can't track allocations in %s, already tracking %u arenas", name, PIG_MEM_TRACKER_MAX_ARENAS);
+		return false;
+	}
+	
+	PigMemTrackedArena_t* tracked = &tracker->arenas[tracker->numArenas];
+	ClearPointer(tracked);
+	tracked->arena = arena;
+	u64 nameLength = MyStrLength64(name);
+	if (nameLength >= PIG_MEM_TRACKER_ARENA_NAME_SIZE) { nameLength = PIG_MEM_TRACKER_ARENA_NAME_SIZE-1; }
+	MyMemCopy(&tracked->name[0], name, nameLength);
+	tracked->name[nameLength] = '\0';
+	
+	tracked->sites = (PigMemSite_t*)PlatAllocFunc(sizeof(PigMemSite_t) * PIG_MEM_TRACKER_MAX_SITES);
+	tracked->siteLookup = (u16*)PlatAllocFunc(sizeof(u16) * PIG_MEM_TRACKER_SITE_LOOKUP_SIZE);
+	tracked->liveCapacity = PIG_MEM_TRACKER_MIN_LIVE_CAPACITY;
+	tracked->liveAllocs = (PigMemLiveAlloc_t*)PlatAllocFunc(sizeof(PigMemLiveAlloc_t) * tracked->liveCapacity);
+	NotNull3(tracked->sites, tracked->siteLookup, tracked->liveAllocs);
+	MyMemSet(tracked->sites, 0x00, sizeof(PigMemSite_t) * PIG_MEM_TRACKER_MAX_SITES);
+	MyMemSet(tracked->siteLookup, 0xFF, sizeof(u16) * PIG_MEM_TRACKER_SITE_LOOKUP_SIZE); //PIG_MEM_TRACKER_NO_SITE
+	MyMemSet(tracked->liveAllocs, 0x00, sizeof(PigMemLiveAlloc_t) * tracked->liveCapacity);
+	tracked->current.frameIndex = tracker->frameIndex;
+	tracked->current.topSiteIndex = PIG_MEM_TRACKER_NO_SITE;
+	
+	tracker->numArenas++;
+	return true;
+}
+
+void PigMemUntrackArena(PigMemTracker_t* tracker, MemArena_t* arena)
+{
+	NotNull2(tracker, arena);
+	AssertSingleThreaded();
+	PigMemTrackedArena_t* tracked = PigMemTrackerFindArena(tracker, arena);
+	if (tracked == nullptr) { return; }
+	PlatFreeFunc(tracked->sites);
+	PlatFreeFunc(tracked->siteLookup);
+	PlatFreeFunc(tracked->liveAllocs);
+	u64 aIndex = (u64)(tracked - &tracker->arenas[0]);
+	for (; aIndex+1 < tracker->numArenas; aIndex++)
+	{
+		MyMemCopy(&tracker->arenas[aIndex], &tracker->arenas[aIndex+1], sizeof(PigMemTrackedArena_t));
+	}
+	tracker->numArenas--;
+}
+
+// +--------------------------------------------------------------+
+// |                            Sites                             |
+// +--------------------------------------------------------------+
+u64 PigMemTrackerHashPntr(const void* pntr)
+{
+	u64 result = (u64)(size_t)pntr;
+	result ^= (result >> 33);
+	result *= 0xFF51AFD7ED558CCDULL;
+	result ^= (result >> 33);
+	return result;
+}
+
+u16 PigMemTrackerGetSite(PigMemTracker_t* tracker, PigMemTrackedArena_t* tracked, const char* filePath, u32 lineNumber)
+{
+	const char* tag = (tracker->tagDepth > 0) ? tracker->tagStack[((tracker->tagDepth <= PIG_MEM_TRACKER_MAX_TAG_DEPTH) ? tracker->tagDepth : PIG_MEM_TRACKER_MAX_TAG_DEPTH) - 1] : nullptr;
+	u64 hash = (tag != nullptr) ? PigMemTrackerHashPntr(tag) : (PigMemTrackerHashPntr(filePath) ^ PigMemTrackerHashPntr((const void*)(size_t)(lineNumber+1)));
+	
+	u64 lookupIndex = (hash & (PIG_MEM_TRACKER_SITE_LOOKUP_SIZE-1));
+	while (tracked->siteLookup[lookupIndex] != PIG_MEM_TRACKER_NO_SITE)
+	{
+		PigMemSite_t* site = &tracked->sites[tracked->siteLookup[lookupIndex]];
+		if (site->tag == tag && (tag != nullptr || (site->filePath == filePath && site->lineNumber == lineNumber)))
+		{
+			return tracked->siteLookup[lookupIndex];
+		}
+		lookupIndex = ((lookupIndex + 1) & (PIG_MEM_TRACKER_SITE_LOOKUP_SIZE-1));
+	}
+	
+	//The last site is reserved for everything that doesn't fit
+	if (tracked->numSites >= PIG_MEM_TRACKER_MAX_SITES-1)
+	{
+		PigMemSite_t* otherSite = &tracked->sites[PIG_MEM_TRACKER_MAX_SITES-1];
+		if (otherSite->tag == nullptr) { otherSite->tag = PIG_MEM_TRACKER_OTHER_SITE_TAG; otherSite->filePath = filePath; otherSite->lineNumber = lineNumber; }
+		return (u16)(PIG_MEM_TRACKER_MAX_SITES-1);
+	}
+	
+	u16 siteIndex = (u16)tracked->numSites;
+	PigMemSite_t* newSite = &tracked->sites[siteIndex];
+	ClearPointer(newSite);
+	newSite->tag = tag;
+	newSite->filePath = filePath;
+	newSite->lineNumber = lineNumber;
+	tracked->siteLookup[lookupIndex] = siteIndex;
+	tracked->numSites++;
+	return siteIndex;
+}
+
+//Returns a string in arena like "pig_textbox.cpp:123" or "tag:Fonts" that stays the same between runs (and machines)
+const char* PigMemTrackerGetSiteName(const PigMemSite_t* site, MemArena_t* arena)
+{
+	if (site->tag != nullptr) { return PrintInArena(arena, "tag:%s", site->tag); }
+	if (site->filePath == nullptr) { return "(unknown)"; }
+	MyStr_t fileName = GetFileNamePart(NewStr(site->filePath));
+	return PrintInArena(arena, "%.*s:%u", StrPrint(fileName), site->lineNumber);
+}
+
+// +--------------------------------------------------------------+
+// |                      Live Allocations                        |
+// +--------------------------------------------------------------+
+PigMemLiveAlloc_t* PigMemTrackerFindLive(PigMemTrackedArena_t* tracked, const void* pntr)
+{
+	u64 mask = tracked->liveCapacity-1;
+	u64 index = (PigMemTrackerHashPntr(pntr) & mask);
+	while (tracked->liveAllocs[index].pntr != nullptr)
+	{
+		if (tracked->liveAllocs[index].pntr == pntr) { return &tracked->liveAllocs[index]; }
+		index = ((index + 1) & mask);
+	}
+	return nullptr;
+}
+
+//Rehashes into a table of newCapacity entries, which also throws away all the tombstones
+void PigMemTrackerResizeLive(PigMemTrackedArena_t* tracked, u64 newCapacity)
+{
+	Assert((newCapacity & (newCapacity-1)) == 0 && newCapacity > tracked->liveCount);
+	PigMemLiveAlloc_t* oldAllocs = tracked->liveAllocs;
+	u64 oldCapacity = tracked->liveCapacity;
+	tracked->liveAllocs = (PigMemLiveAlloc_t*)PlatAllocFunc(sizeof(PigMemLiveAlloc_t) * newCapacity);
+	NotNull(tracked->liveAllocs);
+	MyMemSet(tracked->liveAllocs, 0x00, sizeof(PigMemLiveAlloc_t) * newCapacity);
+	tracked->liveCapacity = newCapacity;
+	tracked->liveTombstones = 0;
+	
+	u64 mask = newCapacity-1;
+	for (u64 oldIndex = 0; oldIndex < oldCapacity; oldIndex++)
+	{
+		const PigMemLiveAlloc_t* oldAlloc = &oldAllocs[oldIndex];
+		if (oldAlloc->pntr == nullptr || oldAlloc->pntr == PIG_MEM_TRACKER_TOMBSTONE) { continue; }
+		u64 index = (PigMemTrackerHashPntr(oldAlloc->pntr) & mask);
+		while (tracked->liveAllocs[index].pntr != nullptr) { index = ((index + 1) & mask); }
+		tracked->liveAllocs[index] = *oldAlloc;
+	}
+	PlatFreeFunc(oldAllocs);
+}
+
+void PigMemTrackerRemoveSiteLive(PigMemTrackedArena_t* tracked, const PigMemLiveAlloc_t* liveAlloc)
+{
+	PigMemSite_t* site = &tracked->sites[liveAlloc->siteIndex];
+	site->numFrees++;
+	if (site->numLiveAllocs > 0) { site->numLiveAllocs--; }
+	site->liveBytes = (site->liveBytes >= liveAlloc->size) ? (site->liveBytes - liveAlloc->size) : 0;
+}
+
+void PigMemTrackerAddLive(PigMemTrackedArena_t* tracked, const void* pntr, u64 size, u16 siteIndex)
+{
+	if ((tracked->liveCount + tracked->liveTombstones + 1) * 4 > tracked->liveCapacity * 3)
+	{
+		u64 newCapacity = tracked->liveCapacity;
+		if ((tracked->liveCount + 1) * 2 > tracked->liveCapacity) { newCapacity *= 2; }
+		PigMemTrackerResizeLive(tracked, newCapacity);
+	}
+	
+	u64 mask = tracked->liveCapacity-1;
+	u64 index = (PigMemTrackerHashPntr(pntr) & mask);
+	PigMemLiveAlloc_t* firstTombstone = nullptr;
+	while (tracked->liveAllocs[index].pntr != nullptr)
+	{
+		PigMemLiveAlloc_t* existing = &tracked->liveAllocs[index];
+		if (existing->pntr == pntr)
+		{
+			//The old allocation was freed somewhere we don't see (like inside gylib) and the arena handed the same address back out
+			PigMemTrackerRemoveSiteLive(tracked, existing);
+			existing->size = size;
+			existing->siteIndex = siteIndex;
+			return;
+		}
+		if (existing->pntr == PIG_MEM_TRACKER_TOMBSTONE && firstTombstone == nullptr) { firstTombstone = existing; }
+		index = ((index + 1) & mask);
+	}
+	
+	PigMemLiveAlloc_t* newAlloc = &tracked->liveAllocs[index];
+	if (firstTombstone != nullptr) { newAlloc = firstTombstone; tracked->liveTombstones--; }
+	newAlloc->pntr = pntr;
+	newAlloc->size = size;
+	newAlloc->siteIndex = siteIndex;
+	tracked->liveCount++;
+}
+
+// +--------------------------------------------------------------+
+// |                          Recording                           |
+// +--------------------------------------------------------------+
+void PigMemTrackerRecordAlloc(PigMemTracker_t* tracker, PigMemTrackedArena_t* tracked, const void* pntr, u64 size, const char* filePath, u32 lineNumber)
+{
+	u16 siteIndex = PigMemTrackerGetSite(tracker, tracked, filePath, lineNumber);
+	PigMemSite_t* site = &tracked->sites[siteIndex];
+	site->numAllocs++;
+	site->numLiveAllocs++;
+	site->liveBytes += size;
+	if (site->liveBytes > site->peakLiveBytes) { site->peakLiveBytes = site->liveBytes; }
+	site->frameAllocs++;
+	site->frameBytes += size;
+	tracked->current.numAllocs++;
+	tracked->current.allocatedBytes += size;
+	PigMemTrackerAddLive(tracked, pntr, size, siteIndex);
+	
+	if (tracked->expectNoAllocFrames > 0 && tracker->frameIndex >= tracked->expectStartFrame && !tracker->reporting)
+	{
+		tracked->numUnexpectedAllocs++;
+		tracker->reporting = true;
+		PrintLine_E("Unexpected %llu byte allocation in %s from %s (frame %llu)", size, &tracked->name[0], PigMemTrackerGetSiteName(site, TempArena), tracker->frameIndex);
+		tracker->reporting = false;
+	}
+}
+
+void PigMemTrackerRecordFree(PigMemTrackedArena_t* tracked, const void* pntr)
+{
+	PigMemLiveAlloc_t* liveAlloc = PigMemTrackerFindLive(tracked, pntr);
+	if (liveAlloc == nullptr) { tracked->numUntrackedFrees++; return; }
+	PigMemTrackerRemoveSiteLive(tracked, liveAlloc);
+	tracked->current.numFrees++;
+	tracked->current.freedBytes += liveAlloc->size;
+	liveAlloc->pntr = PIG_MEM_TRACKER_TOMBSTONE;
+	tracked->liveCount--;
+	tracked->liveTombstones++;
+}
+
+//NOTE: Like Pig_ThisThreadTempArena these live in the engine dll so every thread binds itself again after a reload.
+//      This keeps plat->GetThisThreadId off the path of every tracked allocation
+thread_local PigState_t* Pig_ThisThreadMemTrackerPig = nullptr;
+thread_local bool Pig_ThisThreadIsMemTrackerMain = false;
+
+bool PigMemTrackerIsMainThread()
+{
+	if (Pig_ThisThreadMemTrackerPig != nullptr && Pig_ThisThreadMemTrackerPig == pig) { return Pig_ThisThreadIsMemTrackerMain; }
+	if (pig == nullptr || plat == nullptr || !pig->memTracker.initialized) { return false; } //mainThreadId is filled before the tracker is initialized
+	Pig_ThisThreadIsMemTrackerMain = (plat->GetThisThreadId() == pig->mainThreadId);
+	Pig_ThisThreadMemTrackerPig = pig;
+	return Pig_ThisThreadIsMemTrackerMain;
+}
+
+//Main thread only
+void PigMemTrackerRecordRemoteFrees(PigMemTracker_t* tracker)
+{
+	if (tracker->numPendingRemoteFrees == 0) { return; }
+	plat->LockMutex(&tracker->remoteFreesMutex, MUTEX_LOCK_INFINITE);
+	for (u64 fIndex = 0; fIndex < tracker->numPendingRemoteFrees; fIndex++)
+	{
+		const PigMemRemoteFree_t* remoteFree = &tracker->pendingRemoteFrees[fIndex];
+		PigMemTrackedArena_t* tracked = PigMemTrackerFindArena(tracker, remoteFree->arena);
+		if (tracked != nullptr) { PigMemTrackerRecordFree(tracked, remoteFree->pntr); } //the arena may have been untracked since
+	}
+	tracker->numRemoteFrees += tracker->numPendingRemoteFrees;
+	tracker->numPendingRemoteFrees = 0;
+	plat->UnlockMutex(&tracker->remoteFreesMutex);
+}
+
+//Returns nullptr (and the caller skips all bookkeeping) unless the arena is registered and we are on the main thread.
+//The arena lookup comes first so calls on untracked arenas never ask which thread they are on
+PigMemTrackedArena_t* PigMemTrackerGetArenaForCall(const MemArena_t* arena, bool* isOtherThreadOut = nullptr)
+{
+	if (isOtherThreadOut != nullptr) { *isOtherThreadOut = false; }
+	if (pig == nullptr || pig->memTracker.numArenas == 0) { return nullptr; }
+	PigMemTrackedArena_t* tracked = PigMemTrackerFindArena(&pig->memTracker, arena);
+	if (tracked == nullptr) { return nullptr; }
+	if (!PigMemTrackerIsMainThread())
+	{
+		if (isOtherThreadOut != nullptr) { *isOtherThreadOut = true; }
+		return nullptr;
+	}
+	//Recorded before anything else so a queued free can't be applied to an allocation the arena handed back out since
+	PigMemTrackerRecordRemoteFrees(&pig->memTracker);
+	return tracked;
+}
+
+//Called (instead of recording the free) when a tracked arena frees something on another thread
+void PigMemTrackerQueueRemoteFree(PigMemTracker_t* tracker, const MemArena_t* arena, const void* pntr)
+{
+	plat->LockMutex(&tracker->remoteFreesMutex, MUTEX_LOCK_INFINITE);
+	if (tracker->numPendingRemoteFrees < PIG_MEM_TRACKER_MAX_REMOTE_FREES)
+	{
+		PigMemRemoteFree_t* remoteFree = &tracker->pendingRemoteFrees[tracker->numPendingRemoteFrees];
+		remoteFree->arena = arena;
+		remoteFree->pntr = pntr;
+		tracker->numPendingRemoteFrees = tracker->numPendingRemoteFrees + 1;
+	}
+	else { tracker->numDroppedRemoteFrees++; }
+	plat->UnlockMutex(&tracker->remoteFreesMutex);
+}
+
+// +--------------------------------------------------------------+
+// |                           Wrappers                           |
+// +--------------------------------------------------------------+
+#if !defined(GYLIB_MEM_ARENA_DEBUG_ENABLED)
+//NOTE: The parenthesis around (AllocMem) etc. keep the function-like macros in pig_func_defs.h from expanding so we call the real gylib functions
+void* PigTrackedAllocMem(const char* filePath, u32 lineNumber, MemArena_t* arena, u64 numBytes, AllocAlignment_t alignOverride)
+{
+	void* result = (AllocMem)(arena, numBytes, alignOverride);
+	if (result == nullptr) { return result; }
+	PigMemTrackedArena_t* tracked = PigMemTrackerGetArenaForCall(arena);
+	if (tracked != nullptr) { PigMemTrackerRecordAlloc(&pig->memTracker, tracked, result, numBytes, filePath, lineNumber); }
+	return result;
+}
+
+bool PigTrackedFreeMem(MemArena_t* arena, void* allocPntr, u64 allocSize, bool ignoreNullptr, u64* oldSizeOut)
+{
+	if (allocPntr != nullptr)
+	{
+		bool isOtherThread = false;
+		PigMemTrackedArena_t* tracked = PigMemTrackerGetArenaForCall(arena, &isOtherThread);
+		if (tracked != nullptr) { PigMemTrackerRecordFree(tracked, allocPntr); }
+		else if (isOtherThread) { PigMemTrackerQueueRemoteFree(&pig->memTracker, arena, allocPntr); }
+	}
+	return (FreeMem)(arena, allocPntr, allocSize, ignoreNullptr, oldSizeOut);
+}
+
+void* PigTrackedReallocMem(const char* filePath, u32 lineNumber, MemArena_t* arena, void* allocPntr, u64 newSize, u64 oldSize, AllocAlignment_t alignOverride, bool ignoreNullptr, u64* oldSizeOut)
+{
+	bool isOtherThread = false;
+	PigMemTrackedArena_t* tracked = PigMemTrackerGetArenaForCall(arena, &isOtherThread);
+	if (tracked != nullptr && allocPntr != nullptr) { PigMemTrackerRecordFree(tracked, allocPntr); }
+	else if (isOtherThread && allocPntr != nullptr) { PigMemTrackerQueueRemoteFree(&pig->memTracker, arena, allocPntr); }
+	void* result = (ReallocMem)(arena, allocPntr, newSize, oldSize, alignOverride, ignoreNullptr, oldSizeOut);
+	if (tracked != nullptr && result != nullptr) { PigMemTrackerRecordAlloc(&pig->memTracker, tracked, result, newSize, filePath, lineNumber); }
+	return result;
+}
+#endif //!defined(GYLIB_MEM_ARENA_DEBUG_ENABLED)
+
+// +--------------------------------------------------------------+
+// |                             Tags                             |
+// +--------------------------------------------------------------+
+void PigMemTagPush_(const char* tag)
+{
+	NotNull(tag);
+	if (!PigMemTrackerIsMainThread()) { return; }
+	PigMemTracker_t* tracker = &pig->memTracker;
+	if (tracker->tagDepth < PIG_MEM_TRACKER_MAX_TAG_DEPTH) { tracker->tagStack[tracker->tagDepth] = tag; }
+	tracker->tagDepth++;
+}
+void PigMemTagPop_()
+{
+	if (!PigMemTrackerIsMainThread()) { return; }
+	PigMemTracker_t* tracker = &pig->memTracker;
+	Assert(tracker->tagDepth > 0);
+	if (tracker->tagDepth > 0) { tracker->tagDepth--; }
+}
+
+// +--------------------------------------------------------------+
+// |                     Frames and Reloading                     |
+// +--------------------------------------------------------------+
+//Every allocation made in arena during the next numFrames frames is printed as an error and counted in numUnexpectedAllocs
+void PigMemTrackerExpectNoAllocs(PigMemTracker_t* tracker, MemArena_t* arena, u64 numFrames)
+{
+	NotNull2(tracker, arena);
+	PigMemTrackedArena_t* tracked = PigMemTrackerFindArena(tracker, arena);
+	if (tracked == nullptr) { PrintLine_W("Can't expect no allocations in an arena that isn't tracked"); return; }
+	tracked->expectStartFrame = tracker->frameIndex + 1;
+	tracked->expectNoAllocFrames = numFrames;
+	tracked->numUnexpectedAllocs = 0;
+}
+
+//NOTE: Called at the very top of PigUpdate, so everything from the previous PigUpdate and PigRender lands in one record
+void UpdatePigMemTrackerBefore(PigMemTracker_t* tracker)
+{
+	NotNull(tracker);
+	if (!tracker->initialized) { return; }
+	PigMemTrackerRecordRemoteFrees(tracker);
+	
+	for (u64 aIndex = 0; aIndex < tracker->numArenas; aIndex++)
+	{
+		PigMemTrackedArena_t* tracked = &tracker->arenas[aIndex];
+		PigMemFrameRecord_t* record = &tracked->current;
+		record->frameIndex = tracker->frameIndex;
+		record->arenaUsed = tracked->arena->used;
+		record->arenaNumAllocations = tracked->arena->numAllocations;
+		record->topSiteIndex = PIG_MEM_TRACKER_NO_SITE;
+		u64 topSiteBytes = 0;
+		for (u64 sIndex = 0; sIndex < PIG_MEM_TRACKER_MAX_SITES; sIndex++)
+		{
+			if (sIndex >= tracked->numSites && sIndex != PIG_MEM_TRACKER_MAX_SITES-1) { continue; }
+			PigMemSite_t* site = &tracked->sites[sIndex];
+			if (site->frameBytes > topSiteBytes || (record->topSiteIndex == PIG_MEM_TRACKER_NO_SITE && site->frameAllocs > 0))
+			{
+				topSiteBytes = site->frameBytes;
+				record->topSiteIndex = (u16)sIndex;
+			}
+			site->frameAllocs = 0;
+			site->frameBytes = 0;
+		}
+		tracked->history[tracked->historyCount % PIG_MEM_TRACKER_HISTORY_LENGTH] = *record;
+		tracked->historyCount++;
+		ClearPointer(record);
+		record->frameIndex = tracker->frameIndex + 1;
+		record->topSiteIndex = PIG_MEM_TRACKER_NO_SITE;
+		
+		if (tracked->expectNoAllocFrames > 0 && tracker->frameIndex >= tracked->expectStartFrame)
+		{
+			tracked->expectNoAllocFrames--;
+			if (tracked->expectNoAllocFrames == 0)
+			{
+				if (tracked->numUnexpectedAllocs == 0) { PrintLine_I("No allocations were made in %s during the expected steady state frames", &tracked->name[0]); }
+				else { PrintLine_E("%llu unexpected allocation%s were made in %s during the expected steady state frames", tracked->numUnexpectedAllocs, Plural(tracked->numUnexpectedAllocs, "s"), &tracked->name[0]); }
+			}
+		}
+	}
+	
+	tracker->frameIndex++;
+}
+
+//NOTE: Tags and file paths point into the old dll, so every site is folded into one site (named by a string in the new dll)
+//      Live allocations are kept so frees of allocations made before the reload are still balanced
+void PigMemTrackerHandleReload(PigMemTracker_t* tracker)
+{
+	NotNull(tracker);
+	if (!tracker->initialized) { return; }
+	if (tracker->tagDepth > 0) { PrintLine_W("%llu mem tag%s still pushed during reload", tracker->tagDepth, Plural(tracker->tagDepth, "s")); }
+	tracker->tagDepth = 0;
+	
+	for (u64 aIndex = 0; aIndex < tracker->numArenas; aIndex++)
+	{
+		PigMemTrackedArena_t* tracked = &tracker->arenas[aIndex];
+		PigMemSite_t reloadSite = {};
+		reloadSite.tag = PIG_MEM_TRACKER_RELOAD_SITE_TAG;
+		for (u64 sIndex = 0; sIndex < PIG_MEM_TRACKER_MAX_SITES; sIndex++)
+		{
+			if (sIndex >= tracked->numSites && sIndex != PIG_MEM_TRACKER_MAX_SITES-1) { continue; }
+			const PigMemSite_t* site = &tracked->sites[sIndex];
+			reloadSite.numAllocs += site->numAllocs;
+			reloadSite.numFrees += site->numFrees;
+			reloadSite.numLiveAllocs += site->numLiveAllocs;
+			reloadSite.liveBytes += site->liveBytes;
+		}
+		reloadSite.peakLiveBytes = reloadSite.liveBytes;
+		
+		MyMemSet(tracked->sites, 0x00, sizeof(PigMemSite_t) * PIG_MEM_TRACKER_MAX_SITES);
+		MyMemSet(tracked->siteLookup, 0xFF, sizeof(u16) * PIG_MEM_TRACKER_SITE_LOOKUP_SIZE);
+		tracked->sites[0] = reloadSite;
+		tracked->siteLookup[PigMemTrackerHashPntr(reloadSite.tag) & (PIG_MEM_TRACKER_SITE_LOOKUP_SIZE-1)] = 0;
+		tracked->numSites = 1;
+		
+		for (u64 lIndex = 0; lIndex < tracked->liveCapacity; lIndex++)
+		{
+			tracked->liveAllocs[lIndex].siteIndex = 0;
+		}
+		tracked->current.topSiteIndex = PIG_MEM_TRACKER_NO_SITE;
+		for (u64 hIndex = 0; hIndex < PIG_MEM_TRACKER_HISTORY_LENGTH; hIndex++)
+		{
+			tracked->history[hIndex].topSiteIndex = PIG_MEM_TRACKER_NO_SITE;
+		}
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                             Dump                             |
+// +--------------------------------------------------------------+
+i32 PigMemTrackerCompareNames(const char* left, const char* right)
+{
+	while (*left != '\0' && *left == *right) { left++; right++; }
+	return (i32)(u8)(*left) - (i32)(u8)(*right);
+}
+
+//Writes every tracked arena's sites (sorted by name) and frame history (oldest first) as plain text, one record per line, so two dumps can be diffed directly
+bool PigMemTrackerDump(PigMemTracker_t* tracker, MyStr_t filePath)
+{
+	NotNull(tracker);
+	AssertSingleThreaded();
+	MemArena_t dumpArena;
+	InitMemArena_PagedHeapFuncs(&dumpArena, Megabytes(1), PlatAllocFunc, PlatFreeFunc);
+	StringBuilder_t builder;
+	NewStringBuilder(&builder, &dumpArena, Kilobytes(64));
+	PigMemTrackerRecordRemoteFrees(tracker);
+	StringBuilderAppendPrint(&builder, "frame %llu\n", tracker->frameIndex);
+	StringBuilderAppendPrint(&builder, "remote_frees %llu dropped_remote_frees %llu\n", tracker->numRemoteFrees, tracker->numDroppedRemoteFrees);
+	
+	for (u64 aIndex = 0; aIndex < tracker->numArenas; aIndex++)
+	{
+		const PigMemTrackedArena_t* tracked = &tracker->arenas[aIndex];
+		StringBuilderAppendPrint(&builder, "\narena %s\n", &tracked->name[0]);
+		StringBuilderAppendPrint(&builder, "\tused %llu allocations %llu live_allocs %llu untracked_frees %llu unexpected_allocs %llu\n", tracked->arena->used, tracked->arena->numAllocations, tracked->liveCount, tracked->numUntrackedFrees, tracked->numUnexpectedAllocs);
+		
+		const char** siteNames = AllocArray(&dumpArena, const char*, PIG_MEM_TRACKER_MAX_SITES);
+		u16* sortedSites = AllocArray(&dumpArena, u16, PIG_MEM_TRACKER_MAX_SITES);
+		u64 numSorted = 0;
+		for (u64 sIndex = 0; sIndex < PIG_MEM_TRACKER_MAX_SITES; sIndex++)
+		{
+			if (sIndex >= tracked->numSites && (sIndex != PIG_MEM_TRACKER_MAX_SITES-1 || tracked->sites[sIndex].tag == nullptr)) { continue; }
+			siteNames[sIndex] = PigMemTrackerGetSiteName(&tracked->sites[sIndex], &dumpArena);
+			u64 insertIndex = numSorted;
+			while (insertIndex > 0 && PigMemTrackerCompareNames(siteNames[sortedSites[insertIndex-1]], siteNames[sIndex]) > 0)
+			{
+				sortedSites[insertIndex] = sortedSites[insertIndex-1];
+				insertIndex--;
+			}
+			sortedSites[insertIndex] = (u16)sIndex;
+			numSorted++;
+		}
+		for (u64 sortIndex = 0; sortIndex < numSorted; sortIndex++)
+		{
+			const PigMemSite_t* site = &tracked->sites[sortedSites[sortIndex]];
+			StringBuilderAppendPrint(&builder, "\tsite %s allocs %llu frees %llu live_allocs %llu live_bytes %llu peak_bytes %llu\n", siteNames[sortedSites[sortIndex]], site->numAllocs, site->numFrees, site->numLiveAllocs, site->liveBytes, site->peakLiveBytes);
+		}
+		
+		u64 numRecords = (tracked->historyCount < PIG_MEM_TRACKER_HISTORY_LENGTH) ? tracked->historyCount : PIG_MEM_TRACKER_HISTORY_LENGTH;
+		for (u64 rIndex = tracked->historyCount - numRecords; rIndex < tracked->historyCount; rIndex++)
+		{
+			const PigMemFrameRecord_t* record = &tracked->history[rIndex % PIG_MEM_TRACKER_HISTORY_LENGTH];
+			const char* topSiteName = (record->topSiteIndex != PIG_MEM_TRACKER_NO_SITE) ? siteNames[record->topSiteIndex] : "-";
+			StringBuilderAppendPrint(&builder, "\tframe %llu allocs %u frees %u allocated %llu freed %llu arena_used %llu arena_allocations %llu top %s\n", record->frameIndex, record->numAllocs, record->numFrees, record->allocatedBytes, record->freedBytes, record->arenaUsed, record->arenaNumAllocations, topSiteName);
+		}
+	}
+	
+	MyStr_t dumpStr = ToMyStr(&builder);
+	bool result = plat->WriteEntireFile(filePath, dumpStr.chars, dumpStr.length);
+	if (result) { PrintLine_I("Wrote allocation tracking for %llu arena%s (%s) to \"%.*s\"", tracker->numArenas, Plural(tracker->numArenas, "s"), FormatBytesNt(dumpStr.length, TempArena), StrPrint(filePath)); }
+	else { PrintLine_E("Failed to write allocation tracking to \"%.*s\"", StrPrint(filePath)); }
+	FreeMemArena(&dumpArena);
+	return result;
+}
+
+// +--------------------------------------------------------------+
+// |                            Imgui                             |
+// +--------------------------------------------------------------+
+//Called by RenderPigMemGraph_Imgui for every arena in the graph, does nothing for arenas we aren't tracking
+void RenderPigMemTracker_Imgui(PigMemTracker_t* tracker, const MemArena_t* arena, r32 graphHeight)
+{
+	NotNull2(tracker, arena);
+	PigMemTrackedArena_t* tracked = PigMemTrackerFindArena(tracker, arena);
+	if (tracked == nullptr) { return; }
+	MemArena_t* scratch = GetScratchArena();
+	
+	u64 numRecords = (tracked->historyCount < PIG_MEM_TRACKER_HISTORY_LENGTH) ? tracked->historyCount : PIG_MEM_TRACKER_HISTORY_LENGTH;
+	r32* allocCounts = AllocArray(scratch, r32, PIG_MEM_TRACKER_HISTORY_LENGTH);
+	r32* allocBytes = AllocArray(scratch, r32, PIG_MEM_TRACKER_HISTORY_LENGTH);
+	r32 maxCount = 0;
+	r32 maxBytes = 0;
+	for (u64 rIndex = 0; rIndex < PIG_MEM_TRACKER_HISTORY_LENGTH; rIndex++)
+	{
+		allocCounts[rIndex] = 0;
+		allocBytes[rIndex] = 0;
+		if (rIndex < PIG_MEM_TRACKER_HISTORY_LENGTH - numRecords) { continue; }
+		const PigMemFrameRecord_t* record = &tracked->history[(tracked->historyCount + rIndex) % PIG_MEM_TRACKER_HISTORY_LENGTH];
+		allocCounts[rIndex] = (r32)record->numAllocs;
+		allocBytes[rIndex] = (r32)record->allocatedBytes;
+		if (allocCounts[rIndex] > maxCount) { maxCount = allocCounts[rIndex]; }
+		if (allocBytes[rIndex] > maxBytes) { maxBytes = allocBytes[rIndex]; }
+	}
+	
+	ImGui::Text("Tracked: %llu site%s, %llu live, %llu untracked free%s", tracked->numSites, Plural(tracked->numSites, "s"), tracked->liveCount, tracked->numUntrackedFrees, Plural(tracked->numUntrackedFrees, "s"));
+	ImVec2 plotSize = ImVec2(ImGui::GetContentRegionAvail().x, graphHeight);
+	ImGui::PlotHistogram("###AllocsPerFrame", allocCounts, (int)PIG_MEM_TRACKER_HISTORY_LENGTH, 0, PrintInArena(scratch, "allocs/frame (max %.0f)", maxCount), 0.0f, (maxCount > 0) ? maxCount : 1.0f, plotSize);
+	ImGui::PlotHistogram("###BytesPerFrame", allocBytes, (int)PIG_MEM_TRACKER_HISTORY_LENGTH, 0, PrintInArena(scratch, "bytes/frame (max %s)", FormatBytesNt((u64)maxBytes, scratch)), 0.0f, (maxBytes > 0) ? maxBytes : 1.0f, plotSize);
+	
+	if (ImGui::TreeNode("TrackedSitesNode", "Top Sites (%llu)", tracked->numSites))
+	{
+		u16* sortedSites = AllocArray(scratch, u16, PIG_MEM_TRACKER_IMGUI_MAX_SITES);
+		u64 numSorted = 0;
+		for (u64 sIndex = 0; sIndex < PIG_MEM_TRACKER_MAX_SITES; sIndex++)
+		{
+			if (sIndex >= tracked->numSites && (sIndex != PIG_MEM_TRACKER_MAX_SITES-1 || tracked->sites[sIndex].tag == nullptr)) { continue; }
+			u64 peakBytes = tracked->sites[sIndex].peakLiveBytes;
+			u64 insertIndex = numSorted;
+			while (insertIndex > 0 && tracked->sites[sortedSites[insertIndex-1]].peakLiveBytes < peakBytes)
+			{
+				if (insertIndex < PIG_MEM_TRACKER_IMGUI_MAX_SITES) { sortedSites[insertIndex] = sortedSites[insertIndex-1]; }
+				insertIndex--;
+			}
+			if (insertIndex < PIG_MEM_TRACKER_IMGUI_MAX_SITES) { sortedSites[insertIndex] = (u16)sIndex; }
+			if (numSorted < PIG_MEM_TRACKER_IMGUI_MAX_SITES) { numSorted++; }
+		}
+		
+		u32 valueColor = IM_COL32(170, 170, 170, 255);
+		for (u64 sortIndex = 0; sortIndex < numSorted; sortIndex++)
+		{
+			const PigMemSite_t* site = &tracked->sites[sortedSites[sortIndex]];
+			ImGui::Text("%s", PigMemTrackerGetSiteName(site, scratch));
+			ImGui::SameLine();
+			ImGui::PushStyleColor(ImGuiCol_Text, valueColor);
+			ImGui::Text("live %s (%llu), peak %s, %llu alloc%s", FormatBytesNt(site->liveBytes, scratch), site->numLiveAllocs, FormatBytesNt(site->peakLiveBytes, scratch), site->numAllocs, Plural(site->numAllocs, "s"));
+			ImGui::PopStyleColor();
+		}
+		ImGui::TreePop();
+	}
+	
+	FreeScratchArena(scratch);
+}
+
+#endif //PIG_MEM_TRACKING
@@ -0,0 +1,116 @@
+/*
+File:   pig_mem_tracker.h
+Date:   10\19\2026
+Description:
+	** When PIG_MEM_TRACKING is enabled every AllocMem/FreeMem/ReallocMem call in engine and game code is routed
+	** through PigTrackedAllocMem/etc. (see pig_func_defs.h) which hand the file and line (or the innermost
+	** PigMemTagPush tag) to the tracker. Arenas that have been registered with PigMemTrackArena get per-site
+	** counts, live bytes and high-water marks, plus a ring of per-frame records that the memory graph shows as a
+	** timeline and mem_track_dump writes out. Allocations gylib makes internally (VarArray growth, string
+	** helpers, etc.) never pass through the macros, those only show up in the sampled arena used/allocation counts
+	** NOTE: Allocations are only recorded on the main thread. Frees of tracked arenas from other threads are queued
+	** (see PigMemRemoteFree_t) and recorded by the main thread on its next tracked call or at the start of the next frame.
+	** Allocations made on other threads are not seen, so their frees end up in numUntrackedFrees
+*/
+
+#ifndef _PIG_MEM_TRACKER_H
+#define _PIG_MEM_TRACKER_H
+
+#define PIG_MEM_TRACKER_MAX_ARENAS         4
+#define PIG_MEM_TRACKER_MAX_SITES          1024 //per arena, allocations from further sites are counted against the last one
+#define PIG_MEM_TRACKER_SITE_LOOKUP_SIZE   2048 //must be a power of 2 and larger than PIG_MEM_TRACKER_MAX_SITES
+#define PIG_MEM_TRACKER_HISTORY_LENGTH     256 //frames, must be a power of 2
+#define PIG_MEM_TRACKER_MAX_TAG_DEPTH      16
+#define PIG_MEM_TRACKER_ARENA_NAME_SIZE    32 //chars
+#define PIG_MEM_TRACKER_MIN_LIVE_CAPACITY  1024 //entries
+#define PIG_MEM_TRACKER_NO_SITE            0xFFFF
+#define PIG_MEM_TRACKER_TOMBSTONE          ((const void*)1)
+#define PIG_MEM_TRACKER_MAX_REMOTE_FREES   256 //frees from other threads waiting for the main thread, more than this and they are dropped (and counted)
+
+//An allocation call site. Allocations made while a tag is pushed all go to the tag's site, otherwise the file and line of the call is the key
+struct PigMemSite_t
+{
+	const char* tag;
+	const char* filePath; //for tag sites this is wherever the first allocation inside the tag came from
+	u32 lineNumber;
+	
+	u64 numAllocs;
+	u64 numFrees;
+	u64 numLiveAllocs;
+	u64 liveBytes;
+	u64 peakLiveBytes;
+	
+	u64 frameAllocs;
+	u64 frameBytes;
+};
+
+//Kept small since there are PIG_MEM_TRACKER_HISTORY_LENGTH of these for every tracked arena
+struct PigMemFrameRecord_t
+{
+	u64 frameIndex;
+	u32 numAllocs;
+	u32 numFrees;
+	u64 allocatedBytes;
+	u64 freedBytes;
+	u64 arenaUsed; //sampled from the arena at the end of the frame, includes allocations we didn't see
+	u64 arenaNumAllocations;
+	u16 topSiteIndex; //the site that allocated the most bytes in the frame (PIG_MEM_TRACKER_NO_SITE if nothing was allocated)
+};
+
+struct PigMemLiveAlloc_t
+{
+	const void* pntr; //nullptr for an empty slot, PIG_MEM_TRACKER_TOMBSTONE for a removed one
+	u64 size;
+	u16 siteIndex;
+};
+
+struct PigMemTrackedArena_t
+{
+	MemArena_t* arena;
+	char name[PIG_MEM_TRACKER_ARENA_NAME_SIZE]; //copied since the caller's string may live in the dll
+	
+	u64 numSites;
+	PigMemSite_t* sites; //PIG_MEM_TRACKER_MAX_SITES
+	u16* siteLookup; //PIG_MEM_TRACKER_SITE_LOOKUP_SIZE, open addressing on (tag, filePath, lineNumber)
+	
+	u64 liveCapacity; //power of 2
+	u64 liveCount;
+	u64 liveTombstones;
+	PigMemLiveAlloc_t* liveAllocs; //open addressing on pntr
+	u64 numUntrackedFrees; //frees of allocations we never saw (made before tracking started, or by gylib internally)
+	
+	PigMemFrameRecord_t current;
+	u64 historyCount;
+	PigMemFrameRecord_t history[PIG_MEM_TRACKER_HISTORY_LENGTH];
+	
+	u64 expectStartFrame;
+	u64 expectNoAllocFrames; //frames left where any allocation is reported as an error (see PigMemTrackerExpectNoAllocs)
+	u64 numUnexpectedAllocs;
+};
+
+struct PigMemRemoteFree_t
+{
+	const MemArena_t* arena;
+	const void* pntr;
+};
+
+struct PigMemTracker_t
+{
+	bool initialized;
+	u64 frameIndex;
+	u64 numArenas;
+	PigMemTrackedArena_t arenas[PIG_MEM_TRACKER_MAX_ARENAS];
+	
+	u64 tagDepth;
+	const char* tagStack[PIG_MEM_TRACKER_MAX_TAG_DEPTH];
+	
+	bool reporting; //set while we print an unexpected allocation, so allocations made by the print itself aren't reported again
+	
+	PlatMutex_t remoteFreesMutex; //protects everything below
+	volatile u64 numPendingRemoteFrees; //read without the mutex on the main thread, only to skip locking when it's 0
+	PigMemRemoteFree_t pendingRemoteFrees[PIG_MEM_TRACKER_MAX_REMOTE_FREES];
+	u64 numRemoteFrees;
+	u64 numDroppedRemoteFrees;
+};
+
+#endif //  _PIG_MEM_TRACKER_H
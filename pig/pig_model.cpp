@@ -172,6 +172,19 @@ Model_t CreateModelFromObjModelData(ObjModelData_t* objData, MemArena_t* memAren
 							}
 						}
 						Assert(numVertsFilled == numVertices);
+						newPart->boundsMin = vertices[0].position;
+						newPart->boundsMax = vertices[0].position;
+						for (u64 vIndex = 1; vIndex < numVertices; vIndex++)
+						{
+							newPart->boundsMin = Vec3Min(newPart->boundsMin, vertices[vIndex].position);
+							newPart->boundsMax = Vec3Max(newPart->boundsMax, vertices[vIndex].position);
+						}
+						if (!result.hasBounds) { result.boundsMin = newPart->boundsMin; result.boundsMax = newPart->boundsMax; result.hasBounds = true; }
+						else
+						{
+							result.boundsMin = Vec3Min(result.boundsMin, newPart->boundsMin);
+							result.boundsMax = Vec3Max(result.boundsMax, newPart->boundsMax);
+						}
 						bool createBufferSuccess = CreateVertBuffer3D(memArena, &newPart->buffer, false, numVertices, vertices, copyVertices);
 						Assert(createBufferSuccess);
 						TempPopMark();
@@ -195,10 +208,11 @@ bool TryLoadModel(ProcessLog_t* log, MyStr_t filePath, ModelTextureType_t textur
 	
 	if (StrEndsWith(filePath, ".obj", true))
 	{
-		PlatFileContents_t objFile = {};
-		if (plat->ReadFileContents(filePath, nullptr, true, &objFile))
+		//NOTE: We map the file rather than reading it with convertNewLines, the LineParser handles \r\n line endings on its own
+		PlatMappedFile_t objFile = {};
+		if (plat->MapFile(filePath, &objFile))
 		{
-			MyStr_t objFileContentsStr = NewStr(objFile.length, objFile.chars);
+			MyStr_t objFileContentsStr = NewStr(objFile.length, (char*)objFile.chars);
 			MyStr_t folderPath = GetDirectoryPart(filePath);
 			ObjModelData_t objData = {};
 			if (TryDeserObjFile(objFileContentsStr, folderPath, log, &objData, scratch))
@@ -206,6 +220,7 @@ bool TryLoadModel(ProcessLog_t* log, MyStr_t filePath, ModelTextureType_t textur
 				*modelOut = CreateModelFromObjModelData(&objData, memArena, textureType, copyVertices, flipUvY);
 				result = true;
 			}
+			plat->UnmapFile(&objFile);
 		}
 		else
 		{
@@ -14,17 +14,107 @@ struct CollectionNamedColor_t
 	Color_t value;
 };
 
+// +--------------------------------------------------------------+
+// |                          Name Index                          |
+// +--------------------------------------------------------------+
+//Case-insensitive FNV-1a since every name in a collection is compared with StrEqualsIgnoreCase. Never returns 0
+u64 HashPartsName(MyStr_t name)
+{
+	u64 result = 0xCBF29CE484222325ULL;
+	for (u64 cIndex = 0; cIndex < name.length; cIndex++)
+	{
+		char c = name.pntr[cIndex];
+		if (c >= 'A' && c <= 'Z') { c = (char)(c - 'A' + 'a'); }
+		result ^= (u64)(u8)c;
+		result *= 0x00000100000001B3ULL;
+	}
+	return (result != 0) ? result : 1;
+}
+
+void FreePartsNameIndex(PartsNameIndex_t* index)
+{
+	NotNull(index);
+	if (index->hashes != nullptr)
+	{
+		NotNull(index->allocArena);
+		FreeMem(index->allocArena, index->hashes, sizeof(u64) * index->capacity);
+		FreeMem(index->allocArena, index->values, sizeof(u64) * index->capacity);
+	}
+	ClearPointer(index);
+}
+void InitPartsNameIndex(PartsNameIndex_t* index, MemArena_t* memArena)
+{
+	NotNull2(index, memArena);
+	ClearPointer(index);
+	index->allocArena = memArena;
+}
+
+void PartsNameIndexInsert(PartsNameIndex_t* index, u64 nameHash, u64 value)
+{
+	u64 mask = index->capacity-1;
+	u64 slotIndex = (nameHash & mask);
+	while (index->hashes[slotIndex] != 0) { slotIndex = ((slotIndex + 1) & mask); }
+	index->hashes[slotIndex] = nameHash;
+	index->values[slotIndex] = value;
+	index->count++;
+}
+//Callers are expected to check PartsNameIndexFind first, adding the same hash twice leaves the second entry unreachable
+void PartsNameIndexAdd(PartsNameIndex_t* index, u64 nameHash, u64 value)
+{
+	NotNull(index);
+	NotNull(index->allocArena);
+	Assert(nameHash != 0);
+	if ((index->count+1)*2 > index->capacity)
+	{
+		u64 oldCapacity = index->capacity;
+		u64* oldHashes = index->hashes;
+		u64* oldValues = index->values;
+		index->capacity = (oldCapacity > 0) ? oldCapacity*2 : 16;
+		index->hashes = AllocArray(index->allocArena, u64, index->capacity);
+		index->values = AllocArray(index->allocArena, u64, index->capacity);
+		NotNull2(index->hashes, index->values);
+		MyMemSet(index->hashes, 0x00, sizeof(u64) * index->capacity);
+		index->count = 0;
+		for (u64 sIndex = 0; sIndex < oldCapacity; sIndex++)
+		{
+			if (oldHashes[sIndex] != 0) { PartsNameIndexInsert(index, oldHashes[sIndex], oldValues[sIndex]); }
+		}
+		if (oldHashes != nullptr)
+		{
+			FreeMem(index->allocArena, oldHashes, sizeof(u64) * oldCapacity);
+			FreeMem(index->allocArena, oldValues, sizeof(u64) * oldCapacity);
+		}
+	}
+	PartsNameIndexInsert(index, nameHash, value);
+}
+//Returns UINT64_MAX if nothing with that hash was added
+u64 PartsNameIndexFind(const PartsNameIndex_t* index, u64 nameHash)
+{
+	NotNull(index);
+	if (index->capacity == 0) { return UINT64_MAX; }
+	u64 mask = index->capacity-1;
+	u64 slotIndex = (nameHash & mask);
+	while (index->hashes[slotIndex] != 0)
+	{
+		if (index->hashes[slotIndex] == nameHash) { return index->values[slotIndex]; }
+		slotIndex = ((slotIndex + 1) & mask);
+	}
+	return UINT64_MAX;
+}
+
+// +--------------------------------------------------------------+
+// |                       Deser Helpers                          |
+// +--------------------------------------------------------------+
+//previousKeysArray holds the HashPartsName of each key seen so far in the current Type/Burst/Prefab
 bool Deser_WasKeySeen(const VarArray_t* previousKeysArray, MyStr_t key)
 {
 	NotNull(previousKeysArray);
-	Assert(previousKeysArray->itemSize == sizeof(MyStr_t));
+	Assert(previousKeysArray->itemSize == sizeof(u64));
+	u64 keyHash = HashPartsName(key);
 	VarArrayLoop(previousKeysArray, pIndex)
 	{
-		const VarArrayLoopGet(MyStr_t, previousKey, previousKeysArray, pIndex);
-		if (StrEqualsIgnoreCase(*previousKey, key))
-		{
-			return true;
-		}
+		VarArrayLoopGet(u64, previousKeyHash, previousKeysArray, pIndex);
+		if (*previousKeyHash == keyHash) { return true; }
 	}
 	return false;
 }
@@ -42,38 +132,32 @@ bool Deser_FindNamedColor(const VarArray_t* namedColorsArray, MyStr_t name, Colo
 	return false;
 }
 
-u64 Deser_FindPartsTypeByName(const VarArray_t* typesArray, MyStr_t name)
+u64 Deser_FindPartsTypeByName(const PartsNameIndex_t* typesIndex, const VarArray_t* typesArray, MyStr_t name)
 {
-	NotNull(typesArray);
+	NotNull2(typesIndex, typesArray);
 	NotNullStr(&name);
-	VarArrayLoop(typesArray, tIndex)
-	{
-		VarArrayLoopGet(PartsType_t, type, typesArray, tIndex);
-		if (StrEqualsIgnoreCase(type->name, name)) { return type->id; }
-	}
-	return UINT64_MAX;
+	u64 typeId = PartsNameIndexFind(typesIndex, HashPartsName(name));
+	if (typeId == UINT64_MAX) { return UINT64_MAX; }
+	VarArrayLoopGet(PartsType_t, type, typesArray, typeId-1);
+	return (StrEqualsIgnoreCase(type->name, name) ? type->id : UINT64_MAX);
 }
-u64 Deser_FindPartsBurstByName(const VarArray_t* burstsArray, MyStr_t name)
+u64 Deser_FindPartsBurstByName(const PartsNameIndex_t* burstsIndex, const VarArray_t* burstsArray, MyStr_t name)
 {
-	NotNull(burstsArray);
+	NotNull2(burstsIndex, burstsArray);
 	NotNullStr(&name);
-	VarArrayLoop(burstsArray, bIndex)
-	{
-		VarArrayLoopGet(PartsBurst_t, burst, burstsArray, bIndex);
-		if (StrEqualsIgnoreCase(burst->name, name)) { return burst->id; }
-	}
-	return UINT64_MAX;
+	u64 burstId = PartsNameIndexFind(burstsIndex, HashPartsName(name));
+	if (burstId == UINT64_MAX) { return UINT64_MAX; }
+	VarArrayLoopGet(PartsBurst_t, burst, burstsArray, burstId-1);
+	return (StrEqualsIgnoreCase(burst->name, name) ? burst->id : UINT64_MAX);
 }
-u64 Deser_FindPartsPrefabByName(const VarArray_t* prefabsArray, MyStr_t name)
+u64 Deser_FindPartsPrefabByName(const PartsNameIndex_t* prefabsIndex, const VarArray_t* prefabsArray, MyStr_t name)
 {
-	NotNull(prefabsArray);
+	NotNull2(prefabsIndex, prefabsArray);
 	NotNullStr(&name);
-	VarArrayLoop(prefabsArray, pIndex)
-	{
-		VarArrayLoopGet(PartsPrefab_t, prefab, prefabsArray, pIndex);
-		if (StrEqualsIgnoreCase(prefab->name, name)) { return prefab->id; }
-	}
-	return UINT64_MAX;
+	u64 prefabIndex = PartsNameIndexFind(prefabsIndex, HashPartsName(name));
+	if (prefabIndex == UINT64_MAX) { return UINT64_MAX; }
+	VarArrayLoopGet(PartsPrefab_t, prefab, prefabsArray, prefabIndex);
+	return (StrEqualsIgnoreCase(prefab->name, name) ? prefab->id : UINT64_MAX);
 }
 
 PartsParamI32_t NewPartsParamI32(PartsDistroFunc_t distroFunc, i32 minValue, i32 maxValue)
@@ -465,13 +549,18 @@ void FreePartsPrefabCollection(PartsPrefabCollection_t* collection)
 		VarArrayLoop(&prefab->bursts, bIndex)
 		{
 			VarArrayLoopGet(PartsBurst_t, burst, &prefab->bursts, bIndex);
-			FreeString(collection->allocArena, &burst->name);
-			FreeString(collection->allocArena, &burst->type.name);
+			if (collection->stringsBlock == nullptr)
+			{
+				FreeString(collection->allocArena, &burst->name);
+				FreeString(collection->allocArena, &burst->type.name);
+			}
 		}
 		FreeVarArray(&prefab->bursts);
-		FreeString(collection->allocArena, &prefab->name);
+		if (collection->stringsBlock == nullptr) { FreeString(collection->allocArena, &prefab->name); }
 	}
 	FreeVarArray(&collection->prefabs);
+	FreePartsNameIndex(&collection->prefabIndex);
+	if (collection->stringsBlock != nullptr) { FreeMem(collection->allocArena, collection->stringsBlock, collection->stringsBlockSize); }
 	ClearPointer(collection);
 }
 
@@ -490,8 +579,12 @@ bool TryDeserPartsPrefabCollection(MyStr_t fileContents, MemArena_t* memArena, P
 	VarArray_t namedColors;
 	CreateVarArray(&types, mainHeap, sizeof(PartsType_t));
 	CreateVarArray(&bursts, mainHeap, sizeof(PartsBurst_t));
-	CreateVarArray(&previousKeys, mainHeap, sizeof(MyStr_t));
+	CreateVarArray(&previousKeys, mainHeap, sizeof(u64));
 	CreateVarArray(&namedColors, mainHeap, sizeof(CollectionNamedColor_t));
+	PartsNameIndex_t typesIndex;
+	PartsNameIndex_t burstsIndex;
+	InitPartsNameIndex(&typesIndex, mainHeap);
+	InitPartsNameIndex(&burstsIndex, mainHeap);
 	
 	bool foundFilePrefix = false;
 	
@@ -507,6 +600,7 @@ bool TryDeserPartsPrefabCollection(MyStr_t fileContents, MemArena_t* memArena, P
 	collectionOut->nextBurstId = 1;
 	collectionOut->nextTypeId = 1;
 	CreateVarArray(&collectionOut->prefabs, memArena, sizeof(PartsPrefab_t));
+	InitPartsNameIndex(&collectionOut->prefabIndex, memArena);
 	
 	TextParser_t parser = NewTextParser(fileContents);
 	ParsingToken_t token = {};
@@ -520,6 +614,8 @@ bool TryDeserPartsPrefabCollection(MyStr_t fileContents, MemArena_t* memArena, P
 			FreeVarArray(&bursts);
 			FreeVarArray(&previousKeys);
 			FreeVarArray(&namedColors);
+			FreePartsNameIndex(&typesIndex);
+			FreePartsNameIndex(&burstsIndex);
 			return false;
 		}
 		
@@ -537,6 +633,8 @@ bool TryDeserPartsPrefabCollection(MyStr_t fileContents, MemArena_t* memArena, P
 						FreeVarArray(&bursts);
 						FreeVarArray(&previousKeys);
 						FreeVarArray(&namedColors);
+						FreePartsNameIndex(&typesIndex);
+						FreePartsNameIndex(&burstsIndex);
 						return false;
 					}
 					foundFilePrefix = true;
@@ -549,6 +647,8 @@ bool TryDeserPartsPrefabCollection(MyStr_t fileContents, MemArena_t* memArena, P
 					FreeVarArray(&bursts);
 					FreeVarArray(&previousKeys);
 					FreeVarArray(&namedColors);
+					FreePartsNameIndex(&typesIndex);
+					FreePartsNameIndex(&burstsIndex);
 					return false;
 				}
 			} break;
@@ -575,7 +675,7 @@ bool TryDeserPartsPrefabCollection(MyStr_t fileContents, MemArena_t* memArena, P
 						LogPrintLine_E(log, "Found Type with empty name on line %llu", parser.lineParser.lineIndex+1);
 						log->hadWarnings = true;
 					}
-					else if (Deser_FindPartsTypeByName(&types, token.value) != UINT64_MAX)
+					else if (Deser_FindPartsTypeByName(&typesIndex, &types, token.value) != UINT64_MAX)
 					{
 						LogPrintLine_E(log, "Type on line %llu has same name as previous type: \"%.*s\"", parser.lineParser.lineIndex+1, StrPrint(token.value));
 						log->hadWarnings = true;
@@ -589,6 +689,7 @@ bool TryDeserPartsPrefabCollection(MyStr_t fileContents, MemArena_t* memArena, P
 						ClearPointer(currentType);
 						currentType->name = token.value;
 						currentType->id = types.length;
+						PartsNameIndexAdd(&typesIndex, HashPartsName(currentType->name), currentType->id);
 						
 						currentType->flags                = PartsTypeFlag_None;
 						currentType->texture              = {};
@@ -629,7 +730,7 @@ bool TryDeserPartsPrefabCollection(MyStr_t fileContents, MemArena_t* memArena, P
 						LogPrintLine_E(log, "Found Burst with empty name on line %llu", parser.lineParser.lineIndex+1);
 						log->hadWarnings = true;
 					}
-					else if (Deser_FindPartsBurstByName(&bursts, token.value) != UINT64_MAX)
+					else if (Deser_FindPartsBurstByName(&burstsIndex, &bursts, token.value) != UINT64_MAX)
 					{
 						LogPrintLine_E(log, "Burst on line %llu has same name as previous burst: \"%.*s\"", parser.lineParser.lineIndex+1, StrPrint(token.value));
 						log->hadWarnings = true;
@@ -641,6 +742,7 @@ bool TryDeserPartsPrefabCollection(MyStr_t fileContents, MemArena_t* memArena, P
 						ClearPointer(currentBurst);
 						currentBurst->name = token.value;
 						currentBurst->id = bursts.length;
+						PartsNameIndexAdd(&burstsIndex, HashPartsName(currentBurst->name), currentBurst->id);
 						
 						currentBurst->count = NewPartsParamI32(PartsDistroFunc_Random, 0, 0);
 						currentBurst->shape = PartsEmissionShape_Point;
@@ -662,7 +764,7 @@ bool TryDeserPartsPrefabCollection(MyStr_t fileContents, MemArena_t* memArena, P
 						LogPrintLine_E(log, "Found Prefab with empty name on line %llu", parser.lineParser.lineIndex+1);
 						log->hadWarnings = true;
 					}
-					else if (Deser_FindPartsPrefabByName(&collectionOut->prefabs, token.value) != UINT64_MAX)
+					else if (Deser_FindPartsPrefabByName(&collectionOut->prefabIndex, &collectionOut->prefabs, token.value) != UINT64_MAX)
 					{
 						LogPrintLine_E(log, "Prefab on line %llu has same name as previous prefab: \"%.*s\"", parser.lineParser.lineIndex+1, StrPrint(token.value));
 						log->hadWarnings = true;
@@ -674,6 +776,8 @@ bool TryDeserPartsPrefabCollection(MyStr_t fileContents, MemArena_t* memArena, P
 						ClearPointer(currentPrefab);
 						currentPrefab->name = AllocString(collectionOut->allocArena, &token.value);
 						NotNullStr(&currentPrefab->name);
+						currentPrefab->nameHash = HashPartsName(currentPrefab->name);
+						PartsNameIndexAdd(&collectionOut->prefabIndex, currentPrefab->nameHash, collectionOut->prefabs.length-1);
 						currentPrefab->id = collectionOut->nextPrefabId;
 						collectionOut->nextPrefabId++;
 						CreateVarArray(&currentPrefab->bursts, collectionOut->allocArena, sizeof(PartsBurst_t));
@@ -1253,7 +1357,7 @@ bool TryDeserPartsPrefabCollection(MyStr_t fileContents, MemArena_t* memArena, P
 					// +==============================+
 					if (StrEqualsIgnoreCase(token.key, "Using"))
 					{
-						u64 typeId = Deser_FindPartsTypeByName(&types, token.value);
+						u64 typeId = Deser_FindPartsTypeByName(&typesIndex, &types, token.value);
 						if (Deser_WasKeySeen(&previousKeys, NewStr("Using")))
 						{
 							LogPrintLine_W(log, "Warning: Found \"Using\" a second time in one Burst \"%.*s\" (on line %llu)",
@@ -1348,7 +1452,7 @@ bool TryDeserPartsPrefabCollection(MyStr_t fileContents, MemArena_t* memArena, P
 					// +==============================+
 					if (StrEqualsIgnoreCase(token.key, "Do"))
 					{
-						u64 burstId = Deser_FindPartsBurstByName(&bursts, token.value);
+						u64 burstId = Deser_FindPartsBurstByName(&burstsIndex, &bursts, token.value);
 						if (burstId == UINT64_MAX)
 						{
 							LogPrintLine_E(log, "Prefab \"%.*s\" requests burst \"%.*s\" which doesn't exist. Make sure you used to correct name. (line %llu)",
@@ -1385,11 +1489,11 @@ bool TryDeserPartsPrefabCollection(MyStr_t fileContents, MemArena_t* memArena, P
 					log->hadWarnings = true;
 				}
 				
-				if (!Deser_WasKeySeen(&previousKeys, token.value))
+				if (!Deser_WasKeySeen(&previousKeys, token.key))
 				{
-					MyStr_t* newKeySeenSpace = VarArrayAdd(&previousKeys, MyStr_t);
+					u64* newKeySeenSpace = VarArrayAdd(&previousKeys, u64);
 					NotNull(newKeySeenSpace);
-					*newKeySeenSpace = token.key;
+					*newKeySeenSpace = HashPartsName(token.key);
 				}
 			} break;
 			default:
@@ -1404,5 +1508,280 @@ bool TryDeserPartsPrefabCollection(MyStr_t fileContents, MemArena_t* memArena, P
 	FreeVarArray(&bursts);
 	FreeVarArray(&previousKeys);
 	FreeVarArray(&namedColors);
+	FreePartsNameIndex(&typesIndex);
+	FreePartsNameIndex(&burstsIndex);
 	return true;
-}
\ No newline at end of file
+}
+
+// +--------------------------------------------------------------+
+// |                      Cooked Collection                       |
+// +--------------------------------------------------------------+
+//NOTE: "Resources/Text/particles.parts" -> "Resources/Text/particles.pparts"
+MyStr_t GetCookedPartsPath(MyStr_t sourcePath, MemArena_t* memArena)
+{
+	NotNull(memArena);
+	u64 extensionIndex = sourcePath.length;
+	for (u64 cIndex = sourcePath.length; cIndex > 0; cIndex--)
+	{
+		char c = sourcePath.chars[cIndex-1];
+		if (c == '/' || c == '\\') { break; }
+		if (c == '.') { extensionIndex = cIndex-1; break; }
+	}
+	return PrintInArenaStr(memArena, "%.*s%s", (int)extensionIndex, sourcePath.chars, COOKED_PARTS_FILE_EXTENSION);
+}
+
+u32 CookedPartsAddString(char* stringsBlock, u64* stringsSizeInOut, MyStr_t str)
+{
+	u32 result = (u32)(*stringsSizeInOut);
+	if (stringsBlock != nullptr && str.length > 0) { MyMemCopy(&stringsBlock[*stringsSizeInOut], str.chars, str.length); }
+	if (stringsBlock != nullptr) { stringsBlock[*stringsSizeInOut + str.length] = '\0'; }
+	*stringsSizeInOut += str.length + 1;
+	return result;
+}
+
+u8* SerializeCookedPartsPrefabCollection(const PartsPrefabCollection_t* collection, u64 sourceSize, u64 sourceHash, MemArena_t* memArena, u64* sizeOut)
+{
+	NotNull3(collection, memArena, sizeOut);
+	
+	u64 numBursts = 0;
+	u64 stringsSize = 0;
+	VarArrayLoop(&collection->prefabs, pIndex)
+	{
+		VarArrayLoopGet(PartsPrefab_t, prefab, &collection->prefabs, pIndex);
+		CookedPartsAddString(nullptr, &stringsSize, prefab->name);
+		VarArrayLoop(&prefab->bursts, bIndex)
+		{
+			VarArrayLoopGet(PartsBurst_t, burst, &prefab->bursts, bIndex);
+			CookedPartsAddString(nullptr, &stringsSize, burst->name);
+			CookedPartsAddString(nullptr, &stringsSize, burst->type.name);
+		}
+		numBursts += prefab->bursts.length;
+	}
+	if (stringsSize > UINT32_MAX || numBursts > UINT32_MAX) { return nullptr; }
+	
+	u64 prefabsOffset = sizeof(CookedPartsFileHeader_t);
+	u64 burstsOffset = prefabsOffset + sizeof(CookedPartsFilePrefab_t) * collection->prefabs.length;
+	u64 stringsOffset = burstsOffset + sizeof(CookedPartsFileBurst_t) * numBursts;
+	u64 resultSize = stringsOffset + stringsSize;
+	u8* result = AllocArray(memArena, u8, resultSize);
+	NotNull(result);
+	MyMemSet(result, 0x00, resultSize);
+	
+	CookedPartsFileHeader_t header = {};
+	MyMemCopy(&header.magic[0], COOKED_PARTS_MAGIC, sizeof(header.magic));
+	header.version = COOKED_PARTS_VERSION;
+	header.burstRecordSize = (u32)sizeof(CookedPartsFileBurst_t);
+	header.numSheetResources = RESOURCES_NUM_SHEETS;
+	header.numTextureResources = RESOURCES_NUM_TEXTURES;
+	header.numPrefabs = (u32)collection->prefabs.length;
+	header.numBursts = (u32)numBursts;
+	header.stringsSize = (u32)stringsSize;
+	header.sourceSize = sourceSize;
+	header.sourceHash = sourceHash;
+	header.nextTypeId = collection->nextTypeId;
+	header.nextBurstId = collection->nextBurstId;
+	header.nextPrefabId = collection->nextPrefabId;
+	MyMemCopy(result, &header, sizeof(header));
+	
+	char* stringsBlock = (char*)(result + stringsOffset);
+	u64 stringsWritten = 0;
+	u64 burstIndex = 0;
+	VarArrayLoop(&collection->prefabs, pIndex)
+	{
+		VarArrayLoopGet(PartsPrefab_t, prefab, &collection->prefabs, pIndex);
+		CookedPartsFilePrefab_t prefabRecord = {};
+		prefabRecord.id = prefab->id;
+		prefabRecord.nameHash = prefab->nameHash;
+		prefabRecord.nameLength = (u32)prefab->name.length;
+		prefabRecord.nameOffset = CookedPartsAddString(stringsBlock, &stringsWritten, prefab->name);
+		prefabRecord.firstBurstIndex = (u32)burstIndex;
+		prefabRecord.numBursts = (u32)prefab->bursts.length;
+		MyMemCopy(result + prefabsOffset + sizeof(CookedPartsFilePrefab_t) * pIndex, &prefabRecord, sizeof(prefabRecord));
+		
+		VarArrayLoop(&prefab->bursts, bIndex)
+		{
+			VarArrayLoopGet(PartsBurst_t, burst, &prefab->bursts, bIndex);
+			CookedPartsFileBurst_t burstRecord;
+			ClearStruct(burstRecord);
+			burstRecord.nameLength = (u32)burst->name.length;
+			burstRecord.nameOffset = CookedPartsAddString(stringsBlock, &stringsWritten, burst->name);
+			burstRecord.typeNameLength = (u32)burst->type.name.length;
+			burstRecord.typeNameOffset = CookedPartsAddString(stringsBlock, &stringsWritten, burst->type.name);
+			burstRecord.sheetIndex = (IsHandleFilled(&burst->type.sheet) ? (u32)burst->type.sheet.index : UINT32_MAX);
+			burstRecord.textureIndex = (IsHandleFilled(&burst->type.texture) ? (u32)burst->type.texture.index : UINT32_MAX);
+			MyMemCopy(&burstRecord.burst, burst, sizeof(PartsBurst_t));
+			burstRecord.burst.name = MyStr_Empty;
+			burstRecord.burst.type.name = MyStr_Empty;
+			burstRecord.burst.type.sheet = {};
+			burstRecord.burst.type.texture = {};
+			MyMemCopy(result + burstsOffset + sizeof(CookedPartsFileBurst_t) * burstIndex, &burstRecord, sizeof(burstRecord));
+			burstIndex++;
+		}
+	}
+	Assert(burstIndex == numBursts);
+	Assert(stringsWritten == stringsSize);
+	
+	*sizeOut = resultSize;
+	return result;
+}
+
+bool TryReadCookedPartsHeader(const u8* data, u64 dataSize, CookedPartsFileHeader_t* headerOut)
+{
+	NotNull(headerOut);
+	if (data == nullptr || dataSize < sizeof(CookedPartsFileHeader_t)) { return false; }
+	MyMemCopy(headerOut, data, sizeof(CookedPartsFileHeader_t));
+	if (MyMemCompare(&headerOut->magic[0], COOKED_PARTS_MAGIC, sizeof(headerOut->magic)) != 0) { return false; }
+	if (headerOut->version != COOKED_PARTS_VERSION) { return false; }
+	if (headerOut->burstRecordSize != sizeof(CookedPartsFileBurst_t)) { return false; }
+	if (headerOut->numSheetResources != RESOURCES_NUM_SHEETS || headerOut->numTextureResources != RESOURCES_NUM_TEXTURES) { return false; }
+	u64 expectedSize = sizeof(CookedPartsFileHeader_t)
+		+ sizeof(CookedPartsFilePrefab_t) * (u64)headerOut->numPrefabs
+		+ sizeof(CookedPartsFileBurst_t) * (u64)headerOut->numBursts
+		+ (u64)headerOut->stringsSize;
+	return (dataSize == expectedSize);
+}
+
+//NOTE: Rather than walking the text format this does one copy of the strings and bursts into exactly sized allocations,
+//      then patches up the names and resource handles. The collection is freed like any other with FreePartsPrefabCollection
+bool DeserializeCookedPartsPrefabCollection(const u8* data, u64 dataSize, MemArena_t* memArena, PartsPrefabCollection_t* collectionOut)
+{
+	NotNull2(memArena, collectionOut);
+	Assert(DoesMemArenaSupportFreeing(memArena));
+	CookedPartsFileHeader_t header;
+	if (!TryReadCookedPartsHeader(data, dataSize, &header)) { return false; }
+	
+	u64 prefabsOffset = sizeof(CookedPartsFileHeader_t);
+	u64 burstsOffset = prefabsOffset + sizeof(CookedPartsFilePrefab_t) * header.numPrefabs;
+	u64 stringsOffset = burstsOffset + sizeof(CookedPartsFileBurst_t) * header.numBursts;
+	
+	ClearPointer(collectionOut);
+	collectionOut->allocArena = memArena;
+	collectionOut->nextTypeId = header.nextTypeId;
+	collectionOut->nextBurstId = header.nextBurstId;
+	collectionOut->nextPrefabId = header.nextPrefabId;
+	CreateVarArray(&collectionOut->prefabs, memArena, sizeof(PartsPrefab_t), header.numPrefabs);
+	InitPartsNameIndex(&collectionOut->prefabIndex, memArena);
+	if (header.stringsSize > 0)
+	{
+		collectionOut->stringsBlockSize = header.stringsSize;
+		collectionOut->stringsBlock = AllocArray(memArena, char, header.stringsSize);
+		NotNull(collectionOut->stringsBlock);
+		MyMemCopy(collectionOut->stringsBlock, data + stringsOffset, header.stringsSize);
+		if (collectionOut->stringsBlock[header.stringsSize-1] != '\0') { FreePartsPrefabCollection(collectionOut); return false; }
+	}
+	
+	#define CookedPartsStrIsValid(offset, length) ((u64)(offset) + (u64)(length) < (u64)header.stringsSize)
+	for (u64 pIndex = 0; pIndex < header.numPrefabs; pIndex++)
+	{
+		CookedPartsFilePrefab_t prefabRecord;
+		MyMemCopy(&prefabRecord, data + prefabsOffset + sizeof(CookedPartsFilePrefab_t) * pIndex, sizeof(prefabRecord));
+		if (!CookedPartsStrIsValid(prefabRecord.nameOffset, prefabRecord.nameLength) ||
+			(u64)prefabRecord.firstBurstIndex + (u64)prefabRecord.numBursts > header.numBursts)
+		{
+			FreePartsPrefabCollection(collectionOut);
+			return false;
+		}
+		
+		PartsPrefab_t* newPrefab = VarArrayAdd(&collectionOut->prefabs, PartsPrefab_t);
+		NotNull(newPrefab);
+		ClearPointer(newPrefab);
+		newPrefab->id = prefabRecord.id;
+		newPrefab->name = NewStr(prefabRecord.nameLength, &collectionOut->stringsBlock[prefabRecord.nameOffset]);
+		newPrefab->nameHash = HashPartsName(newPrefab->name);
+		CreateVarArray(&newPrefab->bursts, memArena, sizeof(PartsBurst_t), prefabRecord.numBursts);
+		if (newPrefab->nameHash != prefabRecord.nameHash) { FreePartsPrefabCollection(collectionOut); return false; }
+		PartsNameIndexAdd(&collectionOut->prefabIndex, newPrefab->nameHash, pIndex);
+		
+		for (u64 bIndex = 0; bIndex < prefabRecord.numBursts; bIndex++)
+		{
+			CookedPartsFileBurst_t burstRecord;
+			MyMemCopy(&burstRecord, data + burstsOffset + sizeof(CookedPartsFileBurst_t) * (prefabRecord.firstBurstIndex + bIndex), sizeof(burstRecord));
+			if (!CookedPartsStrIsValid(burstRecord.nameOffset, burstRecord.nameLength) ||
+				!CookedPartsStrIsValid(burstRecord.typeNameOffset, burstRecord.typeNameLength) ||
+				(burstRecord.sheetIndex != UINT32_MAX && burstRecord.sheetIndex >= RESOURCES_NUM_SHEETS) ||
+				(burstRecord.textureIndex != UINT32_MAX && burstRecord.textureIndex >= RESOURCES_NUM_TEXTURES))
+			{
+				FreePartsPrefabCollection(collectionOut);
+				return false;
+			}
+			
+			PartsBurst_t* newBurst = VarArrayAdd(&newPrefab->bursts, PartsBurst_t);
+			NotNull(newBurst);
+			MyMemCopy(newBurst, &burstRecord.burst, sizeof(PartsBurst_t));
+			newBurst->name = NewStr(burstRecord.nameLength, &collectionOut->stringsBlock[burstRecord.nameOffset]);
+			newBurst->type.name = NewStr(burstRecord.typeNameLength, &collectionOut->stringsBlock[burstRecord.typeNameOffset]);
+			if (burstRecord.sheetIndex != UINT32_MAX) { newBurst->type.sheet = GetSpriteSheetHandle(&pig->resources.sheets->items[burstRecord.sheetIndex]); }
+			if (burstRecord.textureIndex != UINT32_MAX) { newBurst->type.texture = GetTextureHandle(&pig->resources.textures->items[burstRecord.textureIndex]); }
+		}
+	}
+	#undef CookedPartsStrIsValid
+	
+	return true;
+}
+
+//NOTE: Loads a .parts file through the .pparts that sits next to it. When allowCook is true (developer builds) the text file is
+//      hashed and the .pparts is (re)cooked whenever it's missing or out of date, otherwise a valid .pparts is trusted as-is
+//      and the text file is only parsed when there is no usable .pparts
+bool TryLoadPartsPrefabCollection(MyStr_t filePath, MemArena_t* memArena, ProcessLog_t* log, PartsPrefabCollection_t* collectionOut, bool allowCook = DEVELOPER_BUILD)
+{
+	NotNull3(memArena, log, collectionOut);
+	NotEmptyStr(&filePath);
+	
+	MemArena_t* scratch = GetScratchArena(memArena);
+	MyStr_t cookedPath = GetCookedPartsPath(filePath, scratch);
+	bool result = false;
+	
+	PlatMappedFile_t sourceFile = {};
+	bool sourceMapped = false;
+	u64 sourceHash = 0;
+	if (allowCook)
+	{
+		sourceMapped = plat->MapFile(filePath, &sourceFile);
+		if (!sourceMapped)
+		{
+			LogPrintLine_E(log, "Couldn't open particles file at \"%.*s\"", StrPrint(filePath));
+			FreeScratchArena(scratch);
+			return false;
+		}
+		sourceHash = FnvHashU64(sourceFile.data, sourceFile.size);
+	}
+	
+	PlatMappedFile_t cookedFile = {};
+	if (plat->MapFile(cookedPath, &cookedFile))
+	{
+		CookedPartsFileHeader_t header;
+		if (TryReadCookedPartsHeader((const u8*)cookedFile.data, cookedFile.size, &header) &&
+			(!allowCook || (header.sourceSize == sourceFile.size && header.sourceHash == sourceHash)))
+		{
+			result = DeserializeCookedPartsPrefabCollection((const u8*)cookedFile.data, cookedFile.size, memArena, collectionOut);
+			if (result) { LogPrintLine_I(log, "Loaded %llu prefab%s from \"%.*s\"", collectionOut->prefabs.length, Plural(collectionOut->prefabs.length, "s"), StrPrint(cookedPath)); }
+		}
+		plat->UnmapFile(&cookedFile);
+	}
+	
+	if (!result)
+	{
+		if (!sourceMapped) { sourceMapped = plat->MapFile(filePath, &sourceFile); }
+		if (!sourceMapped)
+		{
+			LogPrintLine_E(log, "Couldn't open particles file at \"%.*s\"", StrPrint(filePath));
+		}
+		else
+		{
+			result = TryDeserPartsPrefabCollection(NewStr(sourceFile.size, (char*)sourceFile.data), memArena, log, collectionOut);
+			if (result && allowCook)
+			{
+				u64 cookedFileSize = 0;
+				u8* cookedFileData = SerializeCookedPartsPrefabCollection(collectionOut, sourceFile.size, sourceHash, scratch, &cookedFileSize);
+				if (cookedFileData == nullptr || !plat->WriteEntireFile(cookedPath, cookedFileData, cookedFileSize))
+				{
+					LogPrintLine_W(log, "Failed to write cooked particles to \"%.*s\"", StrPrint(cookedPath));
+				}
+			}
+		}
+	}
+	
+	if (sourceMapped) { plat->UnmapFile(&sourceFile); }
+	FreeScratchArena(scratch);
+	return result;
+}
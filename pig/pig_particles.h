@@ -220,9 +220,29 @@ struct PartsPrefab_t
 {
 	u64 id;
 	MyStr_t name;
+	u64 nameHash; //see HashPartsName
 	VarArray_t bursts; //PartsBurst_t
 };
 
+//Open addressing table from a name hash (which is never 0) to some index or id. Used for name lookups while
+//deserializing and for finding prefabs by name at runtime
+struct PartsNameIndex_t
+{
+	MemArena_t* allocArena;
+	u64 count;
+	u64 capacity; //always a power of 2 (or 0)
+	u64* hashes; //0 means the slot is empty
+	u64* values;
+};
+
+//NOTE: A PartsPrefabId_t stays valid across reloads of the collection since it's based on the prefab's name.
+//      The index is just a hint that lets GetPartsPrefabById skip the hash lookup when nothing has moved
+struct PartsPrefabId_t
+{
+	u64 nameHash;
+	u64 indexHint;
+};
+
 struct PartsPrefabCollection_t
 {
 	u64 nextTypeId;
@@ -231,6 +251,59 @@ struct PartsPrefabCollection_t
 	
 	MemArena_t* allocArena;
 	VarArray_t prefabs; //PartsPrefab_t
+	PartsNameIndex_t prefabIndex; //nameHash -> index in prefabs
+	
+	//When loaded from a cooked file all the names live in this one allocation instead of being allocated individually
+	u64 stringsBlockSize;
+	char* stringsBlock;
+};
+
+// +--------------------------------------------------------------+
+// |                       Cooked Collection                      |
+// +--------------------------------------------------------------+
+#define COOKED_PARTS_MAGIC          "PPRT"
+#define COOKED_PARTS_VERSION        1
+#define COOKED_PARTS_FILE_EXTENSION ".pparts"
+
+//NOTE: A .pparts file is this header, followed by numPrefabs CookedPartsFilePrefab_t, then numBursts CookedPartsFileBurst_t
+//      (each prefab's bursts are contiguous), then stringsSize bytes of names. The burst records are a straight copy of the
+//      in-memory PartsBurst_t with the pointers and handles zeroed so these files are only meant to be read by the build that wrote them
+START_PACK()
+struct ATTR_PACKED CookedPartsFileHeader_t
+{
+	char magic[4]; //COOKED_PARTS_MAGIC
+	u32 version; //COOKED_PARTS_VERSION
+	u32 burstRecordSize; //sizeof(CookedPartsFileBurst_t) in the build that wrote the file
+	u32 numSheetResources; //RESOURCES_NUM_SHEETS, resource indices are meaningless if this changes
+	u32 numTextureResources; //RESOURCES_NUM_TEXTURES
+	u32 numPrefabs;
+	u32 numBursts;
+	u32 stringsSize;
+	u64 sourceSize;
+	u64 sourceHash;
+	u64 nextTypeId;
+	u64 nextBurstId;
+	u64 nextPrefabId;
+};
+struct ATTR_PACKED CookedPartsFilePrefab_t
+{
+	u64 id;
+	u64 nameHash;
+	u32 nameOffset;
+	u32 nameLength;
+	u32 firstBurstIndex;
+	u32 numBursts;
+};
+END_PACK()
+struct CookedPartsFileBurst_t
+{
+	u32 nameOffset;
+	u32 nameLength;
+	u32 typeNameOffset;
+	u32 typeNameLength;
+	u32 sheetIndex; //UINT32_MAX if the type has no sheet
+	u32 textureIndex; //UINT32_MAX if the type has no texture
+	PartsBurst_t burst; //name, type.name, type.sheet and type.texture are zeroed
 };
 
 #endif //  _PIG_PARTICLES_H
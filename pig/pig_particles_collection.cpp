@@ -79,6 +79,18 @@ PartsPrefab_t* FindPartsPrefab(PartsPrefabCollection_t* collection, MyStr_t name
 {
 	NotNull(collection);
 	NotNullStr(&name);
+	u64 nameHash = HashPartsName(name);
+	u64 indexedIndex = PartsNameIndexFind(&collection->prefabIndex, nameHash);
+	if (indexedIndex < collection->prefabs.length)
+	{
+		PartsPrefab_t* prefab = VarArrayGet(&collection->prefabs, indexedIndex, PartsPrefab_t);
+		if (prefab->nameHash == nameHash && StrEqualsIgnoreCase(prefab->name, name))
+		{
+			if (prefabIndexOut != nullptr) { *prefabIndexOut = indexedIndex; }
+			return prefab;
+		}
+	}
+	//Collections that were filled in by hand (or a hash collision) won't be found through the index
 	VarArrayLoop(&collection->prefabs, pIndex)
 	{
 		VarArrayLoopGet(PartsPrefab_t, prefab, &collection->prefabs, pIndex);
@@ -103,6 +115,36 @@ const PartsPrefab_t* FindPartsPrefab(const PartsPrefabCollection_t* collection,
 	return (const PartsPrefab_t*)FindPartsPrefab((PartsPrefabCollection_t*)collection, NewStr(nameNullTerm));
 }
 
+//NOTE: Look the id up once (at init or after a reload) and hold onto it, GetPartsPrefabById is then a hash compare
+//      in the common case rather than a string compare against every prefab in the collection
+PartsPrefabId_t GetPartsPrefabId(const PartsPrefabCollection_t* collection, MyStr_t name)
+{
+	NotNull(collection);
+	PartsPrefabId_t result = {};
+	result.nameHash = HashPartsName(name);
+	u64 prefabIndex = 0;
+	if (FindPartsPrefab((PartsPrefabCollection_t*)collection, name, &prefabIndex) != nullptr) { result.indexHint = prefabIndex; }
+	return result;
+}
+PartsPrefabId_t GetPartsPrefabId(const PartsPrefabCollection_t* collection, const char* nameNullTerm)
+{
+	return GetPartsPrefabId(collection, NewStr(nameNullTerm));
+}
+
+const PartsPrefab_t* GetPartsPrefabById(const PartsPrefabCollection_t* collection, PartsPrefabId_t prefabId)
+{
+	NotNull(collection);
+	if (prefabId.nameHash == 0) { return nullptr; }
+	if (prefabId.indexHint < collection->prefabs.length)
+	{
+		const PartsPrefab_t* hintedPrefab = VarArrayGet(&collection->prefabs, prefabId.indexHint, PartsPrefab_t);
+		if (hintedPrefab->nameHash == prefabId.nameHash) { return hintedPrefab; }
+	}
+	u64 prefabIndex = PartsNameIndexFind(&collection->prefabIndex, prefabId.nameHash);
+	if (prefabIndex < collection->prefabs.length) { return VarArrayGet(&collection->prefabs, prefabIndex, PartsPrefab_t); }
+	return nullptr;
+}
+
 void FreeCopiedPartsPrefab(MemArena_t* allocArena, PartsPrefab_t* prefab)
 {
 	NotNull2(allocArena, prefab);
@@ -261,3 +303,8 @@ u64 DoPartsPrefab(ParticleEngine_t* engine, RandomSeries_t* random, const PartsP
 	
 	return numPartsSpawned;
 }
+u64 DoPartsPrefab(ParticleEngine_t* engine, RandomSeries_t* random, const PartsPrefabCollection_t* collection, PartsPrefabId_t prefabId, v2 position, v2 spawnScale, r32 scale, r32 rotation, v2 addVelocity, DoPartsPrefabCallback_f* callback = nullptr, void* userPntr = nullptr)
+{
+	NotNull(collection);
+	return DoPartsPrefab(engine, random, GetPartsPrefabById(collection, prefabId), position, spawnScale, scale, rotation, addVelocity, callback, userPntr);
+}
\ No newline at end of file
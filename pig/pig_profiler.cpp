@@ -0,0 +1,508 @@
+/*
+File:   pig_profiler.cpp
+Date:   10\19\2026
+Description:
+	** Holds the functions that record profiler zones on any thread (PigProfilerBegin_/PigProfilerEnd_), gather them
+	** into a per-frame tree on the main thread, render that tree in the debug overlay, and write Chrome trace captures
+*/
+
+#if PIG_PROFILER
+
+#define PIG_PROFILER_OVERLAY_MAX_LINES   64
+#define PIG_PROFILER_OVERLAY_INDENT      12 //px
+#define PIG_PROFILER_OVERLAY_PADDING     5 //px
+#define PIG_PROFILER_OVERLAY_COLUMN_GAP  10 //px
+
+// +--------------------------------------------------------------+
+// |                        Initialization                        |
+// +--------------------------------------------------------------+
+void InitPigProfilerFrame(PigProfilerFrame_t* frame, MemArena_t* memArena)
+{
+	NotNull2(frame, memArena);
+	ClearPointer(frame);
+	CreateVarArray(&frame->nodes, memArena, sizeof(PigProfilerNode_t), 256);
+}
+
+void InitPigProfiler(PigProfiler_t* profiler, MemArena_t* allocArena, MemArena_t* bufferArena)
+{
+	NotNull3(profiler, allocArena, bufferArena);
+	ClearPointer(profiler);
+	profiler->allocArena = allocArena;
+	profiler->bufferArena = bufferArena;
+	profiler->startTime = GetPerfTime();
+	profiler->frameStartTime = profiler->startTime;
+	for (u64 tIndex = 0; tIndex < PIG_PROFILER_MAX_THREADS; tIndex++)
+	{
+		profiler->threads[tIndex].rootNodeIndex = PIG_PROFILER_NO_NODE;
+	}
+	InitPigProfilerFrame(&profiler->buildingFrame, allocArena);
+	InitPigProfilerFrame(&profiler->lastFrame, allocArena);
+	CreateVarArray(&profiler->captureZones, allocArena, sizeof(PigProfilerCaptureZone_t));
+	profiler->initialized = true;
+}
+
+u64 PigProfilerGetNumThreads(const PigProfiler_t* profiler)
+{
+	u64 result = PigAtomicLoadAcquire(&profiler->numThreads);
+	return (result < PIG_PROFILER_MAX_THREADS) ? result : PIG_PROFILER_MAX_THREADS;
+}
+
+// +--------------------------------------------------------------+
+// |                       Thread Binding                         |
+// +--------------------------------------------------------------+
+void PigProfilerSetThreadName(PigProfilerThread_t* thread, const char* prefix, u64 number, bool appendNumber)
+{
+	u64 nameLength = 0;
+	for (u64 cIndex = 0; prefix[cIndex] != '\0' && nameLength < PIG_PROFILER_THREAD_NAME_SIZE-1; cIndex++) { thread->name[nameLength++] = prefix[cIndex]; }
+	if (appendNumber)
+	{
+		char digits[20];
+		u64 numDigits = 0;
+		do { digits[numDigits++] = (char)('0' + (number % 10)); number /= 10; } while (number > 0);
+		while (numDigits > 0 && nameLength < PIG_PROFILER_THREAD_NAME_SIZE-1) { thread->name[nameLength++] = digits[--numDigits]; }
+	}
+	thread->name[nameLength] = '\0';
+}
+
+//NOTE: Slots are never given back. A thread that registers again (after a dll reload) finds its old slot by thread id
+PigProfilerThread_t* PigProfilerRegisterThread(PigProfiler_t* profiler, ThreadId_t threadId)
+{
+	u64 numThreads = PigProfilerGetNumThreads(profiler);
+	for (u64 tIndex = 0; tIndex < numThreads; tIndex++)
+	{
+		PigProfilerThread_t* thread = &profiler->threads[tIndex];
+		if (PigAtomicLoadAcquire(&thread->registered) != 0 && thread->threadId == threadId) { return thread; }
+	}
+	
+	u64 newIndex = PigAtomicFetchAdd(&profiler->numThreads, 1);
+	if (newIndex >= PIG_PROFILER_MAX_THREADS) { return nullptr; }
+	PigProfilerThread_t* result = &profiler->threads[newIndex];
+	result->threadId = threadId;
+	result->events = AllocArray(profiler->bufferArena, PigProfilerEvent_t, PIG_PROFILER_RING_SIZE);
+	NotNull(result->events);
+	if (threadId == pig->mainThreadId) { PigProfilerSetThreadName(result, "Main", 0, false); }
+	else
+	{
+		PlatThreadPoolThread_t* threadContext = plat->GetThreadContext(threadId);
+		if (threadContext != nullptr) { PigProfilerSetThreadName(result, "Worker ", threadContext->id, true); }
+		else { PigProfilerSetThreadName(result, "Thread ", (u64)threadId, true); }
+	}
+	PigAtomicStoreRelease(&result->registered, 1);
+	return result;
+}
+
+//NOTE: Like Pig_ThisThreadTempArena these live in the engine dll so every thread binds itself again after a reload
+thread_local PigState_t* Pig_ThisThreadProfilerPig = nullptr;
+thread_local PigProfilerThread_t* Pig_ThisThreadProfiler = nullptr;
+
+PigProfilerThread_t* PigProfilerGetThisThread()
+{
+	if (Pig_ThisThreadProfilerPig != nullptr && Pig_ThisThreadProfilerPig == pig) { return Pig_ThisThreadProfiler; }
+	if (pig == nullptr || plat == nullptr || !pig->profiler.initialized) { return nullptr; }
+	Pig_ThisThreadProfiler = PigProfilerRegisterThread(&pig->profiler, plat->GetThisThreadId());
+	Pig_ThisThreadProfilerPig = pig;
+	return Pig_ThisThreadProfiler;
+}
+
+//Threads that the engine can't name on its own (audio, file watching, etc.) can call this once they are running
+void PigProfilerNameThread_(const char* name) //pre-declared in pig_func_defs.h
+{
+	NotNull(name);
+	PigProfilerThread_t* thread = PigProfilerGetThisThread();
+	if (thread == nullptr) { return; }
+	PigProfilerSetThreadName(thread, name, 0, false);
+}
+
+// +--------------------------------------------------------------+
+// |                          Recording                           |
+// +--------------------------------------------------------------+
+void PigProfilerBegin_(const char* name) //pre-declared in pig_func_defs.h
+{
+	PigProfilerThread_t* thread = PigProfilerGetThisThread();
+	if (thread == nullptr) { return; }
+	
+	//Once a zone is dropped everything nested inside it is dropped too, so the main thread never sees a begin without its end
+	u64 writeIndex = thread->writeIndex;
+	u64 readIndex = PigAtomicLoadAcquire(&thread->readIndex);
+	if (thread->droppedDepth > 0 ||
+		thread->recordedDepth >= PIG_PROFILER_MAX_DEPTH ||
+		//Always leave room for the end events of every zone that's already open, plus this one
+		(writeIndex - readIndex) + thread->recordedDepth + 2 > PIG_PROFILER_RING_SIZE)
+	{
+		thread->droppedDepth++;
+		thread->numDropped = thread->numDropped + 1;
+		return;
+	}
+	
+	PigProfilerEvent_t* event = &thread->events[writeIndex & (PIG_PROFILER_RING_SIZE-1)];
+	event->name = name;
+	event->time = GetPerfTime();
+	PigAtomicStoreRelease(&thread->writeIndex, writeIndex + 1);
+	thread->recordedDepth++;
+}
+
+void PigProfilerEnd_() //pre-declared in pig_func_defs.h
+{
+	PerfTime_t endTime = GetPerfTime();
+	PigProfilerThread_t* thread = PigProfilerGetThisThread();
+	if (thread == nullptr) { return; }
+	if (thread->droppedDepth > 0) { thread->droppedDepth--; return; }
+	if (thread->recordedDepth == 0) { return; } //unbalanced end, or the begin was recorded before the dll was reloaded
+	
+	u64 writeIndex = thread->writeIndex;
+	PigProfilerEvent_t* event = &thread->events[writeIndex & (PIG_PROFILER_RING_SIZE-1)];
+	event->name = nullptr;
+	event->time = endTime;
+	PigAtomicStoreRelease(&thread->writeIndex, writeIndex + 1);
+	thread->recordedDepth--;
+}
+
+// +--------------------------------------------------------------+
+// |                          Frame Tree                          |
+// +--------------------------------------------------------------+
+u64 PigProfilerAddNode(PigProfilerFrame_t* frame, u64 threadIndex, u64 parentIndex, const char* name)
+{
+	u64 result = frame->nodes.length;
+	PigProfilerNode_t* newNode = VarArrayAdd(&frame->nodes, PigProfilerNode_t);
+	NotNull(newNode);
+	ClearPointer(newNode);
+	newNode->name = name;
+	newNode->threadIndex = threadIndex;
+	newNode->parentIndex = parentIndex;
+	newNode->firstChildIndex = PIG_PROFILER_NO_NODE;
+	newNode->lastChildIndex = PIG_PROFILER_NO_NODE;
+	newNode->nextSiblingIndex = PIG_PROFILER_NO_NODE;
+	if (parentIndex != PIG_PROFILER_NO_NODE)
+	{
+		PigProfilerNode_t* parent = VarArrayGet(&frame->nodes, parentIndex, PigProfilerNode_t);
+		newNode->depth = parent->depth + 1;
+		if (parent->lastChildIndex != PIG_PROFILER_NO_NODE) { VarArrayGet(&frame->nodes, parent->lastChildIndex, PigProfilerNode_t)->nextSiblingIndex = result; }
+		else { parent->firstChildIndex = result; }
+		parent->lastChildIndex = result;
+	}
+	return result;
+}
+
+//Zones with the same name under the same parent are merged into one node (callCount tells how many there were)
+u64 PigProfilerFindOrAddChild(PigProfilerFrame_t* frame, u64 threadIndex, u64 parentIndex, const char* name)
+{
+	const PigProfilerNode_t* parent = VarArrayGet(&frame->nodes, parentIndex, PigProfilerNode_t);
+	u64 childIndex = parent->firstChildIndex;
+	while (childIndex != PIG_PROFILER_NO_NODE)
+	{
+		const PigProfilerNode_t* child = VarArrayGet(&frame->nodes, childIndex, PigProfilerNode_t);
+		if (child->name == name || StrEquals(NewStr(child->name), NewStr(name))) { return childIndex; }
+		childIndex = child->nextSiblingIndex;
+	}
+	return PigProfilerAddNode(frame, threadIndex, parentIndex, name);
+}
+
+u64 PigProfilerGetParentNode(PigProfiler_t* profiler, PigProfilerThread_t* thread, u64 threadIndex)
+{
+	if (thread->openDepth > 0) { return thread->openZones[thread->openDepth-1].nodeIndex; }
+	if (thread->rootNodeIndex == PIG_PROFILER_NO_NODE)
+	{
+		thread->rootNodeIndex = PigProfilerAddNode(&profiler->buildingFrame, threadIndex, PIG_PROFILER_NO_NODE, nullptr);
+	}
+	return thread->rootNodeIndex;
+}
+
+void PigProfilerOpenZone(PigProfiler_t* profiler, PigProfilerThread_t* thread, u64 threadIndex, const PigProfilerEvent_t* event)
+{
+	//The producer never lets the depth get past PIG_PROFILER_MAX_DEPTH
+	Assert(thread->openDepth < PIG_PROFILER_MAX_DEPTH);
+	u64 parentIndex = PigProfilerGetParentNode(profiler, thread, threadIndex);
+	u64 nodeIndex = PigProfilerFindOrAddChild(&profiler->buildingFrame, threadIndex, parentIndex, event->name);
+	VarArrayGet(&profiler->buildingFrame.nodes, nodeIndex, PigProfilerNode_t)->callCount++;
+	
+	PigProfilerOpenZone_t* openZone = &thread->openZones[thread->openDepth];
+	openZone->name = event->name;
+	openZone->beginTime = event->time;
+	openZone->frameBeginTime = event->time;
+	openZone->nodeIndex = nodeIndex;
+	thread->openDepth++;
+}
+
+void PigProfilerCloseZone(PigProfiler_t* profiler, PigProfilerThread_t* thread, u64 threadIndex, const PigProfilerEvent_t* event)
+{
+	if (thread->openDepth == 0) { return; }
+	thread->openDepth--;
+	PigProfilerOpenZone_t* openZone = &thread->openZones[thread->openDepth];
+	
+	r64 frameMs = GetPerfTimeDiff(&openZone->frameBeginTime, &event->time);
+	if (frameMs < 0) { frameMs = 0; }
+	PigProfilerNode_t* node = VarArrayGet(&profiler->buildingFrame.nodes, openZone->nodeIndex, PigProfilerNode_t);
+	node->totalMs += frameMs;
+	if (thread->openDepth == 0) { VarArrayGet(&profiler->buildingFrame.nodes, thread->rootNodeIndex, PigProfilerNode_t)->totalMs += frameMs; }
+	
+	if (profiler->capturing)
+	{
+		PigProfilerCaptureZone_t* zone = VarArrayAdd(&profiler->captureZones, PigProfilerCaptureZone_t);
+		NotNull(zone);
+		zone->name = openZone->name;
+		zone->threadIndex = threadIndex;
+		zone->beginMs = GetPerfTimeDiff(&profiler->startTime, &openZone->beginTime);
+		zone->durationMs = GetPerfTimeDiff(&openZone->beginTime, &event->time);
+	}
+}
+
+//Reads everything the thread has recorded so far into the building frame
+void PigProfilerDrainThread(PigProfiler_t* profiler, PigProfilerThread_t* thread, u64 threadIndex)
+{
+	u64 writeIndex = PigAtomicLoadAcquire(&thread->writeIndex);
+	for (u64 eIndex = thread->readIndex; eIndex < writeIndex; eIndex++)
+	{
+		const PigProfilerEvent_t* event = &thread->events[eIndex & (PIG_PROFILER_RING_SIZE-1)];
+		if (event->name != nullptr) { PigProfilerOpenZone(profiler, thread, threadIndex, event); }
+		else { PigProfilerCloseZone(profiler, thread, threadIndex, event); }
+	}
+	PigAtomicStoreRelease(&thread->readIndex, writeIndex);
+}
+
+void PigProfilerWriteCapture(PigProfiler_t* profiler);
+
+//NOTE: Called at the very top of PigUpdate, before the main thread opens any zones for the new frame
+void UpdatePigProfilerBefore(PigProfiler_t* profiler)
+{
+	NotNull(profiler);
+	if (!profiler->initialized) { return; }
+	PerfTime_t frameEndTime = GetPerfTime();
+	u64 numThreads = PigProfilerGetNumThreads(profiler);
+	
+	for (u64 tIndex = 0; tIndex < numThreads; tIndex++)
+	{
+		PigProfilerThread_t* thread = &profiler->threads[tIndex];
+		if (PigAtomicLoadAcquire(&thread->registered) == 0) { continue; }
+		PigProfilerDrainThread(profiler, thread, tIndex);
+		
+		//Zones that are still open (a long task, or a frame boundary on another thread) count the part that fell in this frame
+		for (u64 dIndex = 0; dIndex < thread->openDepth; dIndex++)
+		{
+			PigProfilerOpenZone_t* openZone = &thread->openZones[dIndex];
+			r64 frameMs = GetPerfTimeDiff(&openZone->frameBeginTime, &frameEndTime);
+			if (frameMs < 0) { frameMs = 0; }
+			VarArrayGet(&profiler->buildingFrame.nodes, openZone->nodeIndex, PigProfilerNode_t)->totalMs += frameMs;
+			if (dIndex == 0) { VarArrayGet(&profiler->buildingFrame.nodes, thread->rootNodeIndex, PigProfilerNode_t)->totalMs += frameMs; }
+		}
+	}
+	
+	profiler->buildingFrame.frameMs = GetPerfTimeDiff(&profiler->frameStartTime, &frameEndTime);
+	PigProfilerFrame_t finishedFrame = profiler->buildingFrame;
+	profiler->buildingFrame = profiler->lastFrame;
+	profiler->lastFrame = finishedFrame;
+	VarArrayClear(&profiler->buildingFrame.nodes);
+	profiler->buildingFrame.frameIndex = profiler->lastFrame.frameIndex + 1;
+	profiler->buildingFrame.frameMs = 0;
+	profiler->frameStartTime = frameEndTime;
+	
+	//Recreate the path of every zone that's still open in the new frame (without counting them as new calls)
+	for (u64 tIndex = 0; tIndex < numThreads; tIndex++)
+	{
+		PigProfilerThread_t* thread = &profiler->threads[tIndex];
+		thread->rootNodeIndex = PIG_PROFILER_NO_NODE;
+		u64 openDepth = thread->openDepth;
+		thread->openDepth = 0;
+		for (u64 dIndex = 0; dIndex < openDepth; dIndex++)
+		{
+			PigProfilerOpenZone_t* openZone = &thread->openZones[dIndex];
+			u64 parentIndex = PigProfilerGetParentNode(profiler, thread, tIndex);
+			openZone->nodeIndex = PigProfilerFindOrAddChild(&profiler->buildingFrame, tIndex, parentIndex, openZone->name);
+			openZone->frameBeginTime = frameEndTime;
+			thread->openDepth++;
+		}
+	}
+	
+	if (profiler->capturing)
+	{
+		if (profiler->captureFramesLeft > 0) { profiler->captureFramesLeft--; }
+		if (profiler->captureFramesLeft == 0) { PigProfilerWriteCapture(profiler); }
+	}
+}
+
+//NOTE: Every name we have recorded points into the old dll, so anything that hasn't been read yet is thrown away
+void PigProfilerHandleReload(PigProfiler_t* profiler)
+{
+	NotNull(profiler);
+	if (!profiler->initialized) { return; }
+	u64 numThreads = PigProfilerGetNumThreads(profiler);
+	for (u64 tIndex = 0; tIndex < numThreads; tIndex++)
+	{
+		PigProfilerThread_t* thread = &profiler->threads[tIndex];
+		if (PigAtomicLoadAcquire(&thread->registered) == 0) { continue; }
+		PigAtomicStoreRelease(&thread->readIndex, PigAtomicLoadAcquire(&thread->writeIndex));
+		thread->openDepth = 0;
+		thread->rootNodeIndex = PIG_PROFILER_NO_NODE;
+	}
+	VarArrayClear(&profiler->buildingFrame.nodes);
+	VarArrayClear(&profiler->lastFrame.nodes);
+	if (profiler->capturing)
+	{
+		PrintLine_W("Profiler capture to \"%.*s\" was cancelled by the dll reload", StrPrint(profiler->captureFilePath));
+		VarArrayClear(&profiler->captureZones);
+		FreeString(profiler->allocArena, &profiler->captureFilePath);
+		profiler->capturing = false;
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                        Chrome Trace                          |
+// +--------------------------------------------------------------+
+void PigProfilerAppendJsonStr(StringBuilder_t* builder, const char* str)
+{
+	StringBuilderAppendChar(builder, '"');
+	for (u64 cIndex = 0; str[cIndex] != '\0'; cIndex++)
+	{
+		char c = str[cIndex];
+		if (c == '"' || c == '\\') { StringBuilderAppendChar(builder, '\\'); StringBuilderAppendChar(builder, c); }
+		else if ((u8)c < 0x20) { StringBuilderAppendPrint(builder, "\\u%04X", (u32)(u8)c); }
+		else { StringBuilderAppendChar(builder, c); }
+	}
+	StringBuilderAppendChar(builder, '"');
+}
+
+bool StartPigProfilerCapture(PigProfiler_t* profiler, MyStr_t filePath, u64 numFrames)
+{
+	NotNull(profiler);
+	NotNullStr(&filePath);
+	if (!profiler->initialized || profiler->capturing || numFrames == 0) { return false; }
+	profiler->captureFilePath = AllocString(profiler->allocArena, &filePath);
+	profiler->captureNumFrames = numFrames;
+	profiler->captureFramesLeft = numFrames;
+	VarArrayClear(&profiler->captureZones);
+	profiler->capturing = true;
+	return true;
+}
+
+//Writes the trace event format: https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+void PigProfilerWriteCapture(PigProfiler_t* profiler)
+{
+	NotNull(profiler);
+	Assert(profiler->capturing);
+	profiler->capturing = false;
+	
+	MemArena_t traceArena;
+	InitMemArena_PagedHeapFuncs(&traceArena, Megabytes(1), PlatAllocFunc, PlatFreeFunc);
+	StringBuilder_t builder;
+	NewStringBuilder(&builder, &traceArena, 64 + profiler->captureZones.length * 96);
+	StringBuilderAppend(&builder, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+	bool isFirstEvent = true;
+	u64 numThreads = PigProfilerGetNumThreads(profiler);
+	for (u64 tIndex = 0; tIndex < numThreads; tIndex++)
+	{
+		const PigProfilerThread_t* thread = &profiler->threads[tIndex];
+		if (PigAtomicLoadAcquire(&thread->registered) == 0) { continue; }
+		if (!isFirstEvent) { StringBuilderAppendChar(&builder, ','); }
+		isFirstEvent = false;
+		StringBuilderAppendPrint(&builder, "\n{\"ph\":\"M\",\"pid\":1,\"tid\":%llu,\"name\":\"thread_name\",\"args\":{\"name\":", tIndex);
+		PigProfilerAppendJsonStr(&builder, &thread->name[0]);
+		StringBuilderAppend(&builder, "}}");
+	}
+	VarArrayLoop(&profiler->captureZones, zIndex)
+	{
+		VarArrayLoopGet(PigProfilerCaptureZone_t, zone, &profiler->captureZones, zIndex);
+		if (!isFirstEvent) { StringBuilderAppendChar(&builder, ','); }
+		isFirstEvent = false;
+		StringBuilderAppend(&builder, "\n{\"ph\":\"X\",\"pid\":1,\"name\":");
+		PigProfilerAppendJsonStr(&builder, zone->name);
+		StringBuilderAppendPrint(&builder, ",\"tid\":%llu,\"ts\":%.3lf,\"dur\":%.3lf}", zone->threadIndex, zone->beginMs * 1000.0, zone->durationMs * 1000.0);
+	}
+	StringBuilderAppend(&builder, "\n]}\n");
+	
+	MyStr_t traceStr = ToMyStr(&builder);
+	if (plat->WriteEntireFile(profiler->captureFilePath, traceStr.chars, traceStr.length))
+	{
+		PrintLine_I("Wrote %llu profiler zone%s over %llu frame%s (%s) to \"%.*s\"", profiler->captureZones.length, Plural(profiler->captureZones.length, "s"), profiler->captureNumFrames, Plural(profiler->captureNumFrames, "s"), FormatBytesNt(traceStr.length, TempArena), StrPrint(profiler->captureFilePath));
+	}
+	else
+	{
+		PrintLine_E("Failed to write profiler capture to \"%.*s\"", StrPrint(profiler->captureFilePath));
+	}
+	
+	FreeMemArena(&traceArena);
+	VarArrayClear(&profiler->captureZones);
+	FreeString(profiler->allocArena, &profiler->captureFilePath);
+}
+
+// +--------------------------------------------------------------+
+// |                            Render                            |
+// +--------------------------------------------------------------+
+//Returns the number of lines used. Nothing is drawn when drawRec is nullptr, we only measure the widest name column
+u64 PigProfilerOverlayNode(const PigProfiler_t* profiler, u64 nodeIndex, u64 lineIndex, const rec* drawRec, r32 nameColumnWidth, r32 msColumnWidth, r32* maxNameWidthOut)
+{
+	const PigProfilerFrame_t* frame = &profiler->lastFrame;
+	const PigProfilerNode_t* node = VarArrayGet(&frame->nodes, nodeIndex, PigProfilerNode_t);
+	if (lineIndex >= PIG_PROFILER_OVERLAY_MAX_LINES) { return 0; }
+	
+	const PigProfilerThread_t* thread = &profiler->threads[node->threadIndex];
+	const char* displayName = (node->name != nullptr) ? node->name : &thread->name[0];
+	r32 indent = (r32)(node->depth * PIG_PROFILER_OVERLAY_INDENT);
+	if (drawRec == nullptr)
+	{
+		r32 nameWidth = indent + RcMeasureText(displayName).size.width;
+		if (nameWidth > *maxNameWidthOut) { *maxNameWidthOut = nameWidth; }
+	}
+	else
+	{
+		v2 textPos = NewVec2(drawRec->x + PIG_PROFILER_OVERLAY_PADDING, drawRec->y + PIG_PROFILER_OVERLAY_PADDING + (r32)lineIndex * RcGetLineHeight() + RcGetMaxAscend());
+		Vec2Align(&textPos);
+		Color_t nameColor = (node->name != nullptr) ? MonokaiWhite : MonokaiGreen;
+		Color_t msColor = (node->totalMs >= 1.0) ? MonokaiYellow : MonokaiWhite;
+		RcDrawText(displayName, textPos + NewVec2(indent, 0), nameColor);
+		RcDrawTextPrintEx(textPos + NewVec2(nameColumnWidth + msColumnWidth, 0), msColor, TextAlignment_Right, 0, "%.2lfms", node->totalMs);
+		if (node->name != nullptr) { RcDrawTextPrint(textPos + NewVec2(nameColumnWidth + msColumnWidth + PIG_PROFILER_OVERLAY_COLUMN_GAP, 0), MonokaiGray1, "x%llu", node->callCount); }
+		else if (thread->numDropped > 0) { RcDrawTextPrint(textPos + NewVec2(nameColumnWidth + msColumnWidth + PIG_PROFILER_OVERLAY_COLUMN_GAP, 0), MonokaiRed, "%llu dropped", thread->numDropped); }
+	}
+	
+	u64 numLines = 1;
+	u64 childIndex = node->firstChildIndex;
+	while (childIndex != PIG_PROFILER_NO_NODE)
+	{
+		numLines += PigProfilerOverlayNode(profiler, childIndex, lineIndex + numLines, drawRec, nameColumnWidth, msColumnWidth, maxNameWidthOut);
+		childIndex = VarArrayGet(&frame->nodes, childIndex, PigProfilerNode_t)->nextSiblingIndex;
+	}
+	return numLines;
+}
+
+void RenderPigProfiler(PigProfiler_t* profiler)
+{
+	NotNull(profiler);
+	if (!profiler->initialized || !profiler->showOverlay) { return; }
+	RcBindShader(&pig->resources.shaders->main2D);
+	RcBindFont(&pig->resources.fonts->debug, SelectFontFace(12));
+	
+	const PigProfilerFrame_t* frame = &profiler->lastFrame;
+	r32 maxNameWidth = RcMeasureText("Frame 000000").size.width;
+	u64 numLines = 1;
+	VarArrayLoop(&frame->nodes, nIndex)
+	{
+		VarArrayLoopGet(PigProfilerNode_t, node, &frame->nodes, nIndex);
+		if (node->parentIndex == PIG_PROFILER_NO_NODE) { numLines += PigProfilerOverlayNode(profiler, nIndex, numLines, nullptr, 0, 0, &maxNameWidth); }
+	}
+	if (numLines > PIG_PROFILER_OVERLAY_MAX_LINES) { numLines = PIG_PROFILER_OVERLAY_MAX_LINES; }
+	
+	r32 nameColumnWidth = maxNameWidth + PIG_PROFILER_OVERLAY_COLUMN_GAP;
+	r32 msColumnWidth = RcMeasureText("000.00ms").size.width;
+	r32 countColumnWidth = PIG_PROFILER_OVERLAY_COLUMN_GAP + RcMeasureText("0000 dropped").size.width;
+	rec mainRec;
+	mainRec.width = PIG_PROFILER_OVERLAY_PADDING*2 + nameColumnWidth + msColumnWidth + countColumnWidth;
+	mainRec.height = PIG_PROFILER_OVERLAY_PADDING*2 + (r32)numLines * RcGetLineHeight();
+	mainRec.x = ScreenSize.width - 10 - mainRec.width;
+	mainRec.y = 10;
+	RecAlign(&mainRec);
+	RcDrawRectangle(mainRec, ColorTransparent(MonokaiDarkGray, 0.75f));
+	RcDrawRectangleOutline(mainRec, MonokaiGray1, 1, true);
+	
+	v2 headerPos = NewVec2(mainRec.x + PIG_PROFILER_OVERLAY_PADDING, mainRec.y + PIG_PROFILER_OVERLAY_PADDING + RcGetMaxAscend());
+	Vec2Align(&headerPos);
+	RcDrawTextPrint(headerPos, MonokaiLightGray, "Frame %llu", frame->frameIndex);
+	RcDrawTextPrintEx(headerPos + NewVec2(nameColumnWidth + msColumnWidth, 0), MonokaiLightGray, TextAlignment_Right, 0, "%.2lfms", frame->frameMs);
+	
+	u64 lineIndex = 1;
+	VarArrayLoop(&frame->nodes, nIndex)
+	{
+		VarArrayLoopGet(PigProfilerNode_t, node, &frame->nodes, nIndex);
+		if (node->parentIndex == PIG_PROFILER_NO_NODE) { lineIndex += PigProfilerOverlayNode(profiler, nIndex, lineIndex, &mainRec, nameColumnWidth, msColumnWidth, &maxNameWidth); }
+	}
+}
+
+#endif //PIG_PROFILER
@@ -0,0 +1,106 @@
+/*
+File:   pig_profiler.h
+Date:   10\19\2026
+Description:
+	** The profiler records nestable named zones (PigProfileBegin/PigProfileEnd) from any thread. Each thread writes
+	** begin/end events into its own single-producer/single-consumer ring buffer so recording never takes a lock.
+	** Once per frame the main thread drains every buffer into a tree of zones (merged by name under the same parent)
+	** that the debug overlay displays, and optionally into a list of zones that get written out as a Chrome trace
+	** (chrome://tracing or ui.perfetto.dev) by the profiler_capture debug command
+*/
+
+#ifndef _PIG_PROFILER_H
+#define _PIG_PROFILER_H
+
+#define PIG_PROFILER_MAX_THREADS        32
+#define PIG_PROFILER_RING_SIZE          16384 //events per thread, must be a power of 2
+#define PIG_PROFILER_MAX_DEPTH          32 //nested zones per thread, anything deeper is dropped
+#define PIG_PROFILER_THREAD_NAME_SIZE   32 //chars
+#define PIG_PROFILER_NO_NODE            UINT64_MAX
+
+struct PigProfilerEvent_t
+{
+	PerfTime_t time;
+	const char* name; //nullptr for an end event. Must be a string literal (or otherwise live until the dll is reloaded)
+};
+
+struct PigProfilerOpenZone_t
+{
+	const char* name;
+	PerfTime_t beginTime;
+	PerfTime_t frameBeginTime; //beginTime, or the start of the frame for zones that are carried over from a previous frame
+	u64 nodeIndex;
+};
+
+struct PigProfilerThread_t
+{
+	volatile u64 registered; //set last (with release) so the main thread never reads a half filled slot
+	ThreadId_t threadId;
+	char name[PIG_PROFILER_THREAD_NAME_SIZE];
+	PigProfilerEvent_t* events; //PIG_PROFILER_RING_SIZE
+	
+	//Written only by the owning thread
+	volatile u64 writeIndex;
+	volatile u64 numDropped;
+	u64 recordedDepth;
+	u64 droppedDepth;
+	
+	//Written only by the main thread
+	volatile u64 readIndex;
+	u64 openDepth;
+	PigProfilerOpenZone_t openZones[PIG_PROFILER_MAX_DEPTH];
+	u64 rootNodeIndex; //in the building frame
+};
+
+struct PigProfilerNode_t
+{
+	const char* name;
+	u64 threadIndex;
+	u64 depth;
+	u64 parentIndex;
+	u64 firstChildIndex;
+	u64 lastChildIndex;
+	u64 nextSiblingIndex;
+	
+	u64 callCount;
+	r64 totalMs;
+};
+
+struct PigProfilerFrame_t
+{
+	u64 frameIndex;
+	r64 frameMs;
+	VarArray_t nodes; //PigProfilerNode_t, roots (one per thread that recorded something) have depth 0 and a nullptr name
+};
+
+struct PigProfilerCaptureZone_t
+{
+	const char* name;
+	u64 threadIndex;
+	r64 beginMs; //relative to PigProfiler_t startTime
+	r64 durationMs;
+};
+
+struct PigProfiler_t
+{
+	bool initialized;
+	bool showOverlay;
+	MemArena_t* allocArena; //frames and captures, only touched by the main thread
+	MemArena_t* bufferArena; //must be thread safe, ring buffers are allocated by the thread that registers
+	PerfTime_t startTime;
+	
+	volatile u64 numThreads;
+	PigProfilerThread_t threads[PIG_PROFILER_MAX_THREADS];
+	
+	PerfTime_t frameStartTime;
+	PigProfilerFrame_t buildingFrame;
+	PigProfilerFrame_t lastFrame;
+	
+	bool capturing;
+	u64 captureFramesLeft;
+	u64 captureNumFrames;
+	MyStr_t captureFilePath;
+	VarArray_t captureZones; //PigProfilerCaptureZone_t
+};
+
+#endif //  _PIG_PROFILER_H
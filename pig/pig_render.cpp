@@ -684,8 +684,61 @@ void RcBegin_OpenGL()
 	// glAlphaFunc(GL_GEQUAL, 0.01f); AssertNoOpenGlError();
 	// glEnable(GL_ALPHA_TEST); AssertNoOpenGlError();
 	RcSetFaceCulling_OpenGL(true);
-	
-	
+
+
+}
+
+void RcExecuteCommand_OpenGL(const RenderCmd_t* cmd)
+{
+	NotNull(cmd);
+	const RenderCmdPayload_t* payload = &cmd->payload;
+	switch (cmd->type)
+	{
+		case RenderCmdType_SetFaceCulling:            RcSetFaceCulling_OpenGL(payload->enabled); break;
+		case RenderCmdType_SetDepthTestEnabled:       RcSetDepthTestEnabled_OpenGL(payload->enabled); break;
+		case RenderCmdType_SetFillMode:               RcSetFillMode_OpenGL(payload->fillMode); break;
+		case RenderCmdType_BindFrameBuffer:           RcBindFrameBuffer_OpenGL(payload->frameBuffer); break;
+		case RenderCmdType_BindShader:                RcBindShader_OpenGL(payload->shader); break;
+		case RenderCmdType_BindVao:                   RcBindVertexArrayObject_OpenGL(payload->vao); break;
+		case RenderCmdType_BindTexture1:              RcBindTexture1_OpenGL(payload->texture); break;
+		case RenderCmdType_BindTexture2:              RcBindTexture2_OpenGL(payload->texture); break;
+		case RenderCmdType_BindVertBuffer:            RcBindVertBuffer_OpenGL(payload->vertBuffer); break;
+		case RenderCmdType_SetViewport:               RcSetViewport_OpenGL(payload->rectangle); break;
+		case RenderCmdType_SetWorldMatrix:            RcSetWorldMatrix_OpenGL(payload->matrix); break;
+		case RenderCmdType_SetViewMatrix:             RcSetViewMatrix_OpenGL(payload->matrix); break;
+		case RenderCmdType_SetProjectionMatrix:       RcSetProjectionMatrix_OpenGL(payload->matrix); break;
+		case RenderCmdType_SetCameraPosition:         RcSetCameraPosition_OpenGL(payload->vec3); break;
+		case RenderCmdType_SetPlayerPosition:         RcSetPlayerPosition_OpenGL(payload->vec3); break;
+		case RenderCmdType_SetColor1:                 RcSetColor1_OpenGL(payload->colorf); break;
+		case RenderCmdType_SetColor2:                 RcSetColor2_OpenGL(payload->colorf); break;
+		case RenderCmdType_SetScreenSpaceEffectColor: RcSetScreenSpaceEffectColor_OpenGL(payload->colorf); break;
+		case RenderCmdType_SetSourceRec1:             RcSetSourceRec1_OpenGL(payload->sourceRec.rectangle, payload->sourceRec.flipped, payload->sourceRec.textureHeight); break;
+		case RenderCmdType_SetSourceRec2:             RcSetSourceRec2_OpenGL(payload->sourceRec.rectangle, payload->sourceRec.flipped, payload->sourceRec.textureHeight); break;
+		case RenderCmdType_SetShiftVec:               RcSetShiftVec_OpenGL(payload->vec2); break;
+		case RenderCmdType_SetCount:                  RcSetCount_OpenGL(payload->intValue); break;
+		case RenderCmdType_SetCircleRadius:           RcSetCircleRadius_OpenGL(payload->floatValue); break;
+		case RenderCmdType_SetCircleInnerRadius:      RcSetCircleInnerRadius_OpenGL(payload->floatValue); break;
+		case RenderCmdType_SetTime:                   RcSetTime_OpenGL(payload->floatValue); break;
+		case RenderCmdType_SetSaturation:             RcSetSaturation_OpenGL(payload->floatValue); break;
+		case RenderCmdType_SetBrightness:             RcSetBrightness_OpenGL(payload->floatValue); break;
+		case RenderCmdType_SetPolygonPlanes:          RcSetPolygonPlanes_OpenGL(&payload->polygonPlanes[0]); break;
+		case RenderCmdType_SetValue:                  RcSetValue_OpenGL(payload->value.index, payload->value.value); break;
+		case RenderCmdType_SetDynamicUniformR32:      RcSetDynamicUniformR32_OpenGL(payload->dynamic.uniform, payload->dynamic.r32Value); break;
+		case RenderCmdType_SetDynamicUniformVec2:     RcSetDynamicUniformVec2_OpenGL(payload->dynamic.uniform, payload->dynamic.vec2Value); break;
+		case RenderCmdType_SetDynamicUniformVec3:     RcSetDynamicUniformVec3_OpenGL(payload->dynamic.uniform, payload->dynamic.vec3Value); break;
+		case RenderCmdType_SetDynamicUniformVec4:     RcSetDynamicUniformVec4_OpenGL(payload->dynamic.uniform, payload->dynamic.vec4Value); break;
+		case RenderCmdType_SetDynamicUniformMat4:     RcSetDynamicUniformMat4_OpenGL(payload->dynamic.uniform, payload->dynamic.mat4Value); break;
+		case RenderCmdType_ClearColor:                RcClearColor_OpenGL(payload->color); break;
+		case RenderCmdType_ClearDepth:                RcClearDepth_OpenGL(payload->floatValue); break;
+		case RenderCmdType_ClearStencil:              RcClearStencil_OpenGL(payload->intValue); break;
+		case RenderCmdType_DrawBuffer:                RcDrawBuffer_OpenGL(payload->draw.primitive, payload->draw.startIndex, payload->draw.numElements, payload->draw.vertexOffset); break;
+		case RenderCmdType_StartStencilDrawing:       RcStartStencilDrawing_OpenGL(); break;
+		case RenderCmdType_SetStencilPolarity:        RcSetStencilPolarity_OpenGL(payload->enabled); break;
+		case RenderCmdType_UseStencil:                RcUseStencil_OpenGL(payload->enabled); break;
+		case RenderCmdType_DisableStencil:            RcDisableStencil_OpenGL(); break;
+		case RenderCmdType_Begin:                     RcBegin_OpenGL(); break;
+		default: DebugAssertMsg(false, "Unhandled RenderCmdType_t in RcExecuteCommand_OpenGL!"); break;
+	}
 }
 
 #endif //OPENGL_SUPPORTED
@@ -693,64 +746,223 @@ void RcBegin_OpenGL()
 // +--------------------------------------------------------------+
 // |                         General API                          |
 // +--------------------------------------------------------------+
+//Defined in pig_render_funcs_3d.cpp. Anything that changes what queued models would be drawn with has to flush them first
+void RcFlushModelQueue();
+
 void InitRenderContext()
 {
 	NotNull(rc);
 	CreateVarArray(&rc->vertexArrayObjs, fixedHeap, sizeof(VertexArrayObject_t));
+	InitTextLayoutCache(&rc->textLayoutCache, mainHeap);
+	InitRenderCmdBuffer(&rc->cmdBuffer, mainHeap);
+	rc->cmdBackend = pig->renderApi;
+	rc->filterUniforms = true;
+	rc->uniformShadowStamp = 1;
+	rc->modelCulling = true;
+	CreateVarArray(&rc->modelQueue, mainHeap, sizeof(RcQueuedModel_t));
 }
 
-void RcSetFaceCulling(bool enabled)
+// +==============================+
+// |      Command Submission      |
+// +==============================+
+//NOTE: Every Rc function below goes through RcSubmitCommand rather than calling the API specific functions
+//      directly so the command stream always matches what the backend was asked to do
+void RcExecuteCommand(const RenderCmd_t* cmd, RenderApi_t renderApi)
 {
 	NotNull(rc);
-	
-	switch (pig->renderApi)
+	NotNull(cmd);
+	switch (renderApi)
 	{
 		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetFaceCulling_OpenGL(enabled);
-			rc->state.faceCulling = enabled;
-		} break;
+		case RenderApi_OpenGL: RcExecuteCommand_OpenGL(cmd); break;
 		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetFaceCulling!"); break;
+		case RenderApi_None: break; //the null backend does no work, the command was already counted when it was pushed
+		default: DebugAssertMsg(false, "Unsupported render API in RcExecuteCommand!"); break;
+	}
+	
+	//The backends look at these to know what they are working with, so they have to follow the stream even during a replay
+	switch (cmd->type)
+	{
+		case RenderCmdType_BindShader:     rc->state.boundShader = cmd->payload.shader; break;
+		case RenderCmdType_BindVao:        rc->state.boundVao = cmd->payload.vao; break;
+		case RenderCmdType_BindVertBuffer: rc->state.boundBuffer = cmd->payload.vertBuffer; break;
 	}
 }
 
-void RcSetDepthTestEnabled(bool enabled)
+void RcSubmitCommand(const RenderCmd_t* cmd)
 {
 	NotNull(rc);
-	
-	switch (pig->renderApi)
+	if (rc->filterUniforms && rc->state.boundShader != nullptr && RenderCmdUpdateUniformShadow(rc->state.boundShader, cmd, rc->uniformShadowStamp))
 	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetDepthTestEnabled_OpenGL(enabled);
-			rc->state.depthTestEnabled = enabled;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetDepthTestEnabled!"); break;
+		RenderCmdBufferCountFiltered(&rc->cmdBuffer, cmd);
+		return;
 	}
+	RenderCmdBufferPush(&rc->cmdBuffer, cmd);
+	RcExecuteCommand(cmd, rc->cmdBackend);
 }
 
-void RcSetFillMode(PolygonFillMode_t fillMode)
+RenderCmd_t NewRenderCmd(RenderCmdType_t cmdType)
+{
+	RenderCmd_t result;
+	ClearStruct(result); //padding bytes take part in the redundant command comparison
+	result.type = cmdType;
+	return result;
+}
+
+void RcCmdSetFaceCulling(bool enabled)                        { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetFaceCulling);            cmd.payload.enabled = enabled;                    RcSubmitCommand(&cmd); }
+void RcCmdSetDepthTestEnabled(bool enabled)                   { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetDepthTestEnabled);       cmd.payload.enabled = enabled;                    RcSubmitCommand(&cmd); }
+void RcCmdSetFillMode(PolygonFillMode_t fillMode)             { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetFillMode);               cmd.payload.fillMode = fillMode;                  RcSubmitCommand(&cmd); }
+void RcCmdBindFrameBuffer(FrameBuffer_t* buffer)              { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_BindFrameBuffer);           cmd.payload.frameBuffer = buffer;                 RcSubmitCommand(&cmd); }
+void RcCmdBindShader(Shader_t* shader)                        { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_BindShader);                cmd.payload.shader = shader;                      RcSubmitCommand(&cmd); }
+void RcCmdBindVertexArrayObject(VertexArrayObject_t* vao)     { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_BindVao);                   cmd.payload.vao = vao;                            RcSubmitCommand(&cmd); }
+void RcCmdBindTexture1(Texture_t* texture)                    { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_BindTexture1);              cmd.payload.texture = texture;                    RcSubmitCommand(&cmd); }
+void RcCmdBindTexture2(Texture_t* texture)                    { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_BindTexture2);              cmd.payload.texture = texture;                    RcSubmitCommand(&cmd); }
+void RcCmdBindVertBuffer(const VertBuffer_t* buffer)          { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_BindVertBuffer);            cmd.payload.vertBuffer = buffer;                  RcSubmitCommand(&cmd); }
+void RcCmdSetViewport(rec viewportRec)                        { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetViewport);               cmd.payload.rectangle = viewportRec;              RcSubmitCommand(&cmd); }
+void RcCmdSetWorldMatrix(mat4 matrix)                         { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetWorldMatrix);            cmd.payload.matrix = matrix;                      RcSubmitCommand(&cmd); }
+void RcCmdSetViewMatrix(mat4 matrix)                          { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetViewMatrix);             cmd.payload.matrix = matrix;                      RcSubmitCommand(&cmd); }
+void RcCmdSetProjectionMatrix(mat4 matrix)                    { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetProjectionMatrix);       cmd.payload.matrix = matrix;                      RcSubmitCommand(&cmd); }
+void RcCmdSetCameraPosition(v3 cameraPos)                     { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetCameraPosition);         cmd.payload.vec3 = cameraPos;                     RcSubmitCommand(&cmd); }
+void RcCmdSetPlayerPosition(v3 playerPos)                     { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetPlayerPosition);         cmd.payload.vec3 = playerPos;                     RcSubmitCommand(&cmd); }
+void RcCmdSetColor1(Colorf_t colorf)                          { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetColor1);                 cmd.payload.colorf = colorf;                      RcSubmitCommand(&cmd); }
+void RcCmdSetColor2(Colorf_t colorf)                          { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetColor2);                 cmd.payload.colorf = colorf;                      RcSubmitCommand(&cmd); }
+void RcCmdSetScreenSpaceEffectColor(Colorf_t colorf)          { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetScreenSpaceEffectColor); cmd.payload.colorf = colorf;                      RcSubmitCommand(&cmd); }
+void RcCmdSetShiftVec(v2 shiftVec)                            { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetShiftVec);               cmd.payload.vec2 = shiftVec;                      RcSubmitCommand(&cmd); }
+void RcCmdSetCount(i32 count)                                 { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetCount);                  cmd.payload.intValue = count;                     RcSubmitCommand(&cmd); }
+void RcCmdSetCircleRadius(r32 radius)                         { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetCircleRadius);           cmd.payload.floatValue = radius;                  RcSubmitCommand(&cmd); }
+void RcCmdSetCircleInnerRadius(r32 innerRadius)               { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetCircleInnerRadius);      cmd.payload.floatValue = innerRadius;             RcSubmitCommand(&cmd); }
+void RcCmdSetTime(r32 time)                                   { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetTime);                   cmd.payload.floatValue = time;                    RcSubmitCommand(&cmd); }
+void RcCmdSetSaturation(r32 saturation)                       { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetSaturation);             cmd.payload.floatValue = saturation;              RcSubmitCommand(&cmd); }
+void RcCmdSetBrightness(r32 brightness)                       { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetBrightness);             cmd.payload.floatValue = brightness;              RcSubmitCommand(&cmd); }
+void RcCmdClearColor(Color_t color)                           { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_ClearColor);                cmd.payload.color = color;                        RcSubmitCommand(&cmd); }
+void RcCmdClearDepth(r32 depth)                               { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_ClearDepth);                cmd.payload.floatValue = depth;                   RcSubmitCommand(&cmd); }
+void RcCmdClearStencil(i32 stencilValue)                      { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_ClearStencil);              cmd.payload.intValue = stencilValue;              RcSubmitCommand(&cmd); }
+void RcCmdSetStencilPolarity(bool writePositiveValues)        { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetStencilPolarity);        cmd.payload.enabled = writePositiveValues;        RcSubmitCommand(&cmd); }
+void RcCmdUseStencil(bool inverseMask)                        { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_UseStencil);                cmd.payload.enabled = inverseMask;                RcSubmitCommand(&cmd); }
+void RcCmdStartStencilDrawing()                               { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_StartStencilDrawing);                                                         RcSubmitCommand(&cmd); }
+void RcCmdDisableStencil()                                    { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_DisableStencil);                                                              RcSubmitCommand(&cmd); }
+void RcCmdBegin()                                             { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_Begin);                                                                       RcSubmitCommand(&cmd); }
+void RcCmdSetDynamicUniformR32(ShaderDynamicUniform_t* uniform, r32 value)  { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetDynamicUniformR32);  cmd.payload.dynamic.uniform = uniform; cmd.payload.dynamic.r32Value = value;  RcSubmitCommand(&cmd); }
+void RcCmdSetDynamicUniformVec2(ShaderDynamicUniform_t* uniform, v2 value)  { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetDynamicUniformVec2); cmd.payload.dynamic.uniform = uniform; cmd.payload.dynamic.vec2Value = value; RcSubmitCommand(&cmd); }
+void RcCmdSetDynamicUniformVec3(ShaderDynamicUniform_t* uniform, v3 value)  { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetDynamicUniformVec3); cmd.payload.dynamic.uniform = uniform; cmd.payload.dynamic.vec3Value = value; RcSubmitCommand(&cmd); }
+void RcCmdSetDynamicUniformVec4(ShaderDynamicUniform_t* uniform, v4 value)  { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetDynamicUniformVec4); cmd.payload.dynamic.uniform = uniform; cmd.payload.dynamic.vec4Value = value; RcSubmitCommand(&cmd); }
+void RcCmdSetDynamicUniformMat4(ShaderDynamicUniform_t* uniform, mat4 value) { RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetDynamicUniformMat4); cmd.payload.dynamic.uniform = uniform; cmd.payload.dynamic.mat4Value = value; RcSubmitCommand(&cmd); }
+void RcCmdSetSourceRec1(rec rectangle, bool flipped, r32 textureHeight)
+{
+	RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetSourceRec1);
+	cmd.payload.sourceRec.rectangle = rectangle;
+	cmd.payload.sourceRec.flipped = flipped;
+	cmd.payload.sourceRec.textureHeight = textureHeight;
+	RcSubmitCommand(&cmd);
+}
+void RcCmdSetSourceRec2(rec rectangle, bool flipped, r32 textureHeight)
+{
+	RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetSourceRec2);
+	cmd.payload.sourceRec.rectangle = rectangle;
+	cmd.payload.sourceRec.flipped = flipped;
+	cmd.payload.sourceRec.textureHeight = textureHeight;
+	RcSubmitCommand(&cmd);
+}
+void RcCmdSetPolygonPlanes(const v2* planeValues)
+{
+	NotNull(planeValues);
+	RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetPolygonPlanes);
+	MyMemCopy(&cmd.payload.polygonPlanes[0], planeValues, sizeof(cmd.payload.polygonPlanes));
+	RcSubmitCommand(&cmd);
+}
+void RcCmdSetValue(u8 valueIndex, r32 value)
+{
+	RenderCmd_t cmd = NewRenderCmd(RenderCmdType_SetValue);
+	cmd.payload.value.index = valueIndex;
+	cmd.payload.value.value = value;
+	RcSubmitCommand(&cmd);
+}
+void RcCmdDrawBuffer(VertBufferPrimitive_t primitive, u64 startIndex, u64 numElements, u64 vertexOffset)
+{
+	RenderCmd_t cmd = NewRenderCmd(RenderCmdType_DrawBuffer);
+	cmd.payload.draw.primitive = primitive;
+	cmd.payload.draw.startIndex = startIndex;
+	cmd.payload.draw.numElements = numElements;
+	cmd.payload.draw.vertexOffset = vertexOffset;
+	RcSubmitCommand(&cmd);
+}
+
+// +==============================+
+// |     Frames and Playback      |
+// +==============================+
+//Forgets what every shader's uniforms were last set to. Needed whenever commands were executed somewhere other
+//than the real backend (or not at all) so the shadows no longer describe what the API actually holds
+void RcInvalidateUniformShadows()
 {
 	NotNull(rc);
-	
-	switch (pig->renderApi)
+	rc->uniformShadowStamp++;
+}
+void RcSetUniformFiltering(bool enabled)
+{
+	NotNull(rc);
+	if (rc->filterUniforms == enabled) { return; }
+	rc->filterUniforms = enabled;
+	RcInvalidateUniformShadows(); //the shadows aren't updated while filtering is off
+}
+
+void RcStartFrame()
+{
+	NotNull(rc);
+	ClearRenderCmdBuffer(&rc->cmdBuffer);
+	ClearStruct(rc->modelStats);
+	RcInvalidateUniformShadows();
+	rc->frameStartTime = GetPerfTime();
+}
+void RcEndFrame()
+{
+	NotNull(rc);
+	RcFlushModelQueue();
+	PerfTime_t frameEndTime = GetPerfTime();
+	MyMemCopy(&rc->lastFrameStats, &rc->cmdBuffer.stats, sizeof(RenderCmdStats_t));
+	rc->lastFrameStats.frameTime = GetPerfTimeDiff(&rc->frameStartTime, &frameEndTime);
+	MyMemCopy(&rc->lastModelStats, &rc->modelStats, sizeof(RcModelStats_t));
+}
+
+//Re-executes a recorded stream on the given API without recording it again. The RenderContextState_t is
+//restored afterwards, but the API itself is left in whatever state the last command put it in
+void RcReplayCommandBuffer(const RenderCmdBuffer_t* buffer, RenderApi_t renderApi)
+{
+	NotNull(rc);
+	NotNull(buffer);
+	RenderContextState_t stateBefore;
+	MyMemCopy(&stateBefore, &rc->state, sizeof(RenderContextState_t));
+	u64 byteOffset = 0;
+	RenderCmd_t cmd;
+	while (RenderCmdBufferGet(buffer, &byteOffset, &cmd))
 	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetFillMode_OpenGL(fillMode);
-			rc->state.fillMode = fillMode;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetDepthTestEnabled!"); break;
+		RcExecuteCommand(&cmd, renderApi);
 	}
+	MyMemCopy(&rc->state, &stateBefore, sizeof(RenderContextState_t));
+	RcInvalidateUniformShadows();
+}
+
+void RcSetFaceCulling(bool enabled)
+{
+	NotNull(rc);
+	
+	RcCmdSetFaceCulling(enabled);
+	rc->state.faceCulling = enabled;
+}
+
+void RcSetDepthTestEnabled(bool enabled)
+{
+	NotNull(rc);
+	
+	RcCmdSetDepthTestEnabled(enabled);
+	rc->state.depthTestEnabled = enabled;
+}
+
+void RcSetFillMode(PolygonFillMode_t fillMode)
+{
+	NotNull(rc);
+	
+	RcCmdSetFillMode(fillMode);
+	rc->state.fillMode = fillMode;
 }
 
 #if 0
@@ -810,51 +1022,43 @@ void RcBindShader(Shader_t* shader)
 	if (rc->state.boundShader == shader) { return; }
 	//TODO: Track the number of shader binds
 	
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcBindShader_OpenGL(shader);
-			rc->state.boundShader = shader;
-			NotNull(rc->currentWindow);
-			VertexArrayObject_t* compatibleVao = RcGetVertexArrayObj(rc->currentWindow->id, shader->actualVertexType);
-			NotNull(compatibleVao);
-			RcBindVertexArrayObject_OpenGL(compatibleVao);
-			rc->state.boundVao = compatibleVao;
-			RcBindVertBuffer_OpenGL(nullptr);
-			rc->state.boundBuffer = nullptr;
-			RcBindTexture1_OpenGL(rc->state.boundTexture1);
-			RcBindTexture2_OpenGL(rc->state.boundTexture2);
-			RcSetWorldMatrix_OpenGL(Mat4Multiply(rc->state.augmentMatrix, rc->state.worldMatrix));
-			RcSetViewMatrix_OpenGL(rc->state.viewMatrix);
-			RcSetProjectionMatrix_OpenGL(rc->state.projectionMatrix);
-			RcSetCameraPosition_OpenGL(rc->state.cameraPosition);
-			RcSetPlayerPosition_OpenGL(rc->state.playerPosition);
-			RcSetColor1_OpenGL(rc->state.color1f);
-			RcSetColor2_OpenGL(rc->state.color2f);
-			RcSetScreenSpaceEffectColor_OpenGL(rc->state.screenSpaceEffectColorf);
-			if (rc->state.boundTexture1 != nullptr) { RcSetSourceRec1_OpenGL(rc->state.sourceRec1, rc->state.boundTexture1->isFlippedY, rc->state.boundTexture1->height); }
-			if (rc->state.boundTexture2 != nullptr) { RcSetSourceRec2_OpenGL(rc->state.sourceRec2, rc->state.boundTexture2->isFlippedY, rc->state.boundTexture2->height); }
-			RcSetShiftVec_OpenGL(rc->state.shiftVec);
-			RcSetCount_OpenGL(rc->state.count);
-			RcSetCircleRadius_OpenGL(rc->state.circleRadius);
-			RcSetCircleInnerRadius_OpenGL(rc->state.circleInnerRadius);
-			RcSetTime_OpenGL(rc->state.time);
-			RcSetSaturation_OpenGL(rc->state.saturation);
-			RcSetBrightness_OpenGL(rc->state.brightness);
-			RcSetPolygonPlanes_OpenGL(&rc->state.polygonPlanes[0]);
-			RcSetBrightness_OpenGL(rc->state.brightness);
-			for (u8 vIndex = 0; vIndex < ArrayCount(rc->state.values); vIndex++)
-			{
-				RcSetValue_OpenGL(vIndex, rc->state.values[vIndex]);
-			}
-			//TODO: Update all of the uniform values to match our current render context state
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in BindShader!"); break;
-	}
+	RcFlushModelQueue();
+	RcCmdBindShader(shader);
+	rc->state.boundShader = shader;
+	NotNull(rc->currentWindow);
+	VertexArrayObject_t* compatibleVao = RcGetVertexArrayObj(rc->currentWindow->id, shader->actualVertexType);
+	NotNull(compatibleVao);
+	RcCmdBindVertexArrayObject(compatibleVao);
+	rc->state.boundVao = compatibleVao;
+	RcCmdBindVertBuffer(nullptr);
+	rc->state.boundBuffer = nullptr;
+	rc->state.boundApiTexture1 = ((rc->state.boundTexture1 != nullptr) ? GetTextureApiTexture(rc->state.boundTexture1) : nullptr);
+	RcCmdBindTexture1(rc->state.boundApiTexture1);
+	RcCmdBindTexture2(rc->state.boundTexture2);
+	RcCmdSetWorldMatrix(Mat4Multiply(rc->state.augmentMatrix, rc->state.worldMatrix));
+	RcCmdSetViewMatrix(rc->state.viewMatrix);
+	RcCmdSetProjectionMatrix(rc->state.projectionMatrix);
+	RcCmdSetCameraPosition(rc->state.cameraPosition);
+	RcCmdSetPlayerPosition(rc->state.playerPosition);
+	RcCmdSetColor1(rc->state.color1f);
+	RcCmdSetColor2(rc->state.color2f);
+	RcCmdSetScreenSpaceEffectColor(rc->state.screenSpaceEffectColorf);
+	if (rc->state.boundTexture1 != nullptr) { RcCmdSetSourceRec1(GetTextureApiSourceRec(rc->state.boundTexture1, rc->state.sourceRec1), rc->state.boundApiTexture1->isFlippedY, rc->state.boundApiTexture1->height); }
+	if (rc->state.boundTexture2 != nullptr) { RcCmdSetSourceRec2(rc->state.sourceRec2, rc->state.boundTexture2->isFlippedY, rc->state.boundTexture2->height); }
+	RcCmdSetShiftVec(rc->state.shiftVec);
+	RcCmdSetCount(rc->state.count);
+	RcCmdSetCircleRadius(rc->state.circleRadius);
+	RcCmdSetCircleInnerRadius(rc->state.circleInnerRadius);
+	RcCmdSetTime(rc->state.time);
+	RcCmdSetSaturation(rc->state.saturation);
+	RcCmdSetBrightness(rc->state.brightness);
+	RcCmdSetPolygonPlanes(&rc->state.polygonPlanes[0]);
+	RcCmdSetBrightness(rc->state.brightness);
+	for (u8 vIndex = 0; vIndex < ArrayCount(rc->state.values); vIndex++)
+	{
+		RcCmdSetValue(vIndex, rc->state.values[vIndex]);
+	}
+	//TODO: Update all of the uniform values to match our current render context state
 }
 
 void RcBindFrameBuffer(FrameBuffer_t* buffer, bool forceRebind = false)
@@ -862,20 +1066,9 @@ void RcBindFrameBuffer(FrameBuffer_t* buffer, bool forceRebind = false)
 	if (buffer != nullptr && !buffer->isValid) { DebugAssertMsg(false, "Trying to bind invalid frame buffer!"); buffer = nullptr; }
 	if (!forceRebind && rc->state.boundFrameBuffer == buffer) { return; }
 	
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcBindFrameBuffer_OpenGL(buffer);
-			rc->state.boundFrameBuffer = buffer;
-		} break;
-		#endif
-		default:
-		{
-			
-		} break;
-	}
+	RcFlushModelQueue();
+	RcCmdBindFrameBuffer(buffer);
+	rc->state.boundFrameBuffer = buffer;
 }
 
 void RcBindTexture1(Texture_t* texture)
@@ -883,23 +1076,18 @@ void RcBindTexture1(Texture_t* texture)
 	NotNull(rc);
 	if (texture == nullptr) { texture = &rc->dotTexture; }
 	if (!texture->isValid) { texture = &rc->invalidTexture; }
-	//TODO: Track the number of texture binds
 	
-	switch (pig->renderApi)
+	//NOTE: Textures that share an atlas page only need the source rectangle to change between them
+	Texture_t* apiTexture = GetTextureApiTexture(texture);
+	rec defaultSourceRec = NewRec(0, 0, texture->width, texture->height);
+	if (rc->state.boundApiTexture1 != apiTexture)
 	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			rec defaultSourceRec = NewRec(0, 0, texture->width, texture->height);
-			RcBindTexture1_OpenGL(texture);
-			RcSetSourceRec1_OpenGL(defaultSourceRec, texture->isFlippedY, texture->height);
-			rc->state.boundTexture1 = texture;
-			rc->state.sourceRec1 = defaultSourceRec;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in BindTexture1!"); break;
+		RcCmdBindTexture1(apiTexture);
+		rc->state.boundApiTexture1 = apiTexture;
 	}
+	RcCmdSetSourceRec1(GetTextureApiSourceRec(texture, defaultSourceRec), apiTexture->isFlippedY, apiTexture->height);
+	rc->state.boundTexture1 = texture;
+	rc->state.sourceRec1 = defaultSourceRec;
 }
 void RcBindTexture2(Texture_t* texture)
 {
@@ -908,21 +1096,11 @@ void RcBindTexture2(Texture_t* texture)
 	if (!texture->isValid) { texture = &rc->invalidTexture; }
 	//TODO: Track the number of texture binds
 	
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			rec defaultSourceRec = NewRec(0, 0, texture->width, texture->height);
-			RcBindTexture2_OpenGL(texture);
-			RcSetSourceRec2_OpenGL(defaultSourceRec, texture->isFlippedY, texture->height);
-			rc->state.boundTexture2 = texture;
-			rc->state.sourceRec2 = defaultSourceRec;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in BindTexture2!"); break;
-	}
+	rec defaultSourceRec = NewRec(0, 0, texture->width, texture->height);
+	RcCmdBindTexture2(texture);
+	RcCmdSetSourceRec2(defaultSourceRec, texture->isFlippedY, texture->height);
+	rc->state.boundTexture2 = texture;
+	rc->state.sourceRec2 = defaultSourceRec;
 }
 
 void RcBindSpriteSheet(SpriteSheet_t* spriteSheet)
@@ -938,19 +1116,9 @@ void RcBindVertBuffer(const VertBuffer_t* buffer)
 	if (rc->state.boundBuffer == buffer) { return; }
 	//TODO: Track the number of buffer binds
 	
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcBindVertBuffer_OpenGL(buffer);
-			rc->state.boundBuffer = buffer;
-			//TODO: Update all of the uniform values to match our current render context state
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcBindVertBuffer!"); break;
-	}
+	RcCmdBindVertBuffer(buffer);
+	rc->state.boundBuffer = buffer;
+	//TODO: Update all of the uniform values to match our current render context state
 }
 
 void RcBindModel(Model_t* model)
@@ -1010,7 +1178,7 @@ r32 RcGetLineHeight()
 	NotNull(rc->state.boundFont);
 	const FontFace_t* fontFace = GetFontFace(rc->state.boundFont, rc->state.faceSelector);
 	if (fontFace == nullptr) { return 0; }
-	return fontFace->lineHeight * rc->state.fontScale;
+	return fontFace->lineHeight * GetFontFaceScale(fontFace, rc->state.faceSelector) * rc->state.fontScale;
 }
 r32 RcGetMaxAscend()
 {
@@ -1018,7 +1186,7 @@ r32 RcGetMaxAscend()
 	NotNull(rc->state.boundFont);
 	const FontFace_t* fontFace = GetFontFace(rc->state.boundFont, rc->state.faceSelector);
 	if (fontFace == nullptr) { return 0; }
-	return fontFace->maxAscend * rc->state.fontScale;
+	return fontFace->maxAscend * GetFontFaceScale(fontFace, rc->state.faceSelector) * rc->state.fontScale;
 }
 r32 RcGetMaxDescend()
 {
@@ -1026,111 +1194,53 @@ r32 RcGetMaxDescend()
 	NotNull(rc->state.boundFont);
 	const FontFace_t* fontFace = GetFontFace(rc->state.boundFont, rc->state.faceSelector);
 	if (fontFace == nullptr) { return 0; }
-	return fontFace->maxDescend * rc->state.fontScale;
+	return fontFace->maxDescend * GetFontFaceScale(fontFace, rc->state.faceSelector) * rc->state.fontScale;
 }
 
 void RcSetAugmentMatrix(mat4 matrix)
 {
 	NotNull(rc);
 	if (rc->state.augmentMatrix == matrix) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetWorldMatrix_OpenGL(Mat4Multiply(matrix, rc->state.worldMatrix));
-			rc->state.augmentMatrix = matrix;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetWorldMatrix!"); break;
-	}
+	RcCmdSetWorldMatrix(Mat4Multiply(matrix, rc->state.worldMatrix));
+	rc->state.augmentMatrix = matrix;
 }
 void RcSetWorldMatrix(mat4 matrix)
 {
 	NotNull(rc);
 	if (rc->state.worldMatrix == matrix) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetWorldMatrix_OpenGL(Mat4Multiply(rc->state.augmentMatrix, matrix));
-			rc->state.worldMatrix = matrix;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetWorldMatrix!"); break;
-	}
+	RcCmdSetWorldMatrix(Mat4Multiply(rc->state.augmentMatrix, matrix));
+	rc->state.worldMatrix = matrix;
 }
 void RcSetViewMatrix(mat4 matrix)
 {
 	NotNull(rc);
 	if (rc->state.viewMatrix == matrix) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetViewMatrix_OpenGL(matrix);
-			rc->state.viewMatrix = matrix;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetViewMatrix!"); break;
-	}
+	RcFlushModelQueue();
+	RcCmdSetViewMatrix(matrix);
+	rc->state.viewMatrix = matrix;
 }
 void RcSetProjectionMatrix(mat4 matrix)
 {
 	NotNull(rc);
 	if (rc->state.projectionMatrix == matrix) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetProjectionMatrix_OpenGL(matrix);
-			rc->state.projectionMatrix = matrix;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetProjectionMatrix!"); break;
-	}
+	RcFlushModelQueue();
+	RcCmdSetProjectionMatrix(matrix);
+	rc->state.projectionMatrix = matrix;
 }
 
 void RcSetCameraPosition(v3 cameraPos)
 {
 	NotNull(rc);
 	if (rc->state.cameraPosition == cameraPos) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetCameraPosition_OpenGL(cameraPos);
-			rc->state.cameraPosition = cameraPos;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetCameraPosition!"); break;
-	}
+	RcCmdSetCameraPosition(cameraPos);
+	rc->state.cameraPosition = cameraPos;
 }
 void RcSetPlayerPosition(v3 playerPos)
 {
 	NotNull(rc);
 	if (rc->state.playerPosition == playerPos) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetPlayerPosition_OpenGL(playerPos);
-			rc->state.playerPosition = playerPos;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetPlayerPosition!"); break;
-	}
+	RcCmdSetPlayerPosition(playerPos);
+	rc->state.playerPosition = playerPos;
 }
 
 void RcSetDepth(r32 depth)
@@ -1160,18 +1270,8 @@ void RcSetViewport(rec viewportRec, bool fakeScreenSpaceCoordinates = true)
 	NotNull(rc);
 	NotNull(rc->currentWindow);
 	
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetViewport_OpenGL(viewportRec);
-			rc->state.viewportRec = viewportRec;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetViewport!"); break;
-	}
+	RcCmdSetViewport(viewportRec);
+	rc->state.viewportRec = viewportRec;
 	
 	//NOTE: For 2D rendering it can be nice to pretend like our coordinate space hasn't changed when rendering
 	//      to a sub-section of the back buffer. In order to do this we generate a projection matrix to map\
@@ -1198,91 +1298,41 @@ void RcSetColor1(Color_t color)
 {
 	NotNull(rc);
 	if (rc->state.color1.value == color.value) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetColor1_OpenGL(ToColorf(color));
-			rc->state.color1 = color;
-			rc->state.color1f = ToColorf(color);
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetColor1!"); break;
-	}
+	RcCmdSetColor1(ToColorf(color));
+	rc->state.color1 = color;
+	rc->state.color1f = ToColorf(color);
 }
 void RcSetColor1(Colorf_t color)
 {
 	NotNull(rc);
 	if (rc->state.color1f == color) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetColor1_OpenGL(color);
-			rc->state.color1 = ToColor(color);
-			rc->state.color1f = color;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetColor1!"); break;
-	}
+	RcCmdSetColor1(color);
+	rc->state.color1 = ToColor(color);
+	rc->state.color1f = color;
 }
 void RcSetColor2(Color_t color)
 {
 	NotNull(rc);
 	if (rc->state.color2.value == color.value) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetColor2_OpenGL(ToColorf(color));
-			rc->state.color2 = color;
-			rc->state.color2f = ToColorf(color);
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetColor2!"); break;
-	}
+	RcCmdSetColor2(ToColorf(color));
+	rc->state.color2 = color;
+	rc->state.color2f = ToColorf(color);
 }
 void RcSetColor2(Colorf_t color)
 {
 	NotNull(rc);
 	if (rc->state.color2f == color) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetColor2_OpenGL(color);
-			rc->state.color2 = ToColor(color);
-			rc->state.color2f = color;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetColor2!"); break;
-	}
+	RcCmdSetColor2(color);
+	rc->state.color2 = ToColor(color);
+	rc->state.color2f = color;
 }
 void RcSetScreenSpaceEffectColor(Color_t color)
 {
 	NotNull(rc);
 	if (rc->state.screenSpaceEffectColor.value == color.value) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetScreenSpaceEffectColor_OpenGL(ToColorf(color));
-			rc->state.screenSpaceEffectColor = color;
-			rc->state.screenSpaceEffectColorf = ToColorf(color);
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetColor2!"); break;
-	}
+	RcCmdSetScreenSpaceEffectColor(ToColorf(color));
+	rc->state.screenSpaceEffectColor = color;
+	rc->state.screenSpaceEffectColorf = ToColorf(color);
 }
 
 void RcSetSourceRec1(rec rectangle)
@@ -1290,159 +1340,70 @@ void RcSetSourceRec1(rec rectangle)
 	NotNull(rc);
 	NotNull(rc->state.boundTexture1);
 	if (RecBasicallyEqual(rc->state.sourceRec1, rectangle)) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetSourceRec1_OpenGL(rectangle, rc->state.boundTexture1->isFlippedY, rc->state.boundTexture1->height);
-			rc->state.sourceRec1 = rectangle;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetSourceRec1!"); break;
-	}
+	Texture_t* apiTexture = GetTextureApiTexture(rc->state.boundTexture1);
+	RcCmdSetSourceRec1(GetTextureApiSourceRec(rc->state.boundTexture1, rectangle), apiTexture->isFlippedY, apiTexture->height);
+	rc->state.sourceRec1 = rectangle;
 }
 void RcSetSourceRec2(rec rectangle)
 {
 	NotNull(rc);
 	NotNull(rc->state.boundTexture2);
 	if (RecBasicallyEqual(rc->state.sourceRec2, rectangle)) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetSourceRec2_OpenGL(rectangle, rc->state.boundTexture2->isFlippedY, rc->state.boundTexture2->height);
-			rc->state.sourceRec2 = rectangle;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetSourceRec2!"); break;
-	}
+	RcCmdSetSourceRec2(rectangle, rc->state.boundTexture2->isFlippedY, rc->state.boundTexture2->height);
+	rc->state.sourceRec2 = rectangle;
 }
 
 void RcSetShiftVec(v2 shiftVec)
 {
 	NotNull(rc);
 	if (Vec2BasicallyEqual(rc->state.shiftVec, shiftVec)) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetShiftVec_OpenGL(shiftVec);
-			rc->state.shiftVec = shiftVec;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetShiftVec!"); break;
-	}
+	RcCmdSetShiftVec(shiftVec);
+	rc->state.shiftVec = shiftVec;
 }
 
 void RcSetCount(i32 count)
 {
 	NotNull(rc);
 	if (rc->state.count == count) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetCount_OpenGL(count);
-			rc->state.count = count;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetColor1!"); break;
-	}
+	RcCmdSetCount(count);
+	rc->state.count = count;
 }
 
 void RcSetCircleRadius(r32 radius)
 {
 	NotNull(rc);
 	if (BasicallyEqualR32(rc->state.circleRadius, radius)) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetCircleRadius_OpenGL(radius);
-			rc->state.circleRadius = radius;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetCircleRadius!"); break;
-	}
+	RcCmdSetCircleRadius(radius);
+	rc->state.circleRadius = radius;
 }
 void RcSetCircleInnerRadius(r32 innerRadius)
 {
 	NotNull(rc);
 	if (BasicallyEqualR32(rc->state.circleInnerRadius, innerRadius)) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetCircleInnerRadius_OpenGL(innerRadius);
-			rc->state.circleInnerRadius = innerRadius;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetCircleInnerRadius!"); break;
-	}
+	RcCmdSetCircleInnerRadius(innerRadius);
+	rc->state.circleInnerRadius = innerRadius;
 }
 
 void RcSetTime(r32 time)
 {
 	NotNull(rc);
 	if (BasicallyEqualR32(rc->state.time, time)) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetTime_OpenGL(time);
-			rc->state.time = time;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetSaturation!"); break;
-	}
+	RcCmdSetTime(time);
+	rc->state.time = time;
 }
 void RcSetSaturation(r32 saturation)
 {
 	NotNull(rc);
 	if (BasicallyEqualR32(rc->state.saturation, saturation)) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetSaturation_OpenGL(saturation);
-			rc->state.saturation = saturation;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetSaturation!"); break;
-	}
+	RcCmdSetSaturation(saturation);
+	rc->state.saturation = saturation;
 }
 void RcSetBrightness(r32 brightness)
 {
 	NotNull(rc);
 	if (BasicallyEqualR32(rc->state.brightness, brightness)) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetBrightness_OpenGL(brightness);
-			rc->state.brightness = brightness;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetSaturation!"); break;
-	}
+	RcCmdSetBrightness(brightness);
+	rc->state.brightness = brightness;
 }
 
 void RcSetPolygonPlane(u64 planeIndex, r32 direction, r32 distance)
@@ -1451,18 +1412,8 @@ void RcSetPolygonPlane(u64 planeIndex, r32 direction, r32 distance)
 	Assert(planeIndex < ShaderUniform_NumPolygonPlanes);
 	v2 newValue = NewVec2(direction, distance);
 	if (Vec2BasicallyEqual(rc->state.polygonPlanes[planeIndex], newValue)) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			rc->state.polygonPlanes[planeIndex] = newValue;
-			RcSetPolygonPlanes_OpenGL(&rc->state.polygonPlanes[0]);
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetPolygonPlane!"); break;
-	}
+	rc->state.polygonPlanes[planeIndex] = newValue;
+	RcCmdSetPolygonPlanes(&rc->state.polygonPlanes[0]);
 }
 
 void RcSetValue(u8 valueIndex, r32 value)
@@ -1470,18 +1421,8 @@ void RcSetValue(u8 valueIndex, r32 value)
 	NotNull(rc);
 	Assert(valueIndex < ArrayCount(rc->state.values));
 	if (BasicallyEqualR32(rc->state.values[valueIndex], value)) { return; }
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetValue_OpenGL(valueIndex, value);
-			rc->state.values[valueIndex] = value;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetValue!"); break;
-	}
+	RcCmdSetValue(valueIndex, value);
+	rc->state.values[valueIndex] = value;
 }
 
 bool RcSetDynamicUniformR32(MyStr_t uniformName, r32 value)
@@ -1490,18 +1431,8 @@ bool RcSetDynamicUniformR32(MyStr_t uniformName, r32 value)
 	ShaderDynamicUniform_t* uniform = GetDynamicUniform(rc->state.boundShader, uniformName, true);
 	if (uniform == nullptr) { return false; }
 	bool result = false;
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetDynamicUniformR32_OpenGL(uniform, value);
-			result = true;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetDynamicUniformR32!"); break;
-	}
+	RcCmdSetDynamicUniformR32(uniform, value);
+	result = true;
 	return result;
 }
 bool RcSetDynamicUniformVec2(MyStr_t uniformName, v2 value)
@@ -1510,18 +1441,8 @@ bool RcSetDynamicUniformVec2(MyStr_t uniformName, v2 value)
 	ShaderDynamicUniform_t* uniform = GetDynamicUniform(rc->state.boundShader, uniformName, true);
 	if (uniform == nullptr) { return false; }
 	bool result = false;
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetDynamicUniformVec2_OpenGL(uniform, value);
-			result = true;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetDynamicUniformR32!"); break;
-	}
+	RcCmdSetDynamicUniformVec2(uniform, value);
+	result = true;
 	return result;
 }
 bool RcSetDynamicUniformVec3(MyStr_t uniformName, v3 value)
@@ -1530,18 +1451,8 @@ bool RcSetDynamicUniformVec3(MyStr_t uniformName, v3 value)
 	ShaderDynamicUniform_t* uniform = GetDynamicUniform(rc->state.boundShader, uniformName, true);
 	if (uniform == nullptr) { return false; }
 	bool result = false;
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetDynamicUniformVec3_OpenGL(uniform, value);
-			result = true;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetDynamicUniformR32!"); break;
-	}
+	RcCmdSetDynamicUniformVec3(uniform, value);
+	result = true;
 	return result;
 }
 bool RcSetDynamicUniformVec4(MyStr_t uniformName, v4 value)
@@ -1550,18 +1461,8 @@ bool RcSetDynamicUniformVec4(MyStr_t uniformName, v4 value)
 	ShaderDynamicUniform_t* uniform = GetDynamicUniform(rc->state.boundShader, uniformName, true);
 	if (uniform == nullptr) { return false; }
 	bool result = false;
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetDynamicUniformVec4_OpenGL(uniform, value);
-			result = true;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetDynamicUniformR32!"); break;
-	}
+	RcCmdSetDynamicUniformVec4(uniform, value);
+	result = true;
 	return result;
 }
 bool RcSetDynamicUniformMat4(MyStr_t uniformName, mat4 value)
@@ -1570,18 +1471,8 @@ bool RcSetDynamicUniformMat4(MyStr_t uniformName, mat4 value)
 	ShaderDynamicUniform_t* uniform = GetDynamicUniform(rc->state.boundShader, uniformName, true);
 	if (uniform == nullptr) { return false; }
 	bool result = false;
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetDynamicUniformMat4_OpenGL(uniform, value);
-			result = true;
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetDynamicUniformR32!"); break;
-	}
+	RcCmdSetDynamicUniformMat4(uniform, value);
+	result = true;
 	return result;
 }
 
@@ -1609,63 +1500,23 @@ bool RcSetDynamicUniformMat4(const char* nullTermStr, mat4 value)
 void RcClearColor(Color_t color)
 {
 	NotNull(rc);
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcClearColor_OpenGL(color);
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcClearColor!"); break;
-	}
+	RcCmdClearColor(color);
 }
 void RcClearDepth(r32 depth)
 {
 	NotNull(rc);
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcClearDepth_OpenGL(RcGetRealDepth(depth));
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcClearDepth!"); break;
-	}
+	RcCmdClearDepth(RcGetRealDepth(depth));
 }
 void RcClearStencil(i32 stencilValue)
 {
 	NotNull(rc);
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcClearStencil_OpenGL(stencilValue);
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcClearStencil!"); break;
-	}
+	RcCmdClearStencil(stencilValue);
 }
 
 void RcDrawBuffer(VertBufferPrimitive_t primitive, u64 startIndex = 0, u64 numElements = 0, u64 vertexOffset = 0)
 {
 	NotNull(rc);
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcDrawBuffer_OpenGL(primitive, startIndex, numElements, vertexOffset);
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcDrawBuffer!"); break;
-	}
+	RcCmdDrawBuffer(primitive, startIndex, numElements, vertexOffset);
 }
 
 // +==============================+
@@ -1674,62 +1525,22 @@ void RcDrawBuffer(VertBufferPrimitive_t primitive, u64 startIndex = 0, u64 numEl
 void RcStartStencilDrawing()
 {
 	NotNull(rc);
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcStartStencilDrawing_OpenGL();
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcStartStencilDrawing!"); break;
-	}
+	RcCmdStartStencilDrawing();
 }
 void RcSetStencilPolarity(bool writePositiveValues)
 {
 	NotNull(rc);
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcSetStencilPolarity_OpenGL(writePositiveValues);
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcSetStencilPolarity!"); break;
-	}
+	RcCmdSetStencilPolarity(writePositiveValues);
 }
 void RcUseStencil(bool inverseMask = false)
 {
 	NotNull(rc);
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcUseStencil_OpenGL(inverseMask);
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcUseStencil!"); break;
-	}
+	RcCmdUseStencil(inverseMask);
 }
 void RcDisableStencil()
 {
 	NotNull(rc);
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcDisableStencil_OpenGL();
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcDisableStencil!"); break;
-	}
+	RcCmdDisableStencil();
 }
 
 // +==============================+
@@ -1754,17 +1565,7 @@ void RcBegin(const PlatWindow_t* window, FrameBuffer_t* frameBuffer, Shader_t* i
 	// +======================================+
 	// | API Specific Initialization/Options  |
 	// +======================================+
-	switch (pig->renderApi)
-	{
-		#if OPENGL_SUPPORTED
-		case RenderApi_OpenGL:
-		{
-			RcBegin_OpenGL();
-		} break;
-		#endif
-		
-		default: DebugAssertMsg(false, "Unsupported render API in RcBegin!"); break;
-	}
+	RcCmdBegin();
 	
 	// +==============================+
 	// | Set Default Values for State |
@@ -1777,6 +1578,7 @@ void RcBegin(const PlatWindow_t* window, FrameBuffer_t* frameBuffer, Shader_t* i
 	rc->state.boundShader = nullptr;
 	rc->state.boundVao = nullptr;
 	rc->state.boundTexture1 = nullptr;
+	rc->state.boundApiTexture1 = nullptr;
 	rc->state.boundTexture2 = nullptr;
 	rc->state.boundSpriteSheet = nullptr;
 	rc->state.boundBuffer = nullptr;
@@ -2067,4 +1869,19 @@ void RcLoadBasicResources()
 		DestroyTexture(&rc->dotTexture);
 		DebugAssert(false);
 	}
+	
+	MemArena_t* scratch = GetScratchArena();
+	MyStr_t fontSdfShaderCode = PrintInArenaStr(scratch, "#version 130\n%s\n\n// ====== %s ======\n#version 130\n%s",
+		FontSdfShaderCode_Vert_GLSL_130,
+		FRAGMENT_VERTEX_DIVIDER_STR,
+		FontSdfShaderCode_Frag_GLSL_130
+	);
+	if (!CreateShader(fixedHeap, &rc->fontSdfShader, fontSdfShaderCode, VertexType_Default2D, (ShaderUniform_RequireMatrices|ShaderUniform_RequireTexture|ShaderUniform_SourceRec1|ShaderUniform_Color1)))
+	{
+		//SDF font bakes will fall back to being drawn with whatever shader is bound, see FontFlow_BindBake
+		PrintLine_E("Failed to create the font SDF shader! Error %s%s%s", GetResultStr(rc->fontSdfShader.error), (rc->fontSdfShader.error == Result_ApiError) ? ": " : "", (rc->fontSdfShader.error == Result_ApiError) ? rc->fontSdfShader.apiErrorStr.pntr : "");
+		DestroyShader(&rc->fontSdfShader);
+		DebugAssert(false);
+	}
+	FreeScratchArena(scratch);
 }
@@ -195,15 +195,41 @@ enum ShaderUniform_t
 	ShaderUniform_NumPolygonPlanes = 8, //make sure this matches the define in convexPolygon2D.glsl
 };
 
+#define SHADER_UNIFORM_TABLE_MIN_SIZE   32 //slots, the table is kept at most half full
+#define SHADER_BINARY_CACHE_FOLDER      "ShaderCache"
+#define SHADER_BINARY_FILE_EXTENSION    ".pshb"
+#define SHADER_BINARY_MAGIC             "PSHB"
+#define SHADER_BINARY_VERSION           1
+
 struct ShaderDynamicUniform_t
 {
 	u64 uniformIndex;
 	MyStr_t name;
+	u64 nameHash;
+	bool isPresent; //false for names the program doesn't have, so looking them up again doesn't ask the API
 	#if OPENGL_SUPPORTED
 	GLint glLocation;
 	#endif
+	
+	//The last value sent to this uniform (see RcIsUniformCmdRedundant), only trusted while shadowStamp matches rc->uniformShadowStamp
+	u64 shadowStamp;
+	u8 shadowType; //RenderCmdType_t
+	u8 shadowBytes[sizeof(mat4)];
 };
 
+//NOTE: A cached program binary is this header followed by the bytes from glGetProgramBinary
+START_PACK()
+struct ATTR_PACKED ShaderBinaryHeader_t
+{
+	char magic[4]; //SHADER_BINARY_MAGIC
+	u32 version; //SHADER_BINARY_VERSION
+	u64 sourceHash;
+	u64 driverHash; //see PigState_t shaderDriverHash
+	u32 binaryFormat;
+	u32 binarySize;
+};
+END_PACK()
+
 struct Shader_t
 {
 	bool isValid;
@@ -219,7 +245,13 @@ struct Shader_t
 	VarArray_t vertexCodePieces; //MyStr_t
 	VarArray_t fragmentCodePieces; //MyStr_t
 	
-	VarArray_t dynamicUniforms; //ShaderDynamicUniform_t
+	BktArray_t dynamicUniforms; //ShaderDynamicUniform_t, pointers to these are recorded in the command stream so they must not move
+	u64 uniformTableSize; //power of 2
+	ShaderDynamicUniform_t** uniformTable; //open addressing on nameHash
+	struct ShaderUniformShadow_t* uniformShadow; //allocated the first time a uniform set is filtered, see pig_render_commands.h
+	
+	u64 sourceHash; //the code pieces, vertexType and requiredUniforms, used as the key in the shader binary cache
+	bool loadedFromBinary;
 	
 	#if OPENGL_SUPPORTED
 	GLuint glId;
@@ -332,6 +364,10 @@ struct Texture_t
 	u64 antialiasingNumSamples;
 	bool isFlippedY;
 	bool singleChannel;
+	TextureCompression_t compression; //only set by CreateTextureFromCooked
+	u64 gpuSize; //bytes of block data uploaded, 0 for textures made by CreateTexture
+	Texture_t* atlasPage; //non-null if this texture lives in a TextureAtlas_t page (see pig_texture_atlas.h)
+	reci atlasRec; //where this texture sits in atlasPage, in pixels
 	
 	union
 	{
@@ -417,6 +453,8 @@ struct SpriteSheetFrame_t
 	reci logicalBounds;
 	v2i charOffset;
 	VarArray_t points; //SpriteSheetFramePoint_t
+	reci trimRec; //trimmed sheets only, the tight bounds of the non-transparent pixels relative to the frame's top left
+	reci packedRec; //trimmed sheets only, where trimRec's pixels ended up in the texture
 };
 
 struct SpriteSheet_t
@@ -445,6 +483,9 @@ struct SpriteSheet_t
 	
 	u64 numFilledFrames;
 	VarArray_t frames; //SpriteSheetFrame_t
+	
+	bool isTrimmed; //frames were trimmed to their alpha bounds and packed, use packedRec/trimRec instead of gridPos math
+	v2i untrimmedTextureSize; //what the texture would have been as a uniform grid
 };
 
 struct ModelArmatureBone_t
@@ -507,6 +548,8 @@ struct ModelPart_t
 	u64 partIndex;
 	u64 materialIndex;
 	u64 boneId;
+	v3 boundsMin; //model space, used for frustum culling
+	v3 boundsMax;
 	VertBuffer_t buffer;
 };
 struct Model_t
@@ -515,6 +558,9 @@ struct Model_t
 	ModelTextureType_t textureType;
 	VarArray_t materials; //ModelMaterial_t
 	VarArray_t parts; //ModelPart_t
+	bool hasBounds; //false for models that weren't built by CreateModelFromObjModelData, those are never culled
+	v3 boundsMin; //encloses every part
+	v3 boundsMax;
 	
 	bool hasArmature;
 	ModelArmature_t armature;
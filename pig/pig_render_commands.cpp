@@ -0,0 +1,318 @@
+/*
+File:   pig_render_commands.cpp
+Date:   10\19\2026
+Description:
+	** Holds the functions that encode, decode, and measure the render command stream (see pig_render_commands.h)
+	** Executing the commands lives in pig_render.cpp next to the API specific functions that do the work
+*/
+
+void FreeRenderCmdBuffer(RenderCmdBuffer_t* buffer)
+{
+	NotNull(buffer);
+	if (buffer->data != nullptr)
+	{
+		NotNull(buffer->allocArena);
+		FreeMem(buffer->allocArena, buffer->data, buffer->allocLength);
+	}
+	ClearPointer(buffer);
+}
+
+void InitRenderCmdBuffer(RenderCmdBuffer_t* buffer, MemArena_t* memArena, u64 initialSize = RENDER_CMD_BUFFER_INITIAL_SIZE)
+{
+	NotNull(buffer);
+	NotNull(memArena);
+	ClearPointer(buffer);
+	buffer->allocArena = memArena;
+	buffer->recording = PIG_RENDER_CMD_RECORDING;
+	if (initialSize > 0)
+	{
+		buffer->data = AllocArray(memArena, u8, initialSize);
+		NotNull(buffer->data);
+		buffer->allocLength = initialSize;
+	}
+}
+
+//Keeps the allocation around so we don't need to grow the buffer again next frame
+void ClearRenderCmdBuffer(RenderCmdBuffer_t* buffer)
+{
+	NotNull(buffer);
+	buffer->length = 0;
+	ClearStruct(buffer->stats);
+	ClearArray(buffer->hasLastPayload);
+}
+
+//Offset of the value from the start of the payload, the dynamic uniform commands store everything before it plus only the value member they use
+u64 GetRenderCmdDynamicValueOffset()
+{
+	return offsetof(RenderCmdPayload_t, dynamic) + offsetof(RenderCmdDynamicUniformPayload_t, r32Value);
+}
+
+u64 GetRenderCmdPayloadSize(RenderCmdType_t cmdType)
+{
+	RenderCmdPayload_t* payload = nullptr; //only used inside sizeof
+	switch (cmdType)
+	{
+		case RenderCmdType_SetFaceCulling:            return sizeof(payload->enabled);
+		case RenderCmdType_SetDepthTestEnabled:       return sizeof(payload->enabled);
+		case RenderCmdType_SetFillMode:               return sizeof(payload->fillMode);
+		case RenderCmdType_BindFrameBuffer:           return sizeof(payload->frameBuffer);
+		case RenderCmdType_BindShader:                return sizeof(payload->shader);
+		case RenderCmdType_BindVao:                   return sizeof(payload->vao);
+		case RenderCmdType_BindTexture1:              return sizeof(payload->texture);
+		case RenderCmdType_BindTexture2:              return sizeof(payload->texture);
+		case RenderCmdType_BindVertBuffer:            return sizeof(payload->vertBuffer);
+		case RenderCmdType_SetViewport:               return sizeof(payload->rectangle);
+		case RenderCmdType_SetWorldMatrix:            return sizeof(payload->matrix);
+		case RenderCmdType_SetViewMatrix:             return sizeof(payload->matrix);
+		case RenderCmdType_SetProjectionMatrix:       return sizeof(payload->matrix);
+		case RenderCmdType_SetCameraPosition:         return sizeof(payload->vec3);
+		case RenderCmdType_SetPlayerPosition:         return sizeof(payload->vec3);
+		case RenderCmdType_SetColor1:                 return sizeof(payload->colorf);
+		case RenderCmdType_SetColor2:                 return sizeof(payload->colorf);
+		case RenderCmdType_SetScreenSpaceEffectColor: return sizeof(payload->colorf);
+		case RenderCmdType_SetSourceRec1:             return sizeof(payload->sourceRec);
+		case RenderCmdType_SetSourceRec2:             return sizeof(payload->sourceRec);
+		case RenderCmdType_SetShiftVec:               return sizeof(payload->vec2);
+		case RenderCmdType_SetCount:                  return sizeof(payload->intValue);
+		case RenderCmdType_SetCircleRadius:           return sizeof(payload->floatValue);
+		case RenderCmdType_SetCircleInnerRadius:      return sizeof(payload->floatValue);
+		case RenderCmdType_SetTime:                   return sizeof(payload->floatValue);
+		case RenderCmdType_SetSaturation:             return sizeof(payload->floatValue);
+		case RenderCmdType_SetBrightness:             return sizeof(payload->floatValue);
+		case RenderCmdType_SetPolygonPlanes:          return sizeof(payload->polygonPlanes);
+		case RenderCmdType_SetValue:                  return sizeof(payload->value);
+		case RenderCmdType_SetDynamicUniformR32:      return GetRenderCmdDynamicValueOffset() + sizeof(payload->dynamic.r32Value);
+		case RenderCmdType_SetDynamicUniformVec2:     return GetRenderCmdDynamicValueOffset() + sizeof(payload->dynamic.vec2Value);
+		case RenderCmdType_SetDynamicUniformVec3:     return GetRenderCmdDynamicValueOffset() + sizeof(payload->dynamic.vec3Value);
+		case RenderCmdType_SetDynamicUniformVec4:     return GetRenderCmdDynamicValueOffset() + sizeof(payload->dynamic.vec4Value);
+		case RenderCmdType_SetDynamicUniformMat4:     return GetRenderCmdDynamicValueOffset() + sizeof(payload->dynamic.mat4Value);
+		case RenderCmdType_ClearColor:                return sizeof(payload->color);
+		case RenderCmdType_ClearDepth:                return sizeof(payload->floatValue);
+		case RenderCmdType_ClearStencil:              return sizeof(payload->intValue);
+		case RenderCmdType_DrawBuffer:                return sizeof(payload->draw);
+		case RenderCmdType_StartStencilDrawing:       return 0;
+		case RenderCmdType_SetStencilPolarity:        return sizeof(payload->enabled);
+		case RenderCmdType_UseStencil:                return sizeof(payload->enabled);
+		case RenderCmdType_DisableStencil:            return 0;
+		case RenderCmdType_Begin:                     return 0;
+		default: DebugAssertMsg(false, "Unhandled RenderCmdType_t in GetRenderCmdPayloadSize"); return 0;
+	}
+}
+
+//Returns the number of bytes uniform values in this command would send to the GPU (0 for non-uniform commands)
+u64 GetRenderCmdUniformBytes(const RenderCmd_t* cmd)
+{
+	NotNull(cmd);
+	switch (cmd->type)
+	{
+		case RenderCmdType_SetSourceRec1:         return sizeof(v4);
+		case RenderCmdType_SetSourceRec2:         return sizeof(v4);
+		case RenderCmdType_SetValue:              return sizeof(r32);
+		case RenderCmdType_SetDynamicUniformR32:  return sizeof(r32);
+		case RenderCmdType_SetDynamicUniformVec2: return sizeof(v2);
+		case RenderCmdType_SetDynamicUniformVec3: return sizeof(v3);
+		case RenderCmdType_SetDynamicUniformVec4: return sizeof(v4);
+		case RenderCmdType_SetDynamicUniformMat4: return sizeof(mat4);
+		default:
+		{
+			if (GetRenderCmdCategory(cmd->type) == RenderCmdCategory_Uniform) { return GetRenderCmdPayloadSize(cmd->type); }
+			return 0;
+		}
+	}
+}
+
+//Commands that target one of several slots (generic values, dynamic uniforms) are only
+//redundant when they hit the same slot, which we can't tell from the last payload alone
+bool CanRenderCmdBeRedundant(RenderCmdType_t cmdType)
+{
+	RenderCmdCategory_t category = GetRenderCmdCategory(cmdType);
+	if (category != RenderCmdCategory_State && category != RenderCmdCategory_Uniform) { return false; }
+	if (cmdType == RenderCmdType_SetValue) { return false; }
+	if (cmdType >= RenderCmdType_SetDynamicUniformR32 && cmdType <= RenderCmdType_SetDynamicUniformMat4) { return false; }
+	if (cmdType >= RenderCmdType_StartStencilDrawing && cmdType <= RenderCmdType_Begin) { return false; }
+	return true;
+}
+
+//Returns true if the shader already holds the value this uniform command would set. Otherwise the value is remembered
+//as the shader's current one and false is returned. Anything that isn't a uniform command is never redundant
+bool RenderCmdUpdateUniformShadow(Shader_t* shader, const RenderCmd_t* cmd, u64 stamp)
+{
+	NotNull2(shader, cmd);
+	if (GetRenderCmdCategory(cmd->type) != RenderCmdCategory_Uniform) { return false; }
+	
+	if (cmd->type >= RenderCmdType_SetDynamicUniformR32 && cmd->type <= RenderCmdType_SetDynamicUniformMat4)
+	{
+		ShaderDynamicUniform_t* uniform = cmd->payload.dynamic.uniform;
+		NotNull(uniform);
+		const u8* valuePntr = (const u8*)&cmd->payload + GetRenderCmdDynamicValueOffset();
+		u64 valueSize = GetRenderCmdPayloadSize(cmd->type) - GetRenderCmdDynamicValueOffset();
+		Assert(valueSize <= sizeof(uniform->shadowBytes));
+		bool isRedundant = (uniform->shadowStamp == stamp && uniform->shadowType == (u8)cmd->type && MyMemCompare(&uniform->shadowBytes[0], valuePntr, valueSize) == 0);
+		uniform->shadowStamp = stamp;
+		uniform->shadowType = (u8)cmd->type;
+		MyMemCopy(&uniform->shadowBytes[0], valuePntr, valueSize);
+		return isRedundant;
+	}
+	
+	if (shader->uniformShadow == nullptr)
+	{
+		NotNull(shader->allocArena);
+		shader->uniformShadow = AllocStruct(shader->allocArena, ShaderUniformShadow_t);
+		NotNull(shader->uniformShadow);
+		ClearPointer(shader->uniformShadow);
+	}
+	ShaderUniformShadow_t* shadow = shader->uniformShadow;
+	if (shadow->stamp != stamp)
+	{
+		ClearArray(shadow->hasPayload);
+		ClearArray(shadow->hasValue);
+		shadow->stamp = stamp;
+	}
+	
+	if (cmd->type == RenderCmdType_SetValue)
+	{
+		u8 valueIndex = cmd->payload.value.index;
+		Assert(valueIndex < ShaderUniform_NumGenericValues);
+		bool isRedundant = (shadow->hasValue[valueIndex] && shadow->values[valueIndex] == cmd->payload.value.value);
+		shadow->hasValue[valueIndex] = true;
+		shadow->values[valueIndex] = cmd->payload.value.value;
+		return isRedundant;
+	}
+	
+	u64 shadowIndex = (u64)(cmd->type - RenderCmdType_SetWorldMatrix);
+	Assert(shadowIndex < RENDER_CMD_NUM_SHADOWED_UNIFORMS);
+	u64 payloadSize = GetRenderCmdPayloadSize(cmd->type);
+	bool isRedundant = (shadow->hasPayload[shadowIndex] && MyMemCompare(&shadow->payloads[shadowIndex], &cmd->payload, payloadSize) == 0);
+	shadow->hasPayload[shadowIndex] = true;
+	MyMemCopy(&shadow->payloads[shadowIndex], &cmd->payload, payloadSize);
+	return isRedundant;
+}
+
+//Filtered commands never reach RenderCmdBufferPush but we still want to know how much they saved
+void RenderCmdBufferCountFiltered(RenderCmdBuffer_t* buffer, const RenderCmd_t* cmd)
+{
+	NotNull2(buffer, cmd);
+	buffer->stats.numFilteredUniformSets++;
+	buffer->stats.filteredUniformBytes += GetRenderCmdUniformBytes(cmd);
+}
+
+void RenderCmdBufferPush(RenderCmdBuffer_t* buffer, const RenderCmd_t* cmd)
+{
+	NotNull(buffer);
+	NotNull(cmd);
+	Assert(cmd->type > RenderCmdType_None && cmd->type < RenderCmdType_NumTypes);
+	
+	u64 payloadSize = GetRenderCmdPayloadSize(cmd->type);
+	u64 cmdSize = sizeof(RenderCmdHeader_t) + payloadSize;
+	if ((cmdSize % RENDER_CMD_ALIGNMENT) != 0) { cmdSize += RENDER_CMD_ALIGNMENT - (cmdSize % RENDER_CMD_ALIGNMENT); }
+	Assert(cmdSize <= 0xFFFF);
+	
+	// +==============================+
+	// |            Stats             |
+	// +==============================+
+	RenderCmdStats_t* stats = &buffer->stats;
+	stats->numCommands++;
+	stats->numBytes += cmdSize;
+	stats->commandCounts[cmd->type]++;
+	bool isRedundant = false;
+	if (CanRenderCmdBeRedundant(cmd->type))
+	{
+		isRedundant = (buffer->hasLastPayload[cmd->type] && MyMemCompare(&buffer->lastPayloads[cmd->type], &cmd->payload, payloadSize) == 0);
+		MyMemCopy(&buffer->lastPayloads[cmd->type], &cmd->payload, payloadSize);
+		buffer->hasLastPayload[cmd->type] = true;
+	}
+	switch (GetRenderCmdCategory(cmd->type))
+	{
+		case RenderCmdCategory_State:
+		{
+			stats->numStateChanges++;
+			if (isRedundant) { stats->numRedundantStateChanges++; }
+		} break;
+		case RenderCmdCategory_Uniform:
+		{
+			stats->numUniformSets++;
+			stats->uniformBytes += GetRenderCmdUniformBytes(cmd);
+			if (isRedundant) { stats->numRedundantUniformSets++; }
+		} break;
+		case RenderCmdCategory_Clear: stats->numClears++; break;
+		case RenderCmdCategory_Draw: stats->numDrawCalls++; break;
+	}
+	//A new shader starts with whatever uniform values it last had, so comparing against the previous shader's values would be misleading
+	if (cmd->type == RenderCmdType_BindShader)
+	{
+		for (u64 tIndex = RenderCmdType_SetWorldMatrix; tIndex <= RenderCmdType_SetDynamicUniformMat4; tIndex++) { buffer->hasLastPayload[tIndex] = false; }
+	}
+	
+	if (!buffer->recording) { return; }
+	
+	// +==============================+
+	// |            Encode            |
+	// +==============================+
+	if (buffer->length + cmdSize > buffer->allocLength)
+	{
+		NotNull(buffer->allocArena);
+		u64 newAllocLength = MaxU64(buffer->allocLength * 2, RENDER_CMD_BUFFER_INITIAL_SIZE);
+		while (newAllocLength < buffer->length + cmdSize) { newAllocLength *= 2; }
+		u8* newData = AllocArray(buffer->allocArena, u8, newAllocLength);
+		NotNull(newData);
+		if (buffer->data != nullptr)
+		{
+			if (buffer->length > 0) { MyMemCopy(newData, buffer->data, buffer->length); }
+			FreeMem(buffer->allocArena, buffer->data, buffer->allocLength);
+		}
+		buffer->data = newData;
+		buffer->allocLength = newAllocLength;
+	}
+	
+	RenderCmdHeader_t* header = (RenderCmdHeader_t*)&buffer->data[buffer->length];
+	header->type = (u8)cmd->type;
+	header->flags = 0x00;
+	header->size = (u16)cmdSize;
+	header->reserved = 0;
+	u8* payloadPntr = (u8*)(header + 1);
+	if (payloadSize > 0) { MyMemCopy(payloadPntr, &cmd->payload, payloadSize); }
+	if (cmdSize > sizeof(RenderCmdHeader_t) + payloadSize) { MyMemSet(payloadPntr + payloadSize, 0x00, cmdSize - (sizeof(RenderCmdHeader_t) + payloadSize)); }
+	buffer->length += cmdSize;
+}
+
+//Decodes the command at *offset and moves offset past it. Returns false at the end of the buffer
+bool RenderCmdBufferGet(const RenderCmdBuffer_t* buffer, u64* offset, RenderCmd_t* cmdOut)
+{
+	NotNull(buffer);
+	NotNull(offset);
+	NotNull(cmdOut);
+	if (*offset + sizeof(RenderCmdHeader_t) > buffer->length) { return false; }
+	
+	const RenderCmdHeader_t* header = (const RenderCmdHeader_t*)&buffer->data[*offset];
+	Assert(header->type > RenderCmdType_None && header->type < RenderCmdType_NumTypes);
+	Assert(header->size >= sizeof(RenderCmdHeader_t) && *offset + header->size <= buffer->length);
+	u64 payloadSize = GetRenderCmdPayloadSize((RenderCmdType_t)header->type);
+	
+	ClearPointer(cmdOut);
+	cmdOut->type = (RenderCmdType_t)header->type;
+	if (payloadSize > 0) { MyMemCopy(&cmdOut->payload, (const u8*)(header + 1), payloadSize); }
+	*offset += header->size;
+	return true;
+}
+
+bool DumpRenderCmdBuffer(const RenderCmdBuffer_t* buffer, MyStr_t filePath)
+{
+	NotNull(buffer);
+	NotNullStr(&filePath);
+	
+	MemArena_t* scratch = GetScratchArena();
+	u64 fileSize = sizeof(RenderCmdDumpHeader_t) + buffer->length;
+	u8* fileData = AllocArray(scratch, u8, fileSize);
+	NotNull(fileData);
+	
+	RenderCmdDumpHeader_t* header = (RenderCmdDumpHeader_t*)fileData;
+	MyMemCopy(&header->magic[0], RENDER_CMD_DUMP_MAGIC, sizeof(header->magic));
+	header->version = RENDER_CMD_DUMP_VERSION;
+	header->numCommands = buffer->stats.numCommands;
+	header->numBytes = buffer->length;
+	if (buffer->length > 0) { MyMemCopy(fileData + sizeof(RenderCmdDumpHeader_t), buffer->data, buffer->length); }
+	
+	bool result = plat->WriteEntireFile(filePath, fileData, fileSize);
+	FreeScratchArena(scratch);
+	return result;
+}
@@ -0,0 +1,256 @@
+/*
+File:   pig_render_commands.h
+Date:   10\19\2026
+Description:
+	** Every state change, uniform set, and draw that the RenderContext_t front-end makes is encoded as a small
+	** command and appended to a RenderCmdBuffer_t before being handed to the active backend. The buffer can be
+	** replayed later, dumped to a file, or executed by the null backend (RenderApi_None) for profiling the
+	** front-end without any GPU work
+*/
+
+#ifndef _PIG_RENDER_COMMANDS_H
+#define _PIG_RENDER_COMMANDS_H
+
+#define RENDER_CMD_BUFFER_INITIAL_SIZE   Kilobytes(64)
+#define RENDER_CMD_ALIGNMENT             8 //bytes
+#define RENDER_CMD_DUMP_MAGIC            "PRCB"
+#define RENDER_CMD_DUMP_VERSION          3
+
+enum RenderCmdType_t
+{
+	RenderCmdType_None = 0,
+	RenderCmdType_SetFaceCulling,
+	RenderCmdType_SetDepthTestEnabled,
+	RenderCmdType_SetFillMode,
+	RenderCmdType_BindFrameBuffer,
+	RenderCmdType_BindShader,
+	RenderCmdType_BindVao,
+	RenderCmdType_BindTexture1,
+	RenderCmdType_BindTexture2,
+	RenderCmdType_BindVertBuffer,
+	RenderCmdType_SetViewport,
+	RenderCmdType_SetWorldMatrix,
+	RenderCmdType_SetViewMatrix,
+	RenderCmdType_SetProjectionMatrix,
+	RenderCmdType_SetCameraPosition,
+	RenderCmdType_SetPlayerPosition,
+	RenderCmdType_SetColor1,
+	RenderCmdType_SetColor2,
+	RenderCmdType_SetScreenSpaceEffectColor,
+	RenderCmdType_SetSourceRec1,
+	RenderCmdType_SetSourceRec2,
+	RenderCmdType_SetShiftVec,
+	RenderCmdType_SetCount,
+	RenderCmdType_SetCircleRadius,
+	RenderCmdType_SetCircleInnerRadius,
+	RenderCmdType_SetTime,
+	RenderCmdType_SetSaturation,
+	RenderCmdType_SetBrightness,
+	RenderCmdType_SetPolygonPlanes,
+	RenderCmdType_SetValue,
+	RenderCmdType_SetDynamicUniformR32,
+	RenderCmdType_SetDynamicUniformVec2,
+	RenderCmdType_SetDynamicUniformVec3,
+	RenderCmdType_SetDynamicUniformVec4,
+	RenderCmdType_SetDynamicUniformMat4,
+	RenderCmdType_ClearColor,
+	RenderCmdType_ClearDepth,
+	RenderCmdType_ClearStencil,
+	RenderCmdType_DrawBuffer,
+	RenderCmdType_StartStencilDrawing,
+	RenderCmdType_SetStencilPolarity,
+	RenderCmdType_UseStencil,
+	RenderCmdType_DisableStencil,
+	RenderCmdType_Begin,
+	RenderCmdType_NumTypes,
+};
+const char* GetRenderCmdTypeStr(RenderCmdType_t cmdType)
+{
+	switch (cmdType)
+	{
+		case RenderCmdType_None:                      return "None";
+		case RenderCmdType_SetFaceCulling:            return "SetFaceCulling";
+		case RenderCmdType_SetDepthTestEnabled:       return "SetDepthTestEnabled";
+		case RenderCmdType_SetFillMode:               return "SetFillMode";
+		case RenderCmdType_BindFrameBuffer:           return "BindFrameBuffer";
+		case RenderCmdType_BindShader:                return "BindShader";
+		case RenderCmdType_BindVao:                   return "BindVao";
+		case RenderCmdType_BindTexture1:              return "BindTexture1";
+		case RenderCmdType_BindTexture2:              return "BindTexture2";
+		case RenderCmdType_BindVertBuffer:            return "BindVertBuffer";
+		case RenderCmdType_SetViewport:               return "SetViewport";
+		case RenderCmdType_SetWorldMatrix:            return "SetWorldMatrix";
+		case RenderCmdType_SetViewMatrix:             return "SetViewMatrix";
+		case RenderCmdType_SetProjectionMatrix:       return "SetProjectionMatrix";
+		case RenderCmdType_SetCameraPosition:         return "SetCameraPosition";
+		case RenderCmdType_SetPlayerPosition:         return "SetPlayerPosition";
+		case RenderCmdType_SetColor1:                 return "SetColor1";
+		case RenderCmdType_SetColor2:                 return "SetColor2";
+		case RenderCmdType_SetScreenSpaceEffectColor: return "SetScreenSpaceEffectColor";
+		case RenderCmdType_SetSourceRec1:             return "SetSourceRec1";
+		case RenderCmdType_SetSourceRec2:             return "SetSourceRec2";
+		case RenderCmdType_SetShiftVec:               return "SetShiftVec";
+		case RenderCmdType_SetCount:                  return "SetCount";
+		case RenderCmdType_SetCircleRadius:           return "SetCircleRadius";
+		case RenderCmdType_SetCircleInnerRadius:      return "SetCircleInnerRadius";
+		case RenderCmdType_SetTime:                   return "SetTime";
+		case RenderCmdType_SetSaturation:             return "SetSaturation";
+		case RenderCmdType_SetBrightness:             return "SetBrightness";
+		case RenderCmdType_SetPolygonPlanes:          return "SetPolygonPlanes";
+		case RenderCmdType_SetValue:                  return "SetValue";
+		case RenderCmdType_SetDynamicUniformR32:      return "SetDynamicUniformR32";
+		case RenderCmdType_SetDynamicUniformVec2:     return "SetDynamicUniformVec2";
+		case RenderCmdType_SetDynamicUniformVec3:     return "SetDynamicUniformVec3";
+		case RenderCmdType_SetDynamicUniformVec4:     return "SetDynamicUniformVec4";
+		case RenderCmdType_SetDynamicUniformMat4:     return "SetDynamicUniformMat4";
+		case RenderCmdType_ClearColor:                return "ClearColor";
+		case RenderCmdType_ClearDepth:                return "ClearDepth";
+		case RenderCmdType_ClearStencil:              return "ClearStencil";
+		case RenderCmdType_DrawBuffer:                return "DrawBuffer";
+		case RenderCmdType_StartStencilDrawing:       return "StartStencilDrawing";
+		case RenderCmdType_SetStencilPolarity:        return "SetStencilPolarity";
+		case RenderCmdType_UseStencil:                return "UseStencil";
+		case RenderCmdType_DisableStencil:            return "DisableStencil";
+		case RenderCmdType_Begin:                     return "Begin";
+		default: return "Unknown";
+	}
+}
+
+enum RenderCmdCategory_t
+{
+	RenderCmdCategory_None = 0,
+	RenderCmdCategory_State,
+	RenderCmdCategory_Uniform,
+	RenderCmdCategory_Clear,
+	RenderCmdCategory_Draw,
+	RenderCmdCategory_NumCategories,
+};
+RenderCmdCategory_t GetRenderCmdCategory(RenderCmdType_t cmdType)
+{
+	if (cmdType >= RenderCmdType_SetWorldMatrix && cmdType <= RenderCmdType_SetDynamicUniformMat4) { return RenderCmdCategory_Uniform; }
+	if (cmdType >= RenderCmdType_ClearColor && cmdType <= RenderCmdType_ClearStencil) { return RenderCmdCategory_Clear; }
+	if (cmdType == RenderCmdType_DrawBuffer) { return RenderCmdCategory_Draw; }
+	if (cmdType == RenderCmdType_None || cmdType >= RenderCmdType_NumTypes) { return RenderCmdCategory_None; }
+	return RenderCmdCategory_State;
+}
+
+//NOTE: The value always starts at the same offset no matter which member is used, GetRenderCmdPayloadSize
+//      and RenderCmdUpdateUniformShadow both rely on that to size the value part (see GetRenderCmdDynamicValueOffset)
+struct RenderCmdDynamicUniformPayload_t
+{
+	ShaderDynamicUniform_t* uniform;
+	union
+	{
+		r32 r32Value;
+		v2 vec2Value;
+		v3 vec3Value;
+		v4 vec4Value;
+		mat4 mat4Value;
+	};
+};
+
+//NOTE: Pointers to resources (shaders, textures, buffers, etc.) are stored as-is so the
+//      command stream is only meaningful inside the process that recorded it
+union RenderCmdPayload_t
+{
+	bool enabled; //SetFaceCulling, SetDepthTestEnabled, SetStencilPolarity, UseStencil
+	PolygonFillMode_t fillMode;
+	FrameBuffer_t* frameBuffer;
+	Shader_t* shader;
+	VertexArrayObject_t* vao;
+	Texture_t* texture;
+	const VertBuffer_t* vertBuffer;
+	rec rectangle; //SetViewport
+	mat4 matrix;
+	v2 vec2;
+	v3 vec3;
+	Colorf_t colorf;
+	Color_t color; //ClearColor
+	i32 intValue;
+	r32 floatValue;
+	v2 polygonPlanes[ShaderUniform_NumPolygonPlanes];
+	struct { rec rectangle; bool flipped; r32 textureHeight; } sourceRec;
+	struct { u8 index; r32 value; } value;
+	RenderCmdDynamicUniformPayload_t dynamic;
+	struct
+	{
+		VertBufferPrimitive_t primitive;
+		u64 startIndex;
+		u64 numElements;
+		u64 vertexOffset;
+	} draw;
+};
+
+//NOTE: Each command is stored as a header followed by only the bytes of the payload
+//      that the command type actually uses, padded out to RENDER_CMD_ALIGNMENT
+struct RenderCmdHeader_t
+{
+	u8 type; //RenderCmdType_t
+	u8 flags; //unused for now
+	u16 size; //including the header and padding
+	u32 reserved;
+};
+
+struct RenderCmd_t
+{
+	RenderCmdType_t type;
+	RenderCmdPayload_t payload;
+};
+
+struct RenderCmdStats_t
+{
+	u64 numCommands;
+	u64 numStateChanges;
+	u64 numRedundantStateChanges;
+	u64 numUniformSets;
+	u64 numRedundantUniformSets;
+	u64 uniformBytes;
+	u64 numFilteredUniformSets; //never pushed or executed because the bound shader already had the value (see RcIsUniformCmdRedundant)
+	u64 filteredUniformBytes;
+	u64 numClears;
+	u64 numDrawCalls;
+	u64 numBytes;
+	u64 commandCounts[RenderCmdType_NumTypes];
+	r64 frameTime; //ms between RcStartFrame and RcEndFrame, only front-end cost when the backend is RenderApi_None
+};
+
+//NOTE: A dump file is this header followed by the raw command bytes
+START_PACK()
+struct ATTR_PACKED RenderCmdDumpHeader_t
+{
+	char magic[4]; //RENDER_CMD_DUMP_MAGIC
+	u32 version; //RENDER_CMD_DUMP_VERSION
+	u64 numCommands;
+	u64 numBytes;
+};
+END_PACK()
+
+#define RENDER_CMD_NUM_SHADOWED_UNIFORMS   (RenderCmdType_SetPolygonPlanes+1 - RenderCmdType_SetWorldMatrix)
+
+//NOTE: Uniform values are part of the program object in OpenGL so they survive binding other shaders in between.
+//      This remembers what each built-in uniform was last set to, per shader, so re-binding a shader (which re-sends
+//      everything in RcBindShader) or setting a value it already has doesn't produce a command at all.
+//      Dynamic uniforms keep their shadow in ShaderDynamicUniform_t
+struct ShaderUniformShadow_t
+{
+	u64 stamp; //rc->uniformShadowStamp when this was last written, everything is treated as unknown when it doesn't match
+	bool hasPayload[RENDER_CMD_NUM_SHADOWED_UNIFORMS];
+	RenderCmdPayload_t payloads[RENDER_CMD_NUM_SHADOWED_UNIFORMS]; //indexed by (type - RenderCmdType_SetWorldMatrix)
+	bool hasValue[ShaderUniform_NumGenericValues];
+	r32 values[ShaderUniform_NumGenericValues];
+};
+
+struct RenderCmdBuffer_t
+{
+	MemArena_t* allocArena;
+	bool recording;
+	u64 allocLength;
+	u64 length;
+	u8* data;
+	
+	RenderCmdStats_t stats;
+	bool hasLastPayload[RenderCmdType_NumTypes];
+	RenderCmdPayload_t lastPayloads[RenderCmdType_NumTypes]; //used to detect redundant commands
+};
+
+#endif //  _PIG_RENDER_COMMANDS_H
@@ -7,7 +7,40 @@ Date:   12\30\2021
 #ifndef _PIG_RENDER_CONTEXT_H
 #define _PIG_RENDER_CONTEXT_H
 
-#define RC_SCRATCH_BUFFER_SIZE   32 //vertices
+#define RC_SCRATCH_BUFFER_SIZE          32 //vertices
+
+//One visible copy of a model part, written by BuildModelDrawBatches
+struct RcModelInstance_t
+{
+	mat4 worldMatrix; //includes the augmentMatrix
+	Colorf_t color;
+};
+
+struct RcQueuedModel_t
+{
+	Model_t* model;
+	mat4 worldMatrix; //includes the augmentMatrix
+	Color_t color;
+};
+
+//Every instance in a batch draws the same part of the same model
+struct RcModelDrawBatch_t
+{
+	Model_t* model;
+	u64 partIndex;
+	u64 firstInstance;
+	u64 numInstances;
+};
+
+struct RcModelStats_t
+{
+	u64 numQueued;
+	u64 numModelsCulled; //whole model copies thrown out by Model_t bounds
+	u64 numPartsCulled; //includes the parts of culled models
+	u64 numPartsDrawn;
+	u64 numBatches;
+	r64 cullTime; //ms, includes building batches for queued models
+};
 
 struct RenderContextState_t
 {
@@ -20,6 +53,7 @@ struct RenderContextState_t
 	Shader_t* boundShader;
 	VertexArrayObject_t* boundVao;
 	Texture_t* boundTexture1;
+	Texture_t* boundApiTexture1; //what the backend actually has bound, the atlas page when boundTexture1 lives in a TextureAtlas_t. nullptr means unknown
 	Texture_t* boundTexture2;
 	SpriteSheet_t* boundSpriteSheet;
 	const VertBuffer_t* boundBuffer;
@@ -95,11 +129,26 @@ struct RenderContext_t
 	VertBuffer_t scratchBuffer2D; //RC_SCRATCH_BUFFER_SIZE vertices
 	VertBuffer_t scratchBuffer3D; //RC_SCRATCH_BUFFER_SIZE vertices
 	VertBuffer_t sphereBuffers[SphereQuality_NumQualities];
+	Shader_t fontSdfShader; //draws FontBakeFlag_IsSdf font bakes, see pig_font_shaders.cpp
 	
 	VarArray_t vertexArrayObjs; //VertexArrayObject_t TODO: Maybe we should make this a linked list so that pointers don't go invalid?
 	RenderContextState_t state; //TODO: Add support for pushing/popping the state
 	
+	RenderApi_t cmdBackend; //normally pig->renderApi, switched to RenderApi_None to measure the front-end alone
+	RenderCmdBuffer_t cmdBuffer; //cleared by RcStartFrame
+	PerfTime_t frameStartTime;
+	RenderCmdStats_t lastFrameStats;
+	bool filterUniforms; //when true uniform sets the bound shader already has are dropped before they are recorded or executed
+	u64 uniformShadowStamp; //bumped by RcInvalidateUniformShadows, every frame starts by re-sending uniforms so the recorded stream stands on its own
+	
+	bool modelCulling; //RcDrawModel* and RcFlushModelQueue skip parts that are outside the view frustum
+	bool flushingModelQueue;
+	VarArray_t modelQueue; //RcQueuedModel_t, see RcQueueModel
+	RcModelStats_t modelStats;
+	RcModelStats_t lastModelStats;
+	
 	FontFlowInfo_t flowInfo;
+	TextLayoutCache_t textLayoutCache;
 };
 
 #endif //  _PIG_RENDER_CONTEXT_H
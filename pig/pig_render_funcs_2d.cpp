@@ -415,6 +415,13 @@ void RcDrawSheetFrame(v2i frame, rec rectangle, Color_t color, bool flipX = fals
 {
 	NotNull(rc->state.boundSpriteSheet);
 	SpriteSheet_t* sheet = rc->state.boundSpriteSheet;
+	const SpriteSheetFrame_t* sheetFrame = nullptr;
+	if (sheet->isTrimmed)
+	{
+		//Trimmed frames only cover their non-transparent pixels, fully transparent frames have nothing to draw
+		sheetFrame = TryGetSpriteSheetFrame(sheet, frame);
+		if (sheetFrame == nullptr || !sheetFrame->filled) { return; }
+	}
 	rec sourceRec = GetSpriteSheetFrameSourceRec(sheet, frame);
 	if (flipX) { sourceRec.x += sourceRec.width; sourceRec.width = -sourceRec.width; }
 	if (flipY) { sourceRec.y += sourceRec.height; sourceRec.height = -sourceRec.height; }
@@ -426,11 +433,13 @@ void RcDrawSheetFrame(v2i frame, rec rectangle, Color_t color, bool flipX = fals
 		else if (rotation == Dir2_Up)    { boundingBox.rotation = Pi32;           }
 		else if (rotation == Dir2_Right) { boundingBox.rotation = ThreeHalfsPi32; }
 		else { AssertMsg(false, "Rotation is an unsupported value"); }
+		if (sheetFrame != nullptr) { boundingBox = GetSpriteSheetTrimmedDestObb(sheet, sheetFrame, boundingBox, flipX, flipY); }
 		RcBindTexture1(&sheet->texture);
 		RcDrawTexturedObb2(boundingBox, color, sourceRec);
 	}
 	else
 	{
+		if (sheetFrame != nullptr) { rectangle = GetSpriteSheetTrimmedDestRec(sheet, sheetFrame, rectangle, flipX, flipY); }
 		RcBindTexture1(&sheet->texture);
 		RcDrawTexturedPartRectangle(rectangle, color, sourceRec);
 	}
@@ -454,6 +463,12 @@ void RcDrawSheetFrame(v2i frame, obb2 boundingBox, Color_t color, bool flipX = f
 {
 	NotNull(rc->state.boundSpriteSheet);
 	SpriteSheet_t* sheet = rc->state.boundSpriteSheet;
+	if (sheet->isTrimmed)
+	{
+		const SpriteSheetFrame_t* sheetFrame = TryGetSpriteSheetFrame(sheet, frame);
+		if (sheetFrame == nullptr || !sheetFrame->filled) { return; }
+		boundingBox = GetSpriteSheetTrimmedDestObb(sheet, sheetFrame, boundingBox, flipX, flipY);
+	}
 	rec sourceRec = GetSpriteSheetFrameSourceRec(sheet, frame);
 	if (flipX) { sourceRec.x += sourceRec.width; sourceRec.width = -sourceRec.width; }
 	if (flipY) { sourceRec.y += sourceRec.height; sourceRec.height = -sourceRec.height; }
@@ -400,6 +400,35 @@ void RcApplyModelMaterial(ModelTextureType_t textureType, ModelMaterial_t* mater
 	RcSetDynamicUniformR32("SpecularExponent", material->specularExponent);
 }
 
+// +==============================+
+// |        Model Culling         |
+// +==============================+
+Frustum_t RcGetViewFrustum()
+{
+	NotNull(rc);
+	return NewFrustum(Mat4Multiply(rc->state.projectionMatrix, rc->state.viewMatrix));
+}
+
+//cullMatrix should already include the augmentMatrix. Culled models and parts are counted in rc->modelStats
+bool RcIsModelInView(const Frustum_t* frustum, const Model_t* model, const mat4& cullMatrix)
+{
+	if (!rc->modelCulling || !model->hasBounds) { return true; }
+	if (IsBoxInFrustum(frustum, cullMatrix, model->boundsMin, model->boundsMax)) { return true; }
+	rc->modelStats.numModelsCulled++;
+	rc->modelStats.numPartsCulled += model->parts.length;
+	return false;
+}
+bool RcIsModelPartInView(const Frustum_t* frustum, const Model_t* model, const ModelPart_t* part, const mat4& cullMatrix)
+{
+	if (!rc->modelCulling || !model->hasBounds) { return true; }
+	if (IsBoxInFrustum(frustum, cullMatrix, part->boundsMin, part->boundsMax)) { return true; }
+	rc->modelStats.numPartsCulled++;
+	return false;
+}
+
+// +==============================+
+// |         Model Draws          |
+// +==============================+
 void RcDrawModelSimple(v3 position, quat rotation, v3 scale, Color_t color)
 {
 	NotNull(rc->state.boundModel);
@@ -409,15 +438,19 @@ void RcDrawModelSimple(v3 position, quat rotation, v3 scale, Color_t color)
 	Mat4Transform(worldMatrix, Mat4Translate3(position));
 	RcSetWorldMatrix(worldMatrix);
 	RcSetColor1(color);
+	Frustum_t frustum = RcGetViewFrustum();
+	mat4 cullMatrix = Mat4Multiply(rc->state.augmentMatrix, worldMatrix);
+	if (!RcIsModelInView(&frustum, rc->state.boundModel, cullMatrix)) { return; }
 	VarArrayLoop(&rc->state.boundModel->parts, pIndex)
 	{
 		VarArrayLoopGet(ModelPart_t, part, &rc->state.boundModel->parts, pIndex);
-		if (part->buffer.isValid)
+		if (part->buffer.isValid && RcIsModelPartInView(&frustum, rc->state.boundModel, part, cullMatrix))
 		{
 			ModelMaterial_t* material = VarArrayGetHard(&rc->state.boundModel->materials, part->materialIndex, ModelMaterial_t);
 			RcApplyModelMaterial(rc->state.boundModel->textureType, material);
 			RcBindVertBuffer(&part->buffer);
 			RcDrawBuffer(VertBufferPrimitive_Triangles);
+			rc->modelStats.numPartsDrawn++;
 		}
 	}
 }
@@ -431,15 +464,49 @@ void RcDrawModelParts(u64 startPartIndex, u64 numParts, v3 position, quat rotati
 	Mat4Transform(worldMatrix, Mat4Translate3(position));
 	RcSetWorldMatrix(worldMatrix);
 	RcSetColor1(color);
+	//The whole model box isn't checked here since it's likely we are only drawing a few parts of a larger model
+	Frustum_t frustum = RcGetViewFrustum();
+	mat4 cullMatrix = Mat4Multiply(rc->state.augmentMatrix, worldMatrix);
 	for (u64 pIndex = startPartIndex; pIndex < startPartIndex + numParts; pIndex++)
+	{
+		VarArrayLoopGet(ModelPart_t, part, &rc->state.boundModel->parts, pIndex);
+		if (part->buffer.isValid && RcIsModelPartInView(&frustum, rc->state.boundModel, part, cullMatrix))
+		{
+			ModelMaterial_t* material = VarArrayGetHard(&rc->state.boundModel->materials, part->materialIndex, ModelMaterial_t);
+			RcApplyModelMaterial(rc->state.boundModel->textureType, material);
+			RcBindVertBuffer(&part->buffer);
+			RcDrawBuffer(VertBufferPrimitive_Triangles);
+			rc->modelStats.numPartsDrawn++;
+		}
+	}
+}
+//Parts are rigidly attached to their bone, the palette comes from an AnimPoseBatch_t (see GetAnimPosePalette) evaluated against skeleton
+//The rest pose model box means nothing once the bones move so only the parts are culled (each with its own bone transform)
+void RcDrawModelPosed(const Skeleton_t* skeleton, const mat4* palette, v3 position, quat rotation, v3 scale, Color_t color)
+{
+	NotNull(rc->state.boundModel);
+	NotNull2(skeleton, palette);
+	Assert(skeleton->numParts == rc->state.boundModel->parts.length);
+	mat4 worldMatrix = Mat4_Identity;
+	Mat4Transform(worldMatrix, Mat4Scale3(scale));
+	Mat4Transform(worldMatrix, Mat4Quaternion(rotation));
+	Mat4Transform(worldMatrix, Mat4Translate3(position));
+	RcSetColor1(color);
+	Frustum_t frustum = RcGetViewFrustum();
+	VarArrayLoop(&rc->state.boundModel->parts, pIndex)
 	{
 		VarArrayLoopGet(ModelPart_t, part, &rc->state.boundModel->parts, pIndex);
 		if (part->buffer.isValid)
 		{
+			u16 boneIndex = skeleton->partBoneIndices[pIndex];
+			mat4 partMatrix = (boneIndex != ANIM_NO_BONE_INDEX) ? Mat4Multiply(worldMatrix, palette[boneIndex]) : worldMatrix;
+			if (!RcIsModelPartInView(&frustum, rc->state.boundModel, part, Mat4Multiply(rc->state.augmentMatrix, partMatrix))) { continue; }
+			RcSetWorldMatrix(partMatrix);
 			ModelMaterial_t* material = VarArrayGetHard(&rc->state.boundModel->materials, part->materialIndex, ModelMaterial_t);
 			RcApplyModelMaterial(rc->state.boundModel->textureType, material);
 			RcBindVertBuffer(&part->buffer);
 			RcDrawBuffer(VertBufferPrimitive_Triangles);
+			rc->modelStats.numPartsDrawn++;
 		}
 	}
 }
@@ -455,17 +522,231 @@ void RcDrawModelCustomTexture(v3 position, quat rotation, v3 scale, Color_t colo
 	RcSetWorldMatrix(worldMatrix);
 	RcSetColor1(color);
 	RcSetSourceRec1(sourceRec);
+	Frustum_t frustum = RcGetViewFrustum();
+	mat4 cullMatrix = Mat4Multiply(rc->state.augmentMatrix, worldMatrix);
+	if (!RcIsModelInView(&frustum, rc->state.boundModel, cullMatrix)) { return; }
 	VarArrayLoop(&rc->state.boundModel->parts, pIndex)
 	{
 		VarArrayLoopGet(ModelPart_t, part, &rc->state.boundModel->parts, pIndex);
-		if (part->buffer.isValid)
+		if (part->buffer.isValid && RcIsModelPartInView(&frustum, rc->state.boundModel, part, cullMatrix))
 		{
 			ModelMaterial_t* material = VarArrayGetHard(&rc->state.boundModel->materials, part->materialIndex, ModelMaterial_t);
 			RcApplyModelMaterial(rc->state.boundModel->textureType, material, false);
 			RcBindVertBuffer(&part->buffer);
 			RcDrawBuffer(VertBufferPrimitive_Triangles);
+			rc->modelStats.numPartsDrawn++;
+		}
+	}
+}
+
+// +==============================+
+// |         Model Queue          |
+// +==============================+
+//Queues a copy of the bound model to be drawn by RcFlushModelQueue, which happens on it's own before the shader, frame buffer,
+//view or projection matrix changes and at the end of the frame. Textures, material uniforms, world matrix and color1 are set
+//by the flush, any other uniform the shader reads is whatever it happens to be at flush time.
+//The flush culls every copy and draws the survivors grouped by model and part, so each material and vertex buffer is bound
+//once per flush instead of once per copy. Every copy is still it's own draw call
+void RcQueueModel(v3 position, quat rotation, v3 scale, Color_t color)
+{
+	NotNull(rc->state.boundModel);
+	mat4 worldMatrix = Mat4_Identity;
+	Mat4Transform(worldMatrix, Mat4Scale3(scale));
+	Mat4Transform(worldMatrix, Mat4Quaternion(rotation));
+	Mat4Transform(worldMatrix, Mat4Translate3(position));
+	RcQueuedModel_t* queued = VarArrayAdd(&rc->modelQueue, RcQueuedModel_t);
+	NotNull(queued);
+	queued->model = rc->state.boundModel;
+	queued->worldMatrix = Mat4Multiply(rc->state.augmentMatrix, worldMatrix);
+	queued->color = color;
+	rc->modelStats.numQueued++;
+}
+
+//Groups the queue by model (keeping queue order within each model), culls every copy and then every part of every copy against
+//the frustum and writes the surviving copies into instancesOut one part at a time, so each RcModelDrawBatch_t is a contiguous
+//range. instancesOut needs room for every part of every queued model. Doesn't touch rc so it can be run (and timed) headless
+u64 BuildModelDrawBatches(const RcQueuedModel_t* queue, u64 numQueued, const Frustum_t* frustum, bool culling, RcModelInstance_t* instancesOut, VarArray_t* batchesOut, RcModelStats_t* stats)
+{
+	NotNull3(frustum, batchesOut, stats);
+	if (numQueued == 0) { return 0; }
+	NotNull2(queue, instancesOut);
+	
+	//Big queues can outgrow a scratch arena so the working arrays come from mainHeap in one allocation
+	u64 workSpaceSize = numQueued * (sizeof(Model_t*) + sizeof(u64)*4 + sizeof(bool));
+	u8* workSpace = AllocArray(mainHeap, u8, workSpaceSize);
+	NotNull(workSpace);
+	Model_t** groupModels = (Model_t**)workSpace;
+	u64* groupStarts = (u64*)(workSpace + numQueued * sizeof(Model_t*));
+	u64* groupCounts = groupStarts + numQueued;
+	u64* queueGroups = groupCounts + numQueued;
+	u64* sortedIndices = queueGroups + numQueued;
+	bool* copyVisible = (bool*)(sortedIndices + numQueued);
+	
+	// +==============================+
+	// |       Group By Model         |
+	// +==============================+
+	//Real scenes only have a handful of distinct models per flush, and runs of the same model are common, so a linear search that checks the last hit first is plenty
+	u64 numGroups = 0;
+	u64 lastGroup = 0;
+	for (u64 qIndex = 0; qIndex < numQueued; qIndex++)
+	{
+		Model_t* model = queue[qIndex].model;
+		NotNull(model);
+		if (numGroups == 0 || groupModels[lastGroup] != model)
+		{
+			bool foundGroup = false;
+			for (u64 gIndex = 0; gIndex < numGroups; gIndex++)
+			{
+				if (groupModels[gIndex] == model) { lastGroup = gIndex; foundGroup = true; break; }
+			}
+			if (!foundGroup)
+			{
+				lastGroup = numGroups;
+				groupModels[numGroups] = model;
+				groupCounts[numGroups] = 0;
+				numGroups++;
+			}
+		}
+		queueGroups[qIndex] = lastGroup;
+		groupCounts[lastGroup]++;
+	}
+	u64 nextStart = 0;
+	for (u64 gIndex = 0; gIndex < numGroups; gIndex++)
+	{
+		groupStarts[gIndex] = nextStart;
+		nextStart += groupCounts[gIndex];
+		groupCounts[gIndex] = 0; //reused as the fill count below
+	}
+	for (u64 qIndex = 0; qIndex < numQueued; qIndex++)
+	{
+		u64 gIndex = queueGroups[qIndex];
+		sortedIndices[groupStarts[gIndex] + groupCounts[gIndex]] = qIndex;
+		groupCounts[gIndex]++;
+	}
+	
+	// +==============================+
+	// |      Cull and Batch Parts    |
+	// +==============================+
+	u64 numInstances = 0;
+	for (u64 gIndex = 0; gIndex < numGroups; gIndex++)
+	{
+		Model_t* model = groupModels[gIndex];
+		const u64* groupIndices = &sortedIndices[groupStarts[gIndex]];
+		u64 groupCount = groupCounts[gIndex];
+		bool cullModel = (culling && model->hasBounds);
+		
+		u64 numVisibleCopies = 0;
+		for (u64 cIndex = 0; cIndex < groupCount; cIndex++)
+		{
+			const RcQueuedModel_t* queued = &queue[groupIndices[cIndex]];
+			copyVisible[cIndex] = (!cullModel || IsBoxInFrustum(frustum, queued->worldMatrix, model->boundsMin, model->boundsMax));
+			if (copyVisible[cIndex]) { numVisibleCopies++; }
+			else
+			{
+				stats->numModelsCulled++;
+				stats->numPartsCulled += model->parts.length;
+			}
+		}
+		if (numVisibleCopies == 0) { continue; }
+		
+		VarArrayLoop(&model->parts, pIndex)
+		{
+			VarArrayLoopGet(ModelPart_t, part, &model->parts, pIndex);
+			if (!part->buffer.isValid) { continue; }
+			u64 firstInstance = numInstances;
+			for (u64 cIndex = 0; cIndex < groupCount; cIndex++)
+			{
+				if (!copyVisible[cIndex]) { continue; }
+				const RcQueuedModel_t* queued = &queue[groupIndices[cIndex]];
+				//A model with only one part has a part box that's the same as the model box, no need to check it twice
+				if (cullModel && model->parts.length > 1 && !IsBoxInFrustum(frustum, queued->worldMatrix, part->boundsMin, part->boundsMax))
+				{
+					stats->numPartsCulled++;
+					continue;
+				}
+				RcModelInstance_t* instance = &instancesOut[numInstances];
+				instance->worldMatrix = queued->worldMatrix;
+				instance->color = ToColorf(queued->color);
+				numInstances++;
+			}
+			
+			u64 batchCount = numInstances - firstInstance;
+			if (batchCount > 0)
+			{
+				RcModelDrawBatch_t* batch = VarArrayAdd(batchesOut, RcModelDrawBatch_t);
+				NotNull(batch);
+				batch->model = model;
+				batch->partIndex = pIndex;
+				batch->firstInstance = firstInstance;
+				batch->numInstances = batchCount;
+				stats->numBatches++;
+				stats->numPartsDrawn += batchCount;
+			}
+		}
+	}
+	
+	FreeMem(mainHeap, workSpace, workSpaceSize);
+	return numInstances;
+}
+
+//Safe to call at any time, does nothing if the queue is empty
+void RcFlushModelQueue()
+{
+	NotNull(rc);
+	if (rc->flushingModelQueue || rc->modelQueue.length == 0) { return; }
+	NotNull(rc->state.boundShader);
+	rc->flushingModelQueue = true;
+	
+	PerfTime_t cullStartTime = GetPerfTime();
+	u64 maxNumInstances = 0;
+	VarArrayLoop(&rc->modelQueue, qIndex)
+	{
+		VarArrayLoopGet(RcQueuedModel_t, queued, &rc->modelQueue, qIndex);
+		maxNumInstances += queued->model->parts.length;
+	}
+	RcModelInstance_t* instances = (maxNumInstances > 0) ? AllocArray(mainHeap, RcModelInstance_t, maxNumInstances) : nullptr;
+	if (maxNumInstances > 0) { NotNull(instances); }
+	
+	MemArena_t* scratch = GetScratchArena();
+	VarArray_t batches;
+	CreateVarArray(&batches, scratch, sizeof(RcModelDrawBatch_t));
+	Frustum_t frustum = RcGetViewFrustum();
+	BuildModelDrawBatches(
+		(const RcQueuedModel_t*)rc->modelQueue.items, rc->modelQueue.length,
+		&frustum, rc->modelCulling,
+		instances, &batches, &rc->modelStats
+	);
+	PerfTime_t cullEndTime = GetPerfTime();
+	rc->modelStats.cullTime += GetPerfTimeDiff(&cullStartTime, &cullEndTime);
+	
+	bool changedWorldMatrix = false;
+	VarArrayLoop(&batches, bIndex)
+	{
+		VarArrayLoopGet(RcModelDrawBatch_t, batch, &batches, bIndex);
+		ModelPart_t* part = VarArrayGetHard(&batch->model->parts, batch->partIndex, ModelPart_t);
+		ModelMaterial_t* material = VarArrayGetHard(&batch->model->materials, part->materialIndex, ModelMaterial_t);
+		RcApplyModelMaterial(batch->model->textureType, material);
+		RcBindVertBuffer(&part->buffer);
+		for (u64 iIndex = batch->firstInstance; iIndex < batch->firstInstance + batch->numInstances; iIndex++)
+		{
+			const RcModelInstance_t* instance = &instances[iIndex];
+			//The queued matrices already have the augmentMatrix baked in so they go straight to the command buffer
+			RcCmdSetWorldMatrix(instance->worldMatrix);
+			RcCmdSetColor1(instance->color);
+			RcDrawBuffer(VertBufferPrimitive_Triangles);
 		}
+		changedWorldMatrix = true;
 	}
+	if (changedWorldMatrix)
+	{
+		RcCmdSetWorldMatrix(Mat4Multiply(rc->state.augmentMatrix, rc->state.worldMatrix));
+		RcCmdSetColor1(rc->state.color1f);
+	}
+	
+	if (instances != nullptr) { FreeMem(mainHeap, instances, sizeof(RcModelInstance_t) * maxNumInstances); }
+	FreeScratchArena(scratch);
+	VarArrayClear(&rc->modelQueue);
+	rc->flushingModelQueue = false;
 }
 
 void RcDrawVoxFrame(VoxFrame_t* frame, v3 position, v3 scale, quat rotation, bool centered = false)
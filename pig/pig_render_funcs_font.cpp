@@ -105,9 +105,193 @@ FFCB_AFTER_LINE_DEFINITION(RcRenderTextWithSelectionAfterLineCallback) // | RcRe
 	}
 }
 
+// +--------------------------------------------------------------+
+// |                      Text Layout Cache                       |
+// +--------------------------------------------------------------+
+void InitTextLayoutCache(TextLayoutCache_t* cache, MemArena_t* memArena)
+{
+	NotNull2(cache, memArena);
+	ClearPointer(cache);
+	cache->enabled = true;
+	cache->allocArena = memArena;
+	for (u64 lIndex = TEXT_LAYOUT_CACHE_SIZE; lIndex > 0; lIndex--)
+	{
+		cache->layouts[lIndex-1].lruNext = cache->freeHead;
+		cache->freeHead = &cache->layouts[lIndex-1];
+	}
+}
+
+u64 GetTextLayoutBucketIndex(u64 hash)
+{
+	return (hash & (TEXT_LAYOUT_CACHE_NUM_BUCKETS-1));
+}
+
+void TextLayoutCacheUnlink(TextLayoutCache_t* cache, TextLayout_t* layout)
+{
+	NotNull2(cache, layout);
+	if (layout->lruPrev != nullptr) { layout->lruPrev->lruNext = layout->lruNext; }
+	else { cache->lruHead = layout->lruNext; }
+	if (layout->lruNext != nullptr) { layout->lruNext->lruPrev = layout->lruPrev; }
+	else { cache->lruTail = layout->lruPrev; }
+	layout->lruPrev = nullptr;
+	layout->lruNext = nullptr;
+}
+void TextLayoutCachePushFront(TextLayoutCache_t* cache, TextLayout_t* layout)
+{
+	NotNull2(cache, layout);
+	layout->lruPrev = nullptr;
+	layout->lruNext = cache->lruHead;
+	if (cache->lruHead != nullptr) { cache->lruHead->lruPrev = layout; }
+	cache->lruHead = layout;
+	if (cache->lruTail == nullptr) { cache->lruTail = layout; }
+}
+
+//Takes the layout out of the LRU list and its bucket, frees it and puts the slot on the free list
+void TextLayoutCacheRemove(TextLayoutCache_t* cache, TextLayout_t* layout)
+{
+	NotNull2(cache, layout);
+	TextLayout_t** bucketLink = &cache->buckets[GetTextLayoutBucketIndex(layout->hash)];
+	while (*bucketLink != nullptr && *bucketLink != layout) { bucketLink = &(*bucketLink)->bucketNext; }
+	Assert(*bucketLink == layout);
+	*bucketLink = layout->bucketNext;
+	TextLayoutCacheUnlink(cache, layout);
+	FreeTextLayout(layout);
+	layout->lruNext = cache->freeHead;
+	cache->freeHead = layout;
+	Assert(cache->numLayouts > 0);
+	cache->numLayouts--;
+}
+
+void ClearTextLayoutCache(TextLayoutCache_t* cache)
+{
+	NotNull(cache);
+	while (cache->lruHead != nullptr) { TextLayoutCacheRemove(cache, cache->lruHead); }
+	MyMemSet(&cache->seen[0], 0x00, sizeof(cache->seen));
+}
+
+//NOTE: Called from DestroyFont since the layouts hold pointers to the font's bakes
+void TextLayoutCacheEvictFont(const Font_t* font) //pre-declared in pig_func_defs.h
+{
+	if (rc == nullptr) { return; }
+	TextLayoutCache_t* cache = &rc->textLayoutCache;
+	TextLayout_t* layout = cache->lruHead;
+	while (layout != nullptr)
+	{
+		TextLayout_t* nextLayout = layout->lruNext;
+		if (layout->font == font) { TextLayoutCacheRemove(cache, layout); }
+		layout = nextLayout;
+	}
+}
+
+bool AreFontFlowCallbacksEmpty(const FontFlowCallbacks_t* callbacks)
+{
+	return (callbacks == nullptr || (callbacks->beforeChar == nullptr && callbacks->afterChar == nullptr && callbacks->betweenChar == nullptr && callbacks->beforeLine == nullptr && callbacks->afterLine == nullptr));
+}
+
+//Returns nullptr if the text can't be cached (callbacks are bound, the text is too long, the cache is disabled) or it
+//hasn't been asked for on an earlier frame yet. The caller should flow the text directly in that case
+TextLayout_t* GetCachedTextLayout(MyStr_t text, const Font_t* font, FontFaceSelector_t selector, TextAlignment_t alignment, r32 scale, r32 maxWidth, const FontFlowCallbacks_t* callbacks) //pre-declared in pig_func_defs.h
+{
+	NotNull(font);
+	if (rc == nullptr) { return nullptr; }
+	TextLayoutCache_t* cache = &rc->textLayoutCache;
+	if (!cache->enabled || cache->allocArena == nullptr) { return nullptr; }
+	if (text.length > TEXT_LAYOUT_CACHE_MAX_LENGTH) { return nullptr; }
+	//Callbacks can change colors or skip characters based on state that isn't part of the key, so we always flow those directly
+	if (!AreFontFlowCallbacksEmpty(callbacks)) { return nullptr; }
+	
+	u64 hash = GetTextLayoutHash(text, font, selector, alignment, scale, maxWidth);
+	TextLayout_t** bucket = &cache->buckets[GetTextLayoutBucketIndex(hash)];
+	for (TextLayout_t* layout = *bucket; layout != nullptr; layout = layout->bucketNext)
+	{
+		if (DoesTextLayoutMatch(layout, hash, text, font, selector, alignment, scale, maxWidth))
+		{
+			if (layout != cache->lruHead)
+			{
+				TextLayoutCacheUnlink(cache, layout);
+				TextLayoutCachePushFront(cache, layout);
+			}
+			cache->numHits++;
+			return layout;
+		}
+	}
+	
+	cache->numMisses++;
+	TextLayoutCacheSeen_t* seen = &cache->seen[hash & (TEXT_LAYOUT_CACHE_NUM_SEEN-1)];
+	if (seen->hash != hash || seen->time == ProgramTime)
+	{
+		seen->hash = hash;
+		seen->time = ProgramTime;
+		cache->numSkipped++;
+		return nullptr;
+	}
+	
+	if (cache->freeHead == nullptr)
+	{
+		NotNull(cache->lruTail);
+		TextLayoutCacheRemove(cache, cache->lruTail);
+		cache->numEvictions++;
+	}
+	TextLayout_t* newLayout = cache->freeHead;
+	NotNull(newLayout);
+	cache->freeHead = newLayout->lruNext;
+	CreateTextLayout(cache->allocArena, newLayout, text, font, selector, alignment, scale, maxWidth);
+	newLayout->bucketNext = *bucket;
+	*bucket = newLayout;
+	TextLayoutCachePushFront(cache, newLayout);
+	cache->numLayouts++;
+	return newLayout;
+}
+
+TextLayout_t* RcGetCachedTextLayout(MyStr_t text, TextAlignment_t alignment, r32 maxWidth)
+{
+	NotNull(rc);
+	NotNull(rc->state.boundFont);
+	return GetCachedTextLayout(text, rc->state.boundFont, rc->state.faceSelector, alignment, rc->state.fontScale, maxWidth, &rc->state.flowCallbacks);
+}
+
 // +--------------------------------------------------------------+
 // |                       Render Functions                       |
 // +--------------------------------------------------------------+
+//NOTE: Glyphs are stored in flow order so we only need to rebind the bake texture when it actually changes
+void RcDrawTextLayout(TextLayout_t* layout, v2 position, Color_t color, FontFlowInfo_t* infoOut = nullptr)
+{
+	NotNull(layout);
+	const FontBake_t* boundBake = nullptr;
+	Shader_t* textShader = nullptr;
+	VarArrayLoop(&layout->glyphs, gIndex)
+	{
+		VarArrayLoopGet(TextLayoutGlyph_t, glyph, &layout->glyphs, gIndex);
+		rec renderRec = NewRec(glyph->renderRec.topLeft + position, glyph->renderRec.size);
+		switch (glyph->type)
+		{
+			case TextLayoutGlyphType_Char:
+			{
+				NotNull(glyph->bake);
+				if (glyph->bake != boundBake)
+				{
+					FontFlow_BindBake(glyph->bake, &textShader);
+					boundBake = glyph->bake;
+				}
+				RcDrawTexturedPartRectangle(renderRec, (glyph->isColored ? White : color), glyph->sourceRec);
+			} break;
+			case TextLayoutGlyphType_InvalidChar:
+			{
+				RcDrawRectangle(renderRec, PalVioletDarker);
+				boundBake = nullptr;
+			} break;
+			case TextLayoutGlyphType_Underline:
+			{
+				RcDrawRectangle(renderRec, color);
+				boundBake = nullptr;
+			} break;
+			default: DebugAssert(false); break;
+		}
+	}
+	if (textShader != nullptr) { RcBindShader(textShader); }
+	if (infoOut != nullptr) { GetTextLayoutFlowInfo(layout, position, infoOut); }
+}
+
 TextMeasure_t RcMeasureText(MyStr_t text, r32 maxWidth = 0, FontFlowInfo_t* infoOut = nullptr)
 {
 	return MeasureTextInFont(text, rc->state.boundFont, rc->state.faceSelector, rc->state.fontScale, maxWidth, infoOut, &rc->state.flowCallbacks);
@@ -128,21 +312,16 @@ rec RcGetTextRec(MyStr_t text, v2 position)
 	);
 }
 
-void RcDrawText(const char* str, v2 position, Color_t color, TextAlignment_t alignment = TextAlignment_Left, r32 maxWidth = 0)
-{
-	NotNull(str);
-	NotNull(rc->state.boundFont);
-	FontFlow_RenderText(
-		NewStr(str),
-		rc->state.boundFont, rc->state.faceSelector, color, position,
-		alignment, rc->state.fontScale, maxWidth,
-		&rc->state.flowCallbacks, &rc->flowInfo
-	);
-}
 void RcDrawText(MyStr_t str, v2 position, Color_t color, TextAlignment_t alignment = TextAlignment_Left, r32 maxWidth = 0)
 {
 	NotNullStr(&str);
 	NotNull(rc->state.boundFont);
+	TextLayout_t* cachedLayout = RcGetCachedTextLayout(str, alignment, maxWidth);
+	if (cachedLayout != nullptr)
+	{
+		RcDrawTextLayout(cachedLayout, position, color, &rc->flowInfo);
+		return;
+	}
 	FontFlow_RenderText(
 		str,
 		rc->state.boundFont, rc->state.faceSelector, color, position,
@@ -150,6 +329,11 @@ void RcDrawText(MyStr_t str, v2 position, Color_t color, TextAlignment_t alignme
 		&rc->state.flowCallbacks, &rc->flowInfo
 	);
 }
+void RcDrawText(const char* str, v2 position, Color_t color, TextAlignment_t alignment = TextAlignment_Left, r32 maxWidth = 0)
+{
+	NotNull(str);
+	RcDrawText(NewStr(str), position, color, alignment, maxWidth);
+}
 
 void RcDrawTextPrintEx(v2 position, Color_t color, TextAlignment_t alignment, r32 maxWidth, const char* formatString, ...)
 {
@@ -102,6 +102,10 @@ void Pig_InitResources()
 	ClearPointer(pig->resources.musics);
 	ClearPointer(pig->resources.models);
 	ClearPointer(pig->resources.voxelFrameSets);
+	
+	#if PIG_TEXTURE_ATLAS
+	InitTextureAtlas(&pig->resources.textureAtlas, fixedHeap, NewVec2i(TEXTURE_ATLAS_PAGE_SIZE, TEXTURE_ATLAS_PAGE_SIZE));
+	#endif
 }
 
 // +--------------------------------------------------------------+
@@ -315,6 +319,127 @@ ResourceWatch_t* WatchFileForResource(ResourceType_t resourceType, u64 resourceI
 	newResourceWatch->watchedFile = newWatch;
 	return newResourceWatch;
 }
+
+// +==============================+
+// |       File Watch Test        |
+// +==============================+
+void FreeFileWatchTest(FileWatchTest_t* test)
+{
+	NotNull(test);
+	for (u64 fIndex = 0; fIndex < test->numFiles; fIndex++)
+	{
+		if (test->watches[fIndex] != nullptr) { plat->UnwatchFile(test->watches[fIndex]); }
+	}
+	if (test->watches != nullptr) { FreeMem(mainHeap, test->watches, sizeof(PlatWatchedFile_t*) * test->numFiles); }
+	if (test->detected != nullptr) { FreeMem(mainHeap, test->detected, sizeof(bool) * test->numFiles); }
+	ClearPointer(test);
+}
+
+bool StartFileWatchTest(FileWatchTest_t* test, u64 numFiles)
+{
+	NotNull(test);
+	Assert(numFiles > 0);
+	if (platInfo->fileWatchingStats == nullptr) { WriteLine_E("This platform doesn't report file watching stats"); return false; }
+	if (test->phase != FileWatchTestPhase_None) { FreeFileWatchTest(test); }
+	
+	if (!plat->DoesFileExist(NewStr(FILE_WATCH_TEST_FOLDER), nullptr) && !plat->CreateFolder(NewStr(FILE_WATCH_TEST_FOLDER)))
+	{
+		WriteLine_E("Failed to create the \"" FILE_WATCH_TEST_FOLDER "\" folder");
+		return false;
+	}
+	
+	test->numFiles = numFiles;
+	test->watches = AllocArray(mainHeap, PlatWatchedFile_t*, numFiles);
+	test->detected = AllocArray(mainHeap, bool, numFiles);
+	NotNull2(test->watches, test->detected);
+	MyMemSet(test->watches, 0x00, sizeof(PlatWatchedFile_t*) * numFiles);
+	MyMemSet(test->detected, 0x00, sizeof(bool) * numFiles);
+	
+	for (u64 fIndex = 0; fIndex < numFiles; fIndex++)
+	{
+		TempPushMark();
+		MyStr_t filePath = TempPrintStr(FILE_WATCH_TEST_FOLDER "/test_%llu.txt", fIndex);
+		MyStr_t fileContents = TempPrintStr("File %llu created at %llu", fIndex, ProgramTime);
+		if (plat->WriteEntireFile(filePath, fileContents.chars, fileContents.length))
+		{
+			test->watches[fIndex] = plat->WatchFile(filePath);
+		}
+		TempPopMark();
+		if (test->watches[fIndex] == nullptr)
+		{
+			PrintLine_E("Failed to create and watch test file %llu", fIndex);
+			FreeFileWatchTest(test);
+			return false;
+		}
+	}
+	
+	test->phase = FileWatchTestPhase_Idle;
+	test->phaseStartTime = ProgramTime;
+	MyMemCopy(&test->statsBeforeIdle, platInfo->fileWatchingStats, sizeof(PlatFileWatchingStats_t));
+	PrintLine_I("Watching %llu test files, measuring idle cost for %llums...", numFiles, (u64)FILE_WATCH_TEST_IDLE_TIME);
+	return true;
+}
+
+void UpdateFileWatchTest(FileWatchTest_t* test)
+{
+	NotNull(test);
+	if (test->phase == FileWatchTestPhase_Idle)
+	{
+		//NOTE: Creating the files can cause a few notifications right after the folder watch starts, so we swallow any of those here
+		for (u64 fIndex = 0; fIndex < test->numFiles; fIndex++) { plat->InterlockedExchange(&test->watches[fIndex]->changed, 0); }
+		
+		if (TimeSince(test->phaseStartTime) >= FILE_WATCH_TEST_IDLE_TIME)
+		{
+			MyMemCopy(&test->statsAfterIdle, platInfo->fileWatchingStats, sizeof(PlatFileWatchingStats_t));
+			test->touchPerfTime = GetPerfTime();
+			for (u64 fIndex = 0; fIndex < test->numFiles; fIndex++)
+			{
+				TempPushMark();
+				MyStr_t fileContents = TempPrintStr("File %llu touched at %llu", fIndex, ProgramTime);
+				plat->WriteEntireFile(test->watches[fIndex]->path, fileContents.chars, fileContents.length);
+				TempPopMark();
+			}
+			test->phase = FileWatchTestPhase_Touched;
+			test->phaseStartTime = ProgramTime;
+			test->minLatency = 0;
+			test->maxLatency = 0;
+			test->totalLatency = 0;
+			test->numDetected = 0;
+		}
+	}
+	else if (test->phase == FileWatchTestPhase_Touched)
+	{
+		PerfTime_t currentPerfTime = GetPerfTime();
+		r64 latency = GetPerfTimeDiff(&test->touchPerfTime, &currentPerfTime);
+		for (u64 fIndex = 0; fIndex < test->numFiles; fIndex++)
+		{
+			if (!test->detected[fIndex] && plat->InterlockedExchange(&test->watches[fIndex]->changed, 0) != 0)
+			{
+				test->detected[fIndex] = true;
+				if (test->numDetected == 0 || latency < test->minLatency) { test->minLatency = latency; }
+				if (test->numDetected == 0 || latency > test->maxLatency) { test->maxLatency = latency; }
+				test->totalLatency += latency;
+				test->numDetected++;
+			}
+		}
+		
+		bool timedOut = (TimeSince(test->phaseStartTime) >= FILE_WATCH_TEST_TIMEOUT);
+		if (test->numDetected == test->numFiles || timedOut)
+		{
+			const PlatFileWatchingStats_t* before = &test->statsBeforeIdle;
+			const PlatFileWatchingStats_t* after = &test->statsAfterIdle;
+			r64 idleSeconds = (r64)FILE_WATCH_TEST_IDLE_TIME / 1000.0;
+			PrintLine_N("File watch test finished: %llu/%llu changes detected%s", test->numDetected, test->numFiles, (timedOut ? " (timed out)" : ""));
+			if (test->numDetected > 0)
+			{
+				PrintLine_I("  Latency: min %.1lfms avg %.1lfms max %.1lfms (includes %llums debounce)", test->minLatency, test->totalLatency / (r64)test->numDetected, test->maxLatency, (u64)FILE_WATCHING_NOTIFY_DELAY);
+			}
+			PrintLine_I("  Idle: %.1lf wakeups/sec, %.3lfms CPU over %.1lfs", (r64)(after->numWakeups - before->numWakeups) / idleSeconds, after->threadCpuTime - before->threadCpuTime, idleSeconds);
+			PrintLine_I("  Watching %llu files in %llu folders (%llu notifications, %llu overflows so far)", platInfo->fileWatchingStats->numWatchedFiles, platInfo->fileWatchingStats->numWatchedFolders, platInfo->fileWatchingStats->numNotifications, platInfo->fileWatchingStats->numOverflows);
+			FreeFileWatchTest(test);
+		}
+	}
+}
 #else
 #define StopWatchingFilesForResource(resourceType, resourceIndex) //nothing
 #define WatchFileForResource(resourceType, resourceIndex, filePath) //nothing
@@ -326,6 +451,46 @@ ResourceWatch_t* WatchFileForResource(ResourceType_t resourceType, u64 resourceI
 // +==============================+
 // |           Texture            |
 // +==============================+
+#if PIG_TEXTURE_ATLAS
+//NOTE: Returns false if the image couldn't be parsed or doesn't fit in the atlas, the caller falls back to a standalone texture.
+//      When the texture is already in the atlas (hot reload) it's updated there so other atlas entries don't move
+bool Pig_TryLoadAtlasTextureResource(Texture_t* texture, MyStr_t texturePath, bool pixelated)
+{
+	NotNull(texture);
+	TextureAtlas_t* atlas = &pig->resources.textureAtlas;
+	PlatMappedFile_t textureFile;
+	if (!plat->MapFile(texturePath, &textureFile)) { return false; }
+	if (textureFile.size == 0) { plat->UnmapFile(&textureFile); return false; }
+	
+	PlatImageData_t imageData;
+	if (!plat->TryParseImageFile(textureFile.size, textureFile.data, sizeof(u32), &imageData))
+	{
+		plat->UnmapFile(&textureFile);
+		return false;
+	}
+	
+	bool result = false;
+	if (texture->isValid && texture->atlasPage != nullptr)
+	{
+		result = TextureAtlasReplaceTexture(atlas, texture, &imageData);
+	}
+	else
+	{
+		Texture_t newTexture = {};
+		if (TextureAtlasAddTexture(atlas, &newTexture, &imageData, pixelated))
+		{
+			if (texture->isValid) { DestroyTexture(texture); }
+			MyMemCopy(texture, &newTexture, sizeof(Texture_t));
+			result = true;
+		}
+	}
+	
+	plat->FreeImageData(&imageData);
+	plat->UnmapFile(&textureFile);
+	return result;
+}
+#endif
+
 void Pig_LoadTextureResource(u64 textureIndex)
 {
 	NotNull2(pig->resources.textures, pig->resources.textureStatus);
@@ -340,7 +505,20 @@ void Pig_LoadTextureResource(u64 textureIndex)
 	if (metaInfo.numLayers == 0)
 	{
 		MyStr_t texturePathStr = NewStr(texturePath);
-		if (!LoadTexture(fixedHeap, &newTexture, texturePathStr, metaInfo.pixelated, metaInfo.repeating))
+		#if PIG_TEXTURE_ATLAS
+		if (metaInfo.atlasable && !metaInfo.repeating && Pig_TryLoadAtlasTextureResource(texture, texturePathStr, metaInfo.pixelated))
+		{
+			StopWatchingFilesForResource(ResourceType_Texture, textureIndex);
+			WatchFileForResource(ResourceType_Texture, textureIndex, texturePathStr);
+			textureStatus->state = ResourceState_Loaded;
+			return;
+		}
+		#endif
+		bool loadedCooked = false;
+		#if PIG_COOKED_TEXTURES
+		loadedCooked = LoadCookedTexture(fixedHeap, &newTexture, texturePathStr, metaInfo.pixelated, metaInfo.repeating, metaInfo.highQuality, DEVELOPER_BUILD);
+		#endif
+		if (!loadedCooked && !LoadTexture(fixedHeap, &newTexture, texturePathStr, metaInfo.pixelated, metaInfo.repeating))
 		{
 			PrintLine_E("Failed to load texture[%u] from \"%s\"! Error %s",
 				textureIndex,
@@ -387,7 +565,11 @@ void Pig_LoadTextureResource(u64 textureIndex)
 	if (texture->isValid)
 	{
 		textureStatus->state = ResourceState_Unloaded;
-		DestroyTexture(texture);
+		#if PIG_TEXTURE_ATLAS
+		if (texture->atlasPage != nullptr) { TextureAtlasRemoveTexture(&pig->resources.textureAtlas, texture); } //it grew too big for the atlas
+		else
+		#endif
+		{ DestroyTexture(texture); }
 	}
 	MyMemCopy(texture, &newTexture, sizeof(Texture_t));
 	textureStatus->state = ResourceState_Loaded;
@@ -513,7 +695,7 @@ void Pig_LoadSpriteSheetResource(u64 sheetIndex)
 	MyStr_t sheetPathStr = NewStr(sheetPath);
 	
 	SpriteSheet_t tempSheet = {};
-	if (!LoadSpriteSheet(mainHeap, &tempSheet, sheetPathStr, metaInfo.padding, metaInfo.numFrames, metaInfo.pixelated, metaInfo.useTextureArray))
+	if (!LoadSpriteSheet(mainHeap, &tempSheet, sheetPathStr, metaInfo.padding, metaInfo.numFrames, metaInfo.pixelated, metaInfo.useTextureArray, metaInfo.trimFrames))
 	{
 		NotifyPrint_E("Failed to load sheet[%u] from \"%s\"! Error %s%s%s",
 			sheetIndex,
@@ -775,28 +957,77 @@ void Pig_LoadFontResource(u64 fontIndex)
 			ranges[0].fontSize = (float)faceMetaInfo->size; //TODO: This really shouldn't need to be defined
 			ranges[1].fontSize = (float)faceMetaInfo->size; //TODO: This really shouldn't need to be defined
 			
-			ranges[0].firstCodepoint = 0x20;
-			ranges[0].numChars = 0x7E - ranges[0].firstCodepoint;
-			ranges[1].firstCodepoint = UNICODE_LATIN_EXT_START;
-			ranges[1].numChars = UNICODE_LATIN_EXT_COUNT;
-			FontBake_t* mainBake = FontAddBakeToActiveFace(font, face, faceMetaInfo->bakeSize, 2, &ranges[0]);
-			UNUSED(mainBake);
-			
-			if (faceMetaInfo->includeCyrillicBake)
+			if (faceMetaInfo->isSdf)
 			{
-				ranges[0].firstCodepoint = UNICODE_CYRILLIC_START;
-				ranges[0].numChars = UNICODE_CYRILLIC_COUNT;
-				FontBake_t* cyrillicBake = FontAddBakeToActiveFace(font, face, faceMetaInfo->bakeSize, 1, &ranges[0]);
-				UNUSED(cyrillicBake);
+				i32 rasterSize = ((faceMetaInfo->sdfRasterSize > 0) ? faceMetaInfo->sdfRasterSize : FONT_SDF_DEFAULT_RASTER_SIZE);
+				ranges[0].firstCodepoint = 0x20;
+				ranges[0].numChars = 0x7E - ranges[0].firstCodepoint;
+				ranges[1].firstCodepoint = UNICODE_LATIN_EXT_START;
+				ranges[1].numChars = UNICODE_LATIN_EXT_COUNT;
+				FontBake_t* mainBake = FontAddSdfBakeToActiveFace(font, face, rasterSize, FONT_SDF_DEFAULT_SPREAD, faceMetaInfo->bakeSize, 2, &ranges[0]);
+				if (!IsFlagSet(mainBake->flags, FontBakeFlag_IsValid)) { fontStatus->state = ResourceStateWarnOrError(fontStatus->state); }
+				
+				if (faceMetaInfo->includeCyrillicBake)
+				{
+					ranges[0].firstCodepoint = UNICODE_CYRILLIC_START;
+					ranges[0].numChars = UNICODE_CYRILLIC_COUNT;
+					FontBake_t* cyrillicBake = FontAddSdfBakeToActiveFace(font, face, rasterSize, FONT_SDF_DEFAULT_SPREAD, faceMetaInfo->bakeSize, 1, &ranges[0]);
+					if (!IsFlagSet(cyrillicBake->flags, FontBakeFlag_IsValid)) { fontStatus->state = ResourceStateWarnOrError(fontStatus->state); }
+				}
+				
+				if (faceMetaInfo->includeJapaneseKanaBake)
+				{
+					ChangeFontFileForActiveFace(font, face, NewStr(INTERNATIONAL_FONT_NAME), faceMetaInfo->size, faceMetaInfo->bold, faceMetaInfo->italic);
+					ranges[0].firstCodepoint = UNICODE_HIRAGANA_START;
+					ranges[0].numChars = UNICODE_KATAKANA_END - ranges[0].firstCodepoint;
+					FontBake_t* japaneseBake = FontAddSdfBakeToActiveFace(font, face, rasterSize, FONT_SDF_DEFAULT_SPREAD, faceMetaInfo->bakeSize, 1, &ranges[0]);
+					if (!IsFlagSet(japaneseBake->flags, FontBakeFlag_IsValid)) { fontStatus->state = ResourceStateWarnOrError(fontStatus->state); }
+				}
 			}
-			
-			if (faceMetaInfo->includeJapaneseKanaBake)
+			else
 			{
-				ChangeFontFileForActiveFace(font, face, NewStr(INTERNATIONAL_FONT_NAME), faceMetaInfo->size, faceMetaInfo->bold, faceMetaInfo->italic);
-				ranges[0].firstCodepoint = UNICODE_HIRAGANA_START;
-				ranges[0].numChars = UNICODE_KATAKANA_END - ranges[0].firstCodepoint;
-				FontBake_t* japaneseBake = FontAddBakeToActiveFace(font, face, faceMetaInfo->bakeSize, 1, &ranges[0]);
-				UNUSED(japaneseBake);
+				#if PIG_FONT_DYNAMIC_ATLAS
+				//Only ASCII is baked up front, everything else gets rasterized into the face's glyph atlas the first time it's drawn
+				ranges[0].firstCodepoint = 0x20;
+				ranges[0].numChars = 0x7E - ranges[0].firstCodepoint;
+				FontBake_t* mainBake = FontAddBakeToActiveFace(font, face, faceMetaInfo->bakeSize, 1, &ranges[0]);
+				UNUSED(mainBake);
+				if (FontEnableDynamicAtlas(font, face, faceMetaInfo->bakeSize))
+				{
+					if (faceMetaInfo->includeJapaneseKanaBake)
+					{
+						FontSetAtlasFallbackFont(face, NewStr(INTERNATIONAL_FONT_NAME), UNICODE_HIRAGANA_START);
+					}
+				}
+				else
+				{
+					fontStatus->state = ResourceStateWarnOrError(fontStatus->state);
+				}
+				#else
+				ranges[0].firstCodepoint = 0x20;
+				ranges[0].numChars = 0x7E - ranges[0].firstCodepoint;
+				ranges[1].firstCodepoint = UNICODE_LATIN_EXT_START;
+				ranges[1].numChars = UNICODE_LATIN_EXT_COUNT;
+				FontBake_t* mainBake = FontAddBakeToActiveFace(font, face, faceMetaInfo->bakeSize, 2, &ranges[0]);
+				UNUSED(mainBake);
+				
+				if (faceMetaInfo->includeCyrillicBake)
+				{
+					ranges[0].firstCodepoint = UNICODE_CYRILLIC_START;
+					ranges[0].numChars = UNICODE_CYRILLIC_COUNT;
+					FontBake_t* cyrillicBake = FontAddBakeToActiveFace(font, face, faceMetaInfo->bakeSize, 1, &ranges[0]);
+					UNUSED(cyrillicBake);
+				}
+				
+				if (faceMetaInfo->includeJapaneseKanaBake)
+				{
+					ChangeFontFileForActiveFace(font, face, NewStr(INTERNATIONAL_FONT_NAME), faceMetaInfo->size, faceMetaInfo->bold, faceMetaInfo->italic);
+					ranges[0].firstCodepoint = UNICODE_HIRAGANA_START;
+					ranges[0].numChars = UNICODE_KATAKANA_END - ranges[0].firstCodepoint;
+					FontBake_t* japaneseBake = FontAddBakeToActiveFace(font, face, faceMetaInfo->bakeSize, 1, &ranges[0]);
+					UNUSED(japaneseBake);
+				}
+				#endif //PIG_FONT_DYNAMIC_ATLAS
 			}
 			
 			if (faceMetaInfo->includeBtnsSheet)
@@ -842,6 +1073,23 @@ void Pig_LoadFontResource(u64 fontIndex)
 	EndFont(font);
 	fontStatus->state = ResourceState_Loaded;
 }
+//Called once per frame before rendering so glyphs rasterized during the update get uploaded in one batch per atlas page
+void Pig_FlushFontGlyphAtlases()
+{
+	NotNull2(pig->resources.fonts, pig->resources.fontStatus);
+	for (u64 fontIndex = 0; fontIndex < RESOURCES_NUM_FONTS; fontIndex++)
+	{
+		Font_t* font = &pig->resources.fonts->items[fontIndex];
+		if (font->isValid) { FontFlushGlyphAtlases(font); }
+	}
+}
+//Called once per frame before rendering so atlased textures that were loaded or hot reloaded get uploaded in one batch per page
+void Pig_FlushTextureAtlas()
+{
+	#if PIG_TEXTURE_ATLAS
+	TextureAtlasFlush(&pig->resources.textureAtlas);
+	#endif
+}
 void Pig_LoadAllFonts(bool onlyPinned = false)
 {
 	for (u64 fontIndex = 0; fontIndex < RESOURCES_NUM_FONTS; fontIndex++)
@@ -920,8 +1168,8 @@ void Pig_LoadMusicResource(u64 musicIndex)
 	MyStr_t musicPathStr = NewStr(musicPath);
 	Sound_t newMusic = {};
 	
-	PlatFileContents_t musicFile = {};
-	if (plat->ReadFileContents(musicPathStr, nullptr, false, &musicFile))
+	PlatMappedFile_t musicFile = {};
+	if (plat->MapFile(musicPathStr, &musicFile))
 	{
 		bool parseSuccess = false;
 		ProcessLog_t musicParseLog = {};
@@ -965,7 +1213,7 @@ void Pig_LoadMusicResource(u64 musicIndex)
 		}
 		
 		FreeProcessLog(&musicParseLog);
-		plat->FreeFileContents(&musicFile);
+		plat->UnmapFile(&musicFile);
 		if (!parseSuccess)
 		{
 			musicStatus->state = ResourceStateWarnOrError(musicStatus->state);
@@ -1123,6 +1371,8 @@ void Pig_LoadAllVoxelFrameSets(bool onlyPinned = false)
 // +==============================+
 void Pig_LoadResource(ResourceType_t type, u64 resourceIndex)
 {
+	PigProfileBegin("LoadResource");
+	PigMemTagPush(GetResourceTypeStr(type));
 	switch (type)
 	{
 		case ResourceType_Texture:       Pig_LoadTextureResource(resourceIndex);       break;
@@ -1136,6 +1386,8 @@ void Pig_LoadResource(ResourceType_t type, u64 resourceIndex)
 		case ResourceType_VoxelFrameSet: Pig_LoadVoxelFrameSetResource(resourceIndex); break;
 		default: Unimplemented(); break;
 	}
+	PigMemTagPop();
+	PigProfileEnd();
 }
 void Pig_LoadAllResources(bool onlyPinned = false)
 {
@@ -1362,6 +1614,12 @@ void Pig_HandleResourcesOnReload()
 void Pig_UpdateResources()
 {
 	#if DEVELOPER_BUILD
+	UpdateFileWatchTest(&pig->resources.fileWatchTest);
+	
+	//NOTE: The platform layer delivers file changes in a batch once per frame, so if the running total hasn't moved there's nothing to look for
+	if (pigIn->numWatchedFileChanges == pig->resources.lastWatchedFileChanges) { return; }
+	pig->resources.lastWatchedFileChanges = pigIn->numWatchedFileChanges;
+	
 	VarArrayLoop(&pig->resources.watches, wIndex)
 	{
 		VarArrayLoopGet(ResourceWatch_t, watch, &pig->resources.watches, wIndex);
@@ -1369,6 +1627,7 @@ void Pig_UpdateResources()
 		u32 watchChanged = plat->InterlockedExchange(&watch->watchedFile->changed, 0);
 		if (watchChanged != 0)
 		{
+			PigProfileBegin("ReloadResource");
 			switch (watch->type)
 			{
 				case ResourceType_Texture:
@@ -1418,6 +1677,7 @@ void Pig_UpdateResources()
 				} break;
 				default: DebugAssert(false); break;
 			}
+			PigProfileEnd();
 		}
 	}
 	#endif
@@ -90,12 +90,48 @@ struct ResourceWatch_t
 	PlatWatchedFile_t* watchedFile;
 };
 
+#if DEVELOPER_BUILD
+#define FILE_WATCH_TEST_FOLDER     "file_watch_test"
+#define FILE_WATCH_TEST_IDLE_TIME  2000 //ms
+#define FILE_WATCH_TEST_TIMEOUT    10000 //ms
+
+enum FileWatchTestPhase_t
+{
+	FileWatchTestPhase_None = 0,
+	FileWatchTestPhase_Idle, //files are watched but untouched, we measure how much the watching thread does while nothing is happening
+	FileWatchTestPhase_Touched, //files have been rewritten, we are waiting for every change to be delivered
+	FileWatchTestPhase_NumPhases,
+};
+
+//NOTE: This backs the file_watch_test debug command. It touches a bunch of files and measures
+//      how long it takes for the changes to show up on the engine side (including the debounce delay)
+struct FileWatchTest_t
+{
+	FileWatchTestPhase_t phase;
+	u64 numFiles;
+	PlatWatchedFile_t** watches;
+	bool* detected;
+	
+	u64 phaseStartTime;
+	PerfTime_t touchPerfTime;
+	PlatFileWatchingStats_t statsBeforeIdle;
+	PlatFileWatchingStats_t statsAfterIdle;
+	
+	u64 numDetected;
+	r64 minLatency;
+	r64 maxLatency;
+	r64 totalLatency;
+};
+#endif
+
 #define RESOURCE_TEXTURE_MAX_NUM_LAYERS   256
 
 struct ResourceTextureMetaInfo_t
 {
 	bool pixelated;
 	bool repeating;
+	bool highQuality; //cook as BC7 instead of BC1/BC3
+	bool atlasable; //pack into pig->resources.textureAtlas if it's small enough. Must not be repeating
 	u64 numLayers;
 	const char* filePaths[RESOURCE_TEXTURE_MAX_NUM_LAYERS];
 };
@@ -106,6 +142,7 @@ struct ResourceSheetMetaInfo_t
 	v2i padding;
 	bool pixelated;
 	bool useTextureArray;
+	bool trimFrames; //trim each frame to its alpha bounds and pack them (see CreateTrimmedSpriteSheet)
 	MyStr_t metaFilePath;
 };
 
@@ -134,6 +171,8 @@ struct ResourceFontFaceMetaInfo_t
 	bool includeCyrillicBake;
 	bool includeJapaneseKanaBake;
 	bool includeBtnsSheet;
+	bool isSdf; //one distance field bake drawn at every selector size, bakeSize becomes the max size
+	i32 sdfRasterSize; //0 = FONT_SDF_DEFAULT_RASTER_SIZE
 	
 	//Sprite Font options
 	MyStr_t filePaths[MAX_NUM_RESOURCE_FONT_BAKES]; //overrides the const char* returned from Resources_GetPathOrNameForFont
@@ -223,6 +262,8 @@ struct Resources_t
 {
 	#if DEVELOPER_BUILD
 	VarArray_t watches; //ResourceWatch_t
+	u64 lastWatchedFileChanges; //compared against pigIn->numWatchedFileChanges to know whether any watches need checking this frame
+	FileWatchTest_t fileWatchTest;
 	#endif
 	
 	u64 numTexturesAlloc;
@@ -254,6 +295,8 @@ struct Resources_t
 	ResourceMusics_t*         musics;
 	ResourceModels_t*         models;
 	ResourceVoxelFrameSets_t* voxelFrameSets;
+	
+	TextureAtlas_t textureAtlas;
 };
 
 #endif //  _PIG_RESOURCES_H
@@ -9,6 +9,7 @@ Description:
 
 #define PIG_SETTINGS_FILE_PREFIX_STR      "# [Pig Settings]"
 #define PIG_SETTINGS_FILE_PREFIX_LENGTH   16
+#define PIG_SETTINGS_INDEX_MIN_CAPACITY   16 //slots, the index is kept at most half full
 
 MyStr_t PigGetSettingsFilePath(MemArena_t* tempArena, MemArena_t* memArena, MyStr_t applicationName, MyStr_t fileName, PlatApiGetSpecialFolderPath_f* getSpecialFolderPathFunc = nullptr)
 {
@@ -37,6 +38,10 @@ void PigFreeSettings(PigSettings_t* settings)
 		}
 		FreeVarArray(&settings->entries);
 	}
+	if (settings->indexSlots != nullptr && DoesMemArenaSupportFreeing(settings->allocArena))
+	{
+		FreeMem(settings->allocArena, settings->indexSlots, sizeof(u32) * settings->indexCapacity);
+	}
 	ClearPointer(settings);
 }
 
@@ -48,6 +53,70 @@ void PigInitSettings(PigSettings_t* settings, MemArena_t* memArena, u64 numEntri
 	CreateVarArray(&settings->entries, memArena, sizeof(PigSettingsEntry_t), numEntriesExpected);
 }
 
+// +--------------------------------------------------------------+
+// |                          Key Index                           |
+// +--------------------------------------------------------------+
+//Hashes the lowercased key so the same hash works for both ignoreCase and exact lookups
+u64 PigHashSettingKey(MyStr_t key)
+{
+	u64 result = 0;
+	for (u64 cIndex = 0; cIndex < key.length; cIndex++)
+	{
+		char c = key.pntr[cIndex];
+		if (c >= 'A' && c <= 'Z') { c = (char)(c - 'A' + 'a'); }
+		result = (cIndex == 0) ? FnvHashU64(&c, 1) : FnvHashU64(&c, 1, result);
+	}
+	return result;
+}
+
+void PigSettingsIndexInsert(PigSettings_t* settings, u64 entryIndex)
+{
+	NotNull(settings);
+	if (settings->indexSlots == nullptr) { return; }
+	const PigSettingsEntry_t* entry = VarArrayGet(&settings->entries, entryIndex, PigSettingsEntry_t);
+	u64 mask = settings->indexCapacity-1;
+	u64 slotIndex = (entry->keyHash & mask);
+	while (settings->indexSlots[slotIndex] != 0) { slotIndex = ((slotIndex + 1) & mask); }
+	settings->indexSlots[slotIndex] = (u32)(entryIndex + 1);
+}
+
+//Called when entries are removed (which shifts indices) or when the index gets more than half full
+void PigRebuildSettingsIndex(PigSettings_t* settings)
+{
+	NotNull(settings);
+	NotNull(settings->allocArena);
+	u64 newCapacity = PIG_SETTINGS_INDEX_MIN_CAPACITY;
+	while (newCapacity < settings->entries.length*2) { newCapacity *= 2; }
+	if (settings->indexSlots == nullptr || newCapacity > settings->indexCapacity)
+	{
+		if (settings->indexSlots != nullptr && DoesMemArenaSupportFreeing(settings->allocArena))
+		{
+			FreeMem(settings->allocArena, settings->indexSlots, sizeof(u32) * settings->indexCapacity);
+		}
+		settings->indexSlots = AllocArray(settings->allocArena, u32, newCapacity);
+		settings->indexCapacity = (settings->indexSlots != nullptr) ? newCapacity : 0;
+		if (settings->indexSlots == nullptr) { return; } //lookups will just do a linear search
+	}
+	MyMemSet(settings->indexSlots, 0x00, sizeof(u32) * settings->indexCapacity);
+	VarArrayLoop(&settings->entries, sIndex) { PigSettingsIndexInsert(settings, sIndex); }
+}
+
+//Called after adding entries[entryIndex]
+void PigSettingsIndexAdd(PigSettings_t* settings, u64 entryIndex)
+{
+	NotNull(settings);
+	PigSettingsEntry_t* entry = VarArrayGet(&settings->entries, entryIndex, PigSettingsEntry_t);
+	entry->keyHash = PigHashSettingKey(entry->key);
+	if (settings->indexSlots == nullptr || settings->entries.length*2 > settings->indexCapacity) { PigRebuildSettingsIndex(settings); }
+	else { PigSettingsIndexInsert(settings, entryIndex); }
+}
+
+void PigInvalidateSettingCache(PigSettingsEntry_t* entry)
+{
+	NotNull(entry);
+	entry->cache.type = PigSettingsCacheType_None;
+}
+
 // +--------------------------------------------------------------+
 // |                       Deserialization                        |
 // +--------------------------------------------------------------+
@@ -155,6 +224,7 @@ bool PigTryDeserSettings(MyStr_t fileContents, ProcessLog_t* log, PigSettings_t*
 							newEntry->value = AllocString(&stringBufferArena, &token.value);
 							NotNullStr(&newEntry->key);
 							NotNullStr(&newEntry->value);
+							newEntry->keyHash = PigHashSettingKey(newEntry->key);
 						}
 					}
 				} break;
@@ -195,6 +265,8 @@ bool PigTryDeserSettings(MyStr_t fileContents, ProcessLog_t* log, PigSettings_t*
 		}
 	}
 	
+	PigRebuildSettingsIndex(settingsOut);
+	
 	LogPrintLine_I(log, "Successfully deserialized pig settings file! It had %llu setting%s", settingsOut->entries.length, (settingsOut->entries.length == 1 ? "" : "s"));
 	LogExitSuccess(log);
 	return true;
@@ -290,16 +362,40 @@ PigSettingsEntry_t* PigGetSettingEntry(PigSettings_t* settings, MyStr_t key, boo
 {
 	NotNull(settings);
 	NotNullStr(&key);
-	VarArrayLoop(&settings->entries, sIndex)
+	if (settings->indexSlots == nullptr)
+	{
+		VarArrayLoop(&settings->entries, sIndex)
+		{
+			VarArrayLoopGet(PigSettingsEntry_t, setting, &settings->entries, sIndex);
+			if ((ignoreCase && StrEqualsIgnoreCase(setting->key, key)) || (!ignoreCase && StrEquals(setting->key, key)))
+			{
+				if (indexOut != nullptr) { *indexOut = sIndex; }
+				return setting;
+			}
+		}
+		return nullptr;
+	}
+	
+	//Keys that only differ by case share a hash, so keep probing and return the earliest entry that matches (same as the linear search)
+	u64 keyHash = PigHashSettingKey(key);
+	u64 mask = settings->indexCapacity-1;
+	u64 slotIndex = (keyHash & mask);
+	PigSettingsEntry_t* result = nullptr;
+	u64 resultIndex = 0;
+	while (settings->indexSlots[slotIndex] != 0)
 	{
-		VarArrayLoopGet(PigSettingsEntry_t, setting, &settings->entries, sIndex);
-		if ((ignoreCase && StrEqualsIgnoreCase(setting->key, key)) || (!ignoreCase && StrEquals(setting->key, key)))
+		u64 entryIndex = settings->indexSlots[slotIndex] - 1;
+		PigSettingsEntry_t* setting = VarArrayGet(&settings->entries, entryIndex, PigSettingsEntry_t);
+		if (setting->keyHash == keyHash && (result == nullptr || entryIndex < resultIndex) &&
+			((ignoreCase && StrEqualsIgnoreCase(setting->key, key)) || (!ignoreCase && StrEquals(setting->key, key))))
 		{
-			if (indexOut != nullptr) { *indexOut = sIndex; }
-			return setting;
+			result = setting;
+			resultIndex = entryIndex;
 		}
+		slotIndex = ((slotIndex + 1) & mask);
 	}
-	return nullptr;
+	if (result != nullptr && indexOut != nullptr) { *indexOut = resultIndex; }
+	return result;
 }
 bool PigIsSettingSet(const PigSettings_t* settings, MyStr_t key, bool ignoreCase = true)
 {
@@ -321,6 +417,7 @@ bool PigUnsetSetting(PigSettings_t* settings, MyStr_t key, bool ignoreCase = tru
 	if (entry != nullptr)
 	{
 		VarArrayRemove(&settings->entries, entryIndex, PigSettingsEntry_t);
+		PigRebuildSettingsIndex(settings);
 		return true;
 	}
 	return false;
@@ -343,6 +440,7 @@ PigSettingsEntry_t* PigSetSettingStr(PigSettings_t* settings, MyStr_t key, MyStr
 			FreeString(settings->allocArena, &existingEntry->value);
 		}
 		existingEntry->value = AllocString(settings->allocArena, &value);
+		PigInvalidateSettingCache(existingEntry);
 		return existingEntry;
 	}
 	else
@@ -354,6 +452,7 @@ PigSettingsEntry_t* PigSetSettingStr(PigSettings_t* settings, MyStr_t key, MyStr
 		newEntry->value = AllocString(settings->allocArena, &value);
 		NotNullStr(&newEntry->key);
 		NotNullStr(&newEntry->value);
+		PigSettingsIndexAdd(settings, settings->entries.length-1);
 		return newEntry;
 	}
 }
@@ -461,21 +560,38 @@ const char* GetTryGetSettingResultStr(TryGetSettingResult_t result)
 //      Normally Try functions should be used when you want to gracefully, or specially, handle the ParseFailure case.
 //      Or when you want to detect the missing case and do something more than assign a defaultValue
 //      GetSetting functions don't report ParseFailures or Missings. On ParseFailure they throw a DebugAssert. On Missing they return defaultValue
+//NOTE: The typed TryGet functions take a const PigSettings_t* but still fill in the (mutable) parse cache on the entry they find
 
-bool PigTryGetSettingStr(const PigSettings_t* settings, MyStr_t key, MyStr_t* valueOut, bool ignoreCase = true)
+//Parses setting->value as type, unless the last typed read of this entry was already that type
+bool PigParseSettingCached(const PigSettingsEntry_t* setting, PigSettingsCacheType_t type, TryParseFailureReason_t* parseFailureReasonOut)
 {
-	NotNull(settings);
-	NotNullStr(&key);
-	VarArrayLoop(&settings->entries, sIndex)
+	NotNull(setting);
+	PigSettingsCache_t* cache = &setting->cache;
+	if (cache->type != type)
 	{
-		VarArrayLoopGet(PigSettingsEntry_t, setting, &settings->entries, sIndex);
-		if ((ignoreCase && StrEqualsIgnoreCase(setting->key, key)) || (!ignoreCase && StrEquals(setting->key, key)))
+		cache->type = type;
+		cache->failureReason = TryParseFailureReason_None;
+		switch (type)
 		{
-			if (valueOut != nullptr) { *valueOut = setting->value; }
-			return true;
+			case PigSettingsCacheType_Bool: cache->parseSuccess = TryParseBool(setting->value, &cache->boolValue, &cache->failureReason); break;
+			case PigSettingsCacheType_R32:  cache->parseSuccess = TryParseR32(setting->value,  &cache->r32Value,  &cache->failureReason); break;
+			case PigSettingsCacheType_U64:  cache->parseSuccess = TryParseU64(setting->value,  &cache->u64Value,  &cache->failureReason); break;
+			case PigSettingsCacheType_V2:   cache->parseSuccess = TryParseV2(setting->value,   &cache->v2Value,   &cache->failureReason); break;
+			case PigSettingsCacheType_V3:   cache->parseSuccess = TryParseV3(setting->value,   &cache->v3Value,   &cache->failureReason); break;
+			case PigSettingsCacheType_V2i:  cache->parseSuccess = TryParseV2i(setting->value,  &cache->v2iValue,  &cache->failureReason); break;
+			default: Assert(false); cache->type = PigSettingsCacheType_None; return false;
 		}
 	}
-	return false;
+	if (!cache->parseSuccess && parseFailureReasonOut != nullptr) { *parseFailureReasonOut = cache->failureReason; }
+	return cache->parseSuccess;
+}
+
+bool PigTryGetSettingStr(const PigSettings_t* settings, MyStr_t key, MyStr_t* valueOut, bool ignoreCase = true)
+{
+	const PigSettingsEntry_t* setting = PigGetSettingEntry((PigSettings_t*)settings, key, ignoreCase);
+	if (setting == nullptr) { return false; }
+	if (valueOut != nullptr) { *valueOut = setting->value; }
+	return true;
 }
 bool PigTryGetSettingStr(const PigSettings_t* settings, const char* keyNullTerm, MyStr_t* valueOut, bool ignoreCase = true)
 {
@@ -495,15 +611,11 @@ MyStr_t PigGetSettingStr(const PigSettings_t* settings, const char* keyNullTerm,
 
 TryGetSettingResult_t PigTryGetSettingBool(const PigSettings_t* settings, MyStr_t key, bool* valueOut = nullptr, bool ignoreCase = true, TryParseFailureReason_t* parseFailureReasonOut = nullptr)
 {
-	NotNull(settings);
-	NotNullStr(&key);
-	MyStr_t settingValue;
-	if (PigTryGetSettingStr(settings, key, &settingValue, ignoreCase))
-	{
-		if (TryParseBool(settingValue, valueOut, parseFailureReasonOut)) { return TryGetSettingResult_Success; }
-		else { return TryGetSettingResult_ParseError; }
-	}
-	return TryGetSettingResult_Missing;
+	const PigSettingsEntry_t* setting = PigGetSettingEntry((PigSettings_t*)settings, key, ignoreCase);
+	if (setting == nullptr) { return TryGetSettingResult_Missing; }
+	if (!PigParseSettingCached(setting, PigSettingsCacheType_Bool, parseFailureReasonOut)) { return TryGetSettingResult_ParseError; }
+	if (valueOut != nullptr) { *valueOut = setting->cache.boolValue; }
+	return TryGetSettingResult_Success;
 }
 TryGetSettingResult_t PigTryGetSettingBool(const PigSettings_t* settings, const char* keyNullTerm, bool* valueOut = nullptr, bool ignoreCase = true, TryParseFailureReason_t* parseFailureReasonOut = nullptr)
 {
@@ -525,15 +637,11 @@ bool PigGetSettingBool(const PigSettings_t* settings, const char* keyNullTerm, b
 
 TryGetSettingResult_t PigTryGetSettingR32(const PigSettings_t* settings, MyStr_t key, r32* valueOut = nullptr, bool ignoreCase = true, TryParseFailureReason_t* parseFailureReasonOut = nullptr)
 {
-	NotNull(settings);
-	NotNullStr(&key);
-	MyStr_t settingValue;
-	if (PigTryGetSettingStr(settings, key, &settingValue, ignoreCase))
-	{
-		if (TryParseR32(settingValue, valueOut, parseFailureReasonOut)) { return TryGetSettingResult_Success; }
-		else { return TryGetSettingResult_ParseError; }
-	}
-	return TryGetSettingResult_Missing;
+	const PigSettingsEntry_t* setting = PigGetSettingEntry((PigSettings_t*)settings, key, ignoreCase);
+	if (setting == nullptr) { return TryGetSettingResult_Missing; }
+	if (!PigParseSettingCached(setting, PigSettingsCacheType_R32, parseFailureReasonOut)) { return TryGetSettingResult_ParseError; }
+	if (valueOut != nullptr) { *valueOut = setting->cache.r32Value; }
+	return TryGetSettingResult_Success;
 }
 TryGetSettingResult_t PigTryGetSettingR32(const PigSettings_t* settings, const char* keyNullTerm, r32* valueOut = nullptr, bool ignoreCase = true, TryParseFailureReason_t* parseFailureReasonOut = nullptr)
 {
@@ -555,15 +663,11 @@ r32 PigGetSettingR32(const PigSettings_t* settings, const char* keyNullTerm, r32
 
 TryGetSettingResult_t PigTryGetSettingU64(const PigSettings_t* settings, MyStr_t key, u64* valueOut = nullptr, bool ignoreCase = true, TryParseFailureReason_t* parseFailureReasonOut = nullptr)
 {
-	NotNull(settings);
-	NotNullStr(&key);
-	MyStr_t settingValue;
-	if (PigTryGetSettingStr(settings, key, &settingValue, ignoreCase))
-	{
-		if (TryParseU64(settingValue, valueOut, parseFailureReasonOut)) { return TryGetSettingResult_Success; }
-		else { return TryGetSettingResult_ParseError; }
-	}
-	return TryGetSettingResult_Missing;
+	const PigSettingsEntry_t* setting = PigGetSettingEntry((PigSettings_t*)settings, key, ignoreCase);
+	if (setting == nullptr) { return TryGetSettingResult_Missing; }
+	if (!PigParseSettingCached(setting, PigSettingsCacheType_U64, parseFailureReasonOut)) { return TryGetSettingResult_ParseError; }
+	if (valueOut != nullptr) { *valueOut = setting->cache.u64Value; }
+	return TryGetSettingResult_Success;
 }
 TryGetSettingResult_t PigTryGetSettingU64(const PigSettings_t* settings, const char* keyNullTerm, u64* valueOut = nullptr, bool ignoreCase = true, TryParseFailureReason_t* parseFailureReasonOut = nullptr)
 {
@@ -585,15 +689,11 @@ u64 PigGetSettingU64(const PigSettings_t* settings, const char* keyNullTerm, u64
 
 TryGetSettingResult_t PigTryGetSettingV2(const PigSettings_t* settings, MyStr_t key, v2* valueOut = nullptr, bool ignoreCase = true, TryParseFailureReason_t* parseFailureReasonOut = nullptr)
 {
-	NotNull(settings);
-	NotNullStr(&key);
-	MyStr_t settingValue;
-	if (PigTryGetSettingStr(settings, key, &settingValue, ignoreCase))
-	{
-		if (TryParseV2(settingValue, valueOut, parseFailureReasonOut)) { return TryGetSettingResult_Success; }
-		else { return TryGetSettingResult_ParseError; }
-	}
-	return TryGetSettingResult_Missing;
+	const PigSettingsEntry_t* setting = PigGetSettingEntry((PigSettings_t*)settings, key, ignoreCase);
+	if (setting == nullptr) { return TryGetSettingResult_Missing; }
+	if (!PigParseSettingCached(setting, PigSettingsCacheType_V2, parseFailureReasonOut)) { return TryGetSettingResult_ParseError; }
+	if (valueOut != nullptr) { *valueOut = setting->cache.v2Value; }
+	return TryGetSettingResult_Success;
 }
 TryGetSettingResult_t PigTryGetSettingV2(const PigSettings_t* settings, const char* keyNullTerm, v2* valueOut = nullptr, bool ignoreCase = true, TryParseFailureReason_t* parseFailureReasonOut = nullptr)
 {
@@ -615,15 +715,11 @@ v2 PigGetSettingV2(const PigSettings_t* settings, const char* keyNullTerm, v2 de
 
 TryGetSettingResult_t PigTryGetSettingV3(const PigSettings_t* settings, MyStr_t key, v3* valueOut = nullptr, bool ignoreCase = true, TryParseFailureReason_t* parseFailureReasonOut = nullptr)
 {
-	NotNull(settings);
-	NotNullStr(&key);
-	MyStr_t settingValue;
-	if (PigTryGetSettingStr(settings, key, &settingValue, ignoreCase))
-	{
-		if (TryParseV3(settingValue, valueOut, parseFailureReasonOut)) { return TryGetSettingResult_Success; }
-		else { return TryGetSettingResult_ParseError; }
-	}
-	return TryGetSettingResult_Missing;
+	const PigSettingsEntry_t* setting = PigGetSettingEntry((PigSettings_t*)settings, key, ignoreCase);
+	if (setting == nullptr) { return TryGetSettingResult_Missing; }
+	if (!PigParseSettingCached(setting, PigSettingsCacheType_V3, parseFailureReasonOut)) { return TryGetSettingResult_ParseError; }
+	if (valueOut != nullptr) { *valueOut = setting->cache.v3Value; }
+	return TryGetSettingResult_Success;
 }
 TryGetSettingResult_t PigTryGetSettingV3(const PigSettings_t* settings, const char* keyNullTerm, v3* valueOut = nullptr, bool ignoreCase = true, TryParseFailureReason_t* parseFailureReasonOut = nullptr)
 {
@@ -645,15 +741,11 @@ v3 PigGetSettingV3(const PigSettings_t* settings, const char* keyNullTerm, v3 de
 
 TryGetSettingResult_t PigTryGetSettingV2i(const PigSettings_t* settings, MyStr_t key, v2i* valueOut = nullptr, bool ignoreCase = true, TryParseFailureReason_t* parseFailureReasonOut = nullptr)
 {
-	NotNull(settings);
-	NotNullStr(&key);
-	MyStr_t settingValue;
-	if (PigTryGetSettingStr(settings, key, &settingValue, ignoreCase))
-	{
-		if (TryParseV2i(settingValue, valueOut, parseFailureReasonOut)) { return TryGetSettingResult_Success; }
-		else { return TryGetSettingResult_ParseError; }
-	}
-	return TryGetSettingResult_Missing;
+	const PigSettingsEntry_t* setting = PigGetSettingEntry((PigSettings_t*)settings, key, ignoreCase);
+	if (setting == nullptr) { return TryGetSettingResult_Missing; }
+	if (!PigParseSettingCached(setting, PigSettingsCacheType_V2i, parseFailureReasonOut)) { return TryGetSettingResult_ParseError; }
+	if (valueOut != nullptr) { *valueOut = setting->cache.v2iValue; }
+	return TryGetSettingResult_Success;
 }
 TryGetSettingResult_t PigTryGetSettingV2i(const PigSettings_t* settings, const char* keyNullTerm, v2i* valueOut = nullptr, bool ignoreCase = true, TryParseFailureReason_t* parseFailureReasonOut = nullptr)
 {
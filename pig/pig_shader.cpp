@@ -90,12 +90,22 @@ void DestroyShader(Shader_t* shader)
 		FreeString(shader->allocArena, &shader->linkLog);
 	}
 	AssertIf(shader->dynamicUniforms.length > 0, shader->allocArena != nullptr);
-	VarArrayLoop(&shader->dynamicUniforms, uIndex)
+	for (u64 uIndex = 0; uIndex < shader->dynamicUniforms.length; uIndex++)
 	{
-		VarArrayLoopGet(ShaderDynamicUniform_t, uniform, &shader->dynamicUniforms, uIndex);
+		ShaderDynamicUniform_t* uniform = BktArrayGet(&shader->dynamicUniforms, ShaderDynamicUniform_t, uIndex);
 		FreeString(shader->allocArena, &uniform->name);
 	}
-	FreeVarArray(&shader->dynamicUniforms);
+	FreeBktArray(&shader->dynamicUniforms);
+	if (shader->uniformTable != nullptr)
+	{
+		NotNull(shader->allocArena);
+		FreeMem(shader->allocArena, shader->uniformTable, sizeof(ShaderDynamicUniform_t*) * shader->uniformTableSize);
+	}
+	if (shader->uniformShadow != nullptr)
+	{
+		NotNull(shader->allocArena);
+		FreeMem(shader->allocArena, shader->uniformShadow, sizeof(ShaderUniformShadow_t));
+	}
 	AssertIf(shader->vertexCodePieces.length > 0, shader->allocArena != nullptr);
 	VarArrayLoop(&shader->vertexCodePieces, pIndex)
 	{
@@ -113,6 +123,225 @@ void DestroyShader(Shader_t* shader)
 	ClearPointer(shader);
 }
 
+// +--------------------------------------------------------------+
+// |                    Dynamic Uniform Table                     |
+// +--------------------------------------------------------------+
+ShaderDynamicUniform_t* FindShaderDynamicUniform(Shader_t* shader, MyStr_t uniformName, u64 nameHash)
+{
+	NotNull(shader);
+	if (shader->uniformTable == nullptr) { return nullptr; }
+	u64 tableMask = shader->uniformTableSize-1;
+	for (u64 probeIndex = 0; probeIndex < shader->uniformTableSize; probeIndex++)
+	{
+		ShaderDynamicUniform_t* uniform = shader->uniformTable[(nameHash + probeIndex) & tableMask];
+		if (uniform == nullptr) { return nullptr; }
+		if (uniform->nameHash == nameHash && StrEquals(uniform->name, uniformName)) { return uniform; }
+	}
+	return nullptr;
+}
+
+void InsertShaderUniformIntoTable(Shader_t* shader, ShaderDynamicUniform_t* uniform)
+{
+	NotNull2(shader, uniform);
+	NotNull(shader->uniformTable);
+	u64 tableMask = shader->uniformTableSize-1;
+	for (u64 probeIndex = 0; probeIndex < shader->uniformTableSize; probeIndex++)
+	{
+		u64 slotIndex = ((uniform->nameHash + probeIndex) & tableMask);
+		if (shader->uniformTable[slotIndex] == nullptr) { shader->uniformTable[slotIndex] = uniform; return; }
+	}
+	AssertMsg(false, "Shader uniform table was full!");
+}
+
+void ResizeShaderUniformTable(Shader_t* shader, u64 newTableSize)
+{
+	NotNull(shader);
+	NotNull(shader->allocArena);
+	Assert(newTableSize > 0 && (newTableSize & (newTableSize-1)) == 0);
+	if (shader->uniformTable != nullptr)
+	{
+		FreeMem(shader->allocArena, shader->uniformTable, sizeof(ShaderDynamicUniform_t*) * shader->uniformTableSize);
+	}
+	shader->uniformTable = AllocArray(shader->allocArena, ShaderDynamicUniform_t*, newTableSize);
+	NotNull(shader->uniformTable);
+	MyMemSet(shader->uniformTable, 0x00, sizeof(ShaderDynamicUniform_t*) * newTableSize);
+	shader->uniformTableSize = newTableSize;
+	for (u64 uIndex = 0; uIndex < shader->dynamicUniforms.length; uIndex++)
+	{
+		InsertShaderUniformIntoTable(shader, BktArrayGet(&shader->dynamicUniforms, ShaderDynamicUniform_t, uIndex));
+	}
+}
+
+//NOTE: Names that the program doesn't have are added too (with isPresent = false) so we only ever ask the API about them once
+ShaderDynamicUniform_t* AddShaderDynamicUniform(Shader_t* shader, MyStr_t uniformName, u64 nameHash, bool isPresent)
+{
+	NotNull(shader);
+	NotNull(shader->allocArena);
+	ShaderDynamicUniform_t* newUniform = BktArrayAdd(&shader->dynamicUniforms, ShaderDynamicUniform_t);
+	NotNull(newUniform);
+	ClearPointer(newUniform);
+	newUniform->uniformIndex = (shader->dynamicUniforms.length-1);
+	newUniform->name = AllocString(shader->allocArena, &uniformName);
+	newUniform->nameHash = nameHash;
+	newUniform->isPresent = isPresent;
+	#if OPENGL_SUPPORTED
+	newUniform->glLocation = -1;
+	#endif
+	
+	if (shader->dynamicUniforms.length*2 > shader->uniformTableSize)
+	{
+		ResizeShaderUniformTable(shader, MaxU64(shader->uniformTableSize*2, SHADER_UNIFORM_TABLE_MIN_SIZE));
+	}
+	else { InsertShaderUniformIntoTable(shader, newUniform); }
+	return newUniform;
+}
+
+// +--------------------------------------------------------------+
+// |                     Shader Binary Cache                      |
+// +--------------------------------------------------------------+
+//NOTE: Covers everything that decides what program comes out of CreateShaderMultiPieceEnd
+u64 GetShaderSourceHash(Shader_t* shader)
+{
+	NotNull(shader);
+	u32 vertexType = (u32)shader->vertexType;
+	u64 result = FnvHashU64(&vertexType, sizeof(vertexType));
+	result = FnvHashU64(&shader->requiredUniforms, sizeof(shader->requiredUniforms), result);
+	VarArrayLoop(&shader->vertexCodePieces, pIndex)
+	{
+		VarArrayLoopGet(MyStr_t, codePiece, &shader->vertexCodePieces, pIndex);
+		result = FnvHashU64(codePiece->pntr, codePiece->length, result);
+	}
+	u8 separator = 0xFF; //so moving code from the end of the vertex pieces to the start of the fragment pieces changes the hash
+	result = FnvHashU64(&separator, sizeof(separator), result);
+	VarArrayLoop(&shader->fragmentCodePieces, pIndex)
+	{
+		VarArrayLoopGet(MyStr_t, codePiece, &shader->fragmentCodePieces, pIndex);
+		result = FnvHashU64(codePiece->pntr, codePiece->length, result);
+	}
+	return result;
+}
+
+//NOTE: "<SavesAndSettings>/ShaderCache/0123456789ABCDEF.pshb", empty if the platform couldn't give us a folder
+MyStr_t GetShaderBinaryCachePath(u64 sourceHash, MemArena_t* memArena)
+{
+	NotNull(memArena);
+	MemArena_t* scratch = GetScratchArena(memArena);
+	MyStr_t folderPath = plat->GetSpecialFolderPath(SpecialFolder_SavesAndSettings, NewStr(PROJECT_NAME_SAFE_STR), scratch);
+	MyStr_t result = MyStr_Empty;
+	if (folderPath.length > 0)
+	{
+		result = PrintInArenaStr(memArena, "%.*s/" SHADER_BINARY_CACHE_FOLDER "/%016llX" SHADER_BINARY_FILE_EXTENSION, StrPrint(folderPath), sourceHash);
+	}
+	FreeScratchArena(scratch);
+	return result;
+}
+
+#if OPENGL_SUPPORTED
+//Called once after glad is loaded. The driver hash makes binaries from a different GPU or driver version miss instead of failing in glProgramBinary
+void InitShaderBinaryCache_OpenGL()
+{
+	pig->shaderBinaryCacheEnabled = false;
+	pig->shaderDriverHash = 0;
+	#if PIG_SHADER_BINARY_CACHE
+	if (GLAD_GL_ARB_get_program_binary == 0 && !(GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 1))) { return; }
+	GLint numBinaryFormats = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numBinaryFormats);
+	if (CheckOpenGlError() != nullptr || numBinaryFormats <= 0) { return; } //some drivers support the extension but don't offer any formats
+	
+	const char* driverStrs[] = { (const char*)glGetString(GL_VENDOR), (const char*)glGetString(GL_RENDERER), (const char*)glGetString(GL_VERSION) };
+	u64 driverHash = 0;
+	for (u64 sIndex = 0; sIndex < ArrayCount(driverStrs); sIndex++)
+	{
+		if (driverStrs[sIndex] == nullptr) { return; }
+		driverHash = FnvHashU64(driverStrs[sIndex], MyStrLength64(driverStrs[sIndex]), driverHash);
+	}
+	pig->shaderDriverHash = driverHash;
+	pig->shaderBinaryCacheEnabled = true;
+	#endif
+}
+
+//NOTE: On failure the program is left unlinked and can still be compiled and linked from source like normal
+bool TryLoadShaderBinary_OpenGL(Shader_t* shader)
+{
+	NotNull(shader);
+	if (!pig->shaderBinaryCacheEnabled) { return false; }
+	
+	MemArena_t* scratch = GetScratchArena(shader->allocArena);
+	MyStr_t cachePath = GetShaderBinaryCachePath(shader->sourceHash, scratch);
+	bool result = false;
+	PlatMappedFile_t cacheFile = {};
+	if (cachePath.length > 0 && plat->MapFile(cachePath, &cacheFile))
+	{
+		const ShaderBinaryHeader_t* header = (const ShaderBinaryHeader_t*)cacheFile.data;
+		if (cacheFile.size >= sizeof(ShaderBinaryHeader_t) &&
+			MyMemCompare(&header->magic[0], SHADER_BINARY_MAGIC, sizeof(header->magic)) == 0 &&
+			header->version == SHADER_BINARY_VERSION &&
+			header->sourceHash == shader->sourceHash &&
+			header->driverHash == pig->shaderDriverHash &&
+			header->binarySize > 0 && sizeof(ShaderBinaryHeader_t) + header->binarySize <= cacheFile.size)
+		{
+			glProgramBinary(shader->glId, (GLenum)header->binaryFormat, cacheFile.data + sizeof(ShaderBinaryHeader_t), (GLsizei)header->binarySize);
+			const char* errorStr = CheckOpenGlError(true);
+			GLint linkStatus = GL_FALSE;
+			if (errorStr == nullptr)
+			{
+				glGetProgramiv(shader->glId, GL_LINK_STATUS, &linkStatus);
+				errorStr = CheckOpenGlError(true);
+			}
+			result = (errorStr == nullptr && linkStatus == GL_TRUE);
+			if (!result) { PrintLine_W("Cached shader binary \"%.*s\" was rejected by the driver (%s), compiling from source", StrPrint(cachePath), (errorStr != nullptr) ? errorStr : "link failed"); }
+		}
+		plat->UnmapFile(&cacheFile);
+	}
+	
+	if (result) { pig->numShaderBinaryHits++; }
+	else { pig->numShaderBinaryMisses++; }
+	FreeScratchArena(scratch);
+	return result;
+}
+
+//NOTE: Failing to save just means the next run compiles this shader again, so nothing here is treated as an error
+void SaveShaderBinary_OpenGL(Shader_t* shader)
+{
+	NotNull(shader);
+	if (!pig->shaderBinaryCacheEnabled) { return; }
+	
+	GLint binaryLength = 0;
+	glGetProgramiv(shader->glId, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+	if (CheckOpenGlError() != nullptr || binaryLength <= 0) { return; }
+	
+	MemArena_t* scratch = GetScratchArena(shader->allocArena);
+	u64 fileSize = sizeof(ShaderBinaryHeader_t) + (u64)binaryLength;
+	u8* fileData = AllocArray(scratch, u8, fileSize);
+	NotNull(fileData);
+	ShaderBinaryHeader_t* header = (ShaderBinaryHeader_t*)fileData;
+	ClearPointer(header);
+	
+	GLsizei actualLength = 0;
+	GLenum binaryFormat = GL_NONE;
+	glGetProgramBinary(shader->glId, binaryLength, &actualLength, &binaryFormat, fileData + sizeof(ShaderBinaryHeader_t));
+	if (CheckOpenGlError() == nullptr && actualLength > 0 && actualLength <= binaryLength)
+	{
+		MyMemCopy(&header->magic[0], SHADER_BINARY_MAGIC, sizeof(header->magic));
+		header->version = SHADER_BINARY_VERSION;
+		header->sourceHash = shader->sourceHash;
+		header->driverHash = pig->shaderDriverHash;
+		header->binaryFormat = (u32)binaryFormat;
+		header->binarySize = (u32)actualLength;
+		MyStr_t cachePath = GetShaderBinaryCachePath(shader->sourceHash, scratch);
+		if (cachePath.length > 0)
+		{
+			CreateFoldersForPath(cachePath);
+			if (!plat->WriteEntireFile(cachePath, fileData, sizeof(ShaderBinaryHeader_t) + (u64)actualLength))
+			{
+				PrintLine_W("Failed to write shader binary to \"%.*s\"", StrPrint(cachePath));
+			}
+		}
+	}
+	FreeScratchArena(scratch);
+}
+#endif //OPENGL_SUPPORTED
+
 void CreateShaderMultiPieceStart(MemArena_t* memArena, Shader_t* shaderOut, VertexType_t vertexType, u32 requiredUniforms, u64 numVertexPieces = 0, u64 numFragmentPieces = 0)
 {
 	AssertSingleThreaded();
@@ -124,7 +353,7 @@ void CreateShaderMultiPieceStart(MemArena_t* memArena, Shader_t* shaderOut, Vert
 	shaderOut->error = Result_None;
 	shaderOut->vertexType = vertexType;
 	shaderOut->requiredUniforms = requiredUniforms;
-	CreateVarArray(&shaderOut->dynamicUniforms, memArena, sizeof(ShaderDynamicUniform_t));
+	CreateBktArray(&shaderOut->dynamicUniforms, memArena, sizeof(ShaderDynamicUniform_t), 16);
 	
 	CreateVarArray(&shaderOut->vertexCodePieces, memArena, sizeof(MyStr_t), numVertexPieces);
 	CreateVarArray(&shaderOut->fragmentCodePieces, memArena, sizeof(MyStr_t), numFragmentPieces);
@@ -221,6 +450,7 @@ bool CreateShaderMultiPieceEnd(Shader_t* shaderOut)
 	NotNull(shaderOut->allocArena);
 	if (shaderOut->error != Result_None) { return false; }
 	
+	shaderOut->sourceHash = GetShaderSourceHash(shaderOut);
 	bool isSlugShader = IsFlagSet(shaderOut->vertexType, VertexType_SlugBit);
 	bool result = false;
 	const char* errorStr = nullptr;
@@ -246,172 +476,186 @@ bool CreateShaderMultiPieceEnd(Shader_t* shaderOut)
 			if (shaderOut->fragmentCodePieces.length == 0) { shaderOut->error = Result_NoFragShaderPieces; return false; }
 			
 			// +==============================+
-			// |    Compile Vertex Shader     |
+			// |  Try the Shader Binary Cache |
 			// +==============================+
-			GLchar** glVertexCodePiecePntrs = AllocArray(TempArena, GLchar*, shaderOut->vertexCodePieces.length);
-			NotNull(glVertexCodePiecePntrs);
-			GLint* glVertexCodePieceLengths = AllocArray(TempArena, GLint, shaderOut->vertexCodePieces.length);
-			NotNull(glVertexCodePieceLengths);
-			u64 totalVertexCodeLength = 0;
-			VarArrayLoop(&shaderOut->vertexCodePieces, pIndex)
-			{
-				VarArrayLoopGet(MyStr_t, codePiece, &shaderOut->vertexCodePieces, pIndex);
-				glVertexCodePiecePntrs[pIndex] = (GLchar*)codePiece->pntr;
-				glVertexCodePieceLengths[pIndex] = (GLint)codePiece->length;
-				totalVertexCodeLength += codePiece->length;
-			}
-			if (totalVertexCodeLength == 0) { shaderOut->error = Result_EmptyFile; return false; }
-			
-			glShaderSource(shaderOut->glVertId, (GLsizei)shaderOut->vertexCodePieces.length, glVertexCodePiecePntrs, glVertexCodePieceLengths);
-			CreateShader_CheckOpenGlError("glShaderSource(vertId)") { return false; }
-			glCompileShader(shaderOut->glVertId);
-			CreateShader_CheckOpenGlError("glCompileShader(vertId)") { return false; }
-			
-			// +==================================+
-			// | Check Vertex Compilation Status  |
-			// +==================================+
-			GLint vertCompileStatus = 0;
-			GLint vertInfoLogLength = 0;
-			glGetShaderiv(shaderOut->glVertId, GL_COMPILE_STATUS, &vertCompileStatus);
-			CreateShader_CheckOpenGlError("glGetShaderiv(vertId, GL_COMPILE_STATUS)") { return false; }
-			glGetShaderiv(shaderOut->glVertId, GL_INFO_LOG_LENGTH, &vertInfoLogLength);
-			CreateShader_CheckOpenGlError("glGetShaderiv(vertId, GL_INFO_LOG_LENGTH)") { return false; }
-			
-			if (vertInfoLogLength < 0)
-			{
-				PrintLine_W("Warning: GL_INFO_LOG_LENGTH came back as negative: %d", vertInfoLogLength);
-				vertInfoLogLength = 0;
-			}
-			if (vertCompileStatus != GL_TRUE)
+			shaderOut->loadedFromBinary = TryLoadShaderBinary_OpenGL(shaderOut);
+			if (!shaderOut->loadedFromBinary)
 			{
-				PrintLine_E("Vertex compilation failed with %d byte info log", vertInfoLogLength);
-			}
-			//NOTE: We were getting 1 byte logs before so we just put a lower bound on length
-			//      to make sure the log actually has useful informatin in it before printing it out
-			if (vertInfoLogLength > 3)
-			{
-				shaderOut->vertexLog.pntr = AllocArray(shaderOut->allocArena, char, (u64)vertInfoLogLength+1);
-				if (shaderOut->vertexLog.pntr != nullptr)
+				// +==============================+
+				// |    Compile Vertex Shader     |
+				// +==============================+
+				GLchar** glVertexCodePiecePntrs = AllocArray(TempArena, GLchar*, shaderOut->vertexCodePieces.length);
+				NotNull(glVertexCodePiecePntrs);
+				GLint* glVertexCodePieceLengths = AllocArray(TempArena, GLint, shaderOut->vertexCodePieces.length);
+				NotNull(glVertexCodePieceLengths);
+				u64 totalVertexCodeLength = 0;
+				VarArrayLoop(&shaderOut->vertexCodePieces, pIndex)
 				{
-					shaderOut->vertexLog.length = (u64)vertInfoLogLength;
-					glGetShaderInfoLog(shaderOut->glVertId, vertInfoLogLength, NULL, shaderOut->vertexLog.pntr);
-					CreateShader_CheckOpenGlError("glGetShaderInfoLog(vertId)") { return false; }
-					shaderOut->vertexLog.pntr[shaderOut->vertexLog.length] = '\0';
-					PrintLineAt((vertCompileStatus != GL_TRUE) ? DbgLevel_Error : DbgLevel_Warning, "Vertex Log:\n%.*s", StrPrint(shaderOut->vertexLog));
+					VarArrayLoopGet(MyStr_t, codePiece, &shaderOut->vertexCodePieces, pIndex);
+					glVertexCodePiecePntrs[pIndex] = (GLchar*)codePiece->pntr;
+					glVertexCodePieceLengths[pIndex] = (GLint)codePiece->length;
+					totalVertexCodeLength += codePiece->length;
 				}
-				else { PrintLine_W("Warning: Failed to allocate space for %d byte vertex shader log!", vertInfoLogLength); }
-			}
-			if (vertCompileStatus != GL_TRUE)
-			{
-				shaderOut->error = Result_VertexCompileFailed;
-				return false;
-			}
-			
-			// +==============================+
-			// |   Compile Fragment Shader    |
-			// +==============================+
-			GLchar** glFragmentCodePiecePntrs = AllocArray(TempArena, GLchar*, shaderOut->fragmentCodePieces.length);
-			NotNull(glFragmentCodePiecePntrs);
-			GLint* glFragmentCodePieceLengths = AllocArray(TempArena, GLint, shaderOut->fragmentCodePieces.length);
-			NotNull(glFragmentCodePieceLengths);
-			u64 totalFragmentCodeLength = 0;
-			VarArrayLoop(&shaderOut->fragmentCodePieces, pIndex)
-			{
-				VarArrayLoopGet(MyStr_t, codePiece, &shaderOut->fragmentCodePieces, pIndex);
-				glFragmentCodePiecePntrs[pIndex] = (GLchar*)codePiece->pntr;
-				glFragmentCodePieceLengths[pIndex] = (GLint)codePiece->length;
-				totalFragmentCodeLength += codePiece->length;
-			}
-			if (totalFragmentCodeLength == 0) { shaderOut->error = Result_EmptyFile; return false; }
-			
-			glShaderSource(shaderOut->glFragId, (GLsizei)shaderOut->fragmentCodePieces.length, glFragmentCodePiecePntrs, glFragmentCodePieceLengths);
-			CreateShader_CheckOpenGlError("glShaderSource(fragId)") { return false; }
-			glCompileShader(shaderOut->glFragId);
-			CreateShader_CheckOpenGlError("glCompileShader(fragId)") { return false; }
-			
-			// +==================================+
-			// | Check Vertex Compilation Status  |
-			// +==================================+
-			GLint fragCompileStatus = 0;
-			GLint fragInfoLogLength = 0;
-			glGetShaderiv(shaderOut->glFragId, GL_COMPILE_STATUS, &fragCompileStatus);
-			CreateShader_CheckOpenGlError("glGetShaderiv(fragId, GL_COMPILE_STATUS)") { return false; }
-			glGetShaderiv(shaderOut->glFragId, GL_INFO_LOG_LENGTH, &fragInfoLogLength);
-			CreateShader_CheckOpenGlError("glGetShaderiv(fragId, GL_INFO_LOG_LENGTH)") { return false; }
-			
-			if (fragInfoLogLength < 0)
-			{
-				PrintLine_W("Warning: GL_INFO_LOG_LENGTH came back as negative: %d", fragInfoLogLength);
-				fragInfoLogLength = 0;
-			}
-			if (fragCompileStatus != GL_TRUE)
-			{
-				PrintLine_E("Fragment compilation failed with %d byte info log", fragInfoLogLength);
-			}
-			//NOTE: We were getting 1 byte logs before so we just put a lower bound on length
-			//      to make sure the log actually has useful informatin in it before printing it out
-			if (fragInfoLogLength > 3)
-			{
-				shaderOut->fragmentLog.pntr = AllocArray(shaderOut->allocArena, char, (u64)fragInfoLogLength+1);
-				if (shaderOut->fragmentLog.pntr != nullptr)
+				if (totalVertexCodeLength == 0) { shaderOut->error = Result_EmptyFile; return false; }
+				
+				glShaderSource(shaderOut->glVertId, (GLsizei)shaderOut->vertexCodePieces.length, glVertexCodePiecePntrs, glVertexCodePieceLengths);
+				CreateShader_CheckOpenGlError("glShaderSource(vertId)") { return false; }
+				glCompileShader(shaderOut->glVertId);
+				CreateShader_CheckOpenGlError("glCompileShader(vertId)") { return false; }
+				
+				// +==================================+
+				// | Check Vertex Compilation Status  |
+				// +==================================+
+				GLint vertCompileStatus = 0;
+				GLint vertInfoLogLength = 0;
+				glGetShaderiv(shaderOut->glVertId, GL_COMPILE_STATUS, &vertCompileStatus);
+				CreateShader_CheckOpenGlError("glGetShaderiv(vertId, GL_COMPILE_STATUS)") { return false; }
+				glGetShaderiv(shaderOut->glVertId, GL_INFO_LOG_LENGTH, &vertInfoLogLength);
+				CreateShader_CheckOpenGlError("glGetShaderiv(vertId, GL_INFO_LOG_LENGTH)") { return false; }
+				
+				if (vertInfoLogLength < 0)
 				{
-					shaderOut->fragmentLog.length = (u64)fragInfoLogLength;
-					glGetShaderInfoLog(shaderOut->glFragId, fragInfoLogLength, NULL, shaderOut->fragmentLog.pntr);
-					CreateShader_CheckOpenGlError("glGetShaderInfoLog(fragId)") { return false; }
-					shaderOut->fragmentLog.pntr[shaderOut->fragmentLog.length] = '\0';
-					PrintLineAt((fragCompileStatus != GL_TRUE) ? DbgLevel_Error : DbgLevel_Warning, "Fragment Log:\n%.*s", StrPrint(shaderOut->fragmentLog));
+					PrintLine_W("Warning: GL_INFO_LOG_LENGTH came back as negative: %d", vertInfoLogLength);
+					vertInfoLogLength = 0;
 				}
-				else { PrintLine_W("Warning: Failed to allocate space for %d byte fragment shader log!", fragInfoLogLength); }
-			}
-			if (fragCompileStatus != GL_TRUE)
-			{
-				shaderOut->error = Result_VertexCompileFailed;
-				return false;
-			}
-			
-			// +==============================+
-			// |   Attach and Link Shaders    |
-			// +==============================+
-			glAttachShader(shaderOut->glId, shaderOut->glVertId);
-			CreateShader_CheckOpenGlError("glAttachShader(vertId)") { return false; }
-			glAttachShader(shaderOut->glId, shaderOut->glFragId);
-			CreateShader_CheckOpenGlError("glAttachShader(fragId)") { return false; }
-			glLinkProgram(shaderOut->glId);
-			CreateShader_CheckOpenGlError("glLinkProgram(programId)") { return false; }
-			
-			// +==============================+
-			// |      Check Link Status       |
-			// +==============================+
-			GLint linkStatus = 0;
-			GLint linkInfoLogLength = 0;
-			glGetProgramiv(shaderOut->glId, GL_LINK_STATUS, &linkStatus);
-			CreateShader_CheckOpenGlError("glGetProgramiv(programId, GL_LINK_STATUS)") { return false; }
-			glGetProgramiv(shaderOut->glId, GL_INFO_LOG_LENGTH, &linkInfoLogLength);
-			CreateShader_CheckOpenGlError("glGetProgramiv(programId, GL_INFO_LOG_LENGTH)") { return false; }
-			
-			if (linkStatus != GL_TRUE)
-			{
-				PrintLine_E("Shader linking failed with %d byte info log", linkInfoLogLength);
-			}
-			//NOTE: We were getting 1 byte logs before so we just put a lower bound on length
-			//      to make sure the log actually has useful informatin in it before printing it out
-			if (linkInfoLogLength > 3)
-			{
-				shaderOut->linkLog.pntr = AllocArray(shaderOut->allocArena, char, (u64)linkInfoLogLength+1);
-				if (shaderOut->linkLog.pntr != nullptr)
+				if (vertCompileStatus != GL_TRUE)
 				{
-					shaderOut->linkLog.length = (u64)linkInfoLogLength;
-					glGetProgramInfoLog(shaderOut->glId, linkInfoLogLength, NULL, shaderOut->linkLog.pntr);
-					CreateShader_CheckOpenGlError("glGetProgramInfoLog(programId)") { return false; }
-					shaderOut->linkLog.pntr[shaderOut->linkLog.length] = '\0';
-					PrintLineAt((linkStatus != GL_TRUE) ? DbgLevel_Error : DbgLevel_Warning, "Link Log:\n%.*s", StrPrint(shaderOut->linkLog));
+					PrintLine_E("Vertex compilation failed with %d byte info log", vertInfoLogLength);
 				}
-				else { PrintLine_W("Warning: Failed to allocate space for %d byte link log!", linkInfoLogLength); }
-			}
-			if (linkStatus != GL_TRUE)
-			{
-				shaderOut->error = Result_LinkingFailed;
-				return false;
+				//NOTE: We were getting 1 byte logs before so we just put a lower bound on length
+				//      to make sure the log actually has useful informatin in it before printing it out
+				if (vertInfoLogLength > 3)
+				{
+					shaderOut->vertexLog.pntr = AllocArray(shaderOut->allocArena, char, (u64)vertInfoLogLength+1);
+					if (shaderOut->vertexLog.pntr != nullptr)
+					{
+						shaderOut->vertexLog.length = (u64)vertInfoLogLength;
+						glGetShaderInfoLog(shaderOut->glVertId, vertInfoLogLength, NULL, shaderOut->vertexLog.pntr);
+						CreateShader_CheckOpenGlError("glGetShaderInfoLog(vertId)") { return false; }
+						shaderOut->vertexLog.pntr[shaderOut->vertexLog.length] = '\0';
+						PrintLineAt((vertCompileStatus != GL_TRUE) ? DbgLevel_Error : DbgLevel_Warning, "Vertex Log:\n%.*s", StrPrint(shaderOut->vertexLog));
+					}
+					else { PrintLine_W("Warning: Failed to allocate space for %d byte vertex shader log!", vertInfoLogLength); }
+				}
+				if (vertCompileStatus != GL_TRUE)
+				{
+					shaderOut->error = Result_VertexCompileFailed;
+					return false;
+				}
+				
+				// +==============================+
+				// |   Compile Fragment Shader    |
+				// +==============================+
+				GLchar** glFragmentCodePiecePntrs = AllocArray(TempArena, GLchar*, shaderOut->fragmentCodePieces.length);
+				NotNull(glFragmentCodePiecePntrs);
+				GLint* glFragmentCodePieceLengths = AllocArray(TempArena, GLint, shaderOut->fragmentCodePieces.length);
+				NotNull(glFragmentCodePieceLengths);
+				u64 totalFragmentCodeLength = 0;
+				VarArrayLoop(&shaderOut->fragmentCodePieces, pIndex)
+				{
+					VarArrayLoopGet(MyStr_t, codePiece, &shaderOut->fragmentCodePieces, pIndex);
+					glFragmentCodePiecePntrs[pIndex] = (GLchar*)codePiece->pntr;
+					glFragmentCodePieceLengths[pIndex] = (GLint)codePiece->length;
+					totalFragmentCodeLength += codePiece->length;
+				}
+				if (totalFragmentCodeLength == 0) { shaderOut->error = Result_EmptyFile; return false; }
+				
+				glShaderSource(shaderOut->glFragId, (GLsizei)shaderOut->fragmentCodePieces.length, glFragmentCodePiecePntrs, glFragmentCodePieceLengths);
+				CreateShader_CheckOpenGlError("glShaderSource(fragId)") { return false; }
+				glCompileShader(shaderOut->glFragId);
+				CreateShader_CheckOpenGlError("glCompileShader(fragId)") { return false; }
+				
+				// +==================================+
+				// | Check Vertex Compilation Status  |
+				// +==================================+
+				GLint fragCompileStatus = 0;
+				GLint fragInfoLogLength = 0;
+				glGetShaderiv(shaderOut->glFragId, GL_COMPILE_STATUS, &fragCompileStatus);
+				CreateShader_CheckOpenGlError("glGetShaderiv(fragId, GL_COMPILE_STATUS)") { return false; }
+				glGetShaderiv(shaderOut->glFragId, GL_INFO_LOG_LENGTH, &fragInfoLogLength);
+				CreateShader_CheckOpenGlError("glGetShaderiv(fragId, GL_INFO_LOG_LENGTH)") { return false; }
+				
+				if (fragInfoLogLength < 0)
+				{
+					PrintLine_W("Warning: GL_INFO_LOG_LENGTH came back as negative: %d", fragInfoLogLength);
+					fragInfoLogLength = 0;
+				}
+				if (fragCompileStatus != GL_TRUE)
+				{
+					PrintLine_E("Fragment compilation failed with %d byte info log", fragInfoLogLength);
+				}
+				//NOTE: We were getting 1 byte logs before so we just put a lower bound on length
+				//      to make sure the log actually has useful informatin in it before printing it out
+				if (fragInfoLogLength > 3)
+				{
+					shaderOut->fragmentLog.pntr = AllocArray(shaderOut->allocArena, char, (u64)fragInfoLogLength+1);
+					if (shaderOut->fragmentLog.pntr != nullptr)
+					{
+						shaderOut->fragmentLog.length = (u64)fragInfoLogLength;
+						glGetShaderInfoLog(shaderOut->glFragId, fragInfoLogLength, NULL, shaderOut->fragmentLog.pntr);
+						CreateShader_CheckOpenGlError("glGetShaderInfoLog(fragId)") { return false; }
+						shaderOut->fragmentLog.pntr[shaderOut->fragmentLog.length] = '\0';
+						PrintLineAt((fragCompileStatus != GL_TRUE) ? DbgLevel_Error : DbgLevel_Warning, "Fragment Log:\n%.*s", StrPrint(shaderOut->fragmentLog));
+					}
+					else { PrintLine_W("Warning: Failed to allocate space for %d byte fragment shader log!", fragInfoLogLength); }
+				}
+				if (fragCompileStatus != GL_TRUE)
+				{
+					shaderOut->error = Result_VertexCompileFailed;
+					return false;
+				}
+				
+				// +==============================+
+				// |   Attach and Link Shaders    |
+				// +==============================+
+				glAttachShader(shaderOut->glId, shaderOut->glVertId);
+				CreateShader_CheckOpenGlError("glAttachShader(vertId)") { return false; }
+				glAttachShader(shaderOut->glId, shaderOut->glFragId);
+				CreateShader_CheckOpenGlError("glAttachShader(fragId)") { return false; }
+				if (pig->shaderBinaryCacheEnabled)
+				{
+					glProgramParameteri(shaderOut->glId, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+					CreateShader_CheckOpenGlError("glProgramParameteri(programId, GL_PROGRAM_BINARY_RETRIEVABLE_HINT)") { return false; }
+				}
+				glLinkProgram(shaderOut->glId);
+				CreateShader_CheckOpenGlError("glLinkProgram(programId)") { return false; }
+				
+				// +==============================+
+				// |      Check Link Status       |
+				// +==============================+
+				GLint linkStatus = 0;
+				GLint linkInfoLogLength = 0;
+				glGetProgramiv(shaderOut->glId, GL_LINK_STATUS, &linkStatus);
+				CreateShader_CheckOpenGlError("glGetProgramiv(programId, GL_LINK_STATUS)") { return false; }
+				glGetProgramiv(shaderOut->glId, GL_INFO_LOG_LENGTH, &linkInfoLogLength);
+				CreateShader_CheckOpenGlError("glGetProgramiv(programId, GL_INFO_LOG_LENGTH)") { return false; }
+				
+				if (linkStatus != GL_TRUE)
+				{
+					PrintLine_E("Shader linking failed with %d byte info log", linkInfoLogLength);
+				}
+				//NOTE: We were getting 1 byte logs before so we just put a lower bound on length
+				//      to make sure the log actually has useful informatin in it before printing it out
+				if (linkInfoLogLength > 3)
+				{
+					shaderOut->linkLog.pntr = AllocArray(shaderOut->allocArena, char, (u64)linkInfoLogLength+1);
+					if (shaderOut->linkLog.pntr != nullptr)
+					{
+						shaderOut->linkLog.length = (u64)linkInfoLogLength;
+						glGetProgramInfoLog(shaderOut->glId, linkInfoLogLength, NULL, shaderOut->linkLog.pntr);
+						CreateShader_CheckOpenGlError("glGetProgramInfoLog(programId)") { return false; }
+						shaderOut->linkLog.pntr[shaderOut->linkLog.length] = '\0';
+						PrintLineAt((linkStatus != GL_TRUE) ? DbgLevel_Error : DbgLevel_Warning, "Link Log:\n%.*s", StrPrint(shaderOut->linkLog));
+					}
+					else { PrintLine_W("Warning: Failed to allocate space for %d byte link log!", linkInfoLogLength); }
+				}
+				if (linkStatus != GL_TRUE)
+				{
+					shaderOut->error = Result_LinkingFailed;
+					return false;
+				}
+				
+				SaveShaderBinary_OpenGL(shaderOut);
 			}
 			
 			// +==============================+
@@ -543,6 +787,42 @@ bool CreateShaderMultiPieceEnd(Shader_t* shaderOut)
 			CreateShader_FindUniform(shaderOut->glLocations.polygonPlanes,          "PolygonPlanes",          ShaderUniform_PolygonPlanes);
 			#undef CreateShader_FindUniform
 			
+			// +==============================+
+			// |    Resolve Active Uniforms   |
+			// +==============================+
+			//NOTE: Every uniform the program actually uses goes into the dynamic uniform table up front so
+			//      RcSetDynamicUniformX calls never have to ask the driver for a location
+			GLint numActiveUniforms = 0;
+			GLint maxUniformNameLength = 0;
+			glGetProgramiv(shaderOut->glId, GL_ACTIVE_UNIFORMS, &numActiveUniforms);
+			CreateShader_CheckOpenGlError("glGetProgramiv(programId, GL_ACTIVE_UNIFORMS)") { return false; }
+			glGetProgramiv(shaderOut->glId, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxUniformNameLength);
+			CreateShader_CheckOpenGlError("glGetProgramiv(programId, GL_ACTIVE_UNIFORM_MAX_LENGTH)") { return false; }
+			if (numActiveUniforms > 0 && maxUniformNameLength > 0)
+			{
+				GLchar* uniformNameBuffer = AllocArray(TempArena, GLchar, (u64)maxUniformNameLength+1);
+				NotNull(uniformNameBuffer);
+				for (GLint uIndex = 0; uIndex < numActiveUniforms; uIndex++)
+				{
+					GLsizei uniformNameLength = 0;
+					GLint uniformArraySize = 0;
+					GLenum uniformType = GL_NONE;
+					glGetActiveUniform(shaderOut->glId, (GLuint)uIndex, maxUniformNameLength+1, &uniformNameLength, &uniformArraySize, &uniformType, uniformNameBuffer);
+					CreateShader_CheckOpenGlError("glGetActiveUniform(programId)") { return false; }
+					MyStr_t uniformName = NewStr((u64)uniformNameLength, uniformNameBuffer);
+					//Arrays are reported as "name[0]" but they get looked up by their plain name
+					if (uniformName.length > 3 && MyStrCompare(&uniformName.pntr[uniformName.length-3], "[0]", 3) == 0) { uniformName.length -= 3; }
+					uniformName.pntr[uniformName.length] = '\0';
+					u64 nameHash = FnvHashU64(uniformName.pntr, uniformName.length);
+					if (FindShaderDynamicUniform(shaderOut, uniformName, nameHash) != nullptr) { continue; }
+					GLint uniformLocation = glGetUniformLocation(shaderOut->glId, uniformName.pntr);
+					CreateShader_CheckOpenGlError("glGetUniformLocation(programId)") { return false; }
+					if (uniformLocation < 0) { continue; } //members of uniform blocks and other things without a location
+					ShaderDynamicUniform_t* newUniform = AddShaderDynamicUniform(shaderOut, uniformName, nameHash, true);
+					newUniform->glLocation = uniformLocation;
+				}
+			}
+			
 			if (shaderOut->error == Result_None || shaderOut->error == Result_MissingAttribute || shaderOut->error == Result_MissingUniform)
 			{
 				shaderOut->isValid = true;
@@ -621,14 +901,9 @@ ShaderDynamicUniform_t* GetDynamicUniform(Shader_t* shader, MyStr_t uniformName,
 	NotNull(shader);
 	if (!shader->isValid) { return nullptr; }
 	
-	VarArrayLoop(&shader->dynamicUniforms, uIndex)
-	{
-		VarArrayLoopGet(ShaderDynamicUniform_t, uniform, &shader->dynamicUniforms, uIndex);
-		if (StrEquals(uniform->name, uniformName))
-		{
-			return uniform;
-		}
-	}
+	u64 nameHash = FnvHashU64(uniformName.pntr, uniformName.length);
+	ShaderDynamicUniform_t* existingUniform = FindShaderDynamicUniform(shader, uniformName, nameHash);
+	if (existingUniform != nullptr) { return (existingUniform->isPresent ? existingUniform : nullptr); }
 	
 	ShaderDynamicUniform_t* result = nullptr;
 	
@@ -639,23 +914,17 @@ ShaderDynamicUniform_t* GetDynamicUniform(Shader_t* shader, MyStr_t uniformName,
 			// +==============================+
 			// |            OpenGL            |
 			// +==============================+
+			//NOTE: Active uniforms were all added when the shader was linked, this only catches names that
+			//      weren't reported there. Misses are remembered so the name is only ever queried once
 			#if OPENGL_SUPPORTED
 			case RenderApi_OpenGL:
 			{
-				NotNull(shader->allocArena);
 				Assert(IsStrNullTerminated(&uniformName));
 				GLint uniformLocation = glGetUniformLocation(shader->glId, uniformName.pntr);
 				AssertNoOpenGlError();
-				if (uniformLocation >= 0)
-				{
-					ShaderDynamicUniform_t* newUniform = VarArrayAdd(&shader->dynamicUniforms, ShaderDynamicUniform_t);
-					NotNull(newUniform);
-					ClearPointer(newUniform);
-					newUniform->uniformIndex = (shader->dynamicUniforms.length-1);
-					newUniform->name = AllocString(shader->allocArena, &uniformName);
-					newUniform->glLocation = uniformLocation;
-					result = newUniform;
-				}
+				ShaderDynamicUniform_t* newUniform = AddShaderDynamicUniform(shader, uniformName, nameHash, (uniformLocation >= 0));
+				newUniform->glLocation = uniformLocation;
+				if (newUniform->isPresent) { result = newUniform; }
 			} break;
 			#endif
 			
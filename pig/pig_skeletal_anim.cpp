@@ -0,0 +1,428 @@
+/*
+File:   pig_skeletal_anim.cpp
+Date:   10\19\2026
+Description:
+	** Holds the functions that build Skeleton_t and AnimClip_t and evaluate AnimPoseBatch_t bone palettes
+*/
+
+// +--------------------------------------------------------------+
+// |                       Free and Create                        |
+// +--------------------------------------------------------------+
+void FreeSkeleton(Skeleton_t* skeleton)
+{
+	NotNull(skeleton);
+	if (skeleton->allocArena != nullptr)
+	{
+		if (skeleton->parentIndices != nullptr) { FreeMem(skeleton->allocArena, skeleton->parentIndices, sizeof(u16) * skeleton->numBones); }
+		if (skeleton->boneIds != nullptr) { FreeMem(skeleton->allocArena, skeleton->boneIds, sizeof(u64) * skeleton->numBones); }
+		if (skeleton->bindLocal != nullptr) { FreeMem(skeleton->allocArena, skeleton->bindLocal, sizeof(mat4) * skeleton->numBones); }
+		if (skeleton->inverseBind != nullptr) { FreeMem(skeleton->allocArena, skeleton->inverseBind, sizeof(mat4) * skeleton->numBones); }
+		if (skeleton->partBoneIndices != nullptr) { FreeMem(skeleton->allocArena, skeleton->partBoneIndices, sizeof(u16) * skeleton->numParts); }
+	}
+	ClearPointer(skeleton);
+}
+
+//Every bone starts as a root with an identity bind pose. Fill in parentIndices and bindLocal and then call SkeletonCalculateInverseBind
+void CreateSkeleton(Skeleton_t* skeleton, MemArena_t* memArena, u64 numBones, u64 numParts = 0)
+{
+	NotNull2(skeleton, memArena);
+	Assert(numBones > 0 && numBones <= ANIM_MAX_NUM_BONES);
+	ClearPointer(skeleton);
+	skeleton->allocArena = memArena;
+	skeleton->numBones = numBones;
+	skeleton->parentIndices = AllocArray(memArena, u16, numBones);
+	skeleton->boneIds = AllocArray(memArena, u64, numBones);
+	skeleton->bindLocal = AllocArray(memArena, mat4, numBones);
+	skeleton->inverseBind = AllocArray(memArena, mat4, numBones);
+	NotNull2(skeleton->parentIndices, skeleton->boneIds);
+	NotNull2(skeleton->bindLocal, skeleton->inverseBind);
+	for (u64 bIndex = 0; bIndex < numBones; bIndex++)
+	{
+		skeleton->parentIndices[bIndex] = ANIM_NO_BONE_INDEX;
+		skeleton->boneIds[bIndex] = 0;
+		skeleton->bindLocal[bIndex] = Mat4_Identity;
+		skeleton->inverseBind[bIndex] = Mat4_Identity;
+	}
+	skeleton->numParts = numParts;
+	if (numParts > 0)
+	{
+		skeleton->partBoneIndices = AllocArray(memArena, u16, numParts);
+		NotNull(skeleton->partBoneIndices);
+		for (u64 pIndex = 0; pIndex < numParts; pIndex++) { skeleton->partBoneIndices[pIndex] = ANIM_NO_BONE_INDEX; }
+	}
+}
+
+void FreeAnimClip(AnimClip_t* clip)
+{
+	NotNull(clip);
+	if (clip->allocArena != nullptr)
+	{
+		FreeString(clip->allocArena, &clip->name);
+		if (clip->tracks != nullptr)
+		{
+			for (u64 bIndex = 0; bIndex < clip->numBones; bIndex++)
+			{
+				AnimBoneTrack_t* track = &clip->tracks[bIndex];
+				if (track->numKeys > 0)
+				{
+					FreeMem(clip->allocArena, track->times, sizeof(r32) * track->numKeys);
+					FreeMem(clip->allocArena, track->values, sizeof(AnimTransform_t) * track->numKeys);
+				}
+			}
+			FreeMem(clip->allocArena, clip->tracks, sizeof(AnimBoneTrack_t) * clip->numBones);
+		}
+	}
+	ClearPointer(clip);
+}
+
+void CreateAnimClip(AnimClip_t* clip, MemArena_t* memArena, const Skeleton_t* skeleton, MyStr_t name, r32 duration, bool looping = true)
+{
+	NotNull3(clip, memArena, skeleton);
+	Assert(duration > 0);
+	ClearPointer(clip);
+	clip->allocArena = memArena;
+	clip->name = AllocString(memArena, &name);
+	clip->duration = duration;
+	clip->looping = looping;
+	clip->numBones = skeleton->numBones;
+	clip->tracks = AllocArray(memArena, AnimBoneTrack_t, clip->numBones);
+	NotNull(clip->tracks);
+	MyMemSet(clip->tracks, 0x00, sizeof(AnimBoneTrack_t) * clip->numBones);
+}
+
+//Allocates room for numKeys keys on the bone's track. The caller fills in times (ascending) and values
+AnimBoneTrack_t* AnimClipAllocTrack(AnimClip_t* clip, u64 boneIndex, u64 numKeys)
+{
+	NotNull(clip);
+	Assert(boneIndex < clip->numBones);
+	Assert(numKeys > 0);
+	AnimBoneTrack_t* track = &clip->tracks[boneIndex];
+	Assert(track->numKeys == 0);
+	track->numKeys = numKeys;
+	track->times = AllocArray(clip->allocArena, r32, numKeys);
+	track->values = AllocArray(clip->allocArena, AnimTransform_t, numKeys);
+	NotNull2(track->times, track->values);
+	return track;
+}
+
+// +--------------------------------------------------------------+
+// |                      Skeleton Building                       |
+// +--------------------------------------------------------------+
+//Bind poses are composed with the same parent-ordered pass that poses are, so parents must already come before children here
+void SkeletonCalculateInverseBind(Skeleton_t* skeleton)
+{
+	NotNull(skeleton);
+	MemArena_t* scratch = GetScratchArena(skeleton->allocArena);
+	mat4* bindWorld = AllocArray(scratch, mat4, skeleton->numBones);
+	NotNull(bindWorld);
+	for (u64 bIndex = 0; bIndex < skeleton->numBones; bIndex++)
+	{
+		u16 parentIndex = skeleton->parentIndices[bIndex];
+		Assert(parentIndex == ANIM_NO_BONE_INDEX || parentIndex < bIndex);
+		bindWorld[bIndex] = (parentIndex != ANIM_NO_BONE_INDEX) ? Mat4Multiply(bindWorld[parentIndex], skeleton->bindLocal[bIndex]) : skeleton->bindLocal[bIndex];
+		skeleton->inverseBind[bIndex] = Mat4Inverse(bindWorld[bIndex]);
+	}
+	FreeScratchArena(scratch);
+}
+
+u16 FindSkeletonBoneById(const Skeleton_t* skeleton, u64 boneId)
+{
+	NotNull(skeleton);
+	if (boneId == 0) { return ANIM_NO_BONE_INDEX; }
+	for (u64 bIndex = 0; bIndex < skeleton->numBones; bIndex++)
+	{
+		if (skeleton->boneIds[bIndex] == boneId) { return (u16)bIndex; }
+	}
+	return ANIM_NO_BONE_INDEX;
+}
+
+//The armature's bone transforms are model space rest transforms. Bones are reordered so every parent comes before its children
+bool CreateSkeletonFromModel(Skeleton_t* skeleton, MemArena_t* memArena, Model_t* model)
+{
+	NotNull3(skeleton, memArena, model);
+	ModelArmature_t* armature = &model->armature;
+	if (!model->hasArmature || armature->bones.length == 0) { return false; }
+	if (armature->bones.length > ANIM_MAX_NUM_BONES) { return false; }
+	
+	u64 numBones = armature->bones.length;
+	CreateSkeleton(skeleton, memArena, numBones, model->parts.length);
+	
+	MemArena_t* scratch = GetScratchArena(memArena);
+	ModelArmatureBone_t** orderedBones = AllocArray(scratch, ModelArmatureBone_t*, numBones);
+	bool* boneAdded = AllocArray(scratch, bool, numBones);
+	NotNull2(orderedBones, boneAdded);
+	MyMemSet(boneAdded, 0x00, sizeof(bool) * numBones);
+	
+	//Armatures are tiny, so repeatedly sweeping for bones whose parent has already been placed is fine
+	u64 numOrdered = 0;
+	while (numOrdered < numBones)
+	{
+		u64 numAddedThisPass = 0;
+		VarArrayLoop(&armature->bones, bIndex)
+		{
+			if (boneAdded[bIndex]) { continue; }
+			VarArrayLoopGet(ModelArmatureBone_t, bone, &armature->bones, bIndex);
+			u16 parentIndex = ANIM_NO_BONE_INDEX;
+			if (bone->parentBoneId != 0)
+			{
+				for (u64 oIndex = 0; oIndex < numOrdered; oIndex++)
+				{
+					if (orderedBones[oIndex]->id == bone->parentBoneId) { parentIndex = (u16)oIndex; break; }
+				}
+				if (parentIndex == ANIM_NO_BONE_INDEX) { continue; } //parent isn't placed yet
+			}
+			skeleton->parentIndices[numOrdered] = parentIndex;
+			skeleton->boneIds[numOrdered] = bone->id;
+			orderedBones[numOrdered] = bone;
+			boneAdded[bIndex] = true;
+			numOrdered++;
+			numAddedThisPass++;
+		}
+		if (numAddedThisPass == 0)
+		{
+			PrintLine_E("Armature \"%.*s\" has a bone whose parent is missing or that is part of a cycle", StrPrint(armature->name));
+			FreeScratchArena(scratch);
+			FreeSkeleton(skeleton);
+			return false;
+		}
+	}
+	
+	for (u64 bIndex = 0; bIndex < numBones; bIndex++)
+	{
+		u16 parentIndex = skeleton->parentIndices[bIndex];
+		mat4 boneTransform = orderedBones[bIndex]->transform;
+		skeleton->bindLocal[bIndex] = (parentIndex != ANIM_NO_BONE_INDEX) ? Mat4Multiply(Mat4Inverse(orderedBones[parentIndex]->transform), boneTransform) : boneTransform;
+	}
+	SkeletonCalculateInverseBind(skeleton);
+	
+	VarArrayLoop(&model->parts, pIndex)
+	{
+		VarArrayLoopGet(ModelPart_t, part, &model->parts, pIndex);
+		skeleton->partBoneIndices[pIndex] = FindSkeletonBoneById(skeleton, part->boneId);
+	}
+	
+	FreeScratchArena(scratch);
+	return true;
+}
+
+// +--------------------------------------------------------------+
+// |                           Sampling                           |
+// +--------------------------------------------------------------+
+//Equivalent to Translate * Rotate * Scale without doing the two multiplies
+mat4 AnimTransformToMat4(const AnimTransform_t* transform)
+{
+	mat4 result = Mat4Quaternion(transform->rotation);
+	for (u8 row = 0; row < 3; row++)
+	{
+		result.values[0][row] *= transform->scale.x;
+		result.values[1][row] *= transform->scale.y;
+		result.values[2][row] *= transform->scale.z;
+	}
+	result.values[3][0] = transform->position.x;
+	result.values[3][1] = transform->position.y;
+	result.values[3][2] = transform->position.z;
+	result.values[3][3] = 1.0f;
+	return result;
+}
+
+AnimTransform_t SampleAnimBoneTrack(const AnimBoneTrack_t* track, r32 time)
+{
+	NotNull(track);
+	Assert(track->numKeys > 0);
+	if (track->numKeys == 1 || time <= track->times[0]) { return track->values[0]; }
+	if (time >= track->times[track->numKeys-1]) { return track->values[track->numKeys-1]; }
+	
+	//Find the last key at or before time (times[0] <= time < times[numKeys-1] is already known)
+	u64 lowIndex = 0;
+	u64 highIndex = track->numKeys-1;
+	while (highIndex - lowIndex > 1)
+	{
+		u64 middleIndex = (lowIndex + highIndex) / 2;
+		if (track->times[middleIndex] <= time) { lowIndex = middleIndex; }
+		else { highIndex = middleIndex; }
+	}
+	
+	const AnimTransform_t* prevKey = &track->values[lowIndex];
+	const AnimTransform_t* nextKey = &track->values[highIndex];
+	r32 keyLength = track->times[highIndex] - track->times[lowIndex];
+	r32 amount = (keyLength > 0) ? ((time - track->times[lowIndex]) / keyLength) : 0.0f;
+	AnimTransform_t result;
+	result.position = Vec3Lerp(prevKey->position, nextKey->position, amount);
+	result.rotation = QuatLerp(prevKey->rotation, nextKey->rotation, amount);
+	result.scale = Vec3Lerp(prevKey->scale, nextKey->scale, amount);
+	return result;
+}
+
+r32 GetAnimClipLocalTime(const AnimClip_t* clip, r32 time)
+{
+	NotNull(clip);
+	if (clip->looping) { return time - FloorR32(time / clip->duration) * clip->duration; }
+	else { return ClampR32(time, 0, clip->duration); }
+}
+
+// +--------------------------------------------------------------+
+// |                       Pose Evaluation                        |
+// +--------------------------------------------------------------+
+//Matrices are column-major (values[column][row]) so each result column is a sum of left's columns scaled by one column of right
+#if ANIM_POSE_SSE2
+static inline void AnimMat4Multiply_Sse2(const mat4* left, const mat4* right, mat4* result)
+{
+	__m128 leftCol0 = _mm_loadu_ps(&left->values[0][0]);
+	__m128 leftCol1 = _mm_loadu_ps(&left->values[1][0]);
+	__m128 leftCol2 = _mm_loadu_ps(&left->values[2][0]);
+	__m128 leftCol3 = _mm_loadu_ps(&left->values[3][0]);
+	for (u8 col = 0; col < 4; col++)
+	{
+		__m128 resultCol = _mm_mul_ps(leftCol0, _mm_set1_ps(right->values[col][0]));
+		resultCol = _mm_add_ps(resultCol, _mm_mul_ps(leftCol1, _mm_set1_ps(right->values[col][1])));
+		resultCol = _mm_add_ps(resultCol, _mm_mul_ps(leftCol2, _mm_set1_ps(right->values[col][2])));
+		resultCol = _mm_add_ps(resultCol, _mm_mul_ps(leftCol3, _mm_set1_ps(right->values[col][3])));
+		_mm_storeu_ps(&result->values[col][0], resultCol); //left is already in registers and right's column was read above, so result can alias either
+	}
+}
+#endif //ANIM_POSE_SSE2
+
+//result may alias left or right
+static inline void AnimMat4Multiply(const mat4* left, const mat4* right, mat4* result, bool useSimd)
+{
+	#if ANIM_POSE_SSE2
+	if (useSimd) { AnimMat4Multiply_Sse2(left, right, result); return; }
+	#else
+	UNUSED(useSimd);
+	#endif
+	*result = Mat4Multiply(*left, *right);
+}
+
+//paletteOut must have room for skeleton->numBones matrices
+void EvaluateAnimPose(const Skeleton_t* skeleton, const AnimClip_t* clip, r32 time, mat4* paletteOut, bool useSimd = true)
+{
+	NotNull2(skeleton, paletteOut);
+	Assert(clip == nullptr || clip->numBones == skeleton->numBones);
+	r32 localTime = (clip != nullptr) ? GetAnimClipLocalTime(clip, time) : 0.0f;
+	
+	//First pass fills the palette with each bone's model space transform. Parents always come first so their entry is already final
+	for (u64 bIndex = 0; bIndex < skeleton->numBones; bIndex++)
+	{
+		mat4 localMatrix;
+		const AnimBoneTrack_t* track = (clip != nullptr) ? &clip->tracks[bIndex] : nullptr;
+		if (track != nullptr && track->numKeys > 0)
+		{
+			AnimTransform_t localTransform = SampleAnimBoneTrack(track, localTime);
+			localMatrix = AnimTransformToMat4(&localTransform);
+		}
+		else { localMatrix = skeleton->bindLocal[bIndex]; }
+		
+		u16 parentIndex = skeleton->parentIndices[bIndex];
+		if (parentIndex != ANIM_NO_BONE_INDEX) { AnimMat4Multiply(&paletteOut[parentIndex], &localMatrix, &paletteOut[bIndex], useSimd); }
+		else { paletteOut[bIndex] = localMatrix; }
+	}
+	
+	//Second pass takes the rest pose back out so the palette can be applied directly to model space vertices
+	for (u64 bIndex = 0; bIndex < skeleton->numBones; bIndex++)
+	{
+		AnimMat4Multiply(&paletteOut[bIndex], &skeleton->inverseBind[bIndex], &paletteOut[bIndex], useSimd);
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                         Pose Batches                         |
+// +--------------------------------------------------------------+
+void FreeAnimPoseBatch(AnimPoseBatch_t* batch)
+{
+	NotNull(batch);
+	if (batch->allocArena != nullptr)
+	{
+		if (batch->instances != nullptr) { FreeMem(batch->allocArena, batch->instances, sizeof(AnimInstance_t) * batch->numInstances); }
+		if (batch->palettes != nullptr) { FreeMem(batch->allocArena, batch->palettes, sizeof(mat4) * batch->numInstances * batch->skeleton->numBones); }
+		if (batch->semaphoreCreated) { plat->DestroySemaphore(&batch->doneSemaphore); }
+	}
+	ClearPointer(batch);
+}
+
+//Every instance starts in the bind pose (nullptr clip). The skeleton must outlive the batch
+void CreateAnimPoseBatch(AnimPoseBatch_t* batch, MemArena_t* memArena, const Skeleton_t* skeleton, u64 numInstances)
+{
+	NotNull3(batch, memArena, skeleton);
+	Assert(numInstances > 0);
+	ClearPointer(batch);
+	batch->allocArena = memArena;
+	batch->skeleton = skeleton;
+	batch->useSimd = true;
+	batch->numInstances = numInstances;
+	batch->instances = AllocArray(memArena, AnimInstance_t, numInstances);
+	batch->palettes = AllocArray(memArena, mat4, numInstances * skeleton->numBones);
+	NotNull2(batch->instances, batch->palettes);
+	MyMemSet(batch->instances, 0x00, sizeof(AnimInstance_t) * numInstances);
+	if (platInfo->numThreadPoolThreads > 0)
+	{
+		plat->CreateSemaphore(&batch->doneSemaphore, 0, ANIM_POSE_MAX_TASKS);
+		batch->semaphoreCreated = true;
+	}
+}
+
+mat4* GetAnimPosePalette(AnimPoseBatch_t* batch, u64 instanceIndex)
+{
+	NotNull(batch);
+	Assert(instanceIndex < batch->numInstances);
+	return &batch->palettes[instanceIndex * batch->skeleton->numBones];
+}
+
+//NOTE: This runs on thread pool threads (see PigTask_EvaluateAnimPoses) so it must not allocate or touch anything but the batch
+void EvaluateAnimPoseRange(AnimPoseBatch_t* batch, u64 firstInstance, u64 numInstances)
+{
+	NotNull(batch);
+	Assert(firstInstance + numInstances <= batch->numInstances);
+	for (u64 iIndex = firstInstance; iIndex < firstInstance + numInstances; iIndex++)
+	{
+		const AnimInstance_t* instance = &batch->instances[iIndex];
+		EvaluateAnimPose(batch->skeleton, instance->clip, instance->time, GetAnimPosePalette(batch, iIndex), batch->useSimd);
+	}
+}
+
+//Splits the batch into ranges, queues all but the first on the thread pool, evaluates the first on this thread and then waits for the rest.
+//Palettes are all final when this returns
+void EvaluateAnimPoseBatch(AnimPoseBatch_t* batch, bool useThreadPool = true)
+{
+	NotNull(batch);
+	batch->numQueuedTasks = 0;
+	u64 numRanges = 1;
+	if (useThreadPool && batch->semaphoreCreated)
+	{
+		numRanges = platInfo->numThreadPoolThreads + 1;
+		if (numRanges > ANIM_POSE_MAX_TASKS) { numRanges = ANIM_POSE_MAX_TASKS; }
+		u64 maxRanges = MaxU64(batch->numInstances / ANIM_POSE_MIN_INSTANCES_PER_TASK, 1);
+		if (numRanges > maxRanges) { numRanges = maxRanges; }
+	}
+	if (numRanges <= 1) { EvaluateAnimPoseRange(batch, 0, batch->numInstances); return; }
+	
+	u64 instancesPerRange = batch->numInstances / numRanges;
+	u64 numLeftover = batch->numInstances % numRanges;
+	u64 nextInstance = 0;
+	for (u64 rIndex = 0; rIndex < numRanges; rIndex++)
+	{
+		AnimPoseTaskRange_t* range = &batch->ranges[rIndex];
+		range->batch = batch;
+		range->firstInstance = nextInstance;
+		range->numInstances = instancesPerRange + ((rIndex < numLeftover) ? 1 : 0);
+		nextInstance += range->numInstances;
+	}
+	Assert(nextInstance == batch->numInstances);
+	
+	for (u64 rIndex = 1; rIndex < numRanges; rIndex++)
+	{
+		AnimPoseTaskRange_t* range = &batch->ranges[rIndex];
+		PlatTaskInput_t taskInput = {};
+		taskInput.type = PigTask_EvaluateAnimPoses;
+		taskInput.inputSize1 = sizeof(AnimPoseTaskRange_t);
+		taskInput.inputPntr1 = range;
+		taskInput.inputArena1 = nullptr; //the batch owns the ranges
+		if (plat->QueueTask(&taskInput) != nullptr) { batch->numQueuedTasks++; }
+		else { EvaluateAnimPoseRange(batch, range->firstInstance, range->numInstances); }
+	}
+	
+	EvaluateAnimPoseRange(batch, batch->ranges[0].firstInstance, batch->ranges[0].numInstances);
+	for (u64 tIndex = 0; tIndex < batch->numQueuedTasks; tIndex++)
+	{
+		plat->WaitOnSemaphore(&batch->doneSemaphore, SEMAPHORE_WAIT_INFINITE);
+	}
+}
@@ -0,0 +1,92 @@
+/*
+File:   pig_skeletal_anim.h
+Date:   10\19\2026
+Description:
+	** A Skeleton_t is a flattened copy of a model's armature where every bone comes after its parent, so the
+	** hierarchy can be composed with a single forward pass over an array (no pointer chasing or recursion).
+	** AnimClip_t holds one keyframed track per skeleton bone and an AnimPoseBatch_t evaluates any number of
+	** instances (each with their own clip and time) into one contiguous bone palette per instance. The palette
+	** holds boneWorld * inverseBind for every bone, which is what the renderer (or a skinning shader) wants,
+	** and large batches are split up and evaluated on the thread pool (see PigTask_EvaluateAnimPoses)
+*/
+
+#ifndef _PIG_SKELETAL_ANIM_H
+#define _PIG_SKELETAL_ANIM_H
+
+#define ANIM_NO_BONE_INDEX                0xFFFF
+#define ANIM_MAX_NUM_BONES                0xFFFF //bone indices are stored as u16
+#define ANIM_POSE_MAX_TASKS               32 //the main thread takes one range, the rest are queued on the thread pool
+#define ANIM_POSE_MIN_INSTANCES_PER_TASK  16 //smaller batches aren't worth the cost of waking up the thread pool
+
+//SSE2 is the baseline on every x86 target we ship so the mat4 multiplies don't need a runtime check like the AVX2 image kernels do
+#define ANIM_POSE_SSE2 IMAGE_KERNELS_SSE2
+
+struct AnimTransform_t
+{
+	v3 position;
+	quat rotation;
+	v3 scale;
+};
+
+struct Skeleton_t
+{
+	MemArena_t* allocArena;
+	u64 numBones;
+	u16* parentIndices; //always less than the bone's own index, ANIM_NO_BONE_INDEX for root bones
+	u64* boneIds; //the ModelArmatureBone_t id each bone came from (0 for skeletons that weren't made from an armature)
+	mat4* bindLocal; //rest transform relative to the parent (or model space for root bones)
+	mat4* inverseBind; //inverse of the model space rest transform
+	
+	u64 numParts;
+	u16* partBoneIndices; //bone index for each model part, ANIM_NO_BONE_INDEX for parts that aren't attached to a bone
+};
+
+struct AnimBoneTrack_t
+{
+	u64 numKeys; //0 means the bone stays in its bind pose
+	r32* times; //ascending, in seconds
+	AnimTransform_t* values; //relative to the parent bone
+};
+
+struct AnimClip_t
+{
+	MemArena_t* allocArena;
+	MyStr_t name;
+	r32 duration; //seconds
+	bool looping;
+	u64 numBones; //must match the Skeleton_t it's played on
+	AnimBoneTrack_t* tracks; //one per skeleton bone
+};
+
+struct AnimInstance_t
+{
+	const AnimClip_t* clip; //nullptr holds the bind pose
+	r32 time; //seconds
+};
+
+struct AnimPoseBatch_t;
+
+struct AnimPoseTaskRange_t
+{
+	AnimPoseBatch_t* batch;
+	u64 firstInstance;
+	u64 numInstances;
+};
+
+struct AnimPoseBatch_t
+{
+	MemArena_t* allocArena;
+	const Skeleton_t* skeleton;
+	bool useSimd;
+	
+	u64 numInstances;
+	AnimInstance_t* instances;
+	mat4* palettes; //numInstances * skeleton->numBones, instance i's palette starts at palettes[i * skeleton->numBones]
+	
+	bool semaphoreCreated;
+	PlatSemaphore_t doneSemaphore; //triggered once by each queued task
+	AnimPoseTaskRange_t ranges[ANIM_POSE_MAX_TASKS];
+	u64 numQueuedTasks; //from the last EvaluateAnimPoseBatch call
+};
+
+#endif //  _PIG_SKELETAL_ANIM_H
@@ -261,6 +261,7 @@ bool ParseSlugAlbum(MemArena_t* memArena, MyStr_t fileContents, SlugAlbum_t* alb
 			
 			glBindTexture(GL_TEXTURE_2D, albumOut->curveTexture.glId);
 			AssertNoOpenGlError(); //TODO: Make this an error case instead?
+			ForgetBoundApiTexture();
 			glTexImage2D(
 				GL_TEXTURE_2D,
 				0,
@@ -300,7 +301,7 @@ bool ParseSlugAlbum(MemArena_t* memArena, MyStr_t fileContents, SlugAlbum_t* alb
 			albumOut->bandTexture.isValid = true;
 			
 			albumOut->isValid = true;
-			
+		
 		} break;
 		#endif
 		
@@ -405,7 +406,15 @@ bool LoadSlugAlbum(MemArena_t* memArena, MyStr_t filePath, SlugAlbum_t* albumOut
 void FreeSlugFont(SlugFont_t* font)
 {
 	NotNull(font);
-	Unimplemented(); //TODO: Implement me!
+	DestroyTexture(&font->curveTexture);
+	DestroyTexture(&font->bandTexture);
+	if (font->pipelineShader.isValid) { DestroyShader(&font->pipelineShader); }
+	if (font->fileContentsVoidPntr != nullptr)
+	{
+		NotNull(font->allocArena);
+		FreeMem(font->allocArena, font->fileContentsVoidPntr, font->fileContentsSize);
+	}
+	ClearPointer(font);
 }
 
 bool ParseSlugFont(MemArena_t* memArena, MyStr_t fileContents, SlugFont_t* fontOut)
@@ -500,6 +509,7 @@ bool ParseSlugFont(MemArena_t* memArena, MyStr_t fileContents, SlugFont_t* fontO
 			
 			glBindTexture(GL_TEXTURE_2D, fontOut->curveTexture.glId);
 			AssertNoOpenGlError(); //TODO: Make this an error case instead?
+			ForgetBoundApiTexture();
 			glTexImage2D(
 				GL_TEXTURE_2D,
 				0,
@@ -539,7 +549,7 @@ bool ParseSlugFont(MemArena_t* memArena, MyStr_t fileContents, SlugFont_t* fontO
 			fontOut->bandTexture.isValid = true;
 			
 			fontOut->isValid = true;
-			
+		
 		} break;
 		#endif
 		
@@ -585,9 +595,60 @@ void FreeSlugText(SlugText_t* text)
 		NotNull(text->allocArena);
 		FreeString(text->allocArena, &text->text);
 	}
+	if (text->vertBuffer.isValid) { DestroyVertBuffer(&text->vertBuffer); }
 	ClearPointer(text);
 }
 
+//Does nothing unless the text or layout changed since the last build. Returns false if the vertex buffer couldn't be created
+bool UpdateSlugTextGeometry(SlugText_t* text)
+{
+	NotNull(text);
+	NotNull2(text->allocArena, text->font);
+	if (!text->isDirty) { return true; }
+	text->isDirty = false;
+	text->geometryVersion++;
+	text->numGlyphs = 0;
+	if (text->vertBuffer.isValid) { DestroyVertBuffer(&text->vertBuffer); }
+	if (text->text.length == 0) { return true; }
+	
+	i32 maxVertexCount;
+	i32 maxTriangleCount;
+	i32 glyphCount = Terathon::Slug::CountSlug(text->font->fontHeader, &text->layoutData, text->text.pntr, text->text.length, &maxVertexCount, &maxTriangleCount);
+	if (maxVertexCount <= 0 || maxTriangleCount <= 0) { return true; }
+	
+	bool result = true;
+	TempPushMarkNotArena(text->allocArena);
+	Terathon::Slug::GeometryBuffer slugGeometryBuffer = {};
+	Terathon::Slug::Vertex* verticesPntr = TempArray(Terathon::Slug::Vertex, maxVertexCount);
+	Terathon::Slug::Triangle* trianglesPntr = TempArray(Terathon::Slug::Triangle, maxTriangleCount);
+	slugGeometryBuffer.vertexData = verticesPntr;
+	slugGeometryBuffer.triangleData = trianglesPntr;
+	MyMemSet((void*)slugGeometryBuffer.vertexData, 0x00, maxVertexCount * sizeof(Terathon::Slug::Vertex));
+	MyMemSet((void*)slugGeometryBuffer.triangleData, 0x00, maxTriangleCount * sizeof(Terathon::Slug::Triangle));
+	slugGeometryBuffer.vertexIndex = 0;
+	
+	Terathon::Slug::BuildSlug(text->font->fontHeader, &text->layoutData, text->text.pntr, text->text.length, SlugPoint2D_Zero, &slugGeometryBuffer);
+	
+	//BuildSlug advances the data pointers past what it wrote, which is often less than CountSlug's worst case (spaces have no geometry)
+	u64 numVertices = (u64)(slugGeometryBuffer.vertexData - verticesPntr);
+	u64 numTriangles = (u64)(slugGeometryBuffer.triangleData - trianglesPntr);
+	Assert(numVertices <= (u64)maxVertexCount && numTriangles <= (u64)maxTriangleCount);
+	if (numVertices > 0 && numTriangles > 0)
+	{
+		Assert(sizeof(Terathon::Slug::Triangle) == sizeof(u16)*3);
+		//The CPU copies are what SlugTextBatch_t packs from, without them we would have to run BuildSlug again for every batch rebuild
+		result = CreateVertBufferWithIndices_(text->allocArena, &text->vertBuffer, false,
+			numVertices, VertexType_Slug, VertexType_Slug_Size, (void*)verticesPntr, true,
+			numTriangles*3, sizeof(u16), (void*)trianglesPntr, true
+		);
+		AssertMsg(result, "Failed to create vertex buffer for SlugText_t");
+	}
+	text->numGlyphs = (u64)glyphCount;
+	TempPopMarkNotArena(text->allocArena);
+	
+	return result;
+}
+
 SlugText_t CreateSlugText(MemArena_t* memArena, MyStr_t text, SlugFont_t* font, const Terathon::Slug::LayoutData* layoutData = nullptr)
 {
 	NotNull(memArena);
@@ -606,37 +667,151 @@ SlugText_t CreateSlugText(MemArena_t* memArena, MyStr_t text, SlugFont_t* font,
 		Terathon::Slug::SetDefaultLayoutData(&result.layoutData);
 	}
 	
-	i32 maxVertexCount;
-	i32 maxTriangleCount;
-	i32 glyphCount = Terathon::Slug::CountSlug(font->fontHeader, &result.layoutData, result.text.pntr, result.text.length, &maxVertexCount, &maxTriangleCount);
-	
-	if (maxVertexCount > 0)
+	result.isDirty = true;
+	UpdateSlugTextGeometry(&result);
+	return result;
+}
+
+//The geometry is rebuilt the next time the text is drawn (or UpdateSlugTextGeometry is called), setting the same text does nothing
+void SetSlugTextText(SlugText_t* text, MyStr_t newText)
+{
+	NotNull(text);
+	NotNull(text->allocArena);
+	NotNullStr(&newText);
+	if (StrEquals(text->text, newText)) { return; }
+	if (text->text.pntr != nullptr) { FreeString(text->allocArena, &text->text); }
+	text->text = AllocString(text->allocArena, &newText);
+	text->isDirty = true;
+}
+void SetSlugTextLayout(SlugText_t* text, const Terathon::Slug::LayoutData* layoutData)
+{
+	NotNull2(text, layoutData);
+	if (MyMemCompare(&text->layoutData, layoutData, sizeof(Terathon::Slug::LayoutData)) == 0) { return; }
+	MyMemCopy(&text->layoutData, layoutData, sizeof(Terathon::Slug::LayoutData));
+	text->isDirty = true;
+}
+
+// +--------------------------------------------------------------+
+// |                       Slug Text Batch                        |
+// +--------------------------------------------------------------+
+void FreeSlugTextBatch(SlugTextBatch_t* batch)
+{
+	NotNull(batch);
+	if (batch->allocArena != nullptr) { FreeVarArray(&batch->entries); }
+	if (batch->vertBuffer.isValid) { DestroyVertBuffer(&batch->vertBuffer); }
+	ClearPointer(batch);
+}
+
+void CreateSlugTextBatch(MemArena_t* memArena, SlugTextBatch_t* batchOut, SlugFont_t* font, u64 initialRequiredCapacity = 0)
+{
+	NotNull3(memArena, batchOut, font);
+	ClearPointer(batchOut);
+	batchOut->allocArena = memArena;
+	batchOut->font = font;
+	CreateVarArray(&batchOut->entries, memArena, sizeof(SlugTextBatchEntry_t), initialRequiredCapacity);
+	batchOut->isDirty = true;
+}
+
+//The SlugText_t has to stay at the same address for as long as it's in the batch. Returns the entry index
+u64 SlugTextBatchAdd(SlugTextBatch_t* batch, SlugText_t* text, v2 position)
+{
+	NotNull2(batch, text);
+	AssertMsg(text->font == batch->font, "All the SlugText_t in a SlugTextBatch_t have to use the same font");
+	u64 entryIndex = batch->entries.length;
+	SlugTextBatchEntry_t* newEntry = VarArrayAdd(&batch->entries, SlugTextBatchEntry_t);
+	NotNull(newEntry);
+	ClearPointer(newEntry);
+	newEntry->text = text;
+	newEntry->position = position;
+	batch->isDirty = true;
+	return entryIndex;
+}
+void SlugTextBatchMove(SlugTextBatch_t* batch, u64 entryIndex, v2 position)
+{
+	NotNull(batch);
+	SlugTextBatchEntry_t* entry = VarArrayGetHard(&batch->entries, entryIndex, SlugTextBatchEntry_t);
+	if (entry->position.x == position.x && entry->position.y == position.y) { return; }
+	entry->position = position;
+	batch->isDirty = true;
+}
+void SlugTextBatchRemove(SlugTextBatch_t* batch, u64 entryIndex)
+{
+	NotNull(batch);
+	Assert(entryIndex < batch->entries.length);
+	VarArrayRemove(&batch->entries, entryIndex, SlugTextBatchEntry_t);
+	batch->isDirty = true;
+}
+void SlugTextBatchClear(SlugTextBatch_t* batch)
+{
+	NotNull(batch);
+	VarArrayClear(&batch->entries);
+	batch->isDirty = true;
+}
+
+//Rebuilds the packed buffer if anything in the batch changed. When nothing did this is one pass over the entries comparing versions
+bool UpdateSlugTextBatch(SlugTextBatch_t* batch)
+{
+	NotNull(batch);
+	NotNull2(batch->allocArena, batch->font);
+	u64 numVertices = 0;
+	u64 numIndices = 0;
+	VarArrayLoop(&batch->entries, eIndex)
 	{
-		TempPushMarkNotArena(memArena);
-		Terathon::Slug::GeometryBuffer slugGeometryBuffer = {};
-		Terathon::Slug::Vertex* verticesPntr = TempArray(Terathon::Slug::Vertex, maxVertexCount);
-		Terathon::Slug::Triangle* trianglesPntr = TempArray(Terathon::Slug::Triangle, maxTriangleCount);
-		slugGeometryBuffer.vertexData = verticesPntr;
-		slugGeometryBuffer.triangleData = trianglesPntr;
-		MyMemSet((void*)slugGeometryBuffer.vertexData, 0x00, maxVertexCount * sizeof(Terathon::Slug::Vertex));
-		MyMemSet((void*)slugGeometryBuffer.triangleData, 0x00, maxTriangleCount * sizeof(Terathon::Slug::Triangle));
-		slugGeometryBuffer.vertexIndex = 0;
-		
-		Terathon::Slug::BuildSlug(font->fontHeader, &result.layoutData, result.text.pntr, result.text.length, SlugPoint2D_Zero, &slugGeometryBuffer);
-		
-		Assert(sizeof(Terathon::Slug::Triangle) == sizeof(u16)*3);
-		bool createVertBufferResult = CreateVertBufferWithIndices_(memArena, &result.vertBuffer, false,
-			(u64)maxVertexCount, VertexType_Slug, VertexType_Slug_Size, (void*)verticesPntr, false,
-			(u64)maxTriangleCount*3, sizeof(u16), (void*)trianglesPntr, false
-		);
-		Assert(createVertBufferResult == true);
-		TempPopMarkNotArena(memArena);
+		VarArrayLoopGet(SlugTextBatchEntry_t, entry, &batch->entries, eIndex);
+		UpdateSlugTextGeometry(entry->text);
+		if (entry->geometryVersion != entry->text->geometryVersion) { batch->isDirty = true; }
+		if (entry->text->vertBuffer.isValid)
+		{
+			numVertices += entry->text->vertBuffer.numVertices;
+			numIndices += entry->text->vertBuffer.numIndices;
+		}
 	}
-	else
+	if (!batch->isDirty) { return true; }
+	
+	batch->isDirty = false;
+	batch->numRebuilds++;
+	if (batch->vertBuffer.isValid) { DestroyVertBuffer(&batch->vertBuffer); }
+	if (numVertices == 0 || numIndices == 0) { return true; }
+	Assert(numVertices <= UINT32_MAX);
+	
+	Terathon::Slug::Vertex* vertices = AllocArray(&pig->largeAllocHeap, Terathon::Slug::Vertex, numVertices);
+	u32* indices = AllocArray(&pig->largeAllocHeap, u32, numIndices);
+	NotNull2(vertices, indices);
+	u64 vertexIndex = 0;
+	u64 indexIndex = 0;
+	VarArrayLoop(&batch->entries, eIndex)
 	{
-		MyDebugBreak();
+		VarArrayLoopGet(SlugTextBatchEntry_t, entry, &batch->entries, eIndex);
+		entry->geometryVersion = entry->text->geometryVersion;
+		const VertBuffer_t* textBuffer = &entry->text->vertBuffer;
+		if (!textBuffer->isValid) { continue; }
+		Assert(textBuffer->hasVerticesCopy && textBuffer->hasIndicesCopy);
+		Assert(textBuffer->indexSize == sizeof(u16));
+		
+		//Only the position is relative to the text origin, the texcoord, jacobian and banding are all in em-space so they don't change
+		MyMemCopy(&vertices[vertexIndex], textBuffer->vertsVoidPntr, textBuffer->numVertices * sizeof(Terathon::Slug::Vertex));
+		for (u64 vIndex = vertexIndex; vIndex < vertexIndex + textBuffer->numVertices; vIndex++)
+		{
+			vertices[vIndex].position.x += entry->position.x;
+			vertices[vIndex].position.y += entry->position.y;
+		}
+		for (u64 iIndex = 0; iIndex < textBuffer->numIndices; iIndex++)
+		{
+			indices[indexIndex + iIndex] = (u32)(vertexIndex + textBuffer->indicesU16[iIndex]);
+		}
+		vertexIndex += textBuffer->numVertices;
+		indexIndex += textBuffer->numIndices;
 	}
+	Assert(vertexIndex == numVertices && indexIndex == numIndices);
+	
+	bool result = CreateVertBufferWithIndices_(batch->allocArena, &batch->vertBuffer, false,
+		numVertices, VertexType_Slug, VertexType_Slug_Size, (void*)vertices, false,
+		numIndices, sizeof(u32), (void*)indices, false
+	);
+	AssertMsg(result, "Failed to create vertex buffer for SlugTextBatch_t");
 	
+	FreeMem(&pig->largeAllocHeap, indices, sizeof(u32) * numIndices);
+	FreeMem(&pig->largeAllocHeap, vertices, sizeof(Terathon::Slug::Vertex) * numVertices);
 	return result;
 }
 
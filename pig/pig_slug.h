@@ -37,15 +37,40 @@ struct SlugFont_t
 	Shader_t pipelineShader;
 };
 
+//The glyph geometry is built once into vertBuffer (which keeps a CPU copy so batches can pack it) and only rebuilt
+//by UpdateSlugTextGeometry after SetSlugTextText or SetSlugTextLayout actually change something
 struct SlugText_t
 {
 	MemArena_t* allocArena;
 	MyStr_t text;
 	SlugFont_t* font;
 	Terathon::Slug::LayoutData layoutData;
+	bool isDirty;
+	u64 geometryVersion; //bumped every time the geometry is rebuilt, lets a SlugTextBatch_t notice
+	u64 numGlyphs;
 	VertBuffer_t vertBuffer;
 };
 
+struct SlugTextBatchEntry_t
+{
+	SlugText_t* text;
+	v2 position;
+	u64 geometryVersion; //of the text when it was last packed
+};
+
+//Packs the geometry of many (mostly static) SlugText_t that share a font into one vertex/index buffer with each
+//entry's position baked in, so they can all be drawn with one draw call. The buffer is only rebuilt when an entry
+//is added, removed or moved, or when one of the texts rebuilds its own geometry
+struct SlugTextBatch_t
+{
+	MemArena_t* allocArena;
+	SlugFont_t* font;
+	VarArray_t entries; //SlugTextBatchEntry_t
+	bool isDirty;
+	u64 numRebuilds;
+	VertBuffer_t vertBuffer; //u32 indices since a batch easily goes past 65535 vertices
+};
+
 #endif //SLUG_SUPPORTED
 
 #endif //  _PIG_SLUG_H
@@ -8,17 +8,38 @@ Description:
 
 #if SLUG_SUPPORTED
 
-void RenderSlugText(const SlugText_t* text, v2 position)
+void RcBindSlugFont(SlugFont_t* font)
 {
-	RcBindShader(&text->font->pipelineShader);
+	NotNull(font);
+	RcBindShader(&font->pipelineShader);
 	// TODO: glBlendFuncSeparate?
 	// TODO: glBlendEquation?
+	RcBindTexture1(&font->curveTexture);
+	RcBindTexture2(&font->bandTexture);
+}
+
+//Rebuilds the geometry first if the text was changed, otherwise this is just state changes and one draw
+void RenderSlugText(SlugText_t* text, v2 position)
+{
+	NotNull(text);
+	UpdateSlugTextGeometry(text);
+	if (!text->vertBuffer.isValid) { return; }
+	RcBindSlugFont(text->font);
 	RcSetWorldMatrix(Mat4Translate2(position));
-	RcBindTexture1(&text->font->curveTexture);
-	RcBindTexture2(&text->font->bandTexture);
-	RcBindTexture2(&text->font->bandTexture);
 	RcBindVertBuffer(&text->vertBuffer);
 	RcDrawBuffer(VertBufferPrimitive_Triangles);
 }
 
+//Draws every text in the batch with one draw call, offset is added to every entry's position
+void RenderSlugTextBatch(SlugTextBatch_t* batch, v2 offset = Vec2_Zero)
+{
+	NotNull(batch);
+	UpdateSlugTextBatch(batch);
+	if (!batch->vertBuffer.isValid) { return; }
+	RcBindSlugFont(batch->font);
+	RcSetWorldMatrix(Mat4Translate2(offset));
+	RcBindVertBuffer(&batch->vertBuffer);
+	RcDrawBuffer(VertBufferPrimitive_Triangles);
+}
+
 #endif //SLUG_SUPPORTED
@@ -169,8 +169,8 @@ void CreateSoundFromOggAudioData(const OggAudioData_t* oggData, PlatAudioFormat_
 bool TryLoadSoundOggOrWav(ProcessLog_t* log, MyStr_t filePath, MemArena_t* memArena, Sound_t* soundOut)
 {
 	bool result = false;
-	PlatFileContents_t soundFile = {};
-	if (plat->ReadFileContents(filePath, nullptr, false, &soundFile))
+	PlatMappedFile_t soundFile = {};
+	if (plat->MapFile(filePath, &soundFile))
 	{
 		if (StrEndsWith(filePath, ".ogg"))
 		{
@@ -207,7 +207,7 @@ bool TryLoadSoundOggOrWav(ProcessLog_t* log, MyStr_t filePath, MemArena_t* memAr
 			log->errorCode = Result_UnknownExtension;
 		}
 		
-		plat->FreeFileContents(&soundFile);
+		plat->UnmapFile(&soundFile);
 	}
 	else
 	{
@@ -31,7 +31,228 @@ void DestroySpriteSheet(SpriteSheet_t* sheet)
 	sheet->texture.error = textureError;
 }
 
-bool CreateSpriteSheet(MemArena_t* memArena, SpriteSheet_t* sheetOut, const PlatImageData_t* imageData, v2i padding, v2i numFrames, bool pixelated, bool useTextureArray)
+// +--------------------------------------------------------------+
+// |                    Trimmed Sprite Sheets                     |
+// +--------------------------------------------------------------+
+//Returns Reci_Zero if every pixel in the frame is fully transparent
+reci FindSpriteSheetFrameAlphaBounds(const PlatImageData_t* imageData, v2i framePos, v2i frameSize)
+{
+	u64 rowStride = imageData->rowSize / sizeof(u32);
+	i32 top = -1;
+	i32 bottom = -1;
+	for (i32 yPos = 0; yPos < frameSize.height; yPos++)
+	{
+		const u32* row = &imageData->data32[((u64)(framePos.y + yPos) * rowStride) + (u64)framePos.x];
+		if (ImageRowHasAlpha(row, (u64)frameSize.width))
+		{
+			if (top < 0) { top = yPos; }
+			bottom = yPos;
+		}
+	}
+	if (top < 0) { return Reci_Zero; }
+	
+	i32 left = frameSize.width-1;
+	i32 right = 0;
+	for (i32 yPos = top; yPos <= bottom; yPos++)
+	{
+		const u32* row = &imageData->data32[((u64)(framePos.y + yPos) * rowStride) + (u64)framePos.x];
+		//Only look at the columns that could still widen the bounds
+		for (i32 xPos = 0; xPos < left; xPos++) { if ((row[xPos] & 0xFF000000) != 0) { left = xPos; break; } }
+		for (i32 xPos = frameSize.width-1; xPos > right; xPos--) { if ((row[xPos] & 0xFF000000) != 0) { right = xPos; break; } }
+	}
+	if (right < left) { right = left; } //a single column of pixels
+	return NewReci(left, top, right - left + 1, bottom - top + 1);
+}
+
+//Packs every frame's padded trimRec into a bin of the given width with MaxRects. Returns the height that was used
+i32 SpriteSheetTryPackTrimmedFrames(MemArena_t* scratch, SpriteSheet_t* sheet, const u64* frameOrder, u64 numOrderedFrames, i32 binWidth, i32 binHeight, reci* paddedRecsOut)
+{
+	MaxRectsPacker_t packer;
+	InitMaxRectsPacker(&packer, scratch, NewVec2i(binWidth, binHeight));
+	i32 result = 0;
+	for (u64 oIndex = 0; oIndex < numOrderedFrames; oIndex++)
+	{
+		SpriteSheetFrame_t* frame = VarArrayGet(&sheet->frames, frameOrder[oIndex], SpriteSheetFrame_t);
+		v2i paddedSize = frame->trimRec.size + sheet->padding*2;
+		if (!MaxRectsInsert(&packer, paddedSize, &paddedRecsOut[oIndex])) { result = -1; break; }
+	}
+	if (result == 0) { result = packer.usedSize.height; }
+	FreeMaxRectsPacker(&packer);
+	return result;
+}
+
+//NOTE: Instead of keeping every frame at frameSize in a uniform grid, each frame is cut down to the bounding box of its
+//      non-transparent pixels and those boxes are packed with MaxRects. Fully transparent frames take no space at all.
+//      RcDrawSheetFrame knows to draw the smaller quad at the right offset so the result looks identical
+bool CreateTrimmedSpriteSheet(MemArena_t* memArena, SpriteSheet_t* sheetOut, const PlatImageData_t* imageData, v2i padding, v2i numFrames, bool pixelated)
+{
+	AssertSingleThreaded();
+	NotNull(memArena);
+	Assert(memArena != TempArena);
+	NotNull(sheetOut);
+	NotNull(imageData);
+	Assert(imageData->width > 0 && imageData->height > 0);
+	Assert(imageData->pixelSize == sizeof(u32));
+	Assert(padding.x >= 0 && padding.y >= 0);
+	Assert(numFrames.x > 0 && numFrames.y > 0);
+	
+	ClearPointer(sheetOut);
+	sheetOut->isValid = false;
+	sheetOut->allocArena = memArena;
+	CreateVarArray(&sheetOut->frames, memArena, sizeof(SpriteSheetFrame_t), numFrames.x * numFrames.y);
+	sheetOut->numFrames = numFrames;
+	sheetOut->frameSize = NewVec2i(imageData->width / numFrames.x, imageData->height / numFrames.y);
+	sheetOut->padding = padding;
+	sheetOut->numFilledFrames = 0;
+	sheetOut->isTrimmed = true;
+	sheetOut->untrimmedTextureSize = padding*2 + Vec2iMultiply(sheetOut->frameSize + padding*2, numFrames);
+	
+	MemArena_t* scratch = GetScratchArena(memArena);
+	u64 totalNumFrames = (u64)(numFrames.x * numFrames.y);
+	u64* frameOrder = AllocArray(scratch, u64, totalNumFrames);
+	NotNull(frameOrder);
+	
+	// +==============================+
+	// |        Find Alpha Bounds     |
+	// +==============================+
+	u64 totalPaddedArea = 0;
+	i32 maxPaddedWidth = 1;
+	i32 sumPaddedHeights = 0;
+	for (i32 frameY = 0; frameY < numFrames.y; frameY++)
+	{
+		for (i32 frameX = 0; frameX < numFrames.x; frameX++)
+		{
+			v2i gridPos = NewVec2i(frameX, frameY);
+			SpriteSheetFrame_t* frame = VarArrayAdd(&sheetOut->frames, SpriteSheetFrame_t);
+			NotNull(frame);
+			ClearPointer(frame);
+			frame->index = sheetOut->frames.length-1;
+			frame->gridPos = gridPos;
+			CreateVarArray(&frame->points, memArena, sizeof(SpriteSheetFramePoint_t));
+			frame->trimRec = FindSpriteSheetFrameAlphaBounds(imageData, Vec2iMultiply(sheetOut->frameSize, gridPos), sheetOut->frameSize);
+			frame->filled = (frame->trimRec.width > 0);
+			if (!frame->filled) { continue; }
+			
+			//Insertion sort by height (then width) descending, MaxRects does noticeably better with big items first
+			u64 insertIndex = sheetOut->numFilledFrames;
+			while (insertIndex > 0)
+			{
+				SpriteSheetFrame_t* prevFrame = VarArrayGet(&sheetOut->frames, frameOrder[insertIndex-1], SpriteSheetFrame_t);
+				if (prevFrame->trimRec.height > frame->trimRec.height || (prevFrame->trimRec.height == frame->trimRec.height && prevFrame->trimRec.width >= frame->trimRec.width)) { break; }
+				frameOrder[insertIndex] = frameOrder[insertIndex-1];
+				insertIndex--;
+			}
+			frameOrder[insertIndex] = frame->index;
+			sheetOut->numFilledFrames++;
+			
+			v2i paddedSize = frame->trimRec.size + padding*2;
+			totalPaddedArea += (u64)(paddedSize.width * paddedSize.height);
+			maxPaddedWidth = MaxI32(maxPaddedWidth, paddedSize.width);
+			sumPaddedHeights += paddedSize.height;
+		}
+	}
+	
+	// +==============================+
+	// |         Pack Frames          |
+	// +==============================+
+	//Try a few bin widths around the square root of the area and keep whichever texture comes out smallest
+	u64 numRecsAlloc = (sheetOut->numFilledFrames > 0) ? sheetOut->numFilledFrames : 1;
+	reci* paddedRecs = AllocArray(scratch, reci, numRecsAlloc);
+	reci* bestPaddedRecs = AllocArray(scratch, reci, numRecsAlloc);
+	NotNull2(paddedRecs, bestPaddedRecs);
+	v2i textureSize = NewVec2i(1, 1);
+	if (sheetOut->numFilledFrames > 0)
+	{
+		i32 squareWidth = MaxI32(maxPaddedWidth, CeilR32i(SqrtR32((r32)totalPaddedArea)));
+		const r32 widthScales[] = { 1.0f, 1.15f, 1.3f, 1.6f };
+		u64 bestArea = 0;
+		for (u64 sIndex = 0; sIndex < ArrayCount(widthScales); sIndex++)
+		{
+			i32 binWidth = MaxI32(maxPaddedWidth, CeilR32i(squareWidth * widthScales[sIndex]));
+			i32 usedHeight = SpriteSheetTryPackTrimmedFrames(scratch, sheetOut, frameOrder, sheetOut->numFilledFrames, binWidth, sumPaddedHeights, paddedRecs);
+			if (usedHeight <= 0) { continue; }
+			i32 usedWidth = 0;
+			for (u64 oIndex = 0; oIndex < sheetOut->numFilledFrames; oIndex++) { usedWidth = MaxI32(usedWidth, paddedRecs[oIndex].x + paddedRecs[oIndex].width); }
+			u64 area = (u64)usedWidth * (u64)usedHeight;
+			if (bestArea == 0 || area < bestArea)
+			{
+				bestArea = area;
+				textureSize = NewVec2i(usedWidth, usedHeight);
+				MyMemCopy(bestPaddedRecs, paddedRecs, sizeof(reci) * sheetOut->numFilledFrames);
+			}
+		}
+		Assert(bestArea > 0); //a bin as tall as every frame stacked always fits
+	}
+	
+	// +==============================+
+	// |         Copy Pixels          |
+	// +==============================+
+	u64 newPixelsSize = sizeof(u32) * (u64)(textureSize.width * textureSize.height);
+	u32* newPixels = AllocArray(mainHeap, u32, (u64)(textureSize.width * textureSize.height));
+	if (newPixels == nullptr)
+	{
+		DebugAssert(false);
+		sheetOut->error = Result_AllocFailure;
+		DestroySpriteSheet(sheetOut);
+		FreeScratchArena(scratch);
+		return false;
+	}
+	MyMemSet(newPixels, 0x00, newPixelsSize);
+	
+	u64 rowStride = imageData->rowSize / sizeof(u32);
+	u64 paddedRowSize = (u64)textureSize.width;
+	for (u64 oIndex = 0; oIndex < sheetOut->numFilledFrames; oIndex++)
+	{
+		SpriteSheetFrame_t* frame = VarArrayGet(&sheetOut->frames, frameOrder[oIndex], SpriteSheetFrame_t);
+		reci paddedRec = bestPaddedRecs[oIndex];
+		frame->packedRec = NewReci(paddedRec.topLeft + padding, frame->trimRec.size);
+		v2i sourcePos = Vec2iMultiply(sheetOut->frameSize, frame->gridPos) + frame->trimRec.topLeft;
+		for (i32 yPos = 0; yPos < frame->trimRec.height; yPos++)
+		{
+			const u32* sourceRow = &imageData->data32[((u64)(sourcePos.y + yPos) * rowStride) + (u64)sourcePos.x];
+			u32* destRow = &newPixels[((u64)(frame->packedRec.y + yPos) * paddedRowSize) + (u64)frame->packedRec.x];
+			ImageCopyRow(destRow, sourceRow, (u64)frame->trimRec.width);
+			for (i32 padIndex = 1; padIndex <= padding.x; padIndex++)
+			{
+				destRow[-padIndex] = destRow[0];
+				destRow[frame->trimRec.width-1 + padIndex] = destRow[frame->trimRec.width-1];
+			}
+		}
+		u64 paddedRowBytes = (u64)paddedRec.width * sizeof(u32);
+		u32* firstRow = &newPixels[((u64)frame->packedRec.y * paddedRowSize) + (u64)paddedRec.x];
+		u32* lastRow = firstRow + ((u64)(frame->trimRec.height-1) * paddedRowSize);
+		for (i32 padIndex = 1; padIndex <= padding.y; padIndex++)
+		{
+			MyMemCopy(firstRow - ((u64)padIndex * paddedRowSize), firstRow, paddedRowBytes);
+			MyMemCopy(lastRow + ((u64)padIndex * paddedRowSize), lastRow, paddedRowBytes);
+		}
+	}
+	FreeScratchArena(scratch);
+	
+	PlatImageData_t packedImageData = {};
+	packedImageData.size = textureSize;
+	packedImageData.pixelSize = sizeof(u32);
+	packedImageData.rowSize = packedImageData.pixelSize * packedImageData.width;
+	packedImageData.dataSize = packedImageData.rowSize * packedImageData.height;
+	packedImageData.data32 = newPixels;
+	
+	const bool repeating = false;
+	if (!CreateTexture(memArena, &sheetOut->texture, &packedImageData, pixelated, repeating))
+	{
+		sheetOut->error = Result_TextureError;
+		DestroySpriteSheet(sheetOut);
+		FreeMem(mainHeap, newPixels, newPixelsSize);
+		return false;
+	}
+	FreeMem(mainHeap, newPixels, newPixelsSize);
+	
+	sheetOut->isValid = true;
+	sheetOut->id = pig->nextSpriteSheetId;
+	pig->nextSpriteSheetId++;
+	return true;
+}
+
+bool CreateSpriteSheet(MemArena_t* memArena, SpriteSheet_t* sheetOut, const PlatImageData_t* imageData, v2i padding, v2i numFrames, bool pixelated, bool useTextureArray, bool trimFrames = false)
 {
 	AssertSingleThreaded();
 	NotNull(memArena);
@@ -43,6 +264,8 @@ bool CreateSpriteSheet(MemArena_t* memArena, SpriteSheet_t* sheetOut, const Plat
 	Assert(padding.x >= 0 && padding.y >= 0);
 	Assert(numFrames.x > 0 && numFrames.y > 0);
 	AssertIf(useTextureArray, padding.x == 0 && padding.y == 0); //we don't support padding in texture array backed sprite sheets (there's no need?)
+	AssertIf(trimFrames, !useTextureArray); //every layer of a texture array is the same size so there's nothing to gain
+	if (trimFrames) { return CreateTrimmedSpriteSheet(memArena, sheetOut, imageData, padding, numFrames, pixelated); }
 	
 	ClearPointer(sheetOut);
 	sheetOut->isValid = false;
@@ -92,22 +315,17 @@ bool CreateSpriteSheet(MemArena_t* memArena, SpriteSheet_t* sheetOut, const Plat
 				frame->filled = false;
 				CreateVarArray(&frame->points, memArena, sizeof(SpriteSheetFramePoint_t));
 				
+				bool frameHasAlpha = false;
 				for (i32 yPos = 0; yPos < sheetOut->frameSize.y; yPos++)
 				{
-					for (i32 xPos = 0; xPos < sheetOut->frameSize.x; xPos++)
-					{
-						v2i sourcePos = framePos + NewVec2i(xPos, yPos);
-						const u32* source = &(imageData->data32)[(sourcePos.y*imageData->rowSize)/sizeof(u32) + sourcePos.x];
-						
-						if (!frame->filled && ((*source) & 0xFF000000) != 0)
-						{
-							frame->filled = true;
-							sheetOut->numFilledFrames++;
-							// PrintLine_D("pixel (%d, %d) 0x%08X fills frame (%d, %d)", sourcePos.x, sourcePos.y, *source, frameX, frameY);
-						}
-						
-						frameData->data32[(yPos * sheetOut->frameSize.width) + xPos] = *source;
-					}
+					const u32* sourceRow = &(imageData->data32)[((framePos.y + yPos)*imageData->rowSize)/sizeof(u32) + framePos.x];
+					u32* destRow = &frameData->data32[yPos * sheetOut->frameSize.width];
+					if (ImageCopyRow(destRow, sourceRow, (u64)sheetOut->frameSize.width)) { frameHasAlpha = true; }
+				}
+				if (frameHasAlpha)
+				{
+					frame->filled = true;
+					sheetOut->numFilledFrames++;
 				}
 			}
 		}
@@ -159,101 +377,35 @@ bool CreateSpriteSheet(MemArena_t* memArena, SpriteSheet_t* sheetOut, const Plat
 				frame->filled = false;
 				CreateVarArray(&frame->points, memArena, sizeof(SpriteSheetFramePoint_t));
 				
+				//Copy each row and smear its first and last pixel out into the horizontal padding
+				bool frameHasAlpha = false;
+				u64 paddedRowSize = (u64)textureSizeWithPadding.width;
 				for (i32 yPos = 0; yPos < sheetOut->frameSize.y; yPos++)
 				{
-					for (i32 xPos = 0; xPos < sheetOut->frameSize.x; xPos++)
+					const u32* sourceRow = &(imageData->data32)[((framePos.y + yPos)*imageData->rowSize)/sizeof(u32) + framePos.x];
+					u32* destRow = &newPixels[((u64)(framePosWithPadding.y + yPos) * paddedRowSize) + (u64)framePosWithPadding.x];
+					if (ImageCopyRow(destRow, sourceRow, (u64)sheetOut->frameSize.width)) { frameHasAlpha = true; }
+					for (i32 padIndex = 1; padIndex <= sheetOut->padding.x; padIndex++)
 					{
-						v2i sourcePos = framePos + NewVec2i(xPos, yPos);
-						const u32* source = &(imageData->data32)[(sourcePos.y*imageData->rowSize)/sizeof(u32) + sourcePos.x];
-						
-						v2i newPos = framePosWithPadding + NewVec2i(xPos, yPos);
-						if (!frame->filled && ((*source) & 0xFF000000) != 0)
-						{
-							frame->filled = true;
-							sheetOut->numFilledFrames++;
-							// PrintLine_D("pixel (%d, %d) 0x%08X fills frame (%d, %d)", sourcePos.x, sourcePos.y, *source, frameX, frameY);
-						}
-						newPixels[(newPos.y * textureSizeWithPadding.width) + newPos.x] = *source;
-						
-						if (xPos == 0)
-						{
-							for (i32 padIndex = 1; padIndex <= sheetOut->padding.x; padIndex++)
-							{
-								v2i padPos = newPos + NewVec2i(-padIndex, 0);
-								newPixels[(padPos.y * textureSizeWithPadding.width) + padPos.x] = *source;
-							}
-						}
-						if (yPos == 0)
-						{
-							for (i32 padIndex = 1; padIndex <= sheetOut->padding.x; padIndex++)
-							{
-								v2i padPos = newPos + NewVec2i(0, -padIndex);
-								newPixels[(padPos.y * textureSizeWithPadding.width) + padPos.x] = *source;
-							}
-						}
-						if (xPos == sheetOut->frameSize.width-1)
-						{
-							for (i32 padIndex = 1; padIndex <= sheetOut->padding.x; padIndex++)
-							{
-								v2i padPos = newPos + NewVec2i(padIndex, 0);
-								newPixels[(padPos.y * textureSizeWithPadding.width) + padPos.x] = *source;
-							}
-						}
-						if (yPos == sheetOut->frameSize.height-1)
-						{
-							for (i32 padIndex = 1; padIndex <= sheetOut->padding.x; padIndex++)
-							{
-								v2i padPos = newPos + NewVec2i(0, padIndex);
-								newPixels[(padPos.y * textureSizeWithPadding.width) + padPos.x] = *source;
-							}
-						}
-						
-						if (xPos == 0 && yPos == 0)
-						{
-							for (i32 padY = 1; padY <= sheetOut->padding.y; padY++)
-							{
-								for (i32 padX = 1; padX <= sheetOut->padding.x; padX++)
-								{
-									v2i padPos = newPos + NewVec2i(-padX, -padY);
-									newPixels[(padPos.y * textureSizeWithPadding.width) + padPos.x] = *source;
-								}
-							}
-						}
-						if (xPos == sheetOut->frameSize.width-1 && yPos == 0)
-						{
-							for (i32 padY = 1; padY <= sheetOut->padding.y; padY++)
-							{
-								for (i32 padX = 1; padX <= sheetOut->padding.x; padX++)
-								{
-									v2i padPos = newPos + NewVec2i(padX, -padY);
-									newPixels[(padPos.y * textureSizeWithPadding.width) + padPos.x] = *source;
-								}
-							}
-						}
-						if (xPos == 0 && yPos == sheetOut->frameSize.height-1)
-						{
-							for (i32 padY = 1; padY <= sheetOut->padding.y; padY++)
-							{
-								for (i32 padX = 1; padX <= sheetOut->padding.x; padX++)
-								{
-									v2i padPos = newPos + NewVec2i(-padX, padY);
-									newPixels[(padPos.y * textureSizeWithPadding.width) + padPos.x] = *source;
-								}
-							}
-						}
-						if (xPos == sheetOut->frameSize.width-1 && yPos == sheetOut->frameSize.height-1)
-						{
-							for (i32 padY = 1; padY <= sheetOut->padding.y; padY++)
-							{
-								for (i32 padX = 1; padX <= sheetOut->padding.x; padX++)
-								{
-									v2i padPos = newPos + NewVec2i(padX, padY);
-									newPixels[(padPos.y * textureSizeWithPadding.width) + padPos.x] = *source;
-								}
-							}
-						}
+						destRow[-padIndex] = destRow[0];
+						destRow[sheetOut->frameSize.width-1 + padIndex] = destRow[sheetOut->frameSize.width-1];
 					}
 				}
+				if (frameHasAlpha)
+				{
+					frame->filled = true;
+					sheetOut->numFilledFrames++;
+				}
+				
+				//Then copy the first and last padded rows (corners included) out into the vertical padding
+				u64 paddedFrameRowBytes = (u64)frameSizeWithPadding.width * sizeof(u32);
+				u32* firstRow = &newPixels[((u64)framePosWithPadding.y * paddedRowSize) + (u64)(framePosWithPadding.x - padding.x)];
+				u32* lastRow = firstRow + ((u64)(sheetOut->frameSize.height-1) * paddedRowSize);
+				for (i32 padIndex = 1; padIndex <= sheetOut->padding.y; padIndex++)
+				{
+					MyMemCopy(firstRow - ((u64)padIndex * paddedRowSize), firstRow, paddedFrameRowBytes);
+					MyMemCopy(lastRow + ((u64)padIndex * paddedRowSize), lastRow, paddedFrameRowBytes);
+				}
 			}
 		}
 		
@@ -282,14 +434,14 @@ bool CreateSpriteSheet(MemArena_t* memArena, SpriteSheet_t* sheetOut, const Plat
 	return true;
 }
 
-bool LoadSpriteSheet(MemArena_t* memArena, SpriteSheet_t* sheetOut, MyStr_t filePath, v2i padding, v2i numFrames, bool pixelated, bool useTextureArray)
+bool LoadSpriteSheet(MemArena_t* memArena, SpriteSheet_t* sheetOut, MyStr_t filePath, v2i padding, v2i numFrames, bool pixelated, bool useTextureArray, bool trimFrames = false)
 {
 	NotNull(memArena);
 	NotNull(sheetOut);
 	NotEmptyStr(&filePath);
 	
-	PlatFileContents_t textureFile;
-	if (!plat->ReadFileContents(filePath, nullptr, false, &textureFile))
+	PlatMappedFile_t textureFile;
+	if (!plat->MapFile(filePath, &textureFile))
 	{
 		sheetOut->error = Result_CouldntOpenFile;
 		return false;
@@ -297,23 +449,23 @@ bool LoadSpriteSheet(MemArena_t* memArena, SpriteSheet_t* sheetOut, MyStr_t file
 	if (textureFile.size == 0)
 	{
 		sheetOut->error = Result_EmptyFile;
-		plat->FreeFileContents(&textureFile);
+		plat->UnmapFile(&textureFile);
 		return false;
 	}
 	NotNull(textureFile.data);
 	
 	PlatImageData_t imageData;
-	if (!plat->TryParseImageFile(&textureFile, sizeof(u32), &imageData))
+	if (!plat->TryParseImageFile(textureFile.size, textureFile.data, sizeof(u32), &imageData))
 	{
 		sheetOut->error = Result_ParseFailure;
-		plat->FreeFileContents(&textureFile);
+		plat->UnmapFile(&textureFile);
 		return false;
 	}
 	
-	bool result = CreateSpriteSheet(memArena, sheetOut, &imageData, padding, numFrames, pixelated, useTextureArray);
+	bool result = CreateSpriteSheet(memArena, sheetOut, &imageData, padding, numFrames, pixelated, useTextureArray, trimFrames);
 	
 	plat->FreeImageData(&imageData);
-	plat->FreeFileContents(&textureFile);
+	plat->UnmapFile(&textureFile);
 	
 	return result;
 }
@@ -321,6 +473,16 @@ bool LoadSpriteSheet(MemArena_t* memArena, SpriteSheet_t* sheetOut, MyStr_t file
 SpriteSheetFrame_t* TryGetSpriteSheetFrame(SpriteSheet_t* sheet, v2i gridPos)
 {
 	NotNull(sheet);
+	//Frames are added in row order so we can usually go straight to the right one
+	if (gridPos.x >= 0 && gridPos.y >= 0 && gridPos.x < sheet->numFramesX && gridPos.y < sheet->numFramesY)
+	{
+		u64 frameIndex = (u64)((gridPos.y * sheet->numFramesX) + gridPos.x);
+		if (frameIndex < sheet->frames.length)
+		{
+			SpriteSheetFrame_t* frame = VarArrayGet(&sheet->frames, frameIndex, SpriteSheetFrame_t);
+			if (frame->gridPos == gridPos) { return frame; }
+		}
+	}
 	VarArrayLoop(&sheet->frames, fIndex)
 	{
 		VarArrayLoopGet(SpriteSheetFrame_t, frame, &sheet->frames, fIndex);
@@ -376,6 +538,12 @@ rec GetSpriteSheetFrameSourceRec(const SpriteSheet_t* sheet, v2i gridPos)
 {
 	NotNull(sheet);
 	Assert(sheet->texture.numLayers <= 1);
+	if (sheet->isTrimmed)
+	{
+		const SpriteSheetFrame_t* frame = TryGetSpriteSheetFrame(sheet, gridPos);
+		if (frame == nullptr || !frame->filled) { return Rec_Zero; }
+		return ToRec(frame->packedRec);
+	}
 	rec result = NewRec(
 		ToVec2(Vec2iMultiply(gridPos, sheet->frameSize + sheet->padding*2) + sheet->padding),
 		ToVec2(sheet->frameSize)
@@ -394,6 +562,33 @@ rec GetSpriteSheetFrameSourceRec(const SpriteSheet_t* sheet, MyStr_t frameName,
 	return Rec_Zero;
 }
 
+//Takes the rectangle the whole (untrimmed) frame would be drawn to and returns the smaller rectangle that the trimmed pixels land in
+rec GetSpriteSheetTrimmedDestRec(const SpriteSheet_t* sheet, const SpriteSheetFrame_t* frame, rec frameDestRec, bool flipX = false, bool flipY = false)
+{
+	NotNull2(sheet, frame);
+	if (!sheet->isTrimmed) { return frameDestRec; }
+	v2 scale = Vec2Divide(frameDestRec.size, ToVec2(sheet->frameSize));
+	rec trimRec = ToRec(frame->trimRec);
+	if (flipX) { trimRec.x = sheet->frameSize.width - (trimRec.x + trimRec.width); }
+	if (flipY) { trimRec.y = sheet->frameSize.height - (trimRec.y + trimRec.height); }
+	rec result;
+	result.topLeft = frameDestRec.topLeft + Vec2Multiply(trimRec.topLeft, scale);
+	result.size = Vec2Multiply(trimRec.size, scale);
+	return result;
+}
+//Same as above but for a rotated frame. frameDestObb.size is the unrotated size of the whole frame
+obb2 GetSpriteSheetTrimmedDestObb(const SpriteSheet_t* sheet, const SpriteSheetFrame_t* frame, obb2 frameDestObb, bool flipX = false, bool flipY = false)
+{
+	NotNull2(sheet, frame);
+	if (!sheet->isTrimmed) { return frameDestObb; }
+	rec localRec = GetSpriteSheetTrimmedDestRec(sheet, frame, NewRec(-frameDestObb.size/2, frameDestObb.size), flipX, flipY);
+	v2 localCenter = localRec.topLeft + localRec.size/2;
+	obb2 result = frameDestObb;
+	result.center = frameDestObb.center + Vec2Rotate(localCenter, frameDestObb.rotation);
+	result.size = localRec.size;
+	return result;
+}
+
 box GetSpriteSheetFrameArraySourceRec(const SpriteSheet_t* sheet, v2i gridPos)
 {
 	u64 frameIndex = (u64)((gridPos.y * sheet->numFramesX) + gridPos.x);
@@ -41,6 +41,59 @@ void PigHandleTask(const PlatformInfo_t* info, const PlatformApi_t* api, PlatThr
 			task->result.success = plat->WriteEntireFile(task->input.inputStr, task->input.inputPntr1, task->input.inputSize1);
 		} break;
 		
+		// +--------------------------------------------------------------+
+		// |                    PigTask_EncodeGifFrame                    |
+		// +--------------------------------------------------------------+
+		case PigTask_EncodeGifFrame:
+		{
+			Assert(task->input.inputSize1 == sizeof(PigGifFrame_t));
+			NotNull(task->input.inputPntr1);
+			PigGifFrame_t* frame = (PigGifFrame_t*)task->input.inputPntr1;
+			task->result.success = Pig_EncodeGifFrame(frame);
+		} break;
+		
+		// +--------------------------------------------------------------+
+		// |                    PigTask_SaveScreenshot                    |
+		// +--------------------------------------------------------------+
+		case PigTask_SaveScreenshot:
+		{
+			NotNullStr(&task->input.inputStr);
+			Assert(task->input.inputSize1 == sizeof(PlatImageData_t));
+			NotNull(task->input.inputPntr1);
+			PlatImageData_t* imageData = (PlatImageData_t*)task->input.inputPntr1;
+			u64 fileSize = 0;
+			task->result.success = plat->SaveImageDataToFile(task->input.inputStr, imageData, PlatImageFormat_Png, &fileSize);
+			task->result.resultSize1 = fileSize;
+		} break;
+		
+		// +--------------------------------------------------------------+
+		// |                  PigTask_EvaluateAnimPoses                   |
+		// +--------------------------------------------------------------+
+		case PigTask_EvaluateAnimPoses:
+		{
+			Assert(task->input.inputSize1 == sizeof(AnimPoseTaskRange_t));
+			NotNull(task->input.inputPntr1);
+			AnimPoseTaskRange_t* range = (AnimPoseTaskRange_t*)task->input.inputPntr1;
+			EvaluateAnimPoseRange(range->batch, range->firstInstance, range->numInstances);
+			task->result.success = true;
+			plat->TriggerSemaphore(&range->batch->doneSemaphore, 1, nullptr); //the main thread is waiting in EvaluateAnimPoseBatch, range must not be touched after this
+		} break;
+		
+		// +--------------------------------------------------------------+
+		// |                   PigTask_DecompressAssets                   |
+		// +--------------------------------------------------------------+
+		#if PIG_ASSET_PACK
+		case PigTask_DecompressAssets:
+		{
+			Assert(task->input.inputSize1 == sizeof(AssetPackTaskRange_t));
+			NotNull(task->input.inputPntr1);
+			AssetPackTaskRange_t* range = (AssetPackTaskRange_t*)task->input.inputPntr1;
+			DecompressAssetPackRange(range->pack, range->firstItem, range->numItems);
+			task->result.success = true;
+			plat->TriggerSemaphore(&range->pack->doneSemaphore, 1, nullptr); //the main thread is waiting in PrefetchAssetPack, range must not be touched after this
+		} break;
+		#endif
+		
 		// +--------------------------------------------------------------+
 		// |                        Unimplemented                         |
 		// +--------------------------------------------------------------+
@@ -82,6 +135,42 @@ void PigHandleCompletedTask(PlatTask_t* task)
 			}
 		} break;
 		
+		// +--------------------------------------------------------------+
+		// |               PigTask_EncodeGifFrame Completed               |
+		// +--------------------------------------------------------------+
+		case PigTask_EncodeGifFrame:
+		{
+			NotNull(task->input.inputPntr1);
+			Pig_HandleGifFrameEncoded((PigGifFrame_t*)task->input.inputPntr1, task->result.success);
+		} break;
+		
+		// +--------------------------------------------------------------+
+		// |               PigTask_SaveScreenshot Completed               |
+		// +--------------------------------------------------------------+
+		case PigTask_SaveScreenshot:
+		{
+			NotNull(task->input.inputPntr1);
+			Pig_HandleScreenshotSaved(task->result.success, task->input.inputStr, (PlatImageData_t*)task->input.inputPntr1, task->result.resultSize1);
+		} break;
+		
+		// +--------------------------------------------------------------+
+		// |             PigTask_EvaluateAnimPoses Completed              |
+		// +--------------------------------------------------------------+
+		case PigTask_EvaluateAnimPoses:
+		{
+			//Nothing to do, EvaluateAnimPoseBatch already waited for this task and the range may have been freed since
+		} break;
+		
+		// +--------------------------------------------------------------+
+		// |              PigTask_DecompressAssets Completed              |
+		// +--------------------------------------------------------------+
+		#if PIG_ASSET_PACK
+		case PigTask_DecompressAssets:
+		{
+			//Nothing to do, PrefetchAssetPack already waited for this task
+		} break;
+		#endif
+		
 		// +--------------------------------------------------------------+
 		// |                        Unimplemented                         |
 		// +--------------------------------------------------------------+
@@ -12,6 +12,10 @@ enum PigTask_t
 	PigTask_None = 0,
 	PigTask_ReadFileContents,
 	PigTask_WriteEntireFile,
+	PigTask_EncodeGifFrame,
+	PigTask_SaveScreenshot,
+	PigTask_EvaluateAnimPoses,
+	PigTask_DecompressAssets,
 	PigTask_NumTypes, //NOTE: We can't go above GameTask_Base (currently set to 100)
 };
 
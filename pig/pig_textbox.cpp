@@ -369,7 +369,7 @@ r32 TextboxGetAutoHeight(Textbox_t* tb)
 {
 	NotNull(tb);
 	const FontFace_t* fontFace = GetFontFace(GetPointer(&tb->font), tb->fontFaceSelector);
-	r32 fontLineHeight = (fontFace != nullptr) ? (fontFace->lineHeight * tb->fontScale) : 0;
+	r32 fontLineHeight = (fontFace != nullptr) ? (fontFace->lineHeight * GetFontFaceScale(fontFace, tb->fontFaceSelector) * tb->fontScale) : 0;
 	return (fontLineHeight + tb->innerMargin.y*2);
 }
 
@@ -524,7 +524,7 @@ void TextboxLayout(Textbox_t* tb)
 	tb->usableRec = RecDeflate(tb->mainRec, tb->innerMargin);
 	
 	const FontFace_t* fontFace = GetFontFace(GetPointer(&tb->font), tb->fontFaceSelector);
-	r32 fontMaxAscend = (fontFace != nullptr) ? (fontFace->maxAscend * tb->fontScale) : 0;
+	r32 fontMaxAscend = (fontFace != nullptr) ? (fontFace->maxAscend * GetFontFaceScale(fontFace, tb->fontFaceSelector) * tb->fontScale) : 0;
 	tb->textPos = tb->mainRec.topLeft + tb->innerMargin + NewVec2(0, fontMaxAscend);
 	Vec2Align(&tb->textPos);
 }
@@ -709,21 +709,21 @@ void UpdateTextbox(Textbox_t* tb)
 			// +==============================+
 			if (tb->mouseQuickRightClickCount >= 3)
 			{
-				
+			
 			}
 			// +==============================+
 			// |      Double Right Click      |
 			// +==============================+
 			else if (tb->mouseQuickRightClickCount >= 2)
 			{
-				
+			
 			}
 			// +==============================+
 			// |      Single Right Click      |
 			// +==============================+
 			else
 			{
-				
+			
 			}
 		}
 		#endif
@@ -986,8 +986,8 @@ void RenderTextbox(Textbox_t* tb, TextboxColors_t* colors = nullptr)
 	}
 	
 	const FontFace_t* fontFace = GetFontFace(GetPointer(&tb->font), tb->fontFaceSelector);
-	r32 fontMaxAscend = (fontFace != nullptr) ? (fontFace->maxAscend * tb->fontScale) : 0;
-	r32 fontMaxDescend = (fontFace != nullptr) ? (fontFace->maxDescend * tb->fontScale) : 0;
+	r32 fontMaxAscend = (fontFace != nullptr) ? (fontFace->maxAscend * GetFontFaceScale(fontFace, tb->fontFaceSelector) * tb->fontScale) : 0;
+	r32 fontMaxDescend = (fontFace != nullptr) ? (fontFace->maxDescend * GetFontFaceScale(fontFace, tb->fontFaceSelector) * tb->fontScale) : 0;
 	bool isFocused = IsFocused(tb);
 	
 	// +==============================+
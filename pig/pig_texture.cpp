@@ -17,7 +17,7 @@ void DestroyTexture(Texture_t* texture)
 		#if OPENGL_SUPPORTED
 		case RenderApi_OpenGL:
 		{
-			if (texture->glId != 0)
+			if (texture->glId != 0 && texture->atlasPage == nullptr) //atlased textures share their page's glId
 			{
 				glDeleteTextures(1, &texture->glId);
 				AssertNoOpenGlError();
@@ -34,6 +34,26 @@ void DestroyTexture(Texture_t* texture)
 	ClearPointer(texture);
 }
 
+//The texture the render API actually binds, which is the atlas page for textures packed into a TextureAtlas_t
+Texture_t* GetTextureApiTexture(Texture_t* texture)
+{
+	NotNull(texture);
+	return ((texture->atlasPage != nullptr) ? texture->atlasPage : texture);
+}
+//Converts a source rectangle in the texture's own pixel space into the space of GetTextureApiTexture(texture)
+rec GetTextureApiSourceRec(const Texture_t* texture, rec sourceRec)
+{
+	NotNull(texture);
+	if (texture->atlasPage == nullptr) { return sourceRec; }
+	return NewRec(sourceRec.topLeft + ToVec2(texture->atlasRec.topLeft), sourceRec.size);
+}
+//NOTE: Anything that calls glBindTexture outside of the render context has to call this, otherwise RcBindTexture1
+//      might skip a bind it still needs because it thinks the texture it wants is already bound
+void ForgetBoundApiTexture()
+{
+	if (rc != nullptr) { rc->state.boundApiTexture1 = nullptr; }
+}
+
 bool CreateTexture(MemArena_t* memArena, Texture_t* textureOut, const PlatImageData_t* imageData, bool pixelated, bool repeating, bool reverseByteOrder = false, bool generateMipmap = true, u64 antialiasingNumSamples = 0)
 {
 	NotNull(memArena);
@@ -91,6 +111,7 @@ bool CreateTexture(MemArena_t* memArena, Texture_t* textureOut, const PlatImageD
 			GLenum targetEnum = (hasAntialiasing ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D);
 			glBindTexture(targetEnum, textureOut->glId);
 			CreateTexture_CheckOpenGlError("glBindTexture()") { break; }
+			ForgetBoundApiTexture();
 			
 			GLenum dataFormat = reverseByteOrder ? GL_BGRA : GL_RGBA;
 			GLenum internalFormat = imageData->floatChannels ? GL_RGBA32F : GL_RGBA;
@@ -195,8 +216,8 @@ bool LoadTexture(MemArena_t* memArena, Texture_t* textureOut, MyStr_t filePath,
 	NotEmptyStr(&filePath);
 	ClearPointer(textureOut);
 	
-	PlatFileContents_t textureFile;
-	if (!plat->ReadFileContents(filePath, nullptr, false, &textureFile))
+	PlatMappedFile_t textureFile;
+	if (!plat->MapFile(filePath, &textureFile))
 	{
 		textureOut->error = Result_CouldntOpenFile;
 		return false;
@@ -204,16 +225,16 @@ bool LoadTexture(MemArena_t* memArena, Texture_t* textureOut, MyStr_t filePath,
 	if (textureFile.size == 0)
 	{
 		textureOut->error = Result_EmptyFile;
-		plat->FreeFileContents(&textureFile);
+		plat->UnmapFile(&textureFile);
 		return false;
 	}
 	NotNull(textureFile.data);
 	
 	PlatImageData_t imageData;
-	if (!plat->TryParseImageFile(&textureFile, sizeof(u32), &imageData))
+	if (!plat->TryParseImageFile(textureFile.size, textureFile.data, sizeof(u32), &imageData))
 	{
 		textureOut->error = Result_ParseFailure;
-		plat->FreeFileContents(&textureFile);
+		plat->UnmapFile(&textureFile);
 		return false;
 	}
 	
@@ -232,7 +253,7 @@ bool LoadTexture(MemArena_t* memArena, Texture_t* textureOut, MyStr_t filePath,
 	}
 	
 	plat->FreeImageData(&imageData);
-	plat->FreeFileContents(&textureFile);
+	plat->UnmapFile(&textureFile);
 	
 	return result;
 }
@@ -248,6 +269,7 @@ void TextureGenerateMipmaps(Texture_t* texture)
 			{
 				glBindTexture(GL_TEXTURE_2D, texture->glId);
 				AssertNoOpenGlError();
+				ForgetBoundApiTexture();
 				glGenerateMipmap(GL_TEXTURE_2D);
 				AssertNoOpenGlError();
 			}
@@ -259,7 +281,296 @@ void TextureGenerateMipmaps(Texture_t* texture)
 		#endif
 		default: AssertMsg(false, "Unsupported API in TextureGenerateMipmaps"); break;
 	}
+
+}
+
+// +--------------------------------------------------------------+
+// |                       Cooked Textures                        |
+// +--------------------------------------------------------------+
+bool IsTextureCompressionSupported(TextureCompression_t format)
+{
+	switch (pig->renderApi)
+	{
+		#if OPENGL_SUPPORTED
+		case RenderApi_OpenGL:
+		{
+			switch (format)
+			{
+				case TextureCompression_None: return true;
+				case TextureCompression_BC4:  return true; //RGTC is core since OpenGL 3.0
+				case TextureCompression_BC1:  return (GLAD_GL_EXT_texture_compression_s3tc != 0);
+				case TextureCompression_BC3:  return (GLAD_GL_EXT_texture_compression_s3tc != 0);
+				case TextureCompression_BC7:  return (GLAD_GL_ARB_texture_compression_bptc != 0 || GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 2));
+				default: return false;
+			}
+		} break;
+		#endif
+		default: return false;
+	}
+}
+
+//NOTE: Uploads every mip in the cooked texture as-is, nothing is generated on the GPU. BC4 textures
+//      get the same (1, 1, 1, R) swizzle as single channel textures from CreateTexture
+bool CreateTextureFromCooked(MemArena_t* memArena, Texture_t* textureOut, const CookedTexture_t* cooked, bool pixelated, bool repeating)
+{
+	NotNull(memArena);
+	NotNull(textureOut);
+	NotNull(cooked);
+	NotNull(cooked->data);
+	Assert(cooked->numMips > 0);
+	
+	ClearPointer(textureOut);
+	textureOut->allocArena = memArena;
+	textureOut->id = pig->nextTextureId;
+	pig->nextTextureId++;
+	textureOut->isPixelated = pixelated;
+	textureOut->isRepeating = repeating;
+	textureOut->compression = cooked->format;
+	textureOut->gpuSize = cooked->dataSize;
+	textureOut->sizei = cooked->size;
+	textureOut->size = ToVec2(cooked->size);
+	textureOut->numLayers = 1;
+	textureOut->hasAlpha = (cooked->format != TextureCompression_BC1 && cooked->format != TextureCompression_BC4);
+	textureOut->error = Result_None;
+	
+	if (!IsTextureCompressionSupported(cooked->format))
+	{
+		textureOut->error = Result_UnsupportedFormat;
+		return false;
+	}
+	
+	const char* errorStr = nullptr;
+	#if OPENGL_SUPPORTED
+	#define CreateTextureFromCooked_CheckOpenGlError(apiCallStr)                                    \
+	{                                                                                               \
+		errorStr = CheckOpenGlError(true);                                                          \
+		if (errorStr != nullptr)                                                                    \
+		{                                                                                           \
+			textureOut->apiErrorStr = PrintInArenaStr(memArena, apiCallStr " error: %s", errorStr); \
+			textureOut->error = Result_ApiError;                                                    \
+		}                                                                                           \
+	} if (errorStr != nullptr)
+	#endif
+	
+	switch (pig->renderApi)
+	{
+		// +==============================+
+		// |            OpenGL            |
+		// +==============================+
+		#if OPENGL_SUPPORTED
+		case RenderApi_OpenGL:
+		{
+			glGenTextures(1, &textureOut->glId);
+			CreateTextureFromCooked_CheckOpenGlError("glGenTextures()") { break; }
+			glBindTexture(GL_TEXTURE_2D, textureOut->glId);
+			CreateTextureFromCooked_CheckOpenGlError("glBindTexture()") { break; }
+			ForgetBoundApiTexture();
+			
+			GLenum internalFormat = GL_RGBA;
+			switch (cooked->format)
+			{
+				case TextureCompression_BC1: internalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT;  break;
+				case TextureCompression_BC3: internalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
+				case TextureCompression_BC4: internalFormat = GL_COMPRESSED_RED_RGTC1;          break;
+				case TextureCompression_BC7: internalFormat = GL_COMPRESSED_RGBA_BPTC_UNORM;    break;
+				default: break;
+			}
+			
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+			CreateTextureFromCooked_CheckOpenGlError("glPixelStorei(GL_UNPACK_ALIGNMENT)") { break; }
+			for (u64 mIndex = 0; mIndex < cooked->numMips; mIndex++)
+			{
+				const CookedTextureMip_t* mip = &cooked->mips[mIndex];
+				if (cooked->format == TextureCompression_None)
+				{
+					glTexImage2D(
+						GL_TEXTURE_2D,                  //bound texture type
+						(GLint)mIndex,                  //image level
+						internalFormat,                 //internal format
+						mip->size.width,                //image width
+						mip->size.height,               //image height
+						0,                              //border
+						GL_RGBA,                        //format
+						GL_UNSIGNED_BYTE,               //type
+						&cooked->data[mip->dataOffset]  //data
+					);
+					CreateTextureFromCooked_CheckOpenGlError("glTexImage2D(...)") { break; }
+				}
+				else
+				{
+					glCompressedTexImage2D(
+						GL_TEXTURE_2D,                  //bound texture type
+						(GLint)mIndex,                  //image level
+						internalFormat,                 //internal format
+						mip->size.width,                //image width
+						mip->size.height,               //image height
+						0,                              //border
+						(GLsizei)mip->dataSize,         //image size
+						&cooked->data[mip->dataOffset]  //data
+					);
+					CreateTextureFromCooked_CheckOpenGlError("glCompressedTexImage2D(...)") { break; }
+				}
+			}
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+			if (textureOut->error != Result_None) { break; }
+			
+			bool hasMips = (cooked->numMips > 1);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint)(cooked->numMips - 1));
+			CreateTextureFromCooked_CheckOpenGlError("glTexParameteri(GL_TEXTURE_MAX_LEVEL)") { break; }
+			if (hasMips) { glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (pixelated ? GL_NEAREST_MIPMAP_NEAREST : GL_LINEAR_MIPMAP_LINEAR)); }
+			else { glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (pixelated ? GL_NEAREST : GL_LINEAR)); }
+			CreateTextureFromCooked_CheckOpenGlError("glTexParameteri(GL_TEXTURE_MIN_FILTER)") { break; }
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, (pixelated ? GL_NEAREST : GL_LINEAR));
+			CreateTextureFromCooked_CheckOpenGlError("glTexParameteri(GL_TEXTURE_MAG_FILTER)") { break; }
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, (repeating ? GL_REPEAT : GL_CLAMP_TO_EDGE));
+			CreateTextureFromCooked_CheckOpenGlError("glTexParameteri(GL_TEXTURE_WRAP_S)") { break; }
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, (repeating ? GL_REPEAT : GL_CLAMP_TO_EDGE));
+			CreateTextureFromCooked_CheckOpenGlError("glTexParameteri(GL_TEXTURE_WRAP_T)") { break; }
+			
+			if (cooked->format == TextureCompression_BC4)
+			{
+				GLint swizzleMask[] = {GL_ONE, GL_ONE, GL_ONE, GL_RED};
+				glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+				CreateTextureFromCooked_CheckOpenGlError("glTexParameteriv(GL_TEXTURE_SWIZZLE_RGBA)") { break; }
+			}
+			
+			textureOut->isValid = true;
+		} break;
+		#endif
+		
+		default: textureOut->error = Result_UnsupportedApi; break;
+	}
+	
+	AssertIf(!textureOut->isValid, textureOut->error != Result_None);
+	return textureOut->isValid;
+}
+
+//NOTE: "Resources/Textures/thing.png" -> "Cooked/Resources/Textures/thing.ptex"
+MyStr_t GetCookedTexturePath(MyStr_t sourcePath, MemArena_t* memArena)
+{
+	NotNull(memArena);
+	u64 extensionIndex = sourcePath.length;
+	for (u64 cIndex = sourcePath.length; cIndex > 0; cIndex--)
+	{
+		char c = sourcePath.chars[cIndex-1];
+		if (c == '/' || c == '\\') { break; }
+		if (c == '.') { extensionIndex = cIndex-1; break; }
+	}
+	return PrintInArenaStr(memArena, "%s%.*s%s", COOKED_TEXTURE_FOLDER, (int)extensionIndex, sourcePath.chars, COOKED_TEXTURE_FILE_EXTENSION);
+}
+
+//NOTE: Loads the .ptex for sourcePath from COOKED_TEXTURE_FOLDER (see GetCookedTexturePath). When allowCook is true (developer builds) the source image is hashed and
+//      the .ptex is (re)cooked whenever it's missing or out of date, otherwise the .ptex is trusted as-is and the source isn't touched.
+//      Returns false (leaving textureOut cleared) if the caller should fall back to LoadTexture
+bool LoadCookedTexture(MemArena_t* memArena, Texture_t* textureOut, MyStr_t sourcePath, bool pixelated, bool repeating, bool highQuality, bool allowCook)
+{
+	NotNull(memArena);
+	NotNull(textureOut);
+	NotEmptyStr(&sourcePath);
+	ClearPointer(textureOut);
+	
+	MemArena_t* scratch = GetScratchArena(memArena);
+	MyStr_t cookedPath = GetCookedTexturePath(sourcePath, scratch);
+	bool result = false;
+	
+	PlatMappedFile_t sourceFile = {};
+	u64 sourceHash = 0;
+	if (allowCook)
+	{
+		if (!plat->MapFile(sourcePath, &sourceFile)) { FreeScratchArena(scratch); return false; }
+		sourceHash = FnvHashU64(sourceFile.data, sourceFile.size);
+	}
+	
+	PlatMappedFile_t cookedFile = {};
+	if (plat->MapFile(cookedPath, &cookedFile))
+	{
+		CookedTexture_t cooked = {};
+		if (DeserializeCookedTexture(cookedFile.data, cookedFile.size, &cooked) &&
+			(!allowCook || (cooked.sourceSize == sourceFile.size && cooked.sourceHash == sourceHash)))
+		{
+			result = CreateTextureFromCooked(memArena, textureOut, &cooked, pixelated, repeating);
+			if (!result) { DestroyTexture(textureOut); }
+		}
+		plat->UnmapFile(&cookedFile);
+	}
+	
+	if (!result && allowCook && sourceFile.size > 0)
+	{
+		PlatImageData_t imageData;
+		if (plat->TryParseImageFile(sourceFile.size, sourceFile.data, sizeof(u32), &imageData))
+		{
+			TextureCompression_t format = ChooseTextureCompression(&imageData, pixelated, highQuality);
+			if (!IsTextureCompressionSupported(format)) { format = TextureCompression_None; }
+			CookedTexture_t cooked = {};
+			if (CookTexture(scratch, &imageData, format, true, &cooked))
+			{
+				cooked.sourceSize = sourceFile.size;
+				cooked.sourceHash = sourceHash;
+				u64 cookedFileSize = 0;
+				u8* cookedFileData = SerializeCookedTexture(&cooked, scratch, &cookedFileSize);
+				if (cookedFileData != nullptr && (!CreateFoldersForPath(cookedPath) || !plat->WriteEntireFile(cookedPath, cookedFileData, cookedFileSize)))
+				{
+					PrintLine_W("Failed to write cooked texture to \"%.*s\"", StrPrint(cookedPath));
+				}
+				result = CreateTextureFromCooked(memArena, textureOut, &cooked, pixelated, repeating);
+				if (!result) { DestroyTexture(textureOut); }
+			}
+			plat->FreeImageData(&imageData);
+		}
+	}
+	
+	if (allowCook) { plat->UnmapFile(&sourceFile); }
+	FreeScratchArena(scratch);
+	return result;
+}
+
+//NOTE: pixels points at the top-left pixel of subPartRec inside a larger image that is rowSize bytes wide.
+//      Only works on non-antialiased, single layer textures. The pixelSize must match the texture's format
+void UpdateTextureSubPart(Texture_t* texture, reci subPartRec, const u8* pixels, u64 pixelSize, u64 rowSize)
+{
+	NotNull(texture);
+	NotNull(pixels);
+	Assert(texture->isValid);
+	Assert(texture->antialiasingNumSamples == 0 && texture->numLayers == 1);
+	Assert(pixelSize == 1 || pixelSize == 3 || pixelSize == 4);
+	Assert(rowSize >= pixelSize * subPartRec.width && (rowSize % pixelSize) == 0);
+	Assert(subPartRec.x >= 0 && subPartRec.y >= 0);
+	Assert(subPartRec.x + subPartRec.width <= texture->widthi && subPartRec.y + subPartRec.height <= texture->heighti);
+	if (subPartRec.width <= 0 || subPartRec.height <= 0) { return; }
 	
+	switch (pig->renderApi)
+	{
+		#if OPENGL_SUPPORTED
+		case RenderApi_OpenGL:
+		{
+			GLenum dataFormat = ((pixelSize == 1) ? GL_RED : ((pixelSize == 3) ? GL_RGB : GL_RGBA));
+			glActiveTexture(GL_TEXTURE0); AssertNoOpenGlError();
+			glBindTexture(GL_TEXTURE_2D, texture->glId); AssertNoOpenGlError();
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1); AssertNoOpenGlError();
+			glPixelStorei(GL_UNPACK_ROW_LENGTH, (GLint)(rowSize / pixelSize)); AssertNoOpenGlError();
+			glTexSubImage2D(
+				GL_TEXTURE_2D,     //target
+				0,                 //level
+				subPartRec.x,      //xoffset
+				subPartRec.y,      //yoffset
+				subPartRec.width,  //width
+				subPartRec.height, //height
+				dataFormat,        //format
+				GL_UNSIGNED_BYTE,  //type
+				pixels             //pixels
+			);
+			AssertNoOpenGlError();
+			glPixelStorei(GL_UNPACK_ROW_LENGTH, 0); AssertNoOpenGlError();
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 4); AssertNoOpenGlError();
+			//Put back whatever the render context thinks is bound to the first texture slot
+			if (rc != nullptr && rc->state.boundApiTexture1 != nullptr && rc->state.boundApiTexture1->numLayers <= 1)
+			{
+				glBindTexture(GL_TEXTURE_2D, rc->state.boundApiTexture1->glId); AssertNoOpenGlError();
+			}
+		} break;
+		#endif
+		default: AssertMsg(false, "Unsupported API in UpdateTextureSubPart"); break;
+	}
 }
 
 const char* PrintTextureError(const Texture_t* texture)
@@ -360,7 +671,6 @@ void CreateSubImageData(const PlatImageData_t* sourceImageData, reci sourceRec,
 	NotNull(sourceImageData->data8);
 	NotNull(imageDataOut);
 	NotNull(allocArena);
-	//TODO: Make a RecFullyContains function or something similar and assert on that
 	
 	ClearPointer(imageDataOut);
 	imageDataOut->allocArena = allocArena;
@@ -371,20 +681,10 @@ void CreateSubImageData(const PlatImageData_t* sourceImageData, reci sourceRec,
 	imageDataOut->data8 = AllocArray(allocArena, u8, imageDataOut->dataSize);
 	NotNull(imageDataOut->data8);
 	
-	for (i32 yOffset = 0; yOffset < sourceRec.height; yOffset++)
-	{
-		for (i32 xOffset = 0; xOffset < sourceRec.width; xOffset++)
-		{
-			v2i pixelPos = sourceRec.topLeft + NewVec2i(xOffset, yOffset);
-			u64 srcPixelIndex = (pixelPos.y * sourceImageData->rowSize) + (pixelPos.x * sourceImageData->pixelSize);
-			Assert(srcPixelIndex + sourceImageData->pixelSize <= sourceImageData->dataSize);
-			const u32* srcPixelPntr = (u32*)&sourceImageData->data8[srcPixelIndex];
-			u64 destPixelIndex = (yOffset * imageDataOut->rowSize) + (xOffset * imageDataOut->pixelSize);
-			Assert(destPixelIndex + imageDataOut->pixelSize <= imageDataOut->dataSize);
-			u32* destPixelPntr = (u32*)&imageDataOut->data8[destPixelIndex];
-			*destPixelPntr = *srcPixelPntr;
-		}
-	}
+	Assert(sourceImageData->pixelSize == sizeof(u32));
+	Assert(sourceRec.x >= 0 && sourceRec.y >= 0 && sourceRec.x + sourceRec.width <= sourceImageData->width && sourceRec.y + sourceRec.height <= sourceImageData->height);
+	const u8* sourceStart = &sourceImageData->data8[((u64)sourceRec.y * sourceImageData->rowSize) + ((u64)sourceRec.x * sourceImageData->pixelSize)];
+	ImageCopyBlock(imageDataOut->data8, imageDataOut->rowSize, sourceStart, sourceImageData->rowSize, imageDataOut->rowSize, (u64)sourceRec.height);
 }
 
 bool IsPlatImageDataPixelFilled(PlatImageData_t* imageData, v2i pixelPos, u8 minAlpha = 1, u8* alphaValueOut = nullptr)
@@ -94,6 +94,7 @@ bool CreateTextureArray(MemArena_t* memArena, Texture_t* textureOut, u64 numLaye
 			CreateTextureArray_CheckOpenGlError("glGenTextures()") { break; }
 			glBindTexture(GL_TEXTURE_2D_ARRAY, textureOut->glId);
 			CreateTextureArray_CheckOpenGlError("glBindTexture(GL_TEXTURE_2D_ARRAY)") { break; }
+			ForgetBoundApiTexture();
 			
 			GLenum dataFormat = (reverseByteOrder ? GL_BGRA : GL_RGBA);
 			//NOTE: For some reason we have to specify GL_RGBA8 instead of GL_RGBA for texture arrays. Otherwise glTexStorage3D throws INVALID_ENUM
@@ -176,7 +177,7 @@ bool CreateTextureArray(MemArena_t* memArena, Texture_t* textureOut, u64 numLaye
 			}
 			
 			textureOut->isValid = true;
-		}
+		} break;
 		#endif
 		
 		// +==============================+
@@ -211,22 +212,22 @@ bool LoadTextureArrayFromMultipleFiles(MemArena_t* memArena, Texture_t* textureO
 		MyStr_t filePath = filePaths[fIndex];
 		NotNullStr(&filePath);
 		
-		PlatFileContents_t imageFileContents = {};
-		if (plat->ReadFileContents(filePath, nullptr, false, &imageFileContents))
+		PlatMappedFile_t imageFile = {};
+		if (plat->MapFile(filePath, &imageFile))
 		{
-			if (imageFileContents.size == 0)
+			if (imageFile.size == 0)
 			{
 				PrintLine_E("Image file %llu/%llu for texture array was empty at \"%.*s\"", fIndex+1, numFiles, StrPrint(filePath));
 				textureOut->error = Result_EmptyFile;
 				allImagesLoadedSuccessfully = false;
 			}
-			else if (!plat->TryParseImageFile(&imageFileContents, 4, imageDataPntr))
+			else if (!plat->TryParseImageFile(imageFile.size, imageFile.data, 4, imageDataPntr))
 			{
 				PrintLine_E("Failed to parse image %llu/%llu for texture array at \"%.*s\"", fIndex+1, numFiles, StrPrint(filePath));
 				textureOut->error = Result_ParseFailure;
 				allImagesLoadedSuccessfully = false;
 			}
-			plat->FreeFileContents(&imageFileContents);
+			plat->UnmapFile(&imageFile);
 		}
 		else
 		{
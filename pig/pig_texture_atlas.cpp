@@ -0,0 +1,287 @@
+/*
+File:   pig_texture_atlas.cpp
+Date:   10\19\2026
+Description:
+	** Holds the functions that pack textures into a TextureAtlas_t and keep the atlas pages up to date on the GPU
+*/
+
+void InitTextureAtlas(TextureAtlas_t* atlas, MemArena_t* memArena, v2i pageSize)
+{
+	NotNull2(atlas, memArena);
+	Assert(pageSize.width > 0 && pageSize.height > 0);
+	ClearPointer(atlas);
+	atlas->allocArena = memArena;
+	atlas->pageSize = pageSize;
+}
+
+void FreeTextureAtlas(TextureAtlas_t* atlas)
+{
+	NotNull(atlas);
+	for (u64 pIndex = 0; pIndex < atlas->numPages; pIndex++)
+	{
+		TextureAtlasPage_t* page = &atlas->pages[pIndex];
+		DestroyTexture(&page->texture);
+		if (page->pixels != nullptr) { FreeMem(atlas->allocArena, page->pixels, (u64)(page->texture.widthi * page->texture.heighti) * sizeof(u32)); }
+		FreeVarArray(&page->freeRecs);
+	}
+	ClearPointer(atlas);
+}
+
+bool IsTextureInAtlas(const Texture_t* texture)
+{
+	NotNull(texture);
+	return (texture->atlasPage != nullptr);
+}
+
+TextureAtlasPage_t* TextureAtlasAddPage(TextureAtlas_t* atlas, bool pixelated)
+{
+	NotNull(atlas);
+	if (atlas->numPages >= TEXTURE_ATLAS_MAX_PAGES) { return nullptr; }
+	
+	TextureAtlasPage_t* page = &atlas->pages[atlas->numPages];
+	ClearPointer(page);
+	page->pageIndex = atlas->numPages;
+	page->pixelated = pixelated;
+	u64 pixelsSize = (u64)(atlas->pageSize.width * atlas->pageSize.height) * sizeof(u32);
+	page->pixels = AllocArray(atlas->allocArena, u8, pixelsSize);
+	if (page->pixels == nullptr) { return nullptr; }
+	MyMemSet(page->pixels, 0x00, pixelsSize);
+	
+	PlatImageData_t imageData = {};
+	imageData.size = atlas->pageSize;
+	imageData.pixelSize = sizeof(u32);
+	imageData.rowSize = (u64)atlas->pageSize.width * sizeof(u32);
+	imageData.dataSize = pixelsSize;
+	imageData.data8 = page->pixels;
+	if (!CreateTexture(atlas->allocArena, &page->texture, &imageData, pixelated, false))
+	{
+		FreeMem(atlas->allocArena, page->pixels, pixelsSize);
+		ClearPointer(page);
+		return nullptr;
+	}
+	CreateVarArray(&page->freeRecs, atlas->allocArena, sizeof(reci));
+	
+	atlas->numPages++;
+	return page;
+}
+
+//Reuses the smallest free region the item fits in, otherwise shelf packs it like FontAtlasPackGlyph
+bool TextureAtlasPackRec(TextureAtlasPage_t* page, v2i pageSize, v2i paddedSize, reci* recOut)
+{
+	NotNull2(page, recOut);
+	
+	u64 bestFreeIndex = page->freeRecs.length;
+	i32 bestFreeArea = 0;
+	VarArrayLoop(&page->freeRecs, fIndex)
+	{
+		VarArrayLoopGet(reci, freeRec, &page->freeRecs, fIndex);
+		if (freeRec->width >= paddedSize.width && freeRec->height >= paddedSize.height)
+		{
+			i32 area = freeRec->width * freeRec->height;
+			if (bestFreeIndex == page->freeRecs.length || area < bestFreeArea) { bestFreeIndex = fIndex; bestFreeArea = area; }
+		}
+	}
+	if (bestFreeIndex < page->freeRecs.length)
+	{
+		reci* freeRec = VarArrayGet(&page->freeRecs, bestFreeIndex, reci);
+		*recOut = NewReci(freeRec->topLeft, paddedSize);
+		//Whatever is left to the right of the item stays free, the rest of the region below it is given up until the page empties
+		if (freeRec->width - paddedSize.width > 2*TEXTURE_ATLAS_PADDING)
+		{
+			freeRec->x += paddedSize.width;
+			freeRec->width -= paddedSize.width;
+		}
+		else { VarArrayRemove(&page->freeRecs, bestFreeIndex, reci); }
+		return true;
+	}
+	
+	TextureAtlasShelf_t* bestShelf = nullptr;
+	for (u64 sIndex = 0; sIndex < page->numShelves; sIndex++)
+	{
+		TextureAtlasShelf_t* shelf = &page->shelves[sIndex];
+		if (shelf->height >= paddedSize.height && shelf->height <= paddedSize.height + paddedSize.height/4 + 2 &&
+			shelf->usedWidth + paddedSize.width <= pageSize.width &&
+			(bestShelf == nullptr || shelf->height < bestShelf->height))
+		{
+			bestShelf = shelf;
+		}
+	}
+	if (bestShelf == nullptr)
+	{
+		i32 nextShelfY = 0;
+		if (page->numShelves > 0) { nextShelfY = page->shelves[page->numShelves-1].y + page->shelves[page->numShelves-1].height; }
+		if (page->numShelves >= TEXTURE_ATLAS_MAX_SHELVES || nextShelfY + paddedSize.height > pageSize.height || paddedSize.width > pageSize.width) { return false; }
+		bestShelf = &page->shelves[page->numShelves];
+		page->numShelves++;
+		bestShelf->y = nextShelfY;
+		bestShelf->height = paddedSize.height;
+		bestShelf->usedWidth = 0;
+	}
+	
+	*recOut = NewReci(bestShelf->usedWidth, bestShelf->y, paddedSize.width, paddedSize.height);
+	bestShelf->usedWidth += paddedSize.width;
+	return true;
+}
+
+void TextureAtlasMarkDirty(TextureAtlasPage_t* page, reci dirtyRec)
+{
+	NotNull(page);
+	if (page->isDirty)
+	{
+		i32 minX = MinI32(page->dirtyRec.x, dirtyRec.x);
+		i32 minY = MinI32(page->dirtyRec.y, dirtyRec.y);
+		i32 maxX = MaxI32(page->dirtyRec.x + page->dirtyRec.width, dirtyRec.x + dirtyRec.width);
+		i32 maxY = MaxI32(page->dirtyRec.y + page->dirtyRec.height, dirtyRec.y + dirtyRec.height);
+		page->dirtyRec = NewReci(minX, minY, maxX - minX, maxY - minY);
+	}
+	else
+	{
+		page->dirtyRec = dirtyRec;
+		page->isDirty = true;
+	}
+}
+
+//NOTE: Copies the image into the middle of paddedRec and then smears its outermost pixels out into the padding
+void TextureAtlasBlit(TextureAtlas_t* atlas, TextureAtlasPage_t* page, reci paddedRec, const PlatImageData_t* imageData)
+{
+	NotNull3(atlas, page, imageData);
+	Assert(imageData->pixelSize == sizeof(u32));
+	u64 pageRowSize = (u64)atlas->pageSize.width * sizeof(u32);
+	for (i32 yOffset = 0; yOffset < paddedRec.height; yOffset++)
+	{
+		i32 sourceY = ClampI32(yOffset - TEXTURE_ATLAS_PADDING, 0, imageData->height-1);
+		const u32* sourceRow = (const u32*)&imageData->data8[(u64)sourceY * imageData->rowSize];
+		u32* destRow = (u32*)&page->pixels[((u64)(paddedRec.y + yOffset) * pageRowSize) + ((u64)paddedRec.x * sizeof(u32))];
+		for (i32 xOffset = 0; xOffset < paddedRec.width; xOffset++)
+		{
+			i32 sourceX = ClampI32(xOffset - TEXTURE_ATLAS_PADDING, 0, imageData->width-1);
+			destRow[xOffset] = sourceRow[sourceX];
+		}
+	}
+	TextureAtlasMarkDirty(page, paddedRec);
+}
+
+void TextureAtlasFillTexture(TextureAtlasPage_t* page, reci paddedRec, v2i size, Texture_t* textureOut)
+{
+	NotNull2(page, textureOut);
+	ClearPointer(textureOut);
+	textureOut->isValid = true;
+	textureOut->id = pig->nextTextureId;
+	pig->nextTextureId++;
+	textureOut->error = Result_None;
+	textureOut->allocArena = page->texture.allocArena;
+	textureOut->isPixelated = page->pixelated;
+	textureOut->isRepeating = false;
+	textureOut->hasAlpha = true;
+	textureOut->sizei = size;
+	textureOut->size = ToVec2(size);
+	textureOut->numLayers = 1;
+	textureOut->atlasPage = &page->texture;
+	textureOut->atlasRec = NewReci(paddedRec.x + TEXTURE_ATLAS_PADDING, paddedRec.y + TEXTURE_ATLAS_PADDING, size.width, size.height);
+	#if OPENGL_SUPPORTED
+	textureOut->glId = page->texture.glId; //so things like ImGui::Image still have something to show, DestroyTexture knows not to delete it
+	#endif
+}
+
+//NOTE: Returns false if the image is too big for the atlas, isn't RGBA8, or every page is full. The caller should make a standalone texture instead
+bool TextureAtlasAddTexture(TextureAtlas_t* atlas, Texture_t* textureOut, const PlatImageData_t* imageData, bool pixelated)
+{
+	NotNull3(atlas, textureOut, imageData);
+	if (imageData->pixelSize != sizeof(u32) || imageData->floatChannels) { return false; }
+	if (imageData->width <= 0 || imageData->height <= 0) { return false; }
+	if (imageData->width > TEXTURE_ATLAS_MAX_ITEM_SIZE || imageData->height > TEXTURE_ATLAS_MAX_ITEM_SIZE) { return false; }
+	
+	v2i paddedSize = imageData->size + NewVec2i(2*TEXTURE_ATLAS_PADDING, 2*TEXTURE_ATLAS_PADDING);
+	TextureAtlasPage_t* page = nullptr;
+	reci paddedRec = Reci_Zero;
+	for (u64 pIndex = 0; pIndex < atlas->numPages; pIndex++)
+	{
+		TextureAtlasPage_t* existingPage = &atlas->pages[pIndex];
+		if (existingPage->pixelated == pixelated && TextureAtlasPackRec(existingPage, atlas->pageSize, paddedSize, &paddedRec)) { page = existingPage; break; }
+	}
+	if (page == nullptr)
+	{
+		page = TextureAtlasAddPage(atlas, pixelated);
+		if (page == nullptr || !TextureAtlasPackRec(page, atlas->pageSize, paddedSize, &paddedRec)) { return false; }
+	}
+	
+	TextureAtlasBlit(atlas, page, paddedRec, imageData);
+	TextureAtlasFillTexture(page, paddedRec, imageData->size, textureOut);
+	page->numItems++;
+	atlas->numAdds++;
+	return true;
+}
+
+TextureAtlasPage_t* TextureAtlasFindPage(TextureAtlas_t* atlas, const Texture_t* texture)
+{
+	NotNull2(atlas, texture);
+	for (u64 pIndex = 0; pIndex < atlas->numPages; pIndex++)
+	{
+		if (texture->atlasPage == &atlas->pages[pIndex].texture) { return &atlas->pages[pIndex]; }
+	}
+	return nullptr;
+}
+
+void TextureAtlasRemoveTexture(TextureAtlas_t* atlas, Texture_t* texture)
+{
+	NotNull2(atlas, texture);
+	TextureAtlasPage_t* page = TextureAtlasFindPage(atlas, texture);
+	AssertMsg(page != nullptr, "Tried to remove a texture from an atlas it doesn't belong to");
+	
+	Assert(page->numItems > 0);
+	page->numItems--;
+	if (page->numItems == 0)
+	{
+		//Nothing is left on the page so we can start packing it from scratch
+		page->numShelves = 0;
+		VarArrayClear(&page->freeRecs);
+	}
+	else
+	{
+		reci paddedRec = NewReci(texture->atlasRec.x - TEXTURE_ATLAS_PADDING, texture->atlasRec.y - TEXTURE_ATLAS_PADDING, texture->atlasRec.width + 2*TEXTURE_ATLAS_PADDING, texture->atlasRec.height + 2*TEXTURE_ATLAS_PADDING);
+		reci* freeRec = VarArrayAdd(&page->freeRecs, reci);
+		NotNull(freeRec);
+		*freeRec = paddedRec;
+	}
+	atlas->numRemoves++;
+	ClearPointer(texture);
+}
+
+//NOTE: Used on hot reload. When the new image is the same size it's written over the old one in place and every Texture_t*
+//      that points at this texture stays valid without anything else in the atlas moving. Otherwise the old region is freed
+//      and the image is packed again like a new texture
+bool TextureAtlasReplaceTexture(TextureAtlas_t* atlas, Texture_t* texture, const PlatImageData_t* imageData)
+{
+	NotNull3(atlas, texture, imageData);
+	TextureAtlasPage_t* page = TextureAtlasFindPage(atlas, texture);
+	NotNull(page);
+	if (imageData->pixelSize == sizeof(u32) && !imageData->floatChannels && imageData->size == texture->sizei)
+	{
+		reci paddedRec = NewReci(texture->atlasRec.x - TEXTURE_ATLAS_PADDING, texture->atlasRec.y - TEXTURE_ATLAS_PADDING, texture->atlasRec.width + 2*TEXTURE_ATLAS_PADDING, texture->atlasRec.height + 2*TEXTURE_ATLAS_PADDING);
+		TextureAtlasBlit(atlas, page, paddedRec, imageData);
+		atlas->numInPlaceUpdates++;
+		return true;
+	}
+	
+	bool pixelated = page->pixelated;
+	TextureAtlasRemoveTexture(atlas, texture);
+	return TextureAtlasAddTexture(atlas, texture, imageData, pixelated);
+}
+
+//Called once per frame before rendering, uploads the changed part of each page and rebuilds its mips
+void TextureAtlasFlush(TextureAtlas_t* atlas)
+{
+	NotNull(atlas);
+	for (u64 pIndex = 0; pIndex < atlas->numPages; pIndex++)
+	{
+		TextureAtlasPage_t* page = &atlas->pages[pIndex];
+		if (!page->isDirty) { continue; }
+		u64 rowSize = (u64)atlas->pageSize.width * sizeof(u32);
+		const u8* dirtyPixels = &page->pixels[((u64)page->dirtyRec.y * rowSize) + ((u64)page->dirtyRec.x * sizeof(u32))];
+		UpdateTextureSubPart(&page->texture, page->dirtyRec, dirtyPixels, sizeof(u32), rowSize);
+		TextureGenerateMipmaps(&page->texture);
+		atlas->numUploads++;
+		atlas->numUploadedBytes += (u64)(page->dirtyRec.width * page->dirtyRec.height) * sizeof(u32);
+		page->isDirty = false;
+	}
+}
@@ -0,0 +1,58 @@
+/*
+File:   pig_texture_atlas.h
+Date:   10\19\2026
+Description:
+	** A TextureAtlas_t packs small RGBA textures into a handful of shared pages so that drawing a bunch of
+	** them back to back doesn't need a texture bind between each one. A texture that lives in an atlas is
+	** still a regular Texture_t (with its own size) but has atlasPage and atlasRec filled in, and the render
+	** context translates binds and source rectangles into the page's space (see RcBindTexture1)
+*/
+
+#ifndef _PIG_TEXTURE_ATLAS_H
+#define _PIG_TEXTURE_ATLAS_H
+
+#define TEXTURE_ATLAS_PAGE_SIZE       1024 //px
+#define TEXTURE_ATLAS_MAX_PAGES       8 //pages
+#define TEXTURE_ATLAS_MAX_SHELVES     64 //shelves per page
+#define TEXTURE_ATLAS_PADDING         2 //px, filled with copies of the texture's edge pixels so filtering and the first mip don't bleed in neighbors
+#define TEXTURE_ATLAS_MAX_ITEM_SIZE   256 //px, anything wider or taller stays a standalone texture
+
+struct TextureAtlasShelf_t
+{
+	i32 y;
+	i32 height;
+	i32 usedWidth;
+};
+
+struct TextureAtlasPage_t
+{
+	u64 pageIndex;
+	bool pixelated; //filtering is part of the texture object so pixelated and smooth textures can't share a page
+	Texture_t texture;
+	u8* pixels; //RGBA, CPU side copy of the page so changes can be uploaded in one batch
+	
+	u64 numItems;
+	u64 numShelves;
+	TextureAtlasShelf_t shelves[TEXTURE_ATLAS_MAX_SHELVES];
+	VarArray_t freeRecs; //reci, padded regions left behind by removed textures
+	
+	bool isDirty;
+	reci dirtyRec;
+};
+
+struct TextureAtlas_t
+{
+	MemArena_t* allocArena;
+	v2i pageSize;
+	
+	u64 numPages;
+	TextureAtlasPage_t pages[TEXTURE_ATLAS_MAX_PAGES];
+	
+	u64 numAdds;
+	u64 numInPlaceUpdates; //hot reloads that kept their size and were rewritten where they were
+	u64 numRemoves;
+	u64 numUploads;
+	u64 numUploadedBytes;
+};
+
+#endif //  _PIG_TEXTURE_ATLAS_H
@@ -0,0 +1,853 @@
+/*
+File:   pig_texture_compression.cpp
+Date:   10\19\2026
+Description:
+	** Holds the CPU side of texture cooking: choosing a block compression format for an image, building the mip chain,
+	** encoding/decoding BC1, BC3, BC4 and BC7 (mode 6) blocks, and reading/writing the .ptex container.
+	** Nothing in here touches the render API, see CreateTextureFromCooked in pig_texture.cpp for the upload
+*/
+
+// +--------------------------------------------------------------+
+// |                           Helpers                            |
+// +--------------------------------------------------------------+
+u64 GetTextureCompressionBlockBytes(TextureCompression_t format)
+{
+	switch (format)
+	{
+		case TextureCompression_BC1: return 8;
+		case TextureCompression_BC3: return 16;
+		case TextureCompression_BC4: return 8;
+		case TextureCompression_BC7: return 16;
+		default: return 0;
+	}
+}
+u64 GetCookedTextureMipDataSize(TextureCompression_t format, v2i mipSize)
+{
+	if (format == TextureCompression_None) { return (u64)mipSize.width * (u64)mipSize.height * sizeof(u32); }
+	u64 numBlocksX = (u64)((mipSize.width + TEXTURE_BLOCK_SIZE-1) / TEXTURE_BLOCK_SIZE);
+	u64 numBlocksY = (u64)((mipSize.height + TEXTURE_BLOCK_SIZE-1) / TEXTURE_BLOCK_SIZE);
+	return numBlocksX * numBlocksY * GetTextureCompressionBlockBytes(format);
+}
+
+//NOTE: Copies a 4x4 block of RGBA8 pixels into rgbaOut. Pixels past the right/bottom edge repeat the last column/row
+void TexCompFetchBlock(const u8* pixels, v2i size, u64 rowSize, i32 blockX, i32 blockY, u8* rgbaOut)
+{
+	for (i32 yOffset = 0; yOffset < TEXTURE_BLOCK_SIZE; yOffset++)
+	{
+		i32 pixelY = MinI32(blockY*TEXTURE_BLOCK_SIZE + yOffset, size.height-1);
+		for (i32 xOffset = 0; xOffset < TEXTURE_BLOCK_SIZE; xOffset++)
+		{
+			i32 pixelX = MinI32(blockX*TEXTURE_BLOCK_SIZE + xOffset, size.width-1);
+			const u8* pixelPntr = &pixels[((u64)pixelY * rowSize) + ((u64)pixelX * sizeof(u32))];
+			u8* outPntr = &rgbaOut[((yOffset * TEXTURE_BLOCK_SIZE) + xOffset) * 4];
+			outPntr[0] = pixelPntr[0];
+			outPntr[1] = pixelPntr[1];
+			outPntr[2] = pixelPntr[2];
+			outPntr[3] = pixelPntr[3];
+		}
+	}
+}
+
+//NOTE: Finds the principal axis of the block's colors (power iteration on the covariance matrix) and returns
+//      the two pixels that sit furthest along it, pulled in by 1/16th of the range to reduce quantization error.
+//      numChannels is 3 for RGB (BC1) or 4 for RGBA (BC7). Channels are read with a stride of 4 either way
+void TexCompFindEndpoints(const u8* rgba, u64 numChannels, u8* endpoint0Out, u8* endpoint1Out)
+{
+	Assert(numChannels == 3 || numChannels == 4);
+	r32 mean[4] = {};
+	for (u64 pIndex = 0; pIndex < 16; pIndex++)
+	{
+		for (u64 cIndex = 0; cIndex < numChannels; cIndex++) { mean[cIndex] += (r32)rgba[pIndex*4 + cIndex]; }
+	}
+	for (u64 cIndex = 0; cIndex < numChannels; cIndex++) { mean[cIndex] /= 16.0f; }
+	
+	r32 covariance[4][4] = {};
+	for (u64 pIndex = 0; pIndex < 16; pIndex++)
+	{
+		r32 diff[4] = {};
+		for (u64 cIndex = 0; cIndex < numChannels; cIndex++) { diff[cIndex] = (r32)rgba[pIndex*4 + cIndex] - mean[cIndex]; }
+		for (u64 row = 0; row < numChannels; row++)
+		{
+			for (u64 col = 0; col < numChannels; col++) { covariance[row][col] += diff[row] * diff[col]; }
+		}
+	}
+	
+	r32 axis[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+	for (u64 iteration = 0; iteration < 4; iteration++)
+	{
+		r32 newAxis[4] = {};
+		r32 maxComponent = 0.0f;
+		for (u64 row = 0; row < numChannels; row++)
+		{
+			for (u64 col = 0; col < numChannels; col++) { newAxis[row] += covariance[row][col] * axis[col]; }
+			maxComponent = MaxR32(maxComponent, AbsR32(newAxis[row]));
+		}
+		if (maxComponent < 0.0001f) { break; } //all the pixels are the same color, any axis will do
+		for (u64 cIndex = 0; cIndex < numChannels; cIndex++) { axis[cIndex] = newAxis[cIndex] / maxComponent; }
+	}
+	
+	u64 minIndex = 0;
+	u64 maxIndex = 0;
+	r32 minProjection = 0.0f;
+	r32 maxProjection = 0.0f;
+	for (u64 pIndex = 0; pIndex < 16; pIndex++)
+	{
+		r32 projection = 0.0f;
+		for (u64 cIndex = 0; cIndex < numChannels; cIndex++) { projection += (r32)rgba[pIndex*4 + cIndex] * axis[cIndex]; }
+		if (pIndex == 0 || projection < minProjection) { minProjection = projection; minIndex = pIndex; }
+		if (pIndex == 0 || projection > maxProjection) { maxProjection = projection; maxIndex = pIndex; }
+	}
+	
+	for (u64 cIndex = 0; cIndex < numChannels; cIndex++)
+	{
+		i32 maxValue = (i32)rgba[maxIndex*4 + cIndex];
+		i32 minValue = (i32)rgba[minIndex*4 + cIndex];
+		i32 inset = (maxValue - minValue) / 16;
+		endpoint0Out[cIndex] = (u8)ClampI32(maxValue - inset, 0, 255);
+		endpoint1Out[cIndex] = (u8)ClampI32(minValue + inset, 0, 255);
+	}
+}
+
+u32 TexCompColorDistSquared(const u8* left, const u8* right, u64 numChannels)
+{
+	u32 result = 0;
+	for (u64 cIndex = 0; cIndex < numChannels; cIndex++)
+	{
+		i32 diff = (i32)left[cIndex] - (i32)right[cIndex];
+		result += (u32)(diff * diff);
+	}
+	return result;
+}
+
+//NOTE: BC7 fields are packed least significant bit first across all 16 bytes of the block
+void TexCompWriteBits(u8* block, u64* bitIndex, u32 value, u64 numBits)
+{
+	for (u64 bIndex = 0; bIndex < numBits; bIndex++)
+	{
+		u64 outBit = (*bitIndex) + bIndex;
+		if (IsFlagSet(value, (1u << bIndex))) { block[outBit / 8] |= (u8)(1 << (outBit % 8)); }
+	}
+	*bitIndex += numBits;
+}
+u32 TexCompReadBits(const u8* block, u64* bitIndex, u64 numBits)
+{
+	u32 result = 0;
+	for (u64 bIndex = 0; bIndex < numBits; bIndex++)
+	{
+		u64 inBit = (*bitIndex) + bIndex;
+		if (IsFlagSet(block[inBit / 8], (1 << (inBit % 8)))) { result |= (1u << bIndex); }
+	}
+	*bitIndex += numBits;
+	return result;
+}
+
+// +--------------------------------------------------------------+
+// |                         BC1 (DXT1)                           |
+// +--------------------------------------------------------------+
+u16 TexCompPack565(const u8* rgb)
+{
+	u16 red   = (u16)(((u32)rgb[0] * 31 + 127) / 255);
+	u16 green = (u16)(((u32)rgb[1] * 63 + 127) / 255);
+	u16 blue  = (u16)(((u32)rgb[2] * 31 + 127) / 255);
+	return (u16)((red << 11) | (green << 5) | blue);
+}
+void TexCompUnpack565(u16 color, u8* rgbOut)
+{
+	u8 red   = (u8)((color >> 11) & 0x1F);
+	u8 green = (u8)((color >> 5) & 0x3F);
+	u8 blue  = (u8)(color & 0x1F);
+	rgbOut[0] = (u8)((red << 3) | (red >> 2));
+	rgbOut[1] = (u8)((green << 2) | (green >> 4));
+	rgbOut[2] = (u8)((blue << 3) | (blue >> 2));
+}
+
+//NOTE: Always produces a 4 color block (color0 > color1) or a solid block (color0 == color1, every index 0)
+//      so the result decodes the same whether it's read as BC1 or as the color half of BC3
+void EncodeBc1Block(const u8* rgba, u8* blockOut)
+{
+	u8 endpoint0[4] = {};
+	u8 endpoint1[4] = {};
+	TexCompFindEndpoints(rgba, 3, &endpoint0[0], &endpoint1[0]);
+	u16 color0 = TexCompPack565(&endpoint0[0]);
+	u16 color1 = TexCompPack565(&endpoint1[0]);
+	if (color0 < color1) { SWAP_VARIABLES(u16, color0, color1); }
+	
+	u8 palette[4][3];
+	TexCompUnpack565(color0, &palette[0][0]);
+	TexCompUnpack565(color1, &palette[1][0]);
+	for (u64 cIndex = 0; cIndex < 3; cIndex++)
+	{
+		palette[2][cIndex] = (u8)((2 * (u32)palette[0][cIndex] + (u32)palette[1][cIndex] + 1) / 3);
+		palette[3][cIndex] = (u8)(((u32)palette[0][cIndex] + 2 * (u32)palette[1][cIndex] + 1) / 3);
+	}
+	
+	u32 indices = 0;
+	if (color0 != color1)
+	{
+		for (u64 pIndex = 0; pIndex < 16; pIndex++)
+		{
+			u32 bestIndex = 0;
+			u32 bestDist = UINT32_MAX;
+			for (u32 palIndex = 0; palIndex < 4; palIndex++)
+			{
+				u32 dist = TexCompColorDistSquared(&rgba[pIndex*4], &palette[palIndex][0], 3);
+				if (dist < bestDist) { bestDist = dist; bestIndex = palIndex; }
+			}
+			indices |= (bestIndex << (pIndex*2));
+		}
+	}
+	
+	blockOut[0] = (u8)(color0 & 0xFF);
+	blockOut[1] = (u8)(color0 >> 8);
+	blockOut[2] = (u8)(color1 & 0xFF);
+	blockOut[3] = (u8)(color1 >> 8);
+	blockOut[4] = (u8)((indices >> 0) & 0xFF);
+	blockOut[5] = (u8)((indices >> 8) & 0xFF);
+	blockOut[6] = (u8)((indices >> 16) & 0xFF);
+	blockOut[7] = (u8)((indices >> 24) & 0xFF);
+}
+void DecodeBc1Block(const u8* block, u8* rgbaOut, bool forceFourColor = false)
+{
+	u16 color0 = (u16)(block[0] | (block[1] << 8));
+	u16 color1 = (u16)(block[2] | (block[3] << 8));
+	u32 indices = (u32)block[4] | ((u32)block[5] << 8) | ((u32)block[6] << 16) | ((u32)block[7] << 24);
+	
+	u8 palette[4][4];
+	TexCompUnpack565(color0, &palette[0][0]);
+	TexCompUnpack565(color1, &palette[1][0]);
+	palette[0][3] = 255;
+	palette[1][3] = 255;
+	bool fourColor = (forceFourColor || color0 > color1);
+	for (u64 cIndex = 0; cIndex < 3; cIndex++)
+	{
+		if (fourColor)
+		{
+			palette[2][cIndex] = (u8)((2 * (u32)palette[0][cIndex] + (u32)palette[1][cIndex] + 1) / 3);
+			palette[3][cIndex] = (u8)(((u32)palette[0][cIndex] + 2 * (u32)palette[1][cIndex] + 1) / 3);
+		}
+		else
+		{
+			palette[2][cIndex] = (u8)(((u32)palette[0][cIndex] + (u32)palette[1][cIndex]) / 2);
+			palette[3][cIndex] = 0;
+		}
+	}
+	palette[2][3] = 255;
+	palette[3][3] = (fourColor ? 255 : 0);
+	
+	for (u64 pIndex = 0; pIndex < 16; pIndex++)
+	{
+		u32 palIndex = ((indices >> (pIndex*2)) & 0x03);
+		MyMemCopy(&rgbaOut[pIndex*4], &palette[palIndex][0], 4);
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                         BC4 (RGTC1)                          |
+// +--------------------------------------------------------------+
+//NOTE: values are read with the given stride so this can pull the alpha channel straight out of an RGBA block for BC3
+void EncodeBc4Block(const u8* values, u64 stride, u8* blockOut)
+{
+	u8 minValue = 255;
+	u8 maxValue = 0;
+	for (u64 pIndex = 0; pIndex < 16; pIndex++)
+	{
+		u8 value = values[pIndex * stride];
+		if (value < minValue) { minValue = value; }
+		if (value > maxValue) { maxValue = value; }
+	}
+	
+	//8 value mode (value0 > value1): index 0 = value0, index 1 = value1, indices 2-7 step from value0 to value1
+	u8 palette[8];
+	palette[0] = maxValue;
+	palette[1] = minValue;
+	for (u32 step = 1; step < 7; step++) { palette[step+1] = (u8)((((7 - step) * (u32)maxValue) + (step * (u32)minValue) + 3) / 7); }
+	
+	u64 indices = 0;
+	if (maxValue != minValue)
+	{
+		for (u64 pIndex = 0; pIndex < 16; pIndex++)
+		{
+			i32 value = (i32)values[pIndex * stride];
+			u64 bestIndex = 0;
+			i32 bestDist = 256;
+			for (u64 palIndex = 0; palIndex < 8; palIndex++)
+			{
+				i32 dist = AbsI32(value - (i32)palette[palIndex]);
+				if (dist < bestDist) { bestDist = dist; bestIndex = palIndex; }
+			}
+			indices |= (bestIndex << (pIndex*3));
+		}
+	}
+	
+	blockOut[0] = maxValue;
+	blockOut[1] = minValue;
+	for (u64 bIndex = 0; bIndex < 6; bIndex++) { blockOut[2 + bIndex] = (u8)((indices >> (bIndex*8)) & 0xFF); }
+}
+void DecodeBc4Block(const u8* block, u8* valuesOut, u64 stride)
+{
+	u8 value0 = block[0];
+	u8 value1 = block[1];
+	u8 palette[8];
+	palette[0] = value0;
+	palette[1] = value1;
+	if (value0 > value1)
+	{
+		for (u32 step = 1; step < 7; step++) { palette[step+1] = (u8)((((7 - step) * (u32)value0) + (step * (u32)value1) + 3) / 7); }
+	}
+	else
+	{
+		for (u32 step = 1; step < 5; step++) { palette[step+1] = (u8)((((5 - step) * (u32)value0) + (step * (u32)value1) + 2) / 5); }
+		palette[6] = 0;
+		palette[7] = 255;
+	}
+	
+	u64 indices = 0;
+	for (u64 bIndex = 0; bIndex < 6; bIndex++) { indices |= ((u64)block[2 + bIndex] << (bIndex*8)); }
+	for (u64 pIndex = 0; pIndex < 16; pIndex++) { valuesOut[pIndex * stride] = palette[(indices >> (pIndex*3)) & 0x07]; }
+}
+
+// +--------------------------------------------------------------+
+// |                         BC3 (DXT5)                           |
+// +--------------------------------------------------------------+
+void EncodeBc3Block(const u8* rgba, u8* blockOut)
+{
+	EncodeBc4Block(&rgba[3], 4, &blockOut[0]);
+	EncodeBc1Block(rgba, &blockOut[8]);
+}
+void DecodeBc3Block(const u8* block, u8* rgbaOut)
+{
+	DecodeBc1Block(&block[8], rgbaOut, true);
+	DecodeBc4Block(&block[0], &rgbaOut[3], 4);
+}
+
+// +--------------------------------------------------------------+
+// |                       BC7 (BPTC) Mode 6                      |
+// +--------------------------------------------------------------+
+//NOTE: Mode 6 is a single subset with 7.7.7.7 RGBA endpoints, one p-bit per endpoint and 4 bit indices.
+//      It's the simplest BC7 mode and handles smooth RGBA well. A full encoder would also try the partitioned modes
+const u32 Bc7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+//Picks the 7 bit values and p-bit that get closest to the 8 bit endpoint once expanded back to (value << 1) | pBit
+void TexCompQuantizeBc7Endpoint(const u8* endpoint, u8* quantizedOut, u8* pBitOut, u8* expandedOut)
+{
+	u32 bestError = UINT32_MAX;
+	for (u8 pBit = 0; pBit < 2; pBit++)
+	{
+		u8 quantized[4];
+		u8 expanded[4];
+		for (u64 cIndex = 0; cIndex < 4; cIndex++)
+		{
+			i32 value = ((i32)endpoint[cIndex] - pBit + 1) / 2;
+			quantized[cIndex] = (u8)ClampI32(value, 0, 127);
+			expanded[cIndex] = (u8)((quantized[cIndex] << 1) | pBit);
+		}
+		u32 error = TexCompColorDistSquared(endpoint, &expanded[0], 4);
+		if (error < bestError)
+		{
+			bestError = error;
+			*pBitOut = pBit;
+			MyMemCopy(quantizedOut, &quantized[0], 4);
+			MyMemCopy(expandedOut, &expanded[0], 4);
+		}
+	}
+}
+
+void EncodeBc7Block(const u8* rgba, u8* blockOut)
+{
+	u8 endpoints[2][4] = {};
+	TexCompFindEndpoints(rgba, 4, &endpoints[0][0], &endpoints[1][0]);
+	
+	u8 quantized[2][4];
+	u8 expanded[2][4];
+	u8 pBits[2];
+	TexCompQuantizeBc7Endpoint(&endpoints[0][0], &quantized[0][0], &pBits[0], &expanded[0][0]);
+	TexCompQuantizeBc7Endpoint(&endpoints[1][0], &quantized[1][0], &pBits[1], &expanded[1][0]);
+	
+	u8 palette[16][4];
+	for (u64 wIndex = 0; wIndex < 16; wIndex++)
+	{
+		for (u64 cIndex = 0; cIndex < 4; cIndex++)
+		{
+			palette[wIndex][cIndex] = (u8)((((64 - Bc7Weights4[wIndex]) * (u32)expanded[0][cIndex]) + (Bc7Weights4[wIndex] * (u32)expanded[1][cIndex]) + 32) >> 6);
+		}
+	}
+	
+	u8 indices[16];
+	for (u64 pIndex = 0; pIndex < 16; pIndex++)
+	{
+		u32 bestDist = UINT32_MAX;
+		indices[pIndex] = 0;
+		for (u8 wIndex = 0; wIndex < 16; wIndex++)
+		{
+			u32 dist = TexCompColorDistSquared(&rgba[pIndex*4], &palette[wIndex][0], 4);
+			if (dist < bestDist) { bestDist = dist; indices[pIndex] = wIndex; }
+		}
+	}
+	
+	//The first pixel's index is stored with only 3 bits so its top bit must be 0, swap the endpoints if it isn't
+	if (indices[0] >= 8)
+	{
+		for (u64 cIndex = 0; cIndex < 4; cIndex++) { SWAP_VARIABLES(u8, quantized[0][cIndex], quantized[1][cIndex]); }
+		SWAP_VARIABLES(u8, pBits[0], pBits[1]);
+		for (u64 pIndex = 0; pIndex < 16; pIndex++) { indices[pIndex] = (u8)(15 - indices[pIndex]); }
+	}
+	
+	MyMemSet(blockOut, 0x00, 16);
+	u64 bitIndex = 0;
+	TexCompWriteBits(blockOut, &bitIndex, (1 << 6), 7); //mode 6
+	for (u64 cIndex = 0; cIndex < 4; cIndex++)
+	{
+		TexCompWriteBits(blockOut, &bitIndex, quantized[0][cIndex], 7);
+		TexCompWriteBits(blockOut, &bitIndex, quantized[1][cIndex], 7);
+	}
+	TexCompWriteBits(blockOut, &bitIndex, pBits[0], 1);
+	TexCompWriteBits(blockOut, &bitIndex, pBits[1], 1);
+	for (u64 pIndex = 0; pIndex < 16; pIndex++) { TexCompWriteBits(blockOut, &bitIndex, indices[pIndex], (pIndex == 0) ? 3 : 4); }
+	Assert(bitIndex == 128);
+}
+//NOTE: Only decodes mode 6 blocks (which is all EncodeBc7Block produces). Other modes come out magenta
+void DecodeBc7Block(const u8* block, u8* rgbaOut)
+{
+	if ((block[0] & 0x7F) != 0x40)
+	{
+		for (u64 pIndex = 0; pIndex < 16; pIndex++) { rgbaOut[pIndex*4 + 0] = 255; rgbaOut[pIndex*4 + 1] = 0; rgbaOut[pIndex*4 + 2] = 255; rgbaOut[pIndex*4 + 3] = 255; }
+		return;
+	}
+	u64 bitIndex = 7;
+	u8 expanded[2][4];
+	for (u64 cIndex = 0; cIndex < 4; cIndex++)
+	{
+		expanded[0][cIndex] = (u8)TexCompReadBits(block, &bitIndex, 7);
+		expanded[1][cIndex] = (u8)TexCompReadBits(block, &bitIndex, 7);
+	}
+	u8 pBit0 = (u8)TexCompReadBits(block, &bitIndex, 1);
+	u8 pBit1 = (u8)TexCompReadBits(block, &bitIndex, 1);
+	for (u64 cIndex = 0; cIndex < 4; cIndex++)
+	{
+		expanded[0][cIndex] = (u8)((expanded[0][cIndex] << 1) | pBit0);
+		expanded[1][cIndex] = (u8)((expanded[1][cIndex] << 1) | pBit1);
+	}
+	for (u64 pIndex = 0; pIndex < 16; pIndex++)
+	{
+		u32 weight = Bc7Weights4[TexCompReadBits(block, &bitIndex, (pIndex == 0) ? 3 : 4)];
+		for (u64 cIndex = 0; cIndex < 4; cIndex++)
+		{
+			rgbaOut[pIndex*4 + cIndex] = (u8)((((64 - weight) * (u32)expanded[0][cIndex]) + (weight * (u32)expanded[1][cIndex]) + 32) >> 6);
+		}
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                      Encode and Decode                       |
+// +--------------------------------------------------------------+
+//NOTE: Block compression smears hard pixel edges so pixelated textures are only ever stored raw. White textures where only
+//      the alpha varies (masks, glyphs, particles) fit in BC4, otherwise the alpha channel decides between BC1 and BC3
+TextureCompression_t ChooseTextureCompression(const PlatImageData_t* imageData, bool pixelated, bool highQuality)
+{
+	NotNull(imageData);
+	if (pixelated || imageData->pixelSize != sizeof(u32) || imageData->floatChannels) { return TextureCompression_None; }
+	bool allOpaque = true;
+	bool allWhite = true;
+	for (i32 yPos = 0; yPos < imageData->height; yPos++)
+	{
+		const u8* rowPntr = &imageData->data8[(u64)yPos * imageData->rowSize];
+		for (i32 xPos = 0; xPos < imageData->width; xPos++)
+		{
+			const u8* pixelPntr = &rowPntr[xPos * sizeof(u32)];
+			if (pixelPntr[3] != 255) { allOpaque = false; }
+			if (pixelPntr[3] != 0 && (pixelPntr[0] != 255 || pixelPntr[1] != 255 || pixelPntr[2] != 255)) { allWhite = false; }
+		}
+		if (!allOpaque && !allWhite) { break; }
+	}
+	if (allWhite && !allOpaque) { return TextureCompression_BC4; }
+	if (highQuality) { return TextureCompression_BC7; }
+	return (allOpaque ? TextureCompression_BC1 : TextureCompression_BC3);
+}
+
+void EncodeTextureLevel(TextureCompression_t format, const u8* pixels, v2i size, u64 rowSize, u8* dataOut)
+{
+	NotNull2(pixels, dataOut);
+	if (format == TextureCompression_None)
+	{
+		for (i32 yPos = 0; yPos < size.height; yPos++)
+		{
+			MyMemCopy(&dataOut[(u64)yPos * (u64)size.width * sizeof(u32)], &pixels[(u64)yPos * rowSize], (u64)size.width * sizeof(u32));
+		}
+		return;
+	}
+	
+	u64 blockBytes = GetTextureCompressionBlockBytes(format);
+	i32 numBlocksX = (size.width + TEXTURE_BLOCK_SIZE-1) / TEXTURE_BLOCK_SIZE;
+	i32 numBlocksY = (size.height + TEXTURE_BLOCK_SIZE-1) / TEXTURE_BLOCK_SIZE;
+	u8 rgba[16*4];
+	u8* blockPntr = dataOut;
+	for (i32 blockY = 0; blockY < numBlocksY; blockY++)
+	{
+		for (i32 blockX = 0; blockX < numBlocksX; blockX++)
+		{
+			TexCompFetchBlock(pixels, size, rowSize, blockX, blockY, &rgba[0]);
+			switch (format)
+			{
+				case TextureCompression_BC1: EncodeBc1Block(&rgba[0], blockPntr); break;
+				case TextureCompression_BC3: EncodeBc3Block(&rgba[0], blockPntr); break;
+				case TextureCompression_BC4: EncodeBc4Block(&rgba[3], 4, blockPntr); break;
+				case TextureCompression_BC7: EncodeBc7Block(&rgba[0], blockPntr); break;
+				default: Unimplemented(); break;
+			}
+			blockPntr += blockBytes;
+		}
+	}
+}
+
+//NOTE: Fills an RGBA8 image with the decoded contents of one mip. BC4 decodes to white with the value in alpha,
+//      matching the swizzle CreateTextureFromCooked uses. This is what lets us check the encoders without a GPU
+bool DecodeCookedTextureMip(const CookedTexture_t* cooked, u64 mipIndex, MemArena_t* memArena, PlatImageData_t* imageDataOut)
+{
+	NotNull3(cooked, memArena, imageDataOut);
+	if (mipIndex >= cooked->numMips) { return false; }
+	const CookedTextureMip_t* mip = &cooked->mips[mipIndex];
+	const u8* mipData = &cooked->data[mip->dataOffset];
+	
+	ClearPointer(imageDataOut);
+	imageDataOut->size = mip->size;
+	imageDataOut->pixelSize = sizeof(u32);
+	imageDataOut->rowSize = (u64)mip->size.width * sizeof(u32);
+	imageDataOut->dataSize = imageDataOut->rowSize * (u64)mip->size.height;
+	imageDataOut->data8 = AllocArray(memArena, u8, imageDataOut->dataSize);
+	NotNull(imageDataOut->data8);
+	
+	if (cooked->format == TextureCompression_None)
+	{
+		MyMemCopy(imageDataOut->data8, mipData, imageDataOut->dataSize);
+		return true;
+	}
+	
+	u64 blockBytes = GetTextureCompressionBlockBytes(cooked->format);
+	i32 numBlocksX = (mip->size.width + TEXTURE_BLOCK_SIZE-1) / TEXTURE_BLOCK_SIZE;
+	i32 numBlocksY = (mip->size.height + TEXTURE_BLOCK_SIZE-1) / TEXTURE_BLOCK_SIZE;
+	u8 rgba[16*4];
+	const u8* blockPntr = mipData;
+	for (i32 blockY = 0; blockY < numBlocksY; blockY++)
+	{
+		for (i32 blockX = 0; blockX < numBlocksX; blockX++)
+		{
+			switch (cooked->format)
+			{
+				case TextureCompression_BC1: DecodeBc1Block(blockPntr, &rgba[0]); break;
+				case TextureCompression_BC3: DecodeBc3Block(blockPntr, &rgba[0]); break;
+				case TextureCompression_BC4: MyMemSet(&rgba[0], 0xFF, sizeof(rgba)); DecodeBc4Block(blockPntr, &rgba[3], 4); break;
+				case TextureCompression_BC7: DecodeBc7Block(blockPntr, &rgba[0]); break;
+				default: Unimplemented(); break;
+			}
+			for (i32 yOffset = 0; yOffset < TEXTURE_BLOCK_SIZE; yOffset++)
+			{
+				i32 pixelY = blockY*TEXTURE_BLOCK_SIZE + yOffset;
+				if (pixelY >= mip->size.height) { break; }
+				for (i32 xOffset = 0; xOffset < TEXTURE_BLOCK_SIZE; xOffset++)
+				{
+					i32 pixelX = blockX*TEXTURE_BLOCK_SIZE + xOffset;
+					if (pixelX >= mip->size.width) { break; }
+					MyMemCopy(&imageDataOut->data8[((u64)pixelY * imageDataOut->rowSize) + ((u64)pixelX * sizeof(u32))], &rgba[((yOffset * TEXTURE_BLOCK_SIZE) + xOffset) * 4], sizeof(u32));
+				}
+			}
+			blockPntr += blockBytes;
+		}
+	}
+	return true;
+}
+
+//NOTE: Peak signal-to-noise ratio across all 4 channels, in dB. Identical images return 99
+r64 CalcImagePsnr(const PlatImageData_t* left, const PlatImageData_t* right)
+{
+	NotNull2(left, right);
+	Assert(left->size == right->size);
+	Assert(left->pixelSize == sizeof(u32) && right->pixelSize == sizeof(u32));
+	u64 sumSquaredError = 0;
+	for (i32 yPos = 0; yPos < left->height; yPos++)
+	{
+		const u8* leftRow = &left->data8[(u64)yPos * left->rowSize];
+		const u8* rightRow = &right->data8[(u64)yPos * right->rowSize];
+		for (u64 bIndex = 0; bIndex < (u64)left->width * sizeof(u32); bIndex++)
+		{
+			i32 diff = (i32)leftRow[bIndex] - (i32)rightRow[bIndex];
+			sumSquaredError += (u64)(diff * diff);
+		}
+	}
+	if (sumSquaredError == 0) { return 99.0; }
+	r64 meanSquaredError = (r64)sumSquaredError / (r64)((u64)left->width * (u64)left->height * sizeof(u32));
+	return 10.0 * log10((255.0 * 255.0) / meanSquaredError);
+}
+
+//NOTE: 2x2 box filter. Odd sizes reuse the last row/column rather than reading past the edge
+void TexCompDownsampleRgba(const u8* srcPixels, v2i srcSize, u64 srcRowSize, u8* dstPixels, v2i dstSize)
+{
+	ImageDownsampleBox(srcPixels, srcSize, srcRowSize, dstPixels, dstSize);
+}
+
+void FreeCookedTexture(CookedTexture_t* cooked)
+{
+	NotNull(cooked);
+	if (cooked->allocArena != nullptr && cooked->data != nullptr)
+	{
+		FreeMem(cooked->allocArena, cooked->data, cooked->dataSize);
+	}
+	ClearPointer(cooked);
+}
+
+//NOTE: imageData must be RGBA8. The whole mip chain down to 1x1 is built on the CPU and encoded with the same format
+bool CookTexture(MemArena_t* memArena, const PlatImageData_t* imageData, TextureCompression_t format, bool generateMips, CookedTexture_t* cookedOut)
+{
+	NotNull3(memArena, imageData, cookedOut);
+	NotNull(imageData->data8);
+	Assert(format < TextureCompression_NumFormats);
+	if (imageData->pixelSize != sizeof(u32) || imageData->floatChannels) { return false; }
+	if (imageData->width <= 0 || imageData->height <= 0) { return false; }
+	
+	ClearPointer(cookedOut);
+	cookedOut->allocArena = memArena;
+	cookedOut->format = format;
+	cookedOut->size = imageData->size;
+	
+	v2i mipSize = imageData->size;
+	while (cookedOut->numMips < COOKED_TEXTURE_MAX_NUM_MIPS)
+	{
+		CookedTextureMip_t* mip = &cookedOut->mips[cookedOut->numMips];
+		mip->size = mipSize;
+		mip->dataOffset = cookedOut->dataSize;
+		mip->dataSize = GetCookedTextureMipDataSize(format, mipSize);
+		cookedOut->dataSize += mip->dataSize;
+		cookedOut->numMips++;
+		if (!generateMips || (mipSize.width == 1 && mipSize.height == 1)) { break; }
+		mipSize = NewVec2i(MaxI32(mipSize.width/2, 1), MaxI32(mipSize.height/2, 1));
+	}
+	
+	cookedOut->data = AllocArray(memArena, u8, cookedOut->dataSize);
+	if (cookedOut->data == nullptr) { ClearPointer(cookedOut); return false; }
+	
+	MemArena_t* scratch = GetScratchArena(memArena);
+	const u8* levelPixels = imageData->data8;
+	u64 levelRowSize = imageData->rowSize;
+	for (u64 mIndex = 0; mIndex < cookedOut->numMips; mIndex++)
+	{
+		const CookedTextureMip_t* mip = &cookedOut->mips[mIndex];
+		EncodeTextureLevel(format, levelPixels, mip->size, levelRowSize, &cookedOut->data[mip->dataOffset]);
+		if (mIndex+1 < cookedOut->numMips)
+		{
+			v2i nextSize = cookedOut->mips[mIndex+1].size;
+			u8* nextPixels = AllocArray(scratch, u8, (u64)nextSize.width * (u64)nextSize.height * sizeof(u32));
+			NotNull(nextPixels);
+			TexCompDownsampleRgba(levelPixels, mip->size, levelRowSize, nextPixels, nextSize);
+			levelPixels = nextPixels;
+			levelRowSize = (u64)nextSize.width * sizeof(u32);
+		}
+	}
+	FreeScratchArena(scratch);
+	
+	return true;
+}
+
+// +--------------------------------------------------------------+
+// |                       .ptex Container                        |
+// +--------------------------------------------------------------+
+u64 GetCookedTextureFileSize(const CookedTexture_t* cooked)
+{
+	NotNull(cooked);
+	return sizeof(CookedTextureFileHeader_t) + (cooked->numMips * sizeof(CookedTextureFileMip_t)) + cooked->dataSize;
+}
+
+u8* SerializeCookedTexture(const CookedTexture_t* cooked, MemArena_t* memArena, u64* fileSizeOut)
+{
+	NotNull3(cooked, memArena, fileSizeOut);
+	Assert(cooked->numMips > 0 && cooked->numMips <= COOKED_TEXTURE_MAX_NUM_MIPS);
+	u64 fileSize = GetCookedTextureFileSize(cooked);
+	u8* result = AllocArray(memArena, u8, fileSize);
+	if (result == nullptr) { return nullptr; }
+	
+	CookedTextureFileHeader_t* header = (CookedTextureFileHeader_t*)result;
+	ClearPointer(header);
+	MyMemCopy(&header->magic[0], COOKED_TEXTURE_MAGIC, sizeof(header->magic));
+	header->version = COOKED_TEXTURE_VERSION;
+	header->format = (u8)cooked->format;
+	header->width = (u32)cooked->size.width;
+	header->height = (u32)cooked->size.height;
+	header->numMips = (u32)cooked->numMips;
+	header->sourceSize = cooked->sourceSize;
+	header->sourceHash = cooked->sourceHash;
+	header->dataSize = cooked->dataSize;
+	
+	CookedTextureFileMip_t* fileMips = (CookedTextureFileMip_t*)(result + sizeof(CookedTextureFileHeader_t));
+	for (u64 mIndex = 0; mIndex < cooked->numMips; mIndex++)
+	{
+		fileMips[mIndex].width = (u32)cooked->mips[mIndex].size.width;
+		fileMips[mIndex].height = (u32)cooked->mips[mIndex].size.height;
+		fileMips[mIndex].dataOffset = cooked->mips[mIndex].dataOffset;
+		fileMips[mIndex].dataSize = cooked->mips[mIndex].dataSize;
+	}
+	MyMemCopy(result + sizeof(CookedTextureFileHeader_t) + (cooked->numMips * sizeof(CookedTextureFileMip_t)), cooked->data, cooked->dataSize);
+	
+	*fileSizeOut = fileSize;
+	return result;
+}
+
+//NOTE: Doesn't copy anything, cookedOut->data points into fileData so it has to stay alive (and mapped) until the upload is done
+bool DeserializeCookedTexture(const u8* fileData, u64 fileSize, CookedTexture_t* cookedOut)
+{
+	NotNull2(fileData, cookedOut);
+	ClearPointer(cookedOut);
+	if (fileSize < sizeof(CookedTextureFileHeader_t)) { return false; }
+	const CookedTextureFileHeader_t* header = (const CookedTextureFileHeader_t*)fileData;
+	if (MyMemCompare(&header->magic[0], COOKED_TEXTURE_MAGIC, sizeof(header->magic)) != 0) { return false; }
+	if (header->version != COOKED_TEXTURE_VERSION) { return false; }
+	if (header->format >= TextureCompression_NumFormats) { return false; }
+	if (header->numMips == 0 || header->numMips > COOKED_TEXTURE_MAX_NUM_MIPS) { return false; }
+	if (header->width == 0 || header->height == 0) { return false; }
+	u64 dataStart = sizeof(CookedTextureFileHeader_t) + ((u64)header->numMips * sizeof(CookedTextureFileMip_t));
+	if (fileSize != dataStart + header->dataSize) { return false; }
+	
+	cookedOut->allocArena = nullptr;
+	cookedOut->format = (TextureCompression_t)header->format;
+	cookedOut->size = NewVec2i((i32)header->width, (i32)header->height);
+	cookedOut->sourceSize = header->sourceSize;
+	cookedOut->sourceHash = header->sourceHash;
+	cookedOut->numMips = header->numMips;
+	cookedOut->dataSize = header->dataSize;
+	cookedOut->data = (u8*)(fileData + dataStart);
+	
+	const CookedTextureFileMip_t* fileMips = (const CookedTextureFileMip_t*)(fileData + sizeof(CookedTextureFileHeader_t));
+	for (u64 mIndex = 0; mIndex < cookedOut->numMips; mIndex++)
+	{
+		CookedTextureMip_t* mip = &cookedOut->mips[mIndex];
+		mip->size = NewVec2i((i32)fileMips[mIndex].width, (i32)fileMips[mIndex].height);
+		mip->dataOffset = fileMips[mIndex].dataOffset;
+		mip->dataSize = fileMips[mIndex].dataSize;
+		if (mip->dataSize != GetCookedTextureMipDataSize(cookedOut->format, mip->size) || mip->dataOffset + mip->dataSize > cookedOut->dataSize)
+		{
+			ClearPointer(cookedOut);
+			return false;
+		}
+	}
+	return true;
+}
+
+// +--------------------------------------------------------------+
+// |                       Round Trip Check                       |
+// +--------------------------------------------------------------+
+//NOTE: The top-left corner is a solid color that every format can store exactly (5:6:5 representable, even for BC7's shared p-bit).
+//      The rest is smooth gradients with a hard edge that doesn't line up with the block grid
+void FillTextureCompressionTestImage(TextureCompression_t format, PlatImageData_t* imageData)
+{
+	NotNull(imageData);
+	NotNull(imageData->data8);
+	for (i32 yPos = 0; yPos < imageData->height; yPos++)
+	{
+		for (i32 xPos = 0; xPos < imageData->width; xPos++)
+		{
+			u8* pixelPntr = &imageData->data8[((u64)yPos * imageData->rowSize) + ((u64)xPos * sizeof(u32))];
+			bool isSolid = (xPos < TEXTURE_COMPRESSION_TEST_SOLID_SIZE && yPos < TEXTURE_COMPRESSION_TEST_SOLID_SIZE);
+			bool pastEdge = (xPos >= TEXTURE_COMPRESSION_TEST_EDGE_POS);
+			if (format == TextureCompression_BC4)
+			{
+				pixelPntr[0] = 255;
+				pixelPntr[1] = 255;
+				pixelPntr[2] = 255;
+				pixelPntr[3] = (u8)(isSolid ? 94 : ((xPos + yPos) * 255) / (imageData->width + imageData->height - 2));
+				continue;
+			}
+			pixelPntr[0] = (u8)(isSolid ? 206 : (xPos * 255) / (imageData->width - 1));
+			pixelPntr[1] = (u8)(isSolid ? 162 : (yPos * 255) / (imageData->height - 1));
+			pixelPntr[2] = (u8)(isSolid ? 82 : (pastEdge ? 192 : 64));
+			if (format == TextureCompression_BC1) { pixelPntr[3] = 255; }
+			else { pixelPntr[3] = (u8)(isSolid ? 254 : (pastEdge ? 255 - (yPos * 4) : 32 + (yPos * 4))); }
+		}
+	}
+}
+
+//Lowest PSNR (in dB) the generated test image is allowed to decode at
+r64 GetTextureCompressionTestMinPsnr(TextureCompression_t format)
+{
+	switch (format)
+	{
+		case TextureCompression_None: return 99.0;
+		case TextureCompression_BC1:  return TEXTURE_COMPRESSION_TEST_MIN_PSNR_BC1;
+		case TextureCompression_BC3:  return TEXTURE_COMPRESSION_TEST_MIN_PSNR_BC3;
+		case TextureCompression_BC4:  return TEXTURE_COMPRESSION_TEST_MIN_PSNR_BC4;
+		case TextureCompression_BC7:  return TEXTURE_COMPRESSION_TEST_MIN_PSNR_BC7;
+		default: return 0.0;
+	}
+}
+
+//NOTE: Cooks a generated image, checks that cooking is deterministic, that the .ptex container round trips, that every
+//      mip decodes, that the solid corner comes back exactly and that the whole image stays above a minimum PSNR.
+//      Needs no files or GPU. Returns false and points failureOut at a description of the first check that failed
+bool TestTextureCompressionRoundTrip(TextureCompression_t format, r64* psnrOut, const char** failureOut)
+{
+	NotNull2(psnrOut, failureOut);
+	Assert(format < TextureCompression_NumFormats);
+	*psnrOut = 0.0;
+	*failureOut = nullptr;
+	MemArena_t* scratch = GetScratchArena();
+	
+	PlatImageData_t imageData = {};
+	imageData.size = NewVec2i(TEXTURE_COMPRESSION_TEST_SIZE, TEXTURE_COMPRESSION_TEST_SIZE);
+	imageData.pixelSize = sizeof(u32);
+	imageData.rowSize = (u64)imageData.width * sizeof(u32);
+	imageData.dataSize = imageData.rowSize * (u64)imageData.height;
+	imageData.data8 = AllocArray(scratch, u8, imageData.dataSize);
+	NotNull(imageData.data8);
+	FillTextureCompressionTestImage(format, &imageData);
+	
+	CookedTexture_t cooked = {};
+	CookedTexture_t cookedAgain = {};
+	if (!CookTexture(scratch, &imageData, format, true, &cooked)) { *failureOut = "CookTexture failed"; }
+	else if (!CookTexture(scratch, &imageData, format, true, &cookedAgain) || cookedAgain.dataSize != cooked.dataSize || MyMemCompare(cookedAgain.data, cooked.data, cooked.dataSize) != 0)
+	{
+		*failureOut = "Cooking the same image twice produced different data";
+	}
+	
+	if (*failureOut == nullptr && format == TextureCompression_BC7)
+	{
+		for (u64 bIndex = 0; bIndex < cooked.dataSize; bIndex += GetTextureCompressionBlockBytes(format))
+		{
+			if ((cooked.data[bIndex] & 0x7F) != 0x40) { *failureOut = "Found a BC7 block that isn't mode 6"; break; }
+		}
+	}
+	
+	if (*failureOut == nullptr)
+	{
+		u64 fileSize = 0;
+		u8* fileData = SerializeCookedTexture(&cooked, scratch, &fileSize);
+		CookedTexture_t loaded = {};
+		if (fileData == nullptr || fileSize != GetCookedTextureFileSize(&cooked)) { *failureOut = "SerializeCookedTexture failed"; }
+		else if (!DeserializeCookedTexture(fileData, fileSize, &loaded)) { *failureOut = "DeserializeCookedTexture rejected the file SerializeCookedTexture made"; }
+		else if (loaded.format != cooked.format || loaded.size != cooked.size || loaded.numMips != cooked.numMips ||
+			loaded.dataSize != cooked.dataSize || MyMemCompare(loaded.data, cooked.data, cooked.dataSize) != 0 ||
+			MyMemCompare(&loaded.mips[0], &cooked.mips[0], sizeof(CookedTextureMip_t) * cooked.numMips) != 0)
+		{
+			*failureOut = "The .ptex container didn't round trip";
+		}
+	}
+	
+	if (*failureOut == nullptr)
+	{
+		for (u64 mIndex = 0; mIndex < cooked.numMips; mIndex++)
+		{
+			PlatImageData_t decodedImage = {};
+			if (!DecodeCookedTextureMip(&cooked, mIndex, scratch, &decodedImage)) { *failureOut = "DecodeCookedTextureMip failed"; break; }
+			if (mIndex > 0) { continue; }
+			for (i32 yPos = 0; yPos < TEXTURE_COMPRESSION_TEST_SOLID_SIZE && *failureOut == nullptr; yPos++)
+			{
+				u64 rowOffset = (u64)yPos * imageData.rowSize;
+				if (MyMemCompare(&decodedImage.data8[rowOffset], &imageData.data8[rowOffset], TEXTURE_COMPRESSION_TEST_SOLID_SIZE * sizeof(u32)) != 0)
+				{
+					*failureOut = "The solid corner didn't decode exactly";
+				}
+			}
+			*psnrOut = CalcImagePsnr(&imageData, &decodedImage);
+		}
+	}
+	
+	if (*failureOut == nullptr && *psnrOut < GetTextureCompressionTestMinPsnr(format)) { *failureOut = "The decoded image is below the minimum PSNR"; }
+	
+	FreeScratchArena(scratch);
+	return (*failureOut == nullptr);
+}
@@ -0,0 +1,98 @@
+/*
+File:   pig_texture_compression.h
+Date:   10\19\2026
+Description:
+	** Textures can be "cooked" into a block compressed (BC1/BC3/BC4/BC7) mip chain and saved under
+	** COOKED_TEXTURE_FOLDER in a small versioned container (.ptex). Loading a cooked texture skips the image
+	** decode and mipmap generation entirely and uploads the blocks straight to the GPU.
+	** Everything in pig_texture_compression.cpp is CPU only so it can be run and checked without a render context
+*/
+
+#ifndef _PIG_TEXTURE_COMPRESSION_H
+#define _PIG_TEXTURE_COMPRESSION_H
+
+#define COOKED_TEXTURE_MAGIC          "PTEX"
+#define COOKED_TEXTURE_VERSION        1
+#define COOKED_TEXTURE_FILE_EXTENSION ".ptex"
+#define COOKED_TEXTURE_FOLDER         "Cooked/" //mirrors the source path so generated files never land in Resources (or in a pack built from it)
+#define COOKED_TEXTURE_MAX_NUM_MIPS   16 //enough for a 32768x32768 texture
+
+#define TEXTURE_BLOCK_SIZE            4 //pixels, all BCn formats work on 4x4 blocks
+
+#define TEXTURE_COMPRESSION_TEST_SIZE         32 //px, see TestTextureCompressionRoundTrip
+#define TEXTURE_COMPRESSION_TEST_SOLID_SIZE   8 //px, the solid top-left corner that has to decode exactly
+#define TEXTURE_COMPRESSION_TEST_EDGE_POS     18 //px, x position of the hard edge (not on a block boundary)
+#define TEXTURE_COMPRESSION_TEST_MIN_PSNR_BC1 30.0 //dB, the current encoders land around 33
+#define TEXTURE_COMPRESSION_TEST_MIN_PSNR_BC3 30.0 //dB, around 33
+#define TEXTURE_COMPRESSION_TEST_MIN_PSNR_BC4 45.0 //dB, around 53
+#define TEXTURE_COMPRESSION_TEST_MIN_PSNR_BC7 30.0 //dB, around 33 (mode 6 only)
+
+enum TextureCompression_t
+{
+	TextureCompression_None = 0, //raw RGBA8, still gets the precomputed mip chain
+	TextureCompression_BC1,      //RGB 5:6:5 endpoints, 8 bytes per block. Used for opaque textures
+	TextureCompression_BC3,      //BC1 color + BC4 alpha, 16 bytes per block. Used for textures with smooth alpha
+	TextureCompression_BC4,      //single channel, 8 bytes per block. Used for white textures where only alpha matters
+	TextureCompression_BC7,      //RGBA, 16 bytes per block. Used for high quality textures (we only encode mode 6)
+	TextureCompression_NumFormats,
+};
+const char* GetTextureCompressionStr(TextureCompression_t format)
+{
+	switch (format)
+	{
+		case TextureCompression_None: return "None";
+		case TextureCompression_BC1:  return "BC1";
+		case TextureCompression_BC3:  return "BC3";
+		case TextureCompression_BC4:  return "BC4";
+		case TextureCompression_BC7:  return "BC7";
+		default: return "Unknown";
+	}
+}
+
+struct CookedTextureMip_t
+{
+	v2i size;
+	u64 dataOffset; //from the start of CookedTexture_t data
+	u64 dataSize;
+};
+
+struct CookedTexture_t
+{
+	MemArena_t* allocArena; //nullptr if data points into memory we don't own (like a mapped file)
+	TextureCompression_t format;
+	v2i size;
+	u64 sourceSize; //size of the image file this was cooked from
+	u64 sourceHash; //FnvHashU64 of the image file this was cooked from
+	
+	u64 numMips;
+	CookedTextureMip_t mips[COOKED_TEXTURE_MAX_NUM_MIPS];
+	
+	u64 dataSize;
+	u8* data;
+};
+
+//NOTE: A .ptex file is this header, followed by numMips CookedTextureFileMip_t, followed by the block data for every mip
+START_PACK()
+struct ATTR_PACKED CookedTextureFileHeader_t
+{
+	char magic[4]; //COOKED_TEXTURE_MAGIC
+	u32 version; //COOKED_TEXTURE_VERSION
+	u8 format; //TextureCompression_t
+	u8 reserved[3];
+	u32 width;
+	u32 height;
+	u32 numMips;
+	u64 sourceSize;
+	u64 sourceHash;
+	u64 dataSize;
+};
+struct ATTR_PACKED CookedTextureFileMip_t
+{
+	u32 width;
+	u32 height;
+	u64 dataOffset;
+	u64 dataSize;
+};
+END_PACK()
+
+#endif //  _PIG_TEXTURE_COMPRESSION_H
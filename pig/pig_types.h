@@ -349,16 +349,53 @@ struct PigNotificationQueue_t
 	v2 notificationsSize;
 };
 
+enum PigSettingsCacheType_t
+{
+	PigSettingsCacheType_None = 0,
+	PigSettingsCacheType_Bool,
+	PigSettingsCacheType_R32,
+	PigSettingsCacheType_U64,
+	PigSettingsCacheType_V2,
+	PigSettingsCacheType_V3,
+	PigSettingsCacheType_V2i,
+	PigSettingsCacheType_NumTypes,
+};
+
+//The last typed read of an entry's value (including parse failures), kept until the value changes
+struct PigSettingsCache_t
+{
+	PigSettingsCacheType_t type;
+	bool parseSuccess;
+	TryParseFailureReason_t failureReason;
+	union
+	{
+		bool boolValue;
+		r32 r32Value;
+		u64 u64Value;
+		v2 v2Value;
+		v3 v3Value;
+		v2i v2iValue;
+	};
+};
+
 struct PigSettingsEntry_t
 {
 	MyStr_t key;
 	MyStr_t value;
+	u64 keyHash; //case-insensitive, see PigHashSettingKey
+	//NOTE: The typed PigTryGetSetting functions take a const PigSettings_t* and still fill this in, so reading
+	//      settings isn't thread safe (same as the rest of PigSettings_t, it's only touched from the main thread)
+	mutable PigSettingsCache_t cache;
 };
 
 struct PigSettings_t
 {
 	MemArena_t* allocArena;
 	VarArray_t entries; // PigSettingsEntry_t
+	
+	//Open addressing hash table over entries, each slot is 0 (empty) or an entry index+1. Lookups fall back to a linear search if indexSlots is nullptr
+	u64 indexCapacity; //always a power of 2
+	u32* indexSlots;
 };
 
 enum PigDebugBindingType_t
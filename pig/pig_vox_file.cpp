@@ -773,17 +773,16 @@ bool TryDeserVoxFile(MyStr_t voxFileContents, ProcessLog_t* log, VoxFrameSet_t*
 
 bool TryLoadVoxFrameSet(MyStr_t filePath, MemArena_t* memArena, VoxFrameSet_t* frameSetOut)
 {
-	PlatFileContents_t voxFile = {};
-	MemArena_t* scratch = GetScratchArena();
-	if (!plat->ReadFileContents(filePath, scratch, false, &voxFile))
+	PlatMappedFile_t voxFile = {};
+	if (!plat->MapFile(filePath, &voxFile))
 	{
 		PrintLine_E("Failed to open \"%.*s\"", StrPrint(filePath));
-		FreeScratchArena(scratch);
 		frameSetOut->error = Result_CouldntOpenFile;
 		return false;
 	}
+	MemArena_t* scratch = GetScratchArena();
 	
-	MyStr_t voxFileContents = NewStr(voxFile.size, voxFile.chars);
+	MyStr_t voxFileContents = NewStr(voxFile.size, (char*)voxFile.chars);
 	ProcessLog_t deserLog;
 	CreateProcessLog(&deserLog, Megabytes(1), scratch, mainHeap);
 	
@@ -802,5 +801,6 @@ bool TryLoadVoxFrameSet(MyStr_t filePath, MemArena_t* memArena, VoxFrameSet_t* f
 	}
 	
 	FreeScratchArena(scratch);
+	plat->UnmapFile(&voxFile);
 	return deserSuccess;
 }
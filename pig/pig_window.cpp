@@ -114,10 +114,29 @@ void Pig_StartGifRecordingSub(reci subPartRec)
 {
 	NotNull2(pig->currentWindow, pig->currentWindowState);
 	Assert(!pig->currentWindowState->recordingGif);
+	PigGifEncoder_t* encoder = &pig->currentWindowState->gifEncoder;
+	if (encoder->active)
+	{
+		NotifyWrite_W("Still saving the previous GIF, try again in a moment");
+		return;
+	}
+	
+	ClearPointer(encoder);
+	//TODO: Move the output folder to a user directory like Documents
+	encoder->filePath = PrintInArenaStr(mainHeap, "recording_%04u-%02u-%02u_%02u-%02u-%02u.gif", pigIn->localTime.year, pigIn->localTime.month+1, pigIn->localTime.day+1, pigIn->localTime.hour, pigIn->localTime.minute, pigIn->localTime.second);
+	if (!plat->OpenFile(encoder->filePath, OpenFileMode_Write, false, &encoder->file))
+	{
+		NotifyPrint_E("Failed to open \"%.*s\" for writing GIF", StrPrint(encoder->filePath));
+		FreeString(mainHeap, &encoder->filePath);
+		return;
+	}
+	encoder->active = true;
+	encoder->size = subPartRec.size;
+	encoder->startTime = GetPerfTime();
+	
 	pig->currentWindowState->recordingGif = true;
 	pig->currentWindowState->finishGif = false;
 	pig->currentWindowState->screenSubPart = subPartRec;
-	CreateLinkedList(&pig->currentWindowState->gifFrames, platInfo->stdHeap, PigGifFrame_t);
 }
 void Pig_StartGifRecording()
 {
@@ -197,79 +216,253 @@ void Pig_HandleScreenshotHotkeys()
 	if (KeyDownRaw(Key_F4) || KeyReleasedRaw(Key_F4)) { HandleKey(Key_F4); }
 }
 
+// +--------------------------------------------------------------+
+// |                         Screenshots                          |
+// +--------------------------------------------------------------+
+//NOTE: Called on the main thread once the PigTask_SaveScreenshot task completes (or right away if it couldn't be queued)
+void Pig_HandleScreenshotSaved(bool success, MyStr_t filePath, PlatImageData_t* imageData, u64 fileSize)
+{
+	NotNull(imageData);
+	if (success)
+	{
+		PrintLine_I("Saved screenshot %dx%d (%llu bytes) to %.*s", imageData->width, imageData->height, fileSize, StrPrint(filePath));
+	}
+	else
+	{
+		NotifyPrint_E("Failed to save screenshot to %.*s!", StrPrint(filePath));
+	}
+	if (imageData->data8 != nullptr)
+	{
+		FreeMem(imageData->allocArena, imageData->data8, imageData->dataSize);
+		imageData->data8 = nullptr;
+	}
+}
+
+//NOTE: Only the read back from the frameBuffer happens here, PNG encoding and writing the file happen on the thread pool
 void Pig_SaveScreenshot(FrameBuffer_t* frameBuffer, reci subPartRec, MyStr_t filePath)
 {
 	NotNull(frameBuffer);
-	PlatImageData_t imageData = {};
-	if (GetTextureDataSubPart(&frameBuffer->outTexture, subPartRec, &pig->largeAllocHeap, &imageData))
+	PlatImageData_t* imageData = AllocStruct(platInfo->stdHeap, PlatImageData_t);
+	NotNull(imageData);
+	ClearPointer(imageData);
+	if (!GetTextureDataSubPart(&frameBuffer->outTexture, subPartRec, platInfo->stdHeap, imageData))
 	{
-		if (plat->SaveImageDataToFile(filePath, &imageData, PlatImageFormat_Png, nullptr))
+		NotifyWrite_E("Failed to take screenshot!");
+		FreeMem(platInfo->stdHeap, imageData, sizeof(PlatImageData_t));
+		return;
+	}
+	
+	PlatTaskInput_t taskInput = {};
+	taskInput.type = PigTask_SaveScreenshot;
+	
+	taskInput.inputStr = AllocString(mainHeap, &filePath);
+	taskInput.inputStrArena = mainHeap;
+	
+	taskInput.inputSize1 = sizeof(PlatImageData_t);
+	taskInput.inputPntr1 = imageData;
+	taskInput.inputArena1 = platInfo->stdHeap;
+	
+	if (plat->QueueTask(&taskInput) == nullptr)
+	{
+		u64 fileSize = 0;
+		bool success = plat->SaveImageDataToFile(filePath, imageData, PlatImageFormat_Png, &fileSize);
+		Pig_HandleScreenshotSaved(success, filePath, imageData, fileSize);
+		FreeString(mainHeap, &taskInput.inputStr);
+		FreeMem(platInfo->stdHeap, imageData, sizeof(PlatImageData_t));
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                         GIF Encoding                         |
+// +--------------------------------------------------------------+
+//NOTE: Every frame is encoded by msf_gif as a complete single frame GIF. This finds the part after
+//      the header ("GIF89a", screen descriptor, global color table, application extensions) and
+//      before the 0x3B trailer, which is the graphic control extension and image data for that frame
+bool Pig_FindGifFrameBlocks(const u8* gifData, u64 gifSize, u64* offsetOut, u64* sizeOut)
+{
+	NotNull3(gifData, offsetOut, sizeOut);
+	u64 offset = 6 + 7; //signature + logical screen descriptor
+	if (gifSize <= offset || MyMemCompare(gifData, "GIF89a", 6) != 0) { return false; }
+	u8 screenFlags = gifData[10];
+	if (IsFlagSet(screenFlags, 0x80)) { offset += 3 * (2ULL << (screenFlags & 0x07)); }
+	while (offset + 2 <= gifSize && gifData[offset] == 0x21 && gifData[offset+1] == 0xFF)
+	{
+		offset += 2;
+		while (offset < gifSize && gifData[offset] != 0x00) { offset += 1 + gifData[offset]; }
+		offset++; //block terminator
+	}
+	if (offset >= gifSize || gifData[gifSize-1] != 0x3B) { return false; }
+	*offsetOut = offset;
+	*sizeOut = (gifSize - 1) - offset;
+	return true;
+}
+
+//NOTE: This function runs on a thread pool thread
+bool Pig_EncodeGifFrame(PigGifFrame_t* frame)
+{
+	NotNull(frame);
+	NotNull(frame->imageData.data8);
+	MsfGifState msfState = {};
+	if (msf_gif_begin(&msfState, frame->imageData.width, frame->imageData.height) == 0) { return false; }
+	int frameResult = msf_gif_frame(&msfState, frame->imageData.data8, frame->centiseconds, frame->imageData.pixelSize*8, (int)frame->imageData.rowSize);
+	frame->result = msf_gif_end(&msfState);
+	FreeMem(frame->imageData.allocArena, frame->imageData.data8, frame->imageData.dataSize);
+	frame->imageData.data8 = nullptr;
+	return (frameResult != 0 && frame->result.data != nullptr);
+}
+
+void Pig_WriteGifBytes(PigGifEncoder_t* encoder, u64 numBytes, const void* bytesPntr)
+{
+	NotNull(encoder);
+	if (encoder->writeFailed || numBytes == 0) { return; }
+	if (plat->WriteToFile(&encoder->file, numBytes, bytesPntr, false)) { encoder->numBytesWritten += numBytes; }
+	else { encoder->writeFailed = true; }
+}
+
+void Pig_CloseGifEncoder(PigGifEncoder_t* encoder)
+{
+	NotNull(encoder);
+	Assert(encoder->active);
+	Assert(encoder->nextWriteIndex == encoder->numFramesCaptured);
+	
+	if (encoder->numBytesWritten > 0)
+	{
+		u8 trailer = 0x3B;
+		Pig_WriteGifBytes(encoder, sizeof(trailer), &trailer);
+	}
+	plat->CloseFile(&encoder->file);
+	
+	PerfTime_t endTime = GetPerfTime();
+	MemArena_t* scratch = GetScratchArena();
+	PrintLine_I("Uncompressed data for GIF was %s, finished %.0lfms after recording started", FormatBytesNt(encoder->rawBytesCaptured, scratch), GetPerfTimeDiff(&encoder->startTime, &endTime));
+	if (encoder->numFramesDropped > 0)
+	{
+		PrintLine_W("Dropped %llu GIF frame%s because the encoder fell behind", encoder->numFramesDropped, Plural(encoder->numFramesDropped, "s"));
+	}
+	if (!encoder->writeFailed && encoder->numFramesWritten > 0)
+	{
+		NotifyPrint_I("Saved %llu frame %dx%d resolution %s GIF to \"%.*s\"", encoder->numFramesWritten, encoder->size.width, encoder->size.height, FormatBytesNt(encoder->numBytesWritten, scratch), StrPrint(encoder->filePath));
+	}
+	else
+	{
+		NotifyPrint_E("Failed to save %s GIF data to \"%.*s\"", FormatBytesNt(encoder->numBytesWritten, scratch), StrPrint(encoder->filePath));
+	}
+	FreeScratchArena(scratch);
+	
+	FreeString(mainHeap, &encoder->filePath);
+	ClearPointer(encoder);
+}
+
+//Writes out all the frames that have finished encoding, stopping at the first one that is still in flight so the file stays in order
+void Pig_WriteFinishedGifFrames(PigGifEncoder_t* encoder)
+{
+	NotNull(encoder);
+	Assert(encoder->active);
+	while (encoder->nextWriteIndex < encoder->numFramesCaptured)
+	{
+		u64 slotIndex = (encoder->nextWriteIndex % GIF_MAX_FRAMES_IN_FLIGHT);
+		PigGifFrame_t* frame = encoder->frames[slotIndex];
+		NotNull(frame);
+		if (!frame->finished) { break; }
+		
+		u64 blocksOffset = 0;
+		u64 blocksSize = 0;
+		if (frame->success && Pig_FindGifFrameBlocks((const u8*)frame->result.data, frame->result.dataSize, &blocksOffset, &blocksSize))
 		{
-			PrintLine_I("Saved screenshot %dx%d (%llu bytes) to %.*s", imageData.width, imageData.height, imageData.dataSize, StrPrint(filePath));
+			//The header from the first frame we write out is used for the whole file
+			if (encoder->numBytesWritten == 0) { Pig_WriteGifBytes(encoder, blocksOffset, frame->result.data); }
+			Pig_WriteGifBytes(encoder, blocksSize, (const u8*)frame->result.data + blocksOffset);
+			encoder->numFramesWritten++;
 		}
 		else
 		{
-			NotifyPrint_E("Failed to save screenshot to %.*s!", StrPrint(filePath));
+			PrintLine_W("Failed to encode GIF frame %llu", frame->index);
 		}
-		FreeMem(&pig->largeAllocHeap, imageData.data8, imageData.dataSize);
+		
+		if (frame->result.data != nullptr) { msf_gif_free(frame->result); }
+		FreeMem(platInfo->stdHeap, frame, sizeof(PigGifFrame_t));
+		encoder->frames[slotIndex] = nullptr;
+		encoder->nextWriteIndex++;
+	}
+	
+	if (encoder->finishing && encoder->nextWriteIndex == encoder->numFramesCaptured)
+	{
+		Pig_CloseGifEncoder(encoder);
+	}
+}
+
+//NOTE: Called on the main thread when a PigTask_EncodeGifFrame task completes
+void Pig_HandleGifFrameEncoded(PigGifFrame_t* frame, bool success)
+{
+	NotNull(frame);
+	frame->finished = true;
+	frame->success = success;
+	PigWindowState_t* windowState = GetWindowStateById(frame->windowId);
+	if (windowState != nullptr && windowState->gifEncoder.active)
+	{
+		Pig_WriteFinishedGifFrames(&windowState->gifEncoder);
 	}
 	else
 	{
-		NotifyWrite_E("Failed to take screenshot!");
+		if (frame->result.data != nullptr) { msf_gif_free(frame->result); }
+		FreeMem(platInfo->stdHeap, frame, sizeof(PigGifFrame_t));
 	}
 }
 
-void Pig_StoreGifFrame(FrameBuffer_t* frameBuffer, reci subPartRec, LinkedList_t* frames)
+//NOTE: If too many frames are already waiting on the encoder we drop this frame and add its
+//      time onto the next frame that does get captured so the GIF still plays back at the right speed
+void Pig_StoreGifFrame(PigWindowState_t* state)
 {
-	NotNull(frameBuffer);
-	NotNull(frames);
-	Assert(frames->itemSize == sizeof(PigGifFrame_t));
+	NotNull(state);
+	PigGifEncoder_t* encoder = &state->gifEncoder;
+	Assert(encoder->active && !encoder->finishing);
+	
+	u16 frameCentiseconds = (u16)(100 / GIF_FRAMERATE);
+	if (encoder->numFramesCaptured - encoder->nextWriteIndex >= GIF_MAX_FRAMES_IN_FLIGHT)
+	{
+		encoder->numFramesDropped++;
+		encoder->droppedCentiseconds += frameCentiseconds;
+		return;
+	}
 	
-	PigGifFrame_t* newFrame = LinkedListAdd(frames, PigGifFrame_t);
+	PigGifFrame_t* newFrame = AllocStruct(platInfo->stdHeap, PigGifFrame_t);
 	NotNull(newFrame);
 	ClearPointer(newFrame);
+	newFrame->windowId = state->windowId;
+	newFrame->index = encoder->numFramesCaptured;
+	newFrame->centiseconds = frameCentiseconds + encoder->droppedCentiseconds;
 	
-	if (!GetTextureDataSubPart(&frameBuffer->outTexture, subPartRec, platInfo->stdHeap, &newFrame->imageData))
+	if (!GetTextureDataSubPart(&state->frameBuffer.outTexture, state->screenSubPart, platInfo->stdHeap, &newFrame->imageData))
 	{
 		DebugAssert(false);//TODO: What should we do in case of frame get failure?
+		FreeMem(platInfo->stdHeap, newFrame, sizeof(PigGifFrame_t));
+		encoder->numFramesDropped++;
+		encoder->droppedCentiseconds += frameCentiseconds;
+		return;
 	}
-}
-void Pig_SaveGif(LinkedList_t* frames, MyStr_t filePath)
-{
-	NotNull(frames);
-	PrintLine_I("Finishing GIF with %llu frames", pig->currentWindowState->gifFrames.count);
-	v2i gifSize = pig->currentWindowState->screenSubPart.size;
-	MsfGifState msfState = {};
-	int beginResult = msf_gif_begin(&msfState, gifSize.width, gifSize.height);
-	Assert(beginResult != 0);
-	PigGifFrame_t* frame = LinkedListFirst(&pig->currentWindowState->gifFrames, PigGifFrame_t);
-	u64 totalImageDataSize = 0;
-	u64 totalNumFrames = 0;
-	while (frame != nullptr)
-	{
-		int frameResult = msf_gif_frame(&msfState, frame->imageData.data8, 2, frame->imageData.pixelSize*8, (int)frame->imageData.rowSize);
-		Assert(frameResult != 0);
-		totalImageDataSize += frame->imageData.dataSize;
-		totalNumFrames++;
-		FreeMem(frame->imageData.allocArena, frame->imageData.data8, frame->imageData.dataSize);
-		frame = LinkedListNext(frames, PigGifFrame_t, frame);
-	}
+	u64 frameDataSize = newFrame->imageData.dataSize;
 	
-	MsfGifResult gifResult = msf_gif_end(&msfState);
-	NotNull(gifResult.data);
-	PrintLine_I("Uncompressed data for GIF was %s", FormatBytesNt(totalImageDataSize, TempArena));
-	PrintLine_I("Output GIF is %s", FormatBytesNt(gifResult.dataSize, TempArena));
+	PlatTaskInput_t taskInput = {};
+	taskInput.type = PigTask_EncodeGifFrame;
+	taskInput.id = newFrame->index;
+	taskInput.inputSize1 = sizeof(PigGifFrame_t);
+	taskInput.inputPntr1 = newFrame;
 	
-	if (plat->WriteEntireFile(filePath, gifResult.data, gifResult.dataSize))
-	{
-		NotifyPrint_I("Saved %llu frame %dx%d resolution %s GIF to \"%.*s\"", totalNumFrames, gifSize.width, gifSize.height, FormatBytesNt(gifResult.dataSize, TempArena), StrPrint(filePath));
-	}
-	else
+	encoder->frames[newFrame->index % GIF_MAX_FRAMES_IN_FLIGHT] = newFrame;
+	encoder->numFramesCaptured++;
+	if (plat->QueueTask(&taskInput) == nullptr)
 	{
-		NotifyPrint_E("Failed to save %s GIF data to \"%.*s\"", FormatBytesNt(gifResult.dataSize, TempArena), StrPrint(filePath));
+		//The thread pool's queue is full, treat it the same as the encoder falling behind
+		encoder->numFramesCaptured--;
+		encoder->frames[newFrame->index % GIF_MAX_FRAMES_IN_FLIGHT] = nullptr;
+		FreeMem(newFrame->imageData.allocArena, newFrame->imageData.data8, newFrame->imageData.dataSize);
+		FreeMem(platInfo->stdHeap, newFrame, sizeof(PigGifFrame_t));
+		encoder->numFramesDropped++;
+		encoder->droppedCentiseconds += frameCentiseconds;
+		return;
 	}
-	
-	FreeLinkedList(&pig->currentWindowState->gifFrames);
+	encoder->rawBytesCaptured += frameDataSize;
+	encoder->droppedCentiseconds = 0;
 }
 
 void Pig_UpdateCaptureHandling(const PlatWindow_t* window, PigWindowState_t* state)
@@ -289,22 +482,18 @@ void Pig_UpdateCaptureHandling(const PlatWindow_t* window, PigWindowState_t* sta
 	
 	if (state->recordingGif)
 	{
-		Pig_StoreGifFrame(&state->frameBuffer, state->screenSubPart, &state->gifFrames);
+		Pig_StoreGifFrame(state);
 		
-		u64 gifFrameSize = state->screenSubPart.width * state->screenSubPart.height * sizeof(u32);
-		if (state->gifFrames.count * gifFrameSize >= MAX_GIF_SIZE) { state->finishGif = true; }
+		if (state->gifEncoder.numBytesWritten >= MAX_GIF_SIZE) { state->finishGif = true; }
 		
 		if (state->finishGif)
 		{
-			TempPushMark();
-			MyStr_t outputFilePath = TempPrintStr("recording_%04u-%02u-%02u_%02u-%02u-%02u.gif", pigIn->localTime.year, pigIn->localTime.month+1, pigIn->localTime.day+1, pigIn->localTime.hour, pigIn->localTime.minute, pigIn->localTime.second);
-			Pig_SaveGif(&state->gifFrames, outputFilePath);
-			pig->currentWindowState->recordingGif = false;
-			TempPopMark();
+			PrintLine_I("Finishing GIF with %llu frames (%llu still encoding)", state->gifEncoder.numFramesCaptured, state->gifEncoder.numFramesCaptured - state->gifEncoder.nextWriteIndex);
+			state->gifEncoder.finishing = true;
+			state->recordingGif = false;
+			Pig_WriteFinishedGifFrames(&state->gifEncoder);
 		}
 	}
-	
-	
 }
 
 void Pig_UpdateWindowStates()
@@ -142,7 +142,13 @@ typedef PLAT_API_SEEK_TO_OFFSET_IN_FILE_DEFINITION(PlatApiSeekToOffsetInFile_f);
 #define PLAT_API_CLOSE_FILE_DEFINITION(functionName) void functionName(PlatOpenFile_t* openFile)
 typedef PLAT_API_CLOSE_FILE_DEFINITION(PlatApiCloseFile_f);
 
-#define PLAT_API_TRY_PARSE_IMAGE_FILE_DEF(functionName) bool functionName(const PlatFileContents_t* contents, u8 desiredPixelSize, PlatImageData_t* imageOut)
+#define PLAT_API_MAP_FILE_DEF(functionName) bool functionName(MyStr_t filePath, PlatMappedFile_t* mappedFileOut)
+typedef PLAT_API_MAP_FILE_DEF(PlatApiMapFile_f);
+
+#define PLAT_API_UNMAP_FILE_DEF(functionName) void functionName(PlatMappedFile_t* mappedFile)
+typedef PLAT_API_UNMAP_FILE_DEF(PlatApiUnmapFile_f);
+
+#define PLAT_API_TRY_PARSE_IMAGE_FILE_DEF(functionName) bool functionName(u64 fileSize, const void* filePntr, u8 desiredPixelSize, PlatImageData_t* imageOut)
 typedef PLAT_API_TRY_PARSE_IMAGE_FILE_DEF(PlatApiTryParseImageFile_f);
 
 #define PLAT_API_SAVE_IMAGE_DATA_TO_FILE(functionName) bool functionName(MyStr_t filePath, const PlatImageData_t* imageData, PlatImageFormat_t imageFormat, u64* fileSizeOut)
@@ -30,7 +30,8 @@ Date:   01\14\2022
 
 #define SDL_CONTROLLER_DB_PATH "Resources/Text/gamecontrollerdb.txt"
 
-#define FILE_WATCHING_SLEEP_TIME   50 //ms
-#define FILE_WATCHING_NOTIFY_DELAY 300 //ms
+#define FILE_WATCHING_NOTIFY_DELAY  300 //ms (changes are coalesced until a file has been quiet for this long)
+#define FILE_WATCHING_BUFFER_SIZE   Kilobytes(16) //bytes (per watched folder)
+#define FILE_WATCHING_NUM_BUCKETS   4096 //must be power of 2
 
 #endif //  _COMMON_DEFINES_H
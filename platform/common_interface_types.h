@@ -86,6 +86,17 @@ struct StartupOptions_t
 	u64 threadPoolScratchArenasNumMarks;
 };
 
+struct PlatFileWatchingStats_t
+{
+	u64 numWatchedFiles;
+	u64 numWatchedFolders;
+	u64 numWakeups; //number of times the file watching thread woke up for any reason
+	u64 numNotifications; //raw notifications from the OS, before they are matched to watched files
+	u64 numChangesDelivered; //number of times we set the changed flag on a PlatWatchedFile_t
+	u64 numOverflows; //number of times the OS buffer overflowed and we had to mark a whole folder as changed
+	r64 threadCpuTime; //ms
+};
+
 struct PlatformInfo_t
 {
 	PlatType_t type;
@@ -109,6 +120,7 @@ struct PlatformInfo_t
 	
 	PlatThreadIdPair_t mainThreadId;
 	PlatThreadIdPair_t fileWatchingThreadId;
+	const PlatFileWatchingStats_t* fileWatchingStats;
 	PlatThreadIdPair_t audioThreadId;
 	u64 numThreadPoolThreads;
 	PlatThreadIdPair_t threadPoolIds[PLAT_MAX_THREADPOOL_SIZE];
@@ -172,6 +184,8 @@ struct PlatformApi_t
 	PlatApiCloseFile_f*                  CloseFile;
 	PlatApiReadFileContentsStream_f*     ReadFileContentsStream;
 	PlatApiOpenFileStream_f*             OpenFileStream;
+	PlatApiMapFile_f*                    MapFile;
+	PlatApiUnmapFile_f*                  UnmapFile;
 	PlatApiTryParseImageFile_f*          TryParseImageFile;
 	PlatApiSaveImageDataToFile_f*        SaveImageDataToFile;
 	PlatApiFreeImageData_f*              FreeImageData;
@@ -371,6 +385,8 @@ struct EngineInput_t
 	v2 scrollValue;
 	v2 scrollDelta;
 	
+	u64 numWatchedFileChanges; //running total, if this hasn't changed since last frame then no PlatWatchedFile_t has its changed flag set
+	
 	//Debug
 	#if DEVELOPER_BUILD
 	u64 numAudioFrameDrops;
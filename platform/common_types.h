@@ -222,6 +222,7 @@ struct PlatFontCharData_t
 	v2 offset;
 	v2 offset2;
 	r32 advanceX;
+	bool isNotdef; //the font has no glyph for this codepoint, so what got baked is the font's .notdef glyph
 };
 struct PlatFontData_t
 {
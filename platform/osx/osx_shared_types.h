@@ -38,6 +38,24 @@ struct PlatOpenFile_t
 	// HANDLE handle; //TODO: Implement me!
 };
 
+struct PlatMappedFile_t
+{
+	u64 id;
+	bool isOpen;
+	union
+	{
+		u64 size;
+		u64 length;
+	};
+	union
+	{
+		const u8* data;
+		const char* chars;
+	};
+	
+	// int fileDescriptor; //TODO: Implement me!
+};
+
 struct PlatWatchedFile_t
 {
 	u64 id;
@@ -56,6 +56,22 @@ struct PlatOpenFile_t //NOT SUPPORTED
 	int placeholder; //TODO: Add handle here once support is finished
 };
 
+struct PlatMappedFile_t //NOT SUPPORTED
+{
+	u64 id;
+	bool isOpen;
+	union
+	{
+		u64 size;
+		u64 length;
+	};
+	union
+	{
+		const u8* data;
+		const char* chars;
+	};
+};
+
 // +--------------------------------------------------------------+
 // |                           Threads                            |
 // +--------------------------------------------------------------+
@@ -559,6 +559,7 @@ void Win32_FillAudioBufferToMeetTargetFill()
 THREAD_FUNCTION_DEF(Win32_AudioThreadFunc, userPntr) //pre-declared at top of file
 {
 	UNUSED(userPntr);
+	Win32_BindThisThread(false, nullptr);
 	WriteLine_I("Audio thread is starting...");
 	while (InitPhase < Win32InitPhase_Closing)
 	{
@@ -4,8 +4,16 @@ Author: Taylor Robbins
 Date:   09\27\2021
 Description: 
 	** Holds functions that help us track file changes and send out notifications of various sorts
+	** We ask the OS to tell us about changes in each folder that contains a watched file (ReadDirectoryChangesW)
+	** and the watching thread sleeps on an IO completion port until one of those requests completes.
+	** Notifications are matched to watched files through a hash table, debounced, and then
+	** delivered all at once on the main thread in Win32_UpdateFileWatching
 */
 
+#define FILE_WATCHING_WAKEUP_KEY 0 //completion key used to poke the watching thread when a new folder needs a request issued
+
+#define FILE_WATCHING_NOTIFY_FILTER (FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_CREATION)
+
 THREAD_FUNCTION_DEF(Win32_FileWatchingThreadFunc, userPntr);
 
 // +--------------------------------------------------------------+
@@ -14,8 +22,15 @@ THREAD_FUNCTION_DEF(Win32_FileWatchingThreadFunc, userPntr);
 void Win32_InitFileWatching()
 {
 	FileWatchingContext_t* context = &Platform->fileWatchingContext;
+	ClearPointer(context);
+	context->nextFileId = 1;
+	context->nextFolderId = 1;
 	CreateLinkedList(&context->watchedFiles, &Platform->mainHeap, PlatWatchedFile_t);
+	CreateLinkedList(&context->watchedFolders, &Platform->mainHeap, FileWatchingFolder_t);
+	CreateVarArray(&context->pendingFiles, &Platform->threadSafeHeap, sizeof(PlatWatchedFile_t*), 64);
 	Win32_CreateMutex(&context->watchedFilesMutex);
+	context->completionPort = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, 1);
+	Assert(context->completionPort != NULL);
 	Platform->fileWatchingThread = Win32_CreateThread(Win32_FileWatchingThreadFunc, context);
 }
 
@@ -32,12 +47,178 @@ FILETIME Win32_GetFileWriteTime(MyStr_t filePath)
 	return lastWriteTime;
 }
 
+// +--------------------------------------------------------------+
+// |                           Helpers                            |
+// +--------------------------------------------------------------+
+//NOTE: Paths are hashed case-insensitive and with / and \ treated the same, to match how Windows compares paths
+u64 Win32_GetWatchPathHash(MyStr_t fullPath)
+{
+	u64 result = 0;
+	for (u64 cIndex = 0; cIndex < fullPath.length; cIndex++)
+	{
+		char c = fullPath.chars[cIndex];
+		if (c >= 'A' && c <= 'Z') { c = 'a' + (c - 'A'); }
+		if (c == '/') { c = '\\'; }
+		result = ((cIndex == 0) ? FnvHashU64(&c, sizeof(c)) : FnvHashU64(&c, sizeof(c), result));
+	}
+	return result;
+}
+
+//NOTE: Caller must hold watchedFilesMutex
+PlatWatchedFile_t* Win32_FindWatchedFileByPath(FileWatchingContext_t* context, MyStr_t fullPath, u64 hash)
+{
+	PlatWatchedFile_t* filePntr = context->buckets[hash & (FILE_WATCHING_NUM_BUCKETS-1)];
+	while (filePntr != nullptr)
+	{
+		if (filePntr->hash == hash && StrEqualsIgnoreCase(filePntr->fullPath, fullPath)) { return filePntr; }
+		filePntr = filePntr->nextInBucket;
+	}
+	return nullptr;
+}
+
+//NOTE: Caller must hold watchedFilesMutex
+FileWatchingFolder_t* Win32_FindWatchedFolder(FileWatchingContext_t* context, MyStr_t folderPath, u64 hash)
+{
+	FileWatchingFolder_t* folder = LinkedListFirst(&context->watchedFolders, FileWatchingFolder_t);
+	for (u64 fIndex = 0; fIndex < context->watchedFolders.count; fIndex++)
+	{
+		NotNull(folder);
+		if (folder->hash == hash && StrEqualsIgnoreCase(folder->fullPath, folderPath)) { return folder; }
+		folder = LinkedListNext(&context->watchedFolders, FileWatchingFolder_t, folder);
+	}
+	return nullptr;
+}
+
+//NOTE: Caller must hold watchedFilesMutex. Only called on the watching thread
+bool Win32_IssueFolderRead(FileWatchingFolder_t* folder)
+{
+	NotNull(folder);
+	ClearStruct(folder->overlapped);
+	BOOL readResult = ReadDirectoryChangesW(
+		folder->handle, //hDirectory
+		&folder->buffer[0], //lpBuffer
+		sizeof(folder->buffer), //nBufferLength
+		FALSE, //bWatchSubtree
+		FILE_WATCHING_NOTIFY_FILTER, //dwNotifyFilter
+		nullptr, //lpBytesReturned
+		&folder->overlapped, //lpOverlapped
+		nullptr //lpCompletionRoutine
+	);
+	folder->isReading = (readResult != 0);
+	if (!folder->isReading) { PrintLine_W("ReadDirectoryChangesW failed on \"%.*s\": %s", StrPrint(folder->fullPath), Win32_GetErrorCodeStr(GetLastError(), true)); }
+	return folder->isReading;
+}
+
+//NOTE: Caller must hold watchedFilesMutex
+void Win32_MarkWatchedFileChanged(FileWatchingContext_t* context, PlatWatchedFile_t* watchedFile, u64 programTime)
+{
+	watchedFile->lastChangeTime = programTime;
+	if (!watchedFile->isPending)
+	{
+		watchedFile->isPending = true;
+		PlatWatchedFile_t** newPendingPntr = VarArrayAdd(&context->pendingFiles, PlatWatchedFile_t*);
+		NotNull(newPendingPntr);
+		*newPendingPntr = watchedFile;
+	}
+}
+
+//NOTE: Caller must hold watchedFilesMutex. Only called on the watching thread
+void Win32_ProcessFolderNotifications(FileWatchingContext_t* context, FileWatchingFolder_t* folder, DWORD numBytesReturned)
+{
+	u64 programTime = Win32_GetProgramTime(nullptr, true);
+	
+	if (numBytesReturned == 0)
+	{
+		//NOTE: The buffer overflowed (or the OS decided not to tell us what happened) so we treat every file in the folder as changed
+		context->stats.numOverflows++;
+		PlatWatchedFile_t* filePntr = LinkedListFirst(&context->watchedFiles, PlatWatchedFile_t);
+		for (u64 fIndex = 0; fIndex < context->watchedFiles.count; fIndex++)
+		{
+			NotNull(filePntr);
+			if (filePntr->folder == folder) { Win32_MarkWatchedFileChanged(context, filePntr, programTime); }
+			filePntr = LinkedListNext(&context->watchedFiles, PlatWatchedFile_t, filePntr);
+		}
+		return;
+	}
+	
+	char fullPathBuffer[MAX_PATH*2];
+	Assert(folder->fullPath.length + 1 < ArrayCount(fullPathBuffer));
+	MyMemCopy(&fullPathBuffer[0], folder->fullPath.chars, folder->fullPath.length);
+	fullPathBuffer[folder->fullPath.length] = '\\';
+	u64 fileNameOffset = folder->fullPath.length + 1;
+	
+	u8* bufferBytes = (u8*)&folder->buffer[0];
+	u64 byteIndex = 0;
+	while (byteIndex < numBytesReturned)
+	{
+		FILE_NOTIFY_INFORMATION* notifyInfo = (FILE_NOTIFY_INFORMATION*)(bufferBytes + byteIndex);
+		context->stats.numNotifications++;
+		
+		if (notifyInfo->Action != FILE_ACTION_REMOVED && notifyInfo->Action != FILE_ACTION_RENAMED_OLD_NAME)
+		{
+			int fileNameLength = WideCharToMultiByte(
+				CP_UTF8, //CodePage
+				0, //dwFlags
+				&notifyInfo->FileName[0], //lpWideCharStr
+				(int)(notifyInfo->FileNameLength / sizeof(WCHAR)), //cchWideChar
+				&fullPathBuffer[fileNameOffset], //lpMultiByteStr
+				(int)(ArrayCount(fullPathBuffer) - fileNameOffset), //cbMultiByte
+				nullptr, //lpDefaultChar
+				nullptr //lpUsedDefaultChar
+			);
+			if (fileNameLength > 0)
+			{
+				MyStr_t fullPath = NewStr(fileNameOffset + (u64)fileNameLength, &fullPathBuffer[0]);
+				PlatWatchedFile_t* watchedFile = Win32_FindWatchedFileByPath(context, fullPath, Win32_GetWatchPathHash(fullPath));
+				if (watchedFile != nullptr) { Win32_MarkWatchedFileChanged(context, watchedFile, programTime); }
+			}
+		}
+		
+		if (notifyInfo->NextEntryOffset == 0) { break; }
+		byteIndex += notifyInfo->NextEntryOffset;
+	}
+}
+
 // +--------------------------------------------------------------+
 // |                            Update                            |
 // +--------------------------------------------------------------+
+//NOTE: Called once per frame on the main thread. Any pending changes that have settled get delivered here
+//      all together so the engine sees a single batch of changes for the frame
 void Win32_UpdateFileWatching()
 {
-	//TODO: Put this on another thread?
+	FileWatchingContext_t* context = &Platform->fileWatchingContext;
+	//NOTE: The watching thread appends to pendingFiles, so even the empty check has to happen under the lock
+	Win32_LockMutex(&context->watchedFilesMutex, MUTEX_LOCK_INFINITE);
+	if (context->pendingFiles.length == 0)
+	{
+		Win32_UnlockMutex(&context->watchedFilesMutex);
+		Platform->engineActiveInput.numWatchedFileChanges = context->numChangesDelivered;
+		return;
+	}
+	
+	u64 programTime = Win32_GetProgramTime(nullptr, true);
+	for (u64 pIndex = 0; pIndex < context->pendingFiles.length; )
+	{
+		PlatWatchedFile_t* watchedFile = *VarArrayGet(&context->pendingFiles, pIndex, PlatWatchedFile_t*);
+		if (programTime >= watchedFile->lastChangeTime + FILE_WATCHING_NOTIFY_DELAY)
+		{
+			watchedFile->lastWriteTime = Win32_GetFileWriteTime(watchedFile->fullPath);
+			watchedFile->isPending = false;
+			u32 oldChangedValue = Win32_InterlockedExchange(&watchedFile->changed, 1);
+			UNUSED(oldChangedValue);
+			context->numChangesDelivered++;
+			context->stats.numChangesDelivered++;
+			VarArrayRemove(&context->pendingFiles, pIndex, PlatWatchedFile_t*);
+			//don't increment pIndex
+		}
+		else
+		{
+			pIndex++;
+		}
+	}
+	Win32_UnlockMutex(&context->watchedFilesMutex);
+	
+	Platform->engineActiveInput.numWatchedFileChanges = context->numChangesDelivered;
 }
 
 // +--------------------------------------------------------------+
@@ -54,18 +235,12 @@ PLAT_API_IS_FILE_WATCHED_DEF(Win32_IsFileWatched)
 	
 	MyStr_t fullFilePath = Win32_GetFullPath(GetTempArena(), filePath, true);
 	
-	PlatWatchedFile_t* filePntr = LinkedListFirst(&context->watchedFiles, PlatWatchedFile_t);
-	for (u64 fIndex = 0; fIndex < context->watchedFiles.count; fIndex++)
-	{
-		NotNull(filePntr);
-		if (StrEqualsIgnoreCase(filePntr->fullPath, fullFilePath))
-		{
-			if (watchedFileOut != nullptr) { *watchedFileOut = filePntr; }
-			return true;
-		}
-		filePntr = LinkedListNext(&context->watchedFiles, PlatWatchedFile_t, filePntr);
-	}
-	return false;
+	Win32_LockMutex(&context->watchedFilesMutex, MUTEX_LOCK_INFINITE);
+	PlatWatchedFile_t* filePntr = Win32_FindWatchedFileByPath(context, fullFilePath, Win32_GetWatchPathHash(fullFilePath));
+	Win32_UnlockMutex(&context->watchedFilesMutex);
+	
+	if (filePntr != nullptr && watchedFileOut != nullptr) { *watchedFileOut = filePntr; }
+	return (filePntr != nullptr);
 }
 
 // +==============================+
@@ -84,14 +259,63 @@ PLAT_API_WATCH_FILE_DEF(Win32_WatchFile)
 	MyStr_t fullFilePath = Win32_GetFullPath(GetTempArena(), filePath, true);
 	if (!Win32_DoesFileExist(fullFilePath, nullptr)) { return nullptr; }
 	
+	MyStr_t folderPath = GetDirectoryPart(fullFilePath);
+	if (folderPath.length > 0 && (folderPath.chars[folderPath.length-1] == '\\' || folderPath.chars[folderPath.length-1] == '/')) { folderPath.length--; }
+	u64 folderHash = Win32_GetWatchPathHash(folderPath);
+	
 	Win32_LockMutex(&context->watchedFilesMutex, MUTEX_LOCK_INFINITE);
+	
+	FileWatchingFolder_t* folder = Win32_FindWatchedFolder(context, folderPath, folderHash);
+	if (folder == nullptr)
+	{
+		folder = LinkedListAdd(&context->watchedFolders, FileWatchingFolder_t);
+		NotNull(folder);
+		ClearPointer(folder);
+		folder->id = context->nextFolderId;
+		context->nextFolderId++;
+		folder->hash = folderHash;
+		folder->fullPath = AllocString(&Platform->mainHeap, &folderPath);
+		folder->handle = CreateFileA(
+			folder->fullPath.chars, //lpFileName
+			FILE_LIST_DIRECTORY, //dwDesiredAccess
+			FILE_SHARE_READ|FILE_SHARE_WRITE|FILE_SHARE_DELETE, //dwShareMode
+			NULL, //lpSecurityAttributes
+			OPEN_EXISTING, //dwCreationDisposition
+			FILE_FLAG_BACKUP_SEMANTICS|FILE_FLAG_OVERLAPPED, //dwFlagsAndAttributes
+			NULL //hTemplateFile
+		);
+		if (folder->handle != INVALID_HANDLE_VALUE)
+		{
+			HANDLE portResult = CreateIoCompletionPort(folder->handle, context->completionPort, (ULONG_PTR)folder, 0);
+			Assert(portResult == context->completionPort);
+			//NOTE: The first read is issued on the watching thread, since IO requests get cancelled if the thread that issued them exits
+			PostQueuedCompletionStatus(context->completionPort, 0, FILE_WATCHING_WAKEUP_KEY, nullptr);
+		}
+		else
+		{
+			PrintLine_W("Failed to open folder \"%.*s\" for watching: %s", StrPrint(folderPath), Win32_GetErrorCodeStr(GetLastError(), true));
+		}
+		context->stats.numWatchedFolders++;
+	}
+	
 	PlatWatchedFile_t* result = LinkedListAdd(&context->watchedFiles, PlatWatchedFile_t);
 	NotNull(result);
 	ClearPointer(result);
+	result->id = context->nextFileId;
+	context->nextFileId++;
 	result->path = AllocString(&Platform->mainHeap, &filePath);
 	result->fullPath = AllocString(&Platform->mainHeap, &fullFilePath);
-	result->lastWriteTime = Win32_GetFileWriteTime(result->path);
+	result->lastWriteTime = Win32_GetFileWriteTime(result->fullPath);
+	result->hash = Win32_GetWatchPathHash(result->fullPath);
+	result->folder = folder;
+	folder->numWatchedFiles++;
 	Win32_CreateInterlockedInt(&result->changed, 0);
+	
+	u64 bucketIndex = (result->hash & (FILE_WATCHING_NUM_BUCKETS-1));
+	result->nextInBucket = context->buckets[bucketIndex];
+	context->buckets[bucketIndex] = result;
+	context->stats.numWatchedFiles++;
+	
 	Win32_UnlockMutex(&context->watchedFilesMutex);
 	
 	DebugAssert(Win32_IsFileWatched(filePath, nullptr));
@@ -114,12 +338,35 @@ PLAT_API_UNWATCH_FILE_DEF(Win32_UnwatchFile)
 	bool foundInList = IsItemInLinkedList(&context->watchedFiles, watchedFile, &listIndex);
 	if (!foundInList)
 	{
+		Win32_UnlockMutex(&context->watchedFilesMutex);
 		return false;
 	}
 	
+	PlatWatchedFile_t** bucketLink = &context->buckets[nonConstFile->hash & (FILE_WATCHING_NUM_BUCKETS-1)];
+	while (*bucketLink != nullptr && *bucketLink != nonConstFile) { bucketLink = &(*bucketLink)->nextInBucket; }
+	Assert(*bucketLink == nonConstFile);
+	*bucketLink = nonConstFile->nextInBucket;
+	
+	if (nonConstFile->isPending)
+	{
+		VarArrayLoop(&context->pendingFiles, pIndex)
+		{
+			VarArrayLoopGet(PlatWatchedFile_t*, pendingPntr, &context->pendingFiles, pIndex);
+			if (*pendingPntr == nonConstFile) { VarArrayRemove(&context->pendingFiles, pIndex, PlatWatchedFile_t*); break; }
+		}
+	}
+	
+	//NOTE: We leave the folder watch alive even if it has no files left in it. Events for files we
+	//      don't care about get dropped by the hash lookup, and the set of folders a game watches is small
+	NotNull(nonConstFile->folder);
+	Assert(nonConstFile->folder->numWatchedFiles > 0);
+	nonConstFile->folder->numWatchedFiles--;
+	
 	FreeString(&Platform->mainHeap, &nonConstFile->path);
 	FreeString(&Platform->mainHeap, &nonConstFile->fullPath);
 	LinkedListRemove(&context->watchedFiles, PlatWatchedFile_t, nonConstFile);
+	Assert(context->stats.numWatchedFiles > 0);
+	context->stats.numWatchedFiles--;
 	Win32_UnlockMutex(&context->watchedFilesMutex);
 	
 	return true;
@@ -134,33 +381,43 @@ PLAT_API_UNWATCH_FILE_DEF(Win32_UnwatchFile)
 THREAD_FUNCTION_DEF(Win32_FileWatchingThreadFunc, userPntr) //pre-declared at top of file
 {
 	NotNull_(userPntr);
+	Win32_BindThisThread(false, nullptr);
 	FileWatchingContext_t* context = (FileWatchingContext_t*)userPntr;
 	while (true)
 	{
+		DWORD numBytesTransferred = 0;
+		ULONG_PTR completionKey = 0;
+		OVERLAPPED* overlapped = nullptr;
+		BOOL getResult = GetQueuedCompletionStatus(context->completionPort, &numBytesTransferred, &completionKey, &overlapped, INFINITE);
+		
 		Win32_LockMutex(&context->watchedFilesMutex, MUTEX_LOCK_INFINITE);
-		PlatWatchedFile_t* filePntr = LinkedListFirst(&context->watchedFiles, PlatWatchedFile_t);
-		for (u64 fIndex = 0; fIndex < context->watchedFiles.count; fIndex++)
+		context->stats.numWakeups++;
+		
+		if (completionKey != FILE_WATCHING_WAKEUP_KEY)
 		{
-			NotNull(filePntr);
-			//TODO: Do we need to check for the file getting deleted and count that as a change?
-			//TODO: Do we need to check for the file being re-created after a delete?
-			FILETIME newWriteTime = Win32_GetFileWriteTime(filePntr->fullPath);
-			if (CompareFileTime(&newWriteTime, &filePntr->lastWriteTime) != 0)
-			{
-				//TODO: Passing false for ignoreFixedTimeScaleEffects might mean this is no longer thread safe!? Since we access Platform-> variables that might be changing!
-				filePntr->lastWriteTimeChange = Win32_GetProgramTime(nullptr, true);
-				filePntr->lastWriteTime = newWriteTime;
-			}
-			if (filePntr->lastWriteTimeChange != 0 && Win32_TimeSince(filePntr->lastWriteTimeChange, true) >= 1000)
-			{
-				u32 oldChangedValue = Win32_InterlockedExchange(&filePntr->changed, 1);
-				UNUSED(oldChangedValue);
-				filePntr->lastWriteTimeChange = 0;
-			}
-			filePntr = LinkedListNext(&context->watchedFiles, PlatWatchedFile_t, filePntr);
+			FileWatchingFolder_t* folder = (FileWatchingFolder_t*)completionKey;
+			folder->isReading = false;
+			if (getResult) { Win32_ProcessFolderNotifications(context, folder, numBytesTransferred); }
 		}
-		Win32_UnlockMutex(&context->watchedFilesMutex);
 		
-		Win32_SleepForMs(FILE_WATCHING_SLEEP_TIME);
+		//NOTE: (Re-)issue reads for any folder that isn't currently waiting on one, this covers both the
+		//      folder that just completed and any new folders that WatchFile poked us about
+		FileWatchingFolder_t* folder = LinkedListFirst(&context->watchedFolders, FileWatchingFolder_t);
+		for (u64 fIndex = 0; fIndex < context->watchedFolders.count; fIndex++)
+		{
+			NotNull(folder);
+			if (!folder->isReading && folder->handle != INVALID_HANDLE_VALUE) { Win32_IssueFolderRead(folder); }
+			folder = LinkedListNext(&context->watchedFolders, FileWatchingFolder_t, folder);
+		}
+		
+		FILETIME creationTime, exitTime, kernelTime, userTime;
+		if (GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+		{
+			u64 kernelTicks = (((u64)kernelTime.dwHighDateTime << 32) | (u64)kernelTime.dwLowDateTime);
+			u64 userTicks = (((u64)userTime.dwHighDateTime << 32) | (u64)userTime.dwLowDateTime);
+			context->stats.threadCpuTime = (r64)(kernelTicks + userTicks) / 10000.0; //100ns ticks -> ms
+		}
+		
+		Win32_UnlockMutex(&context->watchedFilesMutex);
 	}
 }
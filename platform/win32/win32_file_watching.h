@@ -7,10 +7,36 @@ Date:   01\23\2022
 #ifndef _WIN_32_FILE_WATCHING_H
 #define _WIN_32_FILE_WATCHING_H
 
+//NOTE: We watch folders, not files. Every folder that contains at least one watched file gets
+//      a ReadDirectoryChangesW request that completes on an IO completion port, so the watching
+//      thread sleeps until the OS actually tells us something changed.
+struct FileWatchingFolder_t
+{
+	u64 id;
+	u64 hash;
+	MyStr_t fullPath; //no trailing slash
+	u64 numWatchedFiles;
+	
+	HANDLE handle;
+	bool isReading;
+	OVERLAPPED overlapped;
+	DWORD buffer[FILE_WATCHING_BUFFER_SIZE / sizeof(DWORD)]; //FILE_NOTIFY_INFORMATION entries must be DWORD aligned
+};
+
 struct FileWatchingContext_t
 {
 	PlatMutex_t watchedFilesMutex;
-	LinkedList_t watchedFiles;
+	u64 nextFileId;
+	u64 nextFolderId;
+	LinkedList_t watchedFiles; //PlatWatchedFile_t
+	LinkedList_t watchedFolders; //FileWatchingFolder_t
+	PlatWatchedFile_t* buckets[FILE_WATCHING_NUM_BUCKETS]; //chained through PlatWatchedFile_t::nextInBucket
+	
+	HANDLE completionPort;
+	VarArray_t pendingFiles; //PlatWatchedFile_t* that have seen a change but haven't been delivered yet
+	u64 numChangesDelivered;
+	
+	PlatFileWatchingStats_t stats;
 };
 
 #endif //  _WIN_32_FILE_WATCHING_H
@@ -698,6 +698,128 @@ PLAT_API_CLOSE_FILE_DEFINITION(Win32_CloseFile)
 	openFile->handle = INVALID_HANDLE_VALUE;
 }
 
+// +==============================+
+// |        Win32_MapFile         |
+// +==============================+
+// Unlike ReadFileContents, no copy of the file is made. The data is read-only, is NOT null-terminated,
+// and stays valid until UnmapFile is called. Pages are pulled in from disk as they are touched.
+// Files that are being watched get a buffered copy instead, see below
+// bool MapFile(MyStr_t filePath, PlatMappedFile_t* mappedFileOut)
+PLAT_API_MAP_FILE_DEF(Win32_MapFile)
+{
+	//NOTE: This function should be multi-thread safe!
+	NotNull(Platform);
+	NotEmptyStr(&filePath);
+	NotNull(mappedFileOut);
+	ClearPointer(mappedFileOut);
+	mappedFileOut->fileHandle = INVALID_HANDLE_VALUE;
+	
+	//NOTE: Watched files are the ones that get rewritten while we are running (that's how hot reloading works). If an editor
+	//      truncates or replaces the file while a view is open, touching the missing pages raises EXCEPTION_IN_PAGE_ERROR
+	//      in whatever parser is reading it. A plain copy can't change underneath us so we give those files a buffered read
+	if (InitPhase > Win32InitPhase_SteamInitialized && Win32_IsFileWatched(filePath, nullptr))
+	{
+		if (!Win32_ReadFileContents(filePath, &Platform->threadSafeHeap, false, &mappedFileOut->bufferedContents))
+		{
+			mappedFileOut->errorCode = mappedFileOut->bufferedContents.errorCode;
+			return false;
+		}
+		mappedFileOut->isBuffered = true;
+		mappedFileOut->size = mappedFileOut->bufferedContents.size;
+		mappedFileOut->data = mappedFileOut->bufferedContents.data;
+		mappedFileOut->id = mappedFileOut->bufferedContents.id;
+		mappedFileOut->isOpen = true;
+		return true;
+	}
+	
+	TempPushMark();
+	MyStr_t fullPath = Win32_GetFullPath(GetTempArena(), filePath, true);
+	
+	mappedFileOut->fileHandle = CreateFileA(
+		fullPath.pntr,         //lpFileName
+		GENERIC_READ,          //dwDesiredAccess
+		FILE_SHARE_READ,       //dwShareMode
+		NULL,                  //lpSecurityAttributes (NULL: no sub process access)
+		OPEN_EXISTING,         //dwCreationDisposition
+		FILE_ATTRIBUTE_NORMAL, //dwFlagsAndAttributes
+		NULL                   //hTemplateFile
+	);
+	if (mappedFileOut->fileHandle == INVALID_HANDLE_VALUE)
+	{
+		mappedFileOut->errorCode = GetLastError();
+		PrintLine_E("Failed to open file for mapping at \"%.*s\". Error code: %s", StrPrint(fullPath), Win32_GetErrorCodeStr(mappedFileOut->errorCode, true));
+		TempPopMark();
+		return false;
+	}
+	
+	LARGE_INTEGER fileSize;
+	if (GetFileSizeEx(mappedFileOut->fileHandle, &fileSize) == 0)
+	{
+		mappedFileOut->errorCode = GetLastError();
+		PrintLine_E("Failed to get size of file at \"%.*s\". Error code: %s", StrPrint(fullPath), Win32_GetErrorCodeStr(mappedFileOut->errorCode, true));
+		CloseHandle(mappedFileOut->fileHandle);
+		mappedFileOut->fileHandle = INVALID_HANDLE_VALUE;
+		TempPopMark();
+		return false;
+	}
+	mappedFileOut->size = (u64)fileSize.QuadPart;
+	
+	//NOTE: CreateFileMapping refuses to map empty files, so those are "mapped" with no view at all
+	if (mappedFileOut->size > 0)
+	{
+		mappedFileOut->mappingHandle = CreateFileMappingA(
+			mappedFileOut->fileHandle, //hFile
+			NULL,                      //lpFileMappingAttributes
+			PAGE_READONLY,             //flProtect
+			0, 0,                      //dwMaximumSizeHigh, dwMaximumSizeLow (0 = whole file)
+			NULL                       //lpName
+		);
+		if (mappedFileOut->mappingHandle != NULL)
+		{
+			mappedFileOut->data = (const u8*)MapViewOfFile(mappedFileOut->mappingHandle, FILE_MAP_READ, 0, 0, 0);
+		}
+		if (mappedFileOut->data == nullptr)
+		{
+			mappedFileOut->errorCode = GetLastError();
+			PrintLine_E("Failed to map file at \"%.*s\". Error code: %s", StrPrint(fullPath), Win32_GetErrorCodeStr(mappedFileOut->errorCode, true));
+			if (mappedFileOut->mappingHandle != NULL) { CloseHandle(mappedFileOut->mappingHandle); }
+			CloseHandle(mappedFileOut->fileHandle);
+			ClearPointer(mappedFileOut);
+			mappedFileOut->fileHandle = INVALID_HANDLE_VALUE;
+			TempPopMark();
+			return false;
+		}
+	}
+	
+	mappedFileOut->id = Platform->nextMappedFileId; //TODO: Make this thread safe!
+	Platform->nextMappedFileId++;
+	mappedFileOut->isOpen = true;
+	TempPopMark();
+	return true;
+}
+
+// +==============================+
+// |       Win32_UnmapFile        |
+// +==============================+
+// void UnmapFile(PlatMappedFile_t* mappedFile)
+PLAT_API_UNMAP_FILE_DEF(Win32_UnmapFile)
+{
+	//NOTE: This function should be multi-thread safe!
+	NotNull(mappedFile);
+	if (mappedFile->isBuffered)
+	{
+		Win32_FreeFileContents(&mappedFile->bufferedContents);
+		ClearPointer(mappedFile);
+		mappedFile->fileHandle = INVALID_HANDLE_VALUE;
+		return;
+	}
+	if (mappedFile->data != nullptr) { UnmapViewOfFile(mappedFile->data); }
+	if (mappedFile->mappingHandle != NULL) { CloseHandle(mappedFile->mappingHandle); }
+	if (mappedFile->isOpen && mappedFile->fileHandle != INVALID_HANDLE_VALUE) { CloseHandle(mappedFile->fileHandle); }
+	ClearPointer(mappedFile);
+	mappedFile->fileHandle = INVALID_HANDLE_VALUE;
+}
+
 // +--------------------------------------------------------------+
 // |                       Stream Callbacks                       |
 // +--------------------------------------------------------------+
@@ -865,22 +987,22 @@ PLAT_API_OPEN_FILE_STREAM_DEFINITION(Win32_OpenFileStream)
 // +==============================+
 // |   Win32_TryParseImageFile    |
 // +==============================+
-// bool TryParseImageFile(const PlatFileContents_t* contents, u8 desiredPixelSize, PlatImageData_t* imageOut)
+// The file can come from ReadFileContents or MapFile, stb_image only reads from it
+// bool TryParseImageFile(u64 fileSize, const void* filePntr, u8 desiredPixelSize, PlatImageData_t* imageOut)
 PLAT_API_TRY_PARSE_IMAGE_FILE_DEF(Win32_TryParseImageFile)
 {
 	//NOTE: This function should be multi-thread safe!
-	NotNull(contents);
 	NotNull(imageOut);
 	ClearPointer(imageOut);
-	if (contents->size == 0 || contents->data == nullptr) { return false; }
+	if (fileSize == 0 || filePntr == nullptr) { return false; }
 	
 	//TODO: Should we upgrade stbi_load_from_memory to support u64 sized files?
-	AssertMsg(contents->size <= INT_MAX, "Image file was too big to parse. STB Image doesn't support super large file sizes");
+	AssertMsg(fileSize <= INT_MAX, "Image file was too big to parse. STB Image doesn't support super large file sizes");
 	
 	int stbNumChannels;
 	int stbWidth, stbHeight;
 	u8* stbImageData = stbi_load_from_memory(
-		contents->data, (int)contents->size,
+		(const stbi_uc*)filePntr, (int)fileSize,
 		&stbWidth, &stbHeight,
 		&stbNumChannels,
 		desiredPixelSize
@@ -240,6 +240,9 @@ PLAT_API_BAKE_FONT_DEF(Win32_BakeFont)
 		return false;
 	}
 	
+	stbtt_fontinfo fontInfo = {};
+	bool haveFontInfo = (stbtt_InitFont(&fontInfo, fontFile->data, stbtt_GetFontOffsetForIndex(fontFile->data, 0)) != 0);
+	
 	// TODO: Do we want to use this function and glean some sort of sub-pixel alignment information from it?
 	// void stbtt_GetPackedQuad(stbtt_packedchar *chardata, int pw, int ph, int char_index, float *xpos, float *ypos, stbtt_aligned_quad *q, int align_to_integer)
 	
@@ -313,6 +316,7 @@ PLAT_API_BAKE_FONT_DEF(Win32_BakeFont)
 			charData->offset = NewVec2(stbChar->xoff, stbChar->yoff);
 			charData->offset2 = NewVec2(stbChar->xoff2, stbChar->yoff2);
 			charData->advanceX = stbChar->xadvance;
+			charData->isNotdef = (haveFontInfo && stbtt_FindGlyphIndex(&fontInfo, (int)charData->codepoint) == 0);
 			cIndex++;
 		}
 		if (stbRange->array_of_unicode_codepoints != nullptr) { FreeMem(&Platform->stdHeap, stbRange->array_of_unicode_codepoints, sizeof(int) * stbRange->num_chars); }
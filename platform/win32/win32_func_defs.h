@@ -28,6 +28,11 @@ PLAT_API_GET_THIS_THREAD_ID_DEF(Win32_GetThisThreadId);
 #define AssertSingleThreaded()  Assert(IsMainThread())
 #define AssertSingleThreaded_() Assert_(IsMainThread())
 
+// +==============================+
+// |   win32_file_watching.cpp    |
+// +==============================+
+PLAT_API_IS_FILE_WATCHED_DEF(Win32_IsFileWatched);
+
 // +==============================+
 // |    win32_performance.cpp     |
 // +==============================+
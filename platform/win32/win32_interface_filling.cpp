@@ -114,6 +114,7 @@ void Win32_FillPlatformInfo(PlatformInfo_t* info, PerfTime_t programStartPerfTim
 	info->mainThreadId.osId = MainThreadId;
 	info->fileWatchingThreadId.internalId = ((Platform->fileWatchingThread != nullptr) ? Platform->fileWatchingThread->id : 0);
 	info->fileWatchingThreadId.osId = ((Platform->fileWatchingThread != nullptr) ? (ThreadId_t)Platform->fileWatchingThread->win32_id : 0);
+	info->fileWatchingStats = &Platform->fileWatchingContext.stats;
 	info->audioThreadId.internalId = ((Platform->audioThread != nullptr) ? Platform->audioThread->id : 0);
 	info->audioThreadId.osId = ((Platform->audioThread != nullptr) ? (ThreadId_t)Platform->audioThread->win32_id : 0);
 	u64 filledThreadIndex = 0;
@@ -185,6 +186,8 @@ void Win32_FillPlatformApi(PlatformApi_t* api)
 	api->CloseFile                  = Win32_CloseFile;
 	api->ReadFileContentsStream     = Win32_ReadFileContentsStream;
 	api->OpenFileStream             = Win32_OpenFileStream;
+	api->MapFile                    = Win32_MapFile;
+	api->UnmapFile                  = Win32_UnmapFile;
 	api->TryParseImageFile          = Win32_TryParseImageFile;
 	api->SaveImageDataToFile        = Win32_SaveImageDataToFile;
 	api->FreeImageData              = Win32_FreeImageData;
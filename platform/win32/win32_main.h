@@ -51,6 +51,7 @@ struct Win32PlatformState_t
 	u64 nextMonitorVideoModeId;
 	u64 nextFileContentsId;
 	u64 nextOpenFileId;
+	u64 nextMappedFileId;
 	u64 nextWatchedFileId;
 	u64 nextThreadId;
 	u64 nextMutexId;
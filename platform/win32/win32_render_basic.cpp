@@ -152,7 +152,7 @@ Win32_Texture_t Win32_LoadTexture_OpenGL(MyStr_t filePath, bool pixelated, bool
 		return result;
 	}
 	
-	if (!Win32_TryParseImageFile(&imageFile, 4, &imageData))
+	if (!Win32_TryParseImageFile(imageFile.size, imageFile.data, 4, &imageData))
 	{
 		PrintLine_E("Failed to parse image file as an image using stb_image at \"%.*s\"!", StrPrint(fullPath));
 		Win32_FreeFileContents(&imageFile);
@@ -64,6 +64,29 @@ struct PlatOpenFile_t
 	HANDLE handle;
 };
 
+//NOTE: A read-only view of a whole file, backed by the OS page cache rather than a copy in one of our arenas
+struct PlatMappedFile_t
+{
+	u64 id;
+	bool isOpen;
+	union
+	{
+		u64 size;
+		u64 length;
+	};
+	union
+	{
+		const u8* data;
+		const char* chars;
+	};
+	
+	DWORD errorCode;
+	HANDLE fileHandle;
+	HANDLE mappingHandle;
+	bool isBuffered; //watched files are read into bufferedContents instead of being mapped, see Win32_MapFile
+	PlatFileContents_t bufferedContents;
+};
+
 // +--------------------------------------------------------------+
 // |                           Threads                            |
 // +--------------------------------------------------------------+
@@ -213,7 +236,11 @@ struct PlatWatchedFile_t
 	MyStr_t fullPath;
 	PlatInterlockedInt_t changed;
 	
-	u64 lastWriteTimeChange;
+	u64 hash; //of fullPath, case-insensitive
+	struct FileWatchingFolder_t* folder;
+	PlatWatchedFile_t* nextInBucket;
+	bool isPending;
+	u64 lastChangeTime; //the programTime of the most recent notification, used to debounce
 	FILETIME lastWriteTime;
 };
 
@@ -16,6 +16,12 @@ Description:
 THREAD_FUNCTION_DEF(Win32_WorkerThreadInit, userPntr);
 GYLIB_GET_TEMP_ARENA_DEF(Win32_GetTempArena);
 
+//Every thread we create (plus the main thread) binds these once when it starts so Win32_GetTempArena and
+//Win32_GetThreadContext can answer for the calling thread without comparing ids or searching the thread pool
+thread_local bool Win32_ThisThreadIsBound = false;
+thread_local bool Win32_ThisThreadIsMain = false;
+thread_local PlatThreadPoolThread_t* Win32_ThisThreadPoolThread = nullptr;
+
 // +--------------------------------------------------------------+
 // |                       Mutex Functions                        |
 // +--------------------------------------------------------------+
@@ -272,10 +278,19 @@ bool Win32_DestroyThread(PlatThread_t* thread)
 // +--------------------------------------------------------------+
 // |                          Initialize                          |
 // +--------------------------------------------------------------+
+//NOTE: poolThread should be nullptr for threads that don't come from the thread pool (audio, file watching, etc.)
+void Win32_BindThisThread(bool isMainThread, PlatThreadPoolThread_t* poolThread)
+{
+	Win32_ThisThreadIsMain = isMainThread;
+	Win32_ThisThreadPoolThread = poolThread;
+	Win32_ThisThreadIsBound = true;
+}
+
 void Win32_InitThreading()
 {
 	MainThreadId = Win32_GetThisThreadId();
 	AssertMsg(IsMainThread(), "Our IsMainThread macro must be broken");
+	Win32_BindThisThread(true, nullptr);
 	
 	Platform->nextThreadId = 1;
 	Platform->nextTaskId = 1;
@@ -364,6 +379,10 @@ PLAT_API_GET_THIS_THREAD_ID_DEF(Win32_GetThisThreadId)
 // PlatThreadPoolThread_t* GetThreadContext(ThreadId_t threadId)
 PLAT_API_GET_THREAD_CONTEXT(Win32_GetThreadContext)
 {
+	if (Win32_ThisThreadPoolThread != nullptr && Win32_ThisThreadPoolThread->threadPntr != nullptr && Win32_ThisThreadPoolThread->threadPntr->win32_id == threadId)
+	{
+		return Win32_ThisThreadPoolThread;
+	}
 	for (u64 tIndex = 0; tIndex < Platform->threadPoolSize; tIndex++)
 	{
 		PlatThreadPoolThread_t* thread = &Platform->threadPool[tIndex];
@@ -428,6 +447,13 @@ PLAT_API_QUEUE_TASK_DEFINITION(Win32_QueueTask)
 // +==============================+
 GYLIB_GET_TEMP_ARENA_DEF(Win32_GetTempArena) //pre-declared at top of file
 {
+	if (Win32_ThisThreadIsBound)
+	{
+		if (Win32_ThisThreadIsMain) { return (TempArena != nullptr && TempArena->size > 0) ? TempArena : nullptr; }
+		else if (Win32_ThisThreadPoolThread != nullptr) { return (Win32_ThisThreadPoolThread->tempArena.size > 0) ? &Win32_ThisThreadPoolThread->tempArena : nullptr; }
+		else { return nullptr; }
+	}
+	
 	ThreadId_t thisThreadId = Win32_GetThisThreadId();
 	if (thisThreadId == MainThreadId)
 	{
@@ -537,6 +563,7 @@ THREAD_FUNCTION_DEF(Win32_WorkerThreadInit, userPntr) //pre-declared at top of f
 	NotNull_(userPntr);
 	PlatThreadPoolThread_t* context = (PlatThreadPoolThread_t*)userPntr;
 	
+	Win32_BindThisThread(false, context);
 	InitThreadLocalScratchArenasVirtual(context->scratchArenasMaxSize, context->scratchArenasMarkCount);
 	int result = Win32_WorkerThreadRun(userPntr);
 	FreeThreadLocalScratchArenas();
@@ -143,25 +143,25 @@ const char* Resources_GetPathForTexture(u64 textureIndex, ResourceTextureMetaInf
 	metaInfo->pixelated = false;
 	metaInfo->repeating = true;
 	metaInfo->numLayers = 0;
-	#define NORMAL_TEXTURE_META_INFO(isPixelated, isRepeating, folder, filename) metaInfo->pixelated = (isPixelated); metaInfo->repeating = (isRepeating); return RESOURCE_FOLDER_##folder "/" filename;
+	#define NORMAL_TEXTURE_META_INFO(isPixelated, isRepeating, isAtlasable, folder, filename) metaInfo->pixelated = (isPixelated); metaInfo->repeating = (isRepeating); metaInfo->atlasable = (isAtlasable); return RESOURCE_FOLDER_##folder "/" filename;
 	switch (textureIndex)
 	{
-		//                            pixelated repeating     folder               filename
-		case 0:  NORMAL_TEXTURE_META_INFO(true,  false, SPRITES,  "pig_piggybank.png");             //| piggybank        |
-		case 1:  NORMAL_TEXTURE_META_INFO(true,  false, SPRITES,  "pig_loading_image.png");         //| piggyLoading     |
-		case 2:  NORMAL_TEXTURE_META_INFO(true,  false, SPRITES,  "pig_piggyblob.png");             //| piggyBlob        |
-		case 3:  NORMAL_TEXTURE_META_INFO(true,  false, SPRITES,  "pig_gif_recording.png");         //| gifRecording     |
-		case 4:  NORMAL_TEXTURE_META_INFO(true,  false, SPRITES,  "pig_made_in_pig_engine.png");    //| madeInPigEngine  |
-		case 5:  NORMAL_TEXTURE_META_INFO(true,  true,  TEXTURES, "pig_alpha.png");                 //| alpha            |
-		case 6:  NORMAL_TEXTURE_META_INFO(true,  true,  TEXTURES, "pig_invalid.png");               //| defaultPink      |
-		case 7:  NORMAL_TEXTURE_META_INFO(true,  true,  TEXTURES, "pig_invalid_blue.png");          //| defaultBlue      |
-		case 8:  NORMAL_TEXTURE_META_INFO(true,  true,  TEXTURES, "pig_invalid_green.png");         //| defaultGreen     |
-		case 9:  NORMAL_TEXTURE_META_INFO(true,  true,  TEXTURES, "pig_invalid_purple.png");        //| defaultPurple    |
-		case 10: NORMAL_TEXTURE_META_INFO(true,  true,  TEXTURES, "pig_invalid_red.png");           //| defaultRed       |
-		case 11: NORMAL_TEXTURE_META_INFO(true,  true,  TEXTURES, "pig_invalid_yellow.png");        //| defaultYellow    |
-		case 12: NORMAL_TEXTURE_META_INFO(true,  true,  TEXTURES, "pig_blue_gradient.png");         //| blueGradientBack |
+		//                            pixelated repeating atlasable folder    filename
+		case 0:  NORMAL_TEXTURE_META_INFO(true,  false, true,  SPRITES,  "pig_piggybank.png");             //| piggybank        |
+		case 1:  NORMAL_TEXTURE_META_INFO(true,  false, true,  SPRITES,  "pig_loading_image.png");         //| piggyLoading     |
+		case 2:  NORMAL_TEXTURE_META_INFO(true,  false, true,  SPRITES,  "pig_piggyblob.png");             //| piggyBlob        |
+		case 3:  NORMAL_TEXTURE_META_INFO(true,  false, true,  SPRITES,  "pig_gif_recording.png");         //| gifRecording     |
+		case 4:  NORMAL_TEXTURE_META_INFO(true,  false, true,  SPRITES,  "pig_made_in_pig_engine.png");    //| madeInPigEngine  |
+		case 5:  NORMAL_TEXTURE_META_INFO(true,  true,  false, TEXTURES, "pig_alpha.png");                 //| alpha            |
+		case 6:  NORMAL_TEXTURE_META_INFO(true,  true,  false, TEXTURES, "pig_invalid.png");               //| defaultPink      |
+		case 7:  NORMAL_TEXTURE_META_INFO(true,  true,  false, TEXTURES, "pig_invalid_blue.png");          //| defaultBlue      |
+		case 8:  NORMAL_TEXTURE_META_INFO(true,  true,  false, TEXTURES, "pig_invalid_green.png");         //| defaultGreen     |
+		case 9:  NORMAL_TEXTURE_META_INFO(true,  true,  false, TEXTURES, "pig_invalid_purple.png");        //| defaultPurple    |
+		case 10: NORMAL_TEXTURE_META_INFO(true,  true,  false, TEXTURES, "pig_invalid_red.png");           //| defaultRed       |
+		case 11: NORMAL_TEXTURE_META_INFO(true,  true,  false, TEXTURES, "pig_invalid_yellow.png");        //| defaultYellow    |
+		case 12: NORMAL_TEXTURE_META_INFO(true,  true,  false, TEXTURES, "pig_blue_gradient.png");         //| blueGradientBack |
 		
-		case 13: NORMAL_TEXTURE_META_INFO(true, false,  SPRITES,  "main_menu.png");                 //| mainMenuBackground |
+		case 13: NORMAL_TEXTURE_META_INFO(true, false,  false, SPRITES,  "main_menu.png");                 //| mainMenuBackground |
 		
 		default: DebugAssert(false); return nullptr;
 	}
@@ -199,6 +199,7 @@ const char* Resources_GetPathForSheet(u64 sheetIndex, ResourceSheetMetaInfo_t* m
 		case 0:
 		{
 			metaInfo->numFrames = NewVec2i(4, 1);
+			metaInfo->trimFrames = true;
 			return RESOURCE_FOLDER_SHEETS "/pig_anim.png";
 		} break;
 		// +==============================+
@@ -404,18 +405,11 @@ const char* Resources_GetPathOrNameForFont(u64 fontIndex, ResourceFontMetaInfo_t
 		{
 			metaInfo->fontName = "debugFont";
 			metaInfo->requestFromPlatform = true;
-			metaInfo->faces[0].name  = NewStr("default18");    metaInfo->faces[0].size  = 18; metaInfo->faces[0].bold  = false; metaInfo->faces[0].italic  = false; metaInfo->faces[0].bakeSize  = NewVec2i(256, 256); metaInfo->faces[0].includeCyrillicBake = true; metaInfo->faces[0].includeJapaneseKanaBake = true; metaInfo->faces[0].includeBtnsSheet = true;
-			metaInfo->faces[1].name  = NewStr("bold18");       metaInfo->faces[1].size  = 18; metaInfo->faces[1].bold  = true;  metaInfo->faces[1].italic  = false; metaInfo->faces[1].bakeSize  = NewVec2i(256, 256);
-			metaInfo->faces[2].name  = NewStr("italic18");     metaInfo->faces[2].size  = 18; metaInfo->faces[2].bold  = false; metaInfo->faces[2].italic  = true;  metaInfo->faces[2].bakeSize  = NewVec2i(256, 256);
-			metaInfo->faces[3].name  = NewStr("bolditalic18"); metaInfo->faces[3].size  = 18; metaInfo->faces[3].bold  = true;  metaInfo->faces[3].italic  = true;  metaInfo->faces[3].bakeSize  = NewVec2i(256, 256);
-			metaInfo->faces[4].name  = NewStr("default12");    metaInfo->faces[4].size  = 12; metaInfo->faces[4].bold  = false; metaInfo->faces[4].italic  = false; metaInfo->faces[4].bakeSize  = NewVec2i(256, 256); metaInfo->faces[4].includeCyrillicBake = true; metaInfo->faces[4].includeJapaneseKanaBake = true; metaInfo->faces[4].includeBtnsSheet = true;
-			metaInfo->faces[5].name  = NewStr("bold12");       metaInfo->faces[5].size  = 12; metaInfo->faces[5].bold  = true;  metaInfo->faces[5].italic  = false; metaInfo->faces[5].bakeSize  = NewVec2i(256, 256);
-			metaInfo->faces[6].name  = NewStr("italic12");     metaInfo->faces[6].size  = 12; metaInfo->faces[6].bold  = false; metaInfo->faces[6].italic  = true;  metaInfo->faces[6].bakeSize  = NewVec2i(256, 256);
-			metaInfo->faces[7].name  = NewStr("bolditalic12"); metaInfo->faces[7].size  = 12; metaInfo->faces[7].bold  = true;  metaInfo->faces[7].italic  = true;  metaInfo->faces[7].bakeSize  = NewVec2i(256, 256);
-			metaInfo->faces[8].name  = NewStr("default24");    metaInfo->faces[8].size  = 24; metaInfo->faces[8].bold  = false; metaInfo->faces[8].italic  = false; metaInfo->faces[8].bakeSize  = NewVec2i(512, 512); metaInfo->faces[8].includeCyrillicBake = true; metaInfo->faces[8].includeJapaneseKanaBake = true; metaInfo->faces[8].includeBtnsSheet = true;
-			metaInfo->faces[9].name  = NewStr("bold24");       metaInfo->faces[9].size  = 24; metaInfo->faces[9].bold  = true;  metaInfo->faces[9].italic  = false; metaInfo->faces[9].bakeSize  = NewVec2i(512, 512);
-			metaInfo->faces[10].name = NewStr("italic24");     metaInfo->faces[10].size = 24; metaInfo->faces[10].bold = false; metaInfo->faces[10].italic = true;  metaInfo->faces[10].bakeSize = NewVec2i(512, 512);
-			metaInfo->faces[11].name = NewStr("bolditalic24"); metaInfo->faces[11].size = 24; metaInfo->faces[11].bold = true;  metaInfo->faces[11].italic = true;  metaInfo->faces[11].bakeSize = NewVec2i(512, 512);
+			//NOTE: Each face is a single distance field bake that gets drawn at whatever size the selector asks for (12, 18, 24, etc.)
+			metaInfo->faces[0].name = NewStr("default");    metaInfo->faces[0].size = 18; metaInfo->faces[0].bold = false; metaInfo->faces[0].italic = false; metaInfo->faces[0].isSdf = true; metaInfo->faces[0].bakeSize = NewVec2i(1024, 1024); metaInfo->faces[0].includeCyrillicBake = true; metaInfo->faces[0].includeJapaneseKanaBake = true; metaInfo->faces[0].includeBtnsSheet = true;
+			metaInfo->faces[1].name = NewStr("bold");       metaInfo->faces[1].size = 18; metaInfo->faces[1].bold = true;  metaInfo->faces[1].italic = false; metaInfo->faces[1].isSdf = true; metaInfo->faces[1].bakeSize = NewVec2i(1024, 1024);
+			metaInfo->faces[2].name = NewStr("italic");     metaInfo->faces[2].size = 18; metaInfo->faces[2].bold = false; metaInfo->faces[2].italic = true;  metaInfo->faces[2].isSdf = true; metaInfo->faces[2].bakeSize = NewVec2i(1024, 1024);
+			metaInfo->faces[3].name = NewStr("bolditalic"); metaInfo->faces[3].size = 18; metaInfo->faces[3].bold = true;  metaInfo->faces[3].italic = true;  metaInfo->faces[3].isSdf = true; metaInfo->faces[3].bakeSize = NewVec2i(1024, 1024);
 			// return "Verdana";
 			// return "Cascadia";
 			return "Consolas";